@@ -0,0 +1,205 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_binlog.h
+ *
+ * Compact binary log records for LOCI objects.
+ *
+ * A record is an 8 byte header followed by a sequence of tagged
+ * fields:
+ *
+ *   uint32_t length       Total record length including the header
+ *   uint16_t object_id    of_object_id_t of the logged object
+ *   uint8_t  version      of_version_t of the logged object
+ *   uint8_t  flags        LOCI_BINLOG_FLAG_*
+ *
+ * Each field starts with a one byte LOCI_BINLOG_TAG_* value which
+ * determines the size of what follows, so records can be walked
+ * without knowledge of the object layout.  Fields appear in the same
+ * order as the members in the JSON form of the object.  Multibyte
+ * integers are in the byte order of the writer; the header flags
+ * record which one that was.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_BINLOG_H_)
+#define _LOCI_BINLOG_H_
+
+#include <loci/loci_base.h>
+#include <loci/of_match.h>
+#include <loci/loci_stream.h>
+
+typedef void (*loci_obj_binlog_f)(loci_stream_t *s, of_object_t *obj);
+
+#define LOCI_BINLOG_HEADER_LENGTH 8
+
+#define LOCI_BINLOG_FLAG_BIG_ENDIAN 0x01
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LOCI_BINLOG_HOST_FLAGS LOCI_BINLOG_FLAG_BIG_ENDIAN
+#else
+#define LOCI_BINLOG_HOST_FLAGS 0
+#endif
+
+typedef enum loci_binlog_tag_e {
+    LOCI_BINLOG_TAG_END = 0,     /* Closes an OBJECT or LIST */
+    LOCI_BINLOG_TAG_U8 = 1,
+    LOCI_BINLOG_TAG_U16 = 2,
+    LOCI_BINLOG_TAG_U32 = 3,
+    LOCI_BINLOG_TAG_U64 = 4,
+    LOCI_BINLOG_TAG_MAC = 5,     /* 6 bytes */
+    LOCI_BINLOG_TAG_IPV4 = 6,    /* uint32_t */
+    LOCI_BINLOG_TAG_IPV6 = 7,    /* 16 bytes */
+    LOCI_BINLOG_TAG_BYTES = 8,   /* uint16_t length, data */
+    LOCI_BINLOG_TAG_STRING = 9,  /* uint16_t length, characters */
+    LOCI_BINLOG_TAG_BITMAP = 10, /* uint8_t count, uint64_t words LSW first */
+    LOCI_BINLOG_TAG_MATCH = 11,  /* uint8_t version, entries, MATCH_END */
+    LOCI_BINLOG_TAG_OBJECT = 12, /* uint16_t object_id, uint8_t version,
+                                  * fields, END */
+    LOCI_BINLOG_TAG_LIST = 13,   /* OBJECTs, END */
+} loci_binlog_tag_t;
+
+/*
+ * A match entry is the field index in of_match_fields_t (see
+ * loci_binlog_match_field_names), a width byte, then width bytes of
+ * value followed by width bytes of mask.  Only active fields appear.
+ */
+#define LOCI_BINLOG_MATCH_END 0xff
+
+/****************************************************************
+ *
+ * Per-datatype binary log macros
+ *
+ ****************************************************************/
+
+static inline void
+loci_binlog_put(loci_stream_t *s, int tag, const void *val, int len)
+{
+    uint8_t *out;
+
+    if ((out = loci_stream_reserve(s, len + 1)) == NULL) {
+        return;
+    }
+    out[0] = (uint8_t)tag;
+    MEMCPY(out + 1, val, len);
+    loci_stream_advance(s, len + 1);
+}
+
+#define LOCI_BINLOG_SCALAR(s, tag, type, val) do {      \
+        type _val = (val);                              \
+        loci_binlog_put(s, tag, &_val, sizeof(_val));   \
+    } while (0)
+
+#define LOCI_BINLOG_u8(s, val) LOCI_BINLOG_SCALAR(s, LOCI_BINLOG_TAG_U8, uint8_t, val)
+#define LOCI_BINLOG_u16(s, val) LOCI_BINLOG_SCALAR(s, LOCI_BINLOG_TAG_U16, uint16_t, val)
+#define LOCI_BINLOG_u32(s, val) LOCI_BINLOG_SCALAR(s, LOCI_BINLOG_TAG_U32, uint32_t, val)
+#define LOCI_BINLOG_u64(s, val) LOCI_BINLOG_SCALAR(s, LOCI_BINLOG_TAG_U64, uint64_t, val)
+#define LOCI_BINLOG_x8(s, val) LOCI_BINLOG_u8(s, val)
+#define LOCI_BINLOG_x16(s, val) LOCI_BINLOG_u16(s, val)
+#define LOCI_BINLOG_x32(s, val) LOCI_BINLOG_u32(s, val)
+#define LOCI_BINLOG_x64(s, val) LOCI_BINLOG_u64(s, val)
+#define LOCI_BINLOG_port_no(s, val) LOCI_BINLOG_u32(s, val)
+#define LOCI_BINLOG_fm_cmd(s, val) LOCI_BINLOG_u16(s, val)
+#define LOCI_BINLOG_wc_bmap(s, val) LOCI_BINLOG_u64(s, val)
+#define LOCI_BINLOG_match_bmap(s, val) LOCI_BINLOG_u64(s, val)
+
+#define LOCI_BINLOG_ipv4(s, val) LOCI_BINLOG_SCALAR(s, LOCI_BINLOG_TAG_IPV4, uint32_t, val)
+#define LOCI_BINLOG_mac(s, val) \
+    loci_binlog_put(s, LOCI_BINLOG_TAG_MAC, (val).addr, OF_MAC_ADDR_BYTES)
+#define LOCI_BINLOG_ipv6(s, val) \
+    loci_binlog_put(s, LOCI_BINLOG_TAG_IPV6, (val).addr, OF_IPV6_BYTES)
+
+#define LOCI_BINLOG_octets(s, val) \
+    loci_binlog_bytes(s, LOCI_BINLOG_TAG_BYTES, (val).data, (val).bytes)
+#define LOCI_BINLOG_mcs_rx_mask(s, val) \
+    loci_binlog_bytes(s, LOCI_BINLOG_TAG_BYTES, (val).bytes, sizeof((val).bytes))
+
+#define LOCI_BINLOG_string(s, val) loci_binlog_string(s, val, sizeof(val))
+#define LOCI_BINLOG_port_name(s, val) LOCI_BINLOG_string(s, val)
+#define LOCI_BINLOG_tab_name(s, val) LOCI_BINLOG_string(s, val)
+#define LOCI_BINLOG_desc_str(s, val) LOCI_BINLOG_string(s, val)
+#define LOCI_BINLOG_ser_num(s, val) LOCI_BINLOG_string(s, val)
+#define LOCI_BINLOG_str6(s, val) LOCI_BINLOG_string(s, val)
+#define LOCI_BINLOG_str32(s, val) LOCI_BINLOG_string(s, val)
+#define LOCI_BINLOG_str64(s, val) LOCI_BINLOG_string(s, val)
+#define LOCI_BINLOG_app_code(s, val) LOCI_BINLOG_string(s, val)
+
+/* Signal ids are logged as their in-memory representation */
+#define LOCI_BINLOG_circuit_sig_id(s, val) \
+    loci_binlog_bytes(s, LOCI_BINLOG_TAG_BYTES, (uint8_t *)&(val), sizeof(val))
+#define LOCI_BINLOG_och_sig_id(s, val) \
+    loci_binlog_bytes(s, LOCI_BINLOG_TAG_BYTES, (uint8_t *)&(val), sizeof(val))
+#define LOCI_BINLOG_odu_sig_id(s, val) do {                             \
+        LOCI_BINLOG_u16(s, (val).tpn);                                  \
+        loci_binlog_bytes(s, LOCI_BINLOG_TAG_BYTES, (val).tsmap,        \
+                          (val).tsmap != NULL ? (val).length : 0);      \
+    } while (0)
+
+#define LOCI_BINLOG_bitmap_128(s, val) loci_binlog_u128(s, (val).hi, (val).lo)
+#define LOCI_BINLOG_checksum_128(s, val) loci_binlog_u128(s, (val).hi, (val).lo)
+#define LOCI_BINLOG_bitmap_256(s, val) loci_binlog_words(s, (val).words, 4)
+#define LOCI_BINLOG_bitmap_512(s, val) loci_binlog_words(s, (val).words, 8)
+
+#define LOCI_BINLOG_match(s, val) loci_binlog_match(s, &(val))
+
+extern void loci_binlog_bytes(loci_stream_t *s, int tag,
+                              const uint8_t *data, int len);
+extern void loci_binlog_string(loci_stream_t *s, const char *str, int max_len);
+extern void loci_binlog_words(loci_stream_t *s, const uint64_t *words, int count);
+extern void loci_binlog_u128(loci_stream_t *s, uint64_t hi, uint64_t lo);
+extern void loci_binlog_match(loci_stream_t *s, of_match_t *match);
+extern void loci_binlog_object(loci_stream_t *s, of_object_t *obj);
+
+/**
+ * Write a complete record for any object
+ *
+ * The record must fit in the stream buffer; the header is patched
+ * once the length is known.
+ */
+int of_object_binlog(loci_stream_t *s, of_object_t *obj);
+
+/****************************************************************
+ *
+ * Reading records
+ *
+ ****************************************************************/
+
+typedef struct loci_binlog_record_s {
+    int length;
+    of_object_id_t object_id;
+    of_version_t version;
+    uint8_t flags;
+} loci_binlog_record_t;
+
+typedef struct loci_binlog_cursor_s {
+    const uint8_t *cur;
+    const uint8_t *end;
+    /* Record was written with the other byte order */
+    int swap;
+} loci_binlog_cursor_t;
+
+typedef struct loci_binlog_field_s {
+    loci_binlog_tag_t tag;
+    /* Integer and IPV4 tags */
+    uint64_t value;
+    /* MAC, IPV6, BYTES, STRING, BITMAP and MATCH; for MATCH the entries */
+    const uint8_t *data;
+    int bytes;
+    /* OBJECT, and version for MATCH */
+    of_object_id_t object_id;
+    of_version_t version;
+} loci_binlog_field_t;
+
+extern const char *const loci_binlog_match_field_names[];
+extern const int loci_binlog_match_field_count;
+
+extern int loci_binlog_record_open(const uint8_t *buf, int len,
+                                   loci_binlog_record_t *rec,
+                                   loci_binlog_cursor_t *cursor);
+extern int loci_binlog_next(loci_binlog_cursor_t *cursor,
+                            loci_binlog_field_t *field);
+
+#endif /* _LOCI_BINLOG_H_ */
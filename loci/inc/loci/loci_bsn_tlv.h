@@ -0,0 +1,143 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_bsn_tlv.h
+ *
+ * An index over the wire bytes of a BSN TLV list, as the keys and
+ * values of gentable entries, for finding TLVs by class in constant
+ * time.
+ *
+ * Indexing reads each TLV's type and length once and chains the TLVs
+ * of each class, by position in the list, from a small array by
+ * object id; no object is made.  Types of no known class are indexed
+ * as OF_BSN_TLV.  The typed getters read the value of the first TLV
+ * of a class and check that it is long enough.
+ *
+ * Two lists are equal if they have the same TLVs, byte for byte,
+ * whatever order the classes are in; TLVs of the same class must be
+ * in the same order.  The hash is seeded and agrees with that
+ * equality: it is a sum of TLV hashes, so it doesn't depend on the
+ * order of the TLVs either.
+ *
+ * Usage:
+ *
+ *   loci_bsn_tlv_index_t idx;
+ *   of_port_no_t port;
+ *   uint16_t vlan_vid;
+ *
+ *   if (loci_bsn_tlv_index(&idx, version, key, key_bytes) == 0 &&
+ *       loci_bsn_tlv_u32_get(&idx, OF_BSN_TLV_PORT, &port) == 0 &&
+ *       loci_bsn_tlv_u16_get(&idx, OF_BSN_TLV_VLAN_VID, &vlan_vid) == 0) {
+ *       ...
+ *   }
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_BSN_TLV_H_)
+#define _LOCI_BSN_TLV_H_
+
+#include <loci/loci.h>
+
+/* Most TLVs an index holds */
+#define LOCI_BSN_TLV_INDEX_MAX 64
+
+/* BSN TLV classes, OF_BSN_TLV to OF_BSN_TLV_VXLAN_EGRESS_LAG */
+#define LOCI_BSN_TLV_CLASSES (OF_BSN_TLV_VXLAN_EGRESS_LAG - OF_BSN_TLV + 1)
+
+/* Length of a TLV header: type and length */
+#define LOCI_BSN_TLV_HEADER_BYTES 4
+
+typedef struct loci_bsn_tlv_index_s {
+    of_version_t version;
+    const uint8_t *buf;
+    int len;
+    int count;
+    /** Of each class, by object id less OF_BSN_TLV: 1 + position of its
+     * first TLV, or 0 */
+    uint8_t first[LOCI_BSN_TLV_CLASSES];
+    /** Of each TLV: 1 + position of the next TLV of its class, or 0 */
+    uint8_t next[LOCI_BSN_TLV_INDEX_MAX];
+    /** Of each TLV: its class, less OF_BSN_TLV */
+    uint8_t cls[LOCI_BSN_TLV_INDEX_MAX];
+    /** Of each TLV: offset and length of the TLV, header included */
+    uint16_t offset[LOCI_BSN_TLV_INDEX_MAX];
+    uint16_t length[LOCI_BSN_TLV_INDEX_MAX];
+} loci_bsn_tlv_index_t;
+
+extern int loci_bsn_tlv_index(loci_bsn_tlv_index_t *idx, of_version_t version,
+                              const uint8_t *buf, int len);
+extern int loci_bsn_tlv_index_list(loci_bsn_tlv_index_t *idx,
+                                   of_list_bsn_tlv_t *list);
+
+extern int loci_bsn_tlv_u8_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                               uint8_t *value);
+extern int loci_bsn_tlv_u16_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                                uint16_t *value);
+extern int loci_bsn_tlv_u32_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                                uint32_t *value);
+extern int loci_bsn_tlv_u64_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                                uint64_t *value);
+extern int loci_bsn_tlv_mac_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                                of_mac_addr_t *value);
+extern int loci_bsn_tlv_ipv6_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                                 of_ipv6_t *value);
+extern int loci_bsn_tlv_data_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                                 const uint8_t **data, int *len);
+
+extern uint64_t loci_bsn_tlv_hash(loci_bsn_tlv_index_t *idx, uint64_t seed);
+extern int loci_bsn_tlv_equal(loci_bsn_tlv_index_t *a,
+                              loci_bsn_tlv_index_t *b);
+
+/**
+ * Position of the first TLV of a class, or -1 if there is none
+ */
+static inline int
+loci_bsn_tlv_find(loci_bsn_tlv_index_t *idx, of_object_id_t id)
+{
+    if (id < OF_BSN_TLV || id >= OF_BSN_TLV + LOCI_BSN_TLV_CLASSES) {
+        return -1;
+    }
+    return idx->first[id - OF_BSN_TLV] - 1;
+}
+
+/**
+ * Position of the next TLV of the class of the TLV at pos, or -1
+ */
+static inline int
+loci_bsn_tlv_find_next(loci_bsn_tlv_index_t *idx, int pos)
+{
+    return idx->next[pos] - 1;
+}
+
+/**
+ * Class of the TLV at pos
+ */
+static inline of_object_id_t
+loci_bsn_tlv_id(loci_bsn_tlv_index_t *idx, int pos)
+{
+    return OF_BSN_TLV + idx->cls[pos];
+}
+
+/**
+ * Value of the TLV at pos, after its header
+ */
+static inline const uint8_t *
+loci_bsn_tlv_value(loci_bsn_tlv_index_t *idx, int pos, int *len)
+{
+    *len = idx->length[pos] - LOCI_BSN_TLV_HEADER_BYTES;
+    return idx->buf + idx->offset[pos] + LOCI_BSN_TLV_HEADER_BYTES;
+}
+
+/**
+ * Number of TLVs in an indexed list
+ */
+static inline int
+loci_bsn_tlv_count(loci_bsn_tlv_index_t *idx)
+{
+    return idx->count;
+}
+
+#endif /* _LOCI_BSN_TLV_H_ */
@@ -0,0 +1,180 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_capture.h
+ *
+ * Capture files of raw OpenFlow messages.
+ *
+ * A capture is an append-only log of messages exactly as they were
+ * seen on a connection, each with a timestamp and a connection id.
+ * The log starts with a LOCI_CAPTURE_HEADER_LENGTH byte header:
+ *
+ *   uint32_t magic        LOCI_CAPTURE_MAGIC
+ *   uint16_t format       LOCI_CAPTURE_FORMAT
+ *   uint16_t flags        LOCI_CAPTURE_FLAG_*
+ *   uint64_t reserved
+ *
+ * followed by records of a LOCI_CAPTURE_RECORD_LENGTH byte header
+ *
+ *   uint64_t timestamp    Caller defined, usually ns since the epoch
+ *   uint32_t conn_id      Caller defined connection id
+ *   uint32_t length       Length of the message
+ *
+ * and the message, padded with zeros to a multiple of 8 bytes.  Header
+ * integers are in the byte order of the writer; the flags record
+ * which one that was.  Messages are not validated when written.
+ *
+ * Closing a writer also writes a side index to <path>.idx: one
+ * loci_capture_entry_t per record, then the record numbers sorted by
+ * object id, by xid and by timestamp (ties in record order).  When the
+ * index is missing or does not describe the whole log, for instance
+ * after a crash, loci_capture_open rebuilds it in memory by scanning
+ * the log; a partial record at the end of the log is ignored.
+ *
+ * Both files are read through mmap.  The log is mapped copy-on-write,
+ * so the objects returned by loci_capture_object refer directly to the
+ * mapped message and setting members on them never changes the file.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_CAPTURE_H_)
+#define _LOCI_CAPTURE_H_
+
+#include <loci/loci.h>
+
+#define LOCI_CAPTURE_MAGIC 0x4c434150 /* "LCAP" */
+#define LOCI_CAPTURE_INDEX_MAGIC 0x4c434958 /* "LCIX" */
+#define LOCI_CAPTURE_FORMAT 1
+
+#define LOCI_CAPTURE_HEADER_LENGTH 16
+#define LOCI_CAPTURE_RECORD_LENGTH 16
+#define LOCI_CAPTURE_INDEX_HEADER_LENGTH 32
+
+#define LOCI_CAPTURE_FLAG_BIG_ENDIAN 0x01
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LOCI_CAPTURE_HOST_FLAGS LOCI_CAPTURE_FLAG_BIG_ENDIAN
+#else
+#define LOCI_CAPTURE_HOST_FLAGS 0
+#endif
+
+/* Default size of the writer's output buffer */
+#define LOCI_CAPTURE_BUFFER_SIZE (1024 * 1024)
+
+/* Bytes a record of a 'len' byte message takes in the log */
+#define LOCI_CAPTURE_RECORD_BYTES(len) \
+    (LOCI_CAPTURE_RECORD_LENGTH + (((len) + 7) & ~7))
+
+/**
+ * Index entry for one record
+ *
+ * object_id is OF_OBJECT_INVALID and version and xid are 0 when the
+ * record does not hold an OpenFlow header of a known version whose
+ * length agrees with the record.
+ */
+typedef struct loci_capture_entry_s {
+    /** Offset of the message in the log */
+    uint64_t offset;
+    uint64_t timestamp;
+    uint32_t conn_id;
+    uint32_t xid;
+    uint32_t length;
+    int16_t object_id;
+    uint8_t version;
+    uint8_t pad;
+} loci_capture_entry_t;
+
+typedef struct loci_capture_writer_s {
+    int fd;
+    uint8_t *buf;
+    int size;
+    int pos;
+    /** Log offset of buf[0] */
+    uint64_t offset;
+    char *index_path;
+    /** Index entries of the records written so far */
+    loci_capture_entry_t *entries;
+    int count;
+    int alloc;
+} loci_capture_writer_t;
+
+extern int loci_capture_writer_open(loci_capture_writer_t *w,
+                                    const char *path, int buf_size);
+extern int loci_capture_write(loci_capture_writer_t *w, uint64_t timestamp,
+                              uint32_t conn_id, const uint8_t *msg, int len);
+extern int loci_capture_write_object(loci_capture_writer_t *w,
+                                     uint64_t timestamp, uint32_t conn_id,
+                                     of_object_t *obj);
+extern int loci_capture_writer_flush(loci_capture_writer_t *w);
+extern int loci_capture_writer_close(loci_capture_writer_t *w);
+
+typedef struct loci_capture_s {
+    /** Copy-on-write mapping of the log */
+    uint8_t *log;
+    uint64_t log_map_size;
+    /** Bytes of the log covered by complete records */
+    uint64_t log_size;
+    /** Mapping of the index file, or the index built at open */
+    uint8_t *index;
+    uint64_t index_size;
+    int index_mapped;
+    int count;
+    const loci_capture_entry_t *entries;
+    const uint32_t *by_type;
+    const uint32_t *by_xid;
+    const uint32_t *by_time;
+} loci_capture_t;
+
+/**
+ * Records selected by a query: record numbers in rec[0 .. count - 1]
+ */
+typedef struct loci_capture_range_s {
+    const uint32_t *rec;
+    int count;
+} loci_capture_range_t;
+
+extern int loci_capture_open(loci_capture_t *cap, const char *path);
+extern void loci_capture_close(loci_capture_t *cap);
+extern int loci_capture_reindex(const char *path);
+
+extern of_object_t *loci_capture_object(loci_capture_t *cap, int rec,
+                                        of_object_storage_t *storage);
+
+extern loci_capture_range_t loci_capture_by_type(loci_capture_t *cap,
+                                                 of_object_id_t object_id);
+extern loci_capture_range_t loci_capture_by_xid(loci_capture_t *cap,
+                                                uint32_t xid);
+extern loci_capture_range_t loci_capture_by_time(loci_capture_t *cap,
+                                                 uint64_t start, uint64_t end);
+
+/**
+ * Number of records in a capture
+ */
+static inline int
+loci_capture_count(loci_capture_t *cap)
+{
+    return cap->count;
+}
+
+/**
+ * Index entry of a record
+ */
+static inline const loci_capture_entry_t *
+loci_capture_entry(loci_capture_t *cap, int rec)
+{
+    return &cap->entries[rec];
+}
+
+/**
+ * The raw message of a record, in place in the mapped log
+ */
+static inline uint8_t *
+loci_capture_message(loci_capture_t *cap, int rec)
+{
+    return cap->log + cap->entries[rec].offset;
+}
+
+#endif /* _LOCI_CAPTURE_H_ */
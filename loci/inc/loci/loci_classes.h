@@ -18376,6 +18376,10 @@ extern void of_async_config_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_async_config_failed_error_msg_data_set(
     of_async_config_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_async_config_failed_error_msg_data_reserve(
+    of_async_config_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_async_config_failed_error_msg_data_get(
     of_async_config_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -18579,6 +18583,10 @@ extern void of_bad_action_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_bad_action_error_msg_data_set(
     of_bad_action_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bad_action_error_msg_data_reserve(
+    of_bad_action_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bad_action_error_msg_data_get(
     of_bad_action_error_msg_t *obj,
     of_octets_t *data);
@@ -18602,6 +18610,10 @@ extern void of_bad_instruction_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_bad_instruction_error_msg_data_set(
     of_bad_instruction_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bad_instruction_error_msg_data_reserve(
+    of_bad_instruction_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bad_instruction_error_msg_data_get(
     of_bad_instruction_error_msg_t *obj,
     of_octets_t *data);
@@ -18625,6 +18637,10 @@ extern void of_bad_match_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_bad_match_error_msg_data_set(
     of_bad_match_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bad_match_error_msg_data_reserve(
+    of_bad_match_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bad_match_error_msg_data_get(
     of_bad_match_error_msg_t *obj,
     of_octets_t *data);
@@ -18648,6 +18664,10 @@ extern void of_bad_property_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_bad_property_error_msg_data_set(
     of_bad_property_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bad_property_error_msg_data_reserve(
+    of_bad_property_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bad_property_error_msg_data_get(
     of_bad_property_error_msg_t *obj,
     of_octets_t *data);
@@ -18671,6 +18691,10 @@ extern void of_bad_request_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_bad_request_error_msg_data_set(
     of_bad_request_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bad_request_error_msg_data_reserve(
+    of_bad_request_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bad_request_error_msg_data_get(
     of_bad_request_error_msg_t *obj,
     of_octets_t *data);
@@ -19129,6 +19153,10 @@ extern void of_bsn_error_err_msg_get(
 extern int WARN_UNUSED_RESULT of_bsn_error_data_set(
     of_bsn_error_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_error_data_reserve(
+    of_bsn_error_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_error_data_get(
     of_bsn_error_t *obj,
     of_octets_t *data);
@@ -20794,6 +20822,10 @@ extern void of_bsn_log_loglevel_get(
 extern int WARN_UNUSED_RESULT of_bsn_log_data_set(
     of_bsn_log_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_log_data_reserve(
+    of_bsn_log_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_log_data_get(
     of_bsn_log_t *obj,
     of_octets_t *data);
@@ -20824,6 +20856,10 @@ extern void of_bsn_lua_command_reply_subtype_get(
 extern int WARN_UNUSED_RESULT of_bsn_lua_command_reply_data_set(
     of_bsn_lua_command_reply_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_lua_command_reply_data_reserve(
+    of_bsn_lua_command_reply_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_lua_command_reply_data_get(
     of_bsn_lua_command_reply_t *obj,
     of_octets_t *data);
@@ -20854,6 +20890,10 @@ extern void of_bsn_lua_command_request_subtype_get(
 extern int WARN_UNUSED_RESULT of_bsn_lua_command_request_data_set(
     of_bsn_lua_command_request_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_lua_command_request_data_reserve(
+    of_bsn_lua_command_request_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_lua_command_request_data_get(
     of_bsn_lua_command_request_t *obj,
     of_octets_t *data);
@@ -20884,6 +20924,10 @@ extern void of_bsn_lua_notification_subtype_get(
 extern int WARN_UNUSED_RESULT of_bsn_lua_notification_data_set(
     of_bsn_lua_notification_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_lua_notification_data_reserve(
+    of_bsn_lua_notification_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_lua_notification_data_get(
     of_bsn_lua_notification_t *obj,
     of_octets_t *data);
@@ -20928,6 +20972,10 @@ extern void of_bsn_lua_upload_filename_get(
 extern int WARN_UNUSED_RESULT of_bsn_lua_upload_data_set(
     of_bsn_lua_upload_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_lua_upload_data_reserve(
+    of_bsn_lua_upload_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_lua_upload_data_get(
     of_bsn_lua_upload_t *obj,
     of_octets_t *data);
@@ -21023,6 +21071,10 @@ extern void of_bsn_pdu_rx_request_slot_num_get(
 extern int WARN_UNUSED_RESULT of_bsn_pdu_rx_request_data_set(
     of_bsn_pdu_rx_request_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_pdu_rx_request_data_reserve(
+    of_bsn_pdu_rx_request_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_pdu_rx_request_data_get(
     of_bsn_pdu_rx_request_t *obj,
     of_octets_t *data);
@@ -21155,6 +21207,10 @@ extern void of_bsn_pdu_tx_request_slot_num_get(
 extern int WARN_UNUSED_RESULT of_bsn_pdu_tx_request_data_set(
     of_bsn_pdu_tx_request_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_pdu_tx_request_data_reserve(
+    of_bsn_pdu_tx_request_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_pdu_tx_request_data_get(
     of_bsn_pdu_tx_request_t *obj,
     of_octets_t *data);
@@ -21784,6 +21840,10 @@ extern void of_bsn_shell_command_service_get(
 extern int WARN_UNUSED_RESULT of_bsn_shell_command_data_set(
     of_bsn_shell_command_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_shell_command_data_reserve(
+    of_bsn_shell_command_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_shell_command_data_get(
     of_bsn_shell_command_t *obj,
     of_octets_t *data);
@@ -21814,6 +21874,10 @@ extern void of_bsn_shell_output_subtype_get(
 extern int WARN_UNUSED_RESULT of_bsn_shell_output_data_set(
     of_bsn_shell_output_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bsn_shell_output_data_reserve(
+    of_bsn_shell_output_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bsn_shell_output_data_get(
     of_bsn_shell_output_t *obj,
     of_octets_t *data);
@@ -22436,6 +22500,10 @@ extern void of_bundle_add_msg_flags_get(
 extern int WARN_UNUSED_RESULT of_bundle_add_msg_data_set(
     of_bundle_add_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bundle_add_msg_data_reserve(
+    of_bundle_add_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bundle_add_msg_data_get(
     of_bundle_add_msg_t *obj,
     of_octets_t *data);
@@ -22498,6 +22566,10 @@ extern void of_bundle_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_bundle_failed_error_msg_data_set(
     of_bundle_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_bundle_failed_error_msg_data_reserve(
+    of_bundle_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_bundle_failed_error_msg_data_get(
     of_bundle_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -23024,6 +23096,10 @@ extern void of_echo_reply_xid_get(
 extern int WARN_UNUSED_RESULT of_echo_reply_data_set(
     of_echo_reply_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_echo_reply_data_reserve(
+    of_echo_reply_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_echo_reply_data_get(
     of_echo_reply_t *obj,
     of_octets_t *data);
@@ -23040,6 +23116,10 @@ extern void of_echo_request_xid_get(
 extern int WARN_UNUSED_RESULT of_echo_request_data_set(
     of_echo_request_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_echo_request_data_reserve(
+    of_echo_request_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_echo_request_data_get(
     of_echo_request_t *obj,
     of_octets_t *data);
@@ -23610,6 +23690,10 @@ extern void of_flow_mod_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_flow_mod_failed_error_msg_data_set(
     of_flow_mod_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_flow_mod_failed_error_msg_data_reserve(
+    of_flow_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_flow_mod_failed_error_msg_data_get(
     of_flow_mod_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -23855,6 +23939,10 @@ extern void of_flow_monitor_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_flow_monitor_failed_error_msg_data_set(
     of_flow_monitor_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_flow_monitor_failed_error_msg_data_reserve(
+    of_flow_monitor_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_flow_monitor_failed_error_msg_data_get(
     of_flow_monitor_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -24286,6 +24374,10 @@ extern void of_group_mod_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_group_mod_failed_error_msg_data_set(
     of_group_mod_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_group_mod_failed_error_msg_data_reserve(
+    of_group_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_group_mod_failed_error_msg_data_get(
     of_group_mod_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -24407,6 +24499,10 @@ extern void of_hello_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_hello_failed_error_msg_data_set(
     of_hello_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_hello_failed_error_msg_data_reserve(
+    of_hello_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_hello_failed_error_msg_data_get(
     of_hello_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -24560,6 +24656,10 @@ extern void of_meter_mod_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_meter_mod_failed_error_msg_data_set(
     of_meter_mod_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_meter_mod_failed_error_msg_data_reserve(
+    of_meter_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_meter_mod_failed_error_msg_data_get(
     of_meter_mod_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -24901,6 +25001,10 @@ extern int WARN_UNUSED_RESULT of_packet_in_match_get(
 extern int WARN_UNUSED_RESULT of_packet_in_data_set(
     of_packet_in_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_packet_in_data_reserve(
+    of_packet_in_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_packet_in_data_get(
     of_packet_in_t *obj,
     of_octets_t *data);
@@ -24954,6 +25058,10 @@ extern of_list_action_t *of_packet_out_actions_get(
 extern int WARN_UNUSED_RESULT of_packet_out_data_set(
     of_packet_out_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_packet_out_data_reserve(
+    of_packet_out_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_packet_out_data_get(
     of_packet_out_t *obj,
     of_octets_t *data);
@@ -25071,6 +25179,10 @@ extern void of_port_mod_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_port_mod_failed_error_msg_data_set(
     of_port_mod_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_port_mod_failed_error_msg_data_reserve(
+    of_port_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_port_mod_failed_error_msg_data_get(
     of_port_mod_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -25263,6 +25375,10 @@ extern void of_queue_op_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_queue_op_failed_error_msg_data_set(
     of_queue_op_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_queue_op_failed_error_msg_data_reserve(
+    of_queue_op_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_queue_op_failed_error_msg_data_get(
     of_queue_op_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -25341,6 +25457,10 @@ extern void of_requestforward_role_get(
 extern int WARN_UNUSED_RESULT of_requestforward_data_set(
     of_requestforward_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_requestforward_data_reserve(
+    of_requestforward_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_requestforward_data_get(
     of_requestforward_t *obj,
     of_octets_t *data);
@@ -25410,6 +25530,10 @@ extern void of_role_request_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_role_request_failed_error_msg_data_set(
     of_role_request_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_role_request_failed_error_msg_data_reserve(
+    of_role_request_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_role_request_failed_error_msg_data_get(
     of_role_request_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -25610,6 +25734,10 @@ extern of_ieee80211_vht_cap_t *of_sdwn_add_lvap_vht_capabilities_get(
 extern int WARN_UNUSED_RESULT of_sdwn_add_lvap_beacon_set(
     of_sdwn_add_lvap_t *obj,
     of_octets_t *beacon);
+extern int WARN_UNUSED_RESULT of_sdwn_add_lvap_beacon_reserve(
+    of_sdwn_add_lvap_t *obj,
+    int bytes,
+    uint8_t **beacon);
 extern void of_sdwn_add_lvap_beacon_get(
     of_sdwn_add_lvap_t *obj,
     of_octets_t *beacon);
@@ -26334,6 +26462,10 @@ extern void of_sdwn_packet_in_hdr_addr4_get(
 extern int WARN_UNUSED_RESULT of_sdwn_packet_in_frame_set(
     of_sdwn_packet_in_t *obj,
     of_octets_t *frame);
+extern int WARN_UNUSED_RESULT of_sdwn_packet_in_frame_reserve(
+    of_sdwn_packet_in_t *obj,
+    int bytes,
+    uint8_t **frame);
 extern void of_sdwn_packet_in_frame_get(
     of_sdwn_packet_in_t *obj,
     of_octets_t *frame);
@@ -26493,6 +26625,10 @@ extern void of_switch_config_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_switch_config_failed_error_msg_data_set(
     of_switch_config_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_switch_config_failed_error_msg_data_reserve(
+    of_switch_config_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_switch_config_failed_error_msg_data_get(
     of_switch_config_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -26557,6 +26693,10 @@ extern void of_table_features_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_table_features_failed_error_msg_data_set(
     of_table_features_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_table_features_failed_error_msg_data_reserve(
+    of_table_features_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_table_features_failed_error_msg_data_get(
     of_table_features_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -26662,6 +26802,10 @@ extern void of_table_mod_failed_error_msg_code_get(
 extern int WARN_UNUSED_RESULT of_table_mod_failed_error_msg_data_set(
     of_table_mod_failed_error_msg_t *obj,
     of_octets_t *data);
+extern int WARN_UNUSED_RESULT of_table_mod_failed_error_msg_data_reserve(
+    of_table_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data);
 extern void of_table_mod_failed_error_msg_data_get(
     of_table_mod_failed_error_msg_t *obj,
     of_octets_t *data);
@@ -28273,6 +28417,10 @@ extern of_list_bsn_tlv_t *of_bsn_tlv_bucket_value_get(
 extern int WARN_UNUSED_RESULT of_bsn_tlv_circuit_id_value_set(
     of_bsn_tlv_circuit_id_t *obj,
     of_octets_t *value);
+extern int WARN_UNUSED_RESULT of_bsn_tlv_circuit_id_value_reserve(
+    of_bsn_tlv_circuit_id_t *obj,
+    int bytes,
+    uint8_t **value);
 extern void of_bsn_tlv_circuit_id_value_get(
     of_bsn_tlv_circuit_id_t *obj,
     of_octets_t *value);
@@ -28302,6 +28450,10 @@ extern void of_bsn_tlv_crc_enabled_value_get(
 extern int WARN_UNUSED_RESULT of_bsn_tlv_data_value_set(
     of_bsn_tlv_data_t *obj,
     of_octets_t *value);
+extern int WARN_UNUSED_RESULT of_bsn_tlv_data_value_reserve(
+    of_bsn_tlv_data_t *obj,
+    int bytes,
+    uint8_t **value);
 extern void of_bsn_tlv_data_value_get(
     of_bsn_tlv_data_t *obj,
     of_octets_t *value);
@@ -28311,6 +28463,10 @@ extern void of_bsn_tlv_data_value_get(
 extern int WARN_UNUSED_RESULT of_bsn_tlv_data_mask_value_set(
     of_bsn_tlv_data_mask_t *obj,
     of_octets_t *value);
+extern int WARN_UNUSED_RESULT of_bsn_tlv_data_mask_value_reserve(
+    of_bsn_tlv_data_mask_t *obj,
+    int bytes,
+    uint8_t **value);
 extern void of_bsn_tlv_data_mask_value_get(
     of_bsn_tlv_data_mask_t *obj,
     of_octets_t *value);
@@ -28837,6 +28993,10 @@ extern void of_bsn_tlv_multicast_interface_id_value_get(
 extern int WARN_UNUSED_RESULT of_bsn_tlv_name_value_set(
     of_bsn_tlv_name_t *obj,
     of_octets_t *value);
+extern int WARN_UNUSED_RESULT of_bsn_tlv_name_value_reserve(
+    of_bsn_tlv_name_t *obj,
+    int bytes,
+    uint8_t **value);
 extern void of_bsn_tlv_name_value_get(
     of_bsn_tlv_name_t *obj,
     of_octets_t *value);
@@ -34969,6 +35129,10 @@ extern void of_queue_desc_prop_bsn_queue_name_exp_type_get(
 extern int WARN_UNUSED_RESULT of_queue_desc_prop_bsn_queue_name_name_set(
     of_queue_desc_prop_bsn_queue_name_t *obj,
     of_octets_t *name);
+extern int WARN_UNUSED_RESULT of_queue_desc_prop_bsn_queue_name_name_reserve(
+    of_queue_desc_prop_bsn_queue_name_t *obj,
+    int bytes,
+    uint8_t **name);
 extern void of_queue_desc_prop_bsn_queue_name_name_get(
     of_queue_desc_prop_bsn_queue_name_t *obj,
     of_octets_t *name);
@@ -35130,6 +35294,10 @@ extern void of_sdwn_entity_accesspoint_max_speed_get(
 extern int WARN_UNUSED_RESULT of_sdwn_entity_accesspoint_ssid_set(
     of_sdwn_entity_accesspoint_t *obj,
     of_octets_t *ssid);
+extern int WARN_UNUSED_RESULT of_sdwn_entity_accesspoint_ssid_reserve(
+    of_sdwn_entity_accesspoint_t *obj,
+    int bytes,
+    uint8_t **ssid);
 extern void of_sdwn_entity_accesspoint_ssid_get(
     of_sdwn_entity_accesspoint_t *obj,
     of_octets_t *ssid);
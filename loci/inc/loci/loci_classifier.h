@@ -0,0 +1,88 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_classifier.h
+ *
+ * Find the highest priority flow that matches a packet.
+ *
+ * A classifier holds flows: a match, a priority and a table id, with a
+ * caller pointer.  A packet is given as the fields of an of_match_t,
+ * as set by loci_packet_match.  It matches a flow when it agrees with
+ * the flow's match on every bit of the flow's masks, the meaning of
+ * of_match_more_specific.  Of the flows of a table that match, the one
+ * with the highest priority wins; between equal priorities the choice
+ * is arbitrary, as in OpenFlow.
+ *
+ * The flows of a table are grouped by mask into tuples, each a hash
+ * table keyed on the masked fields.  A lookup probes the tuples in
+ * order of their highest priority and stops once no tuple left can
+ * beat the flow found.  Only the 64 bit words of the fields a mask
+ * covers are hashed and compared.
+ *
+ * In front of the tuples each table has a direct mapped cache of
+ * lookup results, keyed on the words any of the table's masks covers.
+ * Adding or removing a flow empties the cache of its table.
+ *
+ * Usage:
+ *
+ *   loci_classifier_t cls;
+ *
+ *   loci_classifier_init(&cls, LOCI_CLASSIFIER_CACHE_SLOTS);
+ *   loci_classifier_add(&cls, 0, &flow_match, 100, flow);
+ *   ...
+ *   loci_packet_match(version, pkt, len, LOCI_PACKET_FIELDS_ALL, &pkt_match);
+ *   flow = loci_classifier_lookup(&cls, 0, &pkt_match.fields);
+ *   ...
+ *   loci_classifier_cleanup(&cls);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_CLASSIFIER_H_)
+#define _LOCI_CLASSIFIER_H_
+
+#include <loci/loci.h>
+
+/* Default number of cache slots per table */
+#define LOCI_CLASSIFIER_CACHE_SLOTS 4096
+
+#define LOCI_CLASSIFIER_TABLES 256
+
+typedef struct loci_classifier_table_s loci_classifier_table_t;
+
+typedef struct loci_classifier_s {
+    /** Tables are made by their first flow */
+    loci_classifier_table_t *tables[LOCI_CLASSIFIER_TABLES];
+    /** Cache slots per table, a power of 2, or 0 for no cache */
+    int cache_slots;
+    int count;
+    /** Lookups answered by a cache, and by the tuples */
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+} loci_classifier_t;
+
+extern int loci_classifier_init(loci_classifier_t *cls, int cache_slots);
+extern void loci_classifier_cleanup(loci_classifier_t *cls);
+
+extern int loci_classifier_add(loci_classifier_t *cls, uint8_t table_id,
+                               const of_match_t *match, uint16_t priority,
+                               void *data);
+extern int loci_classifier_remove(loci_classifier_t *cls, uint8_t table_id,
+                                  const of_match_t *match, uint16_t priority,
+                                  void **data);
+
+extern void *loci_classifier_lookup(loci_classifier_t *cls, uint8_t table_id,
+                                    const of_match_fields_t *fields);
+
+/**
+ * Number of flows in a classifier
+ */
+static inline int
+loci_classifier_count(loci_classifier_t *cls)
+{
+    return cls->count;
+}
+
+#endif /* _LOCI_CLASSIFIER_H_ */
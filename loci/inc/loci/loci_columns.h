@@ -0,0 +1,114 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_columns.h
+ *
+ * Stats lists read into columns: one host order uint64_t array per
+ * field, one row per entry, without an object per entry.
+ *
+ * The supported lists are port, queue, table, flow and meter stats
+ * and the BSN port, VLAN and VRF counter stats.  Each entry class has
+ * a fixed set of columns, the same in every version; a field the
+ * version doesn't have reads 0.  Columns are looked up by the name of
+ * the accessor for the field, so "rx_packets" for
+ * of_port_stats_entry_rx_packets_get.  The values of the BSN counter
+ * entries are the columns "value0" to "value15".  For 1.4 port stats
+ * the error counters are read from the ethernet property.  Flow stats
+ * also have the key column "match_hash", the loci_match_hash of the
+ * entry's match.
+ *
+ * Extracting a reply appends to the rows already there, so a
+ * multipart reply goes into one set of columns, reply by reply.
+ *
+ * A delta matches each row to the row of the previous poll with the
+ * same key columns (port_no, queue_id, ...).  Counter columns become
+ * the difference, or the current value for a new row or a counter
+ * that went backwards, as after a reset; the other columns are copied.
+ *
+ * The other way, port, queue and table stats replies are filled from
+ * columns in the layout of the reply's version, as many rows as fit
+ * from a cursor; OF_STATS_REPLY_FLAG_REPLY_MORE is set on all but the
+ * last reply.
+ *
+ * Usage:
+ *
+ *   loci_columns_t cur, prev, delta;
+ *
+ *   loci_columns_init(&cur, OF_PORT_STATS_ENTRY, 1024);
+ *   ...
+ *   loci_columns_clear(&cur);
+ *   for each reply:
+ *       of_port_stats_reply_entries_bind(reply, &list);
+ *       loci_columns_extract(&cur, &list);
+ *   loci_columns_delta(&cur, &prev, &delta);
+ *   rx_packets = delta.columns[loci_columns_index(&delta, "rx_packets")];
+ *
+ *   loci_columns_resize(&cols, n_ports);
+ *   ... fill cols.columns[...][0 .. n_ports - 1] ...
+ *   next = 0;
+ *   do {
+ *       reply = of_port_stats_reply_new(version);
+ *       loci_columns_fill(reply, &cols, &next);
+ *       send(reply);
+ *   } while (next < cols.count);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_COLUMNS_H_)
+#define _LOCI_COLUMNS_H_
+
+#include <loci/loci.h>
+
+/* Most columns of an entry class */
+#define LOCI_COLUMNS_MAX 24
+
+/* Values of a BSN counter entry read into columns */
+#define LOCI_COLUMNS_VALUES_MAX 16
+
+/* What a column holds */
+#define LOCI_COLUMN_KEY 0       /* Identifies the entry between polls */
+#define LOCI_COLUMN_COUNTER 1   /* Only goes up, until a reset */
+#define LOCI_COLUMN_GAUGE 2     /* Anything else */
+
+typedef struct loci_columns_class_s loci_columns_class_t;
+
+typedef struct loci_columns_s {
+    of_object_id_t entry_id;
+    const loci_columns_class_t *cls;
+    int n_columns;
+    int n_keys;                 /* The key columns come first */
+    const char *names[LOCI_COLUMNS_MAX];
+    uint8_t kinds[LOCI_COLUMNS_MAX];
+    uint64_t *columns[LOCI_COLUMNS_MAX];
+    int count;                  /* Rows */
+    int capacity;               /* Rows the columns have room for */
+    uint32_t *rows;             /* Scratch: entry offsets of a list */
+    uint32_t *props;            /* Scratch: property offsets of a list */
+} loci_columns_t;
+
+extern int loci_columns_init(loci_columns_t *cols, of_object_id_t entry_id,
+                             int capacity);
+extern void loci_columns_cleanup(loci_columns_t *cols);
+extern int loci_columns_index(const loci_columns_t *cols, const char *name);
+extern int loci_columns_extract(loci_columns_t *cols, of_object_t *list);
+extern int loci_columns_delta(const loci_columns_t *cur,
+                              const loci_columns_t *prev,
+                              loci_columns_t *delta);
+extern int loci_columns_resize(loci_columns_t *cols, int count);
+extern int loci_columns_fill(of_object_t *reply, const loci_columns_t *cols,
+                             int *next);
+
+/**
+ * Drop the rows, keeping the room for them
+ * @param cols The columns
+ */
+static inline void
+loci_columns_clear(loci_columns_t *cols)
+{
+    cols->count = 0;
+}
+
+#endif /* _LOCI_COLUMNS_H_ */
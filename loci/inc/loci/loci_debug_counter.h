@@ -0,0 +1,74 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_debug_counter.h
+ *
+ * BSN debug counter stats replies written from, and read into, arrays
+ * of counters, without an object per entry.
+ *
+ * A loci_debug_counter_t is laid out as an
+ * of_bsn_debug_counter_stats_entry on the wire, so an array of them
+ * goes to and from a reply as one byte-swapped copy of 64 bit words.
+ * Replies are filled with as many counters as fit, from a cursor into
+ * the array; OF_STATS_REPLY_FLAG_REPLY_MORE is set on all but the
+ * last.  Descriptions are written and read the same way.
+ *
+ * Usage:
+ *
+ *   loci_debug_counter_t counters[N];
+ *   int next = 0;
+ *
+ *   do {
+ *       reply = of_bsn_debug_counter_stats_reply_new(version);
+ *       of_bsn_debug_counter_stats_reply_xid_set(reply, xid);
+ *       loci_debug_counter_stats_fill(reply, counters, N, &next);
+ *       send(reply);
+ *   } while (next < N);
+ *
+ *   n = loci_debug_counter_stats_decode(reply, counters, N);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_DEBUG_COUNTER_H_)
+#define _LOCI_DEBUG_COUNTER_H_
+
+#include <loci/loci.h>
+
+/* Wire lengths of the entries */
+#define LOCI_DEBUG_COUNTER_ENTRY_BYTES 16
+#define LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES 328
+
+/* As of_bsn_debug_counter_stats_entry */
+typedef struct loci_debug_counter_s {
+    uint64_t id;
+    uint64_t value;
+} loci_debug_counter_t;
+
+/* As of_bsn_debug_counter_desc_stats_entry */
+typedef struct loci_debug_counter_desc_s {
+    uint64_t id;
+    of_str64_t name;
+    of_desc_str_t description;
+} loci_debug_counter_desc_t;
+
+extern int loci_debug_counter_stats_fill(
+    of_bsn_debug_counter_stats_reply_t *reply,
+    const loci_debug_counter_t *counters, int count, int *next);
+extern int loci_debug_counter_desc_stats_fill(
+    of_bsn_debug_counter_desc_stats_reply_t *reply,
+    const loci_debug_counter_desc_t *descs, int count, int *next);
+
+extern int loci_debug_counter_stats_decode(
+    of_bsn_debug_counter_stats_reply_t *reply,
+    loci_debug_counter_t *counters, int max);
+extern int loci_debug_counter_desc_stats_decode(
+    of_bsn_debug_counter_desc_stats_reply_t *reply,
+    loci_debug_counter_desc_t *descs, int max);
+
+extern int loci_debug_counter_stats_count(
+    of_bsn_debug_counter_stats_reply_t *reply);
+
+#endif /* _LOCI_DEBUG_COUNTER_H_ */
@@ -0,0 +1,182 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_flow_checksum.h
+ *
+ * BSN flow table checksums, kept up to date as flow_mods are applied.
+ *
+ * As with BSN switches, the checksum of a flow is its cookie.  A
+ * table's flows are sorted into buckets by the top bits of their
+ * cookies; each table has buckets_size buckets, a power of 2, as set by
+ * of_bsn_table_set_buckets_size.  The checksum of a bucket is the XOR
+ * of the cookies of its flows and the checksum of a table the XOR of
+ * all of them, so each flow added or deleted costs constant time and
+ * of_bsn_flow_checksum_bucket_stats and of_bsn_table_checksum_stats
+ * replies are built from the sums without looking at any flow.
+ *
+ * Flows are known by table, priority and match, the match in the
+ * canonical form of loci_match_canonical, so a flow_mod of any version
+ * finds the flows of another; time slot maps of ODU signal ids don't
+ * count.  Matches are kept as the 64 bit words their masks cover.
+ *
+ * loci_flow_checksum_apply follows the flow_mod semantics of each
+ * version: an add replaces the flow with the same table, priority and
+ * match; non-strict modifies and deletes cover the flows whose matches
+ * are more specific than theirs, at any priority; modifies keep the
+ * cookies of the flows they change, but in 1.0 and 1.1 add a flow if
+ * they change none; 1.1 and later take a cookie mask, and deletes a
+ * table id of OFPTT_ALL.  Strict flow_mods and adds find their flow by
+ * hash.  Non-strict modifies and deletes, and adds with
+ * OF_FLOW_MOD_FLAG_CHECK_OVERLAP, visit every flow of their tables, so
+ * they cost time linear in the flows of the table, or of all tables
+ * for a delete of OFPTT_ALL.
+ *
+ * Of a flow's actions only the ports and groups it outputs to are
+ * kept, from the apply and write actions instructions after 1.0.
+ * Deletes filtered by out_port or out_group cover the flows with an
+ * output to them; modifies replace the outputs of the flows they
+ * cover with their own.
+ *
+ * Usage:
+ *
+ *   loci_flow_checksum_t fc;
+ *   uint32_t bucket = 0;
+ *
+ *   loci_flow_checksum_init(&fc, n_tables, 1);
+ *   loci_flow_checksum_apply(&fc, flow_mod);
+ *   ...
+ *   do {
+ *       reply = of_bsn_flow_checksum_bucket_stats_reply_new(version);
+ *       loci_flow_checksum_bucket_stats_fill(&fc, table_id, &bucket, reply);
+ *       send(reply);
+ *   } while (bucket < loci_flow_checksum_buckets_size(&fc, table_id));
+ *   ...
+ *   loci_flow_checksum_cleanup(&fc);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_FLOW_CHECKSUM_H_)
+#define _LOCI_FLOW_CHECKSUM_H_
+
+#include <loci/loci.h>
+
+/* Initial slots of the flow index, a power of 2 */
+#define LOCI_FLOW_CHECKSUM_SLOTS 64
+
+/* Most checksum buckets a table can have */
+#define LOCI_FLOW_CHECKSUM_BUCKETS_MAX (1 << 20)
+
+/* A 64 bit word of a canonical match with a mask that isn't 0 */
+typedef struct loci_flow_checksum_word_s {
+    uint64_t value;
+    uint64_t mask;
+    /** Index of the word in of_match_fields_t */
+    uint32_t index;
+} loci_flow_checksum_word_t;
+
+typedef struct loci_flow_checksum_flow_s {
+    /** Next flow in the index slot */
+    struct loci_flow_checksum_flow_s *next;
+    /** Neighbours in the flows of the table */
+    struct loci_flow_checksum_flow_s *table_next;
+    struct loci_flow_checksum_flow_s *table_prev;
+    uint64_t hash;
+    uint64_t cookie;
+    uint16_t priority;
+    uint8_t table_id;
+    uint8_t n_words;
+    /** Outputs of the flow's actions */
+    uint16_t n_ports;
+    uint16_t n_groups;
+    /** By index, then n_ports ports and n_groups groups as uint32_t */
+    loci_flow_checksum_word_t words[];
+} loci_flow_checksum_flow_t;
+
+typedef struct loci_flow_checksum_table_s {
+    loci_flow_checksum_flow_t *flows;
+    uint32_t count;
+    /** XOR of the cookies of the flows */
+    uint64_t checksum;
+    /** XOR of the cookies of the flows of each bucket */
+    uint64_t *buckets;
+    uint32_t buckets_size;
+    /** log2 of buckets_size */
+    int bucket_bits;
+} loci_flow_checksum_table_t;
+
+typedef struct loci_flow_checksum_s {
+    loci_flow_checksum_table_t *tables;
+    int n_tables;
+    /** Flow index: chains of flows by hash of table, priority and match */
+    loci_flow_checksum_flow_t **slots;
+    uint32_t n_slots;
+    uint32_t count;
+} loci_flow_checksum_t;
+
+extern int loci_flow_checksum_init(loci_flow_checksum_t *fc, int n_tables,
+                                   uint32_t buckets_size);
+extern void loci_flow_checksum_cleanup(loci_flow_checksum_t *fc);
+
+extern int loci_flow_checksum_buckets_size_set(loci_flow_checksum_t *fc,
+                                               uint8_t table_id,
+                                               uint32_t buckets_size);
+
+extern int loci_flow_checksum_add(loci_flow_checksum_t *fc, uint8_t table_id,
+                                  const of_match_t *match, uint16_t priority,
+                                  uint64_t cookie, uint16_t flags,
+                                  of_object_t *actions);
+extern int loci_flow_checksum_remove(loci_flow_checksum_t *fc,
+                                     uint8_t table_id,
+                                     const of_match_t *match,
+                                     uint16_t priority);
+
+extern int loci_flow_checksum_apply(loci_flow_checksum_t *fc,
+                                    of_object_t *msg);
+
+extern int loci_flow_checksum_bucket_stats_fill(
+    loci_flow_checksum_t *fc, uint8_t table_id, uint32_t *bucket,
+    of_bsn_flow_checksum_bucket_stats_reply_t *reply);
+extern int loci_flow_checksum_table_stats_fill(
+    loci_flow_checksum_t *fc, of_bsn_table_checksum_stats_reply_t *reply);
+
+/**
+ * Bucket of a cookie in a table: its top bucket_bits bits
+ */
+static inline uint32_t
+loci_flow_checksum_bucket(loci_flow_checksum_table_t *table, uint64_t cookie)
+{
+    return table->bucket_bits == 0 ? 0 :
+        (uint32_t)(cookie >> (64 - table->bucket_bits));
+}
+
+/**
+ * Number of buckets of a table, or 0 if there is no such table
+ */
+static inline uint32_t
+loci_flow_checksum_buckets_size(loci_flow_checksum_t *fc, uint8_t table_id)
+{
+    return table_id < fc->n_tables ? fc->tables[table_id].buckets_size : 0;
+}
+
+/**
+ * Checksum of a table, or 0 if there is no such table
+ */
+static inline uint64_t
+loci_flow_checksum_table(loci_flow_checksum_t *fc, uint8_t table_id)
+{
+    return table_id < fc->n_tables ? fc->tables[table_id].checksum : 0;
+}
+
+/**
+ * Number of flows in all tables
+ */
+static inline uint32_t
+loci_flow_checksum_count(loci_flow_checksum_t *fc)
+{
+    return fc->count;
+}
+
+#endif /* _LOCI_FLOW_CHECKSUM_H_ */
@@ -0,0 +1,169 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_gentable.h
+ *
+ * A BSN generic table: entries of a key and a value, each a list of
+ * BSN TLVs, and a 128 bit checksum the controller gives each entry.
+ *
+ * Entries are indexed by the raw bytes of their key TLV list, so keys
+ * that encode the same TLVs differently are different keys, as they are
+ * to the controller.  The checksums are sorted into buckets by their
+ * top bits; there are buckets_size buckets, a power of 2, as set by
+ * of_bsn_gentable_set_buckets_size.  The checksum of a bucket is the
+ * XOR of the checksums of its entries, and the checksum of the table
+ * the XOR of all of them, so adding, changing or deleting an entry
+ * updates both in constant time.  A controller resyncing the table
+ * compares bucket checksums and only dumps the buckets that differ.
+ *
+ * Replies are filled from a dump over a range of buckets, as many
+ * entries as fit in each message; OF_STATS_REPLY_FLAG_REPLY_MORE is
+ * set on all but the last.  A dump remembers its place by bucket and
+ * position in the bucket, so a table changed between the replies of a
+ * dump may have entries of the bucket it was in repeated or left out.
+ *
+ * Usage:
+ *
+ *   loci_gentable_t gt;
+ *   loci_gentable_dump_t dump;
+ *
+ *   loci_gentable_init(&gt, table_id, 1024);
+ *   loci_gentable_apply(&gt, entry_add);
+ *   ...
+ *   loci_gentable_dump_select(&gt, &dump, checksum, checksum_mask);
+ *   do {
+ *       reply = of_bsn_gentable_entry_desc_stats_reply_new(version);
+ *       loci_gentable_entry_desc_fill(&gt, &dump, reply);
+ *       send(reply);
+ *   } while (!loci_gentable_dump_done(&dump));
+ *   ...
+ *   loci_gentable_cleanup(&gt);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_GENTABLE_H_)
+#define _LOCI_GENTABLE_H_
+
+#include <loci/loci.h>
+
+/* Initial slots of the key index, a power of 2 */
+#define LOCI_GENTABLE_SLOTS 64
+
+/* Most checksum buckets a table can have */
+#define LOCI_GENTABLE_BUCKETS_MAX (1 << 24)
+
+typedef struct loci_gentable_entry_s {
+    /** Next entry in the key index slot */
+    struct loci_gentable_entry_s *next;
+    /** Neighbours in the checksum bucket */
+    struct loci_gentable_entry_s *bucket_next;
+    struct loci_gentable_entry_s *bucket_prev;
+    uint64_t hash;
+    of_checksum_128_t checksum;
+    uint16_t key_bytes;
+    uint16_t value_bytes;
+    /** The key TLV list, then the value TLV list */
+    uint8_t data[];
+} loci_gentable_entry_t;
+
+#define LOCI_GENTABLE_ENTRY_KEY(entry) ((entry)->data)
+#define LOCI_GENTABLE_ENTRY_VALUE(entry) ((entry)->data + (entry)->key_bytes)
+
+typedef struct loci_gentable_bucket_s {
+    loci_gentable_entry_t *entries;
+    uint32_t count;
+    /** XOR of the checksums of the entries */
+    of_checksum_128_t checksum;
+} loci_gentable_bucket_t;
+
+typedef struct loci_gentable_s {
+    uint16_t table_id;
+    /** Key index: chains of entries by hash of the key */
+    loci_gentable_entry_t **slots;
+    uint32_t n_slots;
+    uint32_t count;
+    loci_gentable_bucket_t *buckets;
+    uint32_t buckets_size;
+    /** log2 of buckets_size */
+    int bucket_bits;
+    /** XOR of the checksums of all entries */
+    of_checksum_128_t checksum;
+} loci_gentable_t;
+
+/* Where a dump is; see loci_gentable_dump_init */
+typedef struct loci_gentable_dump_s {
+    uint32_t bucket;
+    uint32_t end;
+    /** Entries of the bucket already in replies */
+    uint32_t skip;
+    of_checksum_128_t checksum;
+    of_checksum_128_t checksum_mask;
+} loci_gentable_dump_t;
+
+extern int loci_gentable_init(loci_gentable_t *gt, uint16_t table_id,
+                              uint32_t buckets_size);
+extern void loci_gentable_cleanup(loci_gentable_t *gt);
+
+extern int loci_gentable_buckets_size_set(loci_gentable_t *gt,
+                                          uint32_t buckets_size);
+
+extern int loci_gentable_add(loci_gentable_t *gt, const uint8_t *key,
+                             int key_bytes, const uint8_t *value,
+                             int value_bytes, of_checksum_128_t checksum);
+extern int loci_gentable_delete(loci_gentable_t *gt, const uint8_t *key,
+                                int key_bytes);
+extern loci_gentable_entry_t *loci_gentable_lookup(loci_gentable_t *gt,
+                                                   const uint8_t *key,
+                                                   int key_bytes);
+extern uint32_t loci_gentable_clear(loci_gentable_t *gt,
+                                    of_checksum_128_t checksum,
+                                    of_checksum_128_t checksum_mask);
+
+extern int loci_gentable_apply(loci_gentable_t *gt, of_object_t *msg);
+
+extern void loci_gentable_dump_init(loci_gentable_t *gt,
+                                    loci_gentable_dump_t *dump,
+                                    uint32_t first, uint32_t count);
+extern void loci_gentable_dump_select(loci_gentable_t *gt,
+                                      loci_gentable_dump_t *dump,
+                                      of_checksum_128_t checksum,
+                                      of_checksum_128_t checksum_mask);
+extern int loci_gentable_bucket_stats_fill(
+    loci_gentable_t *gt, loci_gentable_dump_t *dump,
+    of_bsn_gentable_bucket_stats_reply_t *reply);
+extern int loci_gentable_entry_desc_fill(
+    loci_gentable_t *gt, loci_gentable_dump_t *dump,
+    of_bsn_gentable_entry_desc_stats_reply_t *reply);
+
+/**
+ * Bucket of a checksum: its top bucket_bits bits
+ */
+static inline uint32_t
+loci_gentable_bucket(loci_gentable_t *gt, of_checksum_128_t checksum)
+{
+    return gt->bucket_bits == 0 ? 0 :
+        (uint32_t)(checksum.hi >> (64 - gt->bucket_bits));
+}
+
+/**
+ * Whether a dump has filled its last reply
+ */
+static inline int
+loci_gentable_dump_done(loci_gentable_dump_t *dump)
+{
+    return dump->bucket >= dump->end;
+}
+
+/**
+ * Number of entries in a gentable
+ */
+static inline uint32_t
+loci_gentable_count(loci_gentable_t *gt)
+{
+    return gt->count;
+}
+
+#endif /* _LOCI_GENTABLE_H_ */
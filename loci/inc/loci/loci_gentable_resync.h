@@ -0,0 +1,116 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_gentable_resync.h
+ *
+ * Bring a switch's BSN generic table to the state of a loci_gentable_t
+ * by comparing bucket checksums, as a controller does on reconnecting.
+ *
+ * A resync sets the switch's buckets size to the desired table's and
+ * asks for the checksums of all buckets.  Buckets whose checksums
+ * differ are dumped with entry desc stats requests, one range of
+ * buckets at a time; neighbouring differing buckets share a request
+ * when the checksum prefix of the request can select them together.
+ * For the entries of each range the switch has, an entry the desired
+ * table doesn't have is deleted and one whose checksum differs is
+ * added again; desired entries the switch didn't report are added
+ * when the range's last reply arrives.  Matching entries cost nothing.
+ *
+ * Messages go out through a send function as they are made, so memory
+ * is a bit per bucket plus a set of the desired entries of the range
+ * being compared; ranges are kept to LOCI_GENTABLE_RESYNC_RANGE_ENTRIES
+ * desired entries where more than one bucket is involved.
+ *
+ * The desired table must keep its buckets size during a resync.  Other
+ * changes made to it meanwhile must be sent to the switch as usual; the
+ * resync may send some of them again.
+ *
+ * Usage:
+ *
+ *   loci_gentable_resync_t rs;
+ *
+ *   loci_gentable_resync_start(&rs, &desired, version, xid, send, cookie);
+ *   while (!loci_gentable_resync_done(&rs)) {
+ *       reply = receive();
+ *       loci_gentable_resync_handle(&rs, reply);
+ *   }
+ *   loci_gentable_resync_cleanup(&rs);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_GENTABLE_RESYNC_H_)
+#define _LOCI_GENTABLE_RESYNC_H_
+
+#include <loci/loci.h>
+#include <loci/loci_gentable.h>
+
+/* Most desired entries in a request covering more than one bucket */
+#define LOCI_GENTABLE_RESYNC_RANGE_ENTRIES 1024
+
+/**
+ * Send a message of the resync to the switch
+ * @param cookie The resync's cookie
+ * @param msg The message; the function owns it
+ * @returns 0, or an error to stop the resync with
+ */
+typedef int (*loci_gentable_resync_send_f)(void *cookie, of_object_t *msg);
+
+typedef enum loci_gentable_resync_state_e {
+    LOCI_GENTABLE_RESYNC_BUCKETS,   /* Waiting for bucket stats replies */
+    LOCI_GENTABLE_RESYNC_ENTRIES,   /* Waiting for entry desc replies */
+    LOCI_GENTABLE_RESYNC_DONE,
+} loci_gentable_resync_state_t;
+
+typedef struct loci_gentable_resync_s {
+    loci_gentable_t *gt;
+    of_version_t version;
+    loci_gentable_resync_send_f send;
+    void *cookie;
+    loci_gentable_resync_state_t state;
+    /** Xid of the next message, and of the request being answered */
+    uint32_t xid;
+    uint32_t request_xid;
+    uint32_t buckets_size;
+    /** A bit per bucket, set when the switch's checksum differs */
+    uint32_t *differ;
+    /** Next bucket of the bucket stats replies, or to look for
+     * differing buckets from */
+    uint32_t bucket;
+    /** Buckets of the entry desc request being answered */
+    uint32_t first;
+    uint32_t count;
+    /** Desired entries of those buckets the switch has as they are */
+    loci_gentable_entry_t **seen;
+    uint32_t seen_slots;
+    uint32_t seen_count;
+    /** Scratch TLV list for building entry adds */
+    of_list_bsn_tlv_t *tlvs;
+    /** What the resync found and did */
+    uint32_t buckets_differ;
+    uint32_t requests;
+    uint32_t adds;
+    uint32_t deletes;
+} loci_gentable_resync_t;
+
+extern int loci_gentable_resync_start(loci_gentable_resync_t *rs,
+                                      loci_gentable_t *gt,
+                                      of_version_t version, uint32_t xid,
+                                      loci_gentable_resync_send_f send,
+                                      void *cookie);
+extern int loci_gentable_resync_handle(loci_gentable_resync_t *rs,
+                                       of_object_t *reply);
+extern void loci_gentable_resync_cleanup(loci_gentable_resync_t *rs);
+
+/**
+ * Whether a resync has sent everything it will send
+ */
+static inline int
+loci_gentable_resync_done(loci_gentable_resync_t *rs)
+{
+    return rs->state == LOCI_GENTABLE_RESYNC_DONE;
+}
+
+#endif /* _LOCI_GENTABLE_RESYNC_H_ */
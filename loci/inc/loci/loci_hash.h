@@ -0,0 +1,106 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_hash.h
+ *
+ * Seeded 64 bit hashes of bytes, matches and objects, over a
+ * canonical form.
+ *
+ * The byte hash follows the XXH64 construction: four lanes of
+ * multiply and rotate rounds over 32 byte stripes, then a final
+ * avalanche.  Words are read little endian, so a hash is the same on
+ * every host.
+ *
+ * The canonical form of a match keeps only the bits under its masks,
+ * so bits of a field outside the mask, the padding of
+ * of_match_fields_t and the version do not count.  Fields OpenFlow 1.0
+ * and 1.1 code differently are brought to the form of later versions:
+ * vlan_vid carries the present bit (0x1000) and is 0 for untagged
+ * packets, and ip_dscp is the DSCP, not the ToS byte.  The same flow
+ * then has the same canonical match, and hash, in every version.
+ * Match hashes are of the in-memory fields, so they are the same
+ * across versions but not across hosts of different byte order.
+ *
+ * The canonical form of an object is the values of its members, as
+ * read by the accessors and written in a binary log record, without
+ * the version.  Padding, lengths and type codes of the wire encoding
+ * don't count, and an object with the same members in two versions
+ * has the same hash.  The xid of a message can be left out, so
+ * retransmits of a message hash the same.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_HASH_H_)
+#define _LOCI_HASH_H_
+
+#include <loci/loci.h>
+
+#define LOCI_HASH_PRIME1 0x9e3779b185ebca87ULL
+#define LOCI_HASH_PRIME2 0xc2b2ae3d27d4eb4fULL
+#define LOCI_HASH_PRIME3 0x165667b19e3779f9ULL
+#define LOCI_HASH_PRIME4 0x85ebca77c2b2ae63ULL
+#define LOCI_HASH_PRIME5 0x27d4eb2f165667c5ULL
+
+/* Flags for loci_object_hash */
+#define LOCI_HASH_IGNORE_XID 0x1
+
+static inline uint64_t
+loci_hash_rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t
+loci_hash_round(uint64_t acc, uint64_t word)
+{
+    acc += word * LOCI_HASH_PRIME2;
+    acc = loci_hash_rotl(acc, 31);
+    return acc * LOCI_HASH_PRIME1;
+}
+
+/**
+ * Start a hash built a word at a time
+ */
+static inline uint64_t
+loci_hash_start(uint64_t seed)
+{
+    return seed + LOCI_HASH_PRIME5;
+}
+
+/**
+ * Add a word to a hash built a word at a time
+ */
+static inline uint64_t
+loci_hash_word(uint64_t hash, uint64_t word)
+{
+    hash ^= loci_hash_round(0, word);
+    return loci_hash_rotl(hash, 27) * LOCI_HASH_PRIME1 + LOCI_HASH_PRIME4;
+}
+
+/**
+ * Finish a hash built a word at a time
+ */
+static inline uint64_t
+loci_hash_finish(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= LOCI_HASH_PRIME2;
+    hash ^= hash >> 29;
+    hash *= LOCI_HASH_PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+extern uint64_t loci_hash_bytes(const void *data, int len, uint64_t seed);
+
+extern void loci_match_canonical(const of_match_t *match, of_match_t *canon);
+extern uint64_t loci_match_hash(const of_match_t *match, uint64_t seed);
+extern int loci_match_equal(const of_match_t *a, const of_match_t *b);
+
+extern int loci_object_hash(of_object_t *obj, uint32_t flags, uint64_t seed,
+                            uint64_t *hash);
+
+#endif /* _LOCI_HASH_H_ */
@@ -0,0 +1,89 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+#if !defined(_LOCI_JSON_H_)
+#define _LOCI_JSON_H_
+
+#include <loci/loci_base.h>
+#include <loci/of_match.h>
+#include <loci/loci_stream.h>
+
+typedef void (*loci_obj_json_f)(loci_stream_t *s, of_object_t *obj);
+
+/****************************************************************
+ *
+ * Per-datatype JSON macros
+ *
+ * Integers are emitted as JSON numbers; addresses, octets, bitmaps
+ * and strings as JSON strings.
+ *
+ ****************************************************************/
+
+#define LOCI_JSON_KEY(s, name) loci_stream_lit(s, ",\"" name "\":")
+
+#define LOCI_JSON_u8(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_u16(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_u32(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_u64(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_x8(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_x16(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_x32(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_x64(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_port_no(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_fm_cmd(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_wc_bmap(s, val) loci_stream_dec(s, val)
+#define LOCI_JSON_match_bmap(s, val) loci_stream_dec(s, val)
+
+#define LOCI_JSON_octets(s, val) loci_json_octets(s, (val).data, (val).bytes)
+#define LOCI_JSON_mac(s, val) loci_json_mac(s, &(val))
+#define LOCI_JSON_ipv4(s, val) loci_json_ipv4(s, val)
+#define LOCI_JSON_ipv6(s, val) loci_json_ipv6(s, &(val))
+
+/* Fixed length, possibly unterminated, character arrays */
+#define LOCI_JSON_string(s, val) loci_json_string(s, val, sizeof(val))
+#define LOCI_JSON_port_name(s, val) LOCI_JSON_string(s, val)
+#define LOCI_JSON_tab_name(s, val) LOCI_JSON_string(s, val)
+#define LOCI_JSON_desc_str(s, val) LOCI_JSON_string(s, val)
+#define LOCI_JSON_ser_num(s, val) LOCI_JSON_string(s, val)
+#define LOCI_JSON_str6(s, val) LOCI_JSON_string(s, val)
+#define LOCI_JSON_str32(s, val) LOCI_JSON_string(s, val)
+#define LOCI_JSON_str64(s, val) LOCI_JSON_string(s, val)
+#define LOCI_JSON_app_code(s, val) LOCI_JSON_string(s, val)
+
+#define LOCI_JSON_circuit_sig_id(s, val) loci_json_circuit_sig_id(s, &(val))
+#define LOCI_JSON_och_sig_id(s, val) loci_json_och_sig_id(s, &(val))
+#define LOCI_JSON_odu_sig_id(s, val) loci_json_odu_sig_id(s, &(val))
+
+#define LOCI_JSON_match(s, val) loci_json_match(s, &(val))
+
+/* Bitmaps and checksums are hex strings, most significant word first */
+#define LOCI_JSON_bitmap_128(s, val) loci_json_u128(s, (val).hi, (val).lo)
+#define LOCI_JSON_checksum_128(s, val) loci_json_u128(s, (val).hi, (val).lo)
+#define LOCI_JSON_bitmap_256(s, val) loci_json_words(s, (val).words, 4)
+#define LOCI_JSON_bitmap_512(s, val) loci_json_words(s, (val).words, 8)
+#define LOCI_JSON_mcs_rx_mask(s, val) \
+    loci_json_octets(s, (val).bytes, sizeof((val).bytes))
+
+extern void loci_json_string(loci_stream_t *s, const char *str, int max_len);
+extern void loci_json_octets(loci_stream_t *s, const uint8_t *data, int len);
+extern void loci_json_mac(loci_stream_t *s, const of_mac_addr_t *mac);
+extern void loci_json_ipv4(loci_stream_t *s, uint32_t ipv4);
+extern void loci_json_ipv6(loci_stream_t *s, const of_ipv6_t *ipv6);
+extern void loci_json_words(loci_stream_t *s, const uint64_t *words, int count);
+extern void loci_json_u128(loci_stream_t *s, uint64_t hi, uint64_t lo);
+extern void loci_json_circuit_sig_id(loci_stream_t *s,
+                                     const of_circuit_sig_id_t *sig_id);
+extern void loci_json_och_sig_id(loci_stream_t *s,
+                                 const of_och_sig_id_t *sig_id);
+extern void loci_json_odu_sig_id(loci_stream_t *s,
+                                 const of_odu_sig_id_t *sig_id);
+extern void loci_json_match(loci_stream_t *s, of_match_t *match);
+
+/**
+ * Generic version for any object
+ */
+int of_object_json(loci_stream_t *s, of_object_t *obj);
+
+#endif /* _LOCI_JSON_H_ */
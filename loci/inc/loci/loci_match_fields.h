@@ -0,0 +1,68 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_match_fields.h
+ *
+ * Table driven access to the fields of of_match_fields_t.
+ *
+ * Fields are indexed in declaration order.  The kind of each field
+ * follows the datatype used to show it, so for example arp_spa is
+ * an IPV4 field.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_MATCH_FIELDS_H_)
+#define _LOCI_MATCH_FIELDS_H_
+
+#include <stddef.h>
+#include <loci/loci_base.h>
+#include <loci/of_match.h>
+
+#define LOCI_MATCH_FIELD_COUNT 100
+
+typedef enum loci_match_field_kind_e {
+    LOCI_MATCH_FIELD_U8,
+    LOCI_MATCH_FIELD_U16,
+    LOCI_MATCH_FIELD_U32,
+    LOCI_MATCH_FIELD_U64,
+    LOCI_MATCH_FIELD_MAC,
+    LOCI_MATCH_FIELD_IPV4,
+    LOCI_MATCH_FIELD_IPV6,
+    LOCI_MATCH_FIELD_BITMAP_128,
+    LOCI_MATCH_FIELD_BITMAP_512,
+    LOCI_MATCH_FIELD_CIRCUIT_SIG_ID,
+    LOCI_MATCH_FIELD_OCH_SIG_ID,
+    LOCI_MATCH_FIELD_ODU_SIG_ID,
+} loci_match_field_kind_t;
+
+typedef struct loci_match_field_s {
+    const char *name;
+    uint8_t name_len;
+    uint8_t kind;               /* loci_match_field_kind_t */
+    uint16_t offset;            /* Offset in of_match_fields_t */
+    uint16_t size;              /* Size in of_match_fields_t */
+} loci_match_field_t;
+
+extern const loci_match_field_t loci_match_fields[LOCI_MATCH_FIELD_COUNT];
+
+/**
+ * 0xff for each byte of of_match_fields_t that holds a field value,
+ * 0 for padding and pointers
+ */
+extern const uint8_t loci_match_field_valid_bytes[sizeof(of_match_fields_t)];
+
+extern const loci_match_field_t *loci_match_field_lookup(const char *name,
+                                                         int len);
+
+/**
+ * Pointers to the value and mask of a field within a match
+ */
+#define LOCI_MATCH_FIELD_VALUE(match, field) \
+    ((uint8_t *)&(match)->fields + (field)->offset)
+#define LOCI_MATCH_FIELD_MASK(match, field) \
+    ((uint8_t *)&(match)->masks + (field)->offset)
+
+#endif /* _LOCI_MATCH_FIELDS_H_ */
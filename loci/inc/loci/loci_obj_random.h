@@ -0,0 +1,1945 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ *
+ * Generated by scripts/gen_obj_random.py from the loxigen output.
+ * Edit the script, not this file.
+ *
+ * Header file for random generation of objects.
+ */
+
+/**
+ * Random object declarations
+ *
+ * Routines that fill each object with random member values.
+ *
+ */
+
+#if !defined(_LOCI_OBJ_RANDOM_H_)
+#define _LOCI_OBJ_RANDOM_H_
+
+#include <loci/loci.h>
+#include <loci/loci_random.h>
+
+
+int of_aggregate_stats_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_action_error_msg_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_request_error_msg_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_ip_mask_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_ip_mask_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_l2_table_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_l2_table_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_hybrid_get_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_hybrid_get_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_timeout_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_ip_mask_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_l2_table_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_l2_table_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_mirroring_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_shell_command_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_shell_output_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_shell_status_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_add_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_strict_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_mod_failed_error_msg_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_strict_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_removed_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_failed_error_msg_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_nicira_controller_role_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_nicira_controller_role_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_in_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_out_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_failed_error_msg_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_status_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_op_failed_error_msg_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_set_config_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_reply_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_request_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_checksum_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_mirror_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_set_tunnel_dst_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_enqueue_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_dec_ttl_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_move_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_pop_nsh_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_push_nsh_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_table_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_output_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_dl_dst_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_dl_src_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_dst_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_src_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_tos_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_tp_dst_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_tp_src_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_vlan_pcp_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_vlan_vid_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_strip_vlan_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_interface_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_l2gre_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_q_in_q_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_entry_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_match_v1_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_queue_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_entry_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_min_rate_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_entry_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_entry_OF_VERSION_1_0_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_action_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_instruction_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_match_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_request_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_timeout_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_mirroring_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_add_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_strict_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_mod_failed_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_strict_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_removed_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_add_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_delete_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_mod_failed_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_modify_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_failed_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_in_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_out_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_failed_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_status_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_op_failed_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_set_config_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_switch_config_failed_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_failed_error_msg_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_reply_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_request_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_checksum_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_mirror_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_set_tunnel_dst_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_in_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_out_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_mpls_ttl_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_nw_ttl_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_group_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_dec_ttl_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_move_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_pop_nsh_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_push_nsh_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_table_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_output_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_mpls_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_vlan_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_mpls_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_vlan_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_dl_dst_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_dl_src_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_mpls_label_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_mpls_tc_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_mpls_ttl_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_dst_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_ecn_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_src_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_tos_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_ttl_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_queue_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_tp_dst_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_tp_src_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_vlan_pcp_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_vlan_vid_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_interface_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_l2gre_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_q_in_q_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_counter_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_entry_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_entry_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_entry_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_apply_actions_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_clear_actions_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_goto_table_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_actions_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_metadata_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_match_v2_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_queue_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_entry_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_min_rate_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_entry_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_entry_OF_VERSION_1_1_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_action_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_instruction_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_match_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_request_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_timeout_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_mirroring_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_add_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_strict_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_mod_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_strict_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_removed_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_add_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_delete_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_features_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_features_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_mod_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_modify_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_in_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_out_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_status_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_op_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_request_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_set_config_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_switch_config_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_failed_error_msg_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_reply_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_request_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_checksum_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_mirror_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_set_tunnel_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_in_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_out_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_mpls_ttl_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_nw_ttl_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_group_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_dec_ttl_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_move_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_pop_nsh_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_push_nsh_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_table_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_output_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_mpls_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_vlan_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_mpls_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_vlan_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_field_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_mpls_ttl_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_ttl_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_queue_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_interface_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_l2gre_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_q_in_q_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_counter_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_entry_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_entry_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_entry_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_apply_actions_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_clear_actions_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_goto_table_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_actions_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_metadata_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_match_v3_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_op_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_op_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_sha_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_sha_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_spa_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_spa_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tha_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tha_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tpa_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tpa_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_egr_port_group_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_128_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_512_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ip_fragmentation_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l2_cache_hit_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_src_class_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_lag_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_lag_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_tcp_flags_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf0_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf0_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf1_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf1_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf2_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf2_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf3_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf3_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf4_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf4_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf5_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf5_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf6_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf6_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf7_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf7_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vrf_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vrf_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_type_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_type_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_type_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_type_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_code_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_code_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_type_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_type_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_code_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_code_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_type_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_type_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_phy_port_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_phy_port_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_port_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_port_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_dscp_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_dscp_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_ecn_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_ecn_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_proto_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_proto_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_flabel_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_flabel_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_sll_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_target_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_target_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_tll_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_metadata_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_metadata_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_label_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_label_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_tc_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_tc_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c1_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c1_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c2_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c2_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c3_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c3_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c4_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c4_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_mdtype_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_mdtype_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_np_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_np_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsi_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsi_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsp_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsp_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ovs_tcp_flags_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_flags_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_flags_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_flags_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_flags_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_id_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_id_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_flags_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_flags_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_np_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_np_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_dst_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_dst_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_src_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_src_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_pcp_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_pcp_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_vid_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_vid_masked_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_queue_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_entry_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_max_rate_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_min_rate_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_entry_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_entry_OF_VERSION_1_2_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_get_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_get_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_set_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_action_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_instruction_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_match_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_request_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_arp_idle_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_controller_connections_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_controller_connections_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_error_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_get_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_set_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_bucket_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_clear_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_clear_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_add_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_delete_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_set_buckets_size_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_switch_pipeline_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_switch_pipeline_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_image_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_image_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_convergence_notif_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_log_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_command_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_command_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_notification_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_upload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_timeout_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_port_counter_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_port_counter_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_role_status_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_aux_cxns_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_aux_cxns_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_lacp_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_lacp_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_mirroring_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_switch_pipeline_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_switch_pipeline_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_switch_pipeline_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_checksum_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_checksum_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_set_buckets_size_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_time_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_time_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_clear_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vrf_counter_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vrf_counter_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_flow_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_flow_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_status_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_circuit_port_status_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_circuit_ports_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_circuit_ports_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_adjacency_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_adjacency_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_desc_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_desc_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_add_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_strict_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_mod_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_strict_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_removed_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_add_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_delete_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_features_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_features_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_mod_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_modify_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_config_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_config_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_features_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_features_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_mod_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_mod_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oplink_channel_power_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oplink_channel_power_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oplink_port_power_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oplink_port_power_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oplink_port_power_set_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_in_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_out_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_status_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_get_config_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_op_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_request_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_add_client_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_add_lvap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_del_client_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_del_lvap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_channel_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_channel_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_clients_reply_crypto_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_clients_reply_lvap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_clients_reply_normal_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_clients_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_remote_port_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_get_remote_port_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_ieee80211_mgmt_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_ieee80211_mgmt_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_mod_lvap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_packet_in_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_port_desc_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_port_desc_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_set_channel_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_set_config_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_switch_config_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_failed_error_msg_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_reply_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_request_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_checksum_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_gentable_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_mirror_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_set_tunnel_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_in_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_out_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_mpls_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_nw_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_group_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_checksum_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_gentable_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_mirror_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_circuit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_copy_ttl_in_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_copy_ttl_out_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_dec_mpls_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_dec_nw_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_group_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_dec_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_move_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_pop_nsh_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_push_nsh_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_resubmit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_resubmit_table_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_ofdpa_pop_cw_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_ofdpa_pop_l2_header_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_ofdpa_push_cw_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_ofdpa_push_l2_header_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_oplink_att_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_output_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_pop_mpls_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_pop_pbb_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_pop_vlan_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_push_mpls_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_push_pbb_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_push_vlan_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_field_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_mpls_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_nw_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_queue_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_dec_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_move_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_pop_nsh_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_push_nsh_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_table_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_ofdpa_pop_cw_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_ofdpa_pop_l2_header_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_ofdpa_push_cw_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_ofdpa_push_l2_header_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_output_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_mpls_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_pbb_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_vlan_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_mpls_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_pbb_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_vlan_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_field_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_mpls_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_queue_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_controller_connection_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_desc_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_interface_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_port_counter_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_checksum_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_key_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_port_num_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_port_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_state_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_system_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_system_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_anchor_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_apply_bytes_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_apply_packets_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_auto_negotiation_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_broadcast_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_bucket_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_circuit_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_convergence_status_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_cpu_lag_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_crc_enabled_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_data_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_data_mask_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_decap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_drop_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_dscp_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ecn_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_egress_only_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_egress_port_group_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_eth_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_eth_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_eth_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_gateway_ip_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_gateway_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_ip_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_netmask_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_generation_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_packet_field_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_packet_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_seed_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_header_size_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmp_code_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmp_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmp_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_idle_notification_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_idle_time_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_idle_timeout_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_igmp_snooping_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_internal_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_interval_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ip_proto_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_netmask_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_prefix_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_known_multicast_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l3_src_class_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_loopback_port_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mac_mask_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_miss_packets_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mpls_control_word_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mpls_label_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mpls_sequenced_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_multicast_interface_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_name_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ndp_offload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ndp_static_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_negate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_next_hop_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_offset_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_parent_port_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_key_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_port_num_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_port_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_state_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_system_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_system_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_port_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_port_usage_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_qos_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_queue_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_queue_weight_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rate_limit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rate_unit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_reference_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_reply_packets_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_request_packets_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rx_bytes_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rx_packets_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_sampling_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_set_loopback_mode_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_status_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_sub_agent_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tcp_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tcp_flags_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tcp_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ttl_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tunnel_capability_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tx_bytes_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tx_packets_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_anchor_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_length_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_offset_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udp_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udp_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_uint64_list_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_unicast_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_untagged_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_use_packet_state_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vfi_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vfp_class_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_mac_list_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_pcp_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_vid_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vni_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vpn_key_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vrf_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_mac_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_l2gre_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_q_in_q_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vrf_counter_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_counter_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_desc_prop_optical_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_desc_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_calient_port_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_ext_ad_id_port_otn_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_ext_ad_id_sonet_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_adjacency_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_des_prop_header_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_desc_prop_optical_transport_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_optical_transport_layer_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_exp_port_optical_transport_layer_stack_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_elem_versionbitmap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_ieee80211_ht_cap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_ieee80211_mcs_info_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_ieee80211_vht_cap_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_ieee80211_vht_mcs_info_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_apply_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_arp_offload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_auto_negotiation_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_deny_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_dhcp_offload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_disable_l3_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_disable_split_horizon_check_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_hash_select_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_internal_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_ndp_offload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_packet_of_death_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_permit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_prioritize_pdus_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_span_destination_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_clear_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_goto_table_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_apply_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_arp_offload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_deny_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_disable_l3_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_disable_split_horizon_check_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_hash_select_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_internal_priority_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_ndp_offload_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_packet_of_death_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_permit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_span_destination_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_clear_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_goto_table_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_meter_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_write_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_write_metadata_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_meter_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_metadata_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_match_v3_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_drop_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_dscp_remark_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_experimenter_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_stats_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_config_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_features_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_stats_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oplink_channel_power_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oplink_port_power_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_op_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_op_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_sha_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_sha_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_spa_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_spa_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tha_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tha_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tpa_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tpa_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_egr_port_group_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_128_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_512_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ip_fragmentation_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l2_cache_hit_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_src_class_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_lag_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_lag_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_tcp_flags_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf0_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf0_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf1_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf1_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf2_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf2_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf3_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf3_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf4_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf4_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf5_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf5_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf6_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf6_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf7_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf7_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vfi_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vfi_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vrf_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vrf_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vxlan_network_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigid_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigid_basic_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigid_basic_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigid_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigtype_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigtype_basic_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigtype_basic_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_circuit_och_sigtype_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_type_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_type_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_exp_och_sigid_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_exp_och_sigid_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_exp_och_sigtype_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_exp_och_sigtype_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_exp_odu_sigtype_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_exp_odu_sigtype_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_code_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_code_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_type_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_code_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_code_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_type_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_phy_port_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_phy_port_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_port_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_port_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_dscp_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_dscp_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_ecn_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_ecn_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_proto_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_proto_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_exthdr_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_exthdr_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_flabel_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_flabel_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_sll_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_target_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_target_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_tll_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_metadata_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_metadata_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_bos_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_bos_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_label_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_label_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_tc_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_tc_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c1_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c1_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c2_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c2_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c3_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c3_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c4_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c4_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_mdtype_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_mdtype_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_np_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_np_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsi_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsi_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsp_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsp_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_och_sigatt_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_och_sigatt_basic_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_och_sigatt_basic_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_och_sigatt_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_mpls_l2_port_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_mpls_l2_port_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_mpls_type_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_mpls_type_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_ovid_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_ovid_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_qos_index_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ofdpa_qos_index_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ovs_tcp_flags_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_flags_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_flags_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_flags_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_flags_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_flags_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_flags_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_np_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_np_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_id_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_id_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_dst_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_dst_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_src_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_src_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_pcp_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_pcp_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_vid_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_vid_masked_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_queue_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_prop_optical_transport_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_optical_transport_application_code_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_optical_transport_layer_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_optical_transport_layer_stack_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_max_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_min_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_entity_accesspoint_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_entity_band_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_entity_freq_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_entity_nic_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_entity_rate_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_sdwn_entity_related_switch_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_actions_miss_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_setfield_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_instructions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_instructions_miss_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_match_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_next_tables_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_next_tables_miss_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_wildcards_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_actions_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_actions_miss_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_setfield_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_setfield_miss_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_entry_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_uint32_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_uint64_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_uint8_OF_VERSION_1_3_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_aggregate_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_get_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_get_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_set_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_action_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_instruction_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_match_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_property_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bad_request_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_barrier_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_arp_idle_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_clear_data_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_get_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_bw_enable_set_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_controller_connections_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_controller_connections_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_error_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_get_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_idle_enable_set_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_async_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_command_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_bucket_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_clear_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_clear_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_add_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_delete_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_set_buckets_size_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_interfaces_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_mirroring_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_switch_pipeline_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_get_switch_pipeline_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_image_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_image_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_convergence_notif_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_log_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_command_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_command_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_notification_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lua_upload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_rx_timeout_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_pdu_tx_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_port_counter_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_port_counter_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_aux_cxns_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_aux_cxns_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_lacp_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_lacp_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_mirroring_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_pktin_suppression_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_switch_pipeline_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_set_switch_pipeline_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_switch_pipeline_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_checksum_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_checksum_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_set_buckets_size_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_takeover_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_time_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_time_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_create_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_virtual_port_remove_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_clear_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vrf_counter_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vrf_counter_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bundle_add_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bundle_ctrl_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bundle_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_echo_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_features_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_add_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_delete_strict_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_mod_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_modify_strict_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_monitor_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_removed_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_get_config_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_add_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_delete_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_features_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_features_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_mod_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_modify_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_config_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_config_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_features_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_features_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_mod_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_mod_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_in_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_out_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_status_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_op_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_requestforward_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_request_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_role_status_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_set_config_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_switch_config_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_desc_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_desc_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_failed_error_msg_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_reply_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_request_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_status_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_checksum_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_gentable_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_mirror_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_bsn_set_tunnel_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_in_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_copy_ttl_out_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_mpls_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_dec_nw_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_group_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_checksum_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_gentable_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_mirror_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_copy_ttl_in_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_copy_ttl_out_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_dec_mpls_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_dec_nw_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_group_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_dec_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_move_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_pop_nsh_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_push_nsh_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_resubmit_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_nicira_resubmit_table_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_output_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_pop_mpls_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_pop_pbb_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_pop_vlan_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_push_mpls_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_push_pbb_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_push_vlan_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_field_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_mpls_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_nw_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_id_set_queue_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_dec_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_move_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_pop_nsh_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_push_nsh_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_nicira_resubmit_table_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_output_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_mpls_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_pbb_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_pop_vlan_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_mpls_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_pbb_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_push_vlan_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_field_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_mpls_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_nw_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_action_set_queue_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_experimenter_master_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_experimenter_slave_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_flow_removed_master_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_flow_removed_slave_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_packet_in_master_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_packet_in_slave_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_port_status_master_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_port_status_slave_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_requestforward_master_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_requestforward_slave_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_role_status_master_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_role_status_slave_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_table_status_master_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_async_config_prop_table_status_slave_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_controller_connection_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_debug_counter_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_generic_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_desc_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_entry_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_gentable_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_interface_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_lacp_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_port_counter_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_table_checksum_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_key_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_port_num_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_port_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_state_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_system_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_actor_system_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_anchor_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_apply_bytes_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_apply_packets_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_auto_negotiation_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_broadcast_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_bucket_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_circuit_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_convergence_status_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_cpu_lag_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_crc_enabled_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_data_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_data_mask_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_decap_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_drop_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_dscp_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ecn_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_egress_only_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_egress_port_group_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_eth_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_eth_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_eth_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_gateway_ip_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_gateway_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_ip_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_external_netmask_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_generation_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_packet_field_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_packet_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_seed_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_hash_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_header_size_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmp_code_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmp_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmp_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_idle_notification_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_idle_time_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_idle_timeout_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_igmp_snooping_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_internal_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_interval_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ip_proto_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_netmask_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv4_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_prefix_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ipv6_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_known_multicast_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_l3_src_class_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_loopback_port_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mac_mask_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_miss_packets_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mpls_control_word_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mpls_label_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_mpls_sequenced_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_multicast_interface_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_name_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ndp_offload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ndp_static_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_negate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_next_hop_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_offset_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_parent_port_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_key_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_port_num_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_port_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_state_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_system_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_partner_system_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_port_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_port_usage_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_qos_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_queue_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_queue_weight_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rate_limit_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rate_unit_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_reference_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_reply_packets_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_request_packets_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rx_bytes_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_rx_packets_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_sampling_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_set_loopback_mode_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_status_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_sub_agent_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tcp_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tcp_flags_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tcp_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_ttl_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tunnel_capability_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tx_bytes_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_tx_packets_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_anchor_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_length_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udf_offset_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udp_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_udp_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_uint64_list_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_unicast_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_untagged_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_use_packet_state_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vfi_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vfp_class_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_mac_list_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_pcp_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_vid_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vni_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vpn_key_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vrf_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_counter_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vlan_mac_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_l2gre_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vport_q_in_q_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bsn_vrf_counter_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_bucket_counter_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_flow_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_desc_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_group_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_hello_elem_versionbitmap_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_apply_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_arp_offload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_auto_negotiation_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_deny_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_dhcp_offload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_disable_l3_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_hash_select_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_internal_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_ndp_offload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_packet_of_death_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_permit_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_prioritize_pdus_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_bsn_span_destination_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_clear_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_goto_table_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_apply_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_arp_offload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_deny_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_disable_l3_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_hash_select_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_internal_priority_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_ndp_offload_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_packet_of_death_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_permit_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_bsn_span_destination_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_clear_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_goto_table_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_meter_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_write_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_id_write_metadata_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_meter_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_instruction_write_metadata_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_match_v3_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_drop_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_dscp_remark_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_experimenter_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_band_stats_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_config_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_features_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_meter_stats_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_op_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_op_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_sha_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_sha_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_spa_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_spa_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tha_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tha_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tpa_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_arp_tpa_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_egr_port_group_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_128_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_512_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ip_fragmentation_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l2_cache_hit_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_src_class_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_lag_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_lag_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_tcp_flags_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf0_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf0_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf1_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf1_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf2_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf2_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf3_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf3_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf4_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf4_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf5_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf5_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf6_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf6_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf7_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_udf7_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vfi_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vfi_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vrf_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vrf_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vxlan_network_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_encap_eth_type_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_eth_type_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_code_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_code_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv4_type_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_code_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_code_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_type_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_icmpv6_type_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_phy_port_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_phy_port_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_port_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_in_port_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_dscp_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_dscp_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_ecn_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_ecn_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_proto_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ip_proto_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv4_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_exthdr_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_exthdr_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_flabel_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_flabel_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_sll_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_target_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_target_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_tll_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ipv6_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_metadata_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_metadata_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_bos_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_bos_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_label_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_label_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_tc_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_mpls_tc_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c1_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c1_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c2_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c2_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c3_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c3_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c4_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_c4_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_mdtype_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_mdtype_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_np_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsh_np_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsi_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsi_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsp_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_nsp_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ovs_tcp_flags_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_pbb_uca_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_pbb_uca_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_sctp_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tcp_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_flags_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_flags_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_flags_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_flags_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gbp_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_flags_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_flags_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_np_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tun_gpe_np_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_id_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_dst_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_dst_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_src_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_udp_src_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_pcp_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_pcp_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_vid_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_oxm_vlan_vid_masked_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_packet_queue_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_prop_bsn_forward_error_correction_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_prop_bsn_generation_id_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_prop_bsn_uplink_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_prop_ethernet_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_desc_prop_optical_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_prop_ethernet_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_mod_prop_optical_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_prop_ethernet_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_port_stats_prop_optical_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_desc_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_desc_prop_bsn_queue_name_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_desc_prop_max_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_desc_prop_min_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_max_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_prop_min_rate_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_queue_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_desc_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_actions_miss_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_setfield_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_instructions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_instructions_miss_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_match_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_next_tables_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_next_tables_miss_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_table_sync_from_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_wildcards_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_actions_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_actions_miss_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_setfield_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_feature_prop_write_setfield_miss_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_features_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_prop_eviction_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_mod_prop_vacancy_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_table_stats_entry_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_uint32_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_uint64_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+int of_uint8_OF_VERSION_1_4_random(loci_random_t *r, of_object_t *obj, int depth);
+
+#endif /* _LOCI_OBJ_RANDOM_H_ */
@@ -0,0 +1,67 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_packet.h
+ *
+ * Parse the headers of a packet, such as the data of a packet_in,
+ * into an exact match.
+ *
+ * The headers understood are Ethernet, one 802.1Q or 802.1ad tag,
+ * the top MPLS label, IPv4, IPv6 (skipping hop-by-hop, routing,
+ * fragment and destination options headers), ARP, TCP, UDP, SCTP,
+ * ICMP and ICMPv6 with neighbor discovery.  Each field found is set
+ * in the match with an exact mask; fields of headers not in the
+ * packet are left wildcarded.  L4 fields are not set for a fragment
+ * other than the first.  ipv6_exthdr is not set.
+ *
+ * Only the field groups asked for are set, and parsing stops once the
+ * headers they need are done, so asking for less is faster.  A group
+ * brings in the fields it depends on: eth_type for every group past
+ * Ethernet, ip_proto for L4 and ND, icmpv6_type for ND.
+ *
+ * The in_port and other pipeline fields are not in the packet, so are
+ * left to the caller.
+ *
+ * Usage:
+ *
+ *   loci_packet_in_t pi;
+ *   of_match_t match;
+ *
+ *   if (loci_packet_in_peek(buf, len, &pi) == 0) {
+ *       loci_packet_match(version, pi.data, pi.data_len,
+ *                         LOCI_PACKET_FIELDS_ALL, &match);
+ *       match.fields.in_port = pi.in_port;
+ *       OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+ *   }
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_PACKET_H_)
+#define _LOCI_PACKET_H_
+
+#include <loci/loci.h>
+
+/** eth_dst, eth_src, eth_type */
+#define LOCI_PACKET_FIELDS_ETH  (1 << 0)
+/** vlan_vid, vlan_pcp */
+#define LOCI_PACKET_FIELDS_VLAN (1 << 1)
+/** mpls_label, mpls_tc, mpls_bos */
+#define LOCI_PACKET_FIELDS_MPLS (1 << 2)
+/** ip_dscp, ip_ecn, ip_proto, ipv4_src/dst, ipv6_src/dst, ipv6_flabel */
+#define LOCI_PACKET_FIELDS_IP   (1 << 3)
+/** arp_op, arp_spa, arp_tpa, arp_sha, arp_tha */
+#define LOCI_PACKET_FIELDS_ARP  (1 << 4)
+/** tcp/udp/sctp src/dst, icmpv4/icmpv6 type/code */
+#define LOCI_PACKET_FIELDS_L4   (1 << 5)
+/** ipv6_nd_target, ipv6_nd_sll, ipv6_nd_tll */
+#define LOCI_PACKET_FIELDS_ND   (1 << 6)
+
+#define LOCI_PACKET_FIELDS_ALL  ((1 << 7) - 1)
+
+extern int loci_packet_match(of_version_t version, uint8_t *pkt, int len,
+                             uint32_t fields, of_match_t *match);
+
+#endif /* _LOCI_PACKET_H_ */
@@ -0,0 +1,95 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_parse.h
+ *
+ * Text parser for matches and flows.
+ *
+ * A flow is a list of key=value pairs separated by commas or white
+ * space, for example
+ *
+ *   table=0,priority=100,in_port=1,eth_type=0x800,ipv4_dst=10.0.0.0/8 actions=output:2
+ *
+ * Match keys are the field names printed by loci_show_match.  Each
+ * value may be followed by /mask; IPv4 and IPv6 masks may also be
+ * given as a prefix length.  Without a mask the field is matched
+ * exactly.  Integers are decimal or 0x prefixed hex.
+ *
+ * Flow keys are table, priority, cookie (with optional /mask),
+ * idle_timeout, hard_timeout, importance, buffer_id, out_port,
+ * out_group and flags.
+ *
+ * "actions=" must come last; the rest of the text is a comma
+ * separated action list:
+ *
+ *   output:PORT[:MAX_LEN]  group:ID  set_queue:ID  push_vlan:ETHERTYPE
+ *   pop_vlan  push_mpls:ETHERTYPE  pop_mpls:ETHERTYPE  dec_nw_ttl
+ *   goto_table:ID  drop
+ *
+ * Ports may be given by number or as one of in_port, table, normal,
+ * flood, all, controller, local or any.
+ *
+ * The parser reads the input without copying or modifying it, and does
+ * not allocate.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_PARSE_H_)
+#define _LOCI_PARSE_H_
+
+#include <loci/loci.h>
+
+#define LOCI_FLOW_MAX_ACTIONS 16
+
+typedef enum loci_flow_action_type_e {
+    LOCI_FLOW_ACTION_OUTPUT,        /* arg: port, arg16: max_len */
+    LOCI_FLOW_ACTION_GROUP,         /* arg: group_id */
+    LOCI_FLOW_ACTION_SET_QUEUE,     /* arg: queue_id */
+    LOCI_FLOW_ACTION_PUSH_VLAN,     /* arg16: ethertype */
+    LOCI_FLOW_ACTION_POP_VLAN,
+    LOCI_FLOW_ACTION_PUSH_MPLS,     /* arg16: ethertype */
+    LOCI_FLOW_ACTION_POP_MPLS,      /* arg16: ethertype */
+    LOCI_FLOW_ACTION_DEC_NW_TTL,
+} loci_flow_action_type_t;
+
+typedef struct loci_flow_action_s {
+    loci_flow_action_type_t type;
+    uint32_t arg;
+    uint16_t arg16;
+} loci_flow_action_t;
+
+/**
+ * A parsed flow, independent of OpenFlow version
+ */
+typedef struct loci_flow_s {
+    of_match_t match;
+    uint64_t cookie;
+    uint64_t cookie_mask;
+    uint32_t buffer_id;
+    of_port_no_t out_port;
+    uint32_t out_group;
+    uint16_t priority;
+    uint16_t idle_timeout;
+    uint16_t hard_timeout;
+    uint16_t importance;
+    uint16_t flags;
+    uint8_t table_id;
+    /* Table for a goto_table instruction, or -1 if there is none */
+    int goto_table;
+    int action_count;
+    loci_flow_action_t actions[LOCI_FLOW_MAX_ACTIONS];
+} loci_flow_t;
+
+extern int loci_match_parse(const char *str, int len, of_match_t *match,
+                            const char **errp);
+extern int loci_flow_parse(const char *str, int len, loci_flow_t *flow,
+                           const char **errp);
+extern int loci_flow_add_fill(of_flow_add_t *obj, loci_flow_t *flow);
+extern of_flow_add_t *loci_flow_add_parse(of_version_t version,
+                                          const char *str, int len,
+                                          int *rv);
+
+#endif /* _LOCI_PARSE_H_ */
@@ -0,0 +1,143 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_pdu_sched.h
+ *
+ * The switch side of the BSN PDU messages: a scheduler of the PDU
+ * slots a controller sets up on ports.
+ *
+ * An of_bsn_pdu_tx_request gives a slot a PDU to send every
+ * tx_interval_ms; an of_bsn_pdu_rx_request gives it a timeout_ms in
+ * which a PDU must be received, else an of_bsn_pdu_rx_timeout is sent
+ * to the controller, and again every timeout_ms until one is.  An
+ * interval or timeout of 0 stops the slot.  A port has up to 256 slots
+ * of each kind.
+ *
+ * Slots are kept in a hierarchical timer wheel of 4 levels of 256
+ * buckets, each level a tick 256 times longer than the one below, so
+ * starting, stopping and firing a slot take constant time however many
+ * there are.  A bucket of a higher level is moved down a level as the
+ * clock reaches it.  Spans of time with nothing to fire are skipped a
+ * level at a time.
+ *
+ * The clock is the caller's, in milliseconds; a test can run it as
+ * fast or as slow as it likes.  Advancing it sends the PDUs that are
+ * due, each from the bytes given in its request, and writes an
+ * of_bsn_pdu_rx_timeout for each rx slot that timed out to a stream,
+ * so the messages of a tick go out in a single write.  Neither the
+ * send function nor the stream's flush may change the scheduler.
+ *
+ * Usage:
+ *
+ *   loci_pdu_sched_t sched;
+ *   loci_stream_t timeouts;
+ *
+ *   loci_pdu_sched_init(&sched, version, now_ms);
+ *   loci_stream_init(&timeouts, buf, sizeof(buf), controller_send, conn);
+ *   ...
+ *   rv = loci_pdu_sched_apply(&sched, request);
+ *   ...
+ *   loci_pdu_sched_rx(&sched, port_no, slot_num);
+ *   ...
+ *   loci_pdu_sched_advance(&sched, now_ms, port_send, ports, &timeouts);
+ *   loci_stream_finish(&timeouts);
+ *   ...
+ *   loci_pdu_sched_cleanup(&sched);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_PDU_SCHED_H_)
+#define _LOCI_PDU_SCHED_H_
+
+#include <loci/loci.h>
+#include <loci/loci_stream.h>
+
+/* Slot kinds */
+#define LOCI_PDU_TX 0
+#define LOCI_PDU_RX 1
+
+/* Initial slots of the index, a power of 2 */
+#define LOCI_PDU_SCHED_SLOTS 64
+
+/* Levels of the wheel and buckets of a level */
+#define LOCI_PDU_WHEEL_LEVELS 4
+#define LOCI_PDU_WHEEL_BITS 8
+#define LOCI_PDU_WHEEL_BUCKETS (1 << LOCI_PDU_WHEEL_BITS)
+
+typedef struct loci_pdu_timer_s {
+    /** Next timer in the index slot */
+    struct loci_pdu_timer_s *next;
+    /** Next timer in the wheel bucket, and the pointer to this one */
+    struct loci_pdu_timer_s *wheel_next;
+    struct loci_pdu_timer_s **wheel_prev;
+    /** When it fires, on the scheduler's clock */
+    uint64_t expires;
+    /** tx_interval_ms or timeout_ms */
+    uint32_t interval_ms;
+    of_port_no_t port_no;
+    uint8_t slot_num;
+    /** LOCI_PDU_TX or LOCI_PDU_RX */
+    uint8_t kind;
+    /** Level of the wheel it is in */
+    uint8_t level;
+    uint16_t data_len;
+    /** The PDU to send, or the one expected */
+    uint8_t data[];
+} loci_pdu_timer_t;
+
+typedef struct loci_pdu_sched_s {
+    /** Version of the rx_timeout messages */
+    of_version_t version;
+    /** The last tick advanced to */
+    uint64_t now;
+    /** Index: chains of timers by hash of port, slot and kind */
+    loci_pdu_timer_t **slots;
+    uint32_t n_slots;
+    uint32_t count;
+    loci_pdu_timer_t *wheel[LOCI_PDU_WHEEL_LEVELS][LOCI_PDU_WHEEL_BUCKETS];
+    uint32_t level_count[LOCI_PDU_WHEEL_LEVELS];
+    /** xid of the next rx_timeout */
+    uint32_t xid;
+    /** Sends the send function failed */
+    uint64_t tx_errors;
+} loci_pdu_sched_t;
+
+/**
+ * Send a PDU out of a port
+ * @param cookie As given to loci_pdu_sched_advance
+ * @param port_no The port
+ * @param slot_num The slot of the port
+ * @param data The PDU
+ * @param len Length of data
+ * @returns 0 or an error, which is counted in tx_errors
+ */
+typedef int (*loci_pdu_sched_tx_f)(void *cookie, of_port_no_t port_no,
+                                   uint8_t slot_num, const uint8_t *data,
+                                   int len);
+
+extern int loci_pdu_sched_init(loci_pdu_sched_t *sched, of_version_t version,
+                               uint64_t now);
+extern void loci_pdu_sched_cleanup(loci_pdu_sched_t *sched);
+
+extern int loci_pdu_sched_add(loci_pdu_sched_t *sched, int kind,
+                              of_port_no_t port_no, uint8_t slot_num,
+                              uint32_t interval_ms,
+                              const uint8_t *data, int len);
+extern int loci_pdu_sched_delete(loci_pdu_sched_t *sched, int kind,
+                                 of_port_no_t port_no, uint8_t slot_num);
+extern loci_pdu_timer_t *loci_pdu_sched_lookup(loci_pdu_sched_t *sched,
+                                               int kind, of_port_no_t port_no,
+                                               uint8_t slot_num);
+extern int loci_pdu_sched_apply(loci_pdu_sched_t *sched, of_object_t *msg);
+
+extern int loci_pdu_sched_rx(loci_pdu_sched_t *sched, of_port_no_t port_no,
+                             uint8_t slot_num);
+
+extern int loci_pdu_sched_advance(loci_pdu_sched_t *sched, uint64_t now,
+                                  loci_pdu_sched_tx_f tx, void *cookie,
+                                  loci_stream_t *timeouts);
+
+#endif /* _LOCI_PDU_SCHED_H_ */
@@ -0,0 +1,53 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_peek.h
+ *
+ * Peek at the fields of high rate messages in their wire buffer,
+ * without making an object.
+ *
+ * A peek checks the lengths it depends on, so a short or malformed
+ * message is refused rather than read past its end, but it is not a
+ * full validation: fields it doesn't read are not checked.
+ *
+ * Usage:
+ *
+ *   loci_packet_in_t pi;
+ *
+ *   if (loci_packet_in_peek(buf, len, &pi) == 0) {
+ *       handle(pi.in_port, pi.data, pi.data_len);
+ *   }
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_PEEK_H_)
+#define _LOCI_PEEK_H_
+
+#include <loci/loci.h>
+
+/**
+ * The fields of a packet_in
+ *
+ * Fields not in the message's version are 0.  In 1.2 and later the
+ * in_port is from the match, or 0 if the match has none.
+ */
+typedef struct loci_packet_in_s {
+    of_version_t version;
+    uint32_t xid;
+    uint32_t buffer_id;
+    uint16_t total_len;
+    uint8_t reason;
+    uint8_t table_id;
+    uint64_t cookie;
+    of_port_no_t in_port;
+    /** The packet, in the message buffer */
+    uint8_t *data;
+    int data_len;
+} loci_packet_in_t;
+
+extern int loci_packet_in_peek(uint8_t *buf, int len, loci_packet_in_t *pi);
+
+#endif /* _LOCI_PEEK_H_ */
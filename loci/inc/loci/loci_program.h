@@ -0,0 +1,218 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_program.h
+ *
+ * Compile instruction and action lists into programs for a software
+ * datapath, and run them on packets.
+ *
+ * Compiling walks a list once and decodes each action into a fixed size
+ * op, with its arguments in host byte order.  Running a program is then
+ * a loop over an array, with no list iteration, TLV decoding or
+ * dispatch on object ids.  The actions that set a header field, in
+ * any version (set_dl_src, set_nw_tos, set_vlan_vid, set_field,
+ * set_mpls_label...), all become a LOCI_OP_SET_FIELD.
+ *
+ * Only apply_actions and write_actions produce ops.  The write
+ * actions come after the apply actions; the pipeline runs them with
+ * loci_program_run_write when it executes the action set.  The other
+ * instructions (goto_table, write_metadata, meter, clear_actions and
+ * the BSN instructions) are recorded in the program for the pipeline
+ * to act on.
+ *
+ * Running a program edits the packet in place.  It rewrites header
+ * fields, pushes and pops VLAN tags and MPLS labels, and updates the
+ * IPv4, TCP, UDP and ICMPv6 checksums; the SCTP checksum is not
+ * updated.  Outputs, groups and resubmits go to the callbacks of a
+ * loci_program_env_t.  A field whose header is not in the packet is
+ * not set.
+ *
+ * An action or instruction the compiler does not know fails the
+ * compile with OF_ERROR_COMPAT: copy_ttl_in/out, PBB, the BSN
+ * checksum and gentable actions, set_field of fields other than those
+ * of loci_field_t or tunnel_id, and experimenter actions other than
+ * Nicira dec_ttl, resubmit, resubmit_table and move and BSN mirror and
+ * set_tunnel_dst.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_PROGRAM_H_)
+#define _LOCI_PROGRAM_H_
+
+#include <loci/loci.h>
+
+typedef enum loci_op_code_e {
+    LOCI_OP_OUTPUT,             /* arg32 port, arg16 max_len */
+    LOCI_OP_GROUP,              /* arg32 group id */
+    LOCI_OP_SET_QUEUE,          /* arg32 queue id */
+    LOCI_OP_RESUBMIT,           /* arg32 in_port, arg16 table id */
+    LOCI_OP_PUSH_VLAN,          /* arg16 ethertype */
+    LOCI_OP_POP_VLAN,
+    LOCI_OP_PUSH_MPLS,          /* arg16 ethertype */
+    LOCI_OP_POP_MPLS,           /* arg16 ethertype */
+    LOCI_OP_SET_FIELD,          /* field, value, mask; arg16 see below */
+    LOCI_OP_MOVE,               /* src_field, src_ofs, field, dst_ofs, n_bits */
+    LOCI_OP_DEC_NW_TTL,
+    LOCI_OP_DEC_MPLS_TTL,
+    LOCI_OP_SET_TUNNEL_ID,      /* value */
+    LOCI_OP_SET_TUNNEL_DST,     /* arg32 IPv4 address */
+} loci_op_code_t;
+
+/**
+ * Packet fields ops can set
+ *
+ * L4_SRC and L4_DST are the ports of TCP, UDP and SCTP.  IPV6_SRC and
+ * IPV6_DST are set from ipv6 in the op and can't be moved.
+ */
+typedef enum loci_field_e {
+    LOCI_FIELD_ETH_DST,
+    LOCI_FIELD_ETH_SRC,
+    LOCI_FIELD_VLAN_VID,
+    LOCI_FIELD_VLAN_PCP,
+    LOCI_FIELD_IP_DSCP,
+    LOCI_FIELD_IP_ECN,
+    LOCI_FIELD_IP_TTL,
+    LOCI_FIELD_IPV4_SRC,
+    LOCI_FIELD_IPV4_DST,
+    LOCI_FIELD_L4_SRC,
+    LOCI_FIELD_L4_DST,
+    LOCI_FIELD_MPLS_LABEL,
+    LOCI_FIELD_MPLS_TC,
+    LOCI_FIELD_MPLS_TTL,
+    LOCI_FIELD_IPV6_SRC,
+    LOCI_FIELD_IPV6_DST,
+    LOCI_FIELD_COUNT
+} loci_field_t;
+
+/**
+ * A decoded action
+ *
+ * For LOCI_OP_SET_FIELD of VLAN_VID or VLAN_PCP, arg16 is the
+ * ethertype of a tag to push first if the packet has none, as
+ * OpenFlow 1.0 does, or 0.  Values are right aligned; MAC addresses
+ * are in the low 48 bits of value.
+ */
+typedef struct loci_op_s {
+    uint8_t code;
+    uint8_t field;
+    uint8_t src_field;
+    uint8_t n_bits;
+    uint16_t src_ofs;
+    uint16_t dst_ofs;
+    uint16_t arg16;
+    uint32_t arg32;
+    uint64_t value;
+    uint64_t mask;
+    of_ipv6_t ipv6;
+} loci_op_t;
+
+/* Instructions in a program */
+#define LOCI_PROGRAM_GOTO_TABLE      0x01
+#define LOCI_PROGRAM_WRITE_METADATA  0x02
+#define LOCI_PROGRAM_METER           0x04
+#define LOCI_PROGRAM_CLEAR_ACTIONS   0x08
+#define LOCI_PROGRAM_WRITE_ACTIONS   0x10
+
+/* BSN instructions in a program */
+#define LOCI_PROGRAM_BSN_ARP_OFFLOAD                  0x0001
+#define LOCI_PROGRAM_BSN_AUTO_NEGOTIATION             0x0002
+#define LOCI_PROGRAM_BSN_DENY                         0x0004
+#define LOCI_PROGRAM_BSN_DHCP_OFFLOAD                 0x0008
+#define LOCI_PROGRAM_BSN_DISABLE_L3                   0x0010
+#define LOCI_PROGRAM_BSN_DISABLE_SPLIT_HORIZON_CHECK  0x0020
+#define LOCI_PROGRAM_BSN_DISABLE_SRC_MAC_CHECK        0x0040
+#define LOCI_PROGRAM_BSN_DISABLE_VLAN_COUNTERS        0x0080
+#define LOCI_PROGRAM_BSN_HASH_SELECT                  0x0100
+#define LOCI_PROGRAM_BSN_INTERNAL_PRIORITY            0x0200
+#define LOCI_PROGRAM_BSN_NDP_OFFLOAD                  0x0400
+#define LOCI_PROGRAM_BSN_PACKET_OF_DEATH              0x0800
+#define LOCI_PROGRAM_BSN_PERMIT                       0x1000
+#define LOCI_PROGRAM_BSN_PRIORITIZE_PDUS              0x2000
+#define LOCI_PROGRAM_BSN_REQUIRE_VLAN_XLATE           0x4000
+#define LOCI_PROGRAM_BSN_SPAN_DESTINATION             0x8000
+
+typedef struct loci_program_s {
+    loci_op_t *ops;
+    int n_ops;
+    int alloc_ops;
+    /** ops[0 .. n_apply - 1] are the apply actions, the rest the write actions */
+    int n_apply;
+    /** LOCI_PROGRAM_* */
+    uint32_t flags;
+    uint8_t table_id;
+    uint64_t metadata;
+    uint64_t metadata_mask;
+    uint32_t meter_id;
+    /** LOCI_PROGRAM_BSN_* */
+    uint32_t bsn_flags;
+    uint32_t bsn_hash_select_flags;
+    uint32_t bsn_internal_priority;
+} loci_program_t;
+
+extern int loci_program_compile(loci_program_t *prog,
+                                of_list_instruction_t *instructions);
+extern int loci_program_compile_actions(loci_program_t *prog,
+                                        of_list_action_t *actions);
+extern void loci_program_cleanup(loci_program_t *prog);
+
+/**
+ * A packet being worked on
+ *
+ * Pushes take their bytes from the headroom before data and pops give
+ * them back, so data and len change.
+ */
+typedef struct loci_program_packet_s {
+    uint8_t *data;
+    int len;
+    int headroom;
+} loci_program_packet_t;
+
+/**
+ * Where a program sends packets, and the state it sets
+ *
+ * A NULL callback drops what would be sent to it.
+ */
+typedef struct loci_program_env_s {
+    void (*output)(void *cookie, uint32_t port, uint16_t max_len,
+                   uint8_t *data, int len);
+    void (*group)(void *cookie, uint32_t group_id, uint8_t *data, int len);
+    void (*resubmit)(void *cookie, uint32_t in_port, uint8_t table_id,
+                     uint8_t *data, int len);
+    void *cookie;
+    uint32_t queue_id;
+    uint64_t tunnel_id;
+    uint32_t tunnel_dst;
+} loci_program_env_t;
+
+extern int loci_program_run_ops(const loci_op_t *ops, int n_ops,
+                                loci_program_packet_t *pkt,
+                                loci_program_env_t *env);
+
+/**
+ * Run the apply actions of a program
+ */
+static inline int
+loci_program_run(const loci_program_t *prog, loci_program_packet_t *pkt,
+                 loci_program_env_t *env)
+{
+    return loci_program_run_ops(prog->ops, prog->n_apply, pkt, env);
+}
+
+/**
+ * Run the write actions of a program
+ *
+ * The OpenFlow action set orders actions by type and keeps one of
+ * each; a pipeline that needs that merges the write ops itself.
+ */
+static inline int
+loci_program_run_write(const loci_program_t *prog,
+                       loci_program_packet_t *pkt, loci_program_env_t *env)
+{
+    return loci_program_run_ops(prog->ops + prog->n_apply,
+                                prog->n_ops - prog->n_apply, pkt, env);
+}
+
+#endif /* _LOCI_PROGRAM_H_ */
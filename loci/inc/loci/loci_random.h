@@ -0,0 +1,175 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_random.h
+ *
+ * Deterministic random object generator.
+ *
+ * A generator seeded with the same configuration always produces the
+ * same sequence of objects, byte for byte, so a workload can be
+ * reproduced from its seed alone.
+ *
+ * Every member of an object is set through its generated accessor:
+ * integers are uniform, ports mostly small port numbers, addresses
+ * private unicast ones and strings short printable names.  Matches
+ * follow a typical L2, ARP, IPv4 or IPv6 flow and only use the fields
+ * the wire match of the version can express.  The data of packet_in
+ * and packet_out messages is an Ethernet frame with a valid IPv4 or
+ * ARP header.
+ *
+ * Lists get up to list_max elements of concrete types chosen at random
+ * among those valid for the list and version.  Lists nested deeper
+ * than depth_max are left empty.
+ *
+ * Lists and child objects are built in scratch wire buffers owned by
+ * the generator, so generating an object allocates only the object
+ * itself.  A generator must not be shared between threads.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_RANDOM_H_)
+#define _LOCI_RANDOM_H_
+
+#include <loci/loci.h>
+
+/* Longest octets member or packet the generator produces */
+#define LOCI_RANDOM_DATA_MAX 1514
+
+/* Deepest nesting of lists and child objects */
+#define LOCI_RANDOM_DEPTH_MAX 16
+
+typedef struct loci_random_config_s {
+    uint64_t seed;
+    /* Most elements in a list */
+    int list_max;
+    /* Nesting depth beyond which lists are left empty */
+    int depth_max;
+    /* Longest octets member, up to LOCI_RANDOM_DATA_MAX */
+    int octets_max;
+    /* Shortest and longest packet_in and packet_out data */
+    int packet_min;
+    int packet_max;
+    /* Percent chance of matching on each optional match field */
+    int match_fields;
+    /* Percent chance of a partial mask on a maskable match field */
+    int match_masked;
+} loci_random_config_t;
+
+typedef struct loci_random_s {
+    uint64_t state;
+    loci_random_config_t config;
+    of_wire_buffer_t *scratch[LOCI_RANDOM_DEPTH_MAX];
+    uint8_t data[LOCI_RANDOM_DATA_MAX];
+} loci_random_t;
+
+extern void loci_random_config_init(loci_random_config_t *config);
+extern void loci_random_init(loci_random_t *r,
+                             const loci_random_config_t *config);
+extern void loci_random_cleanup(loci_random_t *r);
+
+extern of_object_t *loci_random_new(loci_random_t *r, of_object_id_t id,
+                                    of_version_t version);
+extern of_object_t *loci_random_message_new(loci_random_t *r,
+                                            of_version_t version);
+extern int of_object_random(loci_random_t *r, of_object_t *obj);
+
+extern void loci_random_match(loci_random_t *r, of_version_t version,
+                              of_match_t *match);
+extern void loci_random_packet(loci_random_t *r, of_octets_t *octets);
+
+/**
+ * Next value of the generator (splitmix64)
+ */
+static inline uint64_t
+loci_random_u64(loci_random_t *r)
+{
+    uint64_t z = (r->state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Uniform value in [0, n)
+ */
+static inline uint32_t
+loci_random_range(loci_random_t *r, uint32_t n)
+{
+    return (uint32_t)(((loci_random_u64(r) >> 32) * n) >> 32);
+}
+
+/****************************************************************
+ *
+ * Used by the generated per-class functions
+ *
+ ****************************************************************/
+
+extern int loci_random_object(loci_random_t *r, of_object_t *obj, int depth);
+extern int loci_random_list(loci_random_t *r, of_object_t *list,
+                            of_object_id_t list_id, of_version_t version,
+                            const of_object_id_t *ids, int count, int depth);
+extern int loci_random_child(loci_random_t *r, of_object_t *obj,
+                             of_version_t version,
+                             const of_object_id_t *ids, int count, int depth);
+extern const of_object_id_t *loci_random_message_ids(of_version_t version,
+                                                     int *count);
+
+extern of_port_no_t loci_random_port_no(loci_random_t *r);
+extern of_ipv4_t loci_random_ipv4(loci_random_t *r);
+extern void loci_random_mac(loci_random_t *r, of_mac_addr_t *mac);
+extern void loci_random_ipv6(loci_random_t *r, of_ipv6_t *ipv6);
+extern void loci_random_bytes(loci_random_t *r, void *buf, int len);
+extern void loci_random_string(loci_random_t *r, char *buf, int len);
+extern void loci_random_octets(loci_random_t *r, of_octets_t *octets);
+
+typedef int (*loci_obj_random_f)(loci_random_t *r, of_object_t *obj, int depth);
+
+/****************************************************************
+ *
+ * Per-datatype random value macros
+ *
+ ****************************************************************/
+
+#define LOCI_RANDOM_u8(r, val) ((val) = (uint8_t)loci_random_u64(r))
+#define LOCI_RANDOM_u16(r, val) ((val) = (uint16_t)loci_random_u64(r))
+#define LOCI_RANDOM_u32(r, val) ((val) = (uint32_t)loci_random_u64(r))
+#define LOCI_RANDOM_u64(r, val) ((val) = loci_random_u64(r))
+#define LOCI_RANDOM_x8(r, val) LOCI_RANDOM_u8(r, val)
+#define LOCI_RANDOM_x16(r, val) LOCI_RANDOM_u16(r, val)
+#define LOCI_RANDOM_x32(r, val) LOCI_RANDOM_u32(r, val)
+#define LOCI_RANDOM_x64(r, val) LOCI_RANDOM_u64(r, val)
+#define LOCI_RANDOM_wc_bmap(r, val) LOCI_RANDOM_u64(r, val)
+#define LOCI_RANDOM_match_bmap(r, val) LOCI_RANDOM_u64(r, val)
+
+#define LOCI_RANDOM_port_no(r, val) ((val) = loci_random_port_no(r))
+#define LOCI_RANDOM_ipv4(r, val) ((val) = loci_random_ipv4(r))
+#define LOCI_RANDOM_mac(r, val) loci_random_mac(r, &(val))
+#define LOCI_RANDOM_ipv6(r, val) loci_random_ipv6(r, &(val))
+#define LOCI_RANDOM_octets(r, val) loci_random_octets(r, &(val))
+
+/* Fixed length character arrays */
+#define LOCI_RANDOM_string(r, val) loci_random_string(r, val, sizeof(val))
+#define LOCI_RANDOM_port_name(r, val) LOCI_RANDOM_string(r, val)
+#define LOCI_RANDOM_tab_name(r, val) LOCI_RANDOM_string(r, val)
+#define LOCI_RANDOM_desc_str(r, val) LOCI_RANDOM_string(r, val)
+#define LOCI_RANDOM_ser_num(r, val) LOCI_RANDOM_string(r, val)
+#define LOCI_RANDOM_str6(r, val) LOCI_RANDOM_string(r, val)
+#define LOCI_RANDOM_str32(r, val) LOCI_RANDOM_string(r, val)
+#define LOCI_RANDOM_str64(r, val) LOCI_RANDOM_string(r, val)
+#define LOCI_RANDOM_app_code(r, val) LOCI_RANDOM_string(r, val)
+
+/* Bitmaps, checksums and signal ids are random bytes */
+#define LOCI_RANDOM_bytes(r, val) loci_random_bytes(r, &(val), sizeof(val))
+#define LOCI_RANDOM_bitmap_128(r, val) LOCI_RANDOM_bytes(r, val)
+#define LOCI_RANDOM_bitmap_256(r, val) LOCI_RANDOM_bytes(r, val)
+#define LOCI_RANDOM_bitmap_512(r, val) LOCI_RANDOM_bytes(r, val)
+#define LOCI_RANDOM_checksum_128(r, val) LOCI_RANDOM_bytes(r, val)
+#define LOCI_RANDOM_circuit_sig_id(r, val) LOCI_RANDOM_bytes(r, val)
+#define LOCI_RANDOM_och_sig_id(r, val) LOCI_RANDOM_bytes(r, val)
+#define LOCI_RANDOM_mcs_rx_mask(r, val) LOCI_RANDOM_bytes(r, val)
+
+#endif /* _LOCI_RANDOM_H_ */
@@ -0,0 +1,96 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_sdwn_client.h
+ *
+ * SDWN client tables read from, and written to, runs of wire messages
+ * as arrays of client records, without an object per client.
+ *
+ * A poll of an access point's clients is answered with one
+ * of_sdwn_get_clients_reply per client, of the lvap, normal or crypto
+ * kind, all but the last with OF_STATS_REPLY_FLAG_REPLY_MORE.  Clients
+ * are pushed to an access point with one of_sdwn_add_client each.
+ * Both are decoded into loci_sdwn_client_t records, and both can be
+ * encoded back to back into a buffer from an array of records, as many
+ * as fit from a cursor.
+ *
+ * A record holds the fixed fields by value.  The supported rates and
+ * the keys, the larger parts, point into the message buffer; the keys
+ * are an of_list_bsn_tlv_data, as loci_bsn_tlv_index reads.  Records
+ * decoded from a buffer are only good while it is.
+ *
+ * SDWN messages are only defined for OpenFlow 1.3.
+ *
+ * Usage:
+ *
+ *   loci_sdwn_client_t clients[N];
+ *   int next = 0;
+ *
+ *   do {
+ *       len = loci_sdwn_clients_reply_encode(buf, sizeof(buf), xid,
+ *                                             clients, N, &next);
+ *       send(buf, len);
+ *   } while (next < N);
+ *
+ *   n = loci_sdwn_clients_decode(buf, len, clients, N, &more);
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_SDWN_CLIENT_H_)
+#define _LOCI_SDWN_CLIENT_H_
+
+#include <loci/loci.h>
+
+/* Client types, as client_type of of_sdwn_get_clients_reply */
+#define LOCI_SDWN_CLIENT_LVAP 0
+#define LOCI_SDWN_CLIENT_NORMAL 1
+#define LOCI_SDWN_CLIENT_CRYPTO 2
+
+/* Wire lengths of the capabilities, of_ieee80211_ht_cap and _vht_cap */
+#define LOCI_SDWN_HT_CAP_BYTES 26
+#define LOCI_SDWN_VHT_CAP_BYTES 12
+
+/* Wire lengths of the messages, without keys */
+#define LOCI_SDWN_REPLY_LVAP_BYTES 34
+#define LOCI_SDWN_REPLY_BYTES 334
+#define LOCI_SDWN_ADD_CLIENT_BYTES 328
+
+/**
+ * A client, from an of_sdwn_get_clients_reply or an of_sdwn_add_client
+ *
+ * Fields a message doesn't have are 0: all but the type and mac for
+ * an lvap reply, ap for any reply and the keys for a normal reply.
+ */
+typedef struct loci_sdwn_client_s {
+    of_mac_addr_t mac;
+    uint8_t type;
+    uint16_t assoc_id;
+    uint16_t capabilities;
+    uint16_t cap_flags;
+    of_port_no_t ap;
+    uint8_t ht_capabilities[LOCI_SDWN_HT_CAP_BYTES];
+    uint8_t vht_capabilities[LOCI_SDWN_VHT_CAP_BYTES];
+    /** OF_DESC_STR_LEN bytes, in the message buffer; NULL for none */
+    uint8_t *supported_rates;
+    /** An of_list_bsn_tlv_data, in the message buffer */
+    uint8_t *keys;
+    int keys_len;
+} loci_sdwn_client_t;
+
+extern int loci_sdwn_client_peek(uint8_t *buf, int len,
+                                 loci_sdwn_client_t *client);
+extern int loci_sdwn_clients_decode(uint8_t *buf, int len,
+                                    loci_sdwn_client_t *clients, int max,
+                                    int *more);
+
+extern int loci_sdwn_clients_reply_encode(uint8_t *buf, int len, uint32_t xid,
+                                          const loci_sdwn_client_t *clients,
+                                          int count, int *next);
+extern int loci_sdwn_add_clients_encode(uint8_t *buf, int len, uint32_t xid,
+                                        const loci_sdwn_client_t *clients,
+                                        int count, int *next);
+
+#endif /* _LOCI_SDWN_CLIENT_H_ */
@@ -0,0 +1,134 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_sdwn_mgmt.h
+ *
+ * The fast path for the IEEE 802.11 management frames access points
+ * report: peek, filter, dispatch and reply without making objects.
+ *
+ * Frames come as an of_sdwn_ieee80211_mgmt, an event with the frame
+ * type, addresses and signal, or as an of_sdwn_packet_in with the
+ * frame itself.  Both peek into a loci_sdwn_mgmt_t, the type of a
+ * packet_in taken from its frame control.
+ *
+ * In a probe storm the same client sends the same frame on every
+ * channel and radio, many times a second.  A filter lets through
+ * burst events per client and type in a window of time and drops the
+ * rest; the clock is the caller's, in any unit.  Clients are kept in
+ * a fixed table indexed by hash, without chaining: a client whose slot
+ * is taken over by another starts a new window, so a full table lets
+ * more through rather than less.
+ *
+ * Dispatch walks a buffer of back to back messages, such as a read
+ * from the connection, calling the handler of each frame's type.  The
+ * answer to an of_sdwn_ieee80211_mgmt is built over it, in place.
+ *
+ * SDWN messages are only defined for OpenFlow 1.3.
+ *
+ * Usage:
+ *
+ *   loci_sdwn_mgmt_handler_f handlers[LOCI_SDWN_MGMT_TYPES] = {
+ *       [IEEE80211_PROBE] = probe_handle,
+ *   };
+ *   loci_sdwn_mgmt_filter_t filter;
+ *
+ *   loci_sdwn_mgmt_filter_init(&filter, 4096, 100, 1);
+ *   n = loci_sdwn_mgmt_dispatch(buf, len, handlers, &filter, now_ms,
+ *                               cookie);
+ *
+ *   int probe_handle(void *cookie, loci_sdwn_mgmt_t *mgmt)
+ *   {
+ *       if (mgmt->object_id == OF_SDWN_IEEE80211_MGMT) {
+ *           len = loci_sdwn_mgmt_reply_build(mgmt->msg, mgmt->msg_len,
+ *                                            deny);
+ *           send(mgmt->msg, len);
+ *       }
+ *       return 0;
+ *   }
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_SDWN_MGMT_H_)
+#define _LOCI_SDWN_MGMT_H_
+
+#include <loci/loci.h>
+
+/* Frame types, IEEE80211_MGMT to IEEE80211_AUTH */
+#define LOCI_SDWN_MGMT_TYPES 4
+
+/* Wire lengths of of_sdwn_ieee80211_mgmt and its reply */
+#define LOCI_SDWN_MGMT_BYTES 41
+#define LOCI_SDWN_MGMT_REPLY_BYTES 24
+
+/**
+ * A management frame, from an of_sdwn_ieee80211_mgmt or an
+ * of_sdwn_packet_in
+ *
+ * Fields a message doesn't have are 0: ssi and freq for a packet_in,
+ * bssid, frame_control, seq_ctrl and the frame for an
+ * of_sdwn_ieee80211_mgmt.
+ */
+typedef struct loci_sdwn_mgmt_s {
+    /** The message, in the buffer */
+    uint8_t *msg;
+    int msg_len;
+    uint32_t xid;
+    /** of_sdwn_ieee80211_mgmt or of_sdwn_packet_in */
+    of_object_id_t object_id;
+    /** IEEE80211_MGMT, _PROBE, _ASSOC or _AUTH */
+    uint8_t type;
+    of_port_no_t if_no;
+    /** The client: addr, or the transmitter of the frame */
+    of_mac_addr_t addr;
+    /** target, or the receiver of the frame */
+    of_mac_addr_t target;
+    of_mac_addr_t bssid;
+    uint32_t ssi;
+    uint32_t freq;
+    /** First byte of the frame control: version, type and subtype */
+    uint8_t frame_control;
+    uint16_t seq_ctrl;
+    /** The frame body, in the buffer */
+    uint8_t *frame;
+    int frame_len;
+} loci_sdwn_mgmt_t;
+
+typedef struct loci_sdwn_mgmt_slot_s loci_sdwn_mgmt_slot_t;
+
+typedef struct loci_sdwn_mgmt_filter_s {
+    uint64_t window;
+    uint32_t burst;
+    uint32_t mask;              /* Slots - 1 */
+    loci_sdwn_mgmt_slot_t *slots;
+    uint64_t passed;
+    uint64_t dropped;
+} loci_sdwn_mgmt_filter_t;
+
+/**
+ * Handle a frame
+ * @param cookie As given to loci_sdwn_mgmt_dispatch
+ * @param mgmt The frame, only good for the call
+ * @returns 0, or an error to stop the dispatch with
+ */
+typedef int (*loci_sdwn_mgmt_handler_f)(void *cookie, loci_sdwn_mgmt_t *mgmt);
+
+extern int loci_sdwn_mgmt_peek(uint8_t *buf, int len, loci_sdwn_mgmt_t *mgmt);
+
+extern int loci_sdwn_mgmt_filter_init(loci_sdwn_mgmt_filter_t *filter,
+                                      int slots, uint64_t window, int burst);
+extern void loci_sdwn_mgmt_filter_cleanup(loci_sdwn_mgmt_filter_t *filter);
+extern int loci_sdwn_mgmt_filter_check(loci_sdwn_mgmt_filter_t *filter,
+                                       const loci_sdwn_mgmt_t *mgmt,
+                                       uint64_t now);
+
+extern int loci_sdwn_mgmt_dispatch(uint8_t *buf, int len,
+                                   loci_sdwn_mgmt_handler_f *handlers,
+                                   loci_sdwn_mgmt_filter_t *filter,
+                                   uint64_t now, void *cookie);
+
+extern int loci_sdwn_mgmt_reply_build(uint8_t *buf, int len, uint8_t deny);
+
+#endif /* _LOCI_SDWN_MGMT_H_ */
@@ -0,0 +1,140 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_stats.h
+ *
+ * Optional instrumentation counters.
+ *
+ * Define LOCI_STATS_ENABLE when building LOCI to count, per object
+ * type, allocations, parses, validation failures and list append
+ * failures, along with the bytes moved by of_wire_buffer_replace_data.
+ *
+ * Each thread increments its own counters; loci_stats_snapshot sums
+ * the counters of all threads.  Counters of threads that have exited
+ * are kept.
+ *
+ * Without LOCI_STATS_ENABLE the counting macros expand to nothing and
+ * snapshots are all zero.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_STATS_H_)
+#define _LOCI_STATS_H_
+
+#include <loci/loci_base.h>
+
+typedef enum loci_stats_validate_reason_e {
+    /* Buffer shorter than the fixed part of the object */
+    LOCI_STATS_VALIDATE_SHORT,
+    /* Length field inconsistent with the buffer or the object */
+    LOCI_STATS_VALIDATE_LENGTH,
+    /* Unsupported message version */
+    LOCI_STATS_VALIDATE_VERSION,
+    LOCI_STATS_VALIDATE_REASON_COUNT
+} loci_stats_validate_reason_t;
+
+/**
+ * Counters kept for each object type
+ */
+typedef struct loci_stats_object_s {
+    /* Objects allocated by of_<cls>_new, of_object_dup and new_from_message */
+    uint64_t allocs;
+    /* Bytes allocated for those objects and their wire buffers */
+    uint64_t alloc_bytes;
+    /* Calls to of_object_delete */
+    uint64_t frees;
+    /* Messages parsed by the of_object_new_from_message functions */
+    uint64_t parses;
+    /* Validation failures attributed to this type, by reason */
+    uint64_t validate_failures[LOCI_STATS_VALIDATE_REASON_COUNT];
+    /* OF_ERROR_RESOURCE from of_list_append and of_list_append_bind */
+    uint64_t list_append_failures;
+} loci_stats_object_t;
+
+/**
+ * A set of counters
+ *
+ * Every member is a uint64_t counter; loci_stats.c relies on this.
+ */
+typedef struct loci_stats_s {
+    loci_stats_object_t objects[OF_OBJECT_COUNT];
+    /* Calls to of_wire_buffer_replace_data */
+    uint64_t replace_data_calls;
+    /* Bytes moved to open or close a gap in those calls */
+    uint64_t replace_data_move_bytes;
+} loci_stats_t;
+
+extern void loci_stats_snapshot(loci_stats_t *stats);
+extern void loci_stats_clear(void);
+extern int loci_stats_show(loci_writer_f writer, void *cookie,
+                           const loci_stats_t *stats);
+
+#if defined(LOCI_STATS_ENABLE)
+
+#define LOCI_STATS_ENABLED 1
+
+extern __thread loci_stats_t *loci_stats_local;
+extern loci_stats_t *loci_stats_local_init(void);
+
+/**
+ * The counters of the calling thread, or NULL if they could not be
+ * allocated
+ */
+static inline loci_stats_t *
+loci_stats_get(void)
+{
+    loci_stats_t *stats = loci_stats_local;
+
+    return stats != NULL ? stats : loci_stats_local_init();
+}
+
+#define LOCI_STATS_UPDATE(stmt) do {                    \
+        loci_stats_t *_stats = loci_stats_get();        \
+        if (_stats != NULL) {                           \
+            stmt;                                       \
+        }                                               \
+    } while (0)
+
+#define LOCI_STATS_ALLOC(object_id, bytes) LOCI_STATS_UPDATE(  \
+        _stats->objects[object_id].allocs++;                   \
+        _stats->objects[object_id].alloc_bytes += (bytes))
+
+/* Account for an object allocated along with its wire buffer */
+#define LOCI_STATS_OBJECT_NEW(obj)                              \
+    LOCI_STATS_ALLOC((obj)->object_id, sizeof(of_object_t) +    \
+                     sizeof(of_wire_buffer_t) + (obj)->wbuf->alloc_bytes)
+
+#define LOCI_STATS_FREE(object_id) \
+    LOCI_STATS_UPDATE(_stats->objects[object_id].frees++)
+
+#define LOCI_STATS_PARSE(object_id) \
+    LOCI_STATS_UPDATE(_stats->objects[object_id].parses++)
+
+#define LOCI_STATS_VALIDATE_FAILURE(object_id, reason) \
+    LOCI_STATS_UPDATE(_stats->objects[object_id].validate_failures[reason]++)
+
+#define LOCI_STATS_LIST_APPEND_FAILURE(object_id) \
+    LOCI_STATS_UPDATE(_stats->objects[object_id].list_append_failures++)
+
+#define LOCI_STATS_REPLACE_DATA(move_bytes) LOCI_STATS_UPDATE(  \
+        _stats->replace_data_calls++;                           \
+        _stats->replace_data_move_bytes += (move_bytes))
+
+#else
+
+#define LOCI_STATS_ENABLED 0
+
+#define LOCI_STATS_ALLOC(object_id, bytes) do { } while (0)
+#define LOCI_STATS_OBJECT_NEW(obj) do { } while (0)
+#define LOCI_STATS_FREE(object_id) do { } while (0)
+#define LOCI_STATS_PARSE(object_id) do { } while (0)
+#define LOCI_STATS_VALIDATE_FAILURE(object_id, reason) do { } while (0)
+#define LOCI_STATS_LIST_APPEND_FAILURE(object_id) do { } while (0)
+#define LOCI_STATS_REPLACE_DATA(move_bytes) do { } while (0)
+
+#endif /* LOCI_STATS_ENABLE */
+
+#endif /* _LOCI_STATS_H_ */
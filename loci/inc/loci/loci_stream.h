@@ -0,0 +1,117 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_stream.h
+ *
+ * Output stream used by the structured (JSON and binary log)
+ * serializers.
+ *
+ * A stream writes into a caller supplied buffer.  When the buffer
+ * fills, the optional flush function is called with the pending
+ * bytes and the buffer is reused; without a flush function the
+ * stream latches OF_ERROR_RESOURCE and drops further output.  No
+ * memory is allocated by the stream.
+ *
+ * Some items (numbers, addresses) are written in one piece, so a
+ * stream with a flush function needs a buffer of at least
+ * LOCI_STREAM_MIN_SIZE bytes.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_STREAM_H_)
+#define _LOCI_STREAM_H_
+
+#include <loci/loci_base.h>
+
+#define LOCI_STREAM_MIN_SIZE 64
+
+/**
+ * Consume bytes flushed from a stream
+ * @param cookie Opaque pointer supplied to loci_stream_init
+ * @param data The bytes to consume
+ * @param len Number of bytes at data
+ * @returns OF_ERROR_NONE or a negative error code which is latched
+ * in the stream
+ */
+typedef int (*loci_stream_flush_f)(void *cookie, const uint8_t *data, int len);
+
+typedef struct loci_stream_s {
+    /** Caller supplied output buffer */
+    uint8_t *buf;
+    /** Capacity of buf */
+    int size;
+    /** Number of bytes currently held in buf */
+    int pos;
+    /** Number of bytes already handed to the flush function */
+    int total;
+    /** If >= 0, bytes at and beyond this offset must not be flushed yet */
+    int hold;
+    /** Sticky error; OF_ERROR_NONE while the stream is healthy */
+    int error;
+    loci_stream_flush_f flush;
+    void *cookie;
+} loci_stream_t;
+
+extern void loci_stream_init(loci_stream_t *s, uint8_t *buf, int size,
+                             loci_stream_flush_f flush, void *cookie);
+extern int loci_stream_make_room(loci_stream_t *s, int bytes);
+extern void loci_stream_write_slow(loci_stream_t *s, const void *data, int len);
+extern int loci_stream_finish(loci_stream_t *s);
+
+extern void loci_stream_dec(loci_stream_t *s, uint64_t val);
+extern void loci_stream_hex(loci_stream_t *s, const uint8_t *data, int len);
+
+/**
+ * Total number of bytes written to the stream so far
+ */
+#define LOCI_STREAM_LENGTH(s) ((s)->total + (s)->pos)
+
+/**
+ * Reserve space for a write of up to 'bytes' bytes
+ * @returns Pointer to the reserved space or NULL if it is not available
+ *
+ * Follow a successful call with loci_stream_advance.
+ */
+static inline uint8_t *
+loci_stream_reserve(loci_stream_t *s, int bytes)
+{
+    if (s->size - s->pos < bytes && loci_stream_make_room(s, bytes) < 0) {
+        return NULL;
+    }
+    return s->buf + s->pos;
+}
+
+static inline void
+loci_stream_advance(loci_stream_t *s, int bytes)
+{
+    s->pos += bytes;
+}
+
+static inline void
+loci_stream_write(loci_stream_t *s, const void *data, int len)
+{
+    if (s->size - s->pos >= len) {
+        MEMCPY(s->buf + s->pos, data, len);
+        s->pos += len;
+    } else {
+        loci_stream_write_slow(s, data, len);
+    }
+}
+
+static inline void
+loci_stream_putc(loci_stream_t *s, char c)
+{
+    if (s->pos < s->size || loci_stream_make_room(s, 1) == 0) {
+        s->buf[s->pos++] = (uint8_t)c;
+    }
+}
+
+/**
+ * Write a string literal; the length is computed at compile time
+ */
+#define loci_stream_lit(s, lit) loci_stream_write((s), (lit), sizeof(lit) - 1)
+
+#endif /* _LOCI_STREAM_H_ */
@@ -0,0 +1,163 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_template.h
+ *
+ * Message templates.
+ *
+ * A template is the wire image of a message built once with LOCI and
+ * a table of the fields that vary between instances.  An instance is
+ * a copy of the image with each field patched by a big-endian store,
+ * with no object or accessor involved.
+ *
+ * Fields are found by probing: the setter given for a field is
+ * called on the message (or on an object bound inside it, such as an
+ * action in its action list) with two different values, and the bytes
+ * that change are the field.  So fields anywhere in the message can be
+ * added, including the values of OXMs in the match, but a field must
+ * keep its length and position when its value changes.  Fields whose
+ * wire value is not the value set, other than by truncation to the
+ * wire width, are refused.  For example OpenFlow 1.0 port numbers are
+ * 16 bits on the wire: an instance stores the low 16 bits of the port
+ * number without the translation of the reserved ports done by the
+ * setters.
+ *
+ * Probing restores the message after each field, so it can be used
+ * as is afterwards.
+ *
+ * Usage:
+ *
+ *   loci_template_init(&t, flow_add);
+ *   xid = loci_template_field_u32(&t, flow_add, of_flow_add_xid_set);
+ *   cookie = loci_template_field_u64(&t, flow_add, of_flow_add_cookie_set);
+ *   dst = loci_template_field_match(&t, of_flow_add_match_set, &match,
+ *                                   "ipv4_dst");
+ *   port = loci_template_field_u32(&t, &output, of_action_output_port_set);
+ *
+ *   loci_template_instance(&t, buf);
+ *   loci_template_patch(&t, buf, xid, next_xid++);
+ *   ...
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_TEMPLATE_H_)
+#define _LOCI_TEMPLATE_H_
+
+#include <loci/loci.h>
+
+#define LOCI_TEMPLATE_FIELDS_MAX 16
+
+typedef struct loci_template_field_s {
+    /** Offset of the field in the message */
+    uint16_t offset;
+    /** Bytes the field takes on the wire */
+    uint8_t width;
+    uint8_t pad;
+} loci_template_field_t;
+
+typedef struct loci_template_s {
+    /** The message fields are being added from */
+    of_object_t *msg;
+    of_object_id_t object_id;
+    of_version_t version;
+    int length;
+    uint8_t *image;
+    int field_count;
+    loci_template_field_t fields[LOCI_TEMPLATE_FIELDS_MAX];
+} loci_template_t;
+
+typedef void (*loci_template_u8_set_f)(of_object_t *obj, uint8_t value);
+typedef void (*loci_template_u16_set_f)(of_object_t *obj, uint16_t value);
+typedef void (*loci_template_u32_set_f)(of_object_t *obj, uint32_t value);
+typedef void (*loci_template_u64_set_f)(of_object_t *obj, uint64_t value);
+typedef void (*loci_template_mac_set_f)(of_object_t *obj, of_mac_addr_t value);
+typedef void (*loci_template_ipv6_set_f)(of_object_t *obj, of_ipv6_t value);
+typedef int (*loci_template_match_set_f)(of_object_t *obj, of_match_t *match);
+
+extern int loci_template_init(loci_template_t *t, of_object_t *msg);
+extern void loci_template_cleanup(loci_template_t *t);
+
+/*
+ * Each returns the index of the new field, or a negative error code.
+ * obj must be the template's message or an object bound inside it.
+ */
+extern int loci_template_field_u8(loci_template_t *t, of_object_t *obj,
+                                  loci_template_u8_set_f set);
+extern int loci_template_field_u16(loci_template_t *t, of_object_t *obj,
+                                   loci_template_u16_set_f set);
+extern int loci_template_field_u32(loci_template_t *t, of_object_t *obj,
+                                   loci_template_u32_set_f set);
+extern int loci_template_field_u64(loci_template_t *t, of_object_t *obj,
+                                   loci_template_u64_set_f set);
+extern int loci_template_field_mac(loci_template_t *t, of_object_t *obj,
+                                   loci_template_mac_set_f set);
+extern int loci_template_field_ipv6(loci_template_t *t, of_object_t *obj,
+                                    loci_template_ipv6_set_f set);
+
+/*
+ * A field of the match set on the message by 'set', named as in
+ * of_match_fields_t.  The field must be exact in 'match'.
+ */
+extern int loci_template_field_match(loci_template_t *t,
+                                     loci_template_match_set_f set,
+                                     const of_match_t *match,
+                                     const char *name);
+
+/**
+ * Start an instance of a template
+ * @param buf Space for the message, at least t->length bytes
+ */
+static inline void
+loci_template_instance(const loci_template_t *t, uint8_t *buf)
+{
+    MEMCPY(buf, t->image, t->length);
+}
+
+/**
+ * Set an integer field of an instance
+ *
+ * Fields narrower than 8 bytes get the low order bytes of value.  The
+ * field must be 1, 2, 4 or 8 bytes wide; a MAC or IPv6 address field
+ * is set with loci_template_patch_bytes, and is left alone here.
+ */
+static inline void
+loci_template_patch(const loci_template_t *t, uint8_t *buf, int field,
+                    uint64_t value)
+{
+    const loci_template_field_t *f = &t->fields[field];
+
+    switch (f->width) {
+    case 1:
+        buf_u8_set(buf + f->offset, (uint8_t)value);
+        break;
+    case 2:
+        buf_u16_set(buf + f->offset, (uint16_t)value);
+        break;
+    case 4:
+        buf_u32_set(buf + f->offset, (uint32_t)value);
+        break;
+    case 8:
+        buf_u64_set(buf + f->offset, value);
+        break;
+    default:
+        LOCI_ASSERT(0);
+        break;
+    }
+}
+
+/**
+ * Set a MAC or IPv6 address field of an instance
+ */
+static inline void
+loci_template_patch_bytes(const loci_template_t *t, uint8_t *buf, int field,
+                          const void *value)
+{
+    const loci_template_field_t *f = &t->fields[field];
+
+    MEMCPY(buf + f->offset, value, f->width);
+}
+
+#endif /* _LOCI_TEMPLATE_H_ */
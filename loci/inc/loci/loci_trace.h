@@ -0,0 +1,86 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ * File: loci_trace.h
+ *
+ * Static tracepoints.
+ *
+ * Define LOCI_TRACE_ENABLE when building LOCI to place USDT probes
+ * (<sys/sdt.h>, from systemtap) in the library under the provider
+ * "loci".  A probe costs a load and a branch on its semaphore until a
+ * tracer such as bpftrace, perf or stap attaches to it; the arguments
+ * are only computed while it is attached.
+ *
+ *   new_from_message(object_id, version, length, xid)
+ *   object_new(object_id, version, length, xid)
+ *   object_delete(object_id, version, length, xid)
+ *       xid is 0 for objects that are not messages
+ *   validate_fail(object_id, reason, len)
+ *       The innermost object rejected by the validator; reason is a
+ *       loci_stats_validate_reason_t and len the bytes left for it
+ *   validate_message_fail(version, type, length, xid)
+ *       A message rejected by of_validate_message
+ *   replace_data(offset, old_len, new_len, move_bytes)
+ *   match_serialize(version, bytes, rv)
+ *
+ * Without LOCI_TRACE_ENABLE the probes expand to nothing and their
+ * arguments are not evaluated.
+ *
+ ****************************************************************/
+
+#if !defined(_LOCI_TRACE_H_)
+#define _LOCI_TRACE_H_
+
+#include <loci/loci_base.h>
+
+#if defined(LOCI_TRACE_ENABLE)
+
+#define LOCI_TRACE_ENABLED 1
+
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+#define LOCI_TRACE_SEMAPHORE(probe) loci_##probe##_semaphore
+
+extern volatile unsigned short LOCI_TRACE_SEMAPHORE(new_from_message);
+extern volatile unsigned short LOCI_TRACE_SEMAPHORE(object_new);
+extern volatile unsigned short LOCI_TRACE_SEMAPHORE(object_delete);
+extern volatile unsigned short LOCI_TRACE_SEMAPHORE(validate_fail);
+extern volatile unsigned short LOCI_TRACE_SEMAPHORE(validate_message_fail);
+extern volatile unsigned short LOCI_TRACE_SEMAPHORE(replace_data);
+extern volatile unsigned short LOCI_TRACE_SEMAPHORE(match_serialize);
+
+extern uint32_t loci_trace_xid(of_object_t *obj);
+
+/* True while a tracer is attached to the probe */
+#define LOCI_TRACE_ACTIVE(probe) \
+    __builtin_expect(LOCI_TRACE_SEMAPHORE(probe) != 0, 0)
+
+#define LOCI_TRACE(probe, ...) do {                     \
+        if (LOCI_TRACE_ACTIVE(probe)) {                 \
+            STAP_PROBEV(loci, probe, __VA_ARGS__);      \
+        }                                               \
+    } while (0)
+
+/* Fire one of the probes taking (object_id, version, length, xid) */
+#define LOCI_TRACE_OBJECT(probe, obj) do {                              \
+        if (LOCI_TRACE_ACTIVE(probe)) {                                 \
+            of_object_t *_obj = (of_object_t *)(obj);                   \
+            STAP_PROBEV(loci, probe, _obj->object_id, _obj->version,    \
+                        _obj->length, loci_trace_xid(_obj));            \
+        }                                                               \
+    } while (0)
+
+#else
+
+#define LOCI_TRACE_ENABLED 0
+
+#define LOCI_TRACE(probe, ...) do { } while (0)
+#define LOCI_TRACE_OBJECT(probe, obj) do { } while (0)
+
+#endif /* LOCI_TRACE_ENABLE */
+
+#endif /* _LOCI_TRACE_H_ */
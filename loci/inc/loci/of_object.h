@@ -69,6 +69,10 @@ typedef struct of_object_storage_s of_object_storage_t;
 of_object_t *of_object_new_from_message_preallocated(
     of_object_storage_t *storage, uint8_t *buf, int len);
 
+of_object_t *of_object_new_preallocated(
+    of_object_storage_t *storage, of_object_id_t object_id,
+    of_version_t version, uint8_t *buf, int bytes);
+
 /* Delete an OpenFlow object without reference to its type */
 extern void of_object_delete(of_object_t *obj);
 
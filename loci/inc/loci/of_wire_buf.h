@@ -191,6 +191,26 @@ of_wire_buffer_grow(of_wire_buffer_t *wbuf, int bytes)
     }
 }
 
+/**
+ * Check for room to replace data in the wire buffer.
+ *
+ * @param wbuf Pointer to the wire buffer structure
+ * @param old_len Number of bytes being replaced
+ * @param new_len Number of bytes replacing them
+ * @return Boolean
+ *
+ * Variable length setters check this before moving the tail of the
+ * buffer, so that a buffer of fixed capacity (see
+ * of_object_new_preallocated) fails with OF_ERROR_RESOURCE rather than
+ * an assertion.
+ */
+
+static inline int
+of_wire_buffer_can_replace(of_wire_buffer_t *wbuf, int old_len, int new_len)
+{
+    return wbuf->current_bytes + (new_len - old_len) <= wbuf->alloc_bytes;
+}
+
 /* TBD */
 
 
@@ -1162,4 +1182,10 @@ of_wire_buffer_replace_data(of_wire_buffer_t *wbuf,
                             uint8_t *data,
                             int new_len);
 
+extern uint8_t *
+of_wire_buffer_resize_data(of_wire_buffer_t *wbuf,
+                           int offset,
+                           int old_len,
+                           int new_len);
+
 #endif /* _OF_WIRE_BUF_H_ */
@@ -0,0 +1,73 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Generate loci_bsn_tlv_types.h.
+
+The class of each BSN TLV wire type is read from the switch of the
+generated of_bsn_tlv_wire_object_id_get, which must give the same
+classes in every version it handles.
+"""
+
+import glob
+import os
+import re
+
+import regen
+
+FN = 'of_bsn_tlv_wire_object_id_get(of_object_t *obj, of_object_id_t *id)'
+VERSION_RE = re.compile(r'^    case (OF_VERSION_1_\d): \{$')
+CASE_RE = re.compile(r'^        case (0x[0-9a-f]+):$')
+ID_RE = re.compile(r'^            \*id = (OF_BSN_TLV_[A-Z0-9_]+);$')
+
+# Wire types with a class in the table; must match WIRE_TYPES in
+# loci_bsn_tlv.c
+WIRE_TYPES = 256
+
+versions = {}
+for name in sorted(glob.glob(regen.path('src/class*.c'))):
+    lines = regen.read(os.path.join('src', os.path.basename(name))).split('\n')
+    if FN not in lines:
+        continue
+    version = value = None
+    for line in lines[lines.index(FN):]:
+        if line == '}':
+            break
+        m = VERSION_RE.match(line)
+        if m:
+            version = versions.setdefault(m.group(1), {})
+            continue
+        m = CASE_RE.match(line)
+        if m:
+            value = int(m.group(1), 16)
+            continue
+        m = ID_RE.match(line)
+        if m:
+            version[value] = m.group(1)
+    break
+
+assert versions, 'no %s in src/class*.c' % FN
+types = list(versions.values())[0]
+for other in versions.values():
+    assert other == types, 'BSN TLV wire types differ between versions'
+assert max(types) < WIRE_TYPES, 'BSN TLV wire type past the table'
+
+o = [regen.COPYRIGHT + '''
+/****************************************************************
+ *
+ * loci_bsn_tlv_types.h
+ *
+ * Class of each BSN TLV wire type, for loci_bsn_tlv.c
+ *
+ * Generated by scripts/gen_bsn_tlv_types.py from the BSN TLV wire type
+ * dispatch.  Edit the script, not this file.
+ *
+ ****************************************************************/
+
+/* Class of each wire type, less OF_BSN_TLV; 0 for unknown types */
+static const uint8_t type_cls[WIRE_TYPES] = {''']
+for value in sorted(types):
+    o.append('    [0x%x] = %s - OF_BSN_TLV,' % (value, types[value]))
+o.append('};')
+regen.write('src/loci_bsn_tlv_types.h', '\n'.join(o) + '\n')
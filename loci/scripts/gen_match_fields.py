@@ -0,0 +1,115 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Generate loci_match_fields.c.
+
+The descriptors are in the order of of_match_fields_t in of_match.h,
+the same order gen_obj_binlog.py numbers the fields of a logged match
+in, so a binary log field number indexes loci_match_fields.
+"""
+
+import parse_show
+import regen
+
+funcs, match_types, tables, match_fields = parse_show.load()
+
+KIND = {
+    'u8': 'U8', 'x8': 'U8', 'u16': 'U16', 'x16': 'U16', 'u32': 'U32', 'x32': 'U32',
+    'port_no': 'U32', 'u64': 'U64', 'x64': 'U64', 'mac': 'MAC', 'ipv4': 'IPV4',
+    'ipv6': 'IPV6', 'bitmap_128': 'BITMAP_128', 'bitmap_512': 'BITMAP_512',
+    'circuit_sig_id': 'CIRCUIT_SIG_ID', 'och_sig_id': 'OCH_SIG_ID',
+    'odu_sig_id': 'ODU_SIG_ID',
+}
+o = [regen.COPYRIGHT + '''
+/****************************************************************
+ *
+ * loci_match_fields.c
+ *
+ * Descriptors for the fields of of_match_fields_t
+ *
+ * Generated by scripts/gen_match_fields.py from loci_obj_show.c and
+ * of_match.h.  Edit the script, not this file.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_match_fields.h>
+''']
+o.append('#define MATCH_FIELD(_name, _kind) \\')
+o.append('    { #_name, sizeof(#_name) - 1, LOCI_MATCH_FIELD_##_kind, \\')
+o.append('      offsetof(of_match_fields_t, _name), \\')
+o.append('      sizeof(((of_match_fields_t *)0)->_name) }')
+o.append('')
+o.append('const loci_match_field_t loci_match_fields[LOCI_MATCH_FIELD_COUNT] = {')
+for typ, name in match_fields:
+    o.append('    MATCH_FIELD(%s, %s),' % (name, KIND[match_types[name]]))
+o.append('};')
+o.append('''
+/*
+ * Bytes of of_match_fields_t that hold field values: not the padding
+ * between fields, nor the tsmap pointer of an ODU signal id
+ */
+#define VALID_BYTES(_name) \\
+    [offsetof(of_match_fields_t, _name) ... \\
+     offsetof(of_match_fields_t, _name) + \\
+     sizeof(((of_match_fields_t *)0)->_name) - 1] = 0xff
+#define TSMAP_BYTES(_name) \\
+    [offsetof(of_match_fields_t, _name) + offsetof(of_odu_sig_id_t, tsmap) ... \\
+     offsetof(of_match_fields_t, _name) + offsetof(of_odu_sig_id_t, tsmap) + \\
+     sizeof(uint8_t *) - 1] = 0
+''')
+o.append('const uint8_t loci_match_field_valid_bytes[sizeof(of_match_fields_t)] = {')
+for typ, name in match_fields:
+    o.append('    VALID_BYTES(%s),' % name)
+    if KIND[match_types[name]] == 'ODU_SIG_ID':
+        o.append('    TSMAP_BYTES(%s),' % name)
+o.append('};')
+o.append('')
+o.append('/* Indices into loci_match_fields sorted by name */')
+o.append('static const uint8_t by_name[LOCI_MATCH_FIELD_COUNT] = {')
+order = sorted(range(len(match_fields)), key=lambda i: match_fields[i][1])
+line = '   '
+for i in order:
+    item = ' %d,' % i
+    if len(line) + len(item) > 76:
+        o.append(line)
+        line = '   '
+    line += item
+o.append(line)
+o.append('};')
+o.append('''
+/**
+ * Look up a match field by name
+ * @param name The field name as printed by loci_show_match; need not
+ * be NUL terminated
+ * @param len Length of name
+ * @returns The field descriptor or NULL if there is no such field
+ */
+
+const loci_match_field_t *
+loci_match_field_lookup(const char *name, int len)
+{
+    const loci_match_field_t *field;
+    int lo = 0, hi = LOCI_MATCH_FIELD_COUNT - 1, mid, cmp;
+
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        field = &loci_match_fields[by_name[mid]];
+        cmp = strncmp(name, field->name, len);
+        if (cmp == 0 && field->name_len != len) {
+            cmp = -1;
+        }
+        if (cmp == 0) {
+            return field;
+        } else if (cmp < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    return NULL;
+}''')
+regen.write('src/loci_match_fields.c', '\n'.join(o) + '\n')
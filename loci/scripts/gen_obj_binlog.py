@@ -0,0 +1,251 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Generate loci_obj_binlog.c and loci_obj_binlog.h.
+
+There is a binary log function for each show function in
+loci_obj_show.c, logging the same members in the same order, and
+loci_binlog_match logs the fields of of_match_fields_t by their index
+in it.
+"""
+
+import parse_show
+import regen
+
+funcs, match_types, tables, match_fields = parse_show.load()
+
+BANNER = """/**
+ *
+ * Generated by scripts/gen_obj_binlog.py from loci_obj_show.c and
+ * of_match.h.  Edit the script, not this file.
+ *
+"""
+
+def decl_block(f):
+    out = []
+    seen = set()
+    for t, v in f['decls']:
+        if v in seen:
+            continue
+        seen.add(v)
+        out.append("    %s %s;" % (t, v))
+    return out
+
+def gen_fn(f):
+    cls, ver = f['cls'], f['ver']
+    o = ["void", "%s_OF_VERSION_1_%d_binlog(loci_stream_t *s, of_object_t *obj)" % (cls, ver), "{"]
+    d = decl_block(f)
+    o.extend(d)
+    if d:
+        o.append("")
+    for m in f['members']:
+        if m[0] == 'scalar':
+            _, nm, var, typ = m
+            o.append("    %s_%s_get(obj, &%s);" % (cls, nm, var))
+            o.append("    LOCI_BINLOG_%s(s, %s);" % (typ, var))
+            o.append("")
+        elif m[0] == 'list':
+            _, nm, it = m
+            o.append("    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);")
+            o.append("    %s_%s_bind(obj, &list);" % (cls, nm))
+            o.append("    %s(&list, &elt, rv) {" % it)
+            o.append("        loci_binlog_object(s, (of_object_t *)&elt);")
+            o.append("    }")
+            o.append("    loci_stream_putc(s, LOCI_BINLOG_TAG_END);")
+            o.append("")
+        else:
+            _, nm, var = m
+            o.append("    %s_%s_bind(obj, &%s);" % (cls, nm, var))
+            o.append("    loci_binlog_object(s, &%s);" % var)
+            o.append("")
+    if o[-1] == "":
+        o.pop()
+    o.append("}")
+    o.append("")
+    return o
+
+def gen_c():
+    o = [regen.COPYRIGHT]
+    o.append(BANNER + """ * Source file for binary log serialization of objects.
+ *
+ */
+
+#define DISABLE_WARN_UNUSED_RESULT
+#include <loci/loci.h>
+#include <loci/loci_binlog.h>
+#include <loci/loci_obj_binlog.h>
+
+static void
+unknown_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    loci_binlog_bytes(s, LOCI_BINLOG_TAG_BYTES,
+                      OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+}
+""")
+    for f in funcs:
+        o.extend(gen_fn(f))
+
+    o.append("const char *const loci_binlog_match_field_names[] = {")
+    for typ, name in match_fields:
+        o.append('    "%s",' % name)
+    o.append("};")
+    o.append("")
+    o.append("const int loci_binlog_match_field_count = %d;" % len(match_fields))
+    o.append("")
+    o.append("""#define LOCI_BINLOG_MATCH_FIELD(s, idx, width, value, mask) do {   \\
+        uint8_t *_out = loci_stream_reserve(s, 2 + 2 * (width));    \\
+        if (_out != NULL) {                                         \\
+            _out[0] = (idx);                                        \\
+            _out[1] = (width);                                      \\
+            MEMCPY(_out + 2, (value), (width));                     \\
+            MEMCPY(_out + 2 + (width), (mask), (width));            \\
+            loci_stream_advance(s, 2 + 2 * (width));                \\
+        }                                                           \\
+    } while (0)
+
+/**
+ * Log the active fields of a match
+ */
+void
+loci_binlog_match(loci_stream_t *s, of_match_t *match)
+{
+    uint8_t *out;
+
+    if ((out = loci_stream_reserve(s, 2)) == NULL) {
+        return;
+    }
+    out[0] = LOCI_BINLOG_TAG_MATCH;
+    out[1] = (uint8_t)match->version;
+    loci_stream_advance(s, 2);
+""")
+    for idx, (typ, name) in enumerate(match_fields):
+        width = "sizeof(match->fields.%s)" % name
+        if typ == 'of_odu_sig_id_t':
+            # tpn and length; tsmap is a pointer into the wire buffer
+            width = "2 * sizeof(uint16_t)"
+        o.append("    if (OF_MATCH_MASK_%s_ACTIVE_TEST(match)) {" % name.upper())
+        o.append("        LOCI_BINLOG_MATCH_FIELD(s, %d, %s," % (idx, width))
+        o.append("            &match->fields.%s, &match->masks.%s);" % (name, name))
+        o.append("    }")
+        o.append("")
+    o.append("""    loci_stream_putc(s, LOCI_BINLOG_MATCH_END);
+}
+""")
+    for ver in sorted(tables):
+        o.append("static const loci_obj_binlog_f binlog_funs_v%d[OF_OBJECT_COUNT] = {" % ver)
+        for e in tables[ver]:
+            o.append(e.replace('_show', '_binlog'))
+        o.append("};")
+        o.append("")
+    o.append("""static const loci_obj_binlog_f *const binlog_funs[] = {
+    [1] = binlog_funs_v1,
+    [2] = binlog_funs_v2,
+    [3] = binlog_funs_v3,
+    [4] = binlog_funs_v4,
+    [5] = binlog_funs_v5,
+};
+
+static void
+binlog_fields(loci_stream_t *s, of_object_t *obj)
+{
+    if ((obj->object_id > 0) && (obj->object_id < OF_OBJECT_COUNT) &&
+            OF_VERSION_OKAY(obj->version)) {
+        binlog_funs[obj->version][obj->object_id](s, obj);
+    } else {
+        unknown_binlog(s, obj);
+    }
+}
+
+/**
+ * Log a nested object as an OBJECT ... END field sequence
+ */
+void
+loci_binlog_object(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t object_id = (uint16_t)obj->object_id;
+    uint8_t *out;
+
+    if ((out = loci_stream_reserve(s, 4)) == NULL) {
+        return;
+    }
+    out[0] = LOCI_BINLOG_TAG_OBJECT;
+    MEMCPY(out + 1, &object_id, sizeof(object_id));
+    out[3] = (uint8_t)obj->version;
+    loci_stream_advance(s, 4);
+
+    binlog_fields(s, obj);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+/**
+ * Write a binary log record for any OF object
+ * @param s The output stream
+ * @param obj The object to log
+ * @returns OF_ERROR_NONE or the stream error
+ */
+int
+of_object_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t object_id = (uint16_t)obj->object_id;
+    uint32_t length;
+    uint8_t *hdr;
+
+    if (loci_stream_reserve(s, LOCI_BINLOG_HEADER_LENGTH) == NULL) {
+        return s->error;
+    }
+
+    /* Keep the header in the buffer until the length is known */
+    s->hold = s->pos;
+    loci_stream_advance(s, LOCI_BINLOG_HEADER_LENGTH);
+
+    binlog_fields(s, obj);
+
+    if (s->error == OF_ERROR_NONE) {
+        hdr = s->buf + s->hold;
+        length = s->pos - s->hold;
+        MEMCPY(hdr, &length, sizeof(length));
+        MEMCPY(hdr + 4, &object_id, sizeof(object_id));
+        hdr[6] = (uint8_t)obj->version;
+        hdr[7] = LOCI_BINLOG_HOST_FLAGS;
+    }
+    s->hold = -1;
+
+    return s->error;
+}""")
+    return '\n'.join(o) + '\n'
+
+def gen_h():
+    o = [regen.COPYRIGHT]
+    o.append(BANNER + """ * Header file for binary log serialization of objects.
+ */
+
+/**
+ * Binary log object declarations
+ *
+ * Routines that emit the tagged fields of each object.
+ *
+ */
+
+#if !defined(_LOCI_OBJ_BINLOG_H_)
+#define _LOCI_OBJ_BINLOG_H_
+
+#include <loci/loci.h>
+#include <loci/loci_stream.h>
+
+/**
+ * Write a binary log record for any OF object.
+ */
+int of_object_binlog(loci_stream_t *s, of_object_t *obj);
+
+""")
+    for f in funcs:
+        o.append("void %s_OF_VERSION_1_%d_binlog(loci_stream_t *s, of_object_t *obj);" % (f['cls'], f['ver']))
+    o.append("")
+    o.append("#endif /* _LOCI_OBJ_BINLOG_H_ */")
+    return '\n'.join(o) + '\n'
+
+regen.write('src/loci_obj_binlog.c', gen_c())
+regen.write('inc/loci/loci_obj_binlog.h', gen_h())
@@ -0,0 +1,203 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Generate loci_obj_json.c and loci_obj_json.h.
+
+There is a JSON function for each show function in loci_obj_show.c,
+emitting the same members in the same order, and loci_json_match for
+the fields of of_match_fields_t.
+"""
+
+import parse_show
+import regen
+
+funcs, match_types, tables, match_fields = parse_show.load()
+
+BANNER = """/**
+ *
+ * Generated by scripts/gen_obj_json.py from loci_obj_show.c and
+ * of_match.h.  Edit the script, not this file.
+ *
+"""
+
+def decl_block(f):
+    out = []
+    seen = set()
+    for t, v in f['decls']:
+        if v in seen:
+            continue
+        seen.add(v)
+        out.append("    %s %s;" % (t, v))
+    if any(m[0] == 'list' for m in f['members']):
+        out.append("    int count;")
+    return out
+
+def gen_json_fn(f):
+    cls, ver = f['cls'], f['ver']
+    o = []
+    o.append("void")
+    o.append("%s_OF_VERSION_1_%d_json(loci_stream_t *s, of_object_t *obj)" % (cls, ver))
+    o.append("{")
+    d = decl_block(f)
+    o.extend(d)
+    if d:
+        o.append("")
+    o.append('    loci_stream_lit(s, "{\\"type\\":\\"%s\\",\\"version\\":%d");' % (cls, ver + 1))
+    o.append("")
+    for m in f['members']:
+        if m[0] == 'scalar':
+            _, nm, var, typ = m
+            o.append("    %s_%s_get(obj, &%s);" % (cls, nm, var))
+            o.append('    LOCI_JSON_KEY(s, "%s");' % nm)
+            o.append("    LOCI_JSON_%s(s, %s);" % (typ, var))
+            o.append("")
+        elif m[0] == 'list':
+            _, nm, it = m
+            o.append('    LOCI_JSON_KEY(s, "%s");' % nm)
+            o.append("    loci_stream_putc(s, '[');")
+            o.append("    count = 0;")
+            o.append("    %s_%s_bind(obj, &list);" % (cls, nm))
+            o.append("    %s(&list, &elt, rv) {" % it)
+            o.append("        if (count++ > 0) {")
+            o.append("            loci_stream_putc(s, ',');")
+            o.append("        }")
+            o.append("        of_object_json(s, (of_object_t *)&elt);")
+            o.append("    }")
+            o.append("    loci_stream_putc(s, ']');")
+            o.append("")
+        else:
+            _, nm, var = m
+            o.append("    %s_%s_bind(obj, &%s);" % (cls, nm, var))
+            o.append('    LOCI_JSON_KEY(s, "%s");' % nm)
+            o.append("    of_object_json(s, &%s);" % var)
+            o.append("")
+    o.append("    loci_stream_putc(s, '}');")
+    o.append("}")
+    o.append("")
+    return o
+
+def gen_json_c():
+    o = [regen.COPYRIGHT]
+    o.append(BANNER + """ * Source file for JSON serialization of objects.
+ *
+ */
+
+#define DISABLE_WARN_UNUSED_RESULT
+#include <loci/loci.h>
+#include <loci/loci_json.h>
+#include <loci/loci_obj_json.h>
+
+static void
+unknown_json(loci_stream_t *s, of_object_t *obj)
+{
+    loci_stream_lit(s, "{\\"type\\":");
+    loci_json_string(s, of_object_id_str[obj->object_id], OF_WIRE_BUFFER_MAX_LENGTH);
+    loci_stream_lit(s, ",\\"version\\":");
+    loci_stream_dec(s, obj->version);
+    loci_stream_lit(s, ",\\"length\\":");
+    loci_stream_dec(s, obj->length);
+    loci_stream_putc(s, '}');
+}
+""")
+    for f in funcs:
+        o.extend(gen_json_fn(f))
+
+    # Match
+    o.append("""/**
+ * Serialize a match as a JSON object keyed by field name
+ *
+ * Only active fields are emitted, each as {"value":...,"mask":...}.
+ */
+void
+loci_json_match(loci_stream_t *s, of_match_t *match)
+{
+    char sep = '{';
+""")
+    for typ, name in match_fields:
+        st = match_types[name]
+        o.append("    if (OF_MATCH_MASK_%s_ACTIVE_TEST(match)) {" % name.upper())
+        o.append("        loci_stream_putc(s, sep);")
+        o.append("        sep = ',';")
+        o.append('        loci_stream_lit(s, "\\"%s\\":{\\"value\\":");' % name)
+        o.append("        LOCI_JSON_%s(s, match->fields.%s);" % (st, name))
+        o.append('        loci_stream_lit(s, ",\\"mask\\":");')
+        o.append("        LOCI_JSON_%s(s, match->masks.%s);" % (st, name))
+        o.append("        loci_stream_putc(s, '}');")
+        o.append("    }")
+        o.append("")
+    o.append("""    if (sep == '{') {
+        loci_stream_putc(s, '{');
+    }
+    loci_stream_putc(s, '}');
+}
+""")
+    for ver in sorted(tables):
+        o.append("static const loci_obj_json_f json_funs_v%d[OF_OBJECT_COUNT] = {" % ver)
+        for e in tables[ver]:
+            o.append(e.replace('_show', '_json'))
+        o.append("};")
+        o.append("")
+    o.append("""static const loci_obj_json_f *const json_funs[] = {
+    [1] = json_funs_v1,
+    [2] = json_funs_v2,
+    [3] = json_funs_v3,
+    [4] = json_funs_v4,
+    [5] = json_funs_v5,
+};
+
+/**
+ * Serialize any OF object as JSON
+ * @param s The output stream
+ * @param obj The object to serialize
+ * @returns OF_ERROR_NONE or the stream error
+ *
+ * Field names are the LOCI member names.  Lists become arrays and
+ * sub-objects nested JSON objects.
+ */
+int
+of_object_json(loci_stream_t *s, of_object_t *obj)
+{
+    if ((obj->object_id > 0) && (obj->object_id < OF_OBJECT_COUNT) &&
+            OF_VERSION_OKAY(obj->version)) {
+        json_funs[obj->version][obj->object_id](s, obj);
+    } else {
+        unknown_json(s, obj);
+    }
+    return s->error;
+}""")
+    return '\n'.join(o) + '\n'
+
+def gen_json_h():
+    o = [regen.COPYRIGHT]
+    o.append(BANNER + """ * Header file for JSON serialization of objects.
+ */
+
+/**
+ * JSON object declarations
+ *
+ * Routines that emit a JSON document for each object.
+ *
+ */
+
+#if !defined(_LOCI_OBJ_JSON_H_)
+#define _LOCI_OBJ_JSON_H_
+
+#include <loci/loci.h>
+#include <loci/loci_stream.h>
+
+/**
+ * Serialize any OF object as JSON.
+ */
+int of_object_json(loci_stream_t *s, of_object_t *obj);
+
+""")
+    for f in funcs:
+        o.append("void %s_OF_VERSION_1_%d_json(loci_stream_t *s, of_object_t *obj);" % (f['cls'], f['ver']))
+    o.append("")
+    o.append("#endif /* _LOCI_OBJ_JSON_H_ */")
+    return '\n'.join(o) + '\n'
+
+regen.write('src/loci_obj_json.c', gen_json_c())
+regen.write('inc/loci/loci_obj_json.h', gen_json_h())
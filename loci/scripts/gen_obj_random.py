@@ -0,0 +1,342 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Generate loci_obj_random.c and loci_obj_random.h.
+
+There is a random function for each concrete class and version with
+a show function in loci_obj_show.c, filling its members in the same
+order.  The wire types, setters, list element classes and match TLVs
+are read from the rest of the loxigen output.
+"""
+
+import glob
+import re
+
+import parse_show
+import regen
+
+funcs, match_types, tables, match_fields = parse_show.load()
+
+BANNER = """/**
+ *
+ * Generated by scripts/gen_obj_random.py from the loxigen output.
+ * Edit the script, not this file.
+ *
+"""
+
+# Object ids in enum order
+base_h = regen.read('inc/loci/loci_base.h')
+enum = base_h[base_h.index('typedef enum of_object_id_e'):base_h.index('} of_object_id_t;')]
+ids = []
+for m in re.finditer(r'^    (OF_[A-Z0-9_]+),?\s*(?:=\s*(\d+))?', enum, re.M):
+    nm = m.group(1)
+    if nm in ('OF_OBJECT_INVALID', 'OF_OBJECT_COUNT') or nm.endswith('_COUNT'):
+        continue
+    ids.append(nm)
+id_index = {}
+for nm in ids:
+    if nm not in id_index:
+        id_index[nm] = len(id_index)
+
+def cls_id(cls):
+    return 'OF_' + cls[3:].upper()
+
+# Class metadata
+meta = {}
+md = regen.read('src/loci_class_metadata.c')
+for m in re.finditer(r'^    \[(OF_[A-Z0-9_]+)\] = \{\n(.*?)\n    \},', md, re.S | re.M):
+    body = m.group(2)
+    tg = re.search(r'\.wire_type_get=(\w+)', body).group(1)
+    ts = re.search(r'\.wire_type_set=(\w+)', body).group(1)
+    meta[m.group(1)] = (tg, ts)
+
+shown = set((f['cls'], f['ver']) for f in funcs)
+all_classes = sorted(set(f['cls'] for f in funcs), key=lambda c: id_index[cls_id(c)])
+
+# Optical extension classes whose generated accessors can't place every
+# member, or whose lengths don't survive the validator
+BROKEN = ('of_calient_flow_stats_entry', 'of_oxm_exp_odu_sigid',
+          'of_oxm_exp_odu_sigid_masked', 'of_action_circuit',
+          'of_action_oplink_att', 'of_exp_port', 'of_exp_port_adjacency',
+          'of_port_optical')
+
+def concrete(cls):
+    tg, ts = meta.get(cls_id(cls), ('NULL', 'NULL'))
+    return not (tg != 'NULL' and ts == 'NULL') and cls not in BROKEN
+
+def candidates(base, ver):
+    bid = cls_id(base)
+    tg, ts = meta.get(bid, ('NULL', 'NULL'))
+    if tg == 'NULL':
+        return [base] if (base, ver) in shown and base not in BROKEN else []
+    out = []
+    for c in all_classes:
+        ctg, cts = meta.get(cls_id(c), ('NULL', 'NULL'))
+        if ctg == tg and cts != 'NULL' and (c, ver) in shown and c not in BROKEN:
+            out.append(c)
+    return out
+
+# Setters returning a status
+classes_h = regen.read('inc/loci/loci_classes.h')
+int_setters = set(re.findall(r'extern int WARN_UNUSED_RESULT (of_\w+_set)\(', classes_h))
+
+# Match TLV initialization done by of_<cls>_new
+match_tlv = {}
+for path in sorted(glob.glob(regen.path('src/class*.c'))):
+    txt = open(path).read()
+    for m in re.finditer(r'^(of_\w+)_new\(of_version_t version\)\n\{\n(.*?)\n\}', txt, re.M | re.S):
+        t = re.search(r'/\* Initialize match TLV for 1.2 \*/\n    if \(\(version >= OF_VERSION_1_(\d)\)\) \{\n        of_object_u16_set\(\(of_object_t \*\)obj, (\d+) \+ 2, 4\);', m.group(2))
+        if t:
+            match_tlv[m.group(1)] = (int(t.group(1)), int(t.group(2)))
+
+# List element base classes
+list_elem = {}
+for path in sorted(glob.glob(regen.path('src/of_list_*.c'))):
+    txt = open(path).read()
+    m = re.search(r'^(of_list_\w+)_first\(.*?\n\{\n    int rv;\n\n    (of_\w+)_init\(obj, list->version, -1, 1\);', txt, re.M | re.S)
+    list_elem[m.group(1)] = m.group(2)
+
+used_sets = {}
+
+def id_set(base, ver):
+    key = (base, ver)
+    if key not in used_sets:
+        used_sets[key] = candidates(base, ver)
+    return key
+
+def set_name(key):
+    return "%s_v%d_ids" % (key[0], key[1] + 1)
+
+def set_args(key):
+    c = used_sets[key]
+    if not c:
+        return "NULL, 0"
+    return "%s, %d" % (set_name(key), len(c))
+
+# Members written by of_<cls>_push_wire_types identify the class on the wire
+pushed = {}
+for path in sorted(glob.glob(regen.path('src/class*.c'))):
+    txt = open(path).read()
+    for m in re.finditer(r'^(of_\w+)_push_wire_types\(of_object_t \*obj\)\n\{\n(.*?)\n\}', txt, re.M | re.S):
+        pushed[m.group(1)] = set(re.findall(r'; /\* (\w+) \*/', m.group(2)))
+
+def is_packet(cls, nm):
+    return cls in ('of_packet_in', 'of_packet_out') and nm == 'data'
+
+def gen_fn(f):
+    cls, ver = f['cls'], f['ver']
+    o = []
+    o.append("int")
+    o.append("%s_OF_VERSION_1_%d_random(loci_random_t *r, of_object_t *obj, int depth)" % (cls, ver))
+    o.append("{")
+    body = []
+    need_rv = False
+    used_vars = set()
+    for m in f['members']:
+        if m[0] == 'scalar':
+            _, nm, var, typ = m
+            if nm in pushed.get(cls, ()):
+                continue
+            used_vars.add(var)
+            setter = "%s_%s_set" % (cls, nm)
+            if typ == 'match':
+                body.append("    loci_random_match(r, obj->version, &%s);" % var)
+            elif is_packet(cls, nm):
+                body.append("    loci_random_packet(r, &%s);" % var)
+            else:
+                body.append("    LOCI_RANDOM_%s(r, %s);" % (typ, var))
+            arg = ("&" + var) if typ in ('octets', 'match') else var
+            if setter in int_setters:
+                need_rv = True
+                body.append("    if ((rv = %s(obj, %s)) < 0) {" % (setter, arg))
+                body.append("        return rv;")
+                body.append("    }")
+            else:
+                body.append("    %s(obj, %s);" % (setter, arg))
+            body.append("")
+        elif m[0] == 'list':
+            _, nm, it = m
+            lcls = 'of_list_' + it[len('OF_LIST_'):-len('_ITER')].lower()
+            key = id_set(list_elem[lcls], ver)
+            need_rv = True
+            used_vars.add('list')
+            body.append("    if ((rv = loci_random_list(r, &list, %s, obj->version," % cls_id(lcls))
+            body.append("                               %s, depth + 1)) < 0 ||" % set_args(key))
+            body.append("        (rv = %s_%s_set(obj, &list)) < 0) {" % (cls, nm))
+            body.append("        return rv;")
+            body.append("    }")
+            body.append("")
+        else:
+            _, nm, var = m
+            typ = [d[0] for d in f['decls'] if d[1] == var][0]
+            key = id_set(typ[:-2], ver)
+            need_rv = True
+            used_vars.add(var)
+            body.append("    if ((rv = loci_random_child(r, &%s, obj->version," % var)
+            body.append("                                %s, depth + 1)) < 0 ||" % set_args(key))
+            body.append("        (rv = %s_%s_set(obj, &%s)) < 0) {" % (cls, nm, var))
+            body.append("        return rv;")
+            body.append("    }")
+            body.append("")
+    decls = []
+    seen = set()
+    for t, v in f['decls']:
+        if v in seen or v not in used_vars:
+            continue
+        seen.add(v)
+        decls.append("    %s %s;" % (t, v))
+    if need_rv:
+        decls.append("    int rv;")
+    o.extend(decls)
+    if decls:
+        o.append("")
+    if cls in match_tlv and ver >= match_tlv[cls][0]:
+        o.append("    /* Initialize match TLV for 1.2 */")
+        o.append("    of_object_u16_set(obj, %d + 2, 4);" % match_tlv[cls][1])
+        o.append("")
+    o.extend(body)
+    o.append("    return OF_ERROR_NONE;")
+    o.append("}")
+    o.append("")
+    return o
+
+def gen_c():
+    o = [regen.COPYRIGHT]
+    o.append(BANNER + """ * Source file for random generation of objects.
+ *
+ */
+
+#include <loci/loci.h>
+#include <loci/loci_random.h>
+#include <loci/loci_obj_random.h>
+#include "loci_int.h"
+""")
+    fns = []
+    for f in funcs:
+        if not concrete(f['cls']):
+            continue
+        fns.append(gen_fn(f))
+    # Candidate tables, now that every list and child has been seen
+    o.append("/* Concrete classes that may stand in for a list element or child */")
+    o.append("")
+    for key in sorted(used_sets, key=lambda k: (id_index[cls_id(k[0])], k[1])):
+        c = used_sets[key]
+        if not c:
+            continue
+        o.append("static const of_object_id_t %s[] = {" % set_name(key))
+        for x in c:
+            o.append("    %s," % cls_id(x))
+        o.append("};")
+        o.append("")
+    o.append("""static int
+unknown_random(loci_random_t *r, of_object_t *obj, int depth)
+{
+    return OF_ERROR_PARAM;
+}
+""")
+    for fn in fns:
+        o.extend(fn)
+    for ver in sorted(tables):
+        o.append("static const loci_obj_random_f random_funs_v%d[OF_OBJECT_COUNT] = {" % ver)
+        for e in tables[ver]:
+            m = re.match(r'^    (of_[a-z0-9_]+)_OF_VERSION_1_\d_show,$', e)
+            if m and concrete(m.group(1)):
+                o.append(e.replace('_show', '_random'))
+            elif m:
+                o.append("    unknown_random,")
+            else:
+                o.append(e.replace('unknown_show', 'unknown_random'))
+        o.append("};")
+        o.append("")
+    o.append("""static const loci_obj_random_f *const random_funs[] = {
+    [1] = random_funs_v1,
+    [2] = random_funs_v2,
+    [3] = random_funs_v3,
+    [4] = random_funs_v4,
+    [5] = random_funs_v5,
+};
+""")
+    # Message types by version
+    for ver in sorted(tables):
+        o.append("static const of_object_id_t message_ids_v%d[] = {" % ver)
+        for c in all_classes:
+            cid = cls_id(c)
+            if (c, ver - 1) in shown and concrete(c) and meta.get(cid, ('NULL', 'NULL'))[1] != 'NULL' \
+                    and meta[cid][1].endswith('_push_wire_types') and id_index[cid] < id_index['OF_ACTION'] \
+                    and c != 'of_header':
+                o.append("    %s," % cid)
+        o.append("};")
+        o.append("")
+    o.append("""static const struct {
+    const of_object_id_t *ids;
+    int count;
+} message_ids[] = {""")
+    for ver in sorted(tables):
+        o.append("    [%d] = { message_ids_v%d, sizeof(message_ids_v%d) / sizeof(message_ids_v%d[0]) }," % (ver, ver, ver, ver))
+    o.append("""};
+
+/**
+ * Fill an object, bound to a wire buffer, with random member values
+ * @param r The generator
+ * @param obj The object, initialized as of_<cls>_new or of_list_append_bind would
+ * @param depth Nesting depth of obj; 0 for a top level object
+ * @returns OF_ERROR_NONE or an error from the generated setters
+ */
+int
+loci_random_object(loci_random_t *r, of_object_t *obj, int depth)
+{
+    if ((obj->object_id > 0) && (obj->object_id < OF_OBJECT_COUNT) &&
+            OF_VERSION_OKAY(obj->version)) {
+        return random_funs[obj->version][obj->object_id](r, obj, depth);
+    }
+    return OF_ERROR_PARAM;
+}
+
+/**
+ * The concrete message types of a version
+ * @param version The OpenFlow version
+ * @param count Set to the number of message types
+ * @returns An array of object ids, in object id order
+ */
+const of_object_id_t *
+loci_random_message_ids(of_version_t version, int *count)
+{
+    if (!OF_VERSION_OKAY(version)) {
+        *count = 0;
+        return NULL;
+    }
+    *count = message_ids[version].count;
+    return message_ids[version].ids;
+}""")
+    return '\n'.join(o) + '\n'
+
+def gen_h():
+    o = [regen.COPYRIGHT]
+    o.append(BANNER + """ * Header file for random generation of objects.
+ */
+
+/**
+ * Random object declarations
+ *
+ * Routines that fill each object with random member values.
+ *
+ */
+
+#if !defined(_LOCI_OBJ_RANDOM_H_)
+#define _LOCI_OBJ_RANDOM_H_
+
+#include <loci/loci.h>
+#include <loci/loci_random.h>
+
+""")
+    for f in funcs:
+        if concrete(f['cls']):
+            o.append("int %s_OF_VERSION_1_%d_random(loci_random_t *r, of_object_t *obj, int depth);" % (f['cls'], f['ver']))
+    o.append("")
+    o.append("#endif /* _LOCI_OBJ_RANDOM_H_ */")
+    return '\n'.join(o) + '\n'
+
+regen.write('src/loci_obj_random.c', gen_c())
+regen.write('inc/loci/loci_obj_random.h', gen_h())
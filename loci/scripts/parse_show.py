@@ -0,0 +1,130 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Read the classes and match fields of LOCI back out of its loxigen output.
+
+loci_obj_show.c has a show function for each class and version that
+gets or binds each member in order, and a table of them per version;
+it is the most regular description of the classes in the tree, so the
+JSON, binary log and random generators are derived from it.
+"""
+
+import re
+
+import regen
+
+FN_RE = re.compile(r'^(of_[a-z0-9_]+)_OF_VERSION_1_(\d)_show\(loci_writer_f writer, void\* cookie, of_object_t \*obj\)$')
+DECL_RE = re.compile(r'^    ([a-zA-Z0-9_]+) ([a-zA-Z0-9_]+);$')
+GET_RE = re.compile(r'^    (of_[a-zA-Z0-9_]+)_get\(obj, &([a-z0-9_]+)\);$')
+NAME_RE = re.compile(r'^    out \+= writer\(cookie, "([A-Za-z0-9_]+)="\);$')
+VAL_RE = re.compile(r'^    out \+= LOCI_SHOW_([a-z0-9_]+)\(writer, cookie, ([a-z0-9_]+)\);$')
+LISTHDR_RE = re.compile(r'^    out \+= writer\(cookie, "(of_[a-z0-9_]+)=\{ "\);$')
+BIND_RE = re.compile(r'^    (of_[a-z0-9_]+)_bind\(obj, &([a-z0-9_]+)\);$')
+ITER_RE = re.compile(r'^    (OF_LIST_[A-Z0-9_]+_ITER)\(&list, &elt, rv\) \{$')
+SUBSHOW_RE = re.compile(r'^    out \+= of_object_show\(writer, cookie, &([a-z0-9_]+)\);$')
+MATCH_FIELD_RE = re.compile(r'^        out \+= LOCI_SHOW_([a-z0-9_]+)\(writer, cookie, match->fields\.([a-z0-9_]+)\);$')
+
+
+def parse(path):
+    """Return the show functions, match field types and tables.
+
+    Each function is a dict of cls, ver, decls (type, variable) and
+    members, each ('scalar', name, variable, show type), ('list', name,
+    iterator) or ('sub', name, variable).  match_types maps a match
+    field to its show type, and tables maps a version to the lines of
+    its show_funs table.
+    """
+    lines = open(path).read().split('\n')
+    funcs = []
+    i = 0
+    n = len(lines)
+    match_types = {}
+    tables = {}
+    while i < n:
+        m = FN_RE.match(lines[i])
+        if m:
+            cls, ver = m.group(1), int(m.group(2))
+            assert lines[i + 1] == '{'
+            i += 2
+            decls = []
+            members = []
+            while lines[i] != '}':
+                line = lines[i]
+                d = DECL_RE.match(line)
+                if line == '    int out = 0;' or line == '' or line == '    return out;':
+                    i += 1
+                    continue
+                if d and not line.startswith('    return'):
+                    decls.append((d.group(1), d.group(2)))
+                    i += 1
+                    continue
+                g = GET_RE.match(line)
+                if g:
+                    acc, var = g.group(1), g.group(2)
+                    nm = NAME_RE.match(lines[i + 1]).group(1)
+                    v = VAL_RE.match(lines[i + 2])
+                    assert v and v.group(2) == var, lines[i + 2]
+                    assert lines[i + 3] == '    out += writer(cookie, " ");'
+                    assert acc == cls + '_' + nm, (acc, cls, nm)
+                    members.append(('scalar', nm, var, v.group(1)))
+                    i += 4
+                    continue
+                lh = LISTHDR_RE.match(line)
+                if lh:
+                    b = BIND_RE.match(lines[i + 1])
+                    it = ITER_RE.match(lines[i + 2])
+                    assert b and it, lines[i + 1:i + 3]
+                    assert lines[i + 3] == '        of_object_show(writer, cookie, (of_object_t *)&elt);'
+                    assert lines[i + 4] == '    }'
+                    assert lines[i + 5] == '    out += writer(cookie, "} ");'
+                    nm = b.group(1)[len(cls) + 1:]
+                    members.append(('list', nm, it.group(1)))
+                    i += 6
+                    continue
+                b = BIND_RE.match(line)
+                if b:
+                    s = SUBSHOW_RE.match(lines[i + 1])
+                    assert s and s.group(1) == b.group(2), lines[i + 1]
+                    nm = b.group(1)[len(cls) + 1:]
+                    members.append(('sub', nm, b.group(2)))
+                    i += 2
+                    continue
+                raise Exception("unparsed line %d: %r" % (i + 1, line))
+            funcs.append(dict(cls=cls, ver=ver, decls=decls, members=members))
+            i += 1
+            continue
+        mf = MATCH_FIELD_RE.match(lines[i])
+        if mf:
+            match_types[mf.group(2)] = mf.group(1)
+        mt = re.match(r'^static const loci_obj_show_f show_funs_v(\d)\[OF_OBJECT_COUNT\] = \{$', lines[i])
+        if mt:
+            ver = int(mt.group(1))
+            entries = []
+            i += 1
+            while lines[i] != '};':
+                entries.append(lines[i])
+                i += 1
+            tables[ver] = entries
+        i += 1
+    return funcs, match_types, tables
+
+
+def match_field_order(path):
+    """Return of_match_fields_t members in declaration order."""
+    txt = open(path).read()
+    body = txt[txt.index('typedef struct of_match_fields_s {'):txt.index('} of_match_fields_t;')]
+    out = []
+    for line in body.split('\n')[1:]:
+        m = re.match(r'^    ([a-z0-9_]+)\s+([a-z0-9_]+);$', line)
+        if m:
+            out.append((m.group(1), m.group(2)))
+    return out
+
+
+def load():
+    """Return parse() of the LOCI tree and its match field order."""
+    funcs, match_types, tables = parse(regen.path('src/loci_obj_show.c'))
+    match_fields = match_field_order(regen.path('inc/loci/of_match.h'))
+    return funcs, match_types, tables, match_fields
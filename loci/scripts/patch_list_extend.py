@@ -0,0 +1,54 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Add loci_list_extend to loci_int.h of the loxigen output.
+
+Runs after patch_trace.py.  The bulk fill functions of loci_columns.c
+and loci_debug_counter.c write list elements in place through it.
+"""
+
+import regen
+
+
+def loci_int_h(s):
+    return regen.insert_after(s, """\
+        LOCI_TRACE_OBJECT(object_new, obj);     \\
+    } while (0)
+
+""", """\
+/**
+ * Make room for bytes more at the end of a list, for writing its
+ * elements in bulk
+ * @param list The list, at the end of its wire buffer
+ * @param bytes Number of bytes to add
+ * @returns Where the new bytes go, or NULL if the buffer can't grow
+ *
+ * The lengths of the list and its parents are updated.  Unlike
+ * of_wire_buffer_grow, the new bytes are not zeroed; the caller
+ * writes all of them.
+ */
+static inline uint8_t *
+loci_list_extend(of_object_t *list, int bytes)
+{
+    uint8_t *data;
+    int end;
+
+    if (!of_object_can_grow(list, list->length + bytes)) {
+        return NULL;
+    }
+    data = OF_OBJECT_BUFFER_INDEX(list, list->length);
+    end = OF_OBJECT_ABSOLUTE_OFFSET(list, list->length + bytes);
+    if (end > WBUF_CURRENT_BYTES(list->wbuf)) {
+        list->wbuf->current_bytes = end;
+    }
+    of_object_parent_length_update(list, bytes);
+
+    return data;
+}
+
+""", done='\nloci_list_extend(')
+
+
+regen.rewrite('src/loci_int.h', loci_int_h)
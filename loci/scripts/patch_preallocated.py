@@ -0,0 +1,192 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Let the loxigen output build objects in buffers of fixed capacity.
+
+Runs after patch_trace.py.
+
+- of_object_new_preallocated builds an object over a caller's buffer;
+- the variable length setters of class*.c and of_list_*.c check
+  of_wire_buffer_can_replace before moving the tail of the buffer, and
+  fail with OF_ERROR_RESOURCE when the object would outgrow it.
+"""
+
+import glob
+import os
+
+import regen
+
+CHECK = """\
+{i}if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {{
+{free}{i}    return OF_ERROR_RESOURCE;
+{i}}}
+"""
+
+
+def class_c(s):
+    """Check for room before each replace of a member."""
+    lines = s.split('\n')
+    out = []
+    for i, line in enumerate(lines):
+        checked = any('of_wire_buffer_can_replace(' in prev
+                      for prev in lines[max(i - 4, 0):i])
+        if not checked and line in (
+                '    /* Otherwise, replace existing object in data buffer */',
+                '    of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));'):
+            out.append(CHECK.format(i='    ', free='').rstrip('\n'))
+            if line.startswith('    /*'):
+                out.append('')
+        out.append(line)
+        if line == '        new_len = match_octets.bytes;' and \
+                'can_replace' not in lines[i + 1]:
+            out.append(CHECK.format(
+                i='        ',
+                free='            FREE(match_octets.data);\n').rstrip('\n'))
+    return '\n'.join(out)
+
+
+def of_wire_buf_h(s):
+    return regen.insert_after(s, """\
+        wbuf->current_bytes = bytes;
+    }
+}
+
+""", """/**
+ * Check for room to replace data in the wire buffer.
+ *
+ * @param wbuf Pointer to the wire buffer structure
+ * @param old_len Number of bytes being replaced
+ * @param new_len Number of bytes replacing them
+ * @return Boolean
+ *
+ * Variable length setters check this before moving the tail of the
+ * buffer, so that a buffer of fixed capacity (see
+ * of_object_new_preallocated) fails with OF_ERROR_RESOURCE rather than
+ * an assertion.
+ */
+
+static inline int
+of_wire_buffer_can_replace(of_wire_buffer_t *wbuf, int old_len, int new_len)
+{
+    return wbuf->current_bytes + (new_len - old_len) <= wbuf->alloc_bytes;
+}
+
+""", done='of_wire_buffer_can_replace(')
+
+
+def of_object_h(s):
+    return regen.insert_after(s, """\
+of_object_t *of_object_new_from_message_preallocated(
+    of_object_storage_t *storage, uint8_t *buf, int len);
+
+""", """\
+of_object_t *of_object_new_preallocated(
+    of_object_storage_t *storage, of_object_id_t object_id,
+    of_version_t version, uint8_t *buf, int bytes);
+
+""")
+
+
+def of_object_c(s):
+    s = regen.edit(s, """\
+#include "loci_log.h"
+#include <loci/loci.h>
+""", """\
+#include "loci_log.h"
+#include "loci_int.h"
+#include <loci/loci.h>
+""")
+    return regen.edit(s, """\
+/**
+ * Bind an existing buffer to an LOCI object
+""", """/**
+ * Build an object in a caller provided buffer
+ *
+ * @param storage Pointer to an uninitialized of_object_storage_t
+ * @param object_id The class of the object
+ * @param version The wire version to use for the object
+ * @param buf Pointer to the buffer, such as a slot of a send ring
+ * @param bytes Capacity of buf
+ * @returns Pointer to an initialized of_object_t, or NULL if the
+ * class is not in version or its fixed part does not fit in buf
+ *
+ * The object is initialized as by of_<cls>_new, but its wire buffer is
+ * buf: the accessors write the wire bytes of the object in place and
+ * setters that would grow the object past bytes return
+ * OF_ERROR_RESOURCE.  Once built, the message is the first obj->length
+ * bytes of buf.
+ *
+ * The lifetime of the returned object is the minimum of the lifetimes of
+ * 'buf' and 'storage'.  It must not be passed to of_object_delete.
+ */
+
+of_object_t *
+of_object_new_preallocated(of_object_storage_t *storage,
+                           of_object_id_t object_id, of_version_t version,
+                           uint8_t *buf, int bytes)
+{
+    of_object_t *obj = &storage->obj;
+    of_wire_buffer_t *wbuf = &storage->wbuf;
+    int len;
+
+    memset(storage, 0, sizeof(*storage));
+
+    if (!OF_VERSION_OKAY(version) ||
+        object_id < 0 || object_id >= OF_OBJECT_COUNT) {
+        return NULL;
+    }
+
+    len = of_object_fixed_len[version][object_id];
+    if (len < 0 || len > bytes) {
+        return NULL;
+    }
+
+    obj->wbuf = wbuf;
+    wbuf->buf = buf;
+    wbuf->alloc_bytes = bytes;
+
+    of_object_init_map[object_id](obj, version, len, 0);
+    LOCI_TRACE_OBJECT(object_new, obj);
+    of_object_wire_type_set(obj);
+    of_object_wire_length_set(obj, obj->length);
+
+    /* Initialize match TLV for 1.2 as of_<cls>_new does */
+    if (version >= OF_VERSION_1_2) {
+        switch (object_id) {
+        case OF_AGGREGATE_STATS_REQUEST:
+        case OF_FLOW_MOD:
+        case OF_FLOW_ADD:
+        case OF_FLOW_DELETE:
+        case OF_FLOW_DELETE_STRICT:
+        case OF_FLOW_MODIFY:
+        case OF_FLOW_MODIFY_STRICT:
+        case OF_FLOW_REMOVED:
+        case OF_FLOW_STATS_ENTRY:
+        case OF_FLOW_STATS_REQUEST:
+            of_object_u16_set(obj, 48 + 2, 4);
+            break;
+        case OF_PACKET_IN:
+            of_object_u16_set(obj, 16 + 2, 4);
+            break;
+        default:
+            break;
+        }
+    }
+
+    return obj;
+}
+
+\
+/**
+ * Bind an existing buffer to an LOCI object
+""", done='\nof_object_new_preallocated(')
+
+
+for name in sorted(glob.glob(regen.path('src/class*.c')) +
+                   glob.glob(regen.path('src/of_list_*.c'))):
+    regen.rewrite(os.path.relpath(name, regen.LOCI), class_c)
+regen.rewrite('inc/loci/of_wire_buf.h', of_wire_buf_h)
+regen.rewrite('inc/loci/of_object.h', of_object_h)
+regen.rewrite('src/of_object.c', of_object_c)
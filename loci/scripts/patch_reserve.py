@@ -0,0 +1,258 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Add reserve accessors for the octets members of the loxigen output.
+
+Runs after patch_preallocated.py.  Next to each of_<cls>_<member>_set
+of an octets member in class*.c goes an of_<cls>_<member>_reserve,
+which resizes the member and returns where to write it in place; it
+is declared in loci_classes.h.  of_wire_buffer_replace_data is split
+into of_wire_buffer_resize_data and the copy.
+
+Existing reserve accessors are written again, so changes to the
+template below reach every class.
+"""
+
+import glob
+import os
+import re
+
+import regen
+
+SET_RE = re.compile(
+    r'(?P<set>/\*\*\n \* Set (?P<member>\w+) in an object of type (?P<cls>\w+)\.\n'
+    r'(?:(?!\*/).)*?\*/\n'
+    r'int WARN_UNUSED_RESULT\n(?P<fn>of_\w+)_set\(\n    (?P<typ>of_\w+_t) \*obj,\n'
+    r'    of_octets_t \*(?P=member)\)\n\{(?P<body>.*?)\n\}\n)'
+    r'(?P<reserve>\n/\*\*\n \* Reserve space for (?:(?!\n\}\n).)*\n\}\n)?', re.S)
+
+RESERVE = """
+/**
+ * Reserve space for %(member)s in an object of type %(cls)s.
+ * @param obj Pointer to an object of type %(cls)s.
+ * @param bytes The length of %(member)s
+ * @param %(member)s Set to where %(member)s is written in the object
+ *
+ * The object is resized for bytes of %(member)s, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+%(fn)s_reserve(
+    %(typ)s *obj,
+    int bytes,
+    uint8_t **%(member)s)
+{%(head)s    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *%(member)s = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+%(tail)s
+}
+"""
+
+# (fn, typ, member) of each reserve accessor
+reserves = []
+
+
+def reserve(m):
+    """Return the set accessor matched and its reserve accessor."""
+    member, fn, typ = m.group('member', 'fn', 'typ')
+    head, rest = m.group('body').split('    new_len = %s->bytes;\n' % member)
+    tail = rest[rest.index('\n    /* Not scalar, update lengths if needed */'):]
+    reserves.append((fn, typ, member))
+    return m.group('set') + RESERVE % dict(member=member, cls=m.group('cls'),
+                                           fn=fn, typ=typ, head=head,
+                                           tail=tail)
+
+
+def class_c(s):
+    return SET_RE.sub(reserve, s)
+
+
+def loci_classes_h(s):
+    for fn, typ, member in reserves:
+        decl = """\
+extern int WARN_UNUSED_RESULT %s_set(
+    %s *obj,
+    of_octets_t *%s);
+""" % (fn, typ, member)
+        if decl not in s:
+            # Not declared for the superclasses
+            continue
+        s = regen.insert_after(s, decl, """\
+extern int WARN_UNUSED_RESULT %s_reserve(
+    %s *obj,
+    int bytes,
+    uint8_t **%s);
+""" % (fn, typ, member), done=' %s_reserve(\n' % fn)
+    return s
+
+
+def of_wire_buf_h(s):
+    return regen.insert_after(s, """\
+extern void
+of_wire_buffer_replace_data(of_wire_buffer_t *wbuf, 
+                            int offset, 
+                            int old_len,
+                            uint8_t *data,
+                            int new_len);
+""", """
+extern uint8_t *
+of_wire_buffer_resize_data(of_wire_buffer_t *wbuf,
+                           int offset,
+                           int old_len,
+                           int new_len);
+""", done='of_wire_buffer_resize_data(')
+
+
+def of_wire_buf_c(s):
+    return regen.edit(s, """/**
+ * Replace data in the data buffer, possibly with a new
+ * length or appending to buffer.
+ *
+ * @param wbuf The wire buffer being updated.
+ * @param offset The start point of the update
+ * @param old_len The number of bytes being replaced
+ * @param data Source of bytes to write into the buffer
+ * @param new_len The number of bytes to write
+ *
+ * The buffer may grow for this operation.  Current byte count
+ * is pre-grow for the replace.
+ *
+ * The current byte count for the buffer is updated.
+ * 
+ */
+
+void
+of_wire_buffer_replace_data(of_wire_buffer_t *wbuf, 
+                            int offset, 
+                            int old_len,
+                            uint8_t *data,
+                            int new_len)
+{
+    int bytes = 0;
+    uint8_t *src_ptr, *dst_ptr;
+    int cur_bytes;
+
+    LOCI_ASSERT(wbuf != NULL);
+
+    cur_bytes = wbuf->current_bytes;
+
+    /* Doesn't make sense; mismatch in current buffer info */
+    LOCI_ASSERT(old_len + offset <= wbuf->current_bytes);
+
+    wbuf->current_bytes += (new_len - old_len); // may decrease size
+
+    if ((old_len + offset < cur_bytes) && (old_len != new_len)) {
+        /* Need to move back of buffer */
+        src_ptr = &wbuf->buf[offset + old_len];
+        dst_ptr = &wbuf->buf[offset + new_len];
+        bytes = cur_bytes - (offset + old_len);
+        MEMMOVE(dst_ptr, src_ptr, bytes);
+    }
+    LOCI_STATS_REPLACE_DATA(bytes);
+    LOCI_TRACE(replace_data, offset, old_len, new_len, bytes);
+
+    dst_ptr = &wbuf->buf[offset];
+    MEMCPY(dst_ptr, data, new_len);
+
+    LOCI_ASSERT(wbuf->current_bytes == cur_bytes + (new_len - old_len));
+}
+""", """/**
+ * Resize a span of the data buffer, moving the bytes after it.
+ *
+ * @param wbuf The wire buffer being updated.
+ * @param offset The start point of the span
+ * @param old_len The current length of the span
+ * @param new_len The new length of the span
+ * @returns Pointer to the start of the span in the buffer
+ *
+ * The buffer may grow for this operation.  The contents of the span
+ * are left to the caller: bytes beyond the old length are not
+ * initialized.
+ *
+ * The current byte count for the buffer is updated.
+ */
+
+uint8_t *
+of_wire_buffer_resize_data(of_wire_buffer_t *wbuf,
+                           int offset,
+                           int old_len,
+                           int new_len)
+{
+    int bytes = 0;
+    uint8_t *src_ptr, *dst_ptr;
+    int cur_bytes;
+
+    LOCI_ASSERT(wbuf != NULL);
+
+    cur_bytes = wbuf->current_bytes;
+
+    /* Doesn't make sense; mismatch in current buffer info */
+    LOCI_ASSERT(old_len + offset <= wbuf->current_bytes);
+    LOCI_ASSERT(cur_bytes + (new_len - old_len) <= wbuf->alloc_bytes);
+
+    wbuf->current_bytes += (new_len - old_len); // may decrease size
+
+    if ((old_len + offset < cur_bytes) && (old_len != new_len)) {
+        /* Need to move back of buffer */
+        src_ptr = &wbuf->buf[offset + old_len];
+        dst_ptr = &wbuf->buf[offset + new_len];
+        bytes = cur_bytes - (offset + old_len);
+        MEMMOVE(dst_ptr, src_ptr, bytes);
+    }
+    LOCI_STATS_REPLACE_DATA(bytes);
+    LOCI_TRACE(replace_data, offset, old_len, new_len, bytes);
+
+    LOCI_ASSERT(wbuf->current_bytes == cur_bytes + (new_len - old_len));
+
+    return &wbuf->buf[offset];
+}
+
+/**
+ * Replace data in the data buffer, possibly with a new
+ * length or appending to buffer.
+ *
+ * @param wbuf The wire buffer being updated.
+ * @param offset The start point of the update
+ * @param old_len The number of bytes being replaced
+ * @param data Source of bytes to write into the buffer
+ * @param new_len The number of bytes to write
+ *
+ * The buffer may grow for this operation.  Current byte count
+ * is pre-grow for the replace.
+ *
+ * The current byte count for the buffer is updated.
+ * 
+ */
+
+void
+of_wire_buffer_replace_data(of_wire_buffer_t *wbuf, 
+                            int offset, 
+                            int old_len,
+                            uint8_t *data,
+                            int new_len)
+{
+    uint8_t *dst_ptr;
+
+    dst_ptr = of_wire_buffer_resize_data(wbuf, offset, old_len, new_len);
+    MEMCPY(dst_ptr, data, new_len);
+}
+""",
+                      done='\nof_wire_buffer_resize_data(')
+
+
+for name in sorted(glob.glob(regen.path('src/class*.c'))):
+    regen.rewrite(os.path.relpath(name, regen.LOCI), class_c)
+regen.rewrite('inc/loci/loci_classes.h', loci_classes_h)
+regen.rewrite('inc/loci/of_wire_buf.h', of_wire_buf_h)
+regen.rewrite('src/of_wire_buf.c', of_wire_buf_c)
@@ -0,0 +1,152 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Add the loci_stats.h hooks to the loxigen output.
+
+The hooks expand to nothing unless LOCI_STATS_ENABLE is defined:
+
+- of_<cls>_new and of_object_dup count an allocation;
+- of_object_delete counts a free and the parse functions a parse;
+- a full list counts a failed append;
+- of_wire_buffer_replace_data counts the bytes it moves;
+- each failure of the validator goes through VALIDATOR_FAIL, which
+  counts it by object and reason.
+"""
+
+import glob
+import os
+import re
+
+import regen
+
+NEW_RE = re.compile(r'^(    of_\w+_init\(obj, version, bytes, 0\);\n)'
+                    r'(?!    LOCI_(STATS_OBJECT_NEW|OBJECT_NEW_HOOK)\(obj\);)',
+                    re.M)
+
+
+def class_c(s):
+    return NEW_RE.sub(r'\1    LOCI_STATS_OBJECT_NEW(obj);\n', s)
+
+
+def loci_int_h(s):
+    return regen.insert_after(s, '#include <loci/loci.h>\n',
+                              '#include <loci/loci_stats.h>\n',
+                              done='#include <loci/loci_stats.h>\n')
+
+
+def of_object_c(s):
+    s = regen.insert_after(s, '#include <loci/loci_validator.h>\n',
+                           '#include <loci/loci_stats.h>\n',
+                           done='#include <loci/loci_stats.h>\n')
+    s = regen.insert_after(s, """\
+        return;
+    }
+
+""", """\
+    LOCI_STATS_FREE(obj->object_id);
+
+""", done='LOCI_STATS_FREE(')
+    s = regen.insert_after(s, """\
+    init_fn(dst, src->version, src->length, 0);
+""", """\
+    LOCI_STATS_OBJECT_NEW(dst);
+""")
+    s = regen.insert_after(s, """\
+    obj->version = version;
+
+    of_header_wire_object_id_get(obj, &object_id);
+    of_object_init_map[object_id](obj, version, len, 0);
+""", """\
+    LOCI_STATS_PARSE(object_id);
+    LOCI_STATS_ALLOC(object_id, sizeof(*obj) + sizeof(of_wire_buffer_t));
+""", done='LOCI_STATS_ALLOC(')
+    s = regen.insert_after(s, """\
+    wbuf->current_bytes = len;
+
+    of_header_wire_object_id_get(obj, &object_id);
+    of_object_init_map[object_id](obj, version, len, 0);
+""", """\
+    LOCI_STATS_PARSE(object_id);
+""")
+    for obj in ['parent', 'list']:
+        s = re.sub(r'(\n    if \(!of_object_can_grow\(%s, [^\n]*\) \{\n)'
+                   r'(?!        LOCI_STATS_LIST_APPEND_FAILURE)' % obj,
+                   r'\1        LOCI_STATS_LIST_APPEND_FAILURE(%s->object_id);\n'
+                   % obj, s)
+    return s
+
+
+def of_wire_buf_c(s):
+    s = regen.insert_after(s, '#include <loci/loci.h>\n',
+                           '#include <loci/loci_stats.h>\n',
+                           done='#include <loci/loci_stats.h>\n')
+    s = regen.edit(s, """\
+    int bytes;
+    uint8_t *src_ptr, *dst_ptr;
+""", """\
+    int bytes = 0;
+    uint8_t *src_ptr, *dst_ptr;
+""")
+    s = regen.insert_after(s, """\
+        MEMMOVE(dst_ptr, src_ptr, bytes);
+    }
+""", """\
+    LOCI_STATS_REPLACE_DATA(bytes);
+""", done='LOCI_STATS_REPLACE_DATA(')
+    return s
+
+
+VALIDATE_RE = re.compile(r'^loci_validate_(of_\w+)_OF_VERSION_1_\d\(')
+
+
+def validator_fail(s):
+    """Make every failure of a check a VALIDATOR_FAIL of its object."""
+    lines = s.split('\n')
+    object_id = None
+    for i, line in enumerate(lines):
+        m = VALIDATE_RE.match(line)
+        if m:
+            object_id = m.group(1).upper()
+        elif line == 'validate_message(of_message_t msg, int len)' or \
+                line == 'of_validate_message(of_message_t msg, int len)':
+            object_id = 'OF_HEADER'
+        if line != '        return -1;':
+            continue
+        cond = lines[i - 1].strip()
+        if 'loci_validate_' in cond:
+            # The failure of a member, already counted
+            continue
+        if cond.startswith('VALIDATOR_LOG("Bad version'):
+            reason = 'VERSION'
+        elif cond.startswith('if (len < '):
+            reason = 'SHORT'
+        else:
+            reason = 'LENGTH'
+        lines[i] = '        VALIDATOR_FAIL(%s, %s);' % (object_id, reason)
+    return '\n'.join(lines)
+
+
+def loci_validator_c(s):
+    s = regen.insert_after(s, '#include <loci/loci_validator.h>\n',
+                           '#include <loci/loci_stats.h>\n',
+                           done='#include <loci/loci_stats.h>\n')
+    s = regen.insert_after(s, """\
+#define VALIDATOR_LOG(...) LOCI_LOG_ERROR("Validator Error: " __VA_ARGS__)
+""", """
+#define VALIDATOR_FAIL(object_id, reason) do {                          \\
+        LOCI_STATS_VALIDATE_FAILURE(object_id, LOCI_STATS_VALIDATE_##reason); \\
+        return -1;                                                      \\
+    } while (0)
+""", done='#define VALIDATOR_FAIL(')
+    return validator_fail(s)
+
+
+for name in sorted(glob.glob(regen.path('src/class*.c')) +
+                   glob.glob(regen.path('src/of_list_*.c'))):
+    regen.rewrite(os.path.relpath(name, regen.LOCI), class_c)
+regen.rewrite('src/loci_int.h', loci_int_h)
+regen.rewrite('src/of_object.c', of_object_c)
+regen.rewrite('src/of_wire_buf.c', of_wire_buf_c)
+regen.rewrite('src/loci_validator.c', loci_validator_c)
@@ -0,0 +1,195 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Add the loci_trace.h probes to the loxigen output.
+
+Runs after patch_stats.py.  The probes expand to nothing unless
+LOCI_TRACE_ENABLE is defined:
+
+- of_<cls>_new calls LOCI_OBJECT_NEW_HOOK in place of the stats hook,
+  which also fires object_new, as of_object_dup does;
+- of_object_delete fires object_delete and the parse functions
+  new_from_message;
+- of_wire_buffer_replace_data fires replace_data;
+- VALIDATOR_FAIL fires validate_fail, and of_validate_message wraps
+  the generated validate_message to fire validate_message_fail;
+- of_match_serialize wraps the generated match_serialize to fire
+  match_serialize.
+"""
+
+import glob
+import os
+import re
+
+import regen
+
+TRACE_H = '#include <loci/loci_trace.h>\n'
+
+
+def include_trace(s):
+    return regen.insert_after(s, '#include <loci/loci_stats.h>\n', TRACE_H,
+                              done=TRACE_H)
+
+
+def class_c(s):
+    return re.sub(r'^(    of_\w+_init\(obj, version, bytes, 0\);\n)'
+                  r'    LOCI_STATS_OBJECT_NEW\(obj\);\n',
+                  r'\1    LOCI_OBJECT_NEW_HOOK(obj);\n', s, flags=re.M)
+
+
+def loci_int_h(s):
+    s = include_trace(s)
+    return regen.insert_after(s, """\
+#define UNREACHABLE()
+#endif
+
+""", """\
+/**
+ * Called by the generated of_<cls>_new functions once the new object
+ * has been initialized
+ */
+#define LOCI_OBJECT_NEW_HOOK(obj) do {          \\
+        LOCI_STATS_OBJECT_NEW(obj);             \\
+        LOCI_TRACE_OBJECT(object_new, obj);     \\
+    } while (0)
+
+""", done='#define LOCI_OBJECT_NEW_HOOK(')
+
+
+def of_object_c(s):
+    s = include_trace(s)
+    s = regen.insert_after(s, """\
+    LOCI_STATS_FREE(obj->object_id);
+""", """\
+    LOCI_TRACE_OBJECT(object_delete, obj);
+""")
+    s = regen.insert_after(s, """\
+    LOCI_STATS_OBJECT_NEW(dst);
+""", """\
+    LOCI_TRACE_OBJECT(object_new, dst);
+""")
+    return regen.insert_after(s, """\
+    of_object_init_map[object_id](obj, version, len, 0);
+    LOCI_STATS_PARSE(object_id);
+""", """\
+    LOCI_TRACE_OBJECT(new_from_message, obj);
+""", count=2)
+
+
+def of_wire_buf_c(s):
+    s = include_trace(s)
+    return regen.insert_after(s, """\
+    LOCI_STATS_REPLACE_DATA(bytes);
+""", """\
+    LOCI_TRACE(replace_data, offset, old_len, new_len, bytes);
+""")
+
+
+def loci_validator_c(s):
+    s = include_trace(s)
+    s = regen.insert_after(s, """\
+        LOCI_STATS_VALIDATE_FAILURE(object_id, LOCI_STATS_VALIDATE_##reason); \\
+""", """\
+        LOCI_TRACE(validate_fail, object_id, LOCI_STATS_VALIDATE_##reason, len); \\
+""")
+    s = regen.edit(s, """
+int
+of_validate_message(of_message_t msg, int len)
+{
+    of_version_t version;
+""", """
+static int
+validate_message(of_message_t msg, int len)
+{
+    of_version_t version;
+""")
+    # Only the bytes len covers are read, however short
+    wrapper = """
+int
+of_validate_message(of_message_t msg, int len)
+{
+    int rv;
+
+    rv = validate_message(msg, len);
+    if (rv < 0) {
+        LOCI_TRACE(validate_message_fail,
+                   len >= 1 ? of_message_version_get(msg) : 0,
+                   len >= OF_MESSAGE_MIN_LENGTH ? of_message_type_get(msg) : -1,
+                   len,
+                   len >= OF_MESSAGE_MIN_LENGTH ? of_message_xid_get(msg) : 0);
+    }
+
+    return rv;
+}
+"""
+    s = s.replace(wrapper.replace(
+        'validate_message_fail,\n                   len >= 1 ? '
+        'of_message_version_get(msg) : 0,',
+        'validate_message_fail, of_message_version_get(msg),'), wrapper)
+    if wrapper not in s:
+        s += wrapper
+    return s
+
+
+SERIALIZE_DOC = """\
+/**
+ * Serialize a match structure according to the version passed
+ * @param version The version to use for serialization protocol
+ * @param match Pointer to the structure to serialize
+ * @param octets Pointer to an octets object to fill out
+ *
+ * A buffer is allocated using normal internal ALLOC/FREE semantics
+ * and pointed to by the octets object.  The length of the resulting
+ * serialization is in octets->bytes.
+ *
+ * For 1.2 matches, returns the padded serialized structure
+ *
+ * Note that FREE must be called on octets->data when processing of
+ * the object is complete.
+ */
+
+"""
+
+
+def of_match_c(s):
+    s = regen.insert_after(s, '#include <loci/loci.h>\n', TRACE_H,
+                           done=TRACE_H)
+    s = regen.edit(s, SERIALIZE_DOC + """\
+int
+of_match_serialize(of_version_t version, of_match_t *match, of_octets_t *octets)
+{
+    int rv;
+""", """\
+static int
+match_serialize(of_version_t version, of_match_t *match, of_octets_t *octets)
+{
+    int rv;
+""")
+    # The wrapper goes after match_serialize, before the next doc comment
+    start = s.index('\nmatch_serialize(of_version_t version')
+    end = s.index('\n}\n', start) + len('\n}\n')
+    return regen.insert_after(s, s[start:end] + '\n', SERIALIZE_DOC + """\
+int
+of_match_serialize(of_version_t version, of_match_t *match, of_octets_t *octets)
+{
+    int rv;
+
+    rv = match_serialize(version, match, octets);
+    LOCI_TRACE(match_serialize, version, rv < 0 ? 0 : octets->bytes, rv);
+
+    return rv;
+}
+
+""")
+
+
+for name in sorted(glob.glob(regen.path('src/class*.c')) +
+                   glob.glob(regen.path('src/of_list_*.c'))):
+    regen.rewrite(os.path.relpath(name, regen.LOCI), class_c)
+regen.rewrite('src/loci_int.h', loci_int_h)
+regen.rewrite('src/of_object.c', of_object_c)
+regen.rewrite('src/of_wire_buf.c', of_wire_buf_c)
+regen.rewrite('src/loci_validator.c', loci_validator_c)
+regen.rewrite('src/of_match.c', of_match_c)
@@ -0,0 +1,67 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Helpers shared by the scripts that regenerate LOCI.
+
+Each script works on the LOCI tree above this directory, or on the one
+given as its only argument.  Files are only rewritten when their
+contents change, and every script may be run again on its own output.
+"""
+
+import os
+import sys
+
+LOCI = os.path.normpath(sys.argv[1] if len(sys.argv) > 1 else
+                        os.path.join(os.path.dirname(__file__), '..'))
+
+COPYRIGHT = """\
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+"""
+
+
+def path(name):
+    """Return the path of a file given relative to the LOCI tree."""
+    return os.path.join(LOCI, name)
+
+
+def read(name):
+    with open(path(name)) as f:
+        return f.read()
+
+
+def write(name, text):
+    """Write a file of the LOCI tree if its contents differ."""
+    if os.path.exists(path(name)) and read(name) == text:
+        return
+    with open(path(name), 'w') as f:
+        f.write(text)
+
+
+def rewrite(name, fn):
+    """Pass the contents of a file through fn and write the result."""
+    write(name, fn(read(name)))
+
+
+
+def edit(text, old, new, done=None, count=1):
+    """Replace old with new in text, unless already done.
+
+    The edit is taken as done if done, by default new, is in text.
+    Otherwise old must be in text count times.
+    """
+    if (done or new) in text:
+        return text
+    if text.count(old) != count:
+        raise Exception('expected %d of %r, found %d' %
+                        (count, old, text.count(old)))
+    return text.replace(old, new)
+
+
+def insert_after(text, anchor, lines, done=None, count=1):
+    """Insert lines after each anchor, unless already done."""
+    return edit(text, anchor, anchor + lines, done or anchor + lines, count)
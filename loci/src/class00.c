@@ -379,6 +379,7 @@ of_action_new(of_version_t version)
     }
 
     of_action_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -579,6 +580,7 @@ of_action_experimenter_new(of_version_t version)
     }
 
     of_action_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -799,6 +801,9 @@ of_action_experimenter_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -813,6 +818,75 @@ of_action_experimenter_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_action_experimenter.
+ * @param obj Pointer to an object of type of_action_experimenter.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_action_experimenter_data_reserve(
+    of_action_experimenter_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_ACTION_EXPERIMENTER);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 8;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -981,6 +1055,7 @@ of_action_bsn_new(of_version_t version)
     }
 
     of_action_bsn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1278,6 +1353,7 @@ of_action_bsn_checksum_new(of_version_t version)
     }
 
     of_action_bsn_checksum_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_bsn_checksum_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1663,6 +1739,7 @@ of_action_bsn_mirror_new(of_version_t version)
     }
 
     of_action_bsn_mirror_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_bsn_mirror_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2220,6 +2297,7 @@ of_action_bsn_set_tunnel_dst_new(of_version_t version)
     }
 
     of_action_bsn_set_tunnel_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_bsn_set_tunnel_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2599,6 +2677,7 @@ of_action_enqueue_new(of_version_t version)
     }
 
     of_action_enqueue_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_enqueue_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3009,6 +3088,7 @@ of_action_nicira_new(of_version_t version)
     }
 
     of_action_nicira_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3306,6 +3386,7 @@ of_action_nicira_dec_ttl_new(of_version_t version)
     }
 
     of_action_nicira_dec_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_nicira_dec_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3605,6 +3686,7 @@ of_action_nicira_move_new(of_version_t version)
     }
 
     of_action_nicira_move_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_nicira_move_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4334,6 +4416,7 @@ of_action_nicira_pop_nsh_new(of_version_t version)
     }
 
     of_action_nicira_pop_nsh_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_nicira_pop_nsh_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4633,6 +4716,7 @@ of_action_nicira_push_nsh_new(of_version_t version)
     }
 
     of_action_nicira_push_nsh_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_nicira_push_nsh_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4932,6 +5016,7 @@ of_action_nicira_resubmit_new(of_version_t version)
     }
 
     of_action_nicira_resubmit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_nicira_resubmit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5403,6 +5488,7 @@ of_action_nicira_resubmit_table_new(of_version_t version)
     }
 
     of_action_nicira_resubmit_table_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_nicira_resubmit_table_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5872,6 +5958,7 @@ of_action_output_new(of_version_t version)
     }
 
     of_action_output_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_output_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6177,6 +6264,7 @@ of_action_set_dl_dst_new(of_version_t version)
     }
 
     of_action_set_dl_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_dl_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6381,6 +6469,7 @@ of_action_set_dl_src_new(of_version_t version)
     }
 
     of_action_set_dl_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_dl_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6585,6 +6674,7 @@ of_action_set_nw_dst_new(of_version_t version)
     }
 
     of_action_set_nw_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_nw_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6789,6 +6879,7 @@ of_action_set_nw_src_new(of_version_t version)
     }
 
     of_action_set_nw_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_nw_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6993,6 +7084,7 @@ of_action_set_nw_tos_new(of_version_t version)
     }
 
     of_action_set_nw_tos_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_nw_tos_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7195,6 +7287,7 @@ of_action_set_tp_dst_new(of_version_t version)
     }
 
     of_action_set_tp_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_tp_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7397,6 +7490,7 @@ of_action_set_tp_src_new(of_version_t version)
     }
 
     of_action_set_tp_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_tp_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7599,6 +7693,7 @@ of_action_set_vlan_pcp_new(of_version_t version)
     }
 
     of_action_set_vlan_pcp_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_vlan_pcp_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7801,6 +7896,7 @@ of_action_set_vlan_vid_new(of_version_t version)
     }
 
     of_action_set_vlan_vid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_vlan_vid_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8002,6 +8098,7 @@ of_action_strip_vlan_new(of_version_t version)
     }
 
     of_action_strip_vlan_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_strip_vlan_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8573,6 +8670,7 @@ of_header_new(of_version_t version)
     }
 
     of_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -8994,6 +9092,7 @@ of_stats_reply_new(of_version_t version)
     }
 
     of_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -9295,6 +9394,7 @@ of_aggregate_stats_reply_new(of_version_t version)
     }
 
     of_aggregate_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_aggregate_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10074,6 +10174,7 @@ of_stats_request_new(of_version_t version)
     }
 
     of_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -10375,6 +10476,7 @@ of_aggregate_stats_request_new(of_version_t version)
     }
 
     of_aggregate_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_aggregate_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11143,6 +11245,10 @@ of_aggregate_stats_request_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -11469,6 +11575,7 @@ of_error_msg_new(of_version_t version)
     }
 
     of_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -11680,6 +11787,7 @@ of_bad_action_error_msg_new(of_version_t version)
     }
 
     of_bad_action_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bad_action_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11988,6 +12096,9 @@ of_bad_action_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -12002,3 +12113,72 @@ of_bad_action_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bad_action_error_msg.
+ * @param obj Pointer to an object of type of_bad_action_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bad_action_error_msg_data_reserve(
+    of_bad_action_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BAD_ACTION_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
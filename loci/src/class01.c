@@ -79,6 +79,7 @@ of_bad_request_error_msg_new(of_version_t version)
     }
 
     of_bad_request_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bad_request_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -387,6 +388,9 @@ of_bad_request_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -401,6 +405,75 @@ of_bad_request_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bad_request_error_msg.
+ * @param obj Pointer to an object of type of_bad_request_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bad_request_error_msg_data_reserve(
+    of_bad_request_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BAD_REQUEST_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -484,6 +557,7 @@ of_barrier_reply_new(of_version_t version)
     }
 
     of_barrier_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_barrier_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -699,6 +773,7 @@ of_barrier_request_new(of_version_t version)
     }
 
     of_barrier_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_barrier_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -990,6 +1065,7 @@ of_experimenter_new(of_version_t version)
     }
 
     of_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1384,6 +1460,9 @@ of_experimenter_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -1398,6 +1477,78 @@ of_experimenter_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_experimenter.
+ * @param obj Pointer to an object of type of_experimenter.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_experimenter_data_reserve(
+    of_experimenter_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 16;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -2079,6 +2230,7 @@ of_bsn_header_new(of_version_t version)
     }
 
     of_bsn_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2463,6 +2615,7 @@ of_bsn_bw_clear_data_reply_new(of_version_t version)
     }
 
     of_bsn_bw_clear_data_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_bw_clear_data_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2935,6 +3088,7 @@ of_bsn_bw_clear_data_request_new(of_version_t version)
     }
 
     of_bsn_bw_clear_data_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_bw_clear_data_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3321,6 +3475,7 @@ of_bsn_bw_enable_get_reply_new(of_version_t version)
     }
 
     of_bsn_bw_enable_get_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_bw_enable_get_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3793,6 +3948,7 @@ of_bsn_bw_enable_get_request_new(of_version_t version)
     }
 
     of_bsn_bw_enable_get_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_bw_enable_get_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4179,6 +4335,7 @@ of_bsn_bw_enable_set_reply_new(of_version_t version)
     }
 
     of_bsn_bw_enable_set_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_bw_enable_set_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4737,6 +4894,7 @@ of_bsn_bw_enable_set_request_new(of_version_t version)
     }
 
     of_bsn_bw_enable_set_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_bw_enable_set_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5209,6 +5367,7 @@ of_bsn_get_interfaces_reply_new(of_version_t version)
     }
 
     of_bsn_get_interfaces_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_interfaces_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5645,6 +5804,10 @@ of_bsn_get_interfaces_reply_interfaces_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(interfaces, 0), new_len);
@@ -5745,6 +5908,7 @@ of_bsn_get_interfaces_request_new(of_version_t version)
     }
 
     of_bsn_get_interfaces_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_interfaces_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6127,6 +6291,7 @@ of_bsn_get_ip_mask_reply_new(of_version_t version)
     }
 
     of_bsn_get_ip_mask_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_ip_mask_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6641,6 +6806,7 @@ of_bsn_get_ip_mask_request_new(of_version_t version)
     }
 
     of_bsn_get_ip_mask_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_ip_mask_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7077,6 +7243,7 @@ of_bsn_get_l2_table_reply_new(of_version_t version)
     }
 
     of_bsn_get_l2_table_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_l2_table_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7591,6 +7758,7 @@ of_bsn_get_l2_table_request_new(of_version_t version)
     }
 
     of_bsn_get_l2_table_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_l2_table_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7953,6 +8121,7 @@ of_bsn_get_mirroring_reply_new(of_version_t version)
     }
 
     of_bsn_get_mirroring_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_mirroring_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8425,6 +8594,7 @@ of_bsn_get_mirroring_request_new(of_version_t version)
     }
 
     of_bsn_get_mirroring_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_get_mirroring_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8893,6 +9063,7 @@ of_bsn_hybrid_get_reply_new(of_version_t version)
     }
 
     of_bsn_hybrid_get_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_hybrid_get_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9407,6 +9578,7 @@ of_bsn_hybrid_get_request_new(of_version_t version)
     }
 
     of_bsn_hybrid_get_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_hybrid_get_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9749,6 +9921,7 @@ of_bsn_interface_new(of_version_t version)
     }
 
     of_bsn_interface_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -10219,6 +10392,7 @@ of_bsn_pdu_rx_reply_new(of_version_t version)
     }
 
     of_bsn_pdu_rx_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_pdu_rx_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10872,6 +11046,7 @@ of_bsn_pdu_rx_request_new(of_version_t version)
     }
 
     of_bsn_pdu_rx_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_pdu_rx_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11539,6 +11714,9 @@ of_bsn_pdu_rx_request_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -11553,6 +11731,78 @@ of_bsn_pdu_rx_request_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bsn_pdu_rx_request.
+ * @param obj Pointer to an object of type of_bsn_pdu_rx_request.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_pdu_rx_request_data_reserve(
+    of_bsn_pdu_rx_request_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+        offset = 26;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 28;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -11635,6 +11885,7 @@ of_bsn_pdu_rx_timeout_new(of_version_t version)
     }
 
     of_bsn_pdu_rx_timeout_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_pdu_rx_timeout_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12202,6 +12453,7 @@ of_bsn_pdu_tx_reply_new(of_version_t version)
     }
 
     of_bsn_pdu_tx_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_pdu_tx_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12855,6 +13107,7 @@ of_bsn_pdu_tx_request_new(of_version_t version)
     }
 
     of_bsn_pdu_tx_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_pdu_tx_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -13522,6 +13775,9 @@ of_bsn_pdu_tx_request_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -13536,6 +13792,78 @@ of_bsn_pdu_tx_request_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bsn_pdu_tx_request.
+ * @param obj Pointer to an object of type of_bsn_pdu_tx_request.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_pdu_tx_request_data_reserve(
+    of_bsn_pdu_tx_request_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+        offset = 26;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 28;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -13614,6 +13942,7 @@ of_bsn_set_ip_mask_new(of_version_t version)
     }
 
     of_bsn_set_ip_mask_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_set_ip_mask_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -14128,6 +14457,7 @@ of_bsn_set_l2_table_reply_new(of_version_t version)
     }
 
     of_bsn_set_l2_table_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_set_l2_table_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -14720,6 +15050,7 @@ of_bsn_set_l2_table_request_new(of_version_t version)
     }
 
     of_bsn_set_l2_table_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_set_l2_table_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -15238,6 +15569,7 @@ of_bsn_set_mirroring_new(of_version_t version)
     }
 
     of_bsn_set_mirroring_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_set_mirroring_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -15710,6 +16042,7 @@ of_bsn_set_pktin_suppression_reply_new(of_version_t version)
     }
 
     of_bsn_set_pktin_suppression_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_set_pktin_suppression_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -80,6 +80,7 @@ of_bsn_set_pktin_suppression_request_new(of_version_t version)
     }
 
     of_bsn_set_pktin_suppression_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_set_pktin_suppression_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -892,6 +893,7 @@ of_bsn_shell_command_new(of_version_t version)
     }
 
     of_bsn_shell_command_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_shell_command_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1332,6 +1334,9 @@ of_bsn_shell_command_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -1346,6 +1351,71 @@ of_bsn_shell_command_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bsn_shell_command.
+ * @param obj Pointer to an object of type of_bsn_shell_command.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_shell_command_data_reserve(
+    of_bsn_shell_command_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+        offset = 20;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -1424,6 +1494,7 @@ of_bsn_shell_output_new(of_version_t version)
     }
 
     of_bsn_shell_output_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_shell_output_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1786,6 +1857,9 @@ of_bsn_shell_output_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -1800,6 +1874,71 @@ of_bsn_shell_output_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bsn_shell_output.
+ * @param obj Pointer to an object of type of_bsn_shell_output.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_shell_output_data_reserve(
+    of_bsn_shell_output_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+        offset = 16;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -1878,6 +2017,7 @@ of_bsn_shell_status_new(of_version_t version)
     }
 
     of_bsn_shell_status_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_shell_status_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2383,6 +2523,7 @@ of_experimenter_stats_reply_new(of_version_t version)
     }
 
     of_experimenter_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2863,6 +3004,9 @@ of_experimenter_stats_reply_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -2877,6 +3021,76 @@ of_experimenter_stats_reply_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_experimenter_stats_reply.
+ * @param obj Pointer to an object of type of_experimenter_stats_reply.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_experimenter_stats_reply_data_reserve(
+    of_experimenter_stats_reply_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+        offset = 16;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+        offset = 24;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -3090,6 +3304,7 @@ of_bsn_stats_reply_new(of_version_t version)
     }
 
     of_bsn_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3625,6 +3840,7 @@ of_experimenter_stats_request_new(of_version_t version)
     }
 
     of_experimenter_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4105,6 +4321,9 @@ of_experimenter_stats_request_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -4119,6 +4338,76 @@ of_experimenter_stats_request_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_experimenter_stats_request.
+ * @param obj Pointer to an object of type of_experimenter_stats_request.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_experimenter_stats_request_data_reserve(
+    of_experimenter_stats_request_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+        offset = 16;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+        offset = 24;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -4332,6 +4621,7 @@ of_bsn_stats_request_new(of_version_t version)
     }
 
     of_bsn_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4802,6 +5092,7 @@ of_bsn_virtual_port_create_reply_new(of_version_t version)
     }
 
     of_bsn_virtual_port_create_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_virtual_port_create_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5425,6 +5716,7 @@ of_bsn_vport_new(of_version_t version)
     }
 
     of_bsn_vport_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5551,6 +5843,7 @@ of_bsn_virtual_port_create_request_new(of_version_t version)
     }
 
     of_bsn_virtual_port_create_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_virtual_port_create_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5988,6 +6281,10 @@ of_bsn_virtual_port_create_request_vport_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(vport, 0), new_len);
@@ -6088,6 +6385,7 @@ of_bsn_virtual_port_remove_reply_new(of_version_t version)
     }
 
     of_bsn_virtual_port_remove_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_virtual_port_remove_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6560,6 +6858,7 @@ of_bsn_virtual_port_remove_request_new(of_version_t version)
     }
 
     of_bsn_virtual_port_remove_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_virtual_port_remove_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7029,6 +7328,7 @@ of_bsn_vport_l2gre_new(of_version_t version)
     }
 
     of_bsn_vport_l2gre_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_vport_l2gre_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8232,6 +8532,7 @@ of_bsn_vport_q_in_q_new(of_version_t version)
     }
 
     of_bsn_vport_q_in_q_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_vport_q_in_q_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8879,6 +9180,7 @@ of_desc_stats_reply_new(of_version_t version)
     }
 
     of_desc_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_desc_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9632,6 +9934,7 @@ of_desc_stats_request_new(of_version_t version)
     }
 
     of_desc_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_desc_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9930,6 +10233,7 @@ of_echo_reply_new(of_version_t version)
     }
 
     of_echo_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_echo_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10152,6 +10456,9 @@ of_echo_reply_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -10166,6 +10473,75 @@ of_echo_reply_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_echo_reply.
+ * @param obj Pointer to an object of type of_echo_reply.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_echo_reply_data_reserve(
+    of_echo_reply_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_ECHO_REPLY);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 8;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -10246,6 +10622,7 @@ of_echo_request_new(of_version_t version)
     }
 
     of_echo_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_echo_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10468,6 +10845,9 @@ of_echo_request_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -10482,6 +10862,75 @@ of_echo_request_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_echo_request.
+ * @param obj Pointer to an object of type of_echo_request.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_echo_request_data_reserve(
+    of_echo_request_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_ECHO_REQUEST);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 8;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -10562,6 +11011,7 @@ of_features_reply_new(of_version_t version)
     }
 
     of_features_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_features_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11330,6 +11780,10 @@ of_features_reply_ports_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(ports, 0), new_len);
@@ -11506,6 +11960,7 @@ of_features_request_new(of_version_t version)
     }
 
     of_features_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_features_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11830,6 +12285,7 @@ of_flow_mod_new(of_version_t version)
     }
 
     of_flow_mod_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     /* Initialize match TLV for 1.2 */
     if ((version >= OF_VERSION_1_2)) {
@@ -12960,6 +13416,10 @@ of_flow_mod_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -13113,6 +13573,10 @@ of_flow_mod_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -13255,6 +13719,10 @@ of_flow_mod_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -13358,6 +13826,7 @@ of_flow_add_new(of_version_t version)
     }
 
     of_flow_add_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_add_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -14568,6 +15037,10 @@ of_flow_add_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -14721,6 +15194,10 @@ of_flow_add_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -14863,6 +15340,10 @@ of_flow_add_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -14966,6 +15447,7 @@ of_flow_delete_new(of_version_t version)
     }
 
     of_flow_delete_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_delete_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -16176,6 +16658,10 @@ of_flow_delete_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -16329,6 +16815,10 @@ of_flow_delete_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -16471,6 +16961,10 @@ of_flow_delete_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -16574,6 +17068,7 @@ of_flow_delete_strict_new(of_version_t version)
     }
 
     of_flow_delete_strict_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_delete_strict_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -17784,6 +18279,10 @@ of_flow_delete_strict_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -17937,6 +18436,10 @@ of_flow_delete_strict_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -18079,6 +18582,10 @@ of_flow_delete_strict_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -18182,6 +18689,7 @@ of_flow_mod_failed_error_msg_new(of_version_t version)
     }
 
     of_flow_mod_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_mod_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -18490,6 +18998,9 @@ of_flow_mod_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -18504,6 +19015,75 @@ of_flow_mod_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_flow_mod_failed_error_msg.
+ * @param obj Pointer to an object of type of_flow_mod_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_flow_mod_failed_error_msg_data_reserve(
+    of_flow_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_FLOW_MOD_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -18589,6 +19169,7 @@ of_flow_modify_new(of_version_t version)
     }
 
     of_flow_modify_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_modify_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -19799,6 +20380,10 @@ of_flow_modify_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -19952,6 +20537,10 @@ of_flow_modify_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -20094,6 +20683,10 @@ of_flow_modify_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -20197,6 +20790,7 @@ of_flow_modify_strict_new(of_version_t version)
     }
 
     of_flow_modify_strict_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_modify_strict_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -21407,6 +22001,10 @@ of_flow_modify_strict_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -21560,6 +22158,10 @@ of_flow_modify_strict_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -21702,6 +22304,10 @@ of_flow_modify_strict_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -21800,6 +22406,7 @@ of_flow_removed_new(of_version_t version)
     }
 
     of_flow_removed_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_removed_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -22935,6 +23542,10 @@ of_flow_removed_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -23014,6 +23625,7 @@ of_flow_stats_entry_new(of_version_t version)
     }
 
     of_flow_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     /* Initialize match TLV for 1.2 */
@@ -24140,6 +24752,10 @@ of_flow_stats_entry_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -24293,6 +24909,10 @@ of_flow_stats_entry_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -24435,6 +25055,10 @@ of_flow_stats_entry_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -24538,6 +25162,7 @@ of_flow_stats_reply_new(of_version_t version)
     }
 
     of_flow_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -24894,6 +25519,10 @@ of_flow_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -24997,6 +25626,7 @@ of_flow_stats_request_new(of_version_t version)
     }
 
     of_flow_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -25765,6 +26395,10 @@ of_flow_stats_request_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
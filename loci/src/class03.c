@@ -78,6 +78,7 @@ of_get_config_reply_new(of_version_t version)
     }
 
     of_get_config_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_get_config_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -462,6 +463,7 @@ of_get_config_request_new(of_version_t version)
     }
 
     of_get_config_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_get_config_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -674,6 +676,7 @@ of_hello_new(of_version_t version)
     }
 
     of_hello_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_hello_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -932,6 +935,10 @@ of_hello_elements_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(elements, 0), new_len);
@@ -1031,6 +1038,7 @@ of_hello_failed_error_msg_new(of_version_t version)
     }
 
     of_hello_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_hello_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1339,6 +1347,9 @@ of_hello_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -1353,6 +1364,75 @@ of_hello_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_hello_failed_error_msg.
+ * @param obj Pointer to an object of type of_hello_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_hello_failed_error_msg_data_reserve(
+    of_hello_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_HELLO_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -1415,6 +1495,7 @@ of_match_v1_new(of_version_t version)
     }
 
     of_match_v1_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2597,6 +2678,7 @@ of_nicira_header_new(of_version_t version)
     }
 
     of_nicira_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2977,6 +3059,7 @@ of_nicira_controller_role_reply_new(of_version_t version)
     }
 
     of_nicira_controller_role_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_nicira_controller_role_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3413,6 +3496,7 @@ of_nicira_controller_role_request_new(of_version_t version)
     }
 
     of_nicira_controller_role_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_nicira_controller_role_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3851,6 +3935,7 @@ of_packet_in_new(of_version_t version)
     }
 
     of_packet_in_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_packet_in_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4532,6 +4617,10 @@ of_packet_in_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -4651,6 +4740,9 @@ of_packet_in_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -4666,6 +4758,81 @@ of_packet_in_data_set(
     return OF_ERROR_NONE;
 }
 
+/**
+ * Reserve space for data in an object of type of_packet_in.
+ * @param obj Pointer to an object of type of_packet_in.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_packet_in_data_reserve(
+    of_packet_in_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+        offset = 18;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    case OF_VERSION_1_1:
+        offset = 24;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = _PACKET_IN_DATA_OFFSET(obj);
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
+
 /**
  * Get in_port from an object of type of_packet_in.
  * @param obj Pointer to an object of type of_packet_in.
@@ -4909,6 +5076,7 @@ of_packet_out_new(of_version_t version)
     }
 
     of_packet_out_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_packet_out_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5356,6 +5524,10 @@ of_packet_out_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -5464,6 +5636,9 @@ of_packet_out_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -5478,6 +5653,75 @@ of_packet_out_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_packet_out.
+ * @param obj Pointer to an object of type of_packet_out.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_packet_out_data_reserve(
+    of_packet_out_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = _PACKET_OUT_DATA_OFFSET(obj);
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -5540,6 +5784,7 @@ of_packet_queue_new(of_version_t version)
     }
 
     of_packet_queue_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_packet_queue_wire_length_set(obj, obj->length);
 
     return obj;
@@ -5892,6 +6137,10 @@ of_packet_queue_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -5972,6 +6221,7 @@ of_port_desc_new(of_version_t version)
     }
 
     of_port_desc_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_wire_length_set(obj, obj->length);
 
     return obj;
@@ -6592,6 +6842,10 @@ of_port_desc_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -7209,6 +7463,7 @@ of_port_mod_new(of_version_t version)
     }
 
     of_port_mod_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_mod_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7826,6 +8081,10 @@ of_port_mod_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -8017,6 +8276,7 @@ of_port_mod_failed_error_msg_new(of_version_t version)
     }
 
     of_port_mod_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_mod_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8325,6 +8585,9 @@ of_port_mod_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -8339,6 +8602,75 @@ of_port_mod_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_port_mod_failed_error_msg.
+ * @param obj Pointer to an object of type of_port_mod_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_port_mod_failed_error_msg_data_reserve(
+    of_port_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_PORT_MOD_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -8401,6 +8733,7 @@ of_port_stats_entry_new(of_version_t version)
     }
 
     of_port_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_stats_entry_wire_length_set(obj, obj->length);
 
     return obj;
@@ -9553,6 +9886,10 @@ of_port_stats_entry_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -9992,6 +10329,7 @@ of_port_stats_reply_new(of_version_t version)
     }
 
     of_port_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10348,6 +10686,10 @@ of_port_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -10451,6 +10793,7 @@ of_port_stats_request_new(of_version_t version)
     }
 
     of_port_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10840,6 +11183,7 @@ of_port_status_new(of_version_t version)
     }
 
     of_port_status_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_status_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11202,6 +11546,10 @@ of_port_status_desc_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(desc, 0), new_len);
@@ -11302,6 +11650,7 @@ of_queue_get_config_reply_new(of_version_t version)
     }
 
     of_queue_get_config_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_get_config_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11651,6 +12000,10 @@ of_queue_get_config_reply_queues_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(queues, 0), new_len);
@@ -11751,6 +12104,7 @@ of_queue_get_config_request_new(of_version_t version)
     }
 
     of_queue_get_config_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_get_config_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12055,6 +12409,7 @@ of_queue_op_failed_error_msg_new(of_version_t version)
     }
 
     of_queue_op_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_op_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12363,6 +12718,9 @@ of_queue_op_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -12377,6 +12735,75 @@ of_queue_op_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_queue_op_failed_error_msg.
+ * @param obj Pointer to an object of type of_queue_op_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_queue_op_failed_error_msg_data_reserve(
+    of_queue_op_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_QUEUE_OP_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_0:
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -12527,6 +12954,7 @@ of_queue_prop_new(of_version_t version)
     }
 
     of_queue_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -12650,6 +13078,7 @@ of_queue_prop_min_rate_new(of_version_t version)
     }
 
     of_queue_prop_min_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_prop_min_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -12844,6 +13273,7 @@ of_queue_stats_entry_new(of_version_t version)
     }
 
     of_queue_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_stats_entry_wire_length_set(obj, obj->length);
 
     return obj;
@@ -13636,6 +14066,10 @@ of_queue_stats_entry_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -13739,6 +14173,7 @@ of_queue_stats_reply_new(of_version_t version)
     }
 
     of_queue_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -14095,6 +14530,10 @@ of_queue_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -14198,6 +14637,7 @@ of_queue_stats_request_new(of_version_t version)
     }
 
     of_queue_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -14677,6 +15117,7 @@ of_set_config_new(of_version_t version)
     }
 
     of_set_config_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_set_config_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -15064,6 +15505,7 @@ of_table_mod_new(of_version_t version)
     }
 
     of_table_mod_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_mod_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -15492,6 +15934,10 @@ of_table_mod_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -15572,6 +16018,7 @@ of_table_stats_entry_new(of_version_t version)
     }
 
     of_table_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -17079,6 +17526,7 @@ of_table_stats_reply_new(of_version_t version)
     }
 
     of_table_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -17435,6 +17883,10 @@ of_table_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -17538,6 +17990,7 @@ of_table_stats_request_new(of_version_t version)
     }
 
     of_table_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -17834,6 +18287,7 @@ of_action_copy_ttl_in_new(of_version_t version)
     }
 
     of_action_copy_ttl_in_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_copy_ttl_in_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
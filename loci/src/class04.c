@@ -76,6 +76,7 @@ of_action_copy_ttl_out_new(of_version_t version)
     }
 
     of_action_copy_ttl_out_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_copy_ttl_out_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -200,6 +201,7 @@ of_action_dec_mpls_ttl_new(of_version_t version)
     }
 
     of_action_dec_mpls_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_dec_mpls_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -324,6 +326,7 @@ of_action_dec_nw_ttl_new(of_version_t version)
     }
 
     of_action_dec_nw_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_dec_nw_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -448,6 +451,7 @@ of_action_group_new(of_version_t version)
     }
 
     of_action_group_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_group_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -656,6 +660,7 @@ of_action_pop_mpls_new(of_version_t version)
     }
 
     of_action_pop_mpls_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_pop_mpls_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -864,6 +869,7 @@ of_action_pop_vlan_new(of_version_t version)
     }
 
     of_action_pop_vlan_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_pop_vlan_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -988,6 +994,7 @@ of_action_push_mpls_new(of_version_t version)
     }
 
     of_action_push_mpls_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_push_mpls_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1196,6 +1203,7 @@ of_action_push_vlan_new(of_version_t version)
     }
 
     of_action_push_vlan_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_push_vlan_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1401,6 +1409,7 @@ of_action_set_mpls_label_new(of_version_t version)
     }
 
     of_action_set_mpls_label_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_mpls_label_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1600,6 +1609,7 @@ of_action_set_mpls_tc_new(of_version_t version)
     }
 
     of_action_set_mpls_tc_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_mpls_tc_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1802,6 +1812,7 @@ of_action_set_mpls_ttl_new(of_version_t version)
     }
 
     of_action_set_mpls_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_mpls_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2007,6 +2018,7 @@ of_action_set_nw_ecn_new(of_version_t version)
     }
 
     of_action_set_nw_ecn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_nw_ecn_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2209,6 +2221,7 @@ of_action_set_nw_ttl_new(of_version_t version)
     }
 
     of_action_set_nw_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_nw_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2417,6 +2430,7 @@ of_action_set_queue_new(of_version_t version)
     }
 
     of_action_set_queue_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_queue_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2627,6 +2641,7 @@ of_bad_instruction_error_msg_new(of_version_t version)
     }
 
     of_bad_instruction_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bad_instruction_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2929,6 +2944,9 @@ of_bad_instruction_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -2943,6 +2961,74 @@ of_bad_instruction_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bad_instruction_error_msg.
+ * @param obj Pointer to an object of type of_bad_instruction_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bad_instruction_error_msg_data_reserve(
+    of_bad_instruction_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BAD_INSTRUCTION_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -3023,6 +3109,7 @@ of_bad_match_error_msg_new(of_version_t version)
     }
 
     of_bad_match_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bad_match_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3325,6 +3412,9 @@ of_bad_match_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -3339,6 +3429,74 @@ of_bad_match_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bad_match_error_msg.
+ * @param obj Pointer to an object of type of_bad_match_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bad_match_error_msg_data_reserve(
+    of_bad_match_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BAD_MATCH_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -3401,6 +3559,7 @@ of_bucket_new(of_version_t version)
     }
 
     of_bucket_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -3829,6 +3988,10 @@ of_bucket_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -3909,6 +4072,7 @@ of_bucket_counter_new(of_version_t version)
     }
 
     of_bucket_counter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4265,6 +4429,7 @@ of_group_mod_new(of_version_t version)
     }
 
     of_group_mod_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4691,6 +4856,10 @@ of_group_mod_buckets_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(buckets, 0), new_len);
@@ -4789,6 +4958,7 @@ of_group_add_new(of_version_t version)
     }
 
     of_group_add_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_add_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5217,6 +5387,10 @@ of_group_add_buckets_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(buckets, 0), new_len);
@@ -5315,6 +5489,7 @@ of_group_delete_new(of_version_t version)
     }
 
     of_group_delete_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_delete_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5743,6 +5918,10 @@ of_group_delete_buckets_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(buckets, 0), new_len);
@@ -5823,6 +6002,7 @@ of_group_desc_stats_entry_new(of_version_t version)
     }
 
     of_group_desc_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -6166,6 +6346,10 @@ of_group_desc_stats_entry_buckets_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(buckets, 0), new_len);
@@ -6264,6 +6448,7 @@ of_group_desc_stats_reply_new(of_version_t version)
     }
 
     of_group_desc_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_desc_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6608,6 +6793,10 @@ of_group_desc_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -6706,6 +6895,7 @@ of_group_desc_stats_request_new(of_version_t version)
     }
 
     of_group_desc_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_desc_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7000,6 +7190,7 @@ of_group_mod_failed_error_msg_new(of_version_t version)
     }
 
     of_group_mod_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_mod_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7302,6 +7493,9 @@ of_group_mod_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -7316,6 +7510,74 @@ of_group_mod_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_group_mod_failed_error_msg.
+ * @param obj Pointer to an object of type of_group_mod_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_group_mod_failed_error_msg_data_reserve(
+    of_group_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_GROUP_MOD_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -7396,6 +7658,7 @@ of_group_modify_new(of_version_t version)
     }
 
     of_group_modify_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_modify_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7824,6 +8087,10 @@ of_group_modify_buckets_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(buckets, 0), new_len);
@@ -7904,6 +8171,7 @@ of_group_stats_entry_new(of_version_t version)
     }
 
     of_group_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -8581,6 +8849,10 @@ of_group_stats_entry_bucket_stats_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(bucket_stats, 0), new_len);
@@ -8679,6 +8951,7 @@ of_group_stats_reply_new(of_version_t version)
     }
 
     of_group_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9023,6 +9296,10 @@ of_group_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -9121,6 +9398,7 @@ of_group_stats_request_new(of_version_t version)
     }
 
     of_group_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9605,6 +9883,7 @@ of_instruction_new(of_version_t version)
     }
 
     of_instruction_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -9727,6 +10006,7 @@ of_instruction_apply_actions_new(of_version_t version)
     }
 
     of_instruction_apply_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_apply_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -9903,6 +10183,10 @@ of_instruction_apply_actions_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -9999,6 +10283,7 @@ of_instruction_clear_actions_new(of_version_t version)
     }
 
     of_instruction_clear_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_clear_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
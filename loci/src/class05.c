@@ -112,6 +112,7 @@ of_instruction_experimenter_new(of_version_t version)
     }
 
     of_instruction_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -328,6 +329,9 @@ of_instruction_experimenter_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -342,6 +346,74 @@ of_instruction_experimenter_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_instruction_experimenter.
+ * @param obj Pointer to an object of type of_instruction_experimenter.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_instruction_experimenter_data_reserve(
+    of_instruction_experimenter_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_EXPERIMENTER);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 8;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -420,6 +492,7 @@ of_instruction_goto_table_new(of_version_t version)
     }
 
     of_instruction_goto_table_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_goto_table_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -628,6 +701,7 @@ of_instruction_write_actions_new(of_version_t version)
     }
 
     of_instruction_write_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_write_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -804,6 +878,10 @@ of_instruction_write_actions_actions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(actions, 0), new_len);
@@ -900,6 +978,7 @@ of_instruction_write_metadata_new(of_version_t version)
     }
 
     of_instruction_write_metadata_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_write_metadata_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1189,6 +1268,7 @@ of_match_v2_new(of_version_t version)
     }
 
     of_match_v2_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_match_v2_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2954,6 +3034,7 @@ of_switch_config_failed_error_msg_new(of_version_t version)
     }
 
     of_switch_config_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_switch_config_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3256,6 +3337,9 @@ of_switch_config_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -3270,6 +3354,74 @@ of_switch_config_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_switch_config_failed_error_msg.
+ * @param obj Pointer to an object of type of_switch_config_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_switch_config_failed_error_msg_data_reserve(
+    of_switch_config_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_SWITCH_CONFIG_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -3350,6 +3502,7 @@ of_table_mod_failed_error_msg_new(of_version_t version)
     }
 
     of_table_mod_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_mod_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3652,6 +3805,9 @@ of_table_mod_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -3666,6 +3822,74 @@ of_table_mod_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_table_mod_failed_error_msg.
+ * @param obj Pointer to an object of type of_table_mod_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_table_mod_failed_error_msg_data_reserve(
+    of_table_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_TABLE_MOD_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_1:
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -5325,6 +5549,7 @@ of_oxm_new(of_version_t version)
     }
 
     of_oxm_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5446,6 +5671,7 @@ of_action_set_field_new(of_version_t version)
     }
 
     of_action_set_field_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_set_field_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5621,6 +5847,10 @@ of_action_set_field_field_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(field, 0), new_len);
@@ -5744,6 +5974,7 @@ of_experimenter_error_msg_new(of_version_t version)
     }
 
     of_experimenter_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -6120,6 +6351,9 @@ of_experimenter_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -6134,6 +6368,73 @@ of_experimenter_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_experimenter_error_msg.
+ * @param obj Pointer to an object of type of_experimenter_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_experimenter_error_msg_data_reserve(
+    of_experimenter_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 16;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -6213,6 +6514,7 @@ of_group_features_stats_reply_new(of_version_t version)
     }
 
     of_group_features_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_features_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7322,6 +7624,7 @@ of_group_features_stats_request_new(of_version_t version)
     }
 
     of_group_features_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_group_features_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7609,6 +7912,7 @@ of_match_v3_new(of_version_t version)
     }
 
     of_match_v3_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_match_v3_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7783,6 +8087,10 @@ of_match_v3_oxm_list_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(oxm_list, 0), new_len);
@@ -7878,6 +8186,7 @@ of_oxm_arp_op_new(of_version_t version)
     }
 
     of_oxm_arp_op_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_op_push_wire_types(obj);
 
     return obj;
@@ -8082,6 +8391,7 @@ of_oxm_arp_op_masked_new(of_version_t version)
     }
 
     of_oxm_arp_op_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_op_masked_push_wire_types(obj);
 
     return obj;
@@ -8368,6 +8678,7 @@ of_oxm_arp_sha_new(of_version_t version)
     }
 
     of_oxm_arp_sha_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_sha_push_wire_types(obj);
 
     return obj;
@@ -8572,6 +8883,7 @@ of_oxm_arp_sha_masked_new(of_version_t version)
     }
 
     of_oxm_arp_sha_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_sha_masked_push_wire_types(obj);
 
     return obj;
@@ -8858,6 +9170,7 @@ of_oxm_arp_spa_new(of_version_t version)
     }
 
     of_oxm_arp_spa_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_spa_push_wire_types(obj);
 
     return obj;
@@ -9062,6 +9375,7 @@ of_oxm_arp_spa_masked_new(of_version_t version)
     }
 
     of_oxm_arp_spa_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_spa_masked_push_wire_types(obj);
 
     return obj;
@@ -9348,6 +9662,7 @@ of_oxm_arp_tha_new(of_version_t version)
     }
 
     of_oxm_arp_tha_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_tha_push_wire_types(obj);
 
     return obj;
@@ -9552,6 +9867,7 @@ of_oxm_arp_tha_masked_new(of_version_t version)
     }
 
     of_oxm_arp_tha_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_tha_masked_push_wire_types(obj);
 
     return obj;
@@ -9838,6 +10154,7 @@ of_oxm_arp_tpa_new(of_version_t version)
     }
 
     of_oxm_arp_tpa_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_tpa_push_wire_types(obj);
 
     return obj;
@@ -10042,6 +10359,7 @@ of_oxm_arp_tpa_masked_new(of_version_t version)
     }
 
     of_oxm_arp_tpa_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_arp_tpa_masked_push_wire_types(obj);
 
     return obj;
@@ -10328,6 +10646,7 @@ of_oxm_bsn_egr_port_group_id_new(of_version_t version)
     }
 
     of_oxm_bsn_egr_port_group_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_egr_port_group_id_push_wire_types(obj);
 
     return obj;
@@ -10532,6 +10851,7 @@ of_oxm_bsn_egr_port_group_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_egr_port_group_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_egr_port_group_id_masked_push_wire_types(obj);
 
     return obj;
@@ -10817,6 +11137,7 @@ of_oxm_bsn_global_vrf_allowed_new(of_version_t version)
     }
 
     of_oxm_bsn_global_vrf_allowed_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_global_vrf_allowed_push_wire_types(obj);
 
     return obj;
@@ -11018,6 +11339,7 @@ of_oxm_bsn_global_vrf_allowed_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_global_vrf_allowed_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_global_vrf_allowed_masked_push_wire_types(obj);
 
     return obj;
@@ -11300,6 +11622,7 @@ of_oxm_bsn_in_ports_128_new(of_version_t version)
     }
 
     of_oxm_bsn_in_ports_128_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_in_ports_128_push_wire_types(obj);
 
     return obj;
@@ -11504,6 +11827,7 @@ of_oxm_bsn_in_ports_128_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_in_ports_128_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_in_ports_128_masked_push_wire_types(obj);
 
     return obj;
@@ -11790,6 +12114,7 @@ of_oxm_bsn_in_ports_512_new(of_version_t version)
     }
 
     of_oxm_bsn_in_ports_512_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_in_ports_512_push_wire_types(obj);
 
     return obj;
@@ -11994,6 +12319,7 @@ of_oxm_bsn_in_ports_512_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_in_ports_512_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_in_ports_512_masked_push_wire_types(obj);
 
     return obj;
@@ -12280,6 +12606,7 @@ of_oxm_bsn_ingress_port_group_id_new(of_version_t version)
     }
 
     of_oxm_bsn_ingress_port_group_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_ingress_port_group_id_push_wire_types(obj);
 
     return obj;
@@ -75,6 +75,7 @@ of_oxm_bsn_ingress_port_group_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_ingress_port_group_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_ingress_port_group_id_masked_push_wire_types(obj);
 
     return obj;
@@ -361,6 +362,7 @@ of_oxm_bsn_ip_fragmentation_new(of_version_t version)
     }
 
     of_oxm_bsn_ip_fragmentation_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_ip_fragmentation_push_wire_types(obj);
 
     return obj;
@@ -565,6 +567,7 @@ of_oxm_bsn_ip_fragmentation_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_ip_fragmentation_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_ip_fragmentation_masked_push_wire_types(obj);
 
     return obj;
@@ -851,6 +854,7 @@ of_oxm_bsn_l2_cache_hit_new(of_version_t version)
     }
 
     of_oxm_bsn_l2_cache_hit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l2_cache_hit_push_wire_types(obj);
 
     return obj;
@@ -1055,6 +1059,7 @@ of_oxm_bsn_l2_cache_hit_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_l2_cache_hit_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l2_cache_hit_masked_push_wire_types(obj);
 
     return obj;
@@ -1340,6 +1345,7 @@ of_oxm_bsn_l3_dst_class_id_new(of_version_t version)
     }
 
     of_oxm_bsn_l3_dst_class_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l3_dst_class_id_push_wire_types(obj);
 
     return obj;
@@ -1541,6 +1547,7 @@ of_oxm_bsn_l3_dst_class_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_l3_dst_class_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l3_dst_class_id_masked_push_wire_types(obj);
 
     return obj;
@@ -1823,6 +1830,7 @@ of_oxm_bsn_l3_interface_class_id_new(of_version_t version)
     }
 
     of_oxm_bsn_l3_interface_class_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l3_interface_class_id_push_wire_types(obj);
 
     return obj;
@@ -2027,6 +2035,7 @@ of_oxm_bsn_l3_interface_class_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_l3_interface_class_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l3_interface_class_id_masked_push_wire_types(obj);
 
     return obj;
@@ -2313,6 +2322,7 @@ of_oxm_bsn_l3_src_class_id_new(of_version_t version)
     }
 
     of_oxm_bsn_l3_src_class_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l3_src_class_id_push_wire_types(obj);
 
     return obj;
@@ -2517,6 +2527,7 @@ of_oxm_bsn_l3_src_class_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_l3_src_class_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_l3_src_class_id_masked_push_wire_types(obj);
 
     return obj;
@@ -2803,6 +2814,7 @@ of_oxm_bsn_lag_id_new(of_version_t version)
     }
 
     of_oxm_bsn_lag_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_lag_id_push_wire_types(obj);
 
     return obj;
@@ -3007,6 +3019,7 @@ of_oxm_bsn_lag_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_lag_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_lag_id_masked_push_wire_types(obj);
 
     return obj;
@@ -3293,6 +3306,7 @@ of_oxm_bsn_tcp_flags_new(of_version_t version)
     }
 
     of_oxm_bsn_tcp_flags_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_tcp_flags_push_wire_types(obj);
 
     return obj;
@@ -3497,6 +3511,7 @@ of_oxm_bsn_tcp_flags_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_tcp_flags_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_tcp_flags_masked_push_wire_types(obj);
 
     return obj;
@@ -3783,6 +3798,7 @@ of_oxm_bsn_udf0_new(of_version_t version)
     }
 
     of_oxm_bsn_udf0_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf0_push_wire_types(obj);
 
     return obj;
@@ -3987,6 +4003,7 @@ of_oxm_bsn_udf0_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf0_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf0_masked_push_wire_types(obj);
 
     return obj;
@@ -4273,6 +4290,7 @@ of_oxm_bsn_udf1_new(of_version_t version)
     }
 
     of_oxm_bsn_udf1_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf1_push_wire_types(obj);
 
     return obj;
@@ -4477,6 +4495,7 @@ of_oxm_bsn_udf1_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf1_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf1_masked_push_wire_types(obj);
 
     return obj;
@@ -4763,6 +4782,7 @@ of_oxm_bsn_udf2_new(of_version_t version)
     }
 
     of_oxm_bsn_udf2_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf2_push_wire_types(obj);
 
     return obj;
@@ -4967,6 +4987,7 @@ of_oxm_bsn_udf2_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf2_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf2_masked_push_wire_types(obj);
 
     return obj;
@@ -5253,6 +5274,7 @@ of_oxm_bsn_udf3_new(of_version_t version)
     }
 
     of_oxm_bsn_udf3_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf3_push_wire_types(obj);
 
     return obj;
@@ -5457,6 +5479,7 @@ of_oxm_bsn_udf3_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf3_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf3_masked_push_wire_types(obj);
 
     return obj;
@@ -5743,6 +5766,7 @@ of_oxm_bsn_udf4_new(of_version_t version)
     }
 
     of_oxm_bsn_udf4_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf4_push_wire_types(obj);
 
     return obj;
@@ -5947,6 +5971,7 @@ of_oxm_bsn_udf4_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf4_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf4_masked_push_wire_types(obj);
 
     return obj;
@@ -6233,6 +6258,7 @@ of_oxm_bsn_udf5_new(of_version_t version)
     }
 
     of_oxm_bsn_udf5_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf5_push_wire_types(obj);
 
     return obj;
@@ -6437,6 +6463,7 @@ of_oxm_bsn_udf5_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf5_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf5_masked_push_wire_types(obj);
 
     return obj;
@@ -6723,6 +6750,7 @@ of_oxm_bsn_udf6_new(of_version_t version)
     }
 
     of_oxm_bsn_udf6_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf6_push_wire_types(obj);
 
     return obj;
@@ -6927,6 +6955,7 @@ of_oxm_bsn_udf6_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf6_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf6_masked_push_wire_types(obj);
 
     return obj;
@@ -7213,6 +7242,7 @@ of_oxm_bsn_udf7_new(of_version_t version)
     }
 
     of_oxm_bsn_udf7_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf7_push_wire_types(obj);
 
     return obj;
@@ -7417,6 +7447,7 @@ of_oxm_bsn_udf7_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_udf7_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_udf7_masked_push_wire_types(obj);
 
     return obj;
@@ -7703,6 +7734,7 @@ of_oxm_bsn_vlan_xlate_port_group_id_new(of_version_t version)
     }
 
     of_oxm_bsn_vlan_xlate_port_group_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vlan_xlate_port_group_id_push_wire_types(obj);
 
     return obj;
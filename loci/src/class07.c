@@ -75,6 +75,7 @@ of_oxm_bsn_vlan_xlate_port_group_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_vlan_xlate_port_group_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vlan_xlate_port_group_id_masked_push_wire_types(obj);
 
     return obj;
@@ -361,6 +362,7 @@ of_oxm_bsn_vrf_new(of_version_t version)
     }
 
     of_oxm_bsn_vrf_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vrf_push_wire_types(obj);
 
     return obj;
@@ -565,6 +567,7 @@ of_oxm_bsn_vrf_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_vrf_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vrf_masked_push_wire_types(obj);
 
     return obj;
@@ -851,6 +854,7 @@ of_oxm_encap_eth_dst_new(of_version_t version)
     }
 
     of_oxm_encap_eth_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_encap_eth_dst_push_wire_types(obj);
 
     return obj;
@@ -1055,6 +1059,7 @@ of_oxm_encap_eth_dst_masked_new(of_version_t version)
     }
 
     of_oxm_encap_eth_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_encap_eth_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -1341,6 +1346,7 @@ of_oxm_encap_eth_src_new(of_version_t version)
     }
 
     of_oxm_encap_eth_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_encap_eth_src_push_wire_types(obj);
 
     return obj;
@@ -1545,6 +1551,7 @@ of_oxm_encap_eth_src_masked_new(of_version_t version)
     }
 
     of_oxm_encap_eth_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_encap_eth_src_masked_push_wire_types(obj);
 
     return obj;
@@ -1831,6 +1838,7 @@ of_oxm_encap_eth_type_new(of_version_t version)
     }
 
     of_oxm_encap_eth_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_encap_eth_type_push_wire_types(obj);
 
     return obj;
@@ -2035,6 +2043,7 @@ of_oxm_encap_eth_type_masked_new(of_version_t version)
     }
 
     of_oxm_encap_eth_type_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_encap_eth_type_masked_push_wire_types(obj);
 
     return obj;
@@ -2321,6 +2330,7 @@ of_oxm_eth_dst_new(of_version_t version)
     }
 
     of_oxm_eth_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_eth_dst_push_wire_types(obj);
 
     return obj;
@@ -2525,6 +2535,7 @@ of_oxm_eth_dst_masked_new(of_version_t version)
     }
 
     of_oxm_eth_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_eth_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -2811,6 +2822,7 @@ of_oxm_eth_src_new(of_version_t version)
     }
 
     of_oxm_eth_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_eth_src_push_wire_types(obj);
 
     return obj;
@@ -3015,6 +3027,7 @@ of_oxm_eth_src_masked_new(of_version_t version)
     }
 
     of_oxm_eth_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_eth_src_masked_push_wire_types(obj);
 
     return obj;
@@ -3301,6 +3314,7 @@ of_oxm_eth_type_new(of_version_t version)
     }
 
     of_oxm_eth_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_eth_type_push_wire_types(obj);
 
     return obj;
@@ -3505,6 +3519,7 @@ of_oxm_eth_type_masked_new(of_version_t version)
     }
 
     of_oxm_eth_type_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_eth_type_masked_push_wire_types(obj);
 
     return obj;
@@ -3791,6 +3806,7 @@ of_oxm_icmpv4_code_new(of_version_t version)
     }
 
     of_oxm_icmpv4_code_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv4_code_push_wire_types(obj);
 
     return obj;
@@ -3995,6 +4011,7 @@ of_oxm_icmpv4_code_masked_new(of_version_t version)
     }
 
     of_oxm_icmpv4_code_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv4_code_masked_push_wire_types(obj);
 
     return obj;
@@ -4281,6 +4298,7 @@ of_oxm_icmpv4_type_new(of_version_t version)
     }
 
     of_oxm_icmpv4_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv4_type_push_wire_types(obj);
 
     return obj;
@@ -4485,6 +4503,7 @@ of_oxm_icmpv4_type_masked_new(of_version_t version)
     }
 
     of_oxm_icmpv4_type_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv4_type_masked_push_wire_types(obj);
 
     return obj;
@@ -4771,6 +4790,7 @@ of_oxm_icmpv6_code_new(of_version_t version)
     }
 
     of_oxm_icmpv6_code_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv6_code_push_wire_types(obj);
 
     return obj;
@@ -4975,6 +4995,7 @@ of_oxm_icmpv6_code_masked_new(of_version_t version)
     }
 
     of_oxm_icmpv6_code_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv6_code_masked_push_wire_types(obj);
 
     return obj;
@@ -5261,6 +5282,7 @@ of_oxm_icmpv6_type_new(of_version_t version)
     }
 
     of_oxm_icmpv6_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv6_type_push_wire_types(obj);
 
     return obj;
@@ -5465,6 +5487,7 @@ of_oxm_icmpv6_type_masked_new(of_version_t version)
     }
 
     of_oxm_icmpv6_type_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_icmpv6_type_masked_push_wire_types(obj);
 
     return obj;
@@ -5751,6 +5774,7 @@ of_oxm_in_phy_port_new(of_version_t version)
     }
 
     of_oxm_in_phy_port_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_in_phy_port_push_wire_types(obj);
 
     return obj;
@@ -5956,6 +5980,7 @@ of_oxm_in_phy_port_masked_new(of_version_t version)
     }
 
     of_oxm_in_phy_port_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_in_phy_port_masked_push_wire_types(obj);
 
     return obj;
@@ -6244,6 +6269,7 @@ of_oxm_in_port_new(of_version_t version)
     }
 
     of_oxm_in_port_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_in_port_push_wire_types(obj);
 
     return obj;
@@ -6449,6 +6475,7 @@ of_oxm_in_port_masked_new(of_version_t version)
     }
 
     of_oxm_in_port_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_in_port_masked_push_wire_types(obj);
 
     return obj;
@@ -6737,6 +6764,7 @@ of_oxm_ip_dscp_new(of_version_t version)
     }
 
     of_oxm_ip_dscp_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ip_dscp_push_wire_types(obj);
 
     return obj;
@@ -6941,6 +6969,7 @@ of_oxm_ip_dscp_masked_new(of_version_t version)
     }
 
     of_oxm_ip_dscp_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ip_dscp_masked_push_wire_types(obj);
 
     return obj;
@@ -7227,6 +7256,7 @@ of_oxm_ip_ecn_new(of_version_t version)
     }
 
     of_oxm_ip_ecn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ip_ecn_push_wire_types(obj);
 
     return obj;
@@ -7431,6 +7461,7 @@ of_oxm_ip_ecn_masked_new(of_version_t version)
     }
 
     of_oxm_ip_ecn_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ip_ecn_masked_push_wire_types(obj);
 
     return obj;
@@ -7717,6 +7748,7 @@ of_oxm_ip_proto_new(of_version_t version)
     }
 
     of_oxm_ip_proto_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ip_proto_push_wire_types(obj);
 
     return obj;
@@ -75,6 +75,7 @@ of_oxm_ip_proto_masked_new(of_version_t version)
     }
 
     of_oxm_ip_proto_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ip_proto_masked_push_wire_types(obj);
 
     return obj;
@@ -361,6 +362,7 @@ of_oxm_ipv4_dst_new(of_version_t version)
     }
 
     of_oxm_ipv4_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv4_dst_push_wire_types(obj);
 
     return obj;
@@ -565,6 +567,7 @@ of_oxm_ipv4_dst_masked_new(of_version_t version)
     }
 
     of_oxm_ipv4_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv4_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -851,6 +854,7 @@ of_oxm_ipv4_src_new(of_version_t version)
     }
 
     of_oxm_ipv4_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv4_src_push_wire_types(obj);
 
     return obj;
@@ -1055,6 +1059,7 @@ of_oxm_ipv4_src_masked_new(of_version_t version)
     }
 
     of_oxm_ipv4_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv4_src_masked_push_wire_types(obj);
 
     return obj;
@@ -1341,6 +1346,7 @@ of_oxm_ipv6_dst_new(of_version_t version)
     }
 
     of_oxm_ipv6_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_dst_push_wire_types(obj);
 
     return obj;
@@ -1545,6 +1551,7 @@ of_oxm_ipv6_dst_masked_new(of_version_t version)
     }
 
     of_oxm_ipv6_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -1831,6 +1838,7 @@ of_oxm_ipv6_flabel_new(of_version_t version)
     }
 
     of_oxm_ipv6_flabel_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_flabel_push_wire_types(obj);
 
     return obj;
@@ -2035,6 +2043,7 @@ of_oxm_ipv6_flabel_masked_new(of_version_t version)
     }
 
     of_oxm_ipv6_flabel_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_flabel_masked_push_wire_types(obj);
 
     return obj;
@@ -2321,6 +2330,7 @@ of_oxm_ipv6_nd_sll_new(of_version_t version)
     }
 
     of_oxm_ipv6_nd_sll_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_nd_sll_push_wire_types(obj);
 
     return obj;
@@ -2525,6 +2535,7 @@ of_oxm_ipv6_nd_sll_masked_new(of_version_t version)
     }
 
     of_oxm_ipv6_nd_sll_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_nd_sll_masked_push_wire_types(obj);
 
     return obj;
@@ -2811,6 +2822,7 @@ of_oxm_ipv6_nd_target_new(of_version_t version)
     }
 
     of_oxm_ipv6_nd_target_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_nd_target_push_wire_types(obj);
 
     return obj;
@@ -3015,6 +3027,7 @@ of_oxm_ipv6_nd_target_masked_new(of_version_t version)
     }
 
     of_oxm_ipv6_nd_target_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_nd_target_masked_push_wire_types(obj);
 
     return obj;
@@ -3301,6 +3314,7 @@ of_oxm_ipv6_nd_tll_new(of_version_t version)
     }
 
     of_oxm_ipv6_nd_tll_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_nd_tll_push_wire_types(obj);
 
     return obj;
@@ -3505,6 +3519,7 @@ of_oxm_ipv6_nd_tll_masked_new(of_version_t version)
     }
 
     of_oxm_ipv6_nd_tll_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_nd_tll_masked_push_wire_types(obj);
 
     return obj;
@@ -3791,6 +3806,7 @@ of_oxm_ipv6_src_new(of_version_t version)
     }
 
     of_oxm_ipv6_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_src_push_wire_types(obj);
 
     return obj;
@@ -3995,6 +4011,7 @@ of_oxm_ipv6_src_masked_new(of_version_t version)
     }
 
     of_oxm_ipv6_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_src_masked_push_wire_types(obj);
 
     return obj;
@@ -4281,6 +4298,7 @@ of_oxm_metadata_new(of_version_t version)
     }
 
     of_oxm_metadata_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_metadata_push_wire_types(obj);
 
     return obj;
@@ -4485,6 +4503,7 @@ of_oxm_metadata_masked_new(of_version_t version)
     }
 
     of_oxm_metadata_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_metadata_masked_push_wire_types(obj);
 
     return obj;
@@ -4771,6 +4790,7 @@ of_oxm_mpls_label_new(of_version_t version)
     }
 
     of_oxm_mpls_label_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_mpls_label_push_wire_types(obj);
 
     return obj;
@@ -4975,6 +4995,7 @@ of_oxm_mpls_label_masked_new(of_version_t version)
     }
 
     of_oxm_mpls_label_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_mpls_label_masked_push_wire_types(obj);
 
     return obj;
@@ -5261,6 +5282,7 @@ of_oxm_mpls_tc_new(of_version_t version)
     }
 
     of_oxm_mpls_tc_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_mpls_tc_push_wire_types(obj);
 
     return obj;
@@ -5465,6 +5487,7 @@ of_oxm_mpls_tc_masked_new(of_version_t version)
     }
 
     of_oxm_mpls_tc_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_mpls_tc_masked_push_wire_types(obj);
 
     return obj;
@@ -5751,6 +5774,7 @@ of_oxm_nsh_c1_new(of_version_t version)
     }
 
     of_oxm_nsh_c1_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c1_push_wire_types(obj);
 
     return obj;
@@ -5955,6 +5979,7 @@ of_oxm_nsh_c1_masked_new(of_version_t version)
     }
 
     of_oxm_nsh_c1_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c1_masked_push_wire_types(obj);
 
     return obj;
@@ -6241,6 +6266,7 @@ of_oxm_nsh_c2_new(of_version_t version)
     }
 
     of_oxm_nsh_c2_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c2_push_wire_types(obj);
 
     return obj;
@@ -6445,6 +6471,7 @@ of_oxm_nsh_c2_masked_new(of_version_t version)
     }
 
     of_oxm_nsh_c2_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c2_masked_push_wire_types(obj);
 
     return obj;
@@ -6731,6 +6758,7 @@ of_oxm_nsh_c3_new(of_version_t version)
     }
 
     of_oxm_nsh_c3_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c3_push_wire_types(obj);
 
     return obj;
@@ -6935,6 +6963,7 @@ of_oxm_nsh_c3_masked_new(of_version_t version)
     }
 
     of_oxm_nsh_c3_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c3_masked_push_wire_types(obj);
 
     return obj;
@@ -7221,6 +7250,7 @@ of_oxm_nsh_c4_new(of_version_t version)
     }
 
     of_oxm_nsh_c4_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c4_push_wire_types(obj);
 
     return obj;
@@ -7425,6 +7455,7 @@ of_oxm_nsh_c4_masked_new(of_version_t version)
     }
 
     of_oxm_nsh_c4_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_c4_masked_push_wire_types(obj);
 
     return obj;
@@ -7711,6 +7742,7 @@ of_oxm_nsh_mdtype_new(of_version_t version)
     }
 
     of_oxm_nsh_mdtype_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_mdtype_push_wire_types(obj);
 
     return obj;
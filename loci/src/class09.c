@@ -75,6 +75,7 @@ of_oxm_nsh_mdtype_masked_new(of_version_t version)
     }
 
     of_oxm_nsh_mdtype_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_mdtype_masked_push_wire_types(obj);
 
     return obj;
@@ -361,6 +362,7 @@ of_oxm_nsh_np_new(of_version_t version)
     }
 
     of_oxm_nsh_np_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_np_push_wire_types(obj);
 
     return obj;
@@ -565,6 +567,7 @@ of_oxm_nsh_np_masked_new(of_version_t version)
     }
 
     of_oxm_nsh_np_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsh_np_masked_push_wire_types(obj);
 
     return obj;
@@ -851,6 +854,7 @@ of_oxm_nsi_new(of_version_t version)
     }
 
     of_oxm_nsi_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsi_push_wire_types(obj);
 
     return obj;
@@ -1055,6 +1059,7 @@ of_oxm_nsi_masked_new(of_version_t version)
     }
 
     of_oxm_nsi_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsi_masked_push_wire_types(obj);
 
     return obj;
@@ -1341,6 +1346,7 @@ of_oxm_nsp_new(of_version_t version)
     }
 
     of_oxm_nsp_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsp_push_wire_types(obj);
 
     return obj;
@@ -1545,6 +1551,7 @@ of_oxm_nsp_masked_new(of_version_t version)
     }
 
     of_oxm_nsp_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_nsp_masked_push_wire_types(obj);
 
     return obj;
@@ -1832,6 +1839,7 @@ of_oxm_ovs_tcp_flags_new(of_version_t version)
     }
 
     of_oxm_ovs_tcp_flags_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ovs_tcp_flags_push_wire_types(obj);
 
     return obj;
@@ -2119,6 +2127,7 @@ of_oxm_ovs_tcp_flags_masked_new(of_version_t version)
     }
 
     of_oxm_ovs_tcp_flags_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ovs_tcp_flags_masked_push_wire_types(obj);
 
     return obj;
@@ -2487,6 +2496,7 @@ of_oxm_sctp_dst_new(of_version_t version)
     }
 
     of_oxm_sctp_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_sctp_dst_push_wire_types(obj);
 
     return obj;
@@ -2691,6 +2701,7 @@ of_oxm_sctp_dst_masked_new(of_version_t version)
     }
 
     of_oxm_sctp_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_sctp_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -2977,6 +2988,7 @@ of_oxm_sctp_src_new(of_version_t version)
     }
 
     of_oxm_sctp_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_sctp_src_push_wire_types(obj);
 
     return obj;
@@ -3181,6 +3193,7 @@ of_oxm_sctp_src_masked_new(of_version_t version)
     }
 
     of_oxm_sctp_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_sctp_src_masked_push_wire_types(obj);
 
     return obj;
@@ -3467,6 +3480,7 @@ of_oxm_tcp_dst_new(of_version_t version)
     }
 
     of_oxm_tcp_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tcp_dst_push_wire_types(obj);
 
     return obj;
@@ -3671,6 +3685,7 @@ of_oxm_tcp_dst_masked_new(of_version_t version)
     }
 
     of_oxm_tcp_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tcp_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -3957,6 +3972,7 @@ of_oxm_tcp_src_new(of_version_t version)
     }
 
     of_oxm_tcp_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tcp_src_push_wire_types(obj);
 
     return obj;
@@ -4161,6 +4177,7 @@ of_oxm_tcp_src_masked_new(of_version_t version)
     }
 
     of_oxm_tcp_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tcp_src_masked_push_wire_types(obj);
 
     return obj;
@@ -4447,6 +4464,7 @@ of_oxm_tun_flags_new(of_version_t version)
     }
 
     of_oxm_tun_flags_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_flags_push_wire_types(obj);
 
     return obj;
@@ -4651,6 +4669,7 @@ of_oxm_tun_flags_masked_new(of_version_t version)
     }
 
     of_oxm_tun_flags_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_flags_masked_push_wire_types(obj);
 
     return obj;
@@ -4937,6 +4956,7 @@ of_oxm_tun_gbp_flags_new(of_version_t version)
     }
 
     of_oxm_tun_gbp_flags_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gbp_flags_push_wire_types(obj);
 
     return obj;
@@ -5141,6 +5161,7 @@ of_oxm_tun_gbp_flags_masked_new(of_version_t version)
     }
 
     of_oxm_tun_gbp_flags_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gbp_flags_masked_push_wire_types(obj);
 
     return obj;
@@ -5427,6 +5448,7 @@ of_oxm_tun_gbp_id_new(of_version_t version)
     }
 
     of_oxm_tun_gbp_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gbp_id_push_wire_types(obj);
 
     return obj;
@@ -5631,6 +5653,7 @@ of_oxm_tun_gbp_id_masked_new(of_version_t version)
     }
 
     of_oxm_tun_gbp_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gbp_id_masked_push_wire_types(obj);
 
     return obj;
@@ -5917,6 +5940,7 @@ of_oxm_tun_gpe_flags_new(of_version_t version)
     }
 
     of_oxm_tun_gpe_flags_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gpe_flags_push_wire_types(obj);
 
     return obj;
@@ -6121,6 +6145,7 @@ of_oxm_tun_gpe_flags_masked_new(of_version_t version)
     }
 
     of_oxm_tun_gpe_flags_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gpe_flags_masked_push_wire_types(obj);
 
     return obj;
@@ -6407,6 +6432,7 @@ of_oxm_tun_gpe_np_new(of_version_t version)
     }
 
     of_oxm_tun_gpe_np_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gpe_np_push_wire_types(obj);
 
     return obj;
@@ -6611,6 +6637,7 @@ of_oxm_tun_gpe_np_masked_new(of_version_t version)
     }
 
     of_oxm_tun_gpe_np_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tun_gpe_np_masked_push_wire_types(obj);
 
     return obj;
@@ -6897,6 +6924,7 @@ of_oxm_tunnel_ipv4_dst_new(of_version_t version)
     }
 
     of_oxm_tunnel_ipv4_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tunnel_ipv4_dst_push_wire_types(obj);
 
     return obj;
@@ -7101,6 +7129,7 @@ of_oxm_tunnel_ipv4_dst_masked_new(of_version_t version)
     }
 
     of_oxm_tunnel_ipv4_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tunnel_ipv4_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -7387,6 +7416,7 @@ of_oxm_tunnel_ipv4_src_new(of_version_t version)
     }
 
     of_oxm_tunnel_ipv4_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tunnel_ipv4_src_push_wire_types(obj);
 
     return obj;
@@ -7591,6 +7621,7 @@ of_oxm_tunnel_ipv4_src_masked_new(of_version_t version)
     }
 
     of_oxm_tunnel_ipv4_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tunnel_ipv4_src_masked_push_wire_types(obj);
 
     return obj;
@@ -7877,6 +7908,7 @@ of_oxm_udp_dst_new(of_version_t version)
     }
 
     of_oxm_udp_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_udp_dst_push_wire_types(obj);
 
     return obj;
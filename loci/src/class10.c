@@ -75,6 +75,7 @@ of_oxm_udp_dst_masked_new(of_version_t version)
     }
 
     of_oxm_udp_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_udp_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -361,6 +362,7 @@ of_oxm_udp_src_new(of_version_t version)
     }
 
     of_oxm_udp_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_udp_src_push_wire_types(obj);
 
     return obj;
@@ -565,6 +567,7 @@ of_oxm_udp_src_masked_new(of_version_t version)
     }
 
     of_oxm_udp_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_udp_src_masked_push_wire_types(obj);
 
     return obj;
@@ -851,6 +854,7 @@ of_oxm_vlan_pcp_new(of_version_t version)
     }
 
     of_oxm_vlan_pcp_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_vlan_pcp_push_wire_types(obj);
 
     return obj;
@@ -1055,6 +1059,7 @@ of_oxm_vlan_pcp_masked_new(of_version_t version)
     }
 
     of_oxm_vlan_pcp_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_vlan_pcp_masked_push_wire_types(obj);
 
     return obj;
@@ -1341,6 +1346,7 @@ of_oxm_vlan_vid_new(of_version_t version)
     }
 
     of_oxm_vlan_vid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_vlan_vid_push_wire_types(obj);
 
     return obj;
@@ -1545,6 +1551,7 @@ of_oxm_vlan_vid_masked_new(of_version_t version)
     }
 
     of_oxm_vlan_vid_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_vlan_vid_masked_push_wire_types(obj);
 
     return obj;
@@ -1853,6 +1860,7 @@ of_queue_prop_experimenter_new(of_version_t version)
     }
 
     of_queue_prop_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2065,6 +2073,9 @@ of_queue_prop_experimenter_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -2079,6 +2090,73 @@ of_queue_prop_experimenter_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_queue_prop_experimenter.
+ * @param obj Pointer to an object of type of_queue_prop_experimenter.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_queue_prop_experimenter_data_reserve(
+    of_queue_prop_experimenter_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_EXPERIMENTER);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 16;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -2156,6 +2234,7 @@ of_queue_prop_max_rate_new(of_version_t version)
     }
 
     of_queue_prop_max_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_queue_prop_max_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2362,6 +2441,7 @@ of_role_reply_new(of_version_t version)
     }
 
     of_role_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_role_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2732,6 +2812,7 @@ of_role_request_new(of_version_t version)
     }
 
     of_role_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_role_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3103,6 +3184,7 @@ of_role_request_failed_error_msg_new(of_version_t version)
     }
 
     of_role_request_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_role_request_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3399,6 +3481,9 @@ of_role_request_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -3413,6 +3498,73 @@ of_role_request_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_role_request_failed_error_msg.
+ * @param obj Pointer to an object of type of_role_request_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_role_request_failed_error_msg_data_reserve(
+    of_role_request_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -3605,6 +3757,7 @@ of_action_id_new(of_version_t version)
     }
 
     of_action_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3760,6 +3913,7 @@ of_action_id_experimenter_new(of_version_t version)
     }
 
     of_action_id_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3998,6 +4152,7 @@ of_action_id_bsn_new(of_version_t version)
     }
 
     of_action_id_bsn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4280,6 +4435,7 @@ of_action_id_bsn_checksum_new(of_version_t version)
     }
 
     of_action_id_bsn_checksum_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_bsn_checksum_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4564,6 +4720,7 @@ of_action_bsn_gentable_new(of_version_t version)
     }
 
     of_action_bsn_gentable_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_bsn_gentable_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4976,6 +5133,10 @@ of_action_bsn_gentable_key_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(key, 0), new_len);
@@ -5072,6 +5233,7 @@ of_action_id_bsn_gentable_new(of_version_t version)
     }
 
     of_action_id_bsn_gentable_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_bsn_gentable_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5356,6 +5518,7 @@ of_action_id_bsn_mirror_new(of_version_t version)
     }
 
     of_action_id_bsn_mirror_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_bsn_mirror_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5640,6 +5803,7 @@ of_action_id_bsn_set_tunnel_dst_new(of_version_t version)
     }
 
     of_action_id_bsn_set_tunnel_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_bsn_set_tunnel_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5924,6 +6088,7 @@ of_action_circuit_new(of_version_t version)
     }
 
     of_action_circuit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_circuit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6329,6 +6494,10 @@ of_action_circuit_field_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(field, 0), new_len);
@@ -6425,6 +6594,7 @@ of_action_id_circuit_new(of_version_t version)
     }
 
     of_action_id_circuit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_circuit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6781,6 +6951,7 @@ of_action_id_copy_ttl_in_new(of_version_t version)
     }
 
     of_action_id_copy_ttl_in_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_copy_ttl_in_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6903,6 +7074,7 @@ of_action_id_copy_ttl_out_new(of_version_t version)
     }
 
     of_action_id_copy_ttl_out_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_copy_ttl_out_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7025,6 +7197,7 @@ of_action_id_dec_mpls_ttl_new(of_version_t version)
     }
 
     of_action_id_dec_mpls_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_dec_mpls_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7147,6 +7320,7 @@ of_action_id_dec_nw_ttl_new(of_version_t version)
     }
 
     of_action_id_dec_nw_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_dec_nw_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7269,6 +7443,7 @@ of_action_id_group_new(of_version_t version)
     }
 
     of_action_id_group_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_group_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7441,6 +7616,7 @@ of_action_id_nicira_new(of_version_t version)
     }
 
     of_action_id_nicira_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -7723,6 +7899,7 @@ of_action_id_nicira_dec_ttl_new(of_version_t version)
     }
 
     of_action_id_nicira_dec_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_nicira_dec_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8007,6 +8184,7 @@ of_action_id_nicira_move_new(of_version_t version)
     }
 
     of_action_id_nicira_move_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_nicira_move_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8291,6 +8469,7 @@ of_action_id_nicira_pop_nsh_new(of_version_t version)
     }
 
     of_action_id_nicira_pop_nsh_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_nicira_pop_nsh_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8575,6 +8754,7 @@ of_action_id_nicira_push_nsh_new(of_version_t version)
     }
 
     of_action_id_nicira_push_nsh_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_nicira_push_nsh_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
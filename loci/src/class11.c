@@ -76,6 +76,7 @@ of_action_id_nicira_resubmit_new(of_version_t version)
     }
 
     of_action_id_nicira_resubmit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_nicira_resubmit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -360,6 +361,7 @@ of_action_id_nicira_resubmit_table_new(of_version_t version)
     }
 
     of_action_id_nicira_resubmit_table_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_nicira_resubmit_table_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -659,6 +661,7 @@ of_action_ofdpa_new(of_version_t version)
     }
 
     of_action_ofdpa_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -952,6 +955,7 @@ of_action_id_ofdpa_new(of_version_t version)
     }
 
     of_action_id_ofdpa_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1229,6 +1233,7 @@ of_action_ofdpa_pop_cw_new(of_version_t version)
     }
 
     of_action_ofdpa_pop_cw_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_ofdpa_pop_cw_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1508,6 +1513,7 @@ of_action_id_ofdpa_pop_cw_new(of_version_t version)
     }
 
     of_action_id_ofdpa_pop_cw_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_ofdpa_pop_cw_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1787,6 +1793,7 @@ of_action_ofdpa_pop_l2_header_new(of_version_t version)
     }
 
     of_action_ofdpa_pop_l2_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_ofdpa_pop_l2_header_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2066,6 +2073,7 @@ of_action_id_ofdpa_pop_l2_header_new(of_version_t version)
     }
 
     of_action_id_ofdpa_pop_l2_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_ofdpa_pop_l2_header_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2345,6 +2353,7 @@ of_action_ofdpa_push_cw_new(of_version_t version)
     }
 
     of_action_ofdpa_push_cw_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_ofdpa_push_cw_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2624,6 +2633,7 @@ of_action_id_ofdpa_push_cw_new(of_version_t version)
     }
 
     of_action_id_ofdpa_push_cw_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_ofdpa_push_cw_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2903,6 +2913,7 @@ of_action_ofdpa_push_l2_header_new(of_version_t version)
     }
 
     of_action_ofdpa_push_l2_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_ofdpa_push_l2_header_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3182,6 +3193,7 @@ of_action_id_ofdpa_push_l2_header_new(of_version_t version)
     }
 
     of_action_id_ofdpa_push_l2_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_ofdpa_push_l2_header_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3462,6 +3474,7 @@ of_action_oplink_att_new(of_version_t version)
     }
 
     of_action_oplink_att_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_oplink_att_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3867,6 +3880,10 @@ of_action_oplink_att_field_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(field, 0), new_len);
@@ -3963,6 +3980,7 @@ of_action_id_oplink_att_new(of_version_t version)
     }
 
     of_action_id_oplink_att_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_oplink_att_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4319,6 +4337,7 @@ of_action_id_output_new(of_version_t version)
     }
 
     of_action_id_output_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_output_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4441,6 +4460,7 @@ of_action_id_pop_mpls_new(of_version_t version)
     }
 
     of_action_id_pop_mpls_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_pop_mpls_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4563,6 +4583,7 @@ of_action_pop_pbb_new(of_version_t version)
     }
 
     of_action_pop_pbb_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_pop_pbb_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4685,6 +4706,7 @@ of_action_id_pop_pbb_new(of_version_t version)
     }
 
     of_action_id_pop_pbb_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_pop_pbb_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4807,6 +4829,7 @@ of_action_id_pop_vlan_new(of_version_t version)
     }
 
     of_action_id_pop_vlan_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_pop_vlan_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4929,6 +4952,7 @@ of_action_id_push_mpls_new(of_version_t version)
     }
 
     of_action_id_push_mpls_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_push_mpls_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5051,6 +5075,7 @@ of_action_push_pbb_new(of_version_t version)
     }
 
     of_action_push_pbb_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_push_pbb_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5253,6 +5278,7 @@ of_action_id_push_pbb_new(of_version_t version)
     }
 
     of_action_id_push_pbb_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_push_pbb_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5375,6 +5401,7 @@ of_action_id_push_vlan_new(of_version_t version)
     }
 
     of_action_id_push_vlan_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_push_vlan_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5497,6 +5524,7 @@ of_action_id_set_field_new(of_version_t version)
     }
 
     of_action_id_set_field_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_set_field_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5619,6 +5647,7 @@ of_action_id_set_mpls_ttl_new(of_version_t version)
     }
 
     of_action_id_set_mpls_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_set_mpls_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5741,6 +5770,7 @@ of_action_id_set_nw_ttl_new(of_version_t version)
     }
 
     of_action_id_set_nw_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_set_nw_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5863,6 +5893,7 @@ of_action_id_set_queue_new(of_version_t version)
     }
 
     of_action_id_set_queue_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_action_id_set_queue_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5986,6 +6017,7 @@ of_async_get_reply_new(of_version_t version)
     }
 
     of_async_get_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_get_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6236,6 +6268,10 @@ of_async_get_reply_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -6799,6 +6835,7 @@ of_async_get_request_new(of_version_t version)
     }
 
     of_async_get_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_get_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7049,6 +7086,10 @@ of_async_get_request_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -7612,6 +7653,7 @@ of_async_set_new(of_version_t version)
     }
 
     of_async_set_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_set_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7862,6 +7904,10 @@ of_async_set_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -8427,6 +8473,7 @@ of_bsn_arp_idle_new(of_version_t version)
     }
 
     of_bsn_arp_idle_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_arp_idle_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8969,6 +9016,7 @@ of_bsn_base_error_new(of_version_t version)
     }
 
     of_bsn_base_error_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -9417,6 +9465,9 @@ of_bsn_base_error_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -9431,3 +9482,69 @@ of_bsn_base_error_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bsn_base_error.
+ * @param obj Pointer to an object of type of_bsn_base_error.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_base_error_data_reserve(
+    of_bsn_base_error_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_BASE_ERROR);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 272;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
@@ -60,6 +60,7 @@ of_bsn_controller_connection_new(of_version_t version)
     }
 
     of_bsn_controller_connection_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -503,6 +504,7 @@ of_bsn_controller_connections_reply_new(of_version_t version)
     }
 
     of_bsn_controller_connections_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_controller_connections_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -915,6 +917,10 @@ of_bsn_controller_connections_reply_connections_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(connections, 0), new_len);
@@ -1012,6 +1018,7 @@ of_bsn_controller_connections_request_new(of_version_t version)
     }
 
     of_bsn_controller_connections_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_controller_connections_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1360,6 +1367,7 @@ of_bsn_debug_counter_desc_stats_entry_new(of_version_t version)
     }
 
     of_bsn_debug_counter_desc_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1724,6 +1732,7 @@ of_bsn_debug_counter_desc_stats_reply_new(of_version_t version)
     }
 
     of_bsn_debug_counter_desc_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_debug_counter_desc_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2216,6 +2225,10 @@ of_bsn_debug_counter_desc_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -2314,6 +2327,7 @@ of_bsn_debug_counter_desc_stats_request_new(of_version_t version)
     }
 
     of_bsn_debug_counter_desc_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_debug_counter_desc_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2742,6 +2756,7 @@ of_bsn_debug_counter_stats_entry_new(of_version_t version)
     }
 
     of_bsn_debug_counter_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3026,6 +3041,7 @@ of_bsn_debug_counter_stats_reply_new(of_version_t version)
     }
 
     of_bsn_debug_counter_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_debug_counter_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3518,6 +3534,10 @@ of_bsn_debug_counter_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -3616,6 +3636,7 @@ of_bsn_debug_counter_stats_request_new(of_version_t version)
     }
 
     of_bsn_debug_counter_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_debug_counter_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4062,6 +4083,7 @@ of_bsn_error_new(of_version_t version)
     }
 
     of_bsn_error_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_error_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4512,6 +4534,9 @@ of_bsn_error_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -4526,6 +4551,72 @@ of_bsn_error_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bsn_error.
+ * @param obj Pointer to an object of type of_bsn_error.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_error_data_reserve(
+    of_bsn_error_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_ERROR);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 272;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -4588,6 +4679,7 @@ of_bsn_flow_checksum_bucket_stats_entry_new(of_version_t version)
     }
 
     of_bsn_flow_checksum_bucket_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4792,6 +4884,7 @@ of_bsn_flow_checksum_bucket_stats_reply_new(of_version_t version)
     }
 
     of_bsn_flow_checksum_bucket_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_flow_checksum_bucket_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5284,6 +5377,10 @@ of_bsn_flow_checksum_bucket_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -5382,6 +5479,7 @@ of_bsn_flow_checksum_bucket_stats_request_new(of_version_t version)
     }
 
     of_bsn_flow_checksum_bucket_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_flow_checksum_bucket_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5907,6 +6005,7 @@ of_bsn_flow_idle_new(of_version_t version)
     }
 
     of_bsn_flow_idle_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_flow_idle_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6527,6 +6626,10 @@ of_bsn_flow_idle_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -6623,6 +6726,7 @@ of_bsn_flow_idle_enable_get_reply_new(of_version_t version)
     }
 
     of_bsn_flow_idle_enable_get_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_flow_idle_enable_get_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7068,6 +7172,7 @@ of_bsn_flow_idle_enable_get_request_new(of_version_t version)
     }
 
     of_bsn_flow_idle_enable_get_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_flow_idle_enable_get_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7433,6 +7538,7 @@ of_bsn_flow_idle_enable_set_reply_new(of_version_t version)
     }
 
     of_bsn_flow_idle_enable_set_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_flow_idle_enable_set_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7958,6 +8064,7 @@ of_bsn_flow_idle_enable_set_request_new(of_version_t version)
     }
 
     of_bsn_flow_idle_enable_set_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_flow_idle_enable_set_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8386,6 +8493,7 @@ of_bsn_generic_stats_entry_new(of_version_t version)
     }
 
     of_bsn_generic_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -8557,6 +8665,10 @@ of_bsn_generic_stats_entry_tlvs_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(tlvs, 0), new_len);
@@ -8655,6 +8767,7 @@ of_bsn_generic_stats_reply_new(of_version_t version)
     }
 
     of_bsn_generic_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_generic_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9147,6 +9260,10 @@ of_bsn_generic_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -9245,6 +9362,7 @@ of_bsn_generic_stats_request_new(of_version_t version)
     }
 
     of_bsn_generic_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_generic_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9817,6 +9935,10 @@ of_bsn_generic_stats_request_tlvs_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(tlvs, 0), new_len);
@@ -9897,6 +10019,7 @@ of_bsn_gentable_bucket_stats_entry_new(of_version_t version)
     }
 
     of_bsn_gentable_bucket_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -10101,6 +10224,7 @@ of_bsn_gentable_bucket_stats_reply_new(of_version_t version)
     }
 
     of_bsn_gentable_bucket_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_bucket_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10593,6 +10717,10 @@ of_bsn_gentable_bucket_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -10691,6 +10819,7 @@ of_bsn_gentable_bucket_stats_request_new(of_version_t version)
     }
 
     of_bsn_gentable_bucket_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_bucket_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11216,6 +11345,7 @@ of_bsn_gentable_clear_reply_new(of_version_t version)
     }
 
     of_bsn_gentable_clear_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_clear_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11821,6 +11951,7 @@ of_bsn_gentable_clear_request_new(of_version_t version)
     }
 
     of_bsn_gentable_clear_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_clear_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12409,6 +12540,7 @@ of_bsn_gentable_desc_stats_entry_new(of_version_t version)
     }
 
     of_bsn_gentable_desc_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -12854,6 +12986,7 @@ of_bsn_gentable_desc_stats_reply_new(of_version_t version)
     }
 
     of_bsn_gentable_desc_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_desc_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -13346,6 +13479,10 @@ of_bsn_gentable_desc_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -13444,6 +13581,7 @@ of_bsn_gentable_desc_stats_request_new(of_version_t version)
     }
 
     of_bsn_gentable_desc_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_desc_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -13889,6 +14027,7 @@ of_bsn_gentable_entry_add_new(of_version_t version)
     }
 
     of_bsn_gentable_entry_add_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_entry_add_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -14461,6 +14600,10 @@ of_bsn_gentable_entry_add_key_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(key, 0), new_len);
@@ -14605,6 +14748,10 @@ of_bsn_gentable_entry_add_value_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(value, 0), new_len);
@@ -14702,6 +14849,7 @@ of_bsn_gentable_entry_delete_new(of_version_t version)
     }
 
     of_bsn_gentable_entry_delete_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_gentable_entry_delete_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -15194,6 +15342,10 @@ of_bsn_gentable_entry_delete_key_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(key, 0), new_len);
@@ -15274,6 +15426,7 @@ of_bsn_gentable_entry_desc_stats_entry_new(of_version_t version)
     }
 
     of_bsn_gentable_entry_desc_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -15525,6 +15678,10 @@ of_bsn_gentable_entry_desc_stats_entry_key_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(key, 0), new_len);
@@ -15669,6 +15826,10 @@ of_bsn_gentable_entry_desc_stats_entry_value_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(value, 0), new_len);
@@ -60,6 +60,7 @@ of_bsn_switch_pipeline_stats_entry_new(of_version_t version)
     }
 
     of_bsn_switch_pipeline_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -264,6 +265,7 @@ of_bsn_switch_pipeline_stats_reply_new(of_version_t version)
     }
 
     of_bsn_switch_pipeline_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_switch_pipeline_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -756,6 +758,10 @@ of_bsn_switch_pipeline_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -854,6 +860,7 @@ of_bsn_switch_pipeline_stats_request_new(of_version_t version)
     }
 
     of_bsn_switch_pipeline_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_switch_pipeline_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1282,6 +1289,7 @@ of_bsn_table_checksum_stats_entry_new(of_version_t version)
     }
 
     of_bsn_table_checksum_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1566,6 +1574,7 @@ of_bsn_table_checksum_stats_reply_new(of_version_t version)
     }
 
     of_bsn_table_checksum_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_table_checksum_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2058,6 +2067,10 @@ of_bsn_table_checksum_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -2156,6 +2169,7 @@ of_bsn_table_checksum_stats_request_new(of_version_t version)
     }
 
     of_bsn_table_checksum_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_table_checksum_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2601,6 +2615,7 @@ of_bsn_table_set_buckets_size_new(of_version_t version)
     }
 
     of_bsn_table_set_buckets_size_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_table_set_buckets_size_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3126,6 +3141,7 @@ of_bsn_time_reply_new(of_version_t version)
     }
 
     of_bsn_time_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_time_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3571,6 +3587,7 @@ of_bsn_time_request_new(of_version_t version)
     }
 
     of_bsn_time_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_time_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4811,6 +4828,7 @@ of_bsn_tlv_new(of_version_t version)
     }
 
     of_bsn_tlv_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4931,6 +4949,7 @@ of_bsn_tlv_actor_key_new(of_version_t version)
     }
 
     of_bsn_tlv_actor_key_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_actor_key_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5133,6 +5152,7 @@ of_bsn_tlv_actor_port_num_new(of_version_t version)
     }
 
     of_bsn_tlv_actor_port_num_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_actor_port_num_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5335,6 +5355,7 @@ of_bsn_tlv_actor_port_priority_new(of_version_t version)
     }
 
     of_bsn_tlv_actor_port_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_actor_port_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5537,6 +5558,7 @@ of_bsn_tlv_actor_state_new(of_version_t version)
     }
 
     of_bsn_tlv_actor_state_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_actor_state_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5739,6 +5761,7 @@ of_bsn_tlv_actor_system_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_actor_system_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_actor_system_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5941,6 +5964,7 @@ of_bsn_tlv_actor_system_priority_new(of_version_t version)
     }
 
     of_bsn_tlv_actor_system_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_actor_system_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6143,6 +6167,7 @@ of_bsn_tlv_anchor_new(of_version_t version)
     }
 
     of_bsn_tlv_anchor_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_anchor_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6345,6 +6370,7 @@ of_bsn_tlv_apply_bytes_new(of_version_t version)
     }
 
     of_bsn_tlv_apply_bytes_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_apply_bytes_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6547,6 +6573,7 @@ of_bsn_tlv_apply_packets_new(of_version_t version)
     }
 
     of_bsn_tlv_apply_packets_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_apply_packets_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6749,6 +6776,7 @@ of_bsn_tlv_auto_negotiation_new(of_version_t version)
     }
 
     of_bsn_tlv_auto_negotiation_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_auto_negotiation_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6951,6 +6979,7 @@ of_bsn_tlv_broadcast_query_timeout_new(of_version_t version)
     }
 
     of_bsn_tlv_broadcast_query_timeout_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_broadcast_query_timeout_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7153,6 +7182,7 @@ of_bsn_tlv_broadcast_rate_new(of_version_t version)
     }
 
     of_bsn_tlv_broadcast_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_broadcast_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7355,6 +7385,7 @@ of_bsn_tlv_bucket_new(of_version_t version)
     }
 
     of_bsn_tlv_bucket_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_bucket_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7527,6 +7558,10 @@ of_bsn_tlv_bucket_value_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(value, 0), new_len);
@@ -7621,6 +7656,7 @@ of_bsn_tlv_circuit_id_new(of_version_t version)
     }
 
     of_bsn_tlv_circuit_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_circuit_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7751,6 +7787,9 @@ of_bsn_tlv_circuit_id_value_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = value->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, value, cur_len);
 
@@ -7765,6 +7804,72 @@ of_bsn_tlv_circuit_id_value_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for value in an object of type of_bsn_tlv_circuit_id.
+ * @param obj Pointer to an object of type of_bsn_tlv_circuit_id.
+ * @param bytes The length of value
+ * @param value Set to where value is written in the object
+ *
+ * The object is resized for bytes of value, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_tlv_circuit_id_value_reserve(
+    of_bsn_tlv_circuit_id_t *obj,
+    int bytes,
+    uint8_t **value)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_TLV_CIRCUIT_ID);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 4;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *value = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -7841,6 +7946,7 @@ of_bsn_tlv_convergence_status_new(of_version_t version)
     }
 
     of_bsn_tlv_convergence_status_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_convergence_status_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8043,6 +8149,7 @@ of_bsn_tlv_cpu_lag_new(of_version_t version)
     }
 
     of_bsn_tlv_cpu_lag_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_cpu_lag_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8165,6 +8272,7 @@ of_bsn_tlv_crc_enabled_new(of_version_t version)
     }
 
     of_bsn_tlv_crc_enabled_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_crc_enabled_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8367,6 +8475,7 @@ of_bsn_tlv_data_new(of_version_t version)
     }
 
     of_bsn_tlv_data_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_data_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8497,6 +8606,9 @@ of_bsn_tlv_data_value_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = value->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, value, cur_len);
 
@@ -8511,6 +8623,72 @@ of_bsn_tlv_data_value_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for value in an object of type of_bsn_tlv_data.
+ * @param obj Pointer to an object of type of_bsn_tlv_data.
+ * @param bytes The length of value
+ * @param value Set to where value is written in the object
+ *
+ * The object is resized for bytes of value, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_tlv_data_value_reserve(
+    of_bsn_tlv_data_t *obj,
+    int bytes,
+    uint8_t **value)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_TLV_DATA);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 4;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *value = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -8587,6 +8765,7 @@ of_bsn_tlv_data_mask_new(of_version_t version)
     }
 
     of_bsn_tlv_data_mask_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_data_mask_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8717,6 +8896,9 @@ of_bsn_tlv_data_mask_value_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = value->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, value, cur_len);
 
@@ -8731,6 +8913,72 @@ of_bsn_tlv_data_mask_value_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for value in an object of type of_bsn_tlv_data_mask.
+ * @param obj Pointer to an object of type of_bsn_tlv_data_mask.
+ * @param bytes The length of value
+ * @param value Set to where value is written in the object
+ *
+ * The object is resized for bytes of value, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_tlv_data_mask_value_reserve(
+    of_bsn_tlv_data_mask_t *obj,
+    int bytes,
+    uint8_t **value)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_TLV_DATA_MASK);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 4;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *value = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -8807,6 +9055,7 @@ of_bsn_tlv_decap_new(of_version_t version)
     }
 
     of_bsn_tlv_decap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_decap_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -9009,6 +9258,7 @@ of_bsn_tlv_disable_src_mac_check_new(of_version_t version)
     }
 
     of_bsn_tlv_disable_src_mac_check_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_disable_src_mac_check_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -9131,6 +9381,7 @@ of_bsn_tlv_drop_new(of_version_t version)
     }
 
     of_bsn_tlv_drop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_drop_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
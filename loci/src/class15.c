@@ -74,6 +74,7 @@ of_bsn_tlv_dscp_new(of_version_t version)
     }
 
     of_bsn_tlv_dscp_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_dscp_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -276,6 +277,7 @@ of_bsn_tlv_ecn_new(of_version_t version)
     }
 
     of_bsn_tlv_ecn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ecn_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -478,6 +480,7 @@ of_bsn_tlv_egress_only_new(of_version_t version)
     }
 
     of_bsn_tlv_egress_only_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_egress_only_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -600,6 +603,7 @@ of_bsn_tlv_egress_port_group_id_new(of_version_t version)
     }
 
     of_bsn_tlv_egress_port_group_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_egress_port_group_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -802,6 +806,7 @@ of_bsn_tlv_enhanced_hash_capability_new(of_version_t version)
     }
 
     of_bsn_tlv_enhanced_hash_capability_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_enhanced_hash_capability_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1004,6 +1009,7 @@ of_bsn_tlv_eth_dst_new(of_version_t version)
     }
 
     of_bsn_tlv_eth_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_eth_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1206,6 +1212,7 @@ of_bsn_tlv_eth_src_new(of_version_t version)
     }
 
     of_bsn_tlv_eth_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_eth_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1408,6 +1415,7 @@ of_bsn_tlv_eth_type_new(of_version_t version)
     }
 
     of_bsn_tlv_eth_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_eth_type_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1610,6 +1618,7 @@ of_bsn_tlv_external_gateway_ip_new(of_version_t version)
     }
 
     of_bsn_tlv_external_gateway_ip_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_external_gateway_ip_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1812,6 +1821,7 @@ of_bsn_tlv_external_gateway_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_external_gateway_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_external_gateway_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2014,6 +2024,7 @@ of_bsn_tlv_external_ip_new(of_version_t version)
     }
 
     of_bsn_tlv_external_ip_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_external_ip_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2216,6 +2227,7 @@ of_bsn_tlv_external_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_external_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_external_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2418,6 +2430,7 @@ of_bsn_tlv_external_netmask_new(of_version_t version)
     }
 
     of_bsn_tlv_external_netmask_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_external_netmask_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2620,6 +2633,7 @@ of_bsn_tlv_generation_id_new(of_version_t version)
     }
 
     of_bsn_tlv_generation_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_generation_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2822,6 +2836,7 @@ of_bsn_tlv_hash_gtp_header_match_new(of_version_t version)
     }
 
     of_bsn_tlv_hash_gtp_header_match_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_hash_gtp_header_match_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3104,6 +3119,7 @@ of_bsn_tlv_hash_gtp_port_match_new(of_version_t version)
     }
 
     of_bsn_tlv_hash_gtp_port_match_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_hash_gtp_port_match_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3466,6 +3482,7 @@ of_bsn_tlv_hash_packet_field_new(of_version_t version)
     }
 
     of_bsn_tlv_hash_packet_field_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_hash_packet_field_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3668,6 +3685,7 @@ of_bsn_tlv_hash_packet_type_new(of_version_t version)
     }
 
     of_bsn_tlv_hash_packet_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_hash_packet_type_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3870,6 +3888,7 @@ of_bsn_tlv_hash_seed_new(of_version_t version)
     }
 
     of_bsn_tlv_hash_seed_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_hash_seed_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4152,6 +4171,7 @@ of_bsn_tlv_hash_type_new(of_version_t version)
     }
 
     of_bsn_tlv_hash_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_hash_type_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4354,6 +4374,7 @@ of_bsn_tlv_header_size_new(of_version_t version)
     }
 
     of_bsn_tlv_header_size_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_header_size_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4556,6 +4577,7 @@ of_bsn_tlv_icmp_code_new(of_version_t version)
     }
 
     of_bsn_tlv_icmp_code_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_icmp_code_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4758,6 +4780,7 @@ of_bsn_tlv_icmp_id_new(of_version_t version)
     }
 
     of_bsn_tlv_icmp_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_icmp_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4960,6 +4983,7 @@ of_bsn_tlv_icmp_type_new(of_version_t version)
     }
 
     of_bsn_tlv_icmp_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_icmp_type_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5162,6 +5186,7 @@ of_bsn_tlv_icmpv6_chksum_new(of_version_t version)
     }
 
     of_bsn_tlv_icmpv6_chksum_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_icmpv6_chksum_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5364,6 +5389,7 @@ of_bsn_tlv_idle_notification_new(of_version_t version)
     }
 
     of_bsn_tlv_idle_notification_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_idle_notification_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5486,6 +5512,7 @@ of_bsn_tlv_idle_time_new(of_version_t version)
     }
 
     of_bsn_tlv_idle_time_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_idle_time_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5688,6 +5715,7 @@ of_bsn_tlv_idle_timeout_new(of_version_t version)
     }
 
     of_bsn_tlv_idle_timeout_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_idle_timeout_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5890,6 +5918,7 @@ of_bsn_tlv_igmp_snooping_new(of_version_t version)
     }
 
     of_bsn_tlv_igmp_snooping_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_igmp_snooping_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6012,6 +6041,7 @@ of_bsn_tlv_ingress_port_group_id_new(of_version_t version)
     }
 
     of_bsn_tlv_ingress_port_group_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ingress_port_group_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6214,6 +6244,7 @@ of_bsn_tlv_internal_gateway_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_internal_gateway_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_internal_gateway_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6416,6 +6447,7 @@ of_bsn_tlv_internal_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_internal_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_internal_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
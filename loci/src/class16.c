@@ -74,6 +74,7 @@ of_bsn_tlv_interval_new(of_version_t version)
     }
 
     of_bsn_tlv_interval_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_interval_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -276,6 +277,7 @@ of_bsn_tlv_ip_proto_new(of_version_t version)
     }
 
     of_bsn_tlv_ip_proto_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ip_proto_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -478,6 +480,7 @@ of_bsn_tlv_ipv4_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv4_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv4_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -680,6 +683,7 @@ of_bsn_tlv_ipv4_dst_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv4_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv4_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -882,6 +886,7 @@ of_bsn_tlv_ipv4_netmask_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv4_netmask_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv4_netmask_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1084,6 +1089,7 @@ of_bsn_tlv_ipv4_src_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv4_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv4_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1286,6 +1292,7 @@ of_bsn_tlv_ipv6_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv6_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv6_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1488,6 +1495,7 @@ of_bsn_tlv_ipv6_dst_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv6_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv6_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1690,6 +1698,7 @@ of_bsn_tlv_ipv6_prefix_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv6_prefix_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv6_prefix_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1972,6 +1981,7 @@ of_bsn_tlv_ipv6_src_new(of_version_t version)
     }
 
     of_bsn_tlv_ipv6_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ipv6_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2174,6 +2184,7 @@ of_bsn_tlv_known_multicast_rate_new(of_version_t version)
     }
 
     of_bsn_tlv_known_multicast_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_known_multicast_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2376,6 +2387,7 @@ of_bsn_tlv_l2_multicast_lookup_new(of_version_t version)
     }
 
     of_bsn_tlv_l2_multicast_lookup_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_l2_multicast_lookup_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2498,6 +2510,7 @@ of_bsn_tlv_l3_dst_class_id_new(of_version_t version)
     }
 
     of_bsn_tlv_l3_dst_class_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_l3_dst_class_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2700,6 +2713,7 @@ of_bsn_tlv_l3_interface_class_id_new(of_version_t version)
     }
 
     of_bsn_tlv_l3_interface_class_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_l3_interface_class_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2902,6 +2916,7 @@ of_bsn_tlv_l3_src_class_id_new(of_version_t version)
     }
 
     of_bsn_tlv_l3_src_class_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_l3_src_class_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3104,6 +3119,7 @@ of_bsn_tlv_loopback_port_new(of_version_t version)
     }
 
     of_bsn_tlv_loopback_port_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_loopback_port_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3307,6 +3323,7 @@ of_bsn_tlv_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3509,6 +3526,7 @@ of_bsn_tlv_mac_mask_new(of_version_t version)
     }
 
     of_bsn_tlv_mac_mask_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_mac_mask_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3711,6 +3729,7 @@ of_bsn_tlv_mcg_type_vxlan_new(of_version_t version)
     }
 
     of_bsn_tlv_mcg_type_vxlan_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_mcg_type_vxlan_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3833,6 +3852,7 @@ of_bsn_tlv_miss_packets_new(of_version_t version)
     }
 
     of_bsn_tlv_miss_packets_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_miss_packets_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4035,6 +4055,7 @@ of_bsn_tlv_mpls_control_word_new(of_version_t version)
     }
 
     of_bsn_tlv_mpls_control_word_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_mpls_control_word_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4237,6 +4258,7 @@ of_bsn_tlv_mpls_label_new(of_version_t version)
     }
 
     of_bsn_tlv_mpls_label_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_mpls_label_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4439,6 +4461,7 @@ of_bsn_tlv_mpls_sequenced_new(of_version_t version)
     }
 
     of_bsn_tlv_mpls_sequenced_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_mpls_sequenced_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4641,6 +4664,7 @@ of_bsn_tlv_multicast_interface_id_new(of_version_t version)
     }
 
     of_bsn_tlv_multicast_interface_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_multicast_interface_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4843,6 +4867,7 @@ of_bsn_tlv_name_new(of_version_t version)
     }
 
     of_bsn_tlv_name_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_name_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4973,6 +4998,9 @@ of_bsn_tlv_name_value_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = value->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, value, cur_len);
 
@@ -4987,6 +5015,72 @@ of_bsn_tlv_name_value_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for value in an object of type of_bsn_tlv_name.
+ * @param obj Pointer to an object of type of_bsn_tlv_name.
+ * @param bytes The length of value
+ * @param value Set to where value is written in the object
+ *
+ * The object is resized for bytes of value, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bsn_tlv_name_value_reserve(
+    of_bsn_tlv_name_t *obj,
+    int bytes,
+    uint8_t **value)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BSN_TLV_NAME);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 4;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *value = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -5063,6 +5157,7 @@ of_bsn_tlv_ndp_offload_new(of_version_t version)
     }
 
     of_bsn_tlv_ndp_offload_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ndp_offload_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5185,6 +5280,7 @@ of_bsn_tlv_ndp_static_new(of_version_t version)
     }
 
     of_bsn_tlv_ndp_static_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ndp_static_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5307,6 +5403,7 @@ of_bsn_tlv_negate_new(of_version_t version)
     }
 
     of_bsn_tlv_negate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_negate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5429,6 +5526,7 @@ of_bsn_tlv_next_hop_ipv4_new(of_version_t version)
     }
 
     of_bsn_tlv_next_hop_ipv4_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_next_hop_ipv4_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5631,6 +5729,7 @@ of_bsn_tlv_next_hop_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_next_hop_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_next_hop_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5833,6 +5932,7 @@ of_bsn_tlv_nexthop_type_vxlan_new(of_version_t version)
     }
 
     of_bsn_tlv_nexthop_type_vxlan_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_nexthop_type_vxlan_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5955,6 +6055,7 @@ of_bsn_tlv_offset_new(of_version_t version)
     }
 
     of_bsn_tlv_offset_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_offset_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -74,6 +74,7 @@ of_bsn_tlv_parent_port_new(of_version_t version)
     }
 
     of_bsn_tlv_parent_port_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_parent_port_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -277,6 +278,7 @@ of_bsn_tlv_partner_key_new(of_version_t version)
     }
 
     of_bsn_tlv_partner_key_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_partner_key_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -479,6 +481,7 @@ of_bsn_tlv_partner_port_num_new(of_version_t version)
     }
 
     of_bsn_tlv_partner_port_num_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_partner_port_num_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -681,6 +684,7 @@ of_bsn_tlv_partner_port_priority_new(of_version_t version)
     }
 
     of_bsn_tlv_partner_port_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_partner_port_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -883,6 +887,7 @@ of_bsn_tlv_partner_state_new(of_version_t version)
     }
 
     of_bsn_tlv_partner_state_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_partner_state_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1085,6 +1090,7 @@ of_bsn_tlv_partner_system_mac_new(of_version_t version)
     }
 
     of_bsn_tlv_partner_system_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_partner_system_mac_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1287,6 +1293,7 @@ of_bsn_tlv_partner_system_priority_new(of_version_t version)
     }
 
     of_bsn_tlv_partner_system_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_partner_system_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1489,6 +1496,7 @@ of_bsn_tlv_port_new(of_version_t version)
     }
 
     of_bsn_tlv_port_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_port_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1692,6 +1700,7 @@ of_bsn_tlv_port_usage_new(of_version_t version)
     }
 
     of_bsn_tlv_port_usage_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_port_usage_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1894,6 +1903,7 @@ of_bsn_tlv_port_vxlan_mode_new(of_version_t version)
     }
 
     of_bsn_tlv_port_vxlan_mode_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_port_vxlan_mode_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2096,6 +2106,7 @@ of_bsn_tlv_priority_new(of_version_t version)
     }
 
     of_bsn_tlv_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2298,6 +2309,7 @@ of_bsn_tlv_push_vlan_on_ingress_new(of_version_t version)
     }
 
     of_bsn_tlv_push_vlan_on_ingress_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_push_vlan_on_ingress_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2420,6 +2432,7 @@ of_bsn_tlv_qos_priority_new(of_version_t version)
     }
 
     of_bsn_tlv_qos_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_qos_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2622,6 +2635,7 @@ of_bsn_tlv_queue_id_new(of_version_t version)
     }
 
     of_bsn_tlv_queue_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_queue_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2824,6 +2838,7 @@ of_bsn_tlv_queue_weight_new(of_version_t version)
     }
 
     of_bsn_tlv_queue_weight_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_queue_weight_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3026,6 +3041,7 @@ of_bsn_tlv_rate_limit_new(of_version_t version)
     }
 
     of_bsn_tlv_rate_limit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_rate_limit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3228,6 +3244,7 @@ of_bsn_tlv_rate_unit_new(of_version_t version)
     }
 
     of_bsn_tlv_rate_unit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_rate_unit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3430,6 +3447,7 @@ of_bsn_tlv_reference_new(of_version_t version)
     }
 
     of_bsn_tlv_reference_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_reference_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3682,6 +3700,10 @@ of_bsn_tlv_reference_key_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(key, 0), new_len);
@@ -3776,6 +3798,7 @@ of_bsn_tlv_reply_packets_new(of_version_t version)
     }
 
     of_bsn_tlv_reply_packets_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_reply_packets_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3978,6 +4001,7 @@ of_bsn_tlv_request_packets_new(of_version_t version)
     }
 
     of_bsn_tlv_request_packets_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_request_packets_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4180,6 +4204,7 @@ of_bsn_tlv_rx_bytes_new(of_version_t version)
     }
 
     of_bsn_tlv_rx_bytes_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_rx_bytes_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4382,6 +4407,7 @@ of_bsn_tlv_rx_packets_new(of_version_t version)
     }
 
     of_bsn_tlv_rx_packets_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_rx_packets_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4584,6 +4610,7 @@ of_bsn_tlv_sampling_rate_new(of_version_t version)
     }
 
     of_bsn_tlv_sampling_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_sampling_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4786,6 +4813,7 @@ of_bsn_tlv_set_loopback_mode_new(of_version_t version)
     }
 
     of_bsn_tlv_set_loopback_mode_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_set_loopback_mode_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4908,6 +4936,7 @@ of_bsn_tlv_status_new(of_version_t version)
     }
 
     of_bsn_tlv_status_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_status_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5110,6 +5139,7 @@ of_bsn_tlv_strip_mpls_l2_on_ingress_new(of_version_t version)
     }
 
     of_bsn_tlv_strip_mpls_l2_on_ingress_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_strip_mpls_l2_on_ingress_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5232,6 +5262,7 @@ of_bsn_tlv_strip_mpls_l3_on_ingress_new(of_version_t version)
     }
 
     of_bsn_tlv_strip_mpls_l3_on_ingress_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_strip_mpls_l3_on_ingress_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5354,6 +5385,7 @@ of_bsn_tlv_strip_vlan_on_egress_new(of_version_t version)
     }
 
     of_bsn_tlv_strip_vlan_on_egress_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_strip_vlan_on_egress_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5476,6 +5508,7 @@ of_bsn_tlv_sub_agent_id_new(of_version_t version)
     }
 
     of_bsn_tlv_sub_agent_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_sub_agent_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5678,6 +5711,7 @@ of_bsn_tlv_tcp_dst_new(of_version_t version)
     }
 
     of_bsn_tlv_tcp_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_tcp_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5880,6 +5914,7 @@ of_bsn_tlv_tcp_flags_new(of_version_t version)
     }
 
     of_bsn_tlv_tcp_flags_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_tcp_flags_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6082,6 +6117,7 @@ of_bsn_tlv_tcp_src_new(of_version_t version)
     }
 
     of_bsn_tlv_tcp_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_tcp_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -74,6 +74,7 @@ of_bsn_tlv_ttl_new(of_version_t version)
     }
 
     of_bsn_tlv_ttl_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_ttl_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -276,6 +277,7 @@ of_bsn_tlv_tunnel_capability_new(of_version_t version)
     }
 
     of_bsn_tlv_tunnel_capability_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_tunnel_capability_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -478,6 +480,7 @@ of_bsn_tlv_tx_bytes_new(of_version_t version)
     }
 
     of_bsn_tlv_tx_bytes_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_tx_bytes_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -680,6 +683,7 @@ of_bsn_tlv_tx_packets_new(of_version_t version)
     }
 
     of_bsn_tlv_tx_packets_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_tx_packets_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -882,6 +886,7 @@ of_bsn_tlv_udf_anchor_new(of_version_t version)
     }
 
     of_bsn_tlv_udf_anchor_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_udf_anchor_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1084,6 +1089,7 @@ of_bsn_tlv_udf_id_new(of_version_t version)
     }
 
     of_bsn_tlv_udf_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_udf_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1286,6 +1292,7 @@ of_bsn_tlv_udf_length_new(of_version_t version)
     }
 
     of_bsn_tlv_udf_length_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_udf_length_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1488,6 +1495,7 @@ of_bsn_tlv_udf_offset_new(of_version_t version)
     }
 
     of_bsn_tlv_udf_offset_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_udf_offset_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1690,6 +1698,7 @@ of_bsn_tlv_udp_dst_new(of_version_t version)
     }
 
     of_bsn_tlv_udp_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_udp_dst_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1892,6 +1901,7 @@ of_bsn_tlv_udp_src_new(of_version_t version)
     }
 
     of_bsn_tlv_udp_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_udp_src_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2094,6 +2104,7 @@ of_bsn_tlv_uint64_list_new(of_version_t version)
     }
 
     of_bsn_tlv_uint64_list_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_uint64_list_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2266,6 +2277,10 @@ of_bsn_tlv_uint64_list_value_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(value, 0), new_len);
@@ -2360,6 +2375,7 @@ of_bsn_tlv_unicast_query_timeout_new(of_version_t version)
     }
 
     of_bsn_tlv_unicast_query_timeout_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_unicast_query_timeout_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2562,6 +2578,7 @@ of_bsn_tlv_unicast_rate_new(of_version_t version)
     }
 
     of_bsn_tlv_unicast_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_unicast_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2764,6 +2781,7 @@ of_bsn_tlv_unknown_multicast_rate_new(of_version_t version)
     }
 
     of_bsn_tlv_unknown_multicast_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_unknown_multicast_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2966,6 +2984,7 @@ of_bsn_tlv_untagged_new(of_version_t version)
     }
 
     of_bsn_tlv_untagged_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_untagged_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3088,6 +3107,7 @@ of_bsn_tlv_use_packet_state_new(of_version_t version)
     }
 
     of_bsn_tlv_use_packet_state_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_use_packet_state_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3290,6 +3310,7 @@ of_bsn_tlv_vfi_new(of_version_t version)
     }
 
     of_bsn_tlv_vfi_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vfi_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3492,6 +3513,7 @@ of_bsn_tlv_vfp_class_id_new(of_version_t version)
     }
 
     of_bsn_tlv_vfp_class_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vfp_class_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3694,6 +3716,7 @@ of_bsn_tlv_vlan_mac_list_new(of_version_t version)
     }
 
     of_bsn_tlv_vlan_mac_list_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vlan_mac_list_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3866,6 +3889,10 @@ of_bsn_tlv_vlan_mac_list_key_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(key, 0), new_len);
@@ -3960,6 +3987,7 @@ of_bsn_tlv_vlan_pcp_new(of_version_t version)
     }
 
     of_bsn_tlv_vlan_pcp_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vlan_pcp_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4162,6 +4190,7 @@ of_bsn_tlv_vlan_vid_new(of_version_t version)
     }
 
     of_bsn_tlv_vlan_vid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vlan_vid_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4364,6 +4393,7 @@ of_bsn_tlv_vlan_vid_mask_new(of_version_t version)
     }
 
     of_bsn_tlv_vlan_vid_mask_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vlan_vid_mask_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4566,6 +4596,7 @@ of_bsn_tlv_vni_new(of_version_t version)
     }
 
     of_bsn_tlv_vni_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vni_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4768,6 +4799,7 @@ of_bsn_tlv_vpn_key_new(of_version_t version)
     }
 
     of_bsn_tlv_vpn_key_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vpn_key_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4970,6 +5002,7 @@ of_bsn_tlv_vrf_new(of_version_t version)
     }
 
     of_bsn_tlv_vrf_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vrf_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5172,6 +5205,7 @@ of_bsn_tlv_vxlan_egress_lag_new(of_version_t version)
     }
 
     of_bsn_tlv_vxlan_egress_lag_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_tlv_vxlan_egress_lag_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5297,6 +5331,7 @@ of_bsn_vlan_counter_clear_new(of_version_t version)
     }
 
     of_bsn_vlan_counter_clear_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_vlan_counter_clear_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5725,6 +5760,7 @@ of_bsn_vlan_counter_stats_entry_new(of_version_t version)
     }
 
     of_bsn_vlan_counter_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -5976,6 +6012,10 @@ of_bsn_vlan_counter_stats_entry_values_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(values, 0), new_len);
@@ -6074,6 +6114,7 @@ of_bsn_vlan_counter_stats_reply_new(of_version_t version)
     }
 
     of_bsn_vlan_counter_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_vlan_counter_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6566,6 +6607,10 @@ of_bsn_vlan_counter_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -6664,6 +6709,7 @@ of_bsn_vlan_counter_stats_request_new(of_version_t version)
     }
 
     of_bsn_vlan_counter_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_vlan_counter_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7172,6 +7218,7 @@ of_bsn_vlan_mac_new(of_version_t version)
     }
 
     of_bsn_vlan_mac_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -7438,6 +7485,7 @@ of_bsn_vrf_counter_stats_entry_new(of_version_t version)
     }
 
     of_bsn_vrf_counter_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -7689,6 +7737,10 @@ of_bsn_vrf_counter_stats_entry_values_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(values, 0), new_len);
@@ -78,6 +78,7 @@ of_bsn_vrf_counter_stats_reply_new(of_version_t version)
     }
 
     of_bsn_vrf_counter_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_vrf_counter_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -570,6 +571,10 @@ of_bsn_vrf_counter_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -668,6 +673,7 @@ of_bsn_vrf_counter_stats_request_new(of_version_t version)
     }
 
     of_bsn_vrf_counter_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_vrf_counter_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1176,6 +1182,7 @@ of_calient_flow_stats_entry_new(of_version_t version)
     }
 
     of_calient_flow_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -2562,6 +2569,10 @@ of_calient_flow_stats_entry_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -2703,6 +2714,10 @@ of_calient_flow_stats_entry_instructions_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instructions, 0), new_len);
@@ -2811,6 +2826,7 @@ of_calient_stats_reply_new(of_version_t version)
     }
 
     of_calient_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3246,6 +3262,7 @@ of_calient_flow_stats_reply_new(of_version_t version)
     }
 
     of_calient_flow_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_flow_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3728,6 +3745,10 @@ of_calient_flow_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -3836,6 +3857,7 @@ of_calient_stats_request_new(of_version_t version)
     }
 
     of_calient_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4271,6 +4293,7 @@ of_calient_flow_stats_request_new(of_version_t version)
     }
 
     of_calient_flow_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_flow_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5112,6 +5135,10 @@ of_calient_flow_stats_request_match_set(
         of_octets_t match_octets;
         OF_TRY(of_match_serialize(ver, match, &match_octets));
         new_len = match_octets.bytes;
+        if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+            FREE(match_octets.data);
+            return OF_ERROR_RESOURCE;
+        }
         of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
             match_octets.data, new_len);
         /* Free match serialized octets */
@@ -5213,6 +5240,7 @@ of_calient_port_desc_prop_new(of_version_t version)
     }
 
     of_calient_port_desc_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5332,6 +5360,7 @@ of_calient_port_desc_prop_optical_new(of_version_t version)
     }
 
     of_calient_port_desc_prop_optical_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_port_desc_prop_optical_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6688,6 +6717,7 @@ of_calient_port_desc_stats_entry_new(of_version_t version)
     }
 
     of_calient_port_desc_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -7248,6 +7278,10 @@ of_calient_port_desc_stats_entry_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -7345,6 +7379,7 @@ of_calient_port_desc_stats_reply_new(of_version_t version)
     }
 
     of_calient_port_desc_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_port_desc_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7827,6 +7862,10 @@ of_calient_port_desc_stats_reply_port_desc_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(port_desc, 0), new_len);
@@ -7924,6 +7963,7 @@ of_calient_port_desc_stats_request_new(of_version_t version)
     }
 
     of_calient_port_desc_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_port_desc_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8344,6 +8384,7 @@ of_calient_port_stats_entry_new(of_version_t version)
     }
 
     of_calient_port_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -9483,6 +9524,7 @@ of_calient_port_stats_reply_new(of_version_t version)
     }
 
     of_calient_port_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_port_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9965,6 +10007,10 @@ of_calient_port_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -10062,6 +10108,7 @@ of_calient_port_stats_request_new(of_version_t version)
     }
 
     of_calient_port_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_port_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10577,6 +10624,7 @@ of_calient_port_status_new(of_version_t version)
     }
 
     of_calient_port_status_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_calient_port_status_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11059,6 +11107,10 @@ of_calient_port_status_desc_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(desc, 0), new_len);
@@ -11155,6 +11207,7 @@ of_circuit_port_status_new(of_version_t version)
     }
 
     of_circuit_port_status_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_circuit_port_status_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12139,6 +12192,7 @@ of_circuit_ports_reply_new(of_version_t version)
     }
 
     of_circuit_ports_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_circuit_ports_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12621,6 +12675,10 @@ of_circuit_ports_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -12718,6 +12776,7 @@ of_circuit_ports_request_new(of_version_t version)
     }
 
     of_circuit_ports_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_circuit_ports_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -13163,6 +13222,7 @@ of_exp_ext_ad_id_new(of_version_t version)
     }
 
     of_exp_ext_ad_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -13439,6 +13499,7 @@ of_exp_ext_ad_id_port_otn_new(of_version_t version)
     }
 
     of_exp_ext_ad_id_port_otn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_ext_ad_id_port_otn_push_wire_types(obj);
 
     return obj;
@@ -13950,6 +14011,7 @@ of_exp_ext_ad_id_sonet_new(of_version_t version)
     }
 
     of_exp_ext_ad_id_sonet_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_ext_ad_id_sonet_push_wire_types(obj);
 
     return obj;
@@ -14316,6 +14378,7 @@ of_exp_optical_ext_reply_new(of_version_t version)
     }
 
     of_exp_optical_ext_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -14759,6 +14822,7 @@ of_exp_optical_ext_request_new(of_version_t version)
     }
 
     of_exp_optical_ext_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -15177,6 +15241,7 @@ of_exp_port_new(of_version_t version)
     }
 
     of_exp_port_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -15736,6 +15801,10 @@ of_exp_port_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -15816,6 +15885,7 @@ of_exp_port_adjacency_new(of_version_t version)
     }
 
     of_exp_port_adjacency_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -16375,6 +16445,10 @@ of_exp_port_adjacency_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -16468,6 +16542,7 @@ of_exp_port_adjacency_id_new(of_version_t version)
     }
 
     of_exp_port_adjacency_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_adjacency_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -16638,6 +16713,10 @@ of_exp_port_adjacency_id_ad_id_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(ad_id, 0), new_len);
@@ -16735,6 +16814,7 @@ of_exp_port_adjacency_reply_new(of_version_t version)
     }
 
     of_exp_port_adjacency_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_adjacency_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -17217,6 +17297,10 @@ of_exp_port_adjacency_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -17314,6 +17398,7 @@ of_exp_port_adjacency_request_new(of_version_t version)
     }
 
     of_exp_port_adjacency_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_adjacency_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -17747,6 +17832,7 @@ of_exp_port_des_prop_header_new(of_version_t version)
     }
 
     of_exp_port_des_prop_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_des_prop_header_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -17868,6 +17954,7 @@ of_exp_port_desc_prop_optical_transport_new(of_version_t version)
     }
 
     of_exp_port_desc_prop_optical_transport_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_desc_prop_optical_transport_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -18194,6 +18281,10 @@ of_exp_port_desc_prop_optical_transport_features_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(features, 0), new_len);
@@ -18291,6 +18382,7 @@ of_exp_port_desc_reply_new(of_version_t version)
     }
 
     of_exp_port_desc_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_desc_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -18773,6 +18865,10 @@ of_exp_port_desc_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
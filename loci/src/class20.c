@@ -77,6 +77,7 @@ of_exp_port_desc_request_new(of_version_t version)
     }
 
     of_exp_port_desc_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_desc_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -516,6 +517,7 @@ of_exp_port_optical_transport_feature_header_new(of_version_t version)
     }
 
     of_exp_port_optical_transport_feature_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -700,6 +702,7 @@ of_exp_port_optical_transport_layer_entry_new(of_version_t version)
     }
 
     of_exp_port_optical_transport_layer_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1053,6 +1056,7 @@ of_exp_port_optical_transport_layer_stack_new(of_version_t version)
     }
 
     of_exp_port_optical_transport_layer_stack_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_exp_port_optical_transport_layer_stack_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1301,6 +1305,10 @@ of_exp_port_optical_transport_layer_stack_value_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(value, 0), new_len);
@@ -1415,6 +1423,7 @@ of_hello_elem_new(of_version_t version)
     }
 
     of_hello_elem_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1535,6 +1544,7 @@ of_hello_elem_versionbitmap_new(of_version_t version)
     }
 
     of_hello_elem_versionbitmap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_hello_elem_versionbitmap_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1707,6 +1717,10 @@ of_hello_elem_versionbitmap_bitmaps_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(bitmaps, 0), new_len);
@@ -1787,6 +1801,7 @@ of_ieee80211_mcs_info_new(of_version_t version)
     }
 
     of_ieee80211_mcs_info_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2127,6 +2142,7 @@ of_ieee80211_ht_cap_new(of_version_t version)
     }
 
     of_ieee80211_ht_cap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2451,6 +2467,10 @@ of_ieee80211_ht_cap_mcs_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(mcs, 0), new_len);
@@ -2765,6 +2785,7 @@ of_ieee80211_vht_mcs_info_new(of_version_t version)
     }
 
     of_ieee80211_vht_mcs_info_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3183,6 +3204,7 @@ of_ieee80211_vht_cap_new(of_version_t version)
     }
 
     of_ieee80211_vht_cap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3429,6 +3451,10 @@ of_ieee80211_vht_cap_mcs_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(mcs, 0), new_len);
@@ -3579,6 +3605,7 @@ of_instruction_id_new(of_version_t version)
     }
 
     of_instruction_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3699,6 +3726,7 @@ of_instruction_id_apply_actions_new(of_version_t version)
     }
 
     of_instruction_id_apply_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_apply_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3928,6 +3956,7 @@ of_instruction_bsn_new(of_version_t version)
     }
 
     of_instruction_bsn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4228,6 +4257,7 @@ of_instruction_id_experimenter_new(of_version_t version)
     }
 
     of_instruction_id_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4535,6 +4565,7 @@ of_instruction_id_bsn_new(of_version_t version)
     }
 
     of_instruction_id_bsn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4817,6 +4848,7 @@ of_instruction_bsn_arp_offload_new(of_version_t version)
     }
 
     of_instruction_bsn_arp_offload_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_arp_offload_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5101,6 +5133,7 @@ of_instruction_id_bsn_arp_offload_new(of_version_t version)
     }
 
     of_instruction_id_bsn_arp_offload_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_arp_offload_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5385,6 +5418,7 @@ of_instruction_bsn_auto_negotiation_new(of_version_t version)
     }
 
     of_instruction_bsn_auto_negotiation_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_auto_negotiation_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5669,6 +5703,7 @@ of_instruction_id_bsn_auto_negotiation_new(of_version_t version)
     }
 
     of_instruction_id_bsn_auto_negotiation_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_auto_negotiation_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5953,6 +5988,7 @@ of_instruction_bsn_deny_new(of_version_t version)
     }
 
     of_instruction_bsn_deny_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_deny_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6237,6 +6273,7 @@ of_instruction_id_bsn_deny_new(of_version_t version)
     }
 
     of_instruction_id_bsn_deny_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_deny_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6521,6 +6558,7 @@ of_instruction_bsn_dhcp_offload_new(of_version_t version)
     }
 
     of_instruction_bsn_dhcp_offload_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_dhcp_offload_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6805,6 +6843,7 @@ of_instruction_id_bsn_dhcp_offload_new(of_version_t version)
     }
 
     of_instruction_id_bsn_dhcp_offload_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_dhcp_offload_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7089,6 +7128,7 @@ of_instruction_bsn_disable_l3_new(of_version_t version)
     }
 
     of_instruction_bsn_disable_l3_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_disable_l3_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7373,6 +7413,7 @@ of_instruction_id_bsn_disable_l3_new(of_version_t version)
     }
 
     of_instruction_id_bsn_disable_l3_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_disable_l3_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7656,6 +7697,7 @@ of_instruction_bsn_disable_split_horizon_check_new(of_version_t version)
     }
 
     of_instruction_bsn_disable_split_horizon_check_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_disable_split_horizon_check_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7935,6 +7977,7 @@ of_instruction_id_bsn_disable_split_horizon_check_new(of_version_t version)
     }
 
     of_instruction_id_bsn_disable_split_horizon_check_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_disable_split_horizon_check_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8215,6 +8258,7 @@ of_instruction_bsn_disable_src_mac_check_new(of_version_t version)
     }
 
     of_instruction_bsn_disable_src_mac_check_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_disable_src_mac_check_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8499,6 +8543,7 @@ of_instruction_id_bsn_disable_src_mac_check_new(of_version_t version)
     }
 
     of_instruction_id_bsn_disable_src_mac_check_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_disable_src_mac_check_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8783,6 +8828,7 @@ of_instruction_bsn_disable_vlan_counters_new(of_version_t version)
     }
 
     of_instruction_bsn_disable_vlan_counters_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_disable_vlan_counters_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -9067,6 +9113,7 @@ of_instruction_id_bsn_disable_vlan_counters_new(of_version_t version)
     }
 
     of_instruction_id_bsn_disable_vlan_counters_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_disable_vlan_counters_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -9351,6 +9398,7 @@ of_instruction_bsn_hash_select_new(of_version_t version)
     }
 
     of_instruction_bsn_hash_select_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_hash_select_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
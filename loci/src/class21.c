@@ -76,6 +76,7 @@ of_instruction_id_bsn_hash_select_new(of_version_t version)
     }
 
     of_instruction_id_bsn_hash_select_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_hash_select_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -360,6 +361,7 @@ of_instruction_bsn_internal_priority_new(of_version_t version)
     }
 
     of_instruction_bsn_internal_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_internal_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -724,6 +726,7 @@ of_instruction_id_bsn_internal_priority_new(of_version_t version)
     }
 
     of_instruction_id_bsn_internal_priority_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_internal_priority_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1008,6 +1011,7 @@ of_instruction_bsn_ndp_offload_new(of_version_t version)
     }
 
     of_instruction_bsn_ndp_offload_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_ndp_offload_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1292,6 +1296,7 @@ of_instruction_id_bsn_ndp_offload_new(of_version_t version)
     }
 
     of_instruction_id_bsn_ndp_offload_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_ndp_offload_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1576,6 +1581,7 @@ of_instruction_bsn_packet_of_death_new(of_version_t version)
     }
 
     of_instruction_bsn_packet_of_death_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_packet_of_death_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1860,6 +1866,7 @@ of_instruction_id_bsn_packet_of_death_new(of_version_t version)
     }
 
     of_instruction_id_bsn_packet_of_death_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_packet_of_death_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2144,6 +2151,7 @@ of_instruction_bsn_permit_new(of_version_t version)
     }
 
     of_instruction_bsn_permit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_permit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2428,6 +2436,7 @@ of_instruction_id_bsn_permit_new(of_version_t version)
     }
 
     of_instruction_id_bsn_permit_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_permit_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2712,6 +2721,7 @@ of_instruction_bsn_prioritize_pdus_new(of_version_t version)
     }
 
     of_instruction_bsn_prioritize_pdus_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_prioritize_pdus_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2996,6 +3006,7 @@ of_instruction_id_bsn_prioritize_pdus_new(of_version_t version)
     }
 
     of_instruction_id_bsn_prioritize_pdus_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_prioritize_pdus_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3280,6 +3291,7 @@ of_instruction_bsn_require_vlan_xlate_new(of_version_t version)
     }
 
     of_instruction_bsn_require_vlan_xlate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_require_vlan_xlate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3564,6 +3576,7 @@ of_instruction_id_bsn_require_vlan_xlate_new(of_version_t version)
     }
 
     of_instruction_id_bsn_require_vlan_xlate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_require_vlan_xlate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3848,6 +3861,7 @@ of_instruction_bsn_span_destination_new(of_version_t version)
     }
 
     of_instruction_bsn_span_destination_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_bsn_span_destination_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4132,6 +4146,7 @@ of_instruction_id_bsn_span_destination_new(of_version_t version)
     }
 
     of_instruction_id_bsn_span_destination_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_bsn_span_destination_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4414,6 +4429,7 @@ of_instruction_id_clear_actions_new(of_version_t version)
     }
 
     of_instruction_id_clear_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_clear_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4536,6 +4552,7 @@ of_instruction_id_goto_table_new(of_version_t version)
     }
 
     of_instruction_id_goto_table_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_goto_table_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4658,6 +4675,7 @@ of_instruction_meter_new(of_version_t version)
     }
 
     of_instruction_meter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_meter_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4860,6 +4878,7 @@ of_instruction_id_meter_new(of_version_t version)
     }
 
     of_instruction_id_meter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_meter_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4982,6 +5001,7 @@ of_instruction_id_write_actions_new(of_version_t version)
     }
 
     of_instruction_id_write_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_write_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5104,6 +5124,7 @@ of_instruction_id_write_metadata_new(of_version_t version)
     }
 
     of_instruction_id_write_metadata_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_instruction_id_write_metadata_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5258,6 +5279,7 @@ of_meter_band_new(of_version_t version)
     }
 
     of_meter_band_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5378,6 +5400,7 @@ of_meter_band_drop_new(of_version_t version)
     }
 
     of_meter_band_drop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_band_drop_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5660,6 +5683,7 @@ of_meter_band_dscp_remark_new(of_version_t version)
     }
 
     of_meter_band_dscp_remark_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_band_dscp_remark_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6022,6 +6046,7 @@ of_meter_band_experimenter_new(of_version_t version)
     }
 
     of_meter_band_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_band_experimenter_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6370,6 +6395,7 @@ of_meter_band_stats_new(of_version_t version)
     }
 
     of_meter_band_stats_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -6636,6 +6662,7 @@ of_meter_config_new(of_version_t version)
     }
 
     of_meter_config_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -6967,6 +6994,10 @@ of_meter_config_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -7063,6 +7094,7 @@ of_meter_config_stats_reply_new(of_version_t version)
     }
 
     of_meter_config_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_config_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7395,6 +7427,10 @@ of_meter_config_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -7491,6 +7527,7 @@ of_meter_config_stats_request_new(of_version_t version)
     }
 
     of_meter_config_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_config_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7839,6 +7876,7 @@ of_meter_features_new(of_version_t version)
     }
 
     of_meter_features_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -8361,6 +8399,7 @@ of_meter_features_stats_reply_new(of_version_t version)
     }
 
     of_meter_features_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_features_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8693,6 +8732,10 @@ of_meter_features_stats_reply_features_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(features, 0), new_len);
@@ -8789,6 +8832,7 @@ of_meter_features_stats_request_new(of_version_t version)
     }
 
     of_meter_features_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_features_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
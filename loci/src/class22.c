@@ -75,6 +75,7 @@ of_meter_mod_new(of_version_t version)
     }
 
     of_meter_mod_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_mod_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -485,6 +486,10 @@ of_meter_mod_bands_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(bands, 0), new_len);
@@ -627,6 +632,10 @@ of_meter_mod_meters_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(meters, 0), new_len);
@@ -723,6 +732,7 @@ of_meter_mod_failed_error_msg_new(of_version_t version)
     }
 
     of_meter_mod_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_mod_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1013,6 +1023,9 @@ of_meter_mod_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -1027,6 +1040,72 @@ of_meter_mod_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_meter_mod_failed_error_msg.
+ * @param obj Pointer to an object of type of_meter_mod_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_meter_mod_failed_error_msg_data_reserve(
+    of_meter_mod_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_METER_MOD_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -1089,6 +1168,7 @@ of_meter_stats_new(of_version_t version)
     }
 
     of_meter_stats_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_stats_wire_length_set(obj, obj->length);
 
     return obj;
@@ -1740,6 +1820,10 @@ of_meter_stats_band_stats_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(band_stats, 0), new_len);
@@ -1836,6 +1920,7 @@ of_meter_stats_reply_new(of_version_t version)
     }
 
     of_meter_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2168,6 +2253,10 @@ of_meter_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -2264,6 +2353,7 @@ of_meter_stats_request_new(of_version_t version)
     }
 
     of_meter_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_meter_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2612,6 +2702,7 @@ of_oplink_channel_power_new(of_version_t version)
     }
 
     of_oplink_channel_power_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3055,6 +3146,7 @@ of_oplink_stats_reply_new(of_version_t version)
     }
 
     of_oplink_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -3490,6 +3582,7 @@ of_oplink_channel_power_reply_new(of_version_t version)
     }
 
     of_oplink_channel_power_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oplink_channel_power_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3972,6 +4065,10 @@ of_oplink_channel_power_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -4077,6 +4174,7 @@ of_oplink_stats_request_new(of_version_t version)
     }
 
     of_oplink_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4512,6 +4610,7 @@ of_oplink_channel_power_request_new(of_version_t version)
     }
 
     of_oplink_channel_power_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oplink_channel_power_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4954,6 +5053,7 @@ of_oplink_exp_header_new(of_version_t version)
     }
 
     of_oplink_exp_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5294,6 +5394,7 @@ of_oplink_port_power_new(of_version_t version)
     }
 
     of_oplink_port_power_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5573,6 +5674,7 @@ of_oplink_port_power_reply_new(of_version_t version)
     }
 
     of_oplink_port_power_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oplink_port_power_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6055,6 +6157,10 @@ of_oplink_port_power_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -6152,6 +6258,7 @@ of_oplink_port_power_request_new(of_version_t version)
     }
 
     of_oplink_port_power_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oplink_port_power_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6588,6 +6695,7 @@ of_oplink_port_power_set_new(of_version_t version)
     }
 
     of_oplink_port_power_set_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oplink_port_power_set_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7100,6 +7208,7 @@ of_oxm_bsn_inner_eth_dst_new(of_version_t version)
     }
 
     of_oxm_bsn_inner_eth_dst_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_inner_eth_dst_push_wire_types(obj);
 
     return obj;
@@ -7301,6 +7410,7 @@ of_oxm_bsn_inner_eth_dst_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_inner_eth_dst_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_inner_eth_dst_masked_push_wire_types(obj);
 
     return obj;
@@ -7582,6 +7692,7 @@ of_oxm_bsn_inner_eth_src_new(of_version_t version)
     }
 
     of_oxm_bsn_inner_eth_src_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_inner_eth_src_push_wire_types(obj);
 
     return obj;
@@ -7783,6 +7894,7 @@ of_oxm_bsn_inner_eth_src_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_inner_eth_src_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_inner_eth_src_masked_push_wire_types(obj);
 
     return obj;
@@ -8064,6 +8176,7 @@ of_oxm_bsn_inner_vlan_vid_new(of_version_t version)
     }
 
     of_oxm_bsn_inner_vlan_vid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_inner_vlan_vid_push_wire_types(obj);
 
     return obj;
@@ -8265,6 +8378,7 @@ of_oxm_bsn_inner_vlan_vid_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_inner_vlan_vid_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_inner_vlan_vid_masked_push_wire_types(obj);
 
     return obj;
@@ -8546,6 +8660,7 @@ of_oxm_bsn_vfi_new(of_version_t version)
     }
 
     of_oxm_bsn_vfi_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vfi_push_wire_types(obj);
 
     return obj;
@@ -8747,6 +8862,7 @@ of_oxm_bsn_vfi_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_vfi_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vfi_masked_push_wire_types(obj);
 
     return obj;
@@ -9028,6 +9144,7 @@ of_oxm_bsn_vxlan_network_id_new(of_version_t version)
     }
 
     of_oxm_bsn_vxlan_network_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vxlan_network_id_push_wire_types(obj);
 
     return obj;
@@ -9229,6 +9346,7 @@ of_oxm_bsn_vxlan_network_id_masked_new(of_version_t version)
     }
 
     of_oxm_bsn_vxlan_network_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_bsn_vxlan_network_id_masked_push_wire_types(obj);
 
     return obj;
@@ -9509,6 +9627,7 @@ of_oxm_circuit_och_sigid_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigid_push_wire_types(obj);
 
     return obj;
@@ -9707,6 +9826,7 @@ of_oxm_circuit_och_sigid_basic_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigid_basic_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigid_basic_push_wire_types(obj);
 
     return obj;
@@ -9905,6 +10025,7 @@ of_oxm_circuit_och_sigid_basic_masked_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigid_basic_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigid_basic_masked_push_wire_types(obj);
 
     return obj;
@@ -10181,6 +10302,7 @@ of_oxm_circuit_och_sigid_masked_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigid_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigid_masked_push_wire_types(obj);
 
     return obj;
@@ -10457,6 +10579,7 @@ of_oxm_circuit_och_sigtype_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigtype_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigtype_push_wire_types(obj);
 
     return obj;
@@ -10655,6 +10778,7 @@ of_oxm_circuit_och_sigtype_basic_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigtype_basic_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigtype_basic_push_wire_types(obj);
 
     return obj;
@@ -10853,6 +10977,7 @@ of_oxm_circuit_och_sigtype_basic_masked_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigtype_basic_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigtype_basic_masked_push_wire_types(obj);
 
     return obj;
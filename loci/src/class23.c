@@ -73,6 +73,7 @@ of_oxm_circuit_och_sigtype_masked_new(of_version_t version)
     }
 
     of_oxm_circuit_och_sigtype_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_circuit_och_sigtype_masked_push_wire_types(obj);
 
     return obj;
@@ -350,6 +351,7 @@ of_oxm_exp_och_sigid_new(of_version_t version)
     }
 
     of_oxm_exp_och_sigid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_och_sigid_push_wire_types(obj);
 
     return obj;
@@ -627,6 +629,7 @@ of_oxm_exp_och_sigid_masked_new(of_version_t version)
     }
 
     of_oxm_exp_och_sigid_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_och_sigid_masked_push_wire_types(obj);
 
     return obj;
@@ -982,6 +985,7 @@ of_oxm_exp_och_sigtype_new(of_version_t version)
     }
 
     of_oxm_exp_och_sigtype_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_och_sigtype_push_wire_types(obj);
 
     return obj;
@@ -1259,6 +1263,7 @@ of_oxm_exp_och_sigtype_masked_new(of_version_t version)
     }
 
     of_oxm_exp_och_sigtype_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_och_sigtype_masked_push_wire_types(obj);
 
     return obj;
@@ -1614,6 +1619,7 @@ of_oxm_exp_odu_sigid_new(of_version_t version)
     }
 
     of_oxm_exp_odu_sigid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_odu_sigid_push_wire_types(obj);
 
     return obj;
@@ -1891,6 +1897,7 @@ of_oxm_exp_odu_sigid_masked_new(of_version_t version)
     }
 
     of_oxm_exp_odu_sigid_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_odu_sigid_masked_push_wire_types(obj);
 
     return obj;
@@ -2246,6 +2253,7 @@ of_oxm_exp_odu_sigtype_new(of_version_t version)
     }
 
     of_oxm_exp_odu_sigtype_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_odu_sigtype_push_wire_types(obj);
 
     return obj;
@@ -2523,6 +2531,7 @@ of_oxm_exp_odu_sigtype_masked_new(of_version_t version)
     }
 
     of_oxm_exp_odu_sigtype_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_exp_odu_sigtype_masked_push_wire_types(obj);
 
     return obj;
@@ -2878,6 +2887,7 @@ of_oxm_ipv6_exthdr_new(of_version_t version)
     }
 
     of_oxm_ipv6_exthdr_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_exthdr_push_wire_types(obj);
 
     return obj;
@@ -3079,6 +3089,7 @@ of_oxm_ipv6_exthdr_masked_new(of_version_t version)
     }
 
     of_oxm_ipv6_exthdr_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ipv6_exthdr_masked_push_wire_types(obj);
 
     return obj;
@@ -3360,6 +3371,7 @@ of_oxm_mpls_bos_new(of_version_t version)
     }
 
     of_oxm_mpls_bos_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_mpls_bos_push_wire_types(obj);
 
     return obj;
@@ -3561,6 +3573,7 @@ of_oxm_mpls_bos_masked_new(of_version_t version)
     }
 
     of_oxm_mpls_bos_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_mpls_bos_masked_push_wire_types(obj);
 
     return obj;
@@ -3841,6 +3854,7 @@ of_oxm_och_sigatt_new(of_version_t version)
     }
 
     of_oxm_och_sigatt_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_och_sigatt_push_wire_types(obj);
 
     return obj;
@@ -4039,6 +4053,7 @@ of_oxm_och_sigatt_basic_new(of_version_t version)
     }
 
     of_oxm_och_sigatt_basic_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_och_sigatt_basic_push_wire_types(obj);
 
     return obj;
@@ -4237,6 +4252,7 @@ of_oxm_och_sigatt_basic_masked_new(of_version_t version)
     }
 
     of_oxm_och_sigatt_basic_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_och_sigatt_basic_masked_push_wire_types(obj);
 
     return obj;
@@ -4513,6 +4529,7 @@ of_oxm_och_sigatt_masked_new(of_version_t version)
     }
 
     of_oxm_och_sigatt_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_och_sigatt_masked_push_wire_types(obj);
 
     return obj;
@@ -4790,6 +4807,7 @@ of_oxm_ofdpa_mpls_l2_port_new(of_version_t version)
     }
 
     of_oxm_ofdpa_mpls_l2_port_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_mpls_l2_port_push_wire_types(obj);
 
     return obj;
@@ -5067,6 +5085,7 @@ of_oxm_ofdpa_mpls_l2_port_masked_new(of_version_t version)
     }
 
     of_oxm_ofdpa_mpls_l2_port_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_mpls_l2_port_masked_push_wire_types(obj);
 
     return obj;
@@ -5422,6 +5441,7 @@ of_oxm_ofdpa_mpls_type_new(of_version_t version)
     }
 
     of_oxm_ofdpa_mpls_type_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_mpls_type_push_wire_types(obj);
 
     return obj;
@@ -5699,6 +5719,7 @@ of_oxm_ofdpa_mpls_type_masked_new(of_version_t version)
     }
 
     of_oxm_ofdpa_mpls_type_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_mpls_type_masked_push_wire_types(obj);
 
     return obj;
@@ -6054,6 +6075,7 @@ of_oxm_ofdpa_ovid_new(of_version_t version)
     }
 
     of_oxm_ofdpa_ovid_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_ovid_push_wire_types(obj);
 
     return obj;
@@ -6331,6 +6353,7 @@ of_oxm_ofdpa_ovid_masked_new(of_version_t version)
     }
 
     of_oxm_ofdpa_ovid_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_ovid_masked_push_wire_types(obj);
 
     return obj;
@@ -6686,6 +6709,7 @@ of_oxm_ofdpa_qos_index_new(of_version_t version)
     }
 
     of_oxm_ofdpa_qos_index_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_qos_index_push_wire_types(obj);
 
     return obj;
@@ -6963,6 +6987,7 @@ of_oxm_ofdpa_qos_index_masked_new(of_version_t version)
     }
 
     of_oxm_ofdpa_qos_index_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_ofdpa_qos_index_masked_push_wire_types(obj);
 
     return obj;
@@ -7318,6 +7343,7 @@ of_oxm_tunnel_id_new(of_version_t version)
     }
 
     of_oxm_tunnel_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tunnel_id_push_wire_types(obj);
 
     return obj;
@@ -7519,6 +7545,7 @@ of_oxm_tunnel_id_masked_new(of_version_t version)
     }
 
     of_oxm_tunnel_id_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_tunnel_id_masked_push_wire_types(obj);
 
     return obj;
@@ -7786,6 +7813,7 @@ of_port_desc_prop_optical_transport_new(of_version_t version)
     }
 
     of_port_desc_prop_optical_transport_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -8142,6 +8170,7 @@ of_port_desc_stats_reply_new(of_version_t version)
     }
 
     of_port_desc_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8474,6 +8503,10 @@ of_port_desc_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -8570,6 +8603,7 @@ of_port_desc_stats_request_new(of_version_t version)
     }
 
     of_port_desc_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8838,6 +8872,7 @@ of_port_optical_new(of_version_t version)
     }
 
     of_port_optical_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -9397,6 +9432,10 @@ of_port_optical_desc_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(desc, 0), new_len);
@@ -9477,6 +9516,7 @@ of_port_optical_transport_application_code_new(of_version_t version)
     }
 
     of_port_optical_transport_application_code_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
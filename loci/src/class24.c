@@ -60,6 +60,7 @@ of_port_optical_transport_layer_entry_new(of_version_t version)
     }
 
     of_port_optical_transport_layer_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -400,6 +401,7 @@ of_port_optical_transport_layer_stack_new(of_version_t version)
     }
 
     of_port_optical_transport_layer_stack_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -646,6 +648,10 @@ of_port_optical_transport_layer_stack_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -778,6 +784,7 @@ of_sdwn_header_new(of_version_t version)
     }
 
     of_sdwn_header_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1134,6 +1141,7 @@ of_sdwn_add_client_new(of_version_t version)
     }
 
     of_sdwn_add_client_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_add_client_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1929,6 +1937,10 @@ of_sdwn_add_client_ht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(ht_capabilities, 0), new_len);
@@ -2071,6 +2083,10 @@ of_sdwn_add_client_vht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(vht_capabilities, 0), new_len);
@@ -2291,6 +2307,10 @@ of_sdwn_add_client_keys_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(keys, 0), new_len);
@@ -2387,6 +2407,7 @@ of_sdwn_add_lvap_new(of_version_t version)
     }
 
     of_sdwn_add_lvap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_add_lvap_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3025,6 +3046,10 @@ of_sdwn_add_lvap_ht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(ht_capabilities, 0), new_len);
@@ -3167,6 +3192,10 @@ of_sdwn_add_lvap_vht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(vht_capabilities, 0), new_len);
@@ -3267,6 +3296,9 @@ of_sdwn_add_lvap_beacon_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = beacon->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, beacon, cur_len);
 
@@ -3281,6 +3313,71 @@ of_sdwn_add_lvap_beacon_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for beacon in an object of type of_sdwn_add_lvap.
+ * @param obj Pointer to an object of type of_sdwn_add_lvap.
+ * @param bytes The length of beacon
+ * @param beacon Set to where beacon is written in the object
+ *
+ * The object is resized for bytes of beacon, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_sdwn_add_lvap_beacon_reserve(
+    of_sdwn_add_lvap_t *obj,
+    int bytes,
+    uint8_t **beacon)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_SDWN_ADD_LVAP);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+        offset = 68;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *beacon = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -3359,6 +3456,7 @@ of_sdwn_del_client_new(of_version_t version)
     }
 
     of_sdwn_del_client_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_del_client_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4108,6 +4206,7 @@ of_sdwn_del_lvap_new(of_version_t version)
     }
 
     of_sdwn_del_lvap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_del_lvap_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4565,6 +4664,7 @@ of_sdwn_entity_new(of_version_t version)
     }
 
     of_sdwn_entity_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -4684,6 +4784,7 @@ of_sdwn_entity_accesspoint_new(of_version_t version)
     }
 
     of_sdwn_entity_accesspoint_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_entity_accesspoint_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5437,6 +5538,9 @@ of_sdwn_entity_accesspoint_ssid_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = ssid->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, ssid, cur_len);
 
@@ -5451,6 +5555,71 @@ of_sdwn_entity_accesspoint_ssid_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for ssid in an object of type of_sdwn_entity_accesspoint.
+ * @param obj Pointer to an object of type of_sdwn_entity_accesspoint.
+ * @param bytes The length of ssid
+ * @param ssid Set to where ssid is written in the object
+ *
+ * The object is resized for bytes of ssid, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_sdwn_entity_accesspoint_ssid_reserve(
+    of_sdwn_entity_accesspoint_t *obj,
+    int bytes,
+    uint8_t **ssid)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_SDWN_ENTITY_ACCESSPOINT);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+        offset = 52;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *ssid = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -5526,6 +5695,7 @@ of_sdwn_entity_band_new(of_version_t version)
     }
 
     of_sdwn_entity_band_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_entity_band_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -5930,6 +6100,10 @@ of_sdwn_entity_band_ht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(ht_capabilities, 0), new_len);
@@ -6072,6 +6246,10 @@ of_sdwn_entity_band_vht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(vht_capabilities, 0), new_len);
@@ -6165,6 +6343,7 @@ of_sdwn_entity_freq_new(of_version_t version)
     }
 
     of_sdwn_entity_freq_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_entity_freq_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6598,6 +6777,7 @@ of_sdwn_entity_nic_new(of_version_t version)
     }
 
     of_sdwn_entity_nic_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_entity_nic_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -6875,6 +7055,7 @@ of_sdwn_entity_rate_new(of_version_t version)
     }
 
     of_sdwn_entity_rate_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_entity_rate_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7230,6 +7411,7 @@ of_sdwn_entity_related_switch_new(of_version_t version)
     }
 
     of_sdwn_entity_related_switch_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_entity_related_switch_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7444,6 +7626,7 @@ of_sdwn_reply_new(of_version_t version)
     }
 
     of_sdwn_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -7879,6 +8062,7 @@ of_sdwn_get_channel_reply_new(of_version_t version)
     }
 
     of_sdwn_get_channel_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_channel_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -8405,6 +8589,7 @@ of_sdwn_request_new(of_version_t version)
     }
 
     of_sdwn_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -8840,6 +9025,7 @@ of_sdwn_get_channel_request_new(of_version_t version)
     }
 
     of_sdwn_get_channel_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_channel_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -9367,6 +9553,7 @@ of_sdwn_get_clients_reply_new(of_version_t version)
     }
 
     of_sdwn_get_clients_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -9881,6 +10068,7 @@ of_sdwn_get_clients_reply_crypto_new(of_version_t version)
     }
 
     of_sdwn_get_clients_reply_crypto_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_clients_reply_crypto_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -10753,6 +10941,10 @@ of_sdwn_get_clients_reply_crypto_ht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(ht_capabilities, 0), new_len);
@@ -10895,6 +11087,10 @@ of_sdwn_get_clients_reply_crypto_vht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(vht_capabilities, 0), new_len);
@@ -11115,6 +11311,10 @@ of_sdwn_get_clients_reply_crypto_keys_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(keys, 0), new_len);
@@ -11213,6 +11413,7 @@ of_sdwn_get_clients_reply_lvap_new(of_version_t version)
     }
 
     of_sdwn_get_clients_reply_lvap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_clients_reply_lvap_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -11807,6 +12008,7 @@ of_sdwn_get_clients_reply_normal_new(of_version_t version)
     }
 
     of_sdwn_get_clients_reply_normal_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_clients_reply_normal_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -12679,6 +12881,10 @@ of_sdwn_get_clients_reply_normal_ht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(ht_capabilities, 0), new_len);
@@ -12821,6 +13027,10 @@ of_sdwn_get_clients_reply_normal_vht_capabilities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(vht_capabilities, 0), new_len);
@@ -12996,6 +13206,7 @@ of_sdwn_get_clients_request_new(of_version_t version)
     }
 
     of_sdwn_get_clients_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_clients_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -13511,6 +13722,7 @@ of_sdwn_get_remote_port_reply_new(of_version_t version)
     }
 
     of_sdwn_get_remote_port_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_remote_port_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -13948,6 +14160,7 @@ of_sdwn_get_remote_port_request_new(of_version_t version)
     }
 
     of_sdwn_get_remote_port_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_get_remote_port_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -14306,6 +14519,7 @@ of_sdwn_ieee80211_mgmt_new(of_version_t version)
     }
 
     of_sdwn_ieee80211_mgmt_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_ieee80211_mgmt_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -15133,6 +15347,7 @@ of_sdwn_ieee80211_mgmt_reply_new(of_version_t version)
     }
 
     of_sdwn_ieee80211_mgmt_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_ieee80211_mgmt_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -15648,6 +15863,7 @@ of_sdwn_mod_lvap_new(of_version_t version)
     }
 
     of_sdwn_mod_lvap_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_mod_lvap_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -16240,6 +16456,7 @@ of_sdwn_packet_in_new(of_version_t version)
     }
 
     of_sdwn_packet_in_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_packet_in_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -17305,6 +17522,9 @@ of_sdwn_packet_in_frame_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = frame->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, frame, cur_len);
 
@@ -17319,6 +17539,71 @@ of_sdwn_packet_in_frame_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for frame in an object of type of_sdwn_packet_in.
+ * @param obj Pointer to an object of type of_sdwn_packet_in.
+ * @param bytes The length of frame
+ * @param frame Set to where frame is written in the object
+ *
+ * The object is resized for bytes of frame, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_sdwn_packet_in_frame_reserve(
+    of_sdwn_packet_in_t *obj,
+    int bytes,
+    uint8_t **frame)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_SDWN_PACKET_IN);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+        offset = 50;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *frame = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -17398,6 +17683,7 @@ of_sdwn_port_desc_reply_new(of_version_t version)
     }
 
     of_sdwn_port_desc_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_port_desc_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -17880,6 +18166,10 @@ of_sdwn_port_desc_reply_entities_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entities, 0), new_len);
@@ -17977,6 +18267,7 @@ of_sdwn_port_desc_request_new(of_version_t version)
     }
 
     of_sdwn_port_desc_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_port_desc_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -18413,6 +18704,7 @@ of_sdwn_set_channel_new(of_version_t version)
     }
 
     of_sdwn_set_channel_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_sdwn_set_channel_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
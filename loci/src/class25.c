@@ -187,6 +187,7 @@ of_table_feature_prop_new(of_version_t version)
     }
 
     of_table_feature_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -307,6 +308,7 @@ of_table_feature_prop_apply_actions_new(of_version_t version)
     }
 
     of_table_feature_prop_apply_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_apply_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -479,6 +481,10 @@ of_table_feature_prop_apply_actions_action_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(action_ids, 0), new_len);
@@ -573,6 +579,7 @@ of_table_feature_prop_apply_actions_miss_new(of_version_t version)
     }
 
     of_table_feature_prop_apply_actions_miss_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_apply_actions_miss_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -745,6 +752,10 @@ of_table_feature_prop_apply_actions_miss_action_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(action_ids, 0), new_len);
@@ -839,6 +850,7 @@ of_table_feature_prop_apply_setfield_new(of_version_t version)
     }
 
     of_table_feature_prop_apply_setfield_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_apply_setfield_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1011,6 +1023,10 @@ of_table_feature_prop_apply_setfield_oxm_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(oxm_ids, 0), new_len);
@@ -1105,6 +1121,7 @@ of_table_feature_prop_apply_setfield_miss_new(of_version_t version)
     }
 
     of_table_feature_prop_apply_setfield_miss_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_apply_setfield_miss_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1277,6 +1294,10 @@ of_table_feature_prop_apply_setfield_miss_oxm_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(oxm_ids, 0), new_len);
@@ -1385,6 +1406,7 @@ of_table_feature_prop_experimenter_new(of_version_t version)
     }
 
     of_table_feature_prop_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -1673,6 +1695,9 @@ of_table_feature_prop_experimenter_experimenter_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = experimenter_data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, experimenter_data, cur_len);
 
@@ -1687,6 +1712,72 @@ of_table_feature_prop_experimenter_experimenter_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for experimenter_data in an object of type of_table_feature_prop_experimenter.
+ * @param obj Pointer to an object of type of_table_feature_prop_experimenter.
+ * @param bytes The length of experimenter_data
+ * @param experimenter_data Set to where experimenter_data is written in the object
+ *
+ * The object is resized for bytes of experimenter_data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_table_feature_prop_experimenter_experimenter_data_reserve(
+    of_table_feature_prop_experimenter_t *obj,
+    int bytes,
+    uint8_t **experimenter_data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *experimenter_data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -1777,6 +1868,7 @@ of_table_feature_prop_experimenter_miss_new(of_version_t version)
     }
 
     of_table_feature_prop_experimenter_miss_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -2065,6 +2157,9 @@ of_table_feature_prop_experimenter_miss_experimenter_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = experimenter_data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, experimenter_data, cur_len);
 
@@ -2079,6 +2174,72 @@ of_table_feature_prop_experimenter_miss_experimenter_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for experimenter_data in an object of type of_table_feature_prop_experimenter_miss.
+ * @param obj Pointer to an object of type of_table_feature_prop_experimenter_miss.
+ * @param bytes The length of experimenter_data
+ * @param experimenter_data Set to where experimenter_data is written in the object
+ *
+ * The object is resized for bytes of experimenter_data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_table_feature_prop_experimenter_miss_experimenter_data_reserve(
+    of_table_feature_prop_experimenter_miss_t *obj,
+    int bytes,
+    uint8_t **experimenter_data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *experimenter_data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -2155,6 +2316,7 @@ of_table_feature_prop_instructions_new(of_version_t version)
     }
 
     of_table_feature_prop_instructions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_instructions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2327,6 +2489,10 @@ of_table_feature_prop_instructions_instruction_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instruction_ids, 0), new_len);
@@ -2421,6 +2587,7 @@ of_table_feature_prop_instructions_miss_new(of_version_t version)
     }
 
     of_table_feature_prop_instructions_miss_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_instructions_miss_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2593,6 +2760,10 @@ of_table_feature_prop_instructions_miss_instruction_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(instruction_ids, 0), new_len);
@@ -2687,6 +2858,7 @@ of_table_feature_prop_match_new(of_version_t version)
     }
 
     of_table_feature_prop_match_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_match_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -2859,6 +3031,10 @@ of_table_feature_prop_match_oxm_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(oxm_ids, 0), new_len);
@@ -2953,6 +3129,7 @@ of_table_feature_prop_next_tables_new(of_version_t version)
     }
 
     of_table_feature_prop_next_tables_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_next_tables_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3125,6 +3302,10 @@ of_table_feature_prop_next_tables_next_table_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(next_table_ids, 0), new_len);
@@ -3219,6 +3400,7 @@ of_table_feature_prop_next_tables_miss_new(of_version_t version)
     }
 
     of_table_feature_prop_next_tables_miss_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_next_tables_miss_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3391,6 +3573,10 @@ of_table_feature_prop_next_tables_miss_next_table_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(next_table_ids, 0), new_len);
@@ -3485,6 +3671,7 @@ of_table_feature_prop_wildcards_new(of_version_t version)
     }
 
     of_table_feature_prop_wildcards_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_wildcards_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3657,6 +3844,10 @@ of_table_feature_prop_wildcards_oxm_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(oxm_ids, 0), new_len);
@@ -3751,6 +3942,7 @@ of_table_feature_prop_write_actions_new(of_version_t version)
     }
 
     of_table_feature_prop_write_actions_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_write_actions_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -3923,6 +4115,10 @@ of_table_feature_prop_write_actions_action_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(action_ids, 0), new_len);
@@ -4017,6 +4213,7 @@ of_table_feature_prop_write_actions_miss_new(of_version_t version)
     }
 
     of_table_feature_prop_write_actions_miss_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_write_actions_miss_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4189,6 +4386,10 @@ of_table_feature_prop_write_actions_miss_action_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(action_ids, 0), new_len);
@@ -4283,6 +4484,7 @@ of_table_feature_prop_write_setfield_new(of_version_t version)
     }
 
     of_table_feature_prop_write_setfield_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_write_setfield_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4455,6 +4657,10 @@ of_table_feature_prop_write_setfield_oxm_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(oxm_ids, 0), new_len);
@@ -4549,6 +4755,7 @@ of_table_feature_prop_write_setfield_miss_new(of_version_t version)
     }
 
     of_table_feature_prop_write_setfield_miss_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_feature_prop_write_setfield_miss_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -4721,6 +4928,10 @@ of_table_feature_prop_write_setfield_miss_oxm_ids_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(oxm_ids, 0), new_len);
@@ -4801,6 +5012,7 @@ of_table_features_new(of_version_t version)
     }
 
     of_table_features_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_u16_len_wire_length_set(obj, obj->length);
 
     return obj;
@@ -5452,6 +5664,10 @@ of_table_features_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -5548,6 +5764,7 @@ of_table_features_failed_error_msg_new(of_version_t version)
     }
 
     of_table_features_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_features_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5838,6 +6055,9 @@ of_table_features_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -5852,6 +6072,72 @@ of_table_features_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_table_features_failed_error_msg.
+ * @param obj Pointer to an object of type of_table_features_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_table_features_failed_error_msg_data_reserve(
+    of_table_features_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -5930,6 +6216,7 @@ of_table_features_stats_reply_new(of_version_t version)
     }
 
     of_table_features_stats_reply_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_features_stats_reply_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6262,6 +6549,10 @@ of_table_features_stats_reply_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -6358,6 +6649,7 @@ of_table_features_stats_request_new(of_version_t version)
     }
 
     of_table_features_stats_request_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_table_features_stats_request_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -6690,6 +6982,10 @@ of_table_features_stats_request_entries_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(entries, 0), new_len);
@@ -6770,6 +7066,7 @@ of_uint32_new(of_version_t version)
     }
 
     of_uint32_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -6956,6 +7253,7 @@ of_uint64_new(of_version_t version)
     }
 
     of_uint64_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -7142,6 +7440,7 @@ of_uint8_new(of_version_t version)
     }
 
     of_uint8_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -7343,6 +7642,7 @@ of_async_config_failed_error_msg_new(of_version_t version)
     }
 
     of_async_config_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -7627,6 +7927,9 @@ of_async_config_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -7641,6 +7944,71 @@ of_async_config_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_async_config_failed_error_msg.
+ * @param obj Pointer to an object of type of_async_config_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_async_config_failed_error_msg_data_reserve(
+    of_async_config_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_ASYNC_CONFIG_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -7764,6 +8132,7 @@ of_async_config_prop_new(of_version_t version)
     }
 
     of_async_config_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -7883,6 +8252,7 @@ of_async_config_prop_experimenter_master_new(of_version_t version)
     }
 
     of_async_config_prop_experimenter_master_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_experimenter_master_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8004,6 +8374,7 @@ of_async_config_prop_experimenter_slave_new(of_version_t version)
     }
 
     of_async_config_prop_experimenter_slave_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_experimenter_slave_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8125,6 +8496,7 @@ of_async_config_prop_flow_removed_master_new(of_version_t version)
     }
 
     of_async_config_prop_flow_removed_master_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_flow_removed_master_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8324,6 +8696,7 @@ of_async_config_prop_flow_removed_slave_new(of_version_t version)
     }
 
     of_async_config_prop_flow_removed_slave_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_flow_removed_slave_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8523,6 +8896,7 @@ of_async_config_prop_packet_in_master_new(of_version_t version)
     }
 
     of_async_config_prop_packet_in_master_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_packet_in_master_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8722,6 +9096,7 @@ of_async_config_prop_packet_in_slave_new(of_version_t version)
     }
 
     of_async_config_prop_packet_in_slave_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_packet_in_slave_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
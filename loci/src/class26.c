@@ -73,6 +73,7 @@ of_async_config_prop_port_status_master_new(of_version_t version)
     }
 
     of_async_config_prop_port_status_master_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_port_status_master_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -272,6 +273,7 @@ of_async_config_prop_port_status_slave_new(of_version_t version)
     }
 
     of_async_config_prop_port_status_slave_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_port_status_slave_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -471,6 +473,7 @@ of_async_config_prop_requestforward_master_new(of_version_t version)
     }
 
     of_async_config_prop_requestforward_master_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_requestforward_master_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -670,6 +673,7 @@ of_async_config_prop_requestforward_slave_new(of_version_t version)
     }
 
     of_async_config_prop_requestforward_slave_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_requestforward_slave_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -869,6 +873,7 @@ of_async_config_prop_role_status_master_new(of_version_t version)
     }
 
     of_async_config_prop_role_status_master_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_role_status_master_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1068,6 +1073,7 @@ of_async_config_prop_role_status_slave_new(of_version_t version)
     }
 
     of_async_config_prop_role_status_slave_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_role_status_slave_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1267,6 +1273,7 @@ of_async_config_prop_table_status_master_new(of_version_t version)
     }
 
     of_async_config_prop_table_status_master_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_table_status_master_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1466,6 +1473,7 @@ of_async_config_prop_table_status_slave_new(of_version_t version)
     }
 
     of_async_config_prop_table_status_slave_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_async_config_prop_table_status_slave_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -1667,6 +1675,7 @@ of_bad_property_error_msg_new(of_version_t version)
     }
 
     of_bad_property_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bad_property_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -1951,6 +1960,9 @@ of_bad_property_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -1965,6 +1977,71 @@ of_bad_property_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bad_property_error_msg.
+ * @param obj Pointer to an object of type of_bad_property_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bad_property_error_msg_data_reserve(
+    of_bad_property_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BAD_PROPERTY_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -2043,6 +2120,7 @@ of_bsn_generic_async_new(of_version_t version)
     }
 
     of_bsn_generic_async_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_generic_async_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -2525,6 +2603,10 @@ of_bsn_generic_async_tlvs_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(tlvs, 0), new_len);
@@ -2621,6 +2703,7 @@ of_bsn_generic_command_new(of_version_t version)
     }
 
     of_bsn_generic_command_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_generic_command_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3103,6 +3186,10 @@ of_bsn_generic_command_tlvs_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(tlvs, 0), new_len);
@@ -3199,6 +3286,7 @@ of_bsn_takeover_new(of_version_t version)
     }
 
     of_bsn_takeover_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bsn_takeover_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3555,6 +3643,7 @@ of_bundle_add_msg_new(of_version_t version)
     }
 
     of_bundle_add_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bundle_add_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -3917,6 +4006,9 @@ of_bundle_add_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -3931,6 +4023,71 @@ of_bundle_add_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bundle_add_msg.
+ * @param obj Pointer to an object of type of_bundle_add_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bundle_add_msg_data_reserve(
+    of_bundle_add_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BUNDLE_ADD_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_4:
+        offset = 16;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -4007,6 +4164,7 @@ of_bundle_ctrl_msg_new(of_version_t version)
     }
 
     of_bundle_ctrl_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bundle_ctrl_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4489,6 +4647,10 @@ of_bundle_ctrl_msg_properties_set(
         return OF_ERROR_NONE;
     }
 
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+
     /* Otherwise, replace existing object in data buffer */
     of_wire_buffer_replace_data(wbuf, abs_offset, cur_len,
         OF_OBJECT_BUFFER_INDEX(properties, 0), new_len);
@@ -4584,6 +4746,7 @@ of_bundle_failed_error_msg_new(of_version_t version)
     }
 
     of_bundle_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_bundle_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -4868,6 +5031,9 @@ of_bundle_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -4882,6 +5048,71 @@ of_bundle_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_bundle_failed_error_msg.
+ * @param obj Pointer to an object of type of_bundle_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_bundle_failed_error_msg_data_reserve(
+    of_bundle_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_BUNDLE_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -4966,6 +5197,7 @@ of_bundle_prop_new(of_version_t version)
     }
 
     of_bundle_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5091,6 +5323,7 @@ of_bundle_prop_experimenter_new(of_version_t version)
     }
 
     of_bundle_prop_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -5368,6 +5601,7 @@ of_flow_monitor_failed_error_msg_new(of_version_t version)
     }
 
     of_flow_monitor_failed_error_msg_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_flow_monitor_failed_error_msg_push_wire_types(obj);
     of_object_message_wire_length_set(obj, obj->length);
 
@@ -5652,6 +5886,9 @@ of_flow_monitor_failed_error_msg_data_set(
     LOCI_ASSERT(abs_offset >= 0);
     LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
     new_len = data->bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
     of_wire_buffer_grow(wbuf, abs_offset + (new_len - cur_len));
     of_wire_buffer_octets_data_set(wbuf, abs_offset, data, cur_len);
 
@@ -5666,6 +5903,71 @@ of_flow_monitor_failed_error_msg_data_set(
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Reserve space for data in an object of type of_flow_monitor_failed_error_msg.
+ * @param obj Pointer to an object of type of_flow_monitor_failed_error_msg.
+ * @param bytes The length of data
+ * @param data Set to where data is written in the object
+ *
+ * The object is resized for bytes of data, to be written in place;
+ * their contents are not initialized.  Returns OF_ERROR_PARAM if bytes
+ * is negative or would make the message longer than
+ * OF_WIRE_BUFFER_MAX_LENGTH, and OF_ERROR_RESOURCE if the buffer can't
+ * hold them.
+ */
+int WARN_UNUSED_RESULT
+of_flow_monitor_failed_error_msg_data_reserve(
+    of_flow_monitor_failed_error_msg_t *obj,
+    int bytes,
+    uint8_t **data)
+{
+    of_wire_buffer_t *wbuf;
+    int offset = 0; /* Offset of value relative to the start obj */
+    int abs_offset; /* Offset of value relative to start of wbuf */
+    of_version_t ver;
+    int cur_len = 0; /* Current length of object data */
+    int new_len, delta; /* For set, need new length and delta */
+
+    LOCI_ASSERT(obj->object_id == OF_FLOW_MONITOR_FAILED_ERROR_MSG);
+    ver = obj->version;
+    wbuf = OF_OBJECT_TO_WBUF(obj);
+    LOCI_ASSERT(wbuf != NULL);
+
+    /* By version, determine offset and current length (where needed) */
+    switch (ver) {
+    case OF_VERSION_1_4:
+        offset = 12;
+        cur_len = _END_LEN(obj, offset);
+        break;
+    default:
+        LOCI_ASSERT(0);
+    }
+
+    abs_offset = OF_OBJECT_ABSOLUTE_OFFSET(obj, offset);
+    LOCI_ASSERT(abs_offset >= 0);
+    LOCI_ASSERT(cur_len >= 0 && cur_len < 64 * 1024);
+    if (bytes < 0 || bytes - cur_len >
+            OF_WIRE_BUFFER_MAX_LENGTH - WBUF_CURRENT_BYTES(wbuf)) {
+        return OF_ERROR_PARAM;
+    }
+    new_len = bytes;
+    if (!of_wire_buffer_can_replace(wbuf, cur_len, new_len)) {
+        return OF_ERROR_RESOURCE;
+    }
+    *data = of_wire_buffer_resize_data(wbuf, abs_offset, cur_len, new_len);
+
+    /* Not scalar, update lengths if needed */
+    delta = new_len - cur_len;
+    if (delta != 0) {
+        /* Update parent(s) */
+        of_object_parent_length_update((of_object_t *)obj, delta);
+    }
+
+    OF_LENGTH_CHECK_ASSERT(obj);
+
+    return OF_ERROR_NONE;
+}
 /* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
 /* Copyright (c) 2011, 2012 Open Networking Foundation */
 /* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
@@ -5741,6 +6043,7 @@ of_oxm_pbb_uca_new(of_version_t version)
     }
 
     of_oxm_pbb_uca_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_pbb_uca_push_wire_types(obj);
 
     return obj;
@@ -5939,6 +6242,7 @@ of_oxm_pbb_uca_masked_new(of_version_t version)
     }
 
     of_oxm_pbb_uca_masked_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_oxm_pbb_uca_masked_push_wire_types(obj);
 
     return obj;
@@ -6230,6 +6534,7 @@ of_port_desc_prop_new(of_version_t version)
     }
 
     of_port_desc_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -6358,6 +6663,7 @@ of_port_desc_prop_experimenter_new(of_version_t version)
     }
 
     of_port_desc_prop_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -6570,6 +6876,7 @@ of_port_desc_prop_bsn_new(of_version_t version)
     }
 
     of_port_desc_prop_bsn_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -6847,6 +7154,7 @@ of_port_desc_prop_bsn_forward_error_correction_new(of_version_t version)
     }
 
     of_port_desc_prop_bsn_forward_error_correction_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_prop_bsn_forward_error_correction_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7282,6 +7590,7 @@ of_port_desc_prop_bsn_generation_id_new(of_version_t version)
     }
 
     of_port_desc_prop_bsn_generation_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_prop_bsn_generation_id_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7639,6 +7948,7 @@ of_port_desc_prop_bsn_uplink_new(of_version_t version)
     }
 
     of_port_desc_prop_bsn_uplink_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_prop_bsn_uplink_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -7916,6 +8226,7 @@ of_port_desc_prop_ethernet_new(of_version_t version)
     }
 
     of_port_desc_prop_ethernet_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_prop_ethernet_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -8505,6 +8816,7 @@ of_port_desc_prop_optical_new(of_version_t version)
     }
 
     of_port_desc_prop_optical_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_desc_prop_optical_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -9343,6 +9655,7 @@ of_port_mod_prop_new(of_version_t version)
     }
 
     of_port_mod_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -9462,6 +9775,7 @@ of_port_mod_prop_ethernet_new(of_version_t version)
     }
 
     of_port_mod_prop_ethernet_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_mod_prop_ethernet_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -9667,6 +9981,7 @@ of_port_mod_prop_experimenter_new(of_version_t version)
     }
 
     of_port_mod_prop_experimenter_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -9942,6 +10257,7 @@ of_port_mod_prop_optical_new(of_version_t version)
     }
 
     of_port_mod_prop_optical_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
     of_port_mod_prop_optical_push_wire_types(obj);
     of_tlv16_wire_length_set(obj, obj->length);
 
@@ -0,0 +1,230 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_binlog.c
+ *
+ * Datatype helpers for the generated binary log serializers and
+ * the record reader.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_binlog.h>
+
+/**
+ * Log a length prefixed run of bytes
+ * @param tag LOCI_BINLOG_TAG_BYTES or LOCI_BINLOG_TAG_STRING
+ */
+
+void
+loci_binlog_bytes(loci_stream_t *s, int tag, const uint8_t *data, int len)
+{
+    uint16_t len16 = (uint16_t)len;
+    uint8_t *out;
+
+    if ((out = loci_stream_reserve(s, 3)) == NULL) {
+        return;
+    }
+    out[0] = (uint8_t)tag;
+    MEMCPY(out + 1, &len16, sizeof(len16));
+    loci_stream_advance(s, 3);
+    loci_stream_write(s, data, len16);
+}
+
+void
+loci_binlog_string(loci_stream_t *s, const char *str, int max_len)
+{
+    const char *end = memchr(str, 0, max_len);
+    int len = (end != NULL) ? end - str : max_len;
+
+    loci_binlog_bytes(s, LOCI_BINLOG_TAG_STRING, (const uint8_t *)str, len);
+}
+
+void
+loci_binlog_words(loci_stream_t *s, const uint64_t *words, int count)
+{
+    uint8_t *out;
+
+    if ((out = loci_stream_reserve(s, 2 + 8 * count)) == NULL) {
+        return;
+    }
+    out[0] = LOCI_BINLOG_TAG_BITMAP;
+    out[1] = (uint8_t)count;
+    MEMCPY(out + 2, words, 8 * count);
+    loci_stream_advance(s, 2 + 8 * count);
+}
+
+void
+loci_binlog_u128(loci_stream_t *s, uint64_t hi, uint64_t lo)
+{
+    uint64_t words[2];
+
+    words[0] = lo;
+    words[1] = hi;
+    loci_binlog_words(s, words, 2);
+}
+
+/****************************************************************
+ * Reader
+ ****************************************************************/
+
+static inline uint16_t
+binlog_u16(loci_binlog_cursor_t *c, const uint8_t *p)
+{
+    uint16_t val;
+
+    MEMCPY(&val, p, sizeof(val));
+    return c->swap ? (uint16_t)((val >> 8) | (val << 8)) : val;
+}
+
+static inline uint32_t
+binlog_u32(loci_binlog_cursor_t *c, const uint8_t *p)
+{
+    uint32_t val;
+
+    MEMCPY(&val, p, sizeof(val));
+    return c->swap ? __builtin_bswap32(val) : val;
+}
+
+static inline uint64_t
+binlog_u64(loci_binlog_cursor_t *c, const uint8_t *p)
+{
+    uint64_t val;
+
+    MEMCPY(&val, p, sizeof(val));
+    return c->swap ? __builtin_bswap64(val) : val;
+}
+
+/**
+ * Open a record for reading
+ * @param buf Start of the record
+ * @param len Bytes available at buf
+ * @param rec Filled with the record header
+ * @param cursor Positioned at the first field of the record
+ * @returns The record length or OF_ERROR_PARSE
+ */
+
+int
+loci_binlog_record_open(const uint8_t *buf, int len,
+                        loci_binlog_record_t *rec,
+                        loci_binlog_cursor_t *cursor)
+{
+    if (len < LOCI_BINLOG_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+
+    rec->flags = buf[7];
+    cursor->swap = (rec->flags & LOCI_BINLOG_FLAG_BIG_ENDIAN) !=
+        LOCI_BINLOG_HOST_FLAGS;
+    rec->length = binlog_u32(cursor, buf);
+    rec->object_id = binlog_u16(cursor, buf + 4);
+    rec->version = buf[6];
+
+    if (rec->length < LOCI_BINLOG_HEADER_LENGTH || rec->length > len ||
+            rec->object_id >= OF_OBJECT_COUNT) {
+        return OF_ERROR_PARSE;
+    }
+
+    cursor->cur = buf + LOCI_BINLOG_HEADER_LENGTH;
+    cursor->end = buf + rec->length;
+
+    return rec->length;
+}
+
+/**
+ * Read the next field of a record
+ * @returns OF_ERROR_NONE, OF_ERROR_RANGE at the end of the record or
+ * OF_ERROR_PARSE if the record is malformed
+ */
+
+int
+loci_binlog_next(loci_binlog_cursor_t *c, loci_binlog_field_t *f)
+{
+    const uint8_t *p = c->cur;
+    const uint8_t *q;
+    int avail = c->end - p;
+    int need;
+
+    if (avail <= 0) {
+        return OF_ERROR_RANGE;
+    }
+
+    MEMSET(f, 0, sizeof(*f));
+    f->tag = (loci_binlog_tag_t)*p++;
+    avail--;
+
+    switch (f->tag) {
+    case LOCI_BINLOG_TAG_END:
+    case LOCI_BINLOG_TAG_LIST:
+        need = 0;
+        break;
+    case LOCI_BINLOG_TAG_U8:
+        if ((need = 1) > avail) return OF_ERROR_PARSE;
+        f->value = p[0];
+        break;
+    case LOCI_BINLOG_TAG_U16:
+        if ((need = 2) > avail) return OF_ERROR_PARSE;
+        f->value = binlog_u16(c, p);
+        break;
+    case LOCI_BINLOG_TAG_U32:
+    case LOCI_BINLOG_TAG_IPV4:
+        if ((need = 4) > avail) return OF_ERROR_PARSE;
+        f->value = binlog_u32(c, p);
+        break;
+    case LOCI_BINLOG_TAG_U64:
+        if ((need = 8) > avail) return OF_ERROR_PARSE;
+        f->value = binlog_u64(c, p);
+        break;
+    case LOCI_BINLOG_TAG_MAC:
+    case LOCI_BINLOG_TAG_IPV6:
+        need = (f->tag == LOCI_BINLOG_TAG_MAC) ? OF_MAC_ADDR_BYTES : OF_IPV6_BYTES;
+        if (need > avail) return OF_ERROR_PARSE;
+        f->data = p;
+        f->bytes = need;
+        break;
+    case LOCI_BINLOG_TAG_BYTES:
+    case LOCI_BINLOG_TAG_STRING:
+        if (avail < 2) return OF_ERROR_PARSE;
+        f->bytes = binlog_u16(c, p);
+        if ((need = 2 + f->bytes) > avail) return OF_ERROR_PARSE;
+        f->data = p + 2;
+        break;
+    case LOCI_BINLOG_TAG_BITMAP:
+        if (avail < 1) return OF_ERROR_PARSE;
+        f->bytes = 8 * p[0];
+        if ((need = 1 + f->bytes) > avail) return OF_ERROR_PARSE;
+        f->data = p + 1;
+        break;
+    case LOCI_BINLOG_TAG_MATCH:
+        if (avail < 1) return OF_ERROR_PARSE;
+        f->version = p[0];
+        q = p + 1;
+        while (q < c->end && *q != LOCI_BINLOG_MATCH_END) {
+            if (c->end - q < 2 || c->end - q < 2 + 2 * q[1]) {
+                return OF_ERROR_PARSE;
+            }
+            q += 2 + 2 * q[1];
+        }
+        if (q >= c->end) return OF_ERROR_PARSE;
+        f->data = p + 1;
+        f->bytes = q - f->data;
+        need = q + 1 - p;
+        break;
+    case LOCI_BINLOG_TAG_OBJECT:
+        if ((need = 3) > avail) return OF_ERROR_PARSE;
+        f->object_id = binlog_u16(c, p);
+        f->version = p[2];
+        if (f->object_id >= OF_OBJECT_COUNT) return OF_ERROR_PARSE;
+        break;
+    default:
+        return OF_ERROR_PARSE;
+    }
+
+    c->cur = p + need;
+
+    return OF_ERROR_NONE;
+}
@@ -0,0 +1,338 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_bsn_tlv.c
+ *
+ * Index, typed getters, hash and equality of BSN TLV lists.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_bsn_tlv.h>
+#include <loci/loci_hash.h>
+
+/* Wire types with a class in the type table; others are OF_BSN_TLV */
+#define WIRE_TYPES 256
+
+#include "loci_bsn_tlv_types.h"
+
+/**
+ * Index a BSN TLV list
+ * @param idx The index
+ * @param version Version of the list
+ * @param buf The TLVs, as on the wire
+ * @param len Length of the list
+ * @returns 0; OF_ERROR_VERSION before 1.3; OF_ERROR_PARSE if a TLV
+ * length is short or runs past the end; or OF_ERROR_RESOURCE if there
+ * are more than LOCI_BSN_TLV_INDEX_MAX TLVs
+ *
+ * The index points into buf, which must stay as it is while the index
+ * is used.
+ */
+int
+loci_bsn_tlv_index(loci_bsn_tlv_index_t *idx, of_version_t version,
+                   const uint8_t *buf, int len)
+{
+    uint8_t *last[LOCI_BSN_TLV_CLASSES];
+    uint16_t type, length;
+    uint8_t cls;
+    int offset, n = 0;
+
+    if (version < OF_VERSION_1_3) {
+        return OF_ERROR_VERSION;
+    }
+
+    idx->version = version;
+    idx->buf = buf;
+    idx->len = len;
+    idx->count = 0;
+    MEMSET(idx->first, 0, sizeof(idx->first));
+
+    for (offset = 0; offset < len; offset += length) {
+        if (len - offset < LOCI_BSN_TLV_HEADER_BYTES) {
+            return OF_ERROR_PARSE;
+        }
+        type = (buf[offset] << 8) | buf[offset + 1];
+        length = (buf[offset + 2] << 8) | buf[offset + 3];
+        if (length < LOCI_BSN_TLV_HEADER_BYTES || length > len - offset) {
+            return OF_ERROR_PARSE;
+        }
+        if (n == LOCI_BSN_TLV_INDEX_MAX) {
+            return OF_ERROR_RESOURCE;
+        }
+
+        cls = type < WIRE_TYPES ? type_cls[type] : 0;
+        idx->cls[n] = cls;
+        idx->offset[n] = offset;
+        idx->length[n] = length;
+        idx->next[n] = 0;
+        if (idx->first[cls] == 0) {
+            idx->first[cls] = n + 1;
+        } else {
+            *last[cls] = n + 1;
+        }
+        last[cls] = &idx->next[n];
+        n++;
+    }
+    idx->count = n;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Index a BSN TLV list object
+ * @param idx The index
+ * @param list The list
+ * @returns As loci_bsn_tlv_index
+ */
+int
+loci_bsn_tlv_index_list(loci_bsn_tlv_index_t *idx, of_list_bsn_tlv_t *list)
+{
+    return loci_bsn_tlv_index(idx, list->version,
+                              OF_OBJECT_BUFFER_INDEX(list, 0), list->length);
+}
+
+/****************************************************************
+ * Typed getters
+ ****************************************************************/
+
+/*
+ * Value of the first TLV of a class, if it is at least bytes long.
+ * Sets *rv to OF_ERROR_RANGE if there is no such TLV, or
+ * OF_ERROR_PARSE if it is shorter.
+ */
+static const uint8_t *
+value_find(loci_bsn_tlv_index_t *idx, of_object_id_t id, int bytes, int *rv)
+{
+    int pos, len;
+    const uint8_t *value;
+
+    if ((pos = loci_bsn_tlv_find(idx, id)) < 0) {
+        *rv = OF_ERROR_RANGE;
+        return NULL;
+    }
+    value = loci_bsn_tlv_value(idx, pos, &len);
+    if (len < bytes) {
+        *rv = OF_ERROR_PARSE;
+        return NULL;
+    }
+
+    return value;
+}
+
+/**
+ * Get the value of the first TLV of a class as a uint8_t
+ * @param idx The index
+ * @param id Class of the TLV, as OF_BSN_TLV_IP_PROTO
+ * @param value Where to put the value
+ * @returns 0, OF_ERROR_RANGE if the list has no such TLV, or
+ * OF_ERROR_PARSE if its value is too short
+ */
+int
+loci_bsn_tlv_u8_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                    uint8_t *value)
+{
+    const uint8_t *v;
+    int rv;
+
+    if ((v = value_find(idx, id, sizeof(*value), &rv)) == NULL) {
+        return rv;
+    }
+    *value = v[0];
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Get the value of the first TLV of a class as a uint16_t
+ * @returns As loci_bsn_tlv_u8_get
+ */
+int
+loci_bsn_tlv_u16_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                     uint16_t *value)
+{
+    const uint8_t *v;
+    uint16_t v16;
+    int rv;
+
+    if ((v = value_find(idx, id, sizeof(*value), &rv)) == NULL) {
+        return rv;
+    }
+    MEMCPY(&v16, v, sizeof(v16));
+    *value = U16_NTOH(v16);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Get the value of the first TLV of a class as a uint32_t, as the
+ * port_no of OF_BSN_TLV_PORT or the address of OF_BSN_TLV_IPV4
+ * @returns As loci_bsn_tlv_u8_get
+ */
+int
+loci_bsn_tlv_u32_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                     uint32_t *value)
+{
+    const uint8_t *v;
+    uint32_t v32;
+    int rv;
+
+    if ((v = value_find(idx, id, sizeof(*value), &rv)) == NULL) {
+        return rv;
+    }
+    MEMCPY(&v32, v, sizeof(v32));
+    *value = U32_NTOH(v32);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Get the value of the first TLV of a class as a uint64_t
+ * @returns As loci_bsn_tlv_u8_get
+ */
+int
+loci_bsn_tlv_u64_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                     uint64_t *value)
+{
+    const uint8_t *v;
+    uint64_t v64;
+    int rv;
+
+    if ((v = value_find(idx, id, sizeof(*value), &rv)) == NULL) {
+        return rv;
+    }
+    MEMCPY(&v64, v, sizeof(v64));
+    *value = U64_NTOH(v64);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Get the value of the first TLV of a class as a MAC address
+ * @returns As loci_bsn_tlv_u8_get
+ */
+int
+loci_bsn_tlv_mac_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                     of_mac_addr_t *value)
+{
+    const uint8_t *v;
+    int rv;
+
+    if ((v = value_find(idx, id, OF_MAC_ADDR_BYTES, &rv)) == NULL) {
+        return rv;
+    }
+    MEMCPY(value->addr, v, OF_MAC_ADDR_BYTES);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Get the value of the first TLV of a class as an IPv6 address
+ * @returns As loci_bsn_tlv_u8_get
+ */
+int
+loci_bsn_tlv_ipv6_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                      of_ipv6_t *value)
+{
+    const uint8_t *v;
+    int rv;
+
+    if ((v = value_find(idx, id, OF_IPV6_BYTES, &rv)) == NULL) {
+        return rv;
+    }
+    MEMCPY(value->addr, v, OF_IPV6_BYTES);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Get the value of the first TLV of a class as bytes, as the name of
+ * OF_BSN_TLV_NAME
+ * @param data Set to the value, in the list's buffer
+ * @param len Set to the length of the value
+ * @returns 0 or OF_ERROR_RANGE if the list has no such TLV
+ */
+int
+loci_bsn_tlv_data_get(loci_bsn_tlv_index_t *idx, of_object_id_t id,
+                      const uint8_t **data, int *len)
+{
+    int pos;
+
+    if ((pos = loci_bsn_tlv_find(idx, id)) < 0) {
+        return OF_ERROR_RANGE;
+    }
+    *data = loci_bsn_tlv_value(idx, pos, len);
+
+    return OF_ERROR_NONE;
+}
+
+/****************************************************************
+ * Hash and equality
+ ****************************************************************/
+
+/**
+ * Hash an indexed list, whatever the order of its TLVs
+ * @param idx The index
+ * @param seed Seed of the hash
+ * @returns The hash
+ */
+uint64_t
+loci_bsn_tlv_hash(loci_bsn_tlv_index_t *idx, uint64_t seed)
+{
+    uint64_t sum = 0, hash;
+    int i;
+
+    for (i = 0; i < idx->count; i++) {
+        sum += loci_hash_bytes(idx->buf + idx->offset[i], idx->length[i],
+                               seed);
+    }
+    hash = loci_hash_start(seed);
+    hash = loci_hash_word(hash, idx->count);
+    hash = loci_hash_word(hash, sum);
+
+    return loci_hash_finish(hash);
+}
+
+/**
+ * Whether two indexed lists have the same TLVs
+ * @param a An index
+ * @param b Another index
+ * @returns 1 if the lists have the same TLVs, the classes in any order
+ * but the TLVs of a class in the same order; else 0
+ */
+int
+loci_bsn_tlv_equal(loci_bsn_tlv_index_t *a, loci_bsn_tlv_index_t *b)
+{
+    int i, pa, pb;
+    uint8_t cls;
+
+    if (a->count != b->count || a->len != b->len) {
+        return 0;
+    }
+
+    /* Each class of a against the same class of b; with the counts
+     * equal, b then has no TLV a hasn't */
+    for (i = 0; i < a->count; i++) {
+        cls = a->cls[i];
+        if (a->first[cls] != i + 1) {
+            continue;
+        }
+        for (pa = i, pb = b->first[cls] - 1; pa >= 0 && pb >= 0;
+             pa = a->next[pa] - 1, pb = b->next[pb] - 1) {
+            if (a->length[pa] != b->length[pb] ||
+                MEMCMP(a->buf + a->offset[pa], b->buf + b->offset[pb],
+                       a->length[pa]) != 0) {
+                return 0;
+            }
+        }
+        if (pa >= 0 || pb >= 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
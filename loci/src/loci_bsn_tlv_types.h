@@ -0,0 +1,163 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_bsn_tlv_types.h
+ *
+ * Class of each BSN TLV wire type, for loci_bsn_tlv.c
+ *
+ * Generated by scripts/gen_bsn_tlv_types.py from the BSN TLV wire type
+ * dispatch.  Edit the script, not this file.
+ *
+ ****************************************************************/
+
+/* Class of each wire type, less OF_BSN_TLV; 0 for unknown types */
+static const uint8_t type_cls[WIRE_TYPES] = {
+    [0x0] = OF_BSN_TLV_PORT - OF_BSN_TLV,
+    [0x1] = OF_BSN_TLV_MAC - OF_BSN_TLV,
+    [0x2] = OF_BSN_TLV_RX_PACKETS - OF_BSN_TLV,
+    [0x3] = OF_BSN_TLV_TX_PACKETS - OF_BSN_TLV,
+    [0x4] = OF_BSN_TLV_IPV4 - OF_BSN_TLV,
+    [0x5] = OF_BSN_TLV_IDLE_TIME - OF_BSN_TLV,
+    [0x6] = OF_BSN_TLV_VLAN_VID - OF_BSN_TLV,
+    [0x7] = OF_BSN_TLV_IDLE_NOTIFICATION - OF_BSN_TLV,
+    [0x8] = OF_BSN_TLV_IDLE_TIMEOUT - OF_BSN_TLV,
+    [0x9] = OF_BSN_TLV_UNICAST_QUERY_TIMEOUT - OF_BSN_TLV,
+    [0xa] = OF_BSN_TLV_BROADCAST_QUERY_TIMEOUT - OF_BSN_TLV,
+    [0xb] = OF_BSN_TLV_REQUEST_PACKETS - OF_BSN_TLV,
+    [0xc] = OF_BSN_TLV_REPLY_PACKETS - OF_BSN_TLV,
+    [0xd] = OF_BSN_TLV_MISS_PACKETS - OF_BSN_TLV,
+    [0xe] = OF_BSN_TLV_CIRCUIT_ID - OF_BSN_TLV,
+    [0xf] = OF_BSN_TLV_UDF_ID - OF_BSN_TLV,
+    [0x10] = OF_BSN_TLV_UDF_ANCHOR - OF_BSN_TLV,
+    [0x11] = OF_BSN_TLV_UDF_OFFSET - OF_BSN_TLV,
+    [0x12] = OF_BSN_TLV_UDF_LENGTH - OF_BSN_TLV,
+    [0x13] = OF_BSN_TLV_VRF - OF_BSN_TLV,
+    [0x14] = OF_BSN_TLV_QUEUE_ID - OF_BSN_TLV,
+    [0x15] = OF_BSN_TLV_QUEUE_WEIGHT - OF_BSN_TLV,
+    [0x16] = OF_BSN_TLV_CRC_ENABLED - OF_BSN_TLV,
+    [0x17] = OF_BSN_TLV_EXTERNAL_IP - OF_BSN_TLV,
+    [0x18] = OF_BSN_TLV_EXTERNAL_MAC - OF_BSN_TLV,
+    [0x19] = OF_BSN_TLV_EXTERNAL_NETMASK - OF_BSN_TLV,
+    [0x1a] = OF_BSN_TLV_EXTERNAL_GATEWAY_IP - OF_BSN_TLV,
+    [0x1b] = OF_BSN_TLV_INTERNAL_MAC - OF_BSN_TLV,
+    [0x1c] = OF_BSN_TLV_INTERNAL_GATEWAY_MAC - OF_BSN_TLV,
+    [0x1d] = OF_BSN_TLV_EXTERNAL_GATEWAY_MAC - OF_BSN_TLV,
+    [0x1e] = OF_BSN_TLV_SAMPLING_RATE - OF_BSN_TLV,
+    [0x1f] = OF_BSN_TLV_HEADER_SIZE - OF_BSN_TLV,
+    [0x20] = OF_BSN_TLV_ETH_SRC - OF_BSN_TLV,
+    [0x21] = OF_BSN_TLV_ETH_DST - OF_BSN_TLV,
+    [0x22] = OF_BSN_TLV_IPV4_SRC - OF_BSN_TLV,
+    [0x23] = OF_BSN_TLV_IPV4_DST - OF_BSN_TLV,
+    [0x24] = OF_BSN_TLV_UDP_SRC - OF_BSN_TLV,
+    [0x25] = OF_BSN_TLV_UDP_DST - OF_BSN_TLV,
+    [0x26] = OF_BSN_TLV_SUB_AGENT_ID - OF_BSN_TLV,
+    [0x27] = OF_BSN_TLV_TX_BYTES - OF_BSN_TLV,
+    [0x28] = OF_BSN_TLV_ACTOR_SYSTEM_PRIORITY - OF_BSN_TLV,
+    [0x29] = OF_BSN_TLV_ACTOR_SYSTEM_MAC - OF_BSN_TLV,
+    [0x2a] = OF_BSN_TLV_ACTOR_PORT_PRIORITY - OF_BSN_TLV,
+    [0x2b] = OF_BSN_TLV_ACTOR_PORT_NUM - OF_BSN_TLV,
+    [0x2c] = OF_BSN_TLV_ACTOR_KEY - OF_BSN_TLV,
+    [0x2d] = OF_BSN_TLV_CONVERGENCE_STATUS - OF_BSN_TLV,
+    [0x2f] = OF_BSN_TLV_PARTNER_SYSTEM_PRIORITY - OF_BSN_TLV,
+    [0x30] = OF_BSN_TLV_PARTNER_SYSTEM_MAC - OF_BSN_TLV,
+    [0x31] = OF_BSN_TLV_PARTNER_PORT_PRIORITY - OF_BSN_TLV,
+    [0x32] = OF_BSN_TLV_PARTNER_PORT_NUM - OF_BSN_TLV,
+    [0x33] = OF_BSN_TLV_PARTNER_KEY - OF_BSN_TLV,
+    [0x34] = OF_BSN_TLV_NAME - OF_BSN_TLV,
+    [0x35] = OF_BSN_TLV_ACTOR_STATE - OF_BSN_TLV,
+    [0x36] = OF_BSN_TLV_PARTNER_STATE - OF_BSN_TLV,
+    [0x37] = OF_BSN_TLV_DATA - OF_BSN_TLV,
+    [0x38] = OF_BSN_TLV_MAC_MASK - OF_BSN_TLV,
+    [0x39] = OF_BSN_TLV_PRIORITY - OF_BSN_TLV,
+    [0x3a] = OF_BSN_TLV_INTERVAL - OF_BSN_TLV,
+    [0x3b] = OF_BSN_TLV_REFERENCE - OF_BSN_TLV,
+    [0x3c] = OF_BSN_TLV_IPV4_NETMASK - OF_BSN_TLV,
+    [0x3d] = OF_BSN_TLV_MPLS_LABEL - OF_BSN_TLV,
+    [0x3e] = OF_BSN_TLV_MPLS_CONTROL_WORD - OF_BSN_TLV,
+    [0x3f] = OF_BSN_TLV_MPLS_SEQUENCED - OF_BSN_TLV,
+    [0x40] = OF_BSN_TLV_BUCKET - OF_BSN_TLV,
+    [0x41] = OF_BSN_TLV_TCP_SRC - OF_BSN_TLV,
+    [0x42] = OF_BSN_TLV_TCP_DST - OF_BSN_TLV,
+    [0x43] = OF_BSN_TLV_IP_PROTO - OF_BSN_TLV,
+    [0x44] = OF_BSN_TLV_ICMP_TYPE - OF_BSN_TLV,
+    [0x45] = OF_BSN_TLV_ICMP_CODE - OF_BSN_TLV,
+    [0x46] = OF_BSN_TLV_ICMP_ID - OF_BSN_TLV,
+    [0x47] = OF_BSN_TLV_RX_BYTES - OF_BSN_TLV,
+    [0x48] = OF_BSN_TLV_VLAN_PCP - OF_BSN_TLV,
+    [0x49] = OF_BSN_TLV_STRIP_VLAN_ON_EGRESS - OF_BSN_TLV,
+    [0x4a] = OF_BSN_TLV_SET_LOOPBACK_MODE - OF_BSN_TLV,
+    [0x4b] = OF_BSN_TLV_STRIP_MPLS_L2_ON_INGRESS - OF_BSN_TLV,
+    [0x4c] = OF_BSN_TLV_STRIP_MPLS_L3_ON_INGRESS - OF_BSN_TLV,
+    [0x4d] = OF_BSN_TLV_VLAN_VID_MASK - OF_BSN_TLV,
+    [0x4e] = OF_BSN_TLV_IGMP_SNOOPING - OF_BSN_TLV,
+    [0x4f] = OF_BSN_TLV_L2_MULTICAST_LOOKUP - OF_BSN_TLV,
+    [0x50] = OF_BSN_TLV_GENERATION_ID - OF_BSN_TLV,
+    [0x51] = OF_BSN_TLV_ANCHOR - OF_BSN_TLV,
+    [0x52] = OF_BSN_TLV_OFFSET - OF_BSN_TLV,
+    [0x53] = OF_BSN_TLV_NEGATE - OF_BSN_TLV,
+    [0x54] = OF_BSN_TLV_IPV6 - OF_BSN_TLV,
+    [0x55] = OF_BSN_TLV_DECAP - OF_BSN_TLV,
+    [0x56] = OF_BSN_TLV_VNI - OF_BSN_TLV,
+    [0x57] = OF_BSN_TLV_MCG_TYPE_VXLAN - OF_BSN_TLV,
+    [0x58] = OF_BSN_TLV_PORT_VXLAN_MODE - OF_BSN_TLV,
+    [0x59] = OF_BSN_TLV_RATE_UNIT - OF_BSN_TLV,
+    [0x5a] = OF_BSN_TLV_BROADCAST_RATE - OF_BSN_TLV,
+    [0x5b] = OF_BSN_TLV_KNOWN_MULTICAST_RATE - OF_BSN_TLV,
+    [0x5c] = OF_BSN_TLV_UNKNOWN_MULTICAST_RATE - OF_BSN_TLV,
+    [0x5d] = OF_BSN_TLV_UNICAST_RATE - OF_BSN_TLV,
+    [0x5e] = OF_BSN_TLV_NEXTHOP_TYPE_VXLAN - OF_BSN_TLV,
+    [0x5f] = OF_BSN_TLV_MULTICAST_INTERFACE_ID - OF_BSN_TLV,
+    [0x60] = OF_BSN_TLV_USE_PACKET_STATE - OF_BSN_TLV,
+    [0x61] = OF_BSN_TLV_STATUS - OF_BSN_TLV,
+    [0x62] = OF_BSN_TLV_VLAN_MAC_LIST - OF_BSN_TLV,
+    [0x63] = OF_BSN_TLV_VFI - OF_BSN_TLV,
+    [0x64] = OF_BSN_TLV_HASH_SEED - OF_BSN_TLV,
+    [0x65] = OF_BSN_TLV_HASH_TYPE - OF_BSN_TLV,
+    [0x66] = OF_BSN_TLV_HASH_PACKET_TYPE - OF_BSN_TLV,
+    [0x67] = OF_BSN_TLV_HASH_PACKET_FIELD - OF_BSN_TLV,
+    [0x68] = OF_BSN_TLV_HASH_GTP_HEADER_MATCH - OF_BSN_TLV,
+    [0x69] = OF_BSN_TLV_HASH_GTP_PORT_MATCH - OF_BSN_TLV,
+    [0x6a] = OF_BSN_TLV_UNTAGGED - OF_BSN_TLV,
+    [0x6b] = OF_BSN_TLV_VFP_CLASS_ID - OF_BSN_TLV,
+    [0x6c] = OF_BSN_TLV_QOS_PRIORITY - OF_BSN_TLV,
+    [0x6d] = OF_BSN_TLV_PARENT_PORT - OF_BSN_TLV,
+    [0x6e] = OF_BSN_TLV_LOOPBACK_PORT - OF_BSN_TLV,
+    [0x6f] = OF_BSN_TLV_VPN_KEY - OF_BSN_TLV,
+    [0x70] = OF_BSN_TLV_DSCP - OF_BSN_TLV,
+    [0x71] = OF_BSN_TLV_TTL - OF_BSN_TLV,
+    [0x72] = OF_BSN_TLV_NEXT_HOP_MAC - OF_BSN_TLV,
+    [0x73] = OF_BSN_TLV_NEXT_HOP_IPV4 - OF_BSN_TLV,
+    [0x74] = OF_BSN_TLV_RATE_LIMIT - OF_BSN_TLV,
+    [0x75] = OF_BSN_TLV_VXLAN_EGRESS_LAG - OF_BSN_TLV,
+    [0x76] = OF_BSN_TLV_CPU_LAG - OF_BSN_TLV,
+    [0x77] = OF_BSN_TLV_UINT64_LIST - OF_BSN_TLV,
+    [0x78] = OF_BSN_TLV_DISABLE_SRC_MAC_CHECK - OF_BSN_TLV,
+    [0x79] = OF_BSN_TLV_DROP - OF_BSN_TLV,
+    [0x7a] = OF_BSN_TLV_IPV6_PREFIX - OF_BSN_TLV,
+    [0x7b] = OF_BSN_TLV_NDP_OFFLOAD - OF_BSN_TLV,
+    [0x7c] = OF_BSN_TLV_NDP_STATIC - OF_BSN_TLV,
+    [0x7d] = OF_BSN_TLV_ICMPV6_CHKSUM - OF_BSN_TLV,
+    [0x7e] = OF_BSN_TLV_IPV6_SRC - OF_BSN_TLV,
+    [0x7f] = OF_BSN_TLV_IPV6_DST - OF_BSN_TLV,
+    [0x80] = OF_BSN_TLV_PUSH_VLAN_ON_INGRESS - OF_BSN_TLV,
+    [0x81] = OF_BSN_TLV_APPLY_PACKETS - OF_BSN_TLV,
+    [0x82] = OF_BSN_TLV_APPLY_BYTES - OF_BSN_TLV,
+    [0x83] = OF_BSN_TLV_ETH_TYPE - OF_BSN_TLV,
+    [0x84] = OF_BSN_TLV_ECN - OF_BSN_TLV,
+    [0x85] = OF_BSN_TLV_TCP_FLAGS - OF_BSN_TLV,
+    [0x86] = OF_BSN_TLV_L3_INTERFACE_CLASS_ID - OF_BSN_TLV,
+    [0x87] = OF_BSN_TLV_L3_SRC_CLASS_ID - OF_BSN_TLV,
+    [0x88] = OF_BSN_TLV_L3_DST_CLASS_ID - OF_BSN_TLV,
+    [0x89] = OF_BSN_TLV_EGRESS_ONLY - OF_BSN_TLV,
+    [0x8a] = OF_BSN_TLV_INGRESS_PORT_GROUP_ID - OF_BSN_TLV,
+    [0x8b] = OF_BSN_TLV_EGRESS_PORT_GROUP_ID - OF_BSN_TLV,
+    [0x8c] = OF_BSN_TLV_DATA_MASK - OF_BSN_TLV,
+    [0x8d] = OF_BSN_TLV_PORT_USAGE - OF_BSN_TLV,
+    [0x8e] = OF_BSN_TLV_TUNNEL_CAPABILITY - OF_BSN_TLV,
+    [0x8f] = OF_BSN_TLV_ENHANCED_HASH_CAPABILITY - OF_BSN_TLV,
+    [0x90] = OF_BSN_TLV_AUTO_NEGOTIATION - OF_BSN_TLV,
+};
@@ -0,0 +1,782 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_capture.c
+ *
+ * Capture file writer, index and mmap based reader.
+ *
+ ****************************************************************/
+
+#include "loci_log.h"
+#include <loci/loci.h>
+#include <loci/loci_capture.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * Message bytes examined to find the object id; the deepest
+ * discriminator is the OF 1.0 flow_mod command at offset 56.
+ */
+#define CLASSIFY_BYTES 64
+
+#define INDEX_BYTES(count) \
+    (LOCI_CAPTURE_INDEX_HEADER_LENGTH + \
+     (uint64_t)(count) * (sizeof(loci_capture_entry_t) + 3 * sizeof(uint32_t)))
+
+typedef struct capture_header_s {
+    uint32_t magic;
+    uint16_t format;
+    uint16_t flags;
+    uint64_t reserved;
+} capture_header_t;
+
+typedef struct capture_record_s {
+    uint64_t timestamp;
+    uint32_t conn_id;
+    uint32_t length;
+} capture_record_t;
+
+typedef struct capture_index_header_s {
+    uint32_t magic;
+    uint16_t format;
+    uint16_t flags;
+    uint32_t count;
+    uint32_t reserved;
+    uint64_t log_size;
+    uint64_t reserved2;
+} capture_index_header_t;
+
+static const uint8_t zeros[8];
+
+/* Write all of data to fd */
+static int
+write_all(int fd, const uint8_t *data, uint64_t len)
+{
+    ssize_t rv;
+
+    while (len > 0) {
+        rv = write(fd, data, len);
+        if (rv < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOCI_LOG_ERROR("capture write failed: %s\n", strerror(errno));
+            return OF_ERROR_RESOURCE;
+        }
+        data += rv;
+        len -= rv;
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Fill in the message derived fields of an index entry
+ */
+static void
+entry_classify(loci_capture_entry_t *e, uint8_t *msg, int len)
+{
+    of_object_storage_t storage;
+    of_object_id_t object_id;
+    uint8_t hdr[CLASSIFY_BYTES];
+    of_version_t version;
+
+    e->object_id = OF_OBJECT_INVALID;
+    e->version = 0;
+    e->xid = 0;
+    e->pad = 0;
+
+    if (len < OF_MESSAGE_MIN_LENGTH) {
+        return;
+    }
+    version = of_message_version_get(msg);
+    if (!OF_VERSION_OKAY(version) || of_message_length_get(msg) != len) {
+        return;
+    }
+
+    /* Short messages are classified from a zero padded copy */
+    if (len < CLASSIFY_BYTES) {
+        MEMSET(hdr, 0, sizeof(hdr));
+        MEMCPY(hdr, msg, len);
+        msg = hdr;
+    }
+
+    MEMSET(&storage, 0, sizeof(storage));
+    storage.obj.version = version;
+    storage.obj.wbuf = &storage.wbuf;
+    storage.wbuf.buf = msg;
+    storage.wbuf.alloc_bytes = storage.wbuf.current_bytes = CLASSIFY_BYTES;
+    of_header_wire_object_id_get(&storage.obj, &object_id);
+
+    e->object_id = object_id;
+    e->version = version;
+    e->xid = of_message_xid_get(msg);
+}
+
+/****************************************************************
+ *
+ * Index
+ *
+ ****************************************************************/
+
+typedef struct sort_key_s {
+    uint64_t key;
+    uint32_t rec;
+} sort_key_t;
+
+static int
+sort_key_cmp(const void *a, const void *b)
+{
+    const sort_key_t *ka = a, *kb = b;
+
+    if (ka->key != kb->key) {
+        return ka->key < kb->key ? -1 : 1;
+    }
+    return ka->rec < kb->rec ? -1 : (ka->rec > kb->rec);
+}
+
+enum { SORT_TYPE, SORT_XID, SORT_TIME };
+
+static inline uint64_t
+entry_key(const loci_capture_entry_t *e, int by)
+{
+    switch (by) {
+    case SORT_TYPE:
+        /* OF_OBJECT_INVALID sorts first */
+        return (uint64_t)(e->object_id + 1);
+    case SORT_XID:
+        return e->xid;
+    default:
+        return e->timestamp;
+    }
+}
+
+static void
+index_sort(const loci_capture_entry_t *entries, int count, int by,
+           sort_key_t *keys, uint32_t *out)
+{
+    int i;
+
+    for (i = 0; i < count; i++) {
+        keys[i].key = entry_key(&entries[i], by);
+        keys[i].rec = i;
+    }
+    qsort(keys, count, sizeof(*keys), sort_key_cmp);
+    for (i = 0; i < count; i++) {
+        out[i] = keys[i].rec;
+    }
+}
+
+/**
+ * Build an index in the file format
+ * @param entries Entries of the records, in record order
+ * @param count Number of records
+ * @param log_size Bytes of the log covered by the records
+ * @param size[out] Size of the index
+ * @returns The index, to be freed with FREE, or NULL
+ */
+static uint8_t *
+index_build(const loci_capture_entry_t *entries, int count,
+            uint64_t log_size, uint64_t *size)
+{
+    capture_index_header_t *hdr;
+    uint32_t *by_type, *by_xid, *by_time;
+    sort_key_t *keys;
+    uint8_t *index;
+
+    *size = INDEX_BYTES(count);
+    if ((index = MALLOC(*size)) == NULL) {
+        return NULL;
+    }
+    if ((keys = MALLOC(count * sizeof(*keys) + 1)) == NULL) {
+        FREE(index);
+        return NULL;
+    }
+
+    hdr = (capture_index_header_t *)index;
+    MEMSET(hdr, 0, sizeof(*hdr));
+    hdr->magic = LOCI_CAPTURE_INDEX_MAGIC;
+    hdr->format = LOCI_CAPTURE_FORMAT;
+    hdr->flags = LOCI_CAPTURE_HOST_FLAGS;
+    hdr->count = count;
+    hdr->log_size = log_size;
+
+    MEMCPY(index + LOCI_CAPTURE_INDEX_HEADER_LENGTH, entries,
+           count * sizeof(*entries));
+    by_type = (uint32_t *)(index + LOCI_CAPTURE_INDEX_HEADER_LENGTH +
+                           count * sizeof(*entries));
+    by_xid = by_type + count;
+    by_time = by_xid + count;
+
+    index_sort(entries, count, SORT_TYPE, keys, by_type);
+    index_sort(entries, count, SORT_XID, keys, by_xid);
+    index_sort(entries, count, SORT_TIME, keys, by_time);
+    FREE(keys);
+
+    return index;
+}
+
+static int
+index_write(const char *path, const loci_capture_entry_t *entries, int count,
+            uint64_t log_size)
+{
+    uint8_t *index;
+    uint64_t size;
+    int fd, rv;
+
+    if ((index = index_build(entries, count, log_size, &size)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    if ((fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+        LOCI_LOG_ERROR("capture index %s: %s\n", path, strerror(errno));
+        FREE(index);
+        return OF_ERROR_RESOURCE;
+    }
+    rv = write_all(fd, index, size);
+    if (close(fd) < 0 && rv == OF_ERROR_NONE) {
+        rv = OF_ERROR_RESOURCE;
+    }
+    FREE(index);
+
+    return rv;
+}
+
+/**
+ * Walk the records of a mapped log
+ * @param cap The capture with log and log_map_size set
+ * @param offset Where to start
+ * @param entries[out] Entries of the records, or NULL to only count them
+ * @returns Number of complete records
+ *
+ * Sets cap->log_size to the bytes covered by complete records.
+ */
+static int
+log_scan(loci_capture_t *cap, uint64_t offset, loci_capture_entry_t *entries)
+{
+    const capture_record_t *r;
+    int count = 0;
+
+    while (cap->log_map_size - offset >= LOCI_CAPTURE_RECORD_LENGTH &&
+           count < INT32_MAX) {
+        r = (const capture_record_t *)(cap->log + offset);
+        if (LOCI_CAPTURE_RECORD_BYTES((uint64_t)r->length) >
+            cap->log_map_size - offset) {
+            break;
+        }
+        if (entries != NULL) {
+            entries[count].offset = offset + LOCI_CAPTURE_RECORD_LENGTH;
+            entries[count].timestamp = r->timestamp;
+            entries[count].conn_id = r->conn_id;
+            entries[count].length = r->length;
+            entry_classify(&entries[count], cap->log + offset +
+                           LOCI_CAPTURE_RECORD_LENGTH, r->length);
+        }
+        offset += LOCI_CAPTURE_RECORD_BYTES((uint64_t)r->length);
+        count++;
+    }
+    cap->log_size = offset;
+
+    return count;
+}
+
+/**
+ * Point a capture at an index, checking it describes the mapped log
+ *
+ * The index must cover every complete record of the log.
+ */
+static int
+index_attach(loci_capture_t *cap, uint8_t *index, uint64_t size)
+{
+    const capture_index_header_t *hdr = (const capture_index_header_t *)index;
+    const loci_capture_entry_t *e;
+    const uint32_t *recs;
+    uint32_t count;
+    uint64_t i;
+
+    if (size < LOCI_CAPTURE_INDEX_HEADER_LENGTH ||
+        hdr->magic != LOCI_CAPTURE_INDEX_MAGIC ||
+        hdr->format != LOCI_CAPTURE_FORMAT ||
+        hdr->flags != LOCI_CAPTURE_HOST_FLAGS ||
+        hdr->count > INT32_MAX || size != INDEX_BYTES(hdr->count) ||
+        hdr->log_size < LOCI_CAPTURE_HEADER_LENGTH ||
+        hdr->log_size > cap->log_map_size ||
+        log_scan(cap, hdr->log_size, NULL) != 0) {
+        return OF_ERROR_PARSE;
+    }
+    count = hdr->count;
+
+    e = (const loci_capture_entry_t *)(index + LOCI_CAPTURE_INDEX_HEADER_LENGTH);
+    for (i = 0; i < count; i++) {
+        if (e[i].offset < LOCI_CAPTURE_HEADER_LENGTH + LOCI_CAPTURE_RECORD_LENGTH ||
+            e[i].offset + e[i].length > cap->log_size) {
+            return OF_ERROR_PARSE;
+        }
+    }
+    recs = (const uint32_t *)(e + count);
+    for (i = 0; i < 3 * (uint64_t)count; i++) {
+        if (recs[i] >= count) {
+            return OF_ERROR_PARSE;
+        }
+    }
+
+    cap->count = count;
+    cap->entries = e;
+    cap->by_type = recs;
+    cap->by_xid = recs + count;
+    cap->by_time = recs + 2 * count;
+
+    return OF_ERROR_NONE;
+}
+
+/* Build the index of a mapped log in memory */
+static int
+log_index(loci_capture_t *cap, uint8_t **index, uint64_t *size)
+{
+    loci_capture_entry_t *entries;
+    int count;
+
+    count = log_scan(cap, LOCI_CAPTURE_HEADER_LENGTH, NULL);
+    if ((entries = MALLOC(count * sizeof(*entries) + 1)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    log_scan(cap, LOCI_CAPTURE_HEADER_LENGTH, entries);
+    *index = index_build(entries, count, cap->log_size, size);
+    FREE(entries);
+
+    return *index == NULL ? OF_ERROR_RESOURCE : OF_ERROR_NONE;
+}
+
+/****************************************************************
+ *
+ * Writer
+ *
+ ****************************************************************/
+
+static char *
+index_path(const char *path)
+{
+    int len = strlen(path);
+    char *p;
+
+    if ((p = MALLOC(len + sizeof(".idx"))) != NULL) {
+        MEMCPY(p, path, len);
+        MEMCPY(p + len, ".idx", sizeof(".idx"));
+    }
+    return p;
+}
+
+/**
+ * Create a capture file
+ * @param w The writer
+ * @param path Path of the log; the index is written to <path>.idx
+ * @param buf_size Size of the output buffer, or 0 for the default
+ *
+ * An existing file at path is truncated and an existing index removed.
+ */
+int
+loci_capture_writer_open(loci_capture_writer_t *w, const char *path,
+                         int buf_size)
+{
+    capture_header_t hdr;
+
+    MEMSET(w, 0, sizeof(*w));
+    w->fd = -1;
+
+    if (buf_size <= 0) {
+        buf_size = LOCI_CAPTURE_BUFFER_SIZE;
+    }
+    if (buf_size < LOCI_CAPTURE_HEADER_LENGTH) {
+        return OF_ERROR_PARAM;
+    }
+
+    w->size = buf_size;
+    if ((w->buf = MALLOC(buf_size)) == NULL ||
+        (w->index_path = index_path(path)) == NULL) {
+        FREE(w->buf);
+        return OF_ERROR_RESOURCE;
+    }
+
+    unlink(w->index_path);
+    if ((w->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+        LOCI_LOG_ERROR("capture %s: %s\n", path, strerror(errno));
+        FREE(w->buf);
+        FREE(w->index_path);
+        return OF_ERROR_RESOURCE;
+    }
+
+    MEMSET(&hdr, 0, sizeof(hdr));
+    hdr.magic = LOCI_CAPTURE_MAGIC;
+    hdr.format = LOCI_CAPTURE_FORMAT;
+    hdr.flags = LOCI_CAPTURE_HOST_FLAGS;
+    MEMCPY(w->buf, &hdr, sizeof(hdr));
+    w->pos = sizeof(hdr);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Write out the writer's buffer
+ */
+int
+loci_capture_writer_flush(loci_capture_writer_t *w)
+{
+    int rv;
+
+    if (w->pos == 0) {
+        return OF_ERROR_NONE;
+    }
+    if ((rv = write_all(w->fd, w->buf, w->pos)) < 0) {
+        return rv;
+    }
+    w->offset += w->pos;
+    w->pos = 0;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Append a message to a capture
+ * @param w The writer
+ * @param timestamp Time the message was seen
+ * @param conn_id Connection the message was seen on
+ * @param msg The message
+ * @param len Length of msg, at most 65535
+ *
+ * The message is copied as is; it need not be valid.
+ */
+int
+loci_capture_write(loci_capture_writer_t *w, uint64_t timestamp,
+                   uint32_t conn_id, const uint8_t *msg, int len)
+{
+    capture_record_t *r;
+    loci_capture_entry_t *e;
+    int bytes = LOCI_CAPTURE_RECORD_BYTES(len);
+    int rv;
+
+    if (len < 0 || len > 0xffff) {
+        return OF_ERROR_PARAM;
+    }
+
+    if (w->count == w->alloc) {
+        int alloc = w->alloc ? 2 * w->alloc : 1024;
+
+        if ((e = MALLOC(alloc * sizeof(*e))) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        if (w->count > 0) {
+            MEMCPY(e, w->entries, w->count * sizeof(*e));
+        }
+        FREE(w->entries);
+        w->entries = e;
+        w->alloc = alloc;
+    }
+
+    if (w->size - w->pos < bytes) {
+        if ((rv = loci_capture_writer_flush(w)) < 0) {
+            return rv;
+        }
+    }
+
+    e = &w->entries[w->count];
+    e->offset = w->offset + w->pos + LOCI_CAPTURE_RECORD_LENGTH;
+    e->timestamp = timestamp;
+    e->conn_id = conn_id;
+    e->length = len;
+
+    if (w->size < bytes) {
+        /* Bigger than the whole buffer; write it directly */
+        capture_record_t rec = { timestamp, conn_id, len };
+
+        if ((rv = write_all(w->fd, (uint8_t *)&rec, sizeof(rec))) < 0 ||
+            (rv = write_all(w->fd, msg, len)) < 0 ||
+            (rv = write_all(w->fd, zeros,
+                            bytes - LOCI_CAPTURE_RECORD_LENGTH - len)) < 0) {
+            return rv;
+        }
+        w->offset += bytes;
+        entry_classify(e, (uint8_t *)msg, len);
+    } else {
+        r = (capture_record_t *)(w->buf + w->pos);
+        r->timestamp = timestamp;
+        r->conn_id = conn_id;
+        r->length = len;
+        MEMCPY(w->buf + w->pos + LOCI_CAPTURE_RECORD_LENGTH, msg, len);
+        MEMCPY(w->buf + w->pos + LOCI_CAPTURE_RECORD_LENGTH + len, zeros,
+               bytes - LOCI_CAPTURE_RECORD_LENGTH - len);
+        entry_classify(e, w->buf + w->pos + LOCI_CAPTURE_RECORD_LENGTH, len);
+        w->pos += bytes;
+    }
+    w->count++;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Append a top level object to a capture
+ */
+int
+loci_capture_write_object(loci_capture_writer_t *w, uint64_t timestamp,
+                          uint32_t conn_id, of_object_t *obj)
+{
+    if (obj->parent != NULL || obj->wbuf == NULL) {
+        return OF_ERROR_PARAM;
+    }
+    return loci_capture_write(w, timestamp, conn_id,
+                              OF_OBJECT_TO_MESSAGE(obj), obj->length);
+}
+
+/**
+ * Flush and close a capture, writing its index
+ *
+ * The writer's resources are released even on error.
+ */
+int
+loci_capture_writer_close(loci_capture_writer_t *w)
+{
+    int rv;
+
+    rv = loci_capture_writer_flush(w);
+    if (close(w->fd) < 0 && rv == OF_ERROR_NONE) {
+        rv = OF_ERROR_RESOURCE;
+    }
+    if (rv == OF_ERROR_NONE) {
+        rv = index_write(w->index_path, w->entries, w->count,
+                         w->offset + w->pos);
+    }
+
+    FREE(w->buf);
+    FREE(w->entries);
+    FREE(w->index_path);
+    MEMSET(w, 0, sizeof(*w));
+    w->fd = -1;
+
+    return rv;
+}
+
+/****************************************************************
+ *
+ * Reader
+ *
+ ****************************************************************/
+
+/* Map a whole file; read-only unless writable, which maps it private */
+static int
+map_file(const char *path, int writable, uint8_t **map, uint64_t *size)
+{
+    struct stat st;
+    void *p;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0) {
+        return OF_ERROR_RESOURCE;
+    }
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return OF_ERROR_PARSE;
+    }
+    p = mmap(NULL, st.st_size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+             MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return OF_ERROR_RESOURCE;
+    }
+    *map = p;
+    *size = st.st_size;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Open a capture
+ * @param cap The capture to initialize
+ * @param path Path of the log
+ *
+ * Uses <path>.idx if it describes the whole log and otherwise indexes
+ * the log in memory.
+ */
+int
+loci_capture_open(loci_capture_t *cap, const char *path)
+{
+    const capture_header_t *hdr;
+    char *ipath;
+    int rv;
+
+    MEMSET(cap, 0, sizeof(*cap));
+
+    if ((rv = map_file(path, 1, &cap->log, &cap->log_map_size)) < 0) {
+        LOCI_LOG_ERROR("capture %s: can't map\n", path);
+        return rv;
+    }
+    hdr = (const capture_header_t *)cap->log;
+    if (cap->log_map_size < LOCI_CAPTURE_HEADER_LENGTH ||
+        hdr->magic != LOCI_CAPTURE_MAGIC ||
+        hdr->format != LOCI_CAPTURE_FORMAT ||
+        hdr->flags != LOCI_CAPTURE_HOST_FLAGS) {
+        LOCI_LOG_ERROR("capture %s: bad header\n", path);
+        loci_capture_close(cap);
+        return OF_ERROR_PARSE;
+    }
+    if ((ipath = index_path(path)) == NULL) {
+        loci_capture_close(cap);
+        return OF_ERROR_RESOURCE;
+    }
+    rv = map_file(ipath, 0, &cap->index, &cap->index_size);
+    FREE(ipath);
+    if (rv == OF_ERROR_NONE) {
+        cap->index_mapped = 1;
+        if (index_attach(cap, cap->index, cap->index_size) == OF_ERROR_NONE) {
+            return OF_ERROR_NONE;
+        }
+        munmap(cap->index, cap->index_size);
+        cap->index = NULL;
+        cap->index_mapped = 0;
+    }
+
+    /* No usable index */
+    if ((rv = log_index(cap, &cap->index, &cap->index_size)) < 0 ||
+        (rv = index_attach(cap, cap->index, cap->index_size)) < 0) {
+        loci_capture_close(cap);
+        return rv;
+    }
+
+    return OF_ERROR_NONE;
+}
+
+void
+loci_capture_close(loci_capture_t *cap)
+{
+    if (cap->log != NULL) {
+        munmap(cap->log, cap->log_map_size);
+    }
+    if (cap->index != NULL) {
+        if (cap->index_mapped) {
+            munmap(cap->index, cap->index_size);
+        } else {
+            FREE(cap->index);
+        }
+    }
+    MEMSET(cap, 0, sizeof(*cap));
+}
+
+/**
+ * Rewrite the index of a capture from its log
+ *
+ * Recovers the index of a capture whose writer was not closed.
+ */
+int
+loci_capture_reindex(const char *path)
+{
+    loci_capture_t cap;
+    char *ipath;
+    int rv;
+
+    if ((ipath = index_path(path)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    unlink(ipath);
+    if ((rv = loci_capture_open(&cap, path)) == OF_ERROR_NONE) {
+        rv = index_write(ipath, cap.entries, cap.count, cap.log_size);
+        loci_capture_close(&cap);
+    }
+    FREE(ipath);
+
+    return rv;
+}
+
+/**
+ * Get a record as an object
+ * @param cap The capture
+ * @param rec The record number
+ * @param storage Storage for the object
+ * @returns The object, referring to the message in the mapped log, or
+ * NULL if the record is not a valid message
+ */
+of_object_t *
+loci_capture_object(loci_capture_t *cap, int rec, of_object_storage_t *storage)
+{
+    const loci_capture_entry_t *e;
+
+    if (rec < 0 || rec >= cap->count) {
+        return NULL;
+    }
+    e = &cap->entries[rec];
+    if (e->object_id == OF_OBJECT_INVALID) {
+        return NULL;
+    }
+
+    return of_object_new_from_message_preallocated(
+        storage, cap->log + e->offset, e->length);
+}
+
+/* First position in recs whose record's key is >= key */
+static int
+lower_bound(loci_capture_t *cap, const uint32_t *recs, int by, uint64_t key)
+{
+    int lo = 0, hi = cap->count, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (entry_key(&cap->entries[recs[mid]], by) < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+static loci_capture_range_t
+range_get(loci_capture_t *cap, const uint32_t *recs, int by,
+          uint64_t start, uint64_t end)
+{
+    loci_capture_range_t range;
+    int first, last;
+
+    first = lower_bound(cap, recs, by, start);
+    last = lower_bound(cap, recs, by, end);
+    range.rec = recs + first;
+    range.count = last > first ? last - first : 0;
+
+    return range;
+}
+
+/**
+ * Records of one object type, in record order
+ */
+loci_capture_range_t
+loci_capture_by_type(loci_capture_t *cap, of_object_id_t object_id)
+{
+    uint64_t key = (uint64_t)(object_id + 1);
+
+    return range_get(cap, cap->by_type, SORT_TYPE, key, key + 1);
+}
+
+/**
+ * Records with an xid, in record order
+ *
+ * Records of every connection are included; check conn_id to pair
+ * requests with replies.
+ */
+loci_capture_range_t
+loci_capture_by_xid(loci_capture_t *cap, uint32_t xid)
+{
+    return range_get(cap, cap->by_xid, SORT_XID, xid, (uint64_t)xid + 1);
+}
+
+/**
+ * Records with start <= timestamp < end, in timestamp order
+ */
+loci_capture_range_t
+loci_capture_by_time(loci_capture_t *cap, uint64_t start, uint64_t end)
+{
+    return range_get(cap, cap->by_time, SORT_TIME, start, end);
+}
@@ -0,0 +1,694 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_classifier.c
+ *
+ * Tuple space classifier with a per table lookup cache.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_classifier.h>
+
+/* The fields are handled as an array of 64 bit words */
+#define FIELDS_WORDS (sizeof(of_match_fields_t) / sizeof(uint64_t))
+
+/* Initial buckets of a tuple's hash table, a power of 2 */
+#define TUPLE_BUCKETS 16
+
+typedef struct cls_rule_s {
+    struct cls_rule_s *next;
+    uint16_t priority;
+    void *data;
+} cls_rule_t;
+
+/* The rules of a tuple with the same masked fields */
+typedef struct cls_node_s {
+    struct cls_node_s *next;
+    uint32_t hash;
+    /** Highest priority first */
+    cls_rule_t *rules;
+    uint64_t key[];
+} cls_node_t;
+
+typedef struct cls_priority_s {
+    uint16_t priority;
+    int count;
+} cls_priority_t;
+
+/* The words a mask covers, and the mask of each */
+typedef struct cls_words_s {
+    int count;
+    uint16_t index[FIELDS_WORDS];
+    uint64_t mask[FIELDS_WORDS];
+} cls_words_t;
+
+typedef struct cls_tuple_s {
+    cls_words_t words;
+    cls_node_t **buckets;
+    uint32_t n_buckets;
+    uint32_t n_nodes;
+    /** Distinct priorities of the rules, highest first, with counts */
+    cls_priority_t *priorities;
+    int n_priorities;
+    int alloc_priorities;
+} cls_tuple_t;
+
+typedef struct cls_cache_slot_s {
+    uint32_t gen;
+    uint32_t hash;
+    cls_rule_t *rule;
+} cls_cache_slot_t;
+
+struct loci_classifier_table_s {
+    /** Highest top priority first */
+    cls_tuple_t **tuples;
+    int n_tuples;
+    int alloc_tuples;
+    /** Words covered by any tuple: the cache key */
+    cls_words_t words;
+    cls_cache_slot_t *cache;
+    /** A key per cache slot; NULL when there is no cache */
+    uint64_t *cache_keys;
+    /** Slots of an older generation are empty */
+    uint32_t gen;
+};
+
+static void
+words_from_mask(const of_match_fields_t *mask, cls_words_t *words)
+{
+    const uint64_t *m = (const uint64_t *)mask;
+    int i;
+
+    words->count = 0;
+    for (i = 0; i < FIELDS_WORDS; i++) {
+        if (m[i] != 0) {
+            words->index[words->count] = i;
+            words->mask[words->count] = m[i];
+            words->count++;
+        }
+    }
+}
+
+static int
+words_eq(const cls_words_t *w1, const cls_words_t *w2)
+{
+    return w1->count == w2->count &&
+        MEMCMP(w1->index, w2->index, w1->count * sizeof(w1->index[0])) == 0 &&
+        MEMCMP(w1->mask, w2->mask, w1->count * sizeof(w1->mask[0])) == 0;
+}
+
+/**
+ * Mask the covered words of fields into key
+ * @returns The hash of the key
+ */
+static inline uint32_t
+key_extract(const uint64_t *fields, const cls_words_t *words, uint64_t *key)
+{
+    uint64_t hash = 0;
+    int i;
+
+    for (i = 0; i < words->count; i++) {
+        key[i] = fields[words->index[i]] & words->mask[i];
+        hash = (hash ^ key[i]) * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 29;
+    }
+
+    return hash ^ (hash >> 32);
+}
+
+static inline cls_node_t *
+tuple_node_find(cls_tuple_t *tuple, const uint64_t *key, uint32_t hash)
+{
+    cls_node_t *node;
+
+    for (node = tuple->buckets[hash & (tuple->n_buckets - 1)];
+         node != NULL; node = node->next) {
+        if (node->hash == hash &&
+            MEMCMP(node->key, key,
+                   tuple->words.count * sizeof(uint64_t)) == 0) {
+            return node;
+        }
+    }
+
+    return NULL;
+}
+
+/* Double the buckets; on failure the chains just get longer */
+static void
+tuple_grow(cls_tuple_t *tuple)
+{
+    cls_node_t **buckets, *node, *next;
+    uint32_t n_buckets = tuple->n_buckets * 2;
+    uint32_t i;
+
+    if ((buckets = MALLOC(n_buckets * sizeof(*buckets))) == NULL) {
+        return;
+    }
+    MEMSET(buckets, 0, n_buckets * sizeof(*buckets));
+    for (i = 0; i < tuple->n_buckets; i++) {
+        for (node = tuple->buckets[i]; node != NULL; node = next) {
+            next = node->next;
+            node->next = buckets[node->hash & (n_buckets - 1)];
+            buckets[node->hash & (n_buckets - 1)] = node;
+        }
+    }
+    FREE(tuple->buckets);
+    tuple->buckets = buckets;
+    tuple->n_buckets = n_buckets;
+}
+
+static cls_node_t *
+tuple_node_get(cls_tuple_t *tuple, const uint64_t *key, uint32_t hash)
+{
+    cls_node_t *node;
+    int key_bytes = tuple->words.count * sizeof(uint64_t);
+
+    if ((node = tuple_node_find(tuple, key, hash)) != NULL) {
+        return node;
+    }
+    if ((node = MALLOC(sizeof(*node) + key_bytes)) == NULL) {
+        return NULL;
+    }
+    node->hash = hash;
+    node->rules = NULL;
+    MEMCPY(node->key, key, key_bytes);
+    node->next = tuple->buckets[hash & (tuple->n_buckets - 1)];
+    tuple->buckets[hash & (tuple->n_buckets - 1)] = node;
+    if (++tuple->n_nodes > tuple->n_buckets) {
+        tuple_grow(tuple);
+    }
+
+    return node;
+}
+
+static void
+tuple_node_remove(cls_tuple_t *tuple, cls_node_t *node)
+{
+    cls_node_t **prev;
+
+    for (prev = &tuple->buckets[node->hash & (tuple->n_buckets - 1)];
+         *prev != node; prev = &(*prev)->next) {
+    }
+    *prev = node->next;
+    FREE(node);
+    tuple->n_nodes--;
+}
+
+static int
+priority_add(cls_tuple_t *tuple, uint16_t priority)
+{
+    cls_priority_t *p;
+    int i;
+
+    for (i = 0; i < tuple->n_priorities; i++) {
+        if (tuple->priorities[i].priority == priority) {
+            tuple->priorities[i].count++;
+            return OF_ERROR_NONE;
+        }
+        if (tuple->priorities[i].priority < priority) {
+            break;
+        }
+    }
+
+    if (tuple->n_priorities == tuple->alloc_priorities) {
+        int alloc = tuple->alloc_priorities ? 2 * tuple->alloc_priorities : 4;
+
+        if ((p = MALLOC(alloc * sizeof(*p))) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        if (tuple->n_priorities > 0) {
+            MEMCPY(p, tuple->priorities, tuple->n_priorities * sizeof(*p));
+        }
+        FREE(tuple->priorities);
+        tuple->priorities = p;
+        tuple->alloc_priorities = alloc;
+    }
+    MEMMOVE(&tuple->priorities[i + 1], &tuple->priorities[i],
+            (tuple->n_priorities - i) * sizeof(*tuple->priorities));
+    tuple->priorities[i].priority = priority;
+    tuple->priorities[i].count = 1;
+    tuple->n_priorities++;
+
+    return OF_ERROR_NONE;
+}
+
+static void
+priority_remove(cls_tuple_t *tuple, uint16_t priority)
+{
+    int i;
+
+    for (i = 0; tuple->priorities[i].priority != priority; i++) {
+    }
+    if (--tuple->priorities[i].count == 0) {
+        MEMMOVE(&tuple->priorities[i], &tuple->priorities[i + 1],
+                (tuple->n_priorities - i - 1) * sizeof(*tuple->priorities));
+        tuple->n_priorities--;
+    }
+}
+
+static void
+tuple_free(cls_tuple_t *tuple)
+{
+    cls_node_t *node, *next_node;
+    cls_rule_t *rule, *next_rule;
+    uint32_t i;
+
+    for (i = 0; i < tuple->n_buckets; i++) {
+        for (node = tuple->buckets[i]; node != NULL; node = next_node) {
+            next_node = node->next;
+            for (rule = node->rules; rule != NULL; rule = next_rule) {
+                next_rule = rule->next;
+                FREE(rule);
+            }
+            FREE(node);
+        }
+    }
+    FREE(tuple->buckets);
+    FREE(tuple->priorities);
+    FREE(tuple);
+}
+
+/* Empty the cache of a table */
+static void
+table_flush(loci_classifier_t *cls, loci_classifier_table_t *table)
+{
+    if (++table->gen == 0) {
+        MEMSET(table->cache, 0, cls->cache_slots * sizeof(*table->cache));
+        table->gen = 1;
+    }
+}
+
+/**
+ * Recompute the cache key after the tuples changed
+ *
+ * If the keys can't be allocated the table goes without a cache.
+ */
+static void
+table_words_update(loci_classifier_t *cls, loci_classifier_table_t *table)
+{
+    uint64_t mask[FIELDS_WORDS];
+    cls_tuple_t *tuple;
+    int i, j;
+
+    MEMSET(mask, 0, sizeof(mask));
+    for (i = 0; i < table->n_tuples; i++) {
+        tuple = table->tuples[i];
+        for (j = 0; j < tuple->words.count; j++) {
+            mask[tuple->words.index[j]] |= tuple->words.mask[j];
+        }
+    }
+    words_from_mask((of_match_fields_t *)mask, &table->words);
+
+    table_flush(cls, table);
+    if (cls->cache_slots > 0) {
+        FREE(table->cache_keys);
+        table->cache_keys = MALLOC(cls->cache_slots * sizeof(uint64_t) *
+                                   (table->words.count ? table->words.count : 1));
+    }
+}
+
+/* Move a tuple to its place in the order of top priorities */
+static void
+table_tuple_sort(loci_classifier_table_t *table, cls_tuple_t *tuple)
+{
+    cls_tuple_t **tuples = table->tuples;
+    uint16_t top = tuple->priorities[0].priority;
+    int i;
+
+    for (i = 0; tuples[i] != tuple; i++) {
+    }
+    while (i > 0 && tuples[i - 1]->priorities[0].priority < top) {
+        tuples[i] = tuples[i - 1];
+        i--;
+    }
+    while (i + 1 < table->n_tuples &&
+           tuples[i + 1]->priorities[0].priority > top) {
+        tuples[i] = tuples[i + 1];
+        i++;
+    }
+    tuples[i] = tuple;
+}
+
+static cls_tuple_t *
+table_tuple_find(loci_classifier_table_t *table, const cls_words_t *words)
+{
+    int i;
+
+    for (i = 0; i < table->n_tuples; i++) {
+        if (words_eq(&table->tuples[i]->words, words)) {
+            return table->tuples[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Find the tuple of a mask, making it if needed */
+static cls_tuple_t *
+table_tuple_get(loci_classifier_t *cls, loci_classifier_table_t *table,
+                const of_match_fields_t *mask)
+{
+    cls_words_t words;
+    cls_tuple_t *tuple, **tuples;
+
+    words_from_mask(mask, &words);
+    if ((tuple = table_tuple_find(table, &words)) != NULL) {
+        return tuple;
+    }
+
+    if (table->n_tuples == table->alloc_tuples) {
+        int alloc = table->alloc_tuples ? 2 * table->alloc_tuples : 8;
+
+        if ((tuples = MALLOC(alloc * sizeof(*tuples))) == NULL) {
+            return NULL;
+        }
+        if (table->n_tuples > 0) {
+            MEMCPY(tuples, table->tuples, table->n_tuples * sizeof(*tuples));
+        }
+        FREE(table->tuples);
+        table->tuples = tuples;
+        table->alloc_tuples = alloc;
+    }
+
+    if ((tuple = MALLOC(sizeof(*tuple))) == NULL) {
+        return NULL;
+    }
+    MEMSET(tuple, 0, sizeof(*tuple));
+    tuple->words = words;
+    tuple->n_buckets = TUPLE_BUCKETS;
+    if ((tuple->buckets = MALLOC(TUPLE_BUCKETS *
+                                 sizeof(*tuple->buckets))) == NULL) {
+        FREE(tuple);
+        return NULL;
+    }
+    MEMSET(tuple->buckets, 0, TUPLE_BUCKETS * sizeof(*tuple->buckets));
+
+    /* Empty until its first rule is in, when it is sorted */
+    table->tuples[table->n_tuples++] = tuple;
+    table_words_update(cls, table);
+
+    return tuple;
+}
+
+/**
+ * Free a node without rules, then the tuple if it has no nodes
+ * @returns 1 if the tuple was freed
+ */
+static int
+table_tuple_prune(loci_classifier_t *cls, loci_classifier_table_t *table,
+                  cls_tuple_t *tuple, cls_node_t *node)
+{
+    int i;
+
+    if (node != NULL && node->rules == NULL) {
+        tuple_node_remove(tuple, node);
+    }
+    if (tuple->n_nodes > 0) {
+        return 0;
+    }
+
+    for (i = 0; table->tuples[i] != tuple; i++) {
+    }
+    MEMMOVE(&table->tuples[i], &table->tuples[i + 1],
+            (table->n_tuples - i - 1) * sizeof(*table->tuples));
+    table->n_tuples--;
+    tuple_free(tuple);
+    table_words_update(cls, table);
+
+    return 1;
+}
+
+static loci_classifier_table_t *
+table_get(loci_classifier_t *cls, uint8_t table_id)
+{
+    loci_classifier_table_t *table;
+
+    if ((table = cls->tables[table_id]) != NULL) {
+        return table;
+    }
+    if ((table = MALLOC(sizeof(*table))) == NULL) {
+        return NULL;
+    }
+    MEMSET(table, 0, sizeof(*table));
+    table->gen = 1;
+    if (cls->cache_slots > 0) {
+        if ((table->cache = MALLOC(cls->cache_slots *
+                                   sizeof(*table->cache))) == NULL) {
+            FREE(table);
+            return NULL;
+        }
+        MEMSET(table->cache, 0, cls->cache_slots * sizeof(*table->cache));
+    }
+    cls->tables[table_id] = table;
+
+    return table;
+}
+
+/**
+ * Initialize a classifier
+ * @param cls The classifier
+ * @param cache_slots Cache slots per table, a power of 2, or 0 for no
+ * cache
+ * @returns 0 or OF_ERROR_PARAM
+ */
+int
+loci_classifier_init(loci_classifier_t *cls, int cache_slots)
+{
+    MEMSET(cls, 0, sizeof(*cls));
+
+    if (cache_slots < 0 || (cache_slots & (cache_slots - 1)) != 0) {
+        return OF_ERROR_PARAM;
+    }
+    cls->cache_slots = cache_slots;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Free the flows and tables of a classifier
+ *
+ * The flows' data pointers are the caller's.
+ */
+void
+loci_classifier_cleanup(loci_classifier_t *cls)
+{
+    loci_classifier_table_t *table;
+    int i, j;
+
+    for (i = 0; i < LOCI_CLASSIFIER_TABLES; i++) {
+        if ((table = cls->tables[i]) == NULL) {
+            continue;
+        }
+        for (j = 0; j < table->n_tuples; j++) {
+            tuple_free(table->tuples[j]);
+        }
+        FREE(table->tuples);
+        FREE(table->cache);
+        FREE(table->cache_keys);
+        FREE(table);
+    }
+    MEMSET(cls, 0, sizeof(*cls));
+}
+
+/**
+ * Add a flow
+ * @param cls The classifier
+ * @param table_id Table of the flow
+ * @param match The flow's match; field bits outside the masks are
+ * ignored
+ * @param priority Priority of the flow
+ * @param data Returned by lookups that find the flow; not NULL
+ * @returns 0, OF_ERROR_PARAM if data is NULL or the table has a flow
+ * with the same match and priority, or OF_ERROR_RESOURCE
+ */
+int
+loci_classifier_add(loci_classifier_t *cls, uint8_t table_id,
+                    const of_match_t *match, uint16_t priority, void *data)
+{
+    loci_classifier_table_t *table;
+    cls_tuple_t *tuple;
+    cls_node_t *node;
+    cls_rule_t *rule, **prev;
+    uint64_t key[FIELDS_WORDS];
+    uint32_t hash;
+    int rv;
+
+    if (data == NULL) {
+        return OF_ERROR_PARAM;
+    }
+    if ((table = table_get(cls, table_id)) == NULL ||
+        (tuple = table_tuple_get(cls, table, &match->masks)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+
+    hash = key_extract((const uint64_t *)&match->fields, &tuple->words, key);
+    if ((node = tuple_node_get(tuple, key, hash)) == NULL) {
+        rv = OF_ERROR_RESOURCE;
+        goto prune;
+    }
+    for (prev = &node->rules; *prev != NULL && (*prev)->priority > priority;
+         prev = &(*prev)->next) {
+    }
+    if (*prev != NULL && (*prev)->priority == priority) {
+        rv = OF_ERROR_PARAM;
+        goto prune;
+    }
+    if ((rule = MALLOC(sizeof(*rule))) == NULL) {
+        rv = OF_ERROR_RESOURCE;
+        goto prune;
+    }
+    if (priority_add(tuple, priority) < 0) {
+        FREE(rule);
+        rv = OF_ERROR_RESOURCE;
+        goto prune;
+    }
+
+    rule->priority = priority;
+    rule->data = data;
+    rule->next = *prev;
+    *prev = rule;
+    table_tuple_sort(table, tuple);
+    table_flush(cls, table);
+    cls->count++;
+
+    return OF_ERROR_NONE;
+
+ prune:
+    table_tuple_prune(cls, table, tuple, node);
+    return rv;
+}
+
+/**
+ * Remove a flow
+ * @param cls The classifier
+ * @param table_id Table of the flow
+ * @param match The flow's match
+ * @param priority Priority of the flow
+ * @param data If not NULL, set to the flow's data
+ * @returns 0 or OF_ERROR_RANGE if there is no such flow
+ */
+int
+loci_classifier_remove(loci_classifier_t *cls, uint8_t table_id,
+                       const of_match_t *match, uint16_t priority,
+                       void **data)
+{
+    loci_classifier_table_t *table;
+    cls_words_t words;
+    cls_tuple_t *tuple;
+    cls_node_t *node;
+    cls_rule_t *rule, **prev;
+    uint64_t key[FIELDS_WORDS];
+    uint32_t hash;
+
+    if ((table = cls->tables[table_id]) == NULL) {
+        return OF_ERROR_RANGE;
+    }
+    words_from_mask(&match->masks, &words);
+    if ((tuple = table_tuple_find(table, &words)) == NULL) {
+        return OF_ERROR_RANGE;
+    }
+    hash = key_extract((const uint64_t *)&match->fields, &tuple->words, key);
+    if ((node = tuple_node_find(tuple, key, hash)) == NULL) {
+        return OF_ERROR_RANGE;
+    }
+    for (prev = &node->rules; *prev != NULL && (*prev)->priority > priority;
+         prev = &(*prev)->next) {
+    }
+    if ((rule = *prev) == NULL || rule->priority != priority) {
+        return OF_ERROR_RANGE;
+    }
+
+    *prev = rule->next;
+    if (data != NULL) {
+        *data = rule->data;
+    }
+    FREE(rule);
+    priority_remove(tuple, priority);
+    table_flush(cls, table);
+    cls->count--;
+
+    if (!table_tuple_prune(cls, table, tuple, node)) {
+        table_tuple_sort(table, tuple);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/* The highest priority rule matching the fields, or NULL */
+static cls_rule_t *
+table_tuples_lookup(loci_classifier_table_t *table, const uint64_t *fields)
+{
+    uint64_t key[FIELDS_WORDS];
+    cls_rule_t *best = NULL;
+    cls_tuple_t *tuple;
+    cls_node_t *node;
+    uint32_t hash;
+    int i;
+
+    for (i = 0; i < table->n_tuples; i++) {
+        tuple = table->tuples[i];
+        if (best != NULL && tuple->priorities[0].priority <= best->priority) {
+            break;
+        }
+        hash = key_extract(fields, &tuple->words, key);
+        if ((node = tuple_node_find(tuple, key, hash)) != NULL &&
+            (best == NULL || node->rules->priority > best->priority)) {
+            best = node->rules;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Find the highest priority flow matching a packet
+ * @param cls The classifier
+ * @param table_id Table to look in
+ * @param fields The packet's fields
+ * @returns The flow's data, or NULL if no flow matches
+ */
+void *
+loci_classifier_lookup(loci_classifier_t *cls, uint8_t table_id,
+                       const of_match_fields_t *fields)
+{
+    loci_classifier_table_t *table;
+    const uint64_t *f = (const uint64_t *)fields;
+    uint64_t key[FIELDS_WORDS], *slot_key;
+    cls_cache_slot_t *slot;
+    cls_rule_t *rule;
+    uint32_t hash, idx;
+    int key_bytes;
+
+    if ((table = cls->tables[table_id]) == NULL) {
+        return NULL;
+    }
+    if (table->cache_keys == NULL) {
+        rule = table_tuples_lookup(table, f);
+        return rule != NULL ? rule->data : NULL;
+    }
+
+    hash = key_extract(f, &table->words, key);
+    idx = hash & (cls->cache_slots - 1);
+    slot = &table->cache[idx];
+    slot_key = &table->cache_keys[idx * table->words.count];
+    key_bytes = table->words.count * sizeof(uint64_t);
+    if (slot->gen == table->gen && slot->hash == hash &&
+        MEMCMP(slot_key, key, key_bytes) == 0) {
+        cls->cache_hits++;
+        rule = slot->rule;
+    } else {
+        cls->cache_misses++;
+        rule = table_tuples_lookup(table, f);
+        slot->gen = table->gen;
+        slot->hash = hash;
+        slot->rule = rule;
+        MEMCPY(slot_key, key, key_bytes);
+    }
+
+    return rule != NULL ? rule->data : NULL;
+}
@@ -0,0 +1,943 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_columns.c
+ *
+ * Stats lists read into per-field columns, and deltas between polls.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_columns.h>
+#include <loci/loci_hash.h>
+#include "loci_int.h"
+
+/* Not in this version, or no such thing */
+#define NA -1
+
+/* The offset is into the property the class reads, not the entry */
+#define PROP_FLAG 0x4000
+#define PROP(offset) (PROP_FLAG | (offset))
+
+/* A port number: 16 bits in 1.0, widened as the accessors do */
+#define PORT_NO_WIDTH 0
+
+/* Offsets by version, as of_object_fixed_len */
+#define ALL(o) { NA, o, o, o, o, o }
+#define V(v1, v2, v3, v4, v5) { NA, v1, v2, v3, v4, v5 }
+
+/* The wire type of of_port_stats_prop_ethernet */
+#define PORT_STATS_PROP_ETHERNET 0
+
+/* Where a column's values come from */
+typedef enum field_source_e {
+    FIELD_WIRE,                 /* The entry, at the offset */
+    FIELD_MATCH_HASH,           /* loci_match_hash of a flow's match */
+} field_source_t;
+
+typedef struct field_s {
+    const char *name;
+    uint8_t kind;
+    uint8_t width;
+    int16_t offset[OF_VERSION_ARRAY_MAX]; /* NA if computed */
+    uint8_t source;             /* field_source_t */
+} field_t;
+
+struct loci_columns_class_s {
+    of_object_id_t entry_id;
+    of_object_id_t list_id;
+    int16_t length_offset[OF_VERSION_ARRAY_MAX]; /* NA if fixed length */
+    of_object_id_t prop_id;     /* Property PROP() offsets are into */
+    int16_t values_offset;      /* Of a BSN counter values list, or NA */
+    const field_t *fields;
+    int n_fields;
+};
+
+/****************************************************************
+ * Entry classes
+ ****************************************************************/
+
+static const field_t port_stats_fields[] = {
+    { "port_no", LOCI_COLUMN_KEY, PORT_NO_WIDTH, V(0, 0, 0, 0, 4) },
+    { "duration_sec", LOCI_COLUMN_GAUGE, 4, V(NA, NA, NA, 104, 8) },
+    { "duration_nsec", LOCI_COLUMN_GAUGE, 4, V(NA, NA, NA, 108, 12) },
+    { "rx_packets", LOCI_COLUMN_COUNTER, 8, V(8, 8, 8, 8, 16) },
+    { "tx_packets", LOCI_COLUMN_COUNTER, 8, V(16, 16, 16, 16, 24) },
+    { "rx_bytes", LOCI_COLUMN_COUNTER, 8, V(24, 24, 24, 24, 32) },
+    { "tx_bytes", LOCI_COLUMN_COUNTER, 8, V(32, 32, 32, 32, 40) },
+    { "rx_dropped", LOCI_COLUMN_COUNTER, 8, V(40, 40, 40, 40, 48) },
+    { "tx_dropped", LOCI_COLUMN_COUNTER, 8, V(48, 48, 48, 48, 56) },
+    { "rx_errors", LOCI_COLUMN_COUNTER, 8, V(56, 56, 56, 56, 64) },
+    { "tx_errors", LOCI_COLUMN_COUNTER, 8, V(64, 64, 64, 64, 72) },
+    { "rx_frame_err", LOCI_COLUMN_COUNTER, 8, V(72, 72, 72, 72, PROP(8)) },
+    { "rx_over_err", LOCI_COLUMN_COUNTER, 8, V(80, 80, 80, 80, PROP(16)) },
+    { "rx_crc_err", LOCI_COLUMN_COUNTER, 8, V(88, 88, 88, 88, PROP(24)) },
+    { "collisions", LOCI_COLUMN_COUNTER, 8, V(96, 96, 96, 96, PROP(32)) },
+};
+
+static const field_t queue_stats_fields[] = {
+    { "port_no", LOCI_COLUMN_KEY, PORT_NO_WIDTH, V(0, 0, 0, 0, 8) },
+    { "queue_id", LOCI_COLUMN_KEY, 4, V(4, 4, 4, 4, 12) },
+    { "tx_bytes", LOCI_COLUMN_COUNTER, 8, V(8, 8, 8, 8, 16) },
+    { "tx_packets", LOCI_COLUMN_COUNTER, 8, V(16, 16, 16, 16, 24) },
+    { "tx_errors", LOCI_COLUMN_COUNTER, 8, V(24, 24, 24, 24, 32) },
+    { "duration_sec", LOCI_COLUMN_GAUGE, 4, V(NA, NA, NA, 32, 40) },
+    { "duration_nsec", LOCI_COLUMN_GAUGE, 4, V(NA, NA, NA, 36, 44) },
+};
+
+static const field_t table_stats_fields[] = {
+    { "table_id", LOCI_COLUMN_KEY, 1, ALL(0) },
+    { "max_entries", LOCI_COLUMN_GAUGE, 4, V(40, 64, 104, NA, NA) },
+    { "active_count", LOCI_COLUMN_GAUGE, 4, V(44, 68, 108, 4, 4) },
+    { "lookup_count", LOCI_COLUMN_COUNTER, 8, V(48, 72, 112, 8, 8) },
+    { "matched_count", LOCI_COLUMN_COUNTER, 8, V(56, 80, 120, 16, 16) },
+};
+
+/*
+ * Flows with the same table, priority and cookie are told apart by
+ * the hash of their match
+ */
+static const field_t flow_stats_fields[] = {
+    { "table_id", LOCI_COLUMN_KEY, 1, ALL(2) },
+    { "priority", LOCI_COLUMN_KEY, 2, V(52, 12, 12, 12, 12) },
+    { "cookie", LOCI_COLUMN_KEY, 8, V(64, 24, 24, 24, 24) },
+    { "match_hash", LOCI_COLUMN_KEY, 8, ALL(NA), FIELD_MATCH_HASH },
+    { "duration_sec", LOCI_COLUMN_GAUGE, 4, V(44, 4, 4, 4, 4) },
+    { "duration_nsec", LOCI_COLUMN_GAUGE, 4, V(48, 8, 8, 8, 8) },
+    { "idle_timeout", LOCI_COLUMN_GAUGE, 2, V(54, 14, 14, 14, 14) },
+    { "hard_timeout", LOCI_COLUMN_GAUGE, 2, V(56, 16, 16, 16, 16) },
+    { "packet_count", LOCI_COLUMN_COUNTER, 8, V(72, 32, 32, 32, 32) },
+    { "byte_count", LOCI_COLUMN_COUNTER, 8, V(80, 40, 40, 40, 40) },
+};
+
+static const field_t meter_stats_fields[] = {
+    { "meter_id", LOCI_COLUMN_KEY, 4, V(NA, NA, NA, 0, 0) },
+    { "flow_count", LOCI_COLUMN_GAUGE, 4, V(NA, NA, NA, 12, 12) },
+    { "packet_in_count", LOCI_COLUMN_COUNTER, 8, V(NA, NA, NA, 16, 16) },
+    { "byte_in_count", LOCI_COLUMN_COUNTER, 8, V(NA, NA, NA, 24, 24) },
+    { "duration_sec", LOCI_COLUMN_GAUGE, 4, V(NA, NA, NA, 32, 32) },
+    { "duration_nsec", LOCI_COLUMN_GAUGE, 4, V(NA, NA, NA, 36, 36) },
+};
+
+static const field_t bsn_port_counter_fields[] = {
+    { "port_no", LOCI_COLUMN_KEY, PORT_NO_WIDTH, V(NA, NA, NA, 4, 4) },
+};
+
+static const field_t bsn_vlan_counter_fields[] = {
+    { "vlan_vid", LOCI_COLUMN_KEY, 2, V(NA, NA, NA, 2, 2) },
+};
+
+static const field_t bsn_vrf_counter_fields[] = {
+    { "vrf", LOCI_COLUMN_KEY, 4, V(NA, NA, NA, 4, 4) },
+};
+
+#define FIELDS(fields) fields, sizeof(fields) / sizeof((fields)[0])
+
+static const loci_columns_class_t classes[] = {
+    { OF_PORT_STATS_ENTRY, OF_LIST_PORT_STATS_ENTRY, V(NA, NA, NA, NA, 0),
+      OF_PORT_STATS_PROP_ETHERNET, NA, FIELDS(port_stats_fields) },
+    { OF_QUEUE_STATS_ENTRY, OF_LIST_QUEUE_STATS_ENTRY, V(NA, NA, NA, NA, 0),
+      OF_OBJECT, NA, FIELDS(queue_stats_fields) },
+    { OF_TABLE_STATS_ENTRY, OF_LIST_TABLE_STATS_ENTRY, ALL(NA),
+      OF_OBJECT, NA, FIELDS(table_stats_fields) },
+    { OF_FLOW_STATS_ENTRY, OF_LIST_FLOW_STATS_ENTRY, ALL(0),
+      OF_OBJECT, NA, FIELDS(flow_stats_fields) },
+    { OF_METER_STATS, OF_LIST_METER_STATS, ALL(4),
+      OF_OBJECT, NA, FIELDS(meter_stats_fields) },
+    { OF_BSN_PORT_COUNTER_STATS_ENTRY, OF_LIST_BSN_PORT_COUNTER_STATS_ENTRY,
+      ALL(0), OF_OBJECT, 8, FIELDS(bsn_port_counter_fields) },
+    { OF_BSN_VLAN_COUNTER_STATS_ENTRY, OF_LIST_BSN_VLAN_COUNTER_STATS_ENTRY,
+      ALL(0), OF_OBJECT, 8, FIELDS(bsn_vlan_counter_fields) },
+    { OF_BSN_VRF_COUNTER_STATS_ENTRY, OF_LIST_BSN_VRF_COUNTER_STATS_ENTRY,
+      ALL(0), OF_OBJECT, 8, FIELDS(bsn_vrf_counter_fields) },
+};
+
+static const char *const value_names[LOCI_COLUMNS_VALUES_MAX] = {
+    "value0", "value1", "value2", "value3",
+    "value4", "value5", "value6", "value7",
+    "value8", "value9", "value10", "value11",
+    "value12", "value13", "value14", "value15",
+};
+
+static const loci_columns_class_t *
+class_find(of_object_id_t entry_id)
+{
+    int i;
+
+    for (i = 0; i < (int)(sizeof(classes) / sizeof(classes[0])); i++) {
+        if (classes[i].entry_id == entry_id) {
+            return &classes[i];
+        }
+    }
+
+    return NULL;
+}
+
+/****************************************************************
+ * Columns
+ ****************************************************************/
+
+/**
+ * Initialize columns for an entry class
+ * @param cols The columns
+ * @param entry_id The entry class, as OF_PORT_STATS_ENTRY
+ * @param capacity Rows to make room for; more are made as needed
+ * @returns OF_ERROR_NONE, OF_ERROR_PARAM if the class isn't supported
+ * or OF_ERROR_RESOURCE
+ */
+int
+loci_columns_init(loci_columns_t *cols, of_object_id_t entry_id,
+                  int capacity)
+{
+    const loci_columns_class_t *cls;
+    int i, n = 0;
+
+    MEMSET(cols, 0, sizeof(*cols));
+    if ((cls = class_find(entry_id)) == NULL || capacity < 0) {
+        return OF_ERROR_PARAM;
+    }
+    cols->entry_id = entry_id;
+    cols->cls = cls;
+    for (i = 0; i < cls->n_fields; i++, n++) {
+        cols->names[n] = cls->fields[i].name;
+        cols->kinds[n] = cls->fields[i].kind;
+        if (cols->kinds[n] == LOCI_COLUMN_KEY) {
+            cols->n_keys++;
+        }
+    }
+    if (cls->values_offset != NA) {
+        for (i = 0; i < LOCI_COLUMNS_VALUES_MAX; i++, n++) {
+            cols->names[n] = value_names[i];
+            cols->kinds[n] = LOCI_COLUMN_COUNTER;
+        }
+    }
+    cols->n_columns = n;
+
+    /* Always have somewhere to point the columns */
+    capacity = capacity > 0 ? capacity : 1;
+    for (i = 0; i < n; i++) {
+        if ((cols->columns[i] = MALLOC(capacity * sizeof(uint64_t))) ==
+            NULL) {
+            loci_columns_cleanup(cols);
+            return OF_ERROR_RESOURCE;
+        }
+    }
+    cols->rows = MALLOC(capacity * sizeof(uint32_t));
+    cols->props = MALLOC(capacity * sizeof(uint32_t));
+    if (cols->rows == NULL || cols->props == NULL) {
+        loci_columns_cleanup(cols);
+        return OF_ERROR_RESOURCE;
+    }
+    cols->capacity = capacity;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Free the columns
+ * @param cols The columns
+ */
+void
+loci_columns_cleanup(loci_columns_t *cols)
+{
+    int i;
+
+    for (i = 0; i < cols->n_columns; i++) {
+        FREE(cols->columns[i]);
+        cols->columns[i] = NULL;
+    }
+    FREE(cols->rows);
+    FREE(cols->props);
+    cols->rows = cols->props = NULL;
+    cols->count = cols->capacity = 0;
+}
+
+/**
+ * Look up a column
+ * @param cols The columns
+ * @param name Name of the column
+ * @returns Index of the column in cols->columns, or -1 if the class
+ * has no such column
+ */
+int
+loci_columns_index(const loci_columns_t *cols, const char *name)
+{
+    int i;
+
+    for (i = 0; i < cols->n_columns; i++) {
+        if (strcmp(cols->names[i], name) == 0) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* Make room for rows; the scratch arrays don't keep their contents */
+static int
+columns_reserve(loci_columns_t *cols, int rows)
+{
+    uint64_t *columns[LOCI_COLUMNS_MAX];
+    uint32_t *scratch_rows, *scratch_props;
+    int i, capacity;
+
+    if (rows <= cols->capacity) {
+        return OF_ERROR_NONE;
+    }
+    capacity = cols->capacity * 2 > rows ? cols->capacity * 2 : rows;
+
+    scratch_rows = MALLOC(capacity * sizeof(uint32_t));
+    scratch_props = MALLOC(capacity * sizeof(uint32_t));
+    for (i = 0; i < cols->n_columns; i++) {
+        if ((columns[i] = MALLOC(capacity * sizeof(uint64_t))) == NULL) {
+            break;
+        }
+    }
+    if (i < cols->n_columns || scratch_rows == NULL || scratch_props == NULL) {
+        while (--i >= 0) {
+            FREE(columns[i]);
+        }
+        FREE(scratch_rows);
+        FREE(scratch_props);
+        return OF_ERROR_RESOURCE;
+    }
+
+    for (i = 0; i < cols->n_columns; i++) {
+        MEMCPY(columns[i], cols->columns[i], cols->count * sizeof(uint64_t));
+        FREE(cols->columns[i]);
+        cols->columns[i] = columns[i];
+    }
+    FREE(cols->rows);
+    FREE(cols->props);
+    cols->rows = scratch_rows;
+    cols->props = scratch_props;
+    cols->capacity = capacity;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Set the number of rows, as before filling the columns in place
+ * @param cols The columns
+ * @param count Number of rows
+ * @returns OF_ERROR_NONE or OF_ERROR_RESOURCE
+ *
+ * Rows past the old count are zero.
+ */
+int
+loci_columns_resize(loci_columns_t *cols, int count)
+{
+    int i, rv;
+
+    if (count < 0) {
+        return OF_ERROR_PARAM;
+    }
+    if ((rv = columns_reserve(cols, count)) < 0) {
+        return rv;
+    }
+    for (i = 0; i < cols->n_columns && count > cols->count; i++) {
+        MEMSET(cols->columns[i] + cols->count, 0,
+               (count - cols->count) * sizeof(uint64_t));
+    }
+    cols->count = count;
+
+    return OF_ERROR_NONE;
+}
+
+/****************************************************************
+ * Extraction
+ ****************************************************************/
+
+/*
+ * Read one field of n entries into a column.  Entries are at rows[i]
+ * in base, or every stride bytes if rows is NULL.  The loops are kept
+ * apart by width and layout so each is a plain load, swap and store.
+ */
+#define COLUMN_READ(type, swap)                                         \
+    do {                                                                \
+        type v_;                                                        \
+        if (rows == NULL) {                                             \
+            for (i = 0; i < n; i++) {                                   \
+                MEMCPY(&v_, base + i * stride, sizeof(v_));             \
+                col[i] = swap(v_);                                      \
+            }                                                           \
+        } else {                                                        \
+            for (i = 0; i < n; i++) {                                   \
+                MEMCPY(&v_, base + rows[i], sizeof(v_));                \
+                col[i] = swap(v_);                                      \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+#define U8_NTOH(v) (v)
+
+static void
+column_read(uint64_t *col, const uint8_t *base, const uint32_t *rows,
+            int stride, int n, int width)
+{
+    int i;
+
+    switch (width) {
+    case 1:
+        COLUMN_READ(uint8_t, U8_NTOH);
+        break;
+    case 2:
+        COLUMN_READ(uint16_t, U16_NTOH);
+        break;
+    case 4:
+        COLUMN_READ(uint32_t, U32_NTOH);
+        break;
+    default:
+        COLUMN_READ(uint64_t, U64_NTOH);
+        break;
+    }
+}
+
+/* Read a field of the properties at props[i], or 0 where there's none */
+static void
+column_read_props(uint64_t *col, const uint8_t *base, const uint32_t *props,
+                  int n, int offset)
+{
+    uint64_t v;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        v = 0;
+        if (props[i] != 0) {
+            MEMCPY(&v, base + props[i] + offset, sizeof(v));
+            v = U64_NTOH(v);
+        }
+        col[i] = v;
+    }
+}
+
+/* Read the values of BSN counter entries; past the last value is 0 */
+static void
+column_read_values(uint64_t *col, const uint8_t *base, const uint32_t *rows,
+                   int n, int length_offset, int values_offset, int value)
+{
+    uint16_t len;
+    uint64_t v;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        MEMCPY(&len, base + rows[i] + length_offset, sizeof(len));
+        v = 0;
+        if (values_offset + (value + 1) * 8 <= U16_NTOH(len)) {
+            MEMCPY(&v, base + rows[i] + values_offset + value * 8, sizeof(v));
+            v = U64_NTOH(v);
+        }
+        col[i] = v;
+    }
+}
+
+/*
+ * Hash the match of each flow stats entry at rows[i] in list, by the
+ * generated getter
+ */
+static int
+column_read_match_hash(uint64_t *col, of_object_t *list,
+                       const uint32_t *rows, int n)
+{
+    of_flow_stats_entry_t entry;
+    of_match_t match;
+    int i, rv;
+
+    for (i = 0; i < n; i++) {
+        of_flow_stats_entry_init(&entry, list->version, -1, 1);
+        of_object_attach(list, &entry, rows[i], 0);
+        of_u16_len_wire_length_get(&entry, &entry.length);
+        if ((rv = of_flow_stats_entry_match_get(&entry, &match)) < 0) {
+            return rv;
+        }
+        col[i] = loci_match_hash(&match, 0);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/*
+ * Find the property of each variable length entry, recording its
+ * offset in props, or 0 if the entry has none.
+ */
+static int
+props_find(const loci_columns_class_t *cls, of_version_t version,
+           const uint8_t *base, const uint32_t *rows, uint32_t *props, int n)
+{
+    int fixed = of_object_fixed_len[version][cls->entry_id];
+    int prop_len = of_object_fixed_len[version][cls->prop_id];
+    int i, len, offset, end, type, plen;
+    uint16_t v;
+
+    for (i = 0; i < n; i++) {
+        MEMCPY(&v, base + rows[i] + cls->length_offset[version], sizeof(v));
+        len = U16_NTOH(v);
+        props[i] = 0;
+        end = rows[i] + len;
+        for (offset = rows[i] + fixed; offset < end; offset += plen) {
+            if (offset + 4 > end) {
+                return OF_ERROR_PARSE;
+            }
+            MEMCPY(&v, base + offset, sizeof(v));
+            type = U16_NTOH(v);
+            MEMCPY(&v, base + offset + 2, sizeof(v));
+            plen = U16_NTOH(v);
+            if (plen < 4 || offset + plen > end) {
+                return OF_ERROR_PARSE;
+            }
+            if (type == PORT_STATS_PROP_ETHERNET && props[i] == 0) {
+                if (plen < prop_len) {
+                    return OF_ERROR_PARSE;
+                }
+                props[i] = offset;
+            }
+        }
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/*
+ * Count the entries of a variable length list, checking each is
+ * whole; with rows, also record where each starts.
+ */
+static int
+rows_scan(const uint8_t *base, int length, int length_offset, int fixed,
+          uint32_t *rows)
+{
+    uint16_t v;
+    int offset, len, n = 0;
+
+    for (offset = 0; offset < length; offset += len) {
+        if (offset + fixed > length) {
+            return OF_ERROR_PARSE;
+        }
+        MEMCPY(&v, base + offset + length_offset, sizeof(v));
+        len = U16_NTOH(v);
+        if (len < fixed || offset + len > length) {
+            return OF_ERROR_PARSE;
+        }
+        if (rows != NULL) {
+            rows[n] = offset;
+        }
+        n++;
+    }
+
+    return n;
+}
+
+/**
+ * Append the entries of a stats list to columns
+ * @param cols Columns for the class of the entries
+ * @param list The list, as bound from a reply
+ * @returns Number of rows appended; OF_ERROR_PARAM if the list isn't
+ * of the class, OF_ERROR_VERSION if the version has no such list,
+ * OF_ERROR_PARSE if the entries are malformed or OF_ERROR_RESOURCE
+ *
+ * Nothing is appended on an error.
+ */
+int
+loci_columns_extract(loci_columns_t *cols, of_object_t *list)
+{
+    const loci_columns_class_t *cls = cols->cls;
+    const field_t *field;
+    of_version_t version = list->version;
+    const uint8_t *base;
+    const uint32_t *rows = NULL;
+    uint64_t *col;
+    int i, j, n, rv, fixed, stride = 0, offset, length_offset;
+
+    if (cls == NULL || list->object_id != cls->list_id) {
+        return OF_ERROR_PARAM;
+    }
+    if (!OF_VERSION_OKAY(version) ||
+        (fixed = of_object_fixed_len[version][cls->entry_id]) <= 0) {
+        return OF_ERROR_VERSION;
+    }
+    base = OF_OBJECT_BUFFER_INDEX(list, 0);
+    length_offset = cls->length_offset[version];
+
+    if (length_offset == NA) {
+        if (list->length % fixed != 0) {
+            return OF_ERROR_PARSE;
+        }
+        n = list->length / fixed;
+        stride = fixed;
+    } else {
+        if ((n = rows_scan(base, list->length, length_offset, fixed,
+                           NULL)) < 0) {
+            return n;
+        }
+    }
+    if ((rv = columns_reserve(cols, cols->count + n)) < 0) {
+        return rv;
+    }
+    if (length_offset != NA) {
+        rows_scan(base, list->length, length_offset, fixed, cols->rows);
+        rows = cols->rows;
+        if (cls->prop_id != OF_OBJECT &&
+            (rv = props_find(cls, version, base, rows, cols->props, n)) < 0) {
+            return rv;
+        }
+    }
+
+    for (i = 0; i < cls->n_fields; i++) {
+        field = &cls->fields[i];
+        col = cols->columns[i] + cols->count;
+        offset = field->offset[version];
+        if (field->source == FIELD_MATCH_HASH) {
+            if ((rv = column_read_match_hash(col, list, rows, n)) < 0) {
+                return rv;
+            }
+        } else if (offset == NA) {
+            MEMSET(col, 0, n * sizeof(uint64_t));
+        } else if (offset & PROP_FLAG) {
+            column_read_props(col, base, cols->props, n, offset & ~PROP_FLAG);
+        } else if (field->width == PORT_NO_WIDTH) {
+            column_read(col, base + offset, rows, stride, n,
+                        version == OF_VERSION_1_0 ? 2 : 4);
+            if (version == OF_VERSION_1_0) {
+                for (j = 0; j < n; j++) {
+                    OF_PORT_NO_VALUE_CHECK(col[j], version);
+                }
+            }
+        } else {
+            column_read(col, base + offset, rows, stride, n, field->width);
+        }
+    }
+    if (cls->values_offset != NA) {
+        for (i = 0; i < LOCI_COLUMNS_VALUES_MAX; i++) {
+            column_read_values(cols->columns[cls->n_fields + i] + cols->count,
+                               base, rows, n, length_offset,
+                               cls->values_offset, i);
+        }
+    }
+    cols->count += n;
+
+    return n;
+}
+
+/****************************************************************
+ * Filling replies
+ ****************************************************************/
+
+/*
+ * Write one column into n entries every stride bytes, the reverse of
+ * COLUMN_READ; values are cut to the width of the field.
+ */
+#define COLUMN_WRITE(type, swap)                                        \
+    do {                                                                \
+        type v_;                                                        \
+        for (i = 0; i < n; i++) {                                       \
+            v_ = swap((type)col[i]);                                    \
+            MEMCPY(base + i * stride, &v_, sizeof(v_));                 \
+        }                                                               \
+    } while (0)
+
+#define U8_HTON(v) (v)
+
+static void
+column_write(const uint64_t *col, uint8_t *base, int stride, int n,
+             int width)
+{
+    int i;
+
+    switch (width) {
+    case 1:
+        COLUMN_WRITE(uint8_t, U8_HTON);
+        break;
+    case 2:
+        COLUMN_WRITE(uint16_t, U16_HTON);
+        break;
+    case 4:
+        COLUMN_WRITE(uint32_t, U32_HTON);
+        break;
+    default:
+        COLUMN_WRITE(uint64_t, U64_HTON);
+        break;
+    }
+}
+
+/* Write a 16 bit value at the same offset of n entries */
+static void
+entries_u16_set(uint8_t *base, int stride, int n, uint16_t value)
+{
+    int i;
+
+    value = U16_HTON(value);
+    for (i = 0; i < n; i++) {
+        MEMCPY(base + i * stride, &value, sizeof(value));
+    }
+}
+
+/* Bind the entries of a reply the columns can fill */
+static int
+reply_entries_bind(of_object_t *reply, of_object_t *list)
+{
+    switch (reply->object_id) {
+    case OF_PORT_STATS_REPLY:
+        of_port_stats_reply_entries_bind(reply, list);
+        break;
+    case OF_QUEUE_STATS_REPLY:
+        of_queue_stats_reply_entries_bind(reply, list);
+        break;
+    case OF_TABLE_STATS_REPLY:
+        of_table_stats_reply_entries_bind(reply, list);
+        break;
+    default:
+        return OF_ERROR_PARAM;
+    }
+
+    return OF_ERROR_NONE;
+}
+
+static void
+reply_flags_set(of_object_t *reply, uint16_t flags)
+{
+    switch (reply->object_id) {
+    case OF_PORT_STATS_REPLY:
+        of_port_stats_reply_flags_set(reply, flags);
+        break;
+    case OF_QUEUE_STATS_REPLY:
+        of_queue_stats_reply_flags_set(reply, flags);
+        break;
+    case OF_TABLE_STATS_REPLY:
+        of_table_stats_reply_flags_set(reply, flags);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Fill a port, queue or table stats reply from columns
+ * @param reply A new reply for the class of the columns
+ * @param cols The columns
+ * @param next Index of the first row for the reply; moved past the rows
+ * filled
+ * @returns Number of rows in the reply; OF_ERROR_PARAM if the reply
+ * isn't for the class, OF_ERROR_VERSION if the version has no such
+ * entries or OF_ERROR_RESOURCE if none fit
+ *
+ * The entries are written in the layout of the reply's version.  Fields
+ * without a column, as the name of a table, are zero.  1.4 port stats
+ * entries get an ethernet property with the error counters.
+ * OF_STATS_REPLY_FLAG_REPLY_MORE is set unless the reply has the last
+ * row.
+ */
+int
+loci_columns_fill(of_object_t *reply, const loci_columns_t *cols, int *next)
+{
+    const loci_columns_class_t *cls = cols->cls;
+    const field_t *field;
+    of_version_t version = reply->version;
+    of_object_t list;
+    uint16_t flags = 0;
+    uint8_t *data;
+    int i, n, fixed, bytes, offset, width, length_offset, room;
+
+    if (cls == NULL || reply_entries_bind(reply, &list) < 0 ||
+        list.object_id != cls->list_id) {
+        return OF_ERROR_PARAM;
+    }
+    if (!OF_VERSION_OKAY(version) ||
+        (fixed = of_object_fixed_len[version][cls->entry_id]) <= 0) {
+        return OF_ERROR_VERSION;
+    }
+    length_offset = cls->length_offset[version];
+    bytes = fixed;
+    if (length_offset != NA && cls->prop_id != OF_OBJECT) {
+        bytes += of_object_fixed_len[version][cls->prop_id];
+    }
+
+    n = *next < cols->count ? cols->count - *next : 0;
+    room = (WBUF_ALLOC_BYTES(list.wbuf) -
+            OF_OBJECT_ABSOLUTE_OFFSET(&list, list.length)) / bytes;
+    if (n > 0 && room <= 0) {
+        return OF_ERROR_RESOURCE;
+    }
+    if (n > room) {
+        n = room;
+    }
+    if ((data = loci_list_extend(&list, n * bytes)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(data, 0, n * bytes);
+
+    if (length_offset != NA) {
+        entries_u16_set(data + length_offset, bytes, n, bytes);
+    }
+    if (bytes > fixed) {
+        /* The type of the property stays 0, ethernet */
+        entries_u16_set(data + fixed + 2, bytes, n, bytes - fixed);
+    }
+    for (i = 0; i < cls->n_fields; i++) {
+        field = &cls->fields[i];
+        if ((offset = field->offset[version]) == NA) {
+            continue;
+        }
+        width = field->width;
+        if (width == PORT_NO_WIDTH) {
+            width = version == OF_VERSION_1_0 ? 2 : 4;
+        }
+        if (offset & PROP_FLAG) {
+            offset = fixed + (offset & ~PROP_FLAG);
+        }
+        column_write(cols->columns[i] + *next, data + offset, bytes, n,
+                     width);
+    }
+    *next += n;
+
+    if (*next < cols->count) {
+        OF_STATS_REPLY_FLAG_REPLY_MORE_SET(flags, version);
+    }
+    reply_flags_set(reply, flags);
+
+    return n;
+}
+
+/****************************************************************
+ * Deltas
+ ****************************************************************/
+
+#define NO_ROW 0xffffffff
+
+static int
+row_keys_equal(const loci_columns_t *a, int row_a,
+               const loci_columns_t *b, int row_b)
+{
+    int i;
+
+    for (i = 0; i < a->n_keys; i++) {
+        if (a->columns[i][row_a] != b->columns[i][row_b]) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static uint64_t
+row_key_hash(const loci_columns_t *cols, int row)
+{
+    uint64_t hash = loci_hash_start(0);
+    int i;
+
+    for (i = 0; i < cols->n_keys; i++) {
+        hash = loci_hash_word(hash, cols->columns[i][row]);
+    }
+
+    return loci_hash_finish(hash);
+}
+
+/*
+ * Match each row of cur to the row of prev with the same keys, into
+ * match; NO_ROW where there's none.  Rows in the same order, as from
+ * a switch that hasn't changed its ports, match without hashing, and
+ * 1 is returned for them.
+ */
+static int
+rows_match(const loci_columns_t *cur, const loci_columns_t *prev,
+           uint32_t *match)
+{
+    int32_t *slots;
+    uint32_t size, mask, s;
+    int i;
+
+    for (i = 0; i < cur->count && i < prev->count; i++) {
+        if (!row_keys_equal(cur, i, prev, i)) {
+            break;
+        }
+        match[i] = i;
+    }
+    if (i == cur->count) {
+        return 1;
+    }
+
+    for (size = 16; size < (uint32_t)prev->count * 2; size <<= 1);
+    mask = size - 1;
+    if ((slots = MALLOC(size * sizeof(*slots))) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(slots, 0xff, size * sizeof(*slots));
+    for (i = 0; i < prev->count; i++) {
+        for (s = row_key_hash(prev, i) & mask; slots[s] >= 0;
+             s = (s + 1) & mask);
+        slots[s] = i;
+    }
+    for (i = 0; i < cur->count; i++) {
+        match[i] = NO_ROW;
+        for (s = row_key_hash(cur, i) & mask; slots[s] >= 0;
+             s = (s + 1) & mask) {
+            if (row_keys_equal(cur, i, prev, slots[s])) {
+                match[i] = slots[s];
+                break;
+            }
+        }
+    }
+    FREE(slots);
+
+    return 0;
+}
+
+/**
+ * The change in each row since the previous poll
+ * @param cur Columns of this poll
+ * @param prev Columns of the previous poll, of the same class
+ * @param delta Columns for the delta, of the same class; its rows are
+ * replaced with one for each row of cur
+ * @returns OF_ERROR_NONE, OF_ERROR_PARAM if the classes differ or
+ * OF_ERROR_RESOURCE
+ */
+int
+loci_columns_delta(const loci_columns_t *cur, const loci_columns_t *prev,
+                   loci_columns_t *delta)
+{
+    const uint64_t *c, *p;
+    const uint32_t *match;
+    uint64_t *d;
+    int i, j, rv, in_order;
+
+    if (cur->cls == NULL || prev->cls != cur->cls || delta->cls != cur->cls ||
+        delta == cur || delta == prev) {
+        return OF_ERROR_PARAM;
+    }
+    delta->count = 0;
+    if ((rv = columns_reserve(delta, cur->count)) < 0) {
+        return rv;
+    }
+    if ((in_order = rows_match(cur, prev, delta->rows)) < 0) {
+        return in_order;
+    }
+    match = delta->rows;
+
+    for (j = 0; j < cur->n_columns; j++) {
+        c = cur->columns[j];
+        p = prev->columns[j];
+        d = delta->columns[j];
+        if (cur->kinds[j] != LOCI_COLUMN_COUNTER) {
+            MEMCPY(d, c, cur->count * sizeof(uint64_t));
+            continue;
+        }
+        if (in_order) {
+            for (i = 0; i < cur->count; i++) {
+                d[i] = c[i] >= p[i] ? c[i] - p[i] : c[i];
+            }
+            continue;
+        }
+        for (i = 0; i < cur->count; i++) {
+            if (match[i] == NO_ROW || c[i] < p[match[i]]) {
+                d[i] = c[i];
+            } else {
+                d[i] = c[i] - p[match[i]];
+            }
+        }
+    }
+    delta->count = cur->count;
+
+    return OF_ERROR_NONE;
+}
@@ -0,0 +1,233 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_debug_counter.c
+ *
+ * Bulk fill and decode of BSN debug counter stats replies.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_debug_counter.h>
+#include "loci_int.h"
+
+/* Offsets in a desc entry */
+#define DESC_NAME_OFFSET 8
+#define DESC_DESCRIPTION_OFFSET 72
+
+/*
+ * Copy n 64 bit words between host and network order.  The loop is
+ * simple enough for the compiler to vectorize.
+ */
+static void
+words_swap(uint8_t *dst, const uint8_t *src, int n)
+{
+    uint64_t word;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        MEMCPY(&word, src + i * 8, sizeof(word));
+        word = U64_HTON(word);
+        MEMCPY(dst + i * 8, &word, sizeof(word));
+    }
+}
+
+/*
+ * Entries of the next reply: as many of count - *next as fit, or
+ * OF_ERROR_RESOURCE if none do.
+ */
+static int
+entries_fit(of_object_t *list, int entry_bytes, int count, int next)
+{
+    int room = (WBUF_ALLOC_BYTES(list->wbuf) -
+                OF_OBJECT_ABSOLUTE_OFFSET(list, list->length)) / entry_bytes;
+
+    if (next >= count) {
+        return 0;
+    }
+    if (room <= 0) {
+        return OF_ERROR_RESOURCE;
+    }
+
+    return count - next < room ? count - next : room;
+}
+
+/**
+ * Fill a debug counter stats reply from an array of counters
+ * @param reply A new reply
+ * @param counters The counters
+ * @param count Number of counters
+ * @param next Index of the first counter for the reply; moved past the
+ * counters filled
+ * @returns Number of counters in the reply, or OF_ERROR_RESOURCE if
+ * none fit
+ *
+ * OF_STATS_REPLY_FLAG_REPLY_MORE is set unless the reply has the last
+ * counter.
+ */
+int
+loci_debug_counter_stats_fill(of_bsn_debug_counter_stats_reply_t *reply,
+                              const loci_debug_counter_t *counters,
+                              int count, int *next)
+{
+    of_list_bsn_debug_counter_stats_entry_t list;
+    uint16_t flags = 0;
+    uint8_t *data;
+    int n;
+
+    of_bsn_debug_counter_stats_reply_entries_bind(reply, &list);
+    if ((n = entries_fit(&list, LOCI_DEBUG_COUNTER_ENTRY_BYTES, count,
+                         *next)) < 0) {
+        return n;
+    }
+    if ((data = loci_list_extend(&list, n * LOCI_DEBUG_COUNTER_ENTRY_BYTES)) ==
+        NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    words_swap(data, (const uint8_t *)(counters + *next), n * 2);
+    *next += n;
+
+    if (*next < count) {
+        OF_STATS_REPLY_FLAG_REPLY_MORE_SET(flags, reply->version);
+    }
+    of_bsn_debug_counter_stats_reply_flags_set(reply, flags);
+
+    return n;
+}
+
+/**
+ * Fill a debug counter desc stats reply from an array of descriptions
+ * @param reply A new reply
+ * @param descs The descriptions
+ * @param count Number of descriptions
+ * @param next Index of the first description for the reply; moved past
+ * the descriptions filled
+ * @returns As loci_debug_counter_stats_fill
+ */
+int
+loci_debug_counter_desc_stats_fill(
+    of_bsn_debug_counter_desc_stats_reply_t *reply,
+    const loci_debug_counter_desc_t *descs, int count, int *next)
+{
+    of_list_bsn_debug_counter_desc_stats_entry_t list;
+    const loci_debug_counter_desc_t *desc;
+    uint16_t flags = 0;
+    uint8_t *data;
+    int i, n;
+
+    of_bsn_debug_counter_desc_stats_reply_entries_bind(reply, &list);
+    if ((n = entries_fit(&list, LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES, count,
+                         *next)) < 0) {
+        return n;
+    }
+    if ((data = loci_list_extend(
+             &list, n * LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    for (i = 0; i < n; i++) {
+        desc = &descs[*next + i];
+        words_swap(data, (const uint8_t *)&desc->id, 1);
+        MEMCPY(data + DESC_NAME_OFFSET, desc->name, sizeof(desc->name));
+        MEMCPY(data + DESC_DESCRIPTION_OFFSET, desc->description,
+               sizeof(desc->description));
+        data += LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES;
+    }
+    *next += n;
+
+    if (*next < count) {
+        OF_STATS_REPLY_FLAG_REPLY_MORE_SET(flags, reply->version);
+    }
+    of_bsn_debug_counter_desc_stats_reply_flags_set(reply, flags);
+
+    return n;
+}
+
+/**
+ * Number of counters in a debug counter stats reply
+ * @param reply The reply
+ * @returns The number, or OF_ERROR_PARSE if the entries don't divide
+ * into counters
+ */
+int
+loci_debug_counter_stats_count(of_bsn_debug_counter_stats_reply_t *reply)
+{
+    of_list_bsn_debug_counter_stats_entry_t list;
+
+    of_bsn_debug_counter_stats_reply_entries_bind(reply, &list);
+    if (list.length % LOCI_DEBUG_COUNTER_ENTRY_BYTES != 0) {
+        return OF_ERROR_PARSE;
+    }
+
+    return list.length / LOCI_DEBUG_COUNTER_ENTRY_BYTES;
+}
+
+/**
+ * Read the counters of a debug counter stats reply into an array
+ * @param reply The reply
+ * @param counters Where to put the counters
+ * @param max Most counters to read
+ * @returns Number of counters read; OF_ERROR_RESOURCE if there are
+ * more than max, or OF_ERROR_PARSE if the entries don't divide into
+ * counters
+ */
+int
+loci_debug_counter_stats_decode(of_bsn_debug_counter_stats_reply_t *reply,
+                                loci_debug_counter_t *counters, int max)
+{
+    of_list_bsn_debug_counter_stats_entry_t list;
+    int n;
+
+    of_bsn_debug_counter_stats_reply_entries_bind(reply, &list);
+    if (list.length % LOCI_DEBUG_COUNTER_ENTRY_BYTES != 0) {
+        return OF_ERROR_PARSE;
+    }
+    if ((n = list.length / LOCI_DEBUG_COUNTER_ENTRY_BYTES) > max) {
+        return OF_ERROR_RESOURCE;
+    }
+    words_swap((uint8_t *)counters, OF_OBJECT_BUFFER_INDEX(&list, 0), n * 2);
+
+    return n;
+}
+
+/**
+ * Read the descriptions of a debug counter desc stats reply into an
+ * array
+ * @param reply The reply
+ * @param descs Where to put the descriptions
+ * @param max Most descriptions to read
+ * @returns As loci_debug_counter_stats_decode
+ *
+ * Names and descriptions are copied as they are on the wire: one that
+ * fills its field has no terminating NUL.
+ */
+int
+loci_debug_counter_desc_stats_decode(
+    of_bsn_debug_counter_desc_stats_reply_t *reply,
+    loci_debug_counter_desc_t *descs, int max)
+{
+    of_list_bsn_debug_counter_desc_stats_entry_t list;
+    const uint8_t *data;
+    int i, n;
+
+    of_bsn_debug_counter_desc_stats_reply_entries_bind(reply, &list);
+    if (list.length % LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES != 0) {
+        return OF_ERROR_PARSE;
+    }
+    if ((n = list.length / LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES) > max) {
+        return OF_ERROR_RESOURCE;
+    }
+    data = OF_OBJECT_BUFFER_INDEX(&list, 0);
+    for (i = 0; i < n; i++) {
+        words_swap((uint8_t *)&descs[i].id, data, 1);
+        MEMCPY(descs[i].name, data + DESC_NAME_OFFSET, sizeof(descs[i].name));
+        MEMCPY(descs[i].description, data + DESC_DESCRIPTION_OFFSET,
+               sizeof(descs[i].description));
+        data += LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES;
+    }
+
+    return n;
+}
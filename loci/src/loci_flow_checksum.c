@@ -0,0 +1,964 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_flow_checksum.c
+ *
+ * BSN flow and table checksums maintained from flow_mods.
+ *
+ ****************************************************************/
+
+#include <stddef.h>
+#include <loci/loci.h>
+#include <loci/loci_flow_checksum.h>
+#include <loci/loci_hash.h>
+
+#define MATCH_WORDS (sizeof(of_match_fields_t) / sizeof(uint64_t))
+
+/* The word of the tsmap pointer of an ODU signal id, which doesn't count */
+#define TSMAP_WORD ((offsetof(of_match_fields_t, exp_odu_sigid) +       \
+                     offsetof(of_odu_sig_id_t, tsmap)) / sizeof(uint64_t))
+
+/* OFPTT_ALL */
+#define TABLE_ALL 0xff
+
+/* Outputs a flow_mod may have without allocating */
+#define OUTPUTS_LOCAL 16
+
+/* What the flow_mods have in common */
+typedef struct flow_mod_s {
+    of_match_t match;
+    uint64_t cookie;
+    uint64_t cookie_mask;
+    of_port_no_t out_port;
+    uint32_t out_group;
+    uint16_t priority;
+    uint16_t flags;
+    uint8_t table_id;
+    of_object_t actions;        /* The action list in 1.0, else instructions */
+} flow_mod_t;
+
+/* The output ports and groups of a flow's actions */
+typedef struct outputs_s {
+    uint32_t *ids;              /* n_ports ports, then n_groups groups */
+    int n_ports;
+    int n_groups;
+    uint32_t local[OUTPUTS_LOCAL];
+} outputs_t;
+
+/* A match as its canonical words */
+typedef struct match_words_s {
+    loci_flow_checksum_word_t words[MATCH_WORDS];
+    int n_words;
+} match_words_t;
+
+static void
+match_words(const of_match_t *match, match_words_t *mw)
+{
+    of_match_t canon;
+    uint64_t value, mask;
+    int i;
+
+    loci_match_canonical(match, &canon);
+    mw->n_words = 0;
+    for (i = 0; i < (int)MATCH_WORDS; i++) {
+        if (i == (int)TSMAP_WORD) {
+            continue;
+        }
+        MEMCPY(&mask, (uint8_t *)&canon.masks + i * 8, sizeof(mask));
+        if (mask != 0) {
+            MEMCPY(&value, (uint8_t *)&canon.fields + i * 8, sizeof(value));
+            mw->words[mw->n_words].value = value;
+            mw->words[mw->n_words].mask = mask;
+            mw->words[mw->n_words].index = i;
+            mw->n_words++;
+        }
+    }
+}
+
+static uint64_t
+flow_hash(uint8_t table_id, uint16_t priority, const match_words_t *mw)
+{
+    uint64_t hash;
+    int i;
+
+    hash = loci_hash_start(0);
+    hash = loci_hash_word(hash, ((uint64_t)table_id << 16) | priority);
+    for (i = 0; i < mw->n_words; i++) {
+        hash = loci_hash_word(hash, mw->words[i].index);
+        hash = loci_hash_word(hash, mw->words[i].value);
+        hash = loci_hash_word(hash, mw->words[i].mask);
+    }
+
+    return loci_hash_finish(hash);
+}
+
+static int
+flow_equal(const loci_flow_checksum_flow_t *flow, uint8_t table_id,
+           uint16_t priority, const match_words_t *mw)
+{
+    int i;
+
+    if (flow->table_id != table_id || flow->priority != priority ||
+        flow->n_words != mw->n_words) {
+        return 0;
+    }
+    for (i = 0; i < mw->n_words; i++) {
+        if (flow->words[i].index != mw->words[i].index ||
+            flow->words[i].value != mw->words[i].value ||
+            flow->words[i].mask != mw->words[i].mask) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Whether a flow's match is more specific than a query's, as
+ * of_match_more_specific: every bit of the query's masks is in the
+ * flow's, with the same value.  Both go by word index.
+ */
+static int
+flow_more_specific(const loci_flow_checksum_flow_t *flow,
+                   const match_words_t *query)
+{
+    const loci_flow_checksum_word_t *f = flow->words;
+    const loci_flow_checksum_word_t *f_end = flow->words + flow->n_words;
+    const loci_flow_checksum_word_t *q;
+    int i;
+
+    for (i = 0; i < query->n_words; i++) {
+        q = &query->words[i];
+        while (f < f_end && f->index < q->index) {
+            f++;
+        }
+        if (f == f_end || f->index != q->index ||
+            (f->mask & q->mask) != q->mask ||
+            ((f->value ^ q->value) & q->mask) != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Whether a packet could match both a flow and a query */
+static int
+flow_overlaps(const loci_flow_checksum_flow_t *flow,
+              const match_words_t *query)
+{
+    const loci_flow_checksum_word_t *f = flow->words;
+    const loci_flow_checksum_word_t *f_end = flow->words + flow->n_words;
+    const loci_flow_checksum_word_t *q;
+    int i;
+
+    for (i = 0; i < query->n_words; i++) {
+        q = &query->words[i];
+        while (f < f_end && f->index < q->index) {
+            f++;
+        }
+        if (f < f_end && f->index == q->index &&
+            ((f->value ^ q->value) & f->mask & q->mask) != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/****************************************************************
+ * Outputs
+ ****************************************************************/
+
+/*
+ * Count the outputs of an action list in *p and *g; with out->ids set,
+ * also store them
+ */
+static void
+action_list_outputs(of_list_action_t *actions, outputs_t *out, int *p,
+                    int *g)
+{
+    of_object_t action;
+    uint32_t id;
+    int rv;
+
+    OF_LIST_ACTION_ITER(actions, &action, rv) {
+        if (action.object_id == OF_ACTION_OUTPUT) {
+            if (out->ids != NULL) {
+                of_action_output_port_get(&action, &id);
+                out->ids[*p] = id;
+            }
+            (*p)++;
+        } else if (action.object_id == OF_ACTION_GROUP) {
+            if (out->ids != NULL) {
+                of_action_group_group_id_get(&action, &id);
+                out->ids[out->n_ports + *g] = id;
+            }
+            (*g)++;
+        }
+    }
+}
+
+static void
+actions_outputs(of_object_t *actions, outputs_t *out, int *p, int *g)
+{
+    of_object_t ins;
+    of_list_action_t list;
+    int rv;
+
+    *p = *g = 0;
+    if (actions->object_id == OF_LIST_ACTION) {
+        action_list_outputs(actions, out, p, g);
+        return;
+    }
+    OF_LIST_INSTRUCTION_ITER(actions, &ins, rv) {
+        if (ins.object_id == OF_INSTRUCTION_APPLY_ACTIONS) {
+            of_instruction_apply_actions_actions_bind(&ins, &list);
+            action_list_outputs(&list, out, p, g);
+        } else if (ins.object_id == OF_INSTRUCTION_WRITE_ACTIONS) {
+            of_instruction_write_actions_actions_bind(&ins, &list);
+            action_list_outputs(&list, out, p, g);
+        }
+    }
+}
+
+/*
+ * The outputs of a flow's action list in 1.0 or instructions after, or
+ * none if actions is NULL.  Free them with outputs_free.
+ */
+static int
+outputs_get(of_object_t *actions, outputs_t *out)
+{
+    int n, p, g;
+
+    out->ids = NULL;
+    out->n_ports = out->n_groups = 0;
+    if (actions == NULL) {
+        return OF_ERROR_NONE;
+    }
+    actions_outputs(actions, out, &out->n_ports, &out->n_groups);
+    if ((n = out->n_ports + out->n_groups) == 0) {
+        return OF_ERROR_NONE;
+    }
+    if (n <= OUTPUTS_LOCAL) {
+        out->ids = out->local;
+    } else if ((out->ids = MALLOC(n * sizeof(uint32_t))) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    actions_outputs(actions, out, &p, &g);
+
+    return OF_ERROR_NONE;
+}
+
+static void
+outputs_free(outputs_t *out)
+{
+    if (out->ids != out->local) {
+        FREE(out->ids);
+    }
+}
+
+static inline uint32_t *
+flow_outputs(const loci_flow_checksum_flow_t *flow)
+{
+    return (uint32_t *)(flow->words + flow->n_words);
+}
+
+static inline size_t
+flow_size(int n_words, int n_outputs)
+{
+    return sizeof(loci_flow_checksum_flow_t) +
+        n_words * sizeof(loci_flow_checksum_word_t) +
+        n_outputs * sizeof(uint32_t);
+}
+
+static int
+ids_find(const uint32_t *ids, int n, uint32_t id)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (ids[i] == id) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Whether a flow outputs to a delete's out_port and out_group */
+static int
+flow_outputs_selected(const loci_flow_checksum_flow_t *flow,
+                      const flow_mod_t *fm)
+{
+    const uint32_t *ports = flow_outputs(flow);
+
+    /* The accessors widen 1.0's OFPP_NONE */
+    if (fm->out_port != OF_PORT_DEST_NONE &&
+        !ids_find(ports, flow->n_ports, fm->out_port)) {
+        return 0;
+    }
+    if (fm->out_group != OF_GROUP_ANY &&
+        !ids_find(ports + flow->n_ports, flow->n_groups, fm->out_group)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/****************************************************************
+ * Tables and the flow index
+ ****************************************************************/
+
+static int
+buckets_bits(uint32_t buckets_size)
+{
+    int bits = 0;
+
+    if (buckets_size == 0 || buckets_size > LOCI_FLOW_CHECKSUM_BUCKETS_MAX ||
+        (buckets_size & (buckets_size - 1)) != 0) {
+        return OF_ERROR_PARAM;
+    }
+    while ((1U << bits) < buckets_size) {
+        bits++;
+    }
+
+    return bits;
+}
+
+static void
+flow_link(loci_flow_checksum_t *fc, loci_flow_checksum_flow_t *flow)
+{
+    loci_flow_checksum_table_t *table = &fc->tables[flow->table_id];
+    loci_flow_checksum_flow_t **slot;
+
+    slot = &fc->slots[flow->hash & (fc->n_slots - 1)];
+    flow->next = *slot;
+    *slot = flow;
+
+    flow->table_prev = NULL;
+    flow->table_next = table->flows;
+    if (table->flows != NULL) {
+        table->flows->table_prev = flow;
+    }
+    table->flows = flow;
+    table->count++;
+    table->checksum ^= flow->cookie;
+    table->buckets[loci_flow_checksum_bucket(table, flow->cookie)] ^=
+        flow->cookie;
+    fc->count++;
+}
+
+static void
+flow_unlink(loci_flow_checksum_t *fc, loci_flow_checksum_flow_t *flow)
+{
+    loci_flow_checksum_table_t *table = &fc->tables[flow->table_id];
+    loci_flow_checksum_flow_t **prev;
+
+    for (prev = &fc->slots[flow->hash & (fc->n_slots - 1)]; *prev != flow;
+         prev = &(*prev)->next) {
+        LOCI_ASSERT(*prev != NULL);
+    }
+    *prev = flow->next;
+
+    if (flow->table_prev != NULL) {
+        flow->table_prev->table_next = flow->table_next;
+    } else {
+        table->flows = flow->table_next;
+    }
+    if (flow->table_next != NULL) {
+        flow->table_next->table_prev = flow->table_prev;
+    }
+    table->count--;
+    table->checksum ^= flow->cookie;
+    table->buckets[loci_flow_checksum_bucket(table, flow->cookie)] ^=
+        flow->cookie;
+    fc->count--;
+}
+
+static void
+flow_free(loci_flow_checksum_t *fc, loci_flow_checksum_flow_t *flow)
+{
+    flow_unlink(fc, flow);
+    FREE(flow);
+}
+
+static loci_flow_checksum_flow_t *
+flow_find(loci_flow_checksum_t *fc, uint8_t table_id, uint16_t priority,
+          const match_words_t *mw, uint64_t hash)
+{
+    loci_flow_checksum_flow_t *flow;
+
+    for (flow = fc->slots[hash & (fc->n_slots - 1)]; flow != NULL;
+         flow = flow->next) {
+        if (flow->hash == hash && flow_equal(flow, table_id, priority, mw)) {
+            return flow;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Give a flow a new cookie and outputs, moving it if they take more or
+ * less room.  On failure the flow is as it was.
+ */
+static int
+flow_update(loci_flow_checksum_t *fc, loci_flow_checksum_flow_t *flow,
+            uint64_t cookie, const outputs_t *out)
+{
+    loci_flow_checksum_flow_t *moved;
+    int n = out->n_ports + out->n_groups;
+
+    if (n != flow->n_ports + flow->n_groups) {
+        if ((moved = MALLOC(flow_size(flow->n_words, n))) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        MEMCPY(moved, flow, flow_size(flow->n_words, 0));
+        flow_unlink(fc, flow);
+        FREE(flow);
+        flow = moved;
+    } else {
+        flow_unlink(fc, flow);
+    }
+    flow->cookie = cookie;
+    flow->n_ports = out->n_ports;
+    flow->n_groups = out->n_groups;
+    MEMCPY(flow_outputs(flow), out->ids, n * sizeof(uint32_t));
+    flow_link(fc, flow);
+
+    return OF_ERROR_NONE;
+}
+
+/* Double the slots; on failure the chains just get longer */
+static void
+slots_grow(loci_flow_checksum_t *fc)
+{
+    loci_flow_checksum_flow_t **slots, *flow, *next;
+    uint32_t n_slots = fc->n_slots * 2;
+    uint32_t i;
+
+    if ((slots = MALLOC(n_slots * sizeof(*slots))) == NULL) {
+        return;
+    }
+    MEMSET(slots, 0, n_slots * sizeof(*slots));
+    for (i = 0; i < fc->n_slots; i++) {
+        for (flow = fc->slots[i]; flow != NULL; flow = next) {
+            next = flow->next;
+            flow->next = slots[flow->hash & (n_slots - 1)];
+            slots[flow->hash & (n_slots - 1)] = flow;
+        }
+    }
+    FREE(fc->slots);
+    fc->slots = slots;
+    fc->n_slots = n_slots;
+}
+
+/**
+ * Initialize flow checksums with no flows
+ * @param fc The flow checksums
+ * @param n_tables Number of tables, 1 to 255
+ * @param buckets_size Number of checksum buckets of each table, a
+ * power of 2
+ * @returns 0, OF_ERROR_PARAM or OF_ERROR_RESOURCE
+ */
+int
+loci_flow_checksum_init(loci_flow_checksum_t *fc, int n_tables,
+                        uint32_t buckets_size)
+{
+    int bits, i;
+
+    MEMSET(fc, 0, sizeof(*fc));
+    if (n_tables < 1 || n_tables >= TABLE_ALL ||
+        (bits = buckets_bits(buckets_size)) < 0) {
+        return OF_ERROR_PARAM;
+    }
+
+    fc->n_slots = LOCI_FLOW_CHECKSUM_SLOTS;
+    fc->slots = MALLOC(fc->n_slots * sizeof(*fc->slots));
+    fc->tables = MALLOC(n_tables * sizeof(*fc->tables));
+    if (fc->slots == NULL || fc->tables == NULL) {
+        loci_flow_checksum_cleanup(fc);
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(fc->slots, 0, fc->n_slots * sizeof(*fc->slots));
+    MEMSET(fc->tables, 0, n_tables * sizeof(*fc->tables));
+    fc->n_tables = n_tables;
+
+    for (i = 0; i < n_tables; i++) {
+        fc->tables[i].buckets = MALLOC(buckets_size * sizeof(uint64_t));
+        if (fc->tables[i].buckets == NULL) {
+            loci_flow_checksum_cleanup(fc);
+            return OF_ERROR_RESOURCE;
+        }
+        MEMSET(fc->tables[i].buckets, 0, buckets_size * sizeof(uint64_t));
+        fc->tables[i].buckets_size = buckets_size;
+        fc->tables[i].bucket_bits = bits;
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Free the flows and tables of flow checksums
+ */
+void
+loci_flow_checksum_cleanup(loci_flow_checksum_t *fc)
+{
+    loci_flow_checksum_flow_t *flow, *next;
+    uint32_t i;
+    int t;
+
+    for (i = 0; fc->slots != NULL && i < fc->n_slots; i++) {
+        for (flow = fc->slots[i]; flow != NULL; flow = next) {
+            next = flow->next;
+            FREE(flow);
+        }
+    }
+    for (t = 0; fc->tables != NULL && t < fc->n_tables; t++) {
+        FREE(fc->tables[t].buckets);
+    }
+    FREE(fc->slots);
+    FREE(fc->tables);
+    MEMSET(fc, 0, sizeof(*fc));
+}
+
+/**
+ * Change the number of checksum buckets of a table
+ * @param fc The flow checksums
+ * @param table_id The table
+ * @param buckets_size Number of buckets, a power of 2
+ * @returns 0, OF_ERROR_PARAM or OF_ERROR_RESOURCE
+ *
+ * The bucket checksums are summed again from the table's flows.  On
+ * error the table is unchanged.
+ */
+int
+loci_flow_checksum_buckets_size_set(loci_flow_checksum_t *fc,
+                                    uint8_t table_id, uint32_t buckets_size)
+{
+    loci_flow_checksum_table_t *table;
+    loci_flow_checksum_flow_t *flow;
+    uint64_t *buckets;
+    int bits;
+
+    if (table_id >= fc->n_tables || (bits = buckets_bits(buckets_size)) < 0) {
+        return OF_ERROR_PARAM;
+    }
+    if ((buckets = MALLOC(buckets_size * sizeof(*buckets))) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(buckets, 0, buckets_size * sizeof(*buckets));
+
+    table = &fc->tables[table_id];
+    FREE(table->buckets);
+    table->buckets = buckets;
+    table->buckets_size = buckets_size;
+    table->bucket_bits = bits;
+    for (flow = table->flows; flow != NULL; flow = flow->table_next) {
+        buckets[loci_flow_checksum_bucket(table, flow->cookie)] ^=
+            flow->cookie;
+    }
+
+    return OF_ERROR_NONE;
+}
+
+static int
+flow_add(loci_flow_checksum_t *fc, uint8_t table_id, const match_words_t *mw,
+         uint16_t priority, uint64_t cookie, uint16_t flags,
+         const outputs_t *out)
+{
+    loci_flow_checksum_flow_t *flow, *old;
+    uint64_t hash;
+
+    if (table_id >= fc->n_tables) {
+        return OF_ERROR_PARAM;
+    }
+
+    hash = flow_hash(table_id, priority, mw);
+    old = flow_find(fc, table_id, priority, mw, hash);
+
+    if (flags & OF_FLOW_MOD_FLAG_CHECK_OVERLAP) {
+        for (flow = fc->tables[table_id].flows; flow != NULL;
+             flow = flow->table_next) {
+            if (flow != old && flow->priority == priority &&
+                flow_overlaps(flow, mw)) {
+                return OF_ERROR_PARAM;
+            }
+        }
+    }
+
+    /* A replaced flow takes the new cookie and outputs */
+    if (old != NULL) {
+        return flow_update(fc, old, cookie, out);
+    }
+
+    flow = MALLOC(flow_size(mw->n_words, out->n_ports + out->n_groups));
+    if (flow == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    flow->hash = hash;
+    flow->cookie = cookie;
+    flow->priority = priority;
+    flow->table_id = table_id;
+    flow->n_words = mw->n_words;
+    flow->n_ports = out->n_ports;
+    flow->n_groups = out->n_groups;
+    MEMCPY(flow->words, mw->words, mw->n_words * sizeof(mw->words[0]));
+    MEMCPY(flow_outputs(flow), out->ids,
+           (out->n_ports + out->n_groups) * sizeof(uint32_t));
+    flow_link(fc, flow);
+    if (fc->count > fc->n_slots) {
+        slots_grow(fc);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Add a flow, or replace the flow with the same table, priority and match
+ * @param fc The flow checksums
+ * @param table_id Table of the flow
+ * @param match Match of the flow
+ * @param priority Priority of the flow
+ * @param cookie Cookie of the flow, its checksum
+ * @param flags Flow mod flags; OF_FLOW_MOD_FLAG_CHECK_OVERLAP counts
+ * @param actions The flow's action list in 1.0 or instructions after,
+ * as bound from its flow_mod or flow stats entry; NULL if it has none
+ * @returns 0, OF_ERROR_PARAM for an unknown table or an overlap, or
+ * OF_ERROR_RESOURCE
+ */
+int
+loci_flow_checksum_add(loci_flow_checksum_t *fc, uint8_t table_id,
+                       const of_match_t *match, uint16_t priority,
+                       uint64_t cookie, uint16_t flags, of_object_t *actions)
+{
+    match_words_t mw;
+    outputs_t out;
+    int rv;
+
+    if ((rv = outputs_get(actions, &out)) < 0) {
+        return rv;
+    }
+    match_words(match, &mw);
+    rv = flow_add(fc, table_id, &mw, priority, cookie, flags, &out);
+    outputs_free(&out);
+
+    return rv;
+}
+
+/**
+ * Remove the flow with a table, priority and match
+ * @param fc The flow checksums
+ * @param table_id Table of the flow
+ * @param match Match of the flow
+ * @param priority Priority of the flow
+ * @returns 0 or OF_ERROR_RANGE if there is no such flow
+ *
+ * For flows a switch removes itself, as when they time out.
+ */
+int
+loci_flow_checksum_remove(loci_flow_checksum_t *fc, uint8_t table_id,
+                          const of_match_t *match, uint16_t priority)
+{
+    loci_flow_checksum_flow_t *flow;
+    match_words_t mw;
+
+    match_words(match, &mw);
+    flow = flow_find(fc, table_id, priority, &mw,
+                     flow_hash(table_id, priority, &mw));
+    if (flow == NULL) {
+        return OF_ERROR_RANGE;
+    }
+    flow_free(fc, flow);
+
+    return OF_ERROR_NONE;
+}
+
+/****************************************************************
+ * Flow mods
+ ****************************************************************/
+
+#define FLOW_MOD_GET(cls, obj, fm) do {                                 \
+        cls##_cookie_get(obj, &(fm)->cookie);                           \
+        cls##_priority_get(obj, &(fm)->priority);                       \
+        cls##_flags_get(obj, &(fm)->flags);                             \
+        cls##_out_port_get(obj, &(fm)->out_port);                       \
+        if ((obj)->version >= OF_VERSION_1_1) {                         \
+            cls##_cookie_mask_get(obj, &(fm)->cookie_mask);             \
+            cls##_table_id_get(obj, &(fm)->table_id);                   \
+            cls##_out_group_get(obj, &(fm)->out_group);                 \
+            cls##_instructions_bind(obj, &(fm)->actions);               \
+        } else {                                                        \
+            cls##_actions_bind(obj, &(fm)->actions);                    \
+        }                                                               \
+        rv = cls##_match_get(obj, &(fm)->match);                        \
+    } while (0)
+
+static int
+flow_mod_get(of_object_t *obj, flow_mod_t *fm)
+{
+    int rv;
+
+    MEMSET(fm, 0, sizeof(*fm));
+    fm->out_group = OF_GROUP_ANY;
+    switch (obj->object_id) {
+    case OF_FLOW_ADD:
+        FLOW_MOD_GET(of_flow_add, obj, fm);
+        break;
+    case OF_FLOW_MODIFY:
+        FLOW_MOD_GET(of_flow_modify, obj, fm);
+        break;
+    case OF_FLOW_MODIFY_STRICT:
+        FLOW_MOD_GET(of_flow_modify_strict, obj, fm);
+        break;
+    case OF_FLOW_DELETE:
+        FLOW_MOD_GET(of_flow_delete, obj, fm);
+        break;
+    case OF_FLOW_DELETE_STRICT:
+        FLOW_MOD_GET(of_flow_delete_strict, obj, fm);
+        break;
+    default:
+        return OF_ERROR_COMPAT;
+    }
+
+    return rv;
+}
+
+static inline int
+cookie_selected(const loci_flow_checksum_flow_t *flow, const flow_mod_t *fm)
+{
+    return ((flow->cookie ^ fm->cookie) & fm->cookie_mask) == 0;
+}
+
+/*
+ * Delete a flow a delete covers, if it outputs to the delete's
+ * out_port and out_group, or give a flow a modify covers the modify's
+ * outputs.  Returns 1 if the flow was deleted or modified.
+ */
+static int
+flow_cover(loci_flow_checksum_t *fc, loci_flow_checksum_flow_t *flow,
+           const flow_mod_t *fm, const outputs_t *out)
+{
+    int rv;
+
+    if (out == NULL) {
+        if (!flow_outputs_selected(flow, fm)) {
+            return 0;
+        }
+        flow_free(fc, flow);
+        return 1;
+    }
+    if ((rv = flow_update(fc, flow, flow->cookie, out)) < 0) {
+        return rv;
+    }
+
+    return 1;
+}
+
+/*
+ * The flows of a table a modify or delete covers: the one flow with its
+ * priority and match if strict, else those with more specific matches.
+ * A modify passes its outputs, a delete NULL.  Returns how many flows
+ * were modified or deleted, or an error.
+ */
+static int
+flows_covered(loci_flow_checksum_t *fc, uint8_t table_id,
+              const flow_mod_t *fm, const match_words_t *mw, int strict,
+              const outputs_t *out)
+{
+    loci_flow_checksum_flow_t *flow, *next;
+    int count = 0, rv;
+
+    if (strict) {
+        flow = flow_find(fc, table_id, fm->priority, mw,
+                         flow_hash(table_id, fm->priority, mw));
+        if (flow == NULL || !cookie_selected(flow, fm)) {
+            return 0;
+        }
+        return flow_cover(fc, flow, fm, out);
+    }
+
+    /* A modified flow moves to the head of the table, behind next */
+    for (flow = fc->tables[table_id].flows; flow != NULL; flow = next) {
+        next = flow->table_next;
+        if (cookie_selected(flow, fm) && flow_more_specific(flow, mw)) {
+            if ((rv = flow_cover(fc, flow, fm, out)) < 0) {
+                return rv;
+            }
+            count += rv;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Apply a flow_mod or bsn_table_set_buckets_size
+ * @param fc The flow checksums
+ * @param msg The message
+ * @returns 0; OF_ERROR_PARAM for an unknown table, an overlap or a bad
+ * buckets size; OF_ERROR_RESOURCE; or OF_ERROR_COMPAT for other
+ * messages
+ *
+ * Modifies change no cookie, but the outputs of the flows they cover.
+ * Flows 1.0 adds to the emergency table aren't in any table.
+ */
+int
+loci_flow_checksum_apply(loci_flow_checksum_t *fc, of_object_t *msg)
+{
+    flow_mod_t fm;
+    match_words_t mw;
+    outputs_t out;
+    uint32_t buckets_size;
+    uint8_t table_id;
+    int strict = 0, rv, t;
+
+    if (msg->object_id == OF_BSN_TABLE_SET_BUCKETS_SIZE) {
+        of_bsn_table_set_buckets_size_table_id_get(msg, &table_id);
+        of_bsn_table_set_buckets_size_buckets_size_get(msg, &buckets_size);
+        return loci_flow_checksum_buckets_size_set(fc, table_id, buckets_size);
+    }
+
+    if ((rv = flow_mod_get(msg, &fm)) < 0) {
+        return rv;
+    }
+    match_words(&fm.match, &mw);
+
+    switch (msg->object_id) {
+    case OF_FLOW_ADD:
+        if (msg->version == OF_VERSION_1_0 &&
+            (fm.flags & OF_FLOW_MOD_FLAG_EMERG)) {
+            return OF_ERROR_NONE;
+        }
+        if ((rv = outputs_get(&fm.actions, &out)) < 0) {
+            return rv;
+        }
+        rv = flow_add(fc, fm.table_id, &mw, fm.priority, fm.cookie,
+                      fm.flags, &out);
+        outputs_free(&out);
+        return rv;
+
+    case OF_FLOW_MODIFY_STRICT:
+        strict = 1;
+        /* fall through */
+    case OF_FLOW_MODIFY:
+        if (fm.table_id >= fc->n_tables) {
+            return OF_ERROR_PARAM;
+        }
+        if ((rv = outputs_get(&fm.actions, &out)) < 0) {
+            return rv;
+        }
+        rv = flows_covered(fc, fm.table_id, &fm, &mw, strict, &out);
+        /* 1.0 and 1.1: a modify of no flow is an add */
+        if (rv == 0 && msg->version < OF_VERSION_1_2) {
+            rv = flow_add(fc, fm.table_id, &mw, fm.priority, fm.cookie,
+                          fm.flags, &out);
+        }
+        outputs_free(&out);
+        return rv < 0 ? rv : OF_ERROR_NONE;
+
+    case OF_FLOW_DELETE_STRICT:
+        strict = 1;
+        /* fall through */
+    default:
+        if (msg->version >= OF_VERSION_1_1 && fm.table_id == TABLE_ALL) {
+            for (t = 0; t < fc->n_tables; t++) {
+                flows_covered(fc, t, &fm, &mw, strict, NULL);
+            }
+            return OF_ERROR_NONE;
+        }
+        if (fm.table_id >= fc->n_tables) {
+            return OF_ERROR_PARAM;
+        }
+        flows_covered(fc, fm.table_id, &fm, &mw, strict, NULL);
+        return OF_ERROR_NONE;
+    }
+}
+
+/****************************************************************
+ * Replies
+ ****************************************************************/
+
+/**
+ * Fill a flow checksum bucket stats reply with a table's buckets
+ * @param fc The flow checksums
+ * @param table_id The table
+ * @param bucket First bucket for the reply; moved past the buckets
+ * filled
+ * @param reply A new reply
+ * @returns Number of buckets in the reply, OF_ERROR_PARAM for an
+ * unknown table, or OF_ERROR_RESOURCE if none fit
+ *
+ * OF_STATS_REPLY_FLAG_REPLY_MORE is set unless the reply has the last
+ * bucket.
+ */
+int
+loci_flow_checksum_bucket_stats_fill(
+    loci_flow_checksum_t *fc, uint8_t table_id, uint32_t *bucket,
+    of_bsn_flow_checksum_bucket_stats_reply_t *reply)
+{
+    of_list_bsn_flow_checksum_bucket_stats_entry_t list;
+    of_bsn_flow_checksum_bucket_stats_entry_t entry;
+    loci_flow_checksum_table_t *table;
+    uint16_t flags = 0;
+    int count = 0;
+
+    if (table_id >= fc->n_tables) {
+        return OF_ERROR_PARAM;
+    }
+    table = &fc->tables[table_id];
+
+    of_bsn_flow_checksum_bucket_stats_reply_entries_bind(reply, &list);
+    for (; *bucket < table->buckets_size; (*bucket)++) {
+        of_bsn_flow_checksum_bucket_stats_entry_init(&entry, reply->version,
+                                                     -1, 1);
+        if (of_list_append_bind(&list, &entry) < 0) {
+            break;
+        }
+        of_bsn_flow_checksum_bucket_stats_entry_checksum_set(
+            &entry, table->buckets[*bucket]);
+        count++;
+    }
+    if (count == 0 && *bucket < table->buckets_size) {
+        return OF_ERROR_RESOURCE;
+    }
+    if (*bucket < table->buckets_size) {
+        OF_STATS_REPLY_FLAG_REPLY_MORE_SET(flags, reply->version);
+    }
+    of_bsn_flow_checksum_bucket_stats_reply_flags_set(reply, flags);
+
+    return count;
+}
+
+/**
+ * Fill a table checksum stats reply with the checksums of all tables
+ * @param fc The flow checksums
+ * @param reply A new reply
+ * @returns Number of tables, or OF_ERROR_RESOURCE
+ */
+int
+loci_flow_checksum_table_stats_fill(
+    loci_flow_checksum_t *fc, of_bsn_table_checksum_stats_reply_t *reply)
+{
+    of_list_bsn_table_checksum_stats_entry_t list;
+    of_bsn_table_checksum_stats_entry_t entry;
+    int t, rv;
+
+    of_bsn_table_checksum_stats_reply_entries_bind(reply, &list);
+    for (t = 0; t < fc->n_tables; t++) {
+        of_bsn_table_checksum_stats_entry_init(&entry, reply->version, -1, 1);
+        if ((rv = of_list_append_bind(&list, &entry)) < 0) {
+            return rv;
+        }
+        of_bsn_table_checksum_stats_entry_table_id_set(&entry, t);
+        of_bsn_table_checksum_stats_entry_checksum_set(
+            &entry, fc->tables[t].checksum);
+    }
+
+    return fc->n_tables;
+}
@@ -0,0 +1,612 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_gentable.c
+ *
+ * BSN generic table store with checksum buckets.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_gentable.h>
+#include <loci/loci_hash.h>
+
+/* Fixed part of a bsn_gentable_entry_desc_stats_entry */
+#define ENTRY_DESC_BYTES 20
+
+static inline void
+checksum_xor(of_checksum_128_t *sum, of_checksum_128_t checksum)
+{
+    sum->hi ^= checksum.hi;
+    sum->lo ^= checksum.lo;
+}
+
+static inline int
+checksum_selected(of_checksum_128_t checksum, of_checksum_128_t want,
+                  of_checksum_128_t mask)
+{
+    return ((checksum.hi ^ want.hi) & mask.hi) == 0 &&
+        ((checksum.lo ^ want.lo) & mask.lo) == 0;
+}
+
+static void
+bucket_link(loci_gentable_t *gt, loci_gentable_entry_t *entry)
+{
+    loci_gentable_bucket_t *bucket;
+
+    bucket = &gt->buckets[loci_gentable_bucket(gt, entry->checksum)];
+    entry->bucket_prev = NULL;
+    entry->bucket_next = bucket->entries;
+    if (bucket->entries != NULL) {
+        bucket->entries->bucket_prev = entry;
+    }
+    bucket->entries = entry;
+    bucket->count++;
+    checksum_xor(&bucket->checksum, entry->checksum);
+    checksum_xor(&gt->checksum, entry->checksum);
+}
+
+static void
+bucket_unlink(loci_gentable_t *gt, loci_gentable_entry_t *entry)
+{
+    loci_gentable_bucket_t *bucket;
+
+    bucket = &gt->buckets[loci_gentable_bucket(gt, entry->checksum)];
+    if (entry->bucket_prev != NULL) {
+        entry->bucket_prev->bucket_next = entry->bucket_next;
+    } else {
+        bucket->entries = entry->bucket_next;
+    }
+    if (entry->bucket_next != NULL) {
+        entry->bucket_next->bucket_prev = entry->bucket_prev;
+    }
+    bucket->count--;
+    checksum_xor(&bucket->checksum, entry->checksum);
+    checksum_xor(&gt->checksum, entry->checksum);
+}
+
+/* The slot in the key index pointing at the key's entry, or at NULL */
+static loci_gentable_entry_t **
+slot_find(loci_gentable_t *gt, const uint8_t *key, int key_bytes,
+          uint64_t hash)
+{
+    loci_gentable_entry_t **prev;
+
+    for (prev = &gt->slots[hash & (gt->n_slots - 1)]; *prev != NULL;
+         prev = &(*prev)->next) {
+        if ((*prev)->hash == hash && (*prev)->key_bytes == key_bytes &&
+            MEMCMP((*prev)->data, key, key_bytes) == 0) {
+            break;
+        }
+    }
+
+    return prev;
+}
+
+/* Double the slots; on failure the chains just get longer */
+static void
+slots_grow(loci_gentable_t *gt)
+{
+    loci_gentable_entry_t **slots, *entry, *next;
+    uint32_t n_slots = gt->n_slots * 2;
+    uint32_t i;
+
+    if ((slots = MALLOC(n_slots * sizeof(*slots))) == NULL) {
+        return;
+    }
+    MEMSET(slots, 0, n_slots * sizeof(*slots));
+    for (i = 0; i < gt->n_slots; i++) {
+        for (entry = gt->slots[i]; entry != NULL; entry = next) {
+            next = entry->next;
+            entry->next = slots[entry->hash & (n_slots - 1)];
+            slots[entry->hash & (n_slots - 1)] = entry;
+        }
+    }
+    FREE(gt->slots);
+    gt->slots = slots;
+    gt->n_slots = n_slots;
+}
+
+static void
+entry_remove(loci_gentable_t *gt, loci_gentable_entry_t **prev)
+{
+    loci_gentable_entry_t *entry = *prev;
+
+    *prev = entry->next;
+    bucket_unlink(gt, entry);
+    FREE(entry);
+    gt->count--;
+}
+
+static int
+buckets_bits(uint32_t buckets_size)
+{
+    int bits = 0;
+
+    if (buckets_size == 0 || buckets_size > LOCI_GENTABLE_BUCKETS_MAX ||
+        (buckets_size & (buckets_size - 1)) != 0) {
+        return OF_ERROR_PARAM;
+    }
+    while ((1U << bits) < buckets_size) {
+        bits++;
+    }
+
+    return bits;
+}
+
+/**
+ * Initialize an empty gentable
+ * @param gt The gentable
+ * @param table_id Table id of the messages it takes
+ * @param buckets_size Number of checksum buckets, a power of 2
+ * @returns 0, OF_ERROR_PARAM or OF_ERROR_RESOURCE
+ */
+int
+loci_gentable_init(loci_gentable_t *gt, uint16_t table_id,
+                   uint32_t buckets_size)
+{
+    int bits;
+
+    MEMSET(gt, 0, sizeof(*gt));
+    if ((bits = buckets_bits(buckets_size)) < 0) {
+        return bits;
+    }
+
+    gt->table_id = table_id;
+    gt->n_slots = LOCI_GENTABLE_SLOTS;
+    gt->buckets_size = buckets_size;
+    gt->bucket_bits = bits;
+    gt->slots = MALLOC(gt->n_slots * sizeof(*gt->slots));
+    gt->buckets = MALLOC(buckets_size * sizeof(*gt->buckets));
+    if (gt->slots == NULL || gt->buckets == NULL) {
+        loci_gentable_cleanup(gt);
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(gt->slots, 0, gt->n_slots * sizeof(*gt->slots));
+    MEMSET(gt->buckets, 0, buckets_size * sizeof(*gt->buckets));
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Free the entries of a gentable
+ */
+void
+loci_gentable_cleanup(loci_gentable_t *gt)
+{
+    loci_gentable_entry_t *entry, *next;
+    uint32_t i;
+
+    for (i = 0; gt->slots != NULL && i < gt->n_slots; i++) {
+        for (entry = gt->slots[i]; entry != NULL; entry = next) {
+            next = entry->next;
+            FREE(entry);
+        }
+    }
+    FREE(gt->slots);
+    FREE(gt->buckets);
+    MEMSET(gt, 0, sizeof(*gt));
+}
+
+/**
+ * Change the number of checksum buckets
+ * @param gt The gentable
+ * @param buckets_size Number of buckets, a power of 2
+ * @returns 0, OF_ERROR_PARAM or OF_ERROR_RESOURCE
+ *
+ * The entries are sorted into the new buckets.  On error the table is
+ * unchanged.
+ */
+int
+loci_gentable_buckets_size_set(loci_gentable_t *gt, uint32_t buckets_size)
+{
+    loci_gentable_bucket_t *buckets;
+    loci_gentable_entry_t *entry;
+    int bits;
+    uint32_t i;
+
+    if ((bits = buckets_bits(buckets_size)) < 0) {
+        return bits;
+    }
+    if ((buckets = MALLOC(buckets_size * sizeof(*buckets))) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(buckets, 0, buckets_size * sizeof(*buckets));
+
+    FREE(gt->buckets);
+    gt->buckets = buckets;
+    gt->buckets_size = buckets_size;
+    gt->bucket_bits = bits;
+    MEMSET(&gt->checksum, 0, sizeof(gt->checksum));
+    for (i = 0; i < gt->n_slots; i++) {
+        for (entry = gt->slots[i]; entry != NULL; entry = entry->next) {
+            bucket_link(gt, entry);
+        }
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Add an entry, or change the entry with the same key
+ * @param gt The gentable
+ * @param key The key TLV list as on the wire
+ * @param key_bytes Length of key
+ * @param value The value TLV list as on the wire
+ * @param value_bytes Length of value
+ * @param checksum Checksum of the entry
+ * @returns 0, OF_ERROR_PARAM or OF_ERROR_RESOURCE
+ *
+ * On error the table is unchanged.
+ */
+int
+loci_gentable_add(loci_gentable_t *gt, const uint8_t *key, int key_bytes,
+                  const uint8_t *value, int value_bytes,
+                  of_checksum_128_t checksum)
+{
+    loci_gentable_entry_t **prev, *entry, *old;
+    uint64_t hash;
+
+    if (key_bytes < 0 || key_bytes > 0xffff ||
+        value_bytes < 0 || value_bytes > 0xffff) {
+        return OF_ERROR_PARAM;
+    }
+
+    hash = loci_hash_bytes(key, key_bytes, 0);
+    prev = slot_find(gt, key, key_bytes, hash);
+    old = *prev;
+
+    /* A changed entry keeps its memory if the value fits */
+    if (old != NULL && old->value_bytes == value_bytes) {
+        if (value_bytes > 0) {
+            MEMCPY(LOCI_GENTABLE_ENTRY_VALUE(old), value, value_bytes);
+        }
+        bucket_unlink(gt, old);
+        old->checksum = checksum;
+        bucket_link(gt, old);
+        return OF_ERROR_NONE;
+    }
+
+    if ((entry = MALLOC(sizeof(*entry) + key_bytes + value_bytes)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    entry->hash = hash;
+    entry->checksum = checksum;
+    entry->key_bytes = key_bytes;
+    entry->value_bytes = value_bytes;
+    if (key_bytes > 0) {
+        MEMCPY(entry->data, key, key_bytes);
+    }
+    if (value_bytes > 0) {
+        MEMCPY(LOCI_GENTABLE_ENTRY_VALUE(entry), value, value_bytes);
+    }
+
+    if (old != NULL) {
+        entry->next = old->next;
+        *prev = entry;
+        bucket_unlink(gt, old);
+        FREE(old);
+        bucket_link(gt, entry);
+        return OF_ERROR_NONE;
+    }
+
+    entry->next = NULL;
+    *prev = entry;
+    bucket_link(gt, entry);
+    if (++gt->count > gt->n_slots) {
+        slots_grow(gt);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Delete the entry with a key
+ * @param gt The gentable
+ * @param key The key TLV list as on the wire
+ * @param key_bytes Length of key
+ * @returns 0 or OF_ERROR_RANGE if there is no such entry
+ */
+int
+loci_gentable_delete(loci_gentable_t *gt, const uint8_t *key, int key_bytes)
+{
+    loci_gentable_entry_t **prev;
+
+    prev = slot_find(gt, key, key_bytes, loci_hash_bytes(key, key_bytes, 0));
+    if (*prev == NULL) {
+        return OF_ERROR_RANGE;
+    }
+    entry_remove(gt, prev);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Find the entry with a key
+ * @param gt The gentable
+ * @param key The key TLV list as on the wire
+ * @param key_bytes Length of key
+ * @returns The entry or NULL
+ */
+loci_gentable_entry_t *
+loci_gentable_lookup(loci_gentable_t *gt, const uint8_t *key, int key_bytes)
+{
+    return *slot_find(gt, key, key_bytes, loci_hash_bytes(key, key_bytes, 0));
+}
+
+/**
+ * Delete the entries whose checksums a checksum and mask select
+ * @param gt The gentable
+ * @param checksum Checksum bits to match
+ * @param checksum_mask Bits of the checksum that count
+ * @returns Number of entries deleted
+ *
+ * As of_bsn_gentable_clear_request: an entry is deleted if its checksum
+ * agrees with checksum on every bit of checksum_mask.  Only the buckets
+ * the leading ones of the mask allow are visited.
+ */
+uint32_t
+loci_gentable_clear(loci_gentable_t *gt, of_checksum_128_t checksum,
+                    of_checksum_128_t checksum_mask)
+{
+    loci_gentable_dump_t dump;
+    loci_gentable_entry_t *entry, *next;
+    uint32_t deleted = 0;
+
+    loci_gentable_dump_select(gt, &dump, checksum, checksum_mask);
+    for (; dump.bucket < dump.end; dump.bucket++) {
+        for (entry = gt->buckets[dump.bucket].entries; entry != NULL;
+             entry = next) {
+            next = entry->bucket_next;
+            if (checksum_selected(entry->checksum, checksum, checksum_mask)) {
+                entry_remove(gt, slot_find(gt, entry->data, entry->key_bytes,
+                                           entry->hash));
+                deleted++;
+            }
+        }
+    }
+
+    return deleted;
+}
+
+/**
+ * Apply a gentable message
+ * @param gt The gentable
+ * @param msg An of_bsn_gentable_entry_add, entry_delete,
+ * set_buckets_size or clear_request
+ * @returns 0, OF_ERROR_PARAM if the message is for another table,
+ * OF_ERROR_COMPAT for other messages, or an error of the operation
+ */
+int
+loci_gentable_apply(loci_gentable_t *gt, of_object_t *msg)
+{
+    of_list_bsn_tlv_t key, value;
+    of_checksum_128_t checksum, checksum_mask;
+    uint32_t buckets_size;
+    uint16_t table_id;
+
+    switch (msg->object_id) {
+    case OF_BSN_GENTABLE_ENTRY_ADD:
+        of_bsn_gentable_entry_add_table_id_get(msg, &table_id);
+        break;
+    case OF_BSN_GENTABLE_ENTRY_DELETE:
+        of_bsn_gentable_entry_delete_table_id_get(msg, &table_id);
+        break;
+    case OF_BSN_GENTABLE_SET_BUCKETS_SIZE:
+        of_bsn_gentable_set_buckets_size_table_id_get(msg, &table_id);
+        break;
+    case OF_BSN_GENTABLE_CLEAR_REQUEST:
+        of_bsn_gentable_clear_request_table_id_get(msg, &table_id);
+        break;
+    default:
+        return OF_ERROR_COMPAT;
+    }
+    if (table_id != gt->table_id) {
+        return OF_ERROR_PARAM;
+    }
+
+    switch (msg->object_id) {
+    case OF_BSN_GENTABLE_ENTRY_ADD:
+        of_bsn_gentable_entry_add_key_bind(msg, &key);
+        of_bsn_gentable_entry_add_value_bind(msg, &value);
+        of_bsn_gentable_entry_add_checksum_get(msg, &checksum);
+        return loci_gentable_add(gt, OF_OBJECT_BUFFER_INDEX(&key, 0),
+                                 key.length, OF_OBJECT_BUFFER_INDEX(&value, 0),
+                                 value.length, checksum);
+    case OF_BSN_GENTABLE_ENTRY_DELETE:
+        of_bsn_gentable_entry_delete_key_bind(msg, &key);
+        return loci_gentable_delete(gt, OF_OBJECT_BUFFER_INDEX(&key, 0),
+                                    key.length);
+    case OF_BSN_GENTABLE_SET_BUCKETS_SIZE:
+        of_bsn_gentable_set_buckets_size_buckets_size_get(msg, &buckets_size);
+        return loci_gentable_buckets_size_set(gt, buckets_size);
+    default:
+        of_bsn_gentable_clear_request_checksum_get(msg, &checksum);
+        of_bsn_gentable_clear_request_checksum_mask_get(msg, &checksum_mask);
+        loci_gentable_clear(gt, checksum, checksum_mask);
+        return OF_ERROR_NONE;
+    }
+}
+
+/****************************************************************
+ * Dumps
+ ****************************************************************/
+
+/**
+ * Start a dump of a range of buckets
+ * @param gt The gentable
+ * @param dump The dump
+ * @param first First bucket
+ * @param count Number of buckets; cut to the buckets there are
+ */
+void
+loci_gentable_dump_init(loci_gentable_t *gt, loci_gentable_dump_t *dump,
+                        uint32_t first, uint32_t count)
+{
+    MEMSET(dump, 0, sizeof(*dump));
+    if (first > gt->buckets_size) {
+        first = gt->buckets_size;
+    }
+    if (count > gt->buckets_size - first) {
+        count = gt->buckets_size - first;
+    }
+    dump->bucket = first;
+    dump->end = first + count;
+}
+
+/**
+ * Start a dump of the entries a checksum and mask select
+ * @param gt The gentable
+ * @param dump The dump
+ * @param checksum Checksum bits to match
+ * @param checksum_mask Bits of the checksum that count
+ *
+ * As of_bsn_gentable_entry_desc_stats_request.  The leading ones of
+ * the mask fix the top bits of the bucket, so a mask of bucket_bits
+ * leading ones dumps one bucket and a mask of 0 all of them; other
+ * bits of the mask filter the entries of those buckets.
+ */
+void
+loci_gentable_dump_select(loci_gentable_t *gt, loci_gentable_dump_t *dump,
+                          of_checksum_128_t checksum,
+                          of_checksum_128_t checksum_mask)
+{
+    int ones = 0, bits = gt->bucket_bits;
+
+    while (ones < bits && (checksum_mask.hi >> (63 - ones)) & 1) {
+        ones++;
+    }
+    if (ones == 0) {
+        loci_gentable_dump_init(gt, dump, 0, gt->buckets_size);
+    } else {
+        loci_gentable_dump_init(gt, dump,
+                                (uint32_t)(checksum.hi >> (64 - ones)) <<
+                                (bits - ones), 1U << (bits - ones));
+    }
+    dump->checksum = checksum;
+    dump->checksum_mask = checksum_mask;
+}
+
+static void
+reply_more_set(of_object_t *reply, loci_gentable_dump_t *dump)
+{
+    uint16_t flags = 0;
+
+    if (!loci_gentable_dump_done(dump)) {
+        OF_STATS_REPLY_FLAG_REPLY_MORE_SET(flags, reply->version);
+    }
+    if (reply->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY) {
+        of_bsn_gentable_bucket_stats_reply_flags_set(reply, flags);
+    } else {
+        of_bsn_gentable_entry_desc_stats_reply_flags_set(reply, flags);
+    }
+}
+
+/**
+ * Fill a bucket stats reply with the checksums of a dump's buckets
+ * @param gt The gentable
+ * @param dump The dump
+ * @param reply A new reply
+ * @returns Number of buckets in the reply, or OF_ERROR_RESOURCE if
+ * none fit
+ *
+ * The dump's checksum and mask don't filter bucket stats.
+ */
+int
+loci_gentable_bucket_stats_fill(loci_gentable_t *gt,
+                                loci_gentable_dump_t *dump,
+                                of_bsn_gentable_bucket_stats_reply_t *reply)
+{
+    of_list_bsn_gentable_bucket_stats_entry_t list;
+    of_bsn_gentable_bucket_stats_entry_t entry;
+    int count = 0;
+
+    of_bsn_gentable_bucket_stats_reply_entries_bind(reply, &list);
+    for (; dump->bucket < dump->end; dump->bucket++) {
+        of_bsn_gentable_bucket_stats_entry_init(&entry, reply->version, -1, 1);
+        if (of_list_append_bind(&list, &entry) < 0) {
+            break;
+        }
+        of_bsn_gentable_bucket_stats_entry_checksum_set(
+            &entry, gt->buckets[dump->bucket].checksum);
+        count++;
+    }
+    if (count == 0 && !loci_gentable_dump_done(dump)) {
+        return OF_ERROR_RESOURCE;
+    }
+    reply_more_set(reply, dump);
+
+    return count;
+}
+
+/* Append an entry desc for an entry; it is written in place */
+static int
+entry_desc_append(of_list_bsn_gentable_entry_desc_stats_entry_t *list,
+                  loci_gentable_entry_t *entry)
+{
+    of_bsn_gentable_entry_desc_stats_entry_t desc;
+    int bytes = ENTRY_DESC_BYTES + entry->key_bytes + entry->value_bytes;
+    int rv;
+
+    of_bsn_gentable_entry_desc_stats_entry_init(&desc, list->version, bytes, 1);
+    if ((rv = of_list_append_bind(list, &desc)) < 0) {
+        return rv;
+    }
+    buf_u16_set(OF_OBJECT_BUFFER_INDEX(&desc, 2), entry->key_bytes);
+    of_bsn_gentable_entry_desc_stats_entry_checksum_set(&desc,
+                                                        entry->checksum);
+    MEMCPY(OF_OBJECT_BUFFER_INDEX(&desc, ENTRY_DESC_BYTES), entry->data,
+           entry->key_bytes + entry->value_bytes);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Fill an entry desc stats reply with the entries of a dump
+ * @param gt The gentable
+ * @param dump The dump
+ * @param reply A new reply
+ * @returns Number of entries in the reply, or OF_ERROR_RESOURCE if an
+ * entry doesn't fit in a reply on its own
+ *
+ * A reply may have no entries, when the dump is done.
+ */
+int
+loci_gentable_entry_desc_fill(loci_gentable_t *gt,
+                              loci_gentable_dump_t *dump,
+                              of_bsn_gentable_entry_desc_stats_reply_t *reply)
+{
+    of_list_bsn_gentable_entry_desc_stats_entry_t list;
+    loci_gentable_entry_t *entry;
+    uint32_t pos;
+    int count = 0;
+
+    of_bsn_gentable_entry_desc_stats_reply_entries_bind(reply, &list);
+    for (; dump->bucket < dump->end; dump->bucket++, dump->skip = 0) {
+        entry = gt->buckets[dump->bucket].entries;
+        for (pos = 0; entry != NULL && pos < dump->skip; pos++) {
+            entry = entry->bucket_next;
+        }
+        for (; entry != NULL; entry = entry->bucket_next, dump->skip++) {
+            if (!checksum_selected(entry->checksum, dump->checksum,
+                                   dump->checksum_mask)) {
+                continue;
+            }
+            if (entry_desc_append(&list, entry) < 0) {
+                if (count == 0) {
+                    return OF_ERROR_RESOURCE;
+                }
+                reply_more_set(reply, dump);
+                return count;
+            }
+            count++;
+        }
+    }
+    reply_more_set(reply, dump);
+
+    return count;
+}
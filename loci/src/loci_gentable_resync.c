@@ -0,0 +1,488 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_gentable_resync.c
+ *
+ * Resync of a switch's BSN gentable by bucket checksum differences.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_gentable_resync.h>
+
+/* Fewest slots of the seen set, a power of 2 */
+#define SEEN_SLOTS_MIN 16
+
+#define DIFFER_WORDS(buckets) (((buckets) + 31) / 32)
+
+static inline int
+differs(loci_gentable_resync_t *rs, uint32_t bucket)
+{
+    return (rs->differ[bucket / 32] >> (bucket % 32)) & 1;
+}
+
+static inline void
+differ_set(loci_gentable_resync_t *rs, uint32_t bucket)
+{
+    rs->differ[bucket / 32] |= 1U << (bucket % 32);
+    rs->buckets_differ++;
+}
+
+/****************************************************************
+ * Seen set: open addressing by the entries' key hashes, kept at most
+ * half full.  It only ever holds entries of the current range.
+ ****************************************************************/
+
+static int
+seen_reset(loci_gentable_resync_t *rs, uint32_t count)
+{
+    uint32_t slots = SEEN_SLOTS_MIN;
+
+    while (slots < 2 * count) {
+        slots *= 2;
+    }
+    if (slots > rs->seen_slots) {
+        FREE(rs->seen);
+        rs->seen_slots = 0;
+        if ((rs->seen = MALLOC(slots * sizeof(*rs->seen))) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        rs->seen_slots = slots;
+    }
+    MEMSET(rs->seen, 0, rs->seen_slots * sizeof(*rs->seen));
+    rs->seen_count = 0;
+
+    return OF_ERROR_NONE;
+}
+
+/* The slot holding an entry, or the empty slot it would go in */
+static loci_gentable_entry_t **
+seen_find(loci_gentable_resync_t *rs, loci_gentable_entry_t *entry)
+{
+    uint32_t i = (uint32_t)entry->hash & (rs->seen_slots - 1);
+
+    while (rs->seen[i] != NULL && rs->seen[i] != entry) {
+        i = (i + 1) & (rs->seen_slots - 1);
+    }
+
+    return &rs->seen[i];
+}
+
+/*
+ * Entries of other ranges are left out, so the set's count can be
+ * compared with the range's.  A full set leaves entries out too, which
+ * only costs extra adds.
+ */
+static void
+seen_add(loci_gentable_resync_t *rs, loci_gentable_entry_t *entry)
+{
+    loci_gentable_entry_t **slot;
+    uint32_t bucket = loci_gentable_bucket(rs->gt, entry->checksum);
+
+    if (bucket < rs->first || bucket >= rs->first + rs->count ||
+        2 * (rs->seen_count + 1) > rs->seen_slots) {
+        return;
+    }
+    slot = seen_find(rs, entry);
+    if (*slot == NULL) {
+        *slot = entry;
+        rs->seen_count++;
+    }
+}
+
+/****************************************************************
+ * Messages to the switch
+ ****************************************************************/
+
+static int
+send_msg(loci_gentable_resync_t *rs, of_object_t *msg)
+{
+    if (msg == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+
+    return rs->send(rs->cookie, msg);
+}
+
+/* Point the scratch list at a copy of raw TLVs */
+static void
+tlvs_load(loci_gentable_resync_t *rs, const uint8_t *bytes, int len)
+{
+    if (len > 0) {
+        MEMCPY(OF_OBJECT_BUFFER_INDEX(rs->tlvs, 0), bytes, len);
+    }
+    rs->tlvs->length = len;
+}
+
+static int
+entry_add_send(loci_gentable_resync_t *rs, loci_gentable_entry_t *entry)
+{
+    of_bsn_gentable_entry_add_t *msg;
+    int rv;
+
+    if ((msg = of_bsn_gentable_entry_add_new(rs->version)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    of_bsn_gentable_entry_add_xid_set(msg, rs->xid++);
+    of_bsn_gentable_entry_add_table_id_set(msg, rs->gt->table_id);
+    of_bsn_gentable_entry_add_checksum_set(msg, entry->checksum);
+    tlvs_load(rs, LOCI_GENTABLE_ENTRY_KEY(entry), entry->key_bytes);
+    if ((rv = of_bsn_gentable_entry_add_key_set(msg, rs->tlvs)) == 0) {
+        tlvs_load(rs, LOCI_GENTABLE_ENTRY_VALUE(entry), entry->value_bytes);
+        rv = of_bsn_gentable_entry_add_value_set(msg, rs->tlvs);
+    }
+    if (rv < 0) {
+        of_object_delete(msg);
+        return rv;
+    }
+    rs->adds++;
+
+    return send_msg(rs, msg);
+}
+
+static int
+entry_delete_send(loci_gentable_resync_t *rs, of_list_bsn_tlv_t *key)
+{
+    of_bsn_gentable_entry_delete_t *msg;
+    int rv;
+
+    if ((msg = of_bsn_gentable_entry_delete_new(rs->version)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    of_bsn_gentable_entry_delete_xid_set(msg, rs->xid++);
+    of_bsn_gentable_entry_delete_table_id_set(msg, rs->gt->table_id);
+    if ((rv = of_bsn_gentable_entry_delete_key_set(msg, key)) < 0) {
+        of_object_delete(msg);
+        return rv;
+    }
+    rs->deletes++;
+
+    return send_msg(rs, msg);
+}
+
+/* Desired entries in a range of buckets */
+static uint32_t
+range_entries(loci_gentable_t *gt, uint32_t first, uint32_t count)
+{
+    uint32_t i, entries = 0;
+
+    for (i = first; i < first + count; i++) {
+        entries += gt->buckets[i].count;
+    }
+
+    return entries;
+}
+
+/*
+ * Ask for the entries of the next range of differing buckets, or finish.
+ * A range is an aligned power of 2 of differing buckets, so a checksum
+ * prefix selects it; it is doubled while it stays aligned, all of it
+ * differs and its entries stay within LOCI_GENTABLE_RESYNC_RANGE_ENTRIES.
+ */
+static int
+entries_request(loci_gentable_resync_t *rs)
+{
+    loci_gentable_t *gt = rs->gt;
+    of_bsn_gentable_entry_desc_stats_request_t *msg;
+    of_checksum_128_t checksum, mask;
+    uint32_t first, count, entries, more, i;
+    int ones, rv;
+
+    for (first = rs->bucket; first < rs->buckets_size; first++) {
+        if (differs(rs, first)) {
+            break;
+        }
+    }
+    if (first >= rs->buckets_size) {
+        rs->state = LOCI_GENTABLE_RESYNC_DONE;
+        return OF_ERROR_NONE;
+    }
+
+    count = 1;
+    entries = gt->buckets[first].count;
+    while ((first & (2 * count - 1)) == 0 && first + 2 * count <=
+           rs->buckets_size) {
+        for (i = first + count; i < first + 2 * count; i++) {
+            if (!differs(rs, i)) {
+                break;
+            }
+        }
+        if (i < first + 2 * count) {
+            break;
+        }
+        more = range_entries(gt, first + count, count);
+        if (entries + more > LOCI_GENTABLE_RESYNC_RANGE_ENTRIES) {
+            break;
+        }
+        entries += more;
+        count *= 2;
+    }
+
+    if ((rv = seen_reset(rs, entries)) < 0) {
+        return rv;
+    }
+
+    /* The top bucket_bits - log2(count) bits select the range */
+    ones = gt->bucket_bits;
+    for (i = count; i > 1; i /= 2) {
+        ones--;
+    }
+    MEMSET(&checksum, 0, sizeof(checksum));
+    MEMSET(&mask, 0, sizeof(mask));
+    if (ones > 0) {
+        checksum.hi = (uint64_t)first << (64 - gt->bucket_bits);
+        mask.hi = ~0ULL << (64 - ones);
+    }
+
+    if ((msg = of_bsn_gentable_entry_desc_stats_request_new(rs->version)) ==
+        NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    rs->request_xid = rs->xid++;
+    of_bsn_gentable_entry_desc_stats_request_xid_set(msg, rs->request_xid);
+    of_bsn_gentable_entry_desc_stats_request_table_id_set(msg, gt->table_id);
+    of_bsn_gentable_entry_desc_stats_request_checksum_set(msg, checksum);
+    of_bsn_gentable_entry_desc_stats_request_checksum_mask_set(msg, mask);
+    rs->first = first;
+    rs->count = count;
+    rs->bucket = first + count;
+    rs->requests++;
+    rs->state = LOCI_GENTABLE_RESYNC_ENTRIES;
+
+    return send_msg(rs, msg);
+}
+
+/****************************************************************
+ * Replies from the switch
+ ****************************************************************/
+
+static int
+bucket_stats_handle(loci_gentable_resync_t *rs,
+                    of_bsn_gentable_bucket_stats_reply_t *reply)
+{
+    of_list_bsn_gentable_bucket_stats_entry_t list;
+    of_bsn_gentable_bucket_stats_entry_t elt;
+    of_checksum_128_t checksum, want;
+    uint16_t flags;
+    int rv;
+
+    of_bsn_gentable_bucket_stats_reply_entries_bind(reply, &list);
+    OF_LIST_BSN_GENTABLE_BUCKET_STATS_ENTRY_ITER(&list, &elt, rv) {
+        if (rs->bucket >= rs->buckets_size) {
+            return OF_ERROR_PARSE;
+        }
+        of_bsn_gentable_bucket_stats_entry_checksum_get(&elt, &checksum);
+        want = rs->gt->buckets[rs->bucket].checksum;
+        if (checksum.hi != want.hi || checksum.lo != want.lo) {
+            differ_set(rs, rs->bucket);
+        }
+        rs->bucket++;
+    }
+
+    of_bsn_gentable_bucket_stats_reply_flags_get(reply, &flags);
+    if (flags & OF_STATS_REPLY_FLAG_REPLY_MORE) {
+        return OF_ERROR_NONE;
+    }
+
+    /* Buckets the switch left out can't be trusted */
+    for (; rs->bucket < rs->buckets_size; rs->bucket++) {
+        differ_set(rs, rs->bucket);
+    }
+    rs->bucket = 0;
+
+    return entries_request(rs);
+}
+
+/* Add the desired entries of the range the switch didn't have */
+static int
+range_finish(loci_gentable_resync_t *rs)
+{
+    loci_gentable_entry_t *entry;
+    uint32_t i;
+    int rv;
+
+    if (rs->seen_count == range_entries(rs->gt, rs->first, rs->count)) {
+        return OF_ERROR_NONE;
+    }
+    for (i = rs->first; i < rs->first + rs->count; i++) {
+        for (entry = rs->gt->buckets[i].entries; entry != NULL;
+             entry = entry->bucket_next) {
+            if (*seen_find(rs, entry) == NULL &&
+                (rv = entry_add_send(rs, entry)) < 0) {
+                return rv;
+            }
+        }
+    }
+
+    return OF_ERROR_NONE;
+}
+
+static int
+entry_desc_handle(loci_gentable_resync_t *rs,
+                  of_bsn_gentable_entry_desc_stats_reply_t *reply)
+{
+    of_list_bsn_gentable_entry_desc_stats_entry_t list;
+    of_bsn_gentable_entry_desc_stats_entry_t desc;
+    of_list_bsn_tlv_t key;
+    of_checksum_128_t checksum;
+    loci_gentable_entry_t *entry;
+    uint16_t flags;
+    int rv;
+
+    of_bsn_gentable_entry_desc_stats_reply_entries_bind(reply, &list);
+    OF_LIST_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY_ITER(&list, &desc, rv) {
+        of_bsn_gentable_entry_desc_stats_entry_key_bind(&desc, &key);
+        of_bsn_gentable_entry_desc_stats_entry_checksum_get(&desc, &checksum);
+        entry = loci_gentable_lookup(rs->gt, OF_OBJECT_BUFFER_INDEX(&key, 0),
+                                     key.length);
+        if (entry == NULL) {
+            rv = entry_delete_send(rs, &key);
+        } else if (entry->checksum.hi != checksum.hi ||
+                   entry->checksum.lo != checksum.lo) {
+            seen_add(rs, entry);
+            rv = entry_add_send(rs, entry);
+        } else {
+            seen_add(rs, entry);
+            rv = OF_ERROR_NONE;
+        }
+        if (rv < 0) {
+            return rv;
+        }
+    }
+
+    of_bsn_gentable_entry_desc_stats_reply_flags_get(reply, &flags);
+    if (flags & OF_STATS_REPLY_FLAG_REPLY_MORE) {
+        return OF_ERROR_NONE;
+    }
+    if ((rv = range_finish(rs)) < 0) {
+        return rv;
+    }
+
+    return entries_request(rs);
+}
+
+/**
+ * Start a resync
+ * @param rs The resync
+ * @param gt The desired table
+ * @param version Version of the messages, 1.3 or later
+ * @param xid Xid of the first message; each message takes the next
+ * @param send Function taking the messages for the switch
+ * @param cookie Passed to send
+ * @returns 0, OF_ERROR_VERSION, OF_ERROR_RESOURCE or an error of send
+ *
+ * Sends a set_buckets_size and a bucket stats request.  On error the
+ * resync must still be cleaned up.
+ */
+int
+loci_gentable_resync_start(loci_gentable_resync_t *rs, loci_gentable_t *gt,
+                           of_version_t version, uint32_t xid,
+                           loci_gentable_resync_send_f send, void *cookie)
+{
+    of_object_t *msg;
+    int rv;
+
+    MEMSET(rs, 0, sizeof(*rs));
+    rs->gt = gt;
+    rs->version = version;
+    rs->send = send;
+    rs->cookie = cookie;
+    rs->xid = xid;
+    rs->buckets_size = gt->buckets_size;
+    rs->state = LOCI_GENTABLE_RESYNC_DONE;
+    if (version < OF_VERSION_1_3) {
+        return OF_ERROR_VERSION;
+    }
+
+    rs->differ = MALLOC(DIFFER_WORDS(rs->buckets_size) * sizeof(*rs->differ));
+    if (rs->differ == NULL ||
+        (rs->tlvs = of_list_bsn_tlv_new(version)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(rs->differ, 0, DIFFER_WORDS(rs->buckets_size) * sizeof(*rs->differ));
+
+    if ((msg = of_bsn_gentable_set_buckets_size_new(version)) != NULL) {
+        of_bsn_gentable_set_buckets_size_xid_set(msg, rs->xid++);
+        of_bsn_gentable_set_buckets_size_table_id_set(msg, gt->table_id);
+        of_bsn_gentable_set_buckets_size_buckets_size_set(msg,
+                                                          gt->buckets_size);
+    }
+    if ((rv = send_msg(rs, msg)) < 0) {
+        return rv;
+    }
+
+    if ((msg = of_bsn_gentable_bucket_stats_request_new(version)) != NULL) {
+        rs->request_xid = rs->xid++;
+        of_bsn_gentable_bucket_stats_request_xid_set(msg, rs->request_xid);
+        of_bsn_gentable_bucket_stats_request_table_id_set(msg, gt->table_id);
+    }
+    if ((rv = send_msg(rs, msg)) < 0) {
+        return rv;
+    }
+    rs->state = LOCI_GENTABLE_RESYNC_BUCKETS;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Take a reply from the switch
+ * @param rs The resync
+ * @param reply A bucket stats or entry desc stats reply
+ * @returns 0; OF_ERROR_COMPAT for messages the resync isn't waiting for,
+ * which it ignores; OF_ERROR_PARAM if the desired table's buckets size
+ * changed; OF_ERROR_PARSE for more buckets than asked for; or an error
+ * of sending
+ *
+ * Replies are told apart by xid, so other traffic may be passed in too.
+ * After an error other than OF_ERROR_COMPAT the resync is done.
+ */
+int
+loci_gentable_resync_handle(loci_gentable_resync_t *rs, of_object_t *reply)
+{
+    uint32_t xid;
+    int rv;
+
+    if (rs->state == LOCI_GENTABLE_RESYNC_BUCKETS &&
+        reply->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY) {
+        of_bsn_gentable_bucket_stats_reply_xid_get(reply, &xid);
+    } else if (rs->state == LOCI_GENTABLE_RESYNC_ENTRIES &&
+               reply->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY) {
+        of_bsn_gentable_entry_desc_stats_reply_xid_get(reply, &xid);
+    } else {
+        return OF_ERROR_COMPAT;
+    }
+    if (xid != rs->request_xid) {
+        return OF_ERROR_COMPAT;
+    }
+
+    if (rs->gt->buckets_size != rs->buckets_size) {
+        rv = OF_ERROR_PARAM;
+    } else if (rs->state == LOCI_GENTABLE_RESYNC_BUCKETS) {
+        rv = bucket_stats_handle(rs, reply);
+    } else {
+        rv = entry_desc_handle(rs, reply);
+    }
+    if (rv < 0) {
+        rs->state = LOCI_GENTABLE_RESYNC_DONE;
+    }
+
+    return rv;
+}
+
+/**
+ * Free what a resync holds
+ */
+void
+loci_gentable_resync_cleanup(loci_gentable_resync_t *rs)
+{
+    FREE(rs->differ);
+    FREE(rs->seen);
+    if (rs->tlvs != NULL) {
+        of_object_delete(rs->tlvs);
+    }
+    MEMSET(rs, 0, sizeof(*rs));
+}
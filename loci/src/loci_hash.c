@@ -0,0 +1,435 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_hash.c
+ *
+ * Hashes of bytes, and of matches and objects in canonical form.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_hash.h>
+#include <loci/loci_binlog.h>
+#include <loci/loci_match_fields.h>
+
+#define MATCH_WORDS (sizeof(of_match_fields_t) / sizeof(uint64_t))
+
+/* Records of most objects fit on the stack */
+#define OBJECT_RECORD_BYTES 1024
+#define OBJECT_RECORD_MAX (16 * 1024 * 1024)
+
+static inline uint64_t
+read64(const uint8_t *p)
+{
+    uint64_t v;
+
+    MEMCPY(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+static inline uint32_t
+read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    MEMCPY(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap32(v);
+#endif
+    return v;
+}
+
+static inline uint64_t
+merge_lane(uint64_t hash, uint64_t lane)
+{
+    hash ^= loci_hash_round(0, lane);
+    return hash * LOCI_HASH_PRIME1 + LOCI_HASH_PRIME4;
+}
+
+/**
+ * Hash bytes
+ * @param data The bytes
+ * @param len Number of bytes
+ * @param seed Seed of the hash
+ * @returns The hash
+ */
+uint64_t
+loci_hash_bytes(const void *data, int len, uint64_t seed)
+{
+    const uint8_t *p = data;
+    const uint8_t *end = p + len;
+    uint64_t v1, v2, v3, v4, hash;
+
+    if (len >= 32) {
+        v1 = seed + LOCI_HASH_PRIME1 + LOCI_HASH_PRIME2;
+        v2 = seed + LOCI_HASH_PRIME2;
+        v3 = seed;
+        v4 = seed - LOCI_HASH_PRIME1;
+        do {
+            v1 = loci_hash_round(v1, read64(p));
+            v2 = loci_hash_round(v2, read64(p + 8));
+            v3 = loci_hash_round(v3, read64(p + 16));
+            v4 = loci_hash_round(v4, read64(p + 24));
+            p += 32;
+        } while (end - p >= 32);
+        hash = loci_hash_rotl(v1, 1) + loci_hash_rotl(v2, 7) +
+            loci_hash_rotl(v3, 12) + loci_hash_rotl(v4, 18);
+        hash = merge_lane(hash, v1);
+        hash = merge_lane(hash, v2);
+        hash = merge_lane(hash, v3);
+        hash = merge_lane(hash, v4);
+    } else {
+        hash = loci_hash_start(seed);
+    }
+    hash += (uint64_t)len;
+
+    for (; end - p >= 8; p += 8) {
+        hash = loci_hash_word(hash, read64(p));
+    }
+    if (end - p >= 4) {
+        hash ^= (uint64_t)read32(p) * LOCI_HASH_PRIME1;
+        hash = loci_hash_rotl(hash, 23) * LOCI_HASH_PRIME2 + LOCI_HASH_PRIME3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        hash ^= *p * LOCI_HASH_PRIME5;
+        hash = loci_hash_rotl(hash, 11) * LOCI_HASH_PRIME1;
+    }
+
+    return loci_hash_finish(hash);
+}
+
+/****************************************************************
+ * Matches
+ ****************************************************************/
+
+#define VLAN_VID_OFFSET offsetof(of_match_fields_t, vlan_vid)
+#define IP_DSCP_OFFSET offsetof(of_match_fields_t, ip_dscp)
+
+/*
+ * Bring vlan_vid and ip_dscp, in the words holding them, to the form
+ * of OpenFlow 1.2 and later
+ */
+static void
+canon_fixup(of_version_t version, int word, uint64_t *value, uint64_t *mask)
+{
+    uint8_t *v = (uint8_t *)value;
+    uint8_t *m = (uint8_t *)mask;
+    uint16_t vid, vid_mask;
+    int offset;
+
+    if (word == VLAN_VID_OFFSET / 8) {
+        offset = VLAN_VID_OFFSET % 8;
+        MEMCPY(&vid, v + offset, sizeof(vid));
+        MEMCPY(&vid_mask, m + offset, sizeof(vid_mask));
+        /* OpenFlow 1.0 and 1.1: untagged is 0xffff, and no present bit */
+        if (version < OF_VERSION_1_2 && vid_mask != 0) {
+            if ((vid & vid_mask) ==
+                (OF_MATCH_UNTAGGED_VLAN_ID(version) & vid_mask)) {
+                vid = 0;
+            } else {
+                vid |= 0x1000;
+                vid_mask |= 0x1000;
+            }
+        }
+        vid_mask &= 0x1fff;
+        MEMCPY(v + offset, &vid, sizeof(vid));
+        MEMCPY(m + offset, &vid_mask, sizeof(vid_mask));
+    }
+
+    if (word == IP_DSCP_OFFSET / 8) {
+        offset = IP_DSCP_OFFSET % 8;
+        /* OpenFlow 1.0 and 1.1 match the ToS byte */
+        if (version < OF_VERSION_1_2) {
+            v[offset] >>= 2;
+            m[offset] >>= 2;
+        }
+        m[offset] &= 0x3f;
+    }
+}
+
+/* A word of a match in canonical form */
+static inline void
+canon_word(const of_match_t *match, int word, uint64_t *value,
+           uint64_t *mask)
+{
+    uint64_t v, m, valid;
+
+    MEMCPY(&v, (const uint8_t *)&match->fields + word * 8, sizeof(v));
+    MEMCPY(&m, (const uint8_t *)&match->masks + word * 8, sizeof(m));
+    MEMCPY(&valid, loci_match_field_valid_bytes + word * 8, sizeof(valid));
+    m &= valid;
+    if (word == VLAN_VID_OFFSET / 8 || word == IP_DSCP_OFFSET / 8) {
+        canon_fixup(match->version, word, &v, &m);
+    }
+    *value = v & m;
+    *mask = m;
+}
+
+/*
+ * The time slot map of an ODU signal id is behind a pointer; it counts
+ * where the match covers the signal id
+ */
+static const uint8_t *
+odu_tsmap(const of_match_t *match, int *len)
+{
+    const of_odu_sig_id_t *mask = &match->masks.exp_odu_sigid;
+    const of_odu_sig_id_t *value = &match->fields.exp_odu_sigid;
+
+    if ((mask->tpn == 0 && mask->length == 0 && mask->tsmap == NULL) ||
+        value->tsmap == NULL) {
+        *len = 0;
+        return NULL;
+    }
+    *len = value->length;
+    return value->tsmap;
+}
+
+/**
+ * Canonical form of a match
+ * @param match The match
+ * @param canon Filled with the canonical form
+ *
+ * The version of canon is that of match, or 1.2 for 1.0 and 1.1
+ * matches, whose encoding it uses.  Pointers to ODU time slot maps are
+ * kept.
+ */
+void
+loci_match_canonical(const of_match_t *match, of_match_t *canon)
+{
+    uint64_t fields[MATCH_WORDS], masks[MATCH_WORDS];
+    int i;
+
+    for (i = 0; i < (int)MATCH_WORDS; i++) {
+        canon_word(match, i, &fields[i], &masks[i]);
+    }
+    MEMCPY(&canon->fields, fields, sizeof(canon->fields));
+    MEMCPY(&canon->masks, masks, sizeof(canon->masks));
+    canon->fields.exp_odu_sigid.tsmap = match->fields.exp_odu_sigid.tsmap;
+    canon->masks.exp_odu_sigid.tsmap = match->masks.exp_odu_sigid.tsmap;
+    canon->version = match->version < OF_VERSION_1_2 ?
+        OF_VERSION_1_2 : match->version;
+}
+
+/**
+ * Hash a match in canonical form
+ * @param match The match
+ * @param seed Seed of the hash
+ * @returns The hash
+ *
+ * Matches equal by loci_match_equal have the same hash.  Only the
+ * words of the fields a mask covers are hashed, the indices, values
+ * and masks of those words in three lanes merged as loci_hash_bytes
+ * merges its stripes.
+ */
+uint64_t
+loci_match_hash(const of_match_t *match, uint64_t seed)
+{
+    const uint8_t *tsmap;
+    uint64_t lane_index = seed + LOCI_HASH_PRIME1 + LOCI_HASH_PRIME2;
+    uint64_t lane_value = seed + LOCI_HASH_PRIME2;
+    uint64_t lane_mask = seed;
+    uint64_t value, mask, hash;
+    int i, len;
+
+    for (i = 0; i < (int)MATCH_WORDS; i++) {
+        canon_word(match, i, &value, &mask);
+        if (mask != 0) {
+            lane_index = loci_hash_round(lane_index, i);
+            lane_value = loci_hash_round(lane_value, value);
+            lane_mask = loci_hash_round(lane_mask, mask);
+        }
+    }
+    hash = loci_hash_rotl(lane_index, 1) + loci_hash_rotl(lane_value, 7) +
+        loci_hash_rotl(lane_mask, 12);
+    hash = merge_lane(hash, lane_index);
+    hash = merge_lane(hash, lane_value);
+    hash = merge_lane(hash, lane_mask);
+
+    if ((tsmap = odu_tsmap(match, &len)) != NULL) {
+        hash = loci_hash_word(hash, loci_hash_bytes(tsmap, len, 0));
+    }
+
+    return loci_hash_finish(hash);
+}
+
+/**
+ * Compare matches in canonical form
+ * @param a A match
+ * @param b A match
+ * @returns Whether the matches cover the same packets
+ *
+ * Unlike of_match_eq, bits outside the masks and the version don't
+ * count, so the same flow in two versions is equal.
+ */
+int
+loci_match_equal(const of_match_t *a, const of_match_t *b)
+{
+    const uint8_t *tsmap_a, *tsmap_b;
+    uint64_t value_a, mask_a, value_b, mask_b;
+    int i, len_a, len_b;
+
+    for (i = 0; i < (int)MATCH_WORDS; i++) {
+        canon_word(a, i, &value_a, &mask_a);
+        canon_word(b, i, &value_b, &mask_b);
+        if (value_a != value_b || mask_a != mask_b) {
+            return 0;
+        }
+    }
+
+    tsmap_a = odu_tsmap(a, &len_a);
+    tsmap_b = odu_tsmap(b, &len_b);
+    return len_a == len_b &&
+        (len_a == 0 || MEMCMP(tsmap_a, tsmap_b, len_a) == 0);
+}
+
+/****************************************************************
+ * Objects
+ ****************************************************************/
+
+/*
+ * Rebuild the match of a binary log field.  Its fields are numbered
+ * by their index in loci_match_fields, as test_hash_field_order checks.
+ */
+static void
+match_from_binlog(const loci_binlog_field_t *field, of_match_t *match)
+{
+    const loci_match_field_t *desc;
+    const uint8_t *p = field->data;
+    const uint8_t *end = p + field->bytes;
+    int width;
+
+    MEMSET(match, 0, sizeof(*match));
+    match->version = field->version;
+
+    for (; end - p >= 2; p += 2 + 2 * width) {
+        width = p[1];
+        if (p[0] >= LOCI_MATCH_FIELD_COUNT) {
+            continue;
+        }
+        desc = &loci_match_fields[p[0]];
+        if (width != desc->size) {
+            continue;
+        }
+        MEMCPY(LOCI_MATCH_FIELD_VALUE(match, desc), p + 2, width);
+        MEMCPY(LOCI_MATCH_FIELD_MASK(match, desc), p + 2 + width, width);
+    }
+}
+
+static int
+object_record_hash(const uint8_t *buf, int len, int skip_xid, uint64_t seed,
+                   uint64_t *hash)
+{
+    loci_binlog_record_t rec;
+    loci_binlog_cursor_t cursor;
+    loci_binlog_field_t field;
+    of_match_t match;
+    uint64_t h = loci_hash_start(seed);
+    int rv;
+
+    if ((rv = loci_binlog_record_open(buf, len, &rec, &cursor)) < 0) {
+        return rv;
+    }
+    h = loci_hash_word(h, rec.object_id);
+
+    while ((rv = loci_binlog_next(&cursor, &field)) == OF_ERROR_NONE) {
+        if (skip_xid) {
+            skip_xid = 0;
+            if (field.tag == LOCI_BINLOG_TAG_U32) {
+                continue;
+            }
+        }
+        h = loci_hash_word(h, field.tag);
+        switch (field.tag) {
+        case LOCI_BINLOG_TAG_U8:
+        case LOCI_BINLOG_TAG_U16:
+        case LOCI_BINLOG_TAG_U32:
+        case LOCI_BINLOG_TAG_U64:
+        case LOCI_BINLOG_TAG_IPV4:
+            h = loci_hash_word(h, field.value);
+            break;
+        case LOCI_BINLOG_TAG_MAC:
+        case LOCI_BINLOG_TAG_IPV6:
+        case LOCI_BINLOG_TAG_BYTES:
+        case LOCI_BINLOG_TAG_STRING:
+        case LOCI_BINLOG_TAG_BITMAP:
+            h = loci_hash_word(h, loci_hash_bytes(field.data, field.bytes, 0));
+            break;
+        case LOCI_BINLOG_TAG_MATCH:
+            match_from_binlog(&field, &match);
+            h = loci_hash_word(h, loci_match_hash(&match, 0));
+            break;
+        case LOCI_BINLOG_TAG_OBJECT:
+            h = loci_hash_word(h, field.object_id);
+            break;
+        default:
+            break;
+        }
+    }
+    if (rv != OF_ERROR_RANGE) {
+        return rv;
+    }
+
+    *hash = loci_hash_finish(h);
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Hash an object in canonical form
+ * @param obj The object
+ * @param flags LOCI_HASH_*
+ * @param seed Seed of the hash
+ * @param hash Set to the hash
+ * @returns An error code
+ *
+ * With LOCI_HASH_IGNORE_XID the xid of a message is left out.  The
+ * members are read into a binary log record on the stack, or in
+ * memory allocated for the call if the object is large.
+ */
+int
+loci_object_hash(of_object_t *obj, uint32_t flags, uint64_t seed,
+                 uint64_t *hash)
+{
+    uint8_t stack_buf[OBJECT_RECORD_BYTES];
+    uint8_t *buf = stack_buf;
+    loci_stream_t s;
+    int size = sizeof(stack_buf);
+    int skip_xid, rv;
+
+    skip_xid = (flags & LOCI_HASH_IGNORE_XID) &&
+        obj->object_id != OF_OBJECT &&
+        obj->object_id < OF_MESSAGE_OBJECT_COUNT;
+
+    for (;;) {
+        loci_stream_init(&s, buf, size, NULL, NULL);
+        rv = of_object_binlog(&s, obj);
+        if (rv != OF_ERROR_RESOURCE || size >= OBJECT_RECORD_MAX) {
+            break;
+        }
+
+        /* Members take a few bytes more than on the wire */
+        if (buf != stack_buf) {
+            FREE(buf);
+        }
+        size = size * 2 > 4 * obj->length ? size * 2 : 4 * obj->length;
+        if ((buf = MALLOC(size)) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+    }
+
+    if (rv == OF_ERROR_NONE) {
+        rv = object_record_hash(buf, s.pos, skip_xid, seed, hash);
+    }
+    if (buf != stack_buf) {
+        FREE(buf);
+    }
+
+    return rv;
+}
@@ -14,6 +14,8 @@
 #define __LOCI_INT_H__
 
 #include <loci/loci.h>
+#include <loci/loci_stats.h>
+#include <loci/loci_trace.h>
 
 #if __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 5)
 #define UNREACHABLE() __builtin_unreachable()
@@ -21,6 +23,45 @@
 #define UNREACHABLE()
 #endif
 
+/**
+ * Called by the generated of_<cls>_new functions once the new object
+ * has been initialized
+ */
+#define LOCI_OBJECT_NEW_HOOK(obj) do {          \
+        LOCI_STATS_OBJECT_NEW(obj);             \
+        LOCI_TRACE_OBJECT(object_new, obj);     \
+    } while (0)
+
+/**
+ * Make room for bytes more at the end of a list, for writing its
+ * elements in bulk
+ * @param list The list, at the end of its wire buffer
+ * @param bytes Number of bytes to add
+ * @returns Where the new bytes go, or NULL if the buffer can't grow
+ *
+ * The lengths of the list and its parents are updated.  Unlike
+ * of_wire_buffer_grow, the new bytes are not zeroed; the caller
+ * writes all of them.
+ */
+static inline uint8_t *
+loci_list_extend(of_object_t *list, int bytes)
+{
+    uint8_t *data;
+    int end;
+
+    if (!of_object_can_grow(list, list->length + bytes)) {
+        return NULL;
+    }
+    data = OF_OBJECT_BUFFER_INDEX(list, list->length);
+    end = OF_OBJECT_ABSOLUTE_OFFSET(list, list->length + bytes);
+    if (end > WBUF_CURRENT_BYTES(list->wbuf)) {
+        list->wbuf->current_bytes = end;
+    }
+    of_object_parent_length_update(list, bytes);
+
+    return data;
+}
+
 /****************************************************************
  * Special case macros for calculating variable lengths and offsets
  ****************************************************************/
@@ -0,0 +1,208 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_json.c
+ *
+ * Datatype helpers for the generated JSON serializers.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_json.h>
+
+static const char hex_digits[] = "0123456789abcdef";
+
+/**
+ * Emit a JSON string, escaping as required
+ * @param str The characters; need not be NUL terminated
+ * @param max_len Stop after this many characters if no NUL is seen
+ *
+ * Control bytes and bytes from 0x80 up, which needn't be UTF-8, are
+ * written as \u00XX escapes of the same value.
+ */
+
+void
+loci_json_string(loci_stream_t *s, const char *str, int max_len)
+{
+    const char *start = str;
+    const char *end;
+    uint8_t *out;
+    unsigned char c;
+
+    end = memchr(str, 0, max_len);
+    if (end == NULL) {
+        end = str + max_len;
+    }
+
+    loci_stream_putc(s, '"');
+    while (str < end) {
+        c = (unsigned char)*str;
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') {
+            str++;
+            continue;
+        }
+        loci_stream_write(s, start, str - start);
+        if (c == '"' || c == '\\') {
+            loci_stream_putc(s, '\\');
+            loci_stream_putc(s, c);
+        } else if ((out = loci_stream_reserve(s, 6)) != NULL) {
+            MEMCPY(out, "\\u00", 4);
+            out[4] = hex_digits[c >> 4];
+            out[5] = hex_digits[c & 0xf];
+            loci_stream_advance(s, 6);
+        }
+        start = ++str;
+    }
+    loci_stream_write(s, start, str - start);
+    loci_stream_putc(s, '"');
+}
+
+void
+loci_json_octets(loci_stream_t *s, const uint8_t *data, int len)
+{
+    loci_stream_putc(s, '"');
+    loci_stream_hex(s, data, len);
+    loci_stream_putc(s, '"');
+}
+
+void
+loci_json_mac(loci_stream_t *s, const of_mac_addr_t *mac)
+{
+    uint8_t *out;
+    int i;
+
+    if ((out = loci_stream_reserve(s, 19)) == NULL) {
+        return;
+    }
+    *out++ = '"';
+    for (i = 0; i < OF_MAC_ADDR_BYTES; i++) {
+        *out++ = hex_digits[mac->addr[i] >> 4];
+        *out++ = hex_digits[mac->addr[i] & 0xf];
+        *out++ = (i == OF_MAC_ADDR_BYTES - 1) ? '"' : ':';
+    }
+    loci_stream_advance(s, 19);
+}
+
+void
+loci_json_ipv4(loci_stream_t *s, uint32_t ipv4)
+{
+    loci_stream_putc(s, '"');
+    loci_stream_dec(s, ipv4 >> 24);
+    loci_stream_putc(s, '.');
+    loci_stream_dec(s, (ipv4 >> 16) & 0xff);
+    loci_stream_putc(s, '.');
+    loci_stream_dec(s, (ipv4 >> 8) & 0xff);
+    loci_stream_putc(s, '.');
+    loci_stream_dec(s, ipv4 & 0xff);
+    loci_stream_putc(s, '"');
+}
+
+/* Uncompressed form, same layout as LOCI_SHOW_ipv6 */
+void
+loci_json_ipv6(loci_stream_t *s, const of_ipv6_t *ipv6)
+{
+    uint8_t *out;
+    int i;
+
+    if ((out = loci_stream_reserve(s, 41)) == NULL) {
+        return;
+    }
+    *out++ = '"';
+    for (i = 0; i < OF_IPV6_BYTES; i++) {
+        *out++ = hex_digits[ipv6->addr[i] >> 4];
+        *out++ = hex_digits[ipv6->addr[i] & 0xf];
+        if ((i & 1) && i != OF_IPV6_BYTES - 1) {
+            *out++ = ':';
+        }
+    }
+    *out = '"';
+    loci_stream_advance(s, 41);
+}
+
+static void
+json_word(uint8_t *out, uint64_t word)
+{
+    int i;
+
+    for (i = 15; i >= 0; i--) {
+        out[i] = hex_digits[word & 0xf];
+        word >>= 4;
+    }
+}
+
+/**
+ * Emit words[count - 1] .. words[0] as one hex string
+ *
+ * A word at a time, so a bitmap_512 fits a stream of
+ * LOCI_STREAM_MIN_SIZE.
+ */
+
+void
+loci_json_words(loci_stream_t *s, const uint64_t *words, int count)
+{
+    uint8_t *out;
+    int i;
+
+    loci_stream_lit(s, "\"0x");
+    for (i = count - 1; i >= 0; i--) {
+        if ((out = loci_stream_reserve(s, 16)) == NULL) {
+            return;
+        }
+        json_word(out, words[i]);
+        loci_stream_advance(s, 16);
+    }
+    loci_stream_putc(s, '"');
+}
+
+void
+loci_json_u128(loci_stream_t *s, uint64_t hi, uint64_t lo)
+{
+    uint64_t words[2];
+
+    words[0] = lo;
+    words[1] = hi;
+    loci_json_words(s, words, 2);
+}
+
+void
+loci_json_circuit_sig_id(loci_stream_t *s, const of_circuit_sig_id_t *sig_id)
+{
+    loci_stream_lit(s, "{\"grid_type\":");
+    loci_stream_dec(s, sig_id->grid_type);
+    loci_stream_lit(s, ",\"channel_spacing\":");
+    loci_stream_dec(s, sig_id->channel_spacing);
+    loci_stream_lit(s, ",\"channel_number\":");
+    loci_stream_dec(s, sig_id->channel_number);
+    loci_stream_lit(s, ",\"spectral_width\":");
+    loci_stream_dec(s, sig_id->spectral_width);
+    loci_stream_putc(s, '}');
+}
+
+void
+loci_json_och_sig_id(loci_stream_t *s, const of_och_sig_id_t *sig_id)
+{
+    loci_stream_lit(s, "{\"grid_type\":");
+    loci_stream_dec(s, sig_id->grid_type);
+    loci_stream_lit(s, ",\"channel_spacing\":");
+    loci_stream_dec(s, sig_id->channel_spacing);
+    loci_stream_lit(s, ",\"n\":");
+    loci_stream_dec(s, sig_id->n);
+    loci_stream_lit(s, ",\"m\":");
+    loci_stream_dec(s, sig_id->m);
+    loci_stream_putc(s, '}');
+}
+
+void
+loci_json_odu_sig_id(loci_stream_t *s, const of_odu_sig_id_t *sig_id)
+{
+    loci_stream_lit(s, "{\"tpn\":");
+    loci_stream_dec(s, sig_id->tpn);
+    loci_stream_lit(s, ",\"tsmap\":");
+    loci_json_octets(s, sig_id->tsmap,
+                     sig_id->tsmap != NULL ? sig_id->length : 0);
+    loci_stream_putc(s, '}');
+}
@@ -0,0 +1,286 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_match_fields.c
+ *
+ * Descriptors for the fields of of_match_fields_t
+ *
+ * Generated by scripts/gen_match_fields.py from loci_obj_show.c and
+ * of_match.h.  Edit the script, not this file.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_match_fields.h>
+
+#define MATCH_FIELD(_name, _kind) \
+    { #_name, sizeof(#_name) - 1, LOCI_MATCH_FIELD_##_kind, \
+      offsetof(of_match_fields_t, _name), \
+      sizeof(((of_match_fields_t *)0)->_name) }
+
+const loci_match_field_t loci_match_fields[LOCI_MATCH_FIELD_COUNT] = {
+    MATCH_FIELD(in_port, U32),
+    MATCH_FIELD(in_phy_port, U32),
+    MATCH_FIELD(metadata, U64),
+    MATCH_FIELD(eth_dst, MAC),
+    MATCH_FIELD(eth_src, MAC),
+    MATCH_FIELD(eth_type, U16),
+    MATCH_FIELD(vlan_vid, U16),
+    MATCH_FIELD(vlan_pcp, U8),
+    MATCH_FIELD(ip_dscp, U8),
+    MATCH_FIELD(ip_ecn, U8),
+    MATCH_FIELD(ip_proto, U8),
+    MATCH_FIELD(ipv4_src, IPV4),
+    MATCH_FIELD(ipv4_dst, IPV4),
+    MATCH_FIELD(tcp_src, U16),
+    MATCH_FIELD(tcp_dst, U16),
+    MATCH_FIELD(udp_src, U16),
+    MATCH_FIELD(udp_dst, U16),
+    MATCH_FIELD(sctp_src, U16),
+    MATCH_FIELD(sctp_dst, U16),
+    MATCH_FIELD(icmpv4_type, U8),
+    MATCH_FIELD(icmpv4_code, U8),
+    MATCH_FIELD(arp_op, U16),
+    MATCH_FIELD(arp_spa, IPV4),
+    MATCH_FIELD(arp_tpa, IPV4),
+    MATCH_FIELD(arp_sha, MAC),
+    MATCH_FIELD(arp_tha, MAC),
+    MATCH_FIELD(ipv6_src, IPV6),
+    MATCH_FIELD(ipv6_dst, IPV6),
+    MATCH_FIELD(ipv6_flabel, U32),
+    MATCH_FIELD(icmpv6_type, U8),
+    MATCH_FIELD(icmpv6_code, U8),
+    MATCH_FIELD(ipv6_nd_target, IPV6),
+    MATCH_FIELD(ipv6_nd_sll, MAC),
+    MATCH_FIELD(ipv6_nd_tll, MAC),
+    MATCH_FIELD(mpls_label, U32),
+    MATCH_FIELD(mpls_tc, U8),
+    MATCH_FIELD(mpls_bos, U8),
+    MATCH_FIELD(tunnel_id, U64),
+    MATCH_FIELD(ipv6_exthdr, U16),
+    MATCH_FIELD(pbb_uca, U8),
+    MATCH_FIELD(circuit_och_sigtype_basic, U8),
+    MATCH_FIELD(circuit_och_sigid_basic, CIRCUIT_SIG_ID),
+    MATCH_FIELD(och_sigatt_basic, U32),
+    MATCH_FIELD(tunnel_ipv4_src, IPV4),
+    MATCH_FIELD(tunnel_ipv4_dst, IPV4),
+    MATCH_FIELD(tun_gbp_id, U16),
+    MATCH_FIELD(tun_gbp_flags, U8),
+    MATCH_FIELD(tun_flags, U16),
+    MATCH_FIELD(tun_gpe_np, U8),
+    MATCH_FIELD(tun_gpe_flags, U8),
+    MATCH_FIELD(nsp, U32),
+    MATCH_FIELD(nsi, U8),
+    MATCH_FIELD(nsh_c1, U32),
+    MATCH_FIELD(nsh_c2, U32),
+    MATCH_FIELD(nsh_c3, U32),
+    MATCH_FIELD(nsh_c4, U32),
+    MATCH_FIELD(nsh_mdtype, U8),
+    MATCH_FIELD(nsh_np, U8),
+    MATCH_FIELD(encap_eth_src, MAC),
+    MATCH_FIELD(encap_eth_dst, MAC),
+    MATCH_FIELD(encap_eth_type, U16),
+    MATCH_FIELD(bsn_in_ports_128, BITMAP_128),
+    MATCH_FIELD(bsn_lag_id, U32),
+    MATCH_FIELD(bsn_vrf, U32),
+    MATCH_FIELD(bsn_global_vrf_allowed, U8),
+    MATCH_FIELD(bsn_l3_interface_class_id, U32),
+    MATCH_FIELD(bsn_l3_src_class_id, U32),
+    MATCH_FIELD(bsn_l3_dst_class_id, U32),
+    MATCH_FIELD(bsn_egr_port_group_id, U32),
+    MATCH_FIELD(bsn_udf0, U32),
+    MATCH_FIELD(bsn_udf1, U32),
+    MATCH_FIELD(bsn_udf2, U32),
+    MATCH_FIELD(bsn_udf3, U32),
+    MATCH_FIELD(bsn_udf4, U32),
+    MATCH_FIELD(bsn_udf5, U32),
+    MATCH_FIELD(bsn_udf6, U32),
+    MATCH_FIELD(bsn_udf7, U32),
+    MATCH_FIELD(bsn_tcp_flags, U16),
+    MATCH_FIELD(bsn_vlan_xlate_port_group_id, U32),
+    MATCH_FIELD(bsn_l2_cache_hit, U8),
+    MATCH_FIELD(bsn_in_ports_512, BITMAP_512),
+    MATCH_FIELD(bsn_ingress_port_group_id, U32),
+    MATCH_FIELD(bsn_vxlan_network_id, U32),
+    MATCH_FIELD(bsn_inner_eth_dst, MAC),
+    MATCH_FIELD(bsn_inner_eth_src, MAC),
+    MATCH_FIELD(bsn_inner_vlan_vid, U16),
+    MATCH_FIELD(bsn_vfi, U16),
+    MATCH_FIELD(bsn_ip_fragmentation, U8),
+    MATCH_FIELD(circuit_och_sigtype, U8),
+    MATCH_FIELD(circuit_och_sigid, CIRCUIT_SIG_ID),
+    MATCH_FIELD(och_sigatt, U32),
+    MATCH_FIELD(exp_odu_sigtype, U8),
+    MATCH_FIELD(exp_odu_sigid, ODU_SIG_ID),
+    MATCH_FIELD(exp_och_sigtype, U8),
+    MATCH_FIELD(ofdpa_qos_index, U8),
+    MATCH_FIELD(exp_och_sigid, OCH_SIG_ID),
+    MATCH_FIELD(ofdpa_mpls_l2_port, U32),
+    MATCH_FIELD(ofdpa_ovid, U16),
+    MATCH_FIELD(ofdpa_mpls_type, U16),
+    MATCH_FIELD(ovs_tcp_flags, U16),
+};
+
+/*
+ * Bytes of of_match_fields_t that hold field values: not the padding
+ * between fields, nor the tsmap pointer of an ODU signal id
+ */
+#define VALID_BYTES(_name) \
+    [offsetof(of_match_fields_t, _name) ... \
+     offsetof(of_match_fields_t, _name) + \
+     sizeof(((of_match_fields_t *)0)->_name) - 1] = 0xff
+#define TSMAP_BYTES(_name) \
+    [offsetof(of_match_fields_t, _name) + offsetof(of_odu_sig_id_t, tsmap) ... \
+     offsetof(of_match_fields_t, _name) + offsetof(of_odu_sig_id_t, tsmap) + \
+     sizeof(uint8_t *) - 1] = 0
+
+const uint8_t loci_match_field_valid_bytes[sizeof(of_match_fields_t)] = {
+    VALID_BYTES(in_port),
+    VALID_BYTES(in_phy_port),
+    VALID_BYTES(metadata),
+    VALID_BYTES(eth_dst),
+    VALID_BYTES(eth_src),
+    VALID_BYTES(eth_type),
+    VALID_BYTES(vlan_vid),
+    VALID_BYTES(vlan_pcp),
+    VALID_BYTES(ip_dscp),
+    VALID_BYTES(ip_ecn),
+    VALID_BYTES(ip_proto),
+    VALID_BYTES(ipv4_src),
+    VALID_BYTES(ipv4_dst),
+    VALID_BYTES(tcp_src),
+    VALID_BYTES(tcp_dst),
+    VALID_BYTES(udp_src),
+    VALID_BYTES(udp_dst),
+    VALID_BYTES(sctp_src),
+    VALID_BYTES(sctp_dst),
+    VALID_BYTES(icmpv4_type),
+    VALID_BYTES(icmpv4_code),
+    VALID_BYTES(arp_op),
+    VALID_BYTES(arp_spa),
+    VALID_BYTES(arp_tpa),
+    VALID_BYTES(arp_sha),
+    VALID_BYTES(arp_tha),
+    VALID_BYTES(ipv6_src),
+    VALID_BYTES(ipv6_dst),
+    VALID_BYTES(ipv6_flabel),
+    VALID_BYTES(icmpv6_type),
+    VALID_BYTES(icmpv6_code),
+    VALID_BYTES(ipv6_nd_target),
+    VALID_BYTES(ipv6_nd_sll),
+    VALID_BYTES(ipv6_nd_tll),
+    VALID_BYTES(mpls_label),
+    VALID_BYTES(mpls_tc),
+    VALID_BYTES(mpls_bos),
+    VALID_BYTES(tunnel_id),
+    VALID_BYTES(ipv6_exthdr),
+    VALID_BYTES(pbb_uca),
+    VALID_BYTES(circuit_och_sigtype_basic),
+    VALID_BYTES(circuit_och_sigid_basic),
+    VALID_BYTES(och_sigatt_basic),
+    VALID_BYTES(tunnel_ipv4_src),
+    VALID_BYTES(tunnel_ipv4_dst),
+    VALID_BYTES(tun_gbp_id),
+    VALID_BYTES(tun_gbp_flags),
+    VALID_BYTES(tun_flags),
+    VALID_BYTES(tun_gpe_np),
+    VALID_BYTES(tun_gpe_flags),
+    VALID_BYTES(nsp),
+    VALID_BYTES(nsi),
+    VALID_BYTES(nsh_c1),
+    VALID_BYTES(nsh_c2),
+    VALID_BYTES(nsh_c3),
+    VALID_BYTES(nsh_c4),
+    VALID_BYTES(nsh_mdtype),
+    VALID_BYTES(nsh_np),
+    VALID_BYTES(encap_eth_src),
+    VALID_BYTES(encap_eth_dst),
+    VALID_BYTES(encap_eth_type),
+    VALID_BYTES(bsn_in_ports_128),
+    VALID_BYTES(bsn_lag_id),
+    VALID_BYTES(bsn_vrf),
+    VALID_BYTES(bsn_global_vrf_allowed),
+    VALID_BYTES(bsn_l3_interface_class_id),
+    VALID_BYTES(bsn_l3_src_class_id),
+    VALID_BYTES(bsn_l3_dst_class_id),
+    VALID_BYTES(bsn_egr_port_group_id),
+    VALID_BYTES(bsn_udf0),
+    VALID_BYTES(bsn_udf1),
+    VALID_BYTES(bsn_udf2),
+    VALID_BYTES(bsn_udf3),
+    VALID_BYTES(bsn_udf4),
+    VALID_BYTES(bsn_udf5),
+    VALID_BYTES(bsn_udf6),
+    VALID_BYTES(bsn_udf7),
+    VALID_BYTES(bsn_tcp_flags),
+    VALID_BYTES(bsn_vlan_xlate_port_group_id),
+    VALID_BYTES(bsn_l2_cache_hit),
+    VALID_BYTES(bsn_in_ports_512),
+    VALID_BYTES(bsn_ingress_port_group_id),
+    VALID_BYTES(bsn_vxlan_network_id),
+    VALID_BYTES(bsn_inner_eth_dst),
+    VALID_BYTES(bsn_inner_eth_src),
+    VALID_BYTES(bsn_inner_vlan_vid),
+    VALID_BYTES(bsn_vfi),
+    VALID_BYTES(bsn_ip_fragmentation),
+    VALID_BYTES(circuit_och_sigtype),
+    VALID_BYTES(circuit_och_sigid),
+    VALID_BYTES(och_sigatt),
+    VALID_BYTES(exp_odu_sigtype),
+    VALID_BYTES(exp_odu_sigid),
+    TSMAP_BYTES(exp_odu_sigid),
+    VALID_BYTES(exp_och_sigtype),
+    VALID_BYTES(ofdpa_qos_index),
+    VALID_BYTES(exp_och_sigid),
+    VALID_BYTES(ofdpa_mpls_l2_port),
+    VALID_BYTES(ofdpa_ovid),
+    VALID_BYTES(ofdpa_mpls_type),
+    VALID_BYTES(ovs_tcp_flags),
+};
+
+/* Indices into loci_match_fields sorted by name */
+static const uint8_t by_name[LOCI_MATCH_FIELD_COUNT] = {
+    21, 24, 22, 25, 23, 68, 64, 61, 80, 81, 83, 84, 85, 87, 79, 67, 65, 66,
+    62, 77, 69, 70, 71, 72, 73, 74, 75, 76, 86, 78, 63, 82, 89, 41, 88, 40,
+    59, 58, 60, 3, 4, 5, 95, 93, 92, 91, 20, 19, 30, 29, 1, 0, 8, 9, 10, 12,
+    11, 27, 38, 28, 32, 31, 33, 26, 2, 36, 34, 35, 52, 53, 54, 55, 56, 57,
+    51, 50, 90, 42, 96, 98, 97, 94, 99, 39, 18, 17, 14, 13, 47, 46, 45, 49,
+    48, 37, 44, 43, 16, 15, 7, 6,
+};
+
+/**
+ * Look up a match field by name
+ * @param name The field name as printed by loci_show_match; need not
+ * be NUL terminated
+ * @param len Length of name
+ * @returns The field descriptor or NULL if there is no such field
+ */
+
+const loci_match_field_t *
+loci_match_field_lookup(const char *name, int len)
+{
+    const loci_match_field_t *field;
+    int lo = 0, hi = LOCI_MATCH_FIELD_COUNT - 1, mid, cmp;
+
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        field = &loci_match_fields[by_name[mid]];
+        cmp = strncmp(name, field->name, len);
+        if (cmp == 0 && field->name_len != len) {
+            cmp = -1;
+        }
+        if (cmp == 0) {
+            return field;
+        } else if (cmp < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    return NULL;
+}
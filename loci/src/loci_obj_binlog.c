@@ -0,0 +1,35667 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ *
+ * Generated by scripts/gen_obj_binlog.py from loci_obj_show.c and
+ * of_match.h.  Edit the script, not this file.
+ *
+ * Source file for binary log serialization of objects.
+ *
+ */
+
+#define DISABLE_WARN_UNUSED_RESULT
+#include <loci/loci.h>
+#include <loci/loci_binlog.h>
+#include <loci/loci_obj_binlog.h>
+
+static void
+unknown_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    loci_binlog_bytes(s, LOCI_BINLOG_TAG_BYTES,
+                      OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+}
+
+void
+of_aggregate_stats_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_aggregate_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_reply_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_flow_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_aggregate_stats_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_match_t match;
+    uint8_t val8;
+    of_port_no_t port_no;
+
+    of_aggregate_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_aggregate_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_aggregate_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bad_action_error_msg_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_action_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_action_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_action_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_request_error_msg_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_request_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_request_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_request_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_barrier_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_barrier_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_clear_data_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_get_reply_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_request_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_interfaces_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_interface_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_get_interfaces_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_get_interfaces_reply_interfaces_bind(obj, &list);
+    OF_LIST_BSN_INTERFACE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_get_interfaces_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_interfaces_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_ip_mask_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_ip_mask_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_ip_mask_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_ip_mask_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_ip_mask_reply_index_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_get_ip_mask_reply_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_get_ip_mask_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_ip_mask_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_ip_mask_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_ip_mask_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_ip_mask_request_index_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_get_l2_table_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+
+    of_bsn_get_l2_table_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_l2_table_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_l2_table_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_l2_table_reply_l2_table_enable_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_get_l2_table_reply_l2_table_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_get_l2_table_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_l2_table_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_l2_table_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_l2_table_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_mirroring_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_reply_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_get_mirroring_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_request_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_hybrid_get_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+
+    of_bsn_hybrid_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_hybrid_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_hybrid_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_hybrid_get_reply_hybrid_enable_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_hybrid_get_reply_hybrid_version_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_hybrid_get_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_hybrid_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_hybrid_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_hybrid_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_pdu_rx_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_rx_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_rx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_timeout_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_rx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_pdu_rx_timeout_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_timeout_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_timeout_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_timeout_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_tx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_tx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_tx_interval_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_tx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_set_ip_mask_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_set_ip_mask_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_ip_mask_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_ip_mask_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_ip_mask_index_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_ip_mask_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_set_l2_table_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+
+    of_bsn_set_l2_table_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_l2_table_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_l2_table_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_l2_table_reply_l2_table_enable_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_l2_table_reply_l2_table_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_l2_table_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_l2_table_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+
+    of_bsn_set_l2_table_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_l2_table_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_l2_table_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_l2_table_request_l2_table_enable_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_l2_table_request_l2_table_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_set_mirroring_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_set_mirroring_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_mirroring_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_set_pktin_suppression_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_pktin_suppression_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_pktin_suppression_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_bsn_set_pktin_suppression_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_enabled_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_pktin_suppression_request_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_bsn_shell_command_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_shell_command_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_shell_command_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_shell_command_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_shell_command_service_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_shell_command_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_shell_output_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_shell_output_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_shell_output_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_shell_output_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_shell_output_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_shell_status_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_shell_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_shell_status_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_shell_status_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_shell_status_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_create_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_bsn_vport_t bsn_vport;
+
+    of_bsn_virtual_port_create_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_request_vport_bind(obj, &bsn_vport);
+    loci_binlog_object(s, &bsn_vport);
+}
+
+void
+of_bsn_virtual_port_remove_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_remove_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_request_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_desc_stats_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+    of_serial_num_t ser_num;
+
+    of_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_desc_stats_reply_mfr_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_hw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_sw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_serial_num_get(obj, &ser_num);
+    LOCI_BINLOG_ser_num(s, ser_num);
+
+    of_desc_stats_reply_dp_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_desc_stats_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_echo_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_reply_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_echo_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_features_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    of_list_port_desc_t list;
+    of_object_t elt;
+    int rv;
+
+    of_features_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_datapath_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_features_reply_n_buffers_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_features_reply_n_tables_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_features_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_actions_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_features_reply_ports_bind(obj, &list);
+    OF_LIST_PORT_DESC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_features_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_features_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_flow_add_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_match_t match;
+    uint64_t val64;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_add_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_add_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_add_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_add_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_match_t match;
+    uint64_t val64;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_delete_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_strict_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_match_t match;
+    uint64_t val64;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_delete_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_strict_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_mod_failed_error_msg_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_flow_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_flow_modify_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_match_t match;
+    uint64_t val64;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_modify_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_modify_strict_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_match_t match;
+    uint64_t val64;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_modify_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_strict_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_removed_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_match_t match;
+    uint64_t val64;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_flow_removed_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_removed_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_removed_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_removed_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_flow_removed_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_flow_stats_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_flow_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_reply_entries_bind(obj, &list);
+    OF_LIST_FLOW_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_stats_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_match_t match;
+    uint8_t val8;
+    of_port_no_t port_no;
+
+    of_flow_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_get_config_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_get_config_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_get_config_reply_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_get_config_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_hello_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_hello_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_hello_failed_error_msg_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_hello_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_hello_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_hello_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_nicira_controller_role_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_nicira_controller_role_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_nicira_controller_role_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_nicira_controller_role_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_nicira_controller_role_reply_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_nicira_controller_role_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_nicira_controller_role_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_nicira_controller_role_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_nicira_controller_role_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_nicira_controller_role_request_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_packet_in_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_packet_in_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_in_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_in_total_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_packet_in_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_packet_in_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_packet_in_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_packet_out_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+    of_octets_t octets;
+
+    of_packet_out_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_out_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_out_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_out_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    of_packet_out_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_mod_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+
+    of_port_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_mod_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_advertise_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_port_mod_failed_error_msg_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_port_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_stats_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_stats_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_stats_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_port_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_port_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_port_status_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_desc_t port_desc;
+
+    of_port_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_port_status_desc_bind(obj, &port_desc);
+    loci_binlog_object(s, &port_desc);
+}
+
+void
+of_queue_get_config_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_packet_queue_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_reply_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_get_config_reply_queues_bind(obj, &list);
+    OF_LIST_PACKET_QUEUE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_get_config_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_queue_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_request_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_queue_op_failed_error_msg_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_queue_op_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_op_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_queue_op_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_queue_stats_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_queue_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_stats_reply_entries_bind(obj, &list);
+    OF_LIST_QUEUE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_stats_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_queue_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_queue_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_request_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_set_config_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_set_config_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_set_config_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_set_config_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_table_mod_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_table_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_table_stats_reply_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_stats_request_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_table_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_bsn_checksum_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_checksum_128_t checksum_128;
+
+    of_action_bsn_checksum_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_checksum_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_checksum_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_action_bsn_mirror_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_action_bsn_mirror_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_mirror_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_dest_port_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_vlan_tag_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_copy_stage_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_bsn_set_tunnel_dst_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_bsn_set_tunnel_dst_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_enqueue_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint32_t val32;
+
+    of_action_enqueue_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_action_enqueue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_nicira_dec_ttl_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_dec_ttl_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_dec_ttl_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_move_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_move_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_move_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_n_bits_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_dst_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_nicira_move_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_nicira_pop_nsh_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_pop_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_pop_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_push_nsh_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_push_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_push_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_resubmit_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_nicira_resubmit_table_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_table_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_table_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_output_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint16_t val16;
+
+    of_action_output_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_action_output_max_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_set_dl_dst_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_action_set_dl_dst_dl_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_action_set_dl_src_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_action_set_dl_src_dl_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_action_set_nw_dst_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_nw_dst_nw_addr_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_set_nw_src_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_nw_src_nw_addr_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_set_nw_tos_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_nw_tos_nw_tos_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_tp_dst_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_set_tp_dst_tp_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_set_tp_src_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_set_tp_src_tp_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_set_vlan_pcp_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_vlan_pcp_vlan_pcp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_vlan_vid_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_set_vlan_vid_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_strip_vlan_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_interface_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    of_ipv4_t ipv4;
+
+    of_bsn_interface_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_interface_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_bsn_interface_ipv4_addr_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_interface_ipv4_netmask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_vport_l2gre_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_ipv4_t ipv4;
+    uint8_t val8;
+    of_port_name_t port_name;
+
+    of_bsn_vport_l2gre_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_loopback_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_local_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_nh_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_src_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dst_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dscp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_vpn_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_rate_limit_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bsn_vport_q_in_q_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_name_t port_name;
+
+    of_bsn_vport_q_in_q_port_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_q_in_q_ingress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_ingress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_flow_stats_entry_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_match_t match;
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_entry_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_flow_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_entry_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_match_v1_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_wc_bmap_t wc_bmap;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    uint16_t val16;
+    uint8_t val8;
+    of_ipv4_t ipv4;
+
+    of_match_v1_wildcards_get(obj, &wc_bmap);
+    LOCI_BINLOG_wc_bmap(s, wc_bmap);
+
+    of_match_v1_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_match_v1_eth_src_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_match_v1_eth_dst_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_match_v1_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_match_v1_vlan_pcp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_match_v1_eth_type_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_match_v1_ip_dscp_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_match_v1_ip_proto_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_match_v1_ipv4_src_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_match_v1_ipv4_dst_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_match_v1_tcp_src_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_match_v1_tcp_dst_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_packet_queue_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_queue_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_packet_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_queue_properties_bind(obj, &list);
+    OF_LIST_QUEUE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+
+    of_port_desc_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_desc_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_desc_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_port_desc_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_curr_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_advertised_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_supported_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_peer_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_port_stats_entry_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint64_t val64;
+
+    of_port_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_stats_entry_rx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_frame_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_over_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_crc_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_collisions_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_queue_prop_min_rate_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_min_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_stats_entry_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_queue_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_entry_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_table_stats_entry_OF_VERSION_1_0_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_table_name_t table_name;
+    of_wc_bmap_t wc_bmap;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_table_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_stats_entry_name_get(obj, &table_name);
+    LOCI_BINLOG_tab_name(s, table_name);
+
+    of_table_stats_entry_wildcards_get(obj, &wc_bmap);
+    LOCI_BINLOG_wc_bmap(s, wc_bmap);
+
+    of_table_stats_entry_max_entries_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_active_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_lookup_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_table_stats_entry_matched_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_aggregate_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_aggregate_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_reply_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_flow_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_aggregate_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_aggregate_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_aggregate_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_aggregate_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_aggregate_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_bad_action_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_action_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_action_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_action_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_instruction_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_instruction_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_instruction_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_instruction_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_match_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_match_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_match_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_match_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_request_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_request_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_request_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_request_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_barrier_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_barrier_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_clear_data_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_get_reply_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_request_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_interfaces_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_interface_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_get_interfaces_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_get_interfaces_reply_interfaces_bind(obj, &list);
+    OF_LIST_BSN_INTERFACE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_get_interfaces_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_interfaces_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_mirroring_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_reply_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_get_mirroring_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_request_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_pdu_rx_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_rx_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_rx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_timeout_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_rx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_pdu_rx_timeout_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_timeout_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_timeout_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_timeout_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_tx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_tx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_tx_interval_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_tx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_set_mirroring_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_set_mirroring_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_mirroring_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_set_pktin_suppression_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_pktin_suppression_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_pktin_suppression_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_bsn_set_pktin_suppression_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_enabled_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_pktin_suppression_request_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_bsn_virtual_port_create_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_create_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_bsn_vport_t bsn_vport;
+
+    of_bsn_virtual_port_create_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_request_vport_bind(obj, &bsn_vport);
+    loci_binlog_object(s, &bsn_vport);
+}
+
+void
+of_bsn_virtual_port_remove_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_remove_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_request_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_desc_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+    of_serial_num_t ser_num;
+
+    of_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_desc_stats_reply_mfr_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_hw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_sw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_serial_num_get(obj, &ser_num);
+    LOCI_BINLOG_ser_num(s, ser_num);
+
+    of_desc_stats_reply_dp_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_desc_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_echo_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_reply_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_echo_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_features_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    of_list_port_desc_t list;
+    of_object_t elt;
+    int rv;
+
+    of_features_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_datapath_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_features_reply_n_buffers_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_features_reply_n_tables_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_features_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_reserved_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_features_reply_ports_bind(obj, &list);
+    OF_LIST_PORT_DESC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_features_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_features_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_flow_add_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_add_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_add_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_add_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_add_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_add_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_strict_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_mod_failed_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_flow_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_flow_modify_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_modify_strict_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_removed_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint16_t val16;
+    uint8_t val8;
+    of_match_t match;
+
+    of_flow_removed_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_removed_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_removed_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_flow_removed_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_removed_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_flow_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_flow_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_reply_entries_bind(obj, &list);
+    OF_LIST_FLOW_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_flow_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_get_config_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_get_config_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_get_config_reply_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_get_config_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_group_add_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_add_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_add_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_add_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_delete_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_delete_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_delete_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_delete_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_group_mod_failed_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_group_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_group_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_group_modify_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_modify_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_modify_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_modify_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_group_stats_request_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_hello_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_hello_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_hello_failed_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_hello_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_hello_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_hello_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_packet_in_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint16_t val16;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_packet_in_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_in_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_in_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_packet_in_in_phy_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_packet_in_total_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_packet_in_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_packet_in_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_packet_in_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_packet_out_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+    of_octets_t octets;
+
+    of_packet_out_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_out_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_out_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_out_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    of_packet_out_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_mod_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+
+    of_port_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_mod_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_advertise_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_port_mod_failed_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_port_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_stats_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_port_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_port_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_port_status_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_desc_t port_desc;
+
+    of_port_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_port_status_desc_bind(obj, &port_desc);
+    loci_binlog_object(s, &port_desc);
+}
+
+void
+of_queue_get_config_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_packet_queue_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_reply_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_get_config_reply_queues_bind(obj, &list);
+    OF_LIST_PACKET_QUEUE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_get_config_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_queue_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_request_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_queue_op_failed_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_queue_op_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_op_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_queue_op_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_queue_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_queue_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_stats_reply_entries_bind(obj, &list);
+    OF_LIST_QUEUE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_queue_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_queue_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_request_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_set_config_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_set_config_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_set_config_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_set_config_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_switch_config_failed_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_switch_config_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_switch_config_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_switch_config_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_mod_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_table_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_table_mod_failed_error_msg_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_table_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_table_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_stats_reply_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_stats_request_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_table_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_bsn_checksum_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_checksum_128_t checksum_128;
+
+    of_action_bsn_checksum_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_checksum_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_checksum_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_action_bsn_mirror_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_action_bsn_mirror_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_mirror_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_dest_port_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_vlan_tag_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_copy_stage_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_bsn_set_tunnel_dst_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_bsn_set_tunnel_dst_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_copy_ttl_in_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_copy_ttl_out_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_mpls_ttl_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_nw_ttl_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_group_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_group_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_nicira_dec_ttl_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_dec_ttl_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_dec_ttl_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_move_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_move_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_move_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_n_bits_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_dst_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_nicira_move_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_nicira_pop_nsh_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_pop_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_pop_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_push_nsh_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_push_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_push_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_resubmit_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_nicira_resubmit_table_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_table_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_table_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_output_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint16_t val16;
+
+    of_action_output_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_action_output_max_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_pop_mpls_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_pop_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_pop_vlan_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_push_mpls_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_push_vlan_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_vlan_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_set_dl_dst_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_action_set_dl_dst_dl_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_action_set_dl_src_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_action_set_dl_src_dl_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_action_set_mpls_label_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_mpls_label_mpls_label_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_set_mpls_tc_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_mpls_tc_mpls_tc_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_action_set_mpls_ttl_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_mpls_ttl_mpls_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_nw_dst_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_nw_dst_nw_addr_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_set_nw_ecn_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_nw_ecn_nw_ecn_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_nw_src_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_nw_src_nw_addr_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_set_nw_tos_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_nw_tos_nw_tos_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_nw_ttl_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_nw_ttl_nw_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_queue_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_set_tp_dst_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_set_tp_dst_tp_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_set_tp_src_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_set_tp_src_tp_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_set_vlan_pcp_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_vlan_pcp_vlan_pcp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_vlan_vid_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_set_vlan_vid_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_interface_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    of_ipv4_t ipv4;
+
+    of_bsn_interface_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_interface_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_bsn_interface_ipv4_addr_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_interface_ipv4_netmask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_vport_l2gre_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_ipv4_t ipv4;
+    uint8_t val8;
+    of_port_name_t port_name;
+
+    of_bsn_vport_l2gre_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_loopback_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_local_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_nh_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_src_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dst_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dscp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_vpn_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_rate_limit_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bsn_vport_q_in_q_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_name_t port_name;
+
+    of_bsn_vport_q_in_q_port_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_q_in_q_ingress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_ingress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bucket_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_port_no_t port_no;
+    uint32_t val32;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bucket_weight_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bucket_watch_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bucket_watch_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bucket_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bucket_counter_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bucket_counter_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bucket_counter_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_flow_stats_entry_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_entry_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_entry_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_entry_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_desc_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_entry_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_entry_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    of_list_bucket_counter_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_ref_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_group_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_entry_bucket_stats_bind(obj, &list);
+    OF_LIST_BUCKET_COUNTER_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_apply_actions_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_apply_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_clear_actions_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_goto_table_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_instruction_goto_table_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_instruction_write_actions_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_write_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_write_metadata_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_instruction_write_metadata_metadata_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_instruction_write_metadata_metadata_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_match_v2_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_wc_bmap_t wc_bmap;
+    of_mac_addr_t mac_addr;
+    uint16_t val16;
+    uint8_t val8;
+    of_ipv4_t ipv4;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_match_v2_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_match_v2_wildcards_get(obj, &wc_bmap);
+    LOCI_BINLOG_wc_bmap(s, wc_bmap);
+
+    of_match_v2_eth_src_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_match_v2_eth_src_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_match_v2_eth_dst_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_match_v2_eth_dst_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_match_v2_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_match_v2_vlan_pcp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_match_v2_eth_type_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_match_v2_ip_dscp_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_match_v2_ip_proto_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_match_v2_ipv4_src_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_match_v2_ipv4_src_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_match_v2_ipv4_dst_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_match_v2_ipv4_dst_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_match_v2_tcp_src_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_match_v2_tcp_dst_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_match_v2_mpls_label_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_match_v2_mpls_tc_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_match_v2_metadata_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_match_v2_metadata_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_packet_queue_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_queue_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_packet_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_queue_properties_bind(obj, &list);
+    OF_LIST_QUEUE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+
+    of_port_desc_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_desc_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_desc_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_port_desc_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_curr_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_advertised_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_supported_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_peer_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_curr_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_max_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_stats_entry_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint64_t val64;
+
+    of_port_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_stats_entry_rx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_frame_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_over_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_crc_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_collisions_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_queue_prop_min_rate_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_min_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_stats_entry_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_queue_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_entry_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_table_stats_entry_OF_VERSION_1_1_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_table_name_t table_name;
+    of_wc_bmap_t wc_bmap;
+    of_match_bmap_t match_bmap;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_table_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_stats_entry_name_get(obj, &table_name);
+    LOCI_BINLOG_tab_name(s, table_name);
+
+    of_table_stats_entry_wildcards_get(obj, &wc_bmap);
+    LOCI_BINLOG_wc_bmap(s, wc_bmap);
+
+    of_table_stats_entry_match_get(obj, &match_bmap);
+    LOCI_BINLOG_match_bmap(s, match_bmap);
+
+    of_table_stats_entry_instructions_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_write_actions_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_apply_actions_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_max_entries_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_active_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_lookup_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_table_stats_entry_matched_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_aggregate_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_aggregate_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_reply_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_flow_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_aggregate_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_aggregate_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_aggregate_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_aggregate_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_aggregate_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_bad_action_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_action_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_action_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_action_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_instruction_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_instruction_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_instruction_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_instruction_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_match_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_match_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_match_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_match_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_request_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_request_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_request_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_request_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_barrier_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_barrier_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_clear_data_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_get_reply_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_request_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_interfaces_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_interface_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_get_interfaces_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_get_interfaces_reply_interfaces_bind(obj, &list);
+    OF_LIST_BSN_INTERFACE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_get_interfaces_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_interfaces_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_mirroring_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_reply_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_get_mirroring_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_request_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_pdu_rx_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_rx_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_rx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_timeout_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_rx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_pdu_rx_timeout_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_timeout_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_timeout_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_timeout_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_tx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_tx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_tx_interval_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_tx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_set_mirroring_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_set_mirroring_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_mirroring_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_set_pktin_suppression_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_pktin_suppression_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_pktin_suppression_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_bsn_set_pktin_suppression_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_enabled_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_pktin_suppression_request_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_bsn_virtual_port_create_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_create_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_bsn_vport_t bsn_vport;
+
+    of_bsn_virtual_port_create_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_request_vport_bind(obj, &bsn_vport);
+    loci_binlog_object(s, &bsn_vport);
+}
+
+void
+of_bsn_virtual_port_remove_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_remove_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_request_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_desc_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+    of_serial_num_t ser_num;
+
+    of_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_desc_stats_reply_mfr_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_hw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_sw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_serial_num_get(obj, &ser_num);
+    LOCI_BINLOG_ser_num(s, ser_num);
+
+    of_desc_stats_reply_dp_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_desc_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_echo_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_reply_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_echo_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_features_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    of_list_port_desc_t list;
+    of_object_t elt;
+    int rv;
+
+    of_features_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_datapath_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_features_reply_n_buffers_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_features_reply_n_tables_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_features_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_reserved_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_features_reply_ports_bind(obj, &list);
+    OF_LIST_PORT_DESC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_features_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_features_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_flow_add_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_add_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_add_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_add_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_add_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_add_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_strict_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_mod_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_flow_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_flow_modify_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_modify_strict_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_removed_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint16_t val16;
+    uint8_t val8;
+    of_match_t match;
+
+    of_flow_removed_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_removed_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_removed_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_flow_removed_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_removed_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_flow_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_flow_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_reply_entries_bind(obj, &list);
+    OF_LIST_FLOW_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_flow_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_get_config_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_get_config_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_get_config_reply_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_get_config_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_group_add_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_add_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_add_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_add_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_delete_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_delete_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_delete_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_delete_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_group_features_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_features_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_group_features_stats_reply_types_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_max_groups_all_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_select_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_indirect_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_ff_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_actions_all_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_select_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_indirect_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_ff_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_group_features_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_features_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_group_mod_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_group_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_group_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_group_modify_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_modify_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_modify_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_modify_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_group_stats_request_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_hello_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_hello_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_hello_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_hello_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_hello_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_hello_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_packet_in_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_match_t match;
+    of_octets_t octets;
+
+    of_packet_in_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_in_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_in_total_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_packet_in_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_packet_in_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_packet_in_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_packet_in_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_packet_out_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+    of_octets_t octets;
+
+    of_packet_out_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_out_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_out_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_out_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    of_packet_out_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_mod_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+
+    of_port_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_mod_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_advertise_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_port_mod_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_port_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_stats_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_port_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_port_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_port_status_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_desc_t port_desc;
+
+    of_port_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_port_status_desc_bind(obj, &port_desc);
+    loci_binlog_object(s, &port_desc);
+}
+
+void
+of_queue_get_config_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_packet_queue_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_reply_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_get_config_reply_queues_bind(obj, &list);
+    OF_LIST_PACKET_QUEUE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_get_config_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_queue_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_request_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_queue_op_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_queue_op_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_op_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_queue_op_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_queue_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_queue_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_stats_reply_entries_bind(obj, &list);
+    OF_LIST_QUEUE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_queue_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_queue_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_request_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_role_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_role_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_reply_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_reply_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_role_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_role_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_role_request_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_role_request_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_role_request_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_set_config_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_set_config_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_set_config_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_set_config_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_switch_config_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_switch_config_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_switch_config_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_switch_config_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_mod_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_table_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_table_mod_failed_error_msg_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_table_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_table_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_stats_reply_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_stats_request_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_table_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_bsn_checksum_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_checksum_128_t checksum_128;
+
+    of_action_bsn_checksum_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_checksum_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_checksum_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_action_bsn_mirror_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_action_bsn_mirror_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_mirror_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_dest_port_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_vlan_tag_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_copy_stage_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_bsn_set_tunnel_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_bsn_set_tunnel_dst_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_copy_ttl_in_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_copy_ttl_out_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_mpls_ttl_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_nw_ttl_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_group_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_group_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_nicira_dec_ttl_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_dec_ttl_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_dec_ttl_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_move_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_move_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_move_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_n_bits_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_dst_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_nicira_move_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_nicira_pop_nsh_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_pop_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_pop_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_push_nsh_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_push_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_push_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_resubmit_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_nicira_resubmit_table_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_table_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_table_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_output_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint16_t val16;
+
+    of_action_output_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_action_output_max_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_pop_mpls_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_pop_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_pop_vlan_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_push_mpls_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_push_vlan_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_vlan_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_set_field_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_oxm_t oxm;
+
+    of_action_set_field_field_bind(obj, &oxm);
+    loci_binlog_object(s, &oxm);
+}
+
+void
+of_action_set_mpls_ttl_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_mpls_ttl_mpls_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_nw_ttl_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_nw_ttl_nw_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_queue_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_interface_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    of_ipv4_t ipv4;
+
+    of_bsn_interface_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_interface_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_bsn_interface_ipv4_addr_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_interface_ipv4_netmask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_vport_l2gre_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_ipv4_t ipv4;
+    uint8_t val8;
+    of_port_name_t port_name;
+
+    of_bsn_vport_l2gre_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_loopback_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_local_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_nh_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_src_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dst_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dscp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_vpn_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_rate_limit_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bsn_vport_q_in_q_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_name_t port_name;
+
+    of_bsn_vport_q_in_q_port_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_q_in_q_ingress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_ingress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bucket_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_port_no_t port_no;
+    uint32_t val32;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bucket_weight_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bucket_watch_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bucket_watch_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bucket_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bucket_counter_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bucket_counter_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bucket_counter_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_flow_stats_entry_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_entry_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_entry_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_entry_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_desc_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_entry_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_entry_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    of_list_bucket_counter_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_ref_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_group_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_entry_bucket_stats_bind(obj, &list);
+    OF_LIST_BUCKET_COUNTER_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_apply_actions_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_apply_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_clear_actions_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_goto_table_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_instruction_goto_table_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_instruction_write_actions_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_write_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_write_metadata_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_instruction_write_metadata_metadata_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_instruction_write_metadata_metadata_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_match_v3_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_oxm_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_match_v3_oxm_list_bind(obj, &list);
+    OF_LIST_OXM_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_oxm_arp_op_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_arp_op_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_arp_op_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_arp_op_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_arp_op_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_arp_sha_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_sha_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_sha_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_sha_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_arp_sha_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_spa_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_spa_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_arp_spa_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_spa_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_arp_spa_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_arp_tha_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_tha_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_tha_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_tha_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_arp_tha_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_tpa_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_tpa_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_arp_tpa_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_tpa_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_arp_tpa_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_egr_port_group_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_egr_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_egr_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_egr_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_global_vrf_allowed_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_global_vrf_allowed_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_global_vrf_allowed_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_in_ports_128_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_128_t bitmap_128;
+
+    of_oxm_bsn_in_ports_128_value_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+}
+
+void
+of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_128_t bitmap_128;
+
+    of_oxm_bsn_in_ports_128_masked_value_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+
+    of_oxm_bsn_in_ports_128_masked_value_mask_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+}
+
+void
+of_oxm_bsn_in_ports_512_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_512_t bitmap_512;
+
+    of_oxm_bsn_in_ports_512_value_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+}
+
+void
+of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_512_t bitmap_512;
+
+    of_oxm_bsn_in_ports_512_masked_value_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+
+    of_oxm_bsn_in_ports_512_masked_value_mask_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+}
+
+void
+of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_ingress_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_ingress_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_ingress_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_ip_fragmentation_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_ip_fragmentation_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_ip_fragmentation_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_ip_fragmentation_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_l2_cache_hit_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_l2_cache_hit_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_l2_cache_hit_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_l2_cache_hit_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_dst_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_dst_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_dst_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_interface_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_interface_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_interface_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_src_class_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_src_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_src_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_src_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_lag_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_lag_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_lag_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_lag_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_lag_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_tcp_flags_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_tcp_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_bsn_tcp_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_bsn_udf0_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf0_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf0_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf0_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf0_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf1_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf1_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf1_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf1_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf1_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf2_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf2_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf2_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf2_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf2_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf3_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf3_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf3_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf3_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf3_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf4_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf4_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf4_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf4_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf4_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf5_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf5_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf5_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf5_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf5_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf6_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf6_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf6_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf6_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf6_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf7_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf7_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf7_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf7_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf7_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vlan_xlate_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vrf_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vrf_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vrf_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vrf_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vrf_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_encap_eth_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_encap_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_encap_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_type_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_encap_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_encap_eth_type_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_encap_eth_type_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_encap_eth_type_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_eth_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_type_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_eth_type_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_eth_type_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_eth_type_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_icmpv4_code_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv4_code_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_code_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv4_code_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv4_type_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv4_type_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_type_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv4_type_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv6_code_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv6_code_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_code_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv6_code_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv6_type_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv6_type_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_type_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv6_type_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_in_phy_port_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_phy_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_phy_port_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_phy_port_masked_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_oxm_in_phy_port_masked_value_mask_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_port_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_port_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_port_masked_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_oxm_in_port_masked_value_mask_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_ip_dscp_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_dscp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_dscp_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_dscp_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_dscp_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ip_ecn_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_ecn_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_ecn_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_ecn_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_ecn_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ip_proto_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_proto_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_proto_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_proto_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_proto_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ipv4_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_dst_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_ipv4_dst_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_src_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_ipv4_src_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv6_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_dst_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_dst_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_dst_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_flabel_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ipv6_flabel_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_ipv6_flabel_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ipv6_flabel_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ipv6_flabel_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_ipv6_nd_sll_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_sll_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_sll_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_ipv6_nd_sll_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_target_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_nd_target_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_nd_target_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_nd_target_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_nd_target_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_nd_tll_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_tll_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_tll_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_ipv6_nd_tll_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_src_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_src_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_src_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_metadata_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_metadata_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_oxm_metadata_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_metadata_masked_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_oxm_metadata_masked_value_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_oxm_mpls_label_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_mpls_label_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_mpls_label_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_mpls_label_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_mpls_label_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_mpls_tc_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_tc_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_mpls_tc_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_tc_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_mpls_tc_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsh_c1_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c1_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c1_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c1_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c1_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c2_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c2_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c2_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c2_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c2_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c3_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c3_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c3_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c3_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c3_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c4_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c4_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c4_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c4_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c4_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_mdtype_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_mdtype_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsh_mdtype_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_mdtype_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsh_mdtype_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsh_np_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_np_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsh_np_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_np_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsh_np_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsi_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsi_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsi_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsi_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsi_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsp_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsp_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsp_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsp_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsp_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_ovs_tcp_flags_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ovs_tcp_flags_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ovs_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ovs_tcp_flags_masked_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ovs_tcp_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_ovs_tcp_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_sctp_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_sctp_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_sctp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_sctp_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_sctp_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_sctp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tcp_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tcp_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tcp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tcp_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tcp_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tcp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_flags_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tun_flags_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tun_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_gbp_flags_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gbp_flags_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gbp_flags_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gbp_flags_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gbp_flags_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tun_gbp_id_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_gbp_id_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tun_gbp_id_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_gbp_id_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tun_gbp_id_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_gpe_flags_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_flags_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_flags_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_flags_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gpe_flags_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_np_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_np_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_np_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_np_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gpe_np_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tunnel_ipv4_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_dst_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_tunnel_ipv4_dst_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_src_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_tunnel_ipv4_src_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_udp_dst_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_udp_dst_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_udp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_udp_src_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_udp_src_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_udp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_vlan_pcp_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_vlan_pcp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_vlan_pcp_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_vlan_pcp_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_vlan_pcp_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_vlan_vid_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_vlan_vid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_vlan_vid_masked_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_vlan_vid_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_vlan_vid_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_packet_queue_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_queue_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_packet_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_queue_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_queue_properties_bind(obj, &list);
+    OF_LIST_QUEUE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+
+    of_port_desc_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_desc_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_desc_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_port_desc_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_curr_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_advertised_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_supported_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_peer_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_curr_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_max_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_stats_entry_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint64_t val64;
+
+    of_port_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_stats_entry_rx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_frame_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_over_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_crc_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_collisions_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_queue_prop_max_rate_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_max_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_prop_min_rate_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_min_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_stats_entry_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_queue_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_entry_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_table_stats_entry_OF_VERSION_1_2_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_table_name_t table_name;
+    of_match_bmap_t match_bmap;
+    of_wc_bmap_t wc_bmap;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_table_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_stats_entry_name_get(obj, &table_name);
+    LOCI_BINLOG_tab_name(s, table_name);
+
+    of_table_stats_entry_match_get(obj, &match_bmap);
+    LOCI_BINLOG_match_bmap(s, match_bmap);
+
+    of_table_stats_entry_wildcards_get(obj, &wc_bmap);
+    LOCI_BINLOG_wc_bmap(s, wc_bmap);
+
+    of_table_stats_entry_write_actions_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_apply_actions_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_write_setfields_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_stats_entry_apply_setfields_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_stats_entry_metadata_match_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_stats_entry_metadata_write_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_stats_entry_instructions_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_entry_max_entries_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_active_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_lookup_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_table_stats_entry_matched_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_aggregate_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_aggregate_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_reply_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_flow_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_aggregate_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_aggregate_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_aggregate_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_aggregate_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_aggregate_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_async_get_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_reply_packet_in_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_reply_packet_in_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_reply_port_status_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_reply_port_status_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_reply_flow_removed_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_reply_flow_removed_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_get_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_request_packet_in_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_request_packet_in_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_request_port_status_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_request_port_status_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_request_flow_removed_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_get_request_flow_removed_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_set_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_set_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_set_packet_in_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_set_packet_in_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_set_port_status_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_set_port_status_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_set_flow_removed_mask_equal_master_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_set_flow_removed_mask_slave_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bad_action_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_action_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_action_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_action_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_instruction_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_instruction_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_instruction_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_instruction_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_match_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_match_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_match_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_match_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_request_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_request_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_request_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_request_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_barrier_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_barrier_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_arp_idle_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_ipv4_t ipv4;
+
+    of_bsn_arp_idle_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_arp_idle_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_arp_idle_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_arp_idle_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_arp_idle_ipv4_addr_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_bw_clear_data_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_clear_data_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_get_reply_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_request_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_controller_connections_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_controller_connection_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_controller_connections_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_controller_connections_reply_connections_bind(obj, &list);
+    OF_LIST_BSN_CONTROLLER_CONNECTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_controller_connections_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_controller_connections_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_debug_counter_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_debug_counter_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_debug_counter_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_debug_counter_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_debug_counter_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_debug_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_debug_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_debug_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_DEBUG_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_debug_counter_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_debug_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_error_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+    of_octets_t octets;
+
+    of_bsn_error_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_error_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_error_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_error_err_msg_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_bsn_error_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_flow_checksum_bucket_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_flow_checksum_bucket_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_flow_checksum_bucket_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_flow_checksum_bucket_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_FLOW_CHECKSUM_BUCKET_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_bsn_flow_checksum_bucket_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_flow_checksum_bucket_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_flow_idle_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint16_t val16;
+    uint8_t val8;
+    of_match_t match;
+
+    of_bsn_flow_idle_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_bsn_flow_idle_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_flow_idle_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_flow_idle_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_get_reply_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_flow_idle_enable_get_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_set_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_flow_idle_enable_set_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_set_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_set_request_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_generic_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_generic_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_generic_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_generic_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENERIC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_generic_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_str64_t str64;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_generic_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_generic_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_generic_stats_request_name_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_stats_request_tlvs_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_bucket_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_bucket_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_bucket_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_bucket_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_BUCKET_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_bucket_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_bucket_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_bucket_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_bucket_stats_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_gentable_clear_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_clear_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_clear_reply_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_clear_reply_deleted_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_clear_reply_error_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_clear_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_clear_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_clear_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_clear_request_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    of_bsn_gentable_clear_request_checksum_mask_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_entry_add_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_add_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_add_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_add_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_entry_add_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_add_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_add_value_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_delete_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_delete_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_delete_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_delete_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_delete_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_entry_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_entry_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_entry_desc_stats_request_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    of_bsn_gentable_entry_desc_stats_request_checksum_mask_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_entry_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_entry_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_ENTRY_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_entry_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_stats_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_entry_stats_request_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    of_bsn_gentable_entry_stats_request_checksum_mask_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_set_buckets_size_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_set_buckets_size_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_set_buckets_size_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_set_buckets_size_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_set_buckets_size_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_set_buckets_size_buckets_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_interfaces_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_interface_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_get_interfaces_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_get_interfaces_reply_interfaces_bind(obj, &list);
+    OF_LIST_BSN_INTERFACE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_get_interfaces_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_interfaces_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_mirroring_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_reply_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_get_mirroring_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_request_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_get_switch_pipeline_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_desc_str_t desc_str;
+
+    of_bsn_get_switch_pipeline_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_switch_pipeline_reply_pipeline_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_get_switch_pipeline_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_switch_pipeline_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_image_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+
+    of_bsn_image_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_image_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_image_desc_stats_reply_image_checksum_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_bsn_image_desc_stats_reply_startup_config_checksum_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_image_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_image_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_image_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_lacp_convergence_notif_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+
+    of_bsn_lacp_convergence_notif_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_convergence_notif_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_convergence_notif_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lacp_convergence_notif_convergence_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_lacp_convergence_notif_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_lacp_convergence_notif_actor_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_actor_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_convergence_notif_actor_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_actor_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_actor_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_convergence_notif_partner_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_lacp_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_lacp_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_lacp_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_lacp_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_lacp_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_LACP_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_lacp_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_lacp_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_lacp_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_log_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_log_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_log_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_log_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_log_loglevel_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_log_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_command_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_lua_command_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_command_reply_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_command_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_lua_command_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_command_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_notification_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_lua_notification_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_notification_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_notification_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_notification_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_upload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_str64_t str64;
+    of_octets_t octets;
+
+    of_bsn_lua_upload_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_upload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_upload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_upload_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_lua_upload_filename_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    of_bsn_lua_upload_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_pdu_rx_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_rx_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_rx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_timeout_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_rx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_pdu_rx_timeout_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_timeout_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_timeout_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_timeout_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_tx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_tx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_tx_interval_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_tx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_port_counter_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_port_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_port_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_port_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_port_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_PORT_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_port_counter_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_bsn_port_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_port_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_port_counter_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_role_status_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint64_t val64;
+
+    of_bsn_role_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_role_status_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_role_status_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_role_status_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_role_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_bsn_role_status_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_bsn_set_aux_cxns_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_aux_cxns_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_num_aux_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_aux_cxns_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_aux_cxns_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_aux_cxns_request_num_aux_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_lacp_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_bsn_set_lacp_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_lacp_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_lacp_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_set_lacp_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+
+    of_bsn_set_lacp_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_lacp_request_enabled_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_lacp_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_set_lacp_request_actor_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_lacp_request_actor_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_set_lacp_request_actor_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_lacp_request_actor_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_lacp_request_actor_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_set_mirroring_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_set_mirroring_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_mirroring_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_set_pktin_suppression_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_pktin_suppression_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_pktin_suppression_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_bsn_set_pktin_suppression_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_enabled_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_pktin_suppression_request_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_bsn_set_switch_pipeline_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_switch_pipeline_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_switch_pipeline_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_switch_pipeline_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_desc_str_t desc_str;
+
+    of_bsn_set_switch_pipeline_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_switch_pipeline_request_pipeline_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_switch_pipeline_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_switch_pipeline_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_switch_pipeline_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_switch_pipeline_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_SWITCH_PIPELINE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_switch_pipeline_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_switch_pipeline_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_switch_pipeline_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_table_checksum_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_table_checksum_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_table_checksum_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_table_checksum_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_table_checksum_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_TABLE_CHECKSUM_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_table_checksum_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_table_checksum_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_table_checksum_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_table_set_buckets_size_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_table_set_buckets_size_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_set_buckets_size_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_set_buckets_size_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_table_set_buckets_size_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_table_set_buckets_size_buckets_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_time_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_bsn_time_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_time_reply_time_ms_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_time_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_time_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_create_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_bsn_vport_t bsn_vport;
+
+    of_bsn_virtual_port_create_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_request_vport_bind(obj, &bsn_vport);
+    loci_binlog_object(s, &bsn_vport);
+}
+
+void
+of_bsn_virtual_port_remove_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_remove_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_request_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_vlan_counter_clear_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_vlan_counter_clear_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_clear_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_clear_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vlan_counter_clear_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_vlan_counter_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_vlan_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vlan_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vlan_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vlan_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_VLAN_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_vlan_counter_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_vlan_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vlan_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vlan_counter_stats_request_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_vrf_counter_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_vrf_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vrf_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vrf_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vrf_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_VRF_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_vrf_counter_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_vrf_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vrf_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vrf_counter_stats_request_vrf_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_calient_flow_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_calient_flow_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_calient_flow_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_flow_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_calient_flow_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_flow_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_calient_flow_stats_reply_entries_bind(obj, &list);
+    OF_LIST_CALIENT_FLOW_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_calient_flow_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_calient_flow_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_flow_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_calient_flow_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_flow_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_calient_flow_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_flow_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_calient_flow_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_calient_flow_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_calient_flow_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_calient_flow_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_calient_port_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_calient_port_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_calient_port_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_calient_port_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_calient_port_desc_stats_reply_port_desc_bind(obj, &list);
+    OF_LIST_CALIENT_PORT_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_calient_port_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_calient_port_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_calient_port_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_calient_port_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_calient_port_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_calient_port_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_calient_port_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_calient_port_stats_reply_entries_bind(obj, &list);
+    OF_LIST_CALIENT_PORT_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_calient_port_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_calient_port_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_calient_port_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_calient_port_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_calient_port_status_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_calient_port_desc_stats_entry_t calient_port_desc_stats_entry;
+
+    of_calient_port_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_status_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_status_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_calient_port_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_calient_port_status_desc_bind(obj, &calient_port_desc_stats_entry);
+    loci_binlog_object(s, &calient_port_desc_stats_entry);
+}
+
+void
+of_circuit_port_status_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint64_t val64;
+
+    of_circuit_port_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_circuit_port_status_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_circuit_port_status_exp_type_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_circuit_port_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_circuit_port_status_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_circuit_port_status_lengths_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_circuit_port_status_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_circuit_port_status_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_circuit_port_status_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_circuit_port_status_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_circuit_port_status_ignore_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_circuit_ports_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_optical_t list;
+    of_object_t elt;
+    int rv;
+
+    of_circuit_ports_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_circuit_ports_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_circuit_ports_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_circuit_ports_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_circuit_ports_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_OPTICAL_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_circuit_ports_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_circuit_ports_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_circuit_ports_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_circuit_ports_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_circuit_ports_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+    of_serial_num_t ser_num;
+
+    of_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_desc_stats_reply_mfr_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_hw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_sw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_serial_num_get(obj, &ser_num);
+    LOCI_BINLOG_ser_num(s, ser_num);
+
+    of_desc_stats_reply_dp_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_echo_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_reply_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_echo_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_exp_port_adjacency_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_exp_port_adjacency_t list;
+    of_object_t elt;
+    int rv;
+
+    of_exp_port_adjacency_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_adjacency_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_exp_port_adjacency_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_adjacency_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_exp_port_adjacency_reply_entries_bind(obj, &list);
+    OF_LIST_EXP_PORT_ADJACENCY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_exp_port_adjacency_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_exp_port_adjacency_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_adjacency_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_exp_port_adjacency_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_adjacency_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_exp_port_desc_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_exp_port_t list;
+    of_object_t elt;
+    int rv;
+
+    of_exp_port_desc_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_desc_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_exp_port_desc_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_desc_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_exp_port_desc_reply_entries_bind(obj, &list);
+    OF_LIST_EXP_PORT_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_exp_port_desc_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_exp_port_desc_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_desc_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_exp_port_desc_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_desc_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_features_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+
+    of_features_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_datapath_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_features_reply_n_buffers_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_features_reply_n_tables_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_features_reply_auxiliary_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_features_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_reserved_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_features_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_features_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_flow_add_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_add_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_add_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_add_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_add_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_add_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_strict_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_mod_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_flow_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_flow_modify_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_modify_strict_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_removed_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint16_t val16;
+    uint8_t val8;
+    of_match_t match;
+
+    of_flow_removed_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_removed_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_removed_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_flow_removed_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_removed_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_flow_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_flow_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_reply_entries_bind(obj, &list);
+    OF_LIST_FLOW_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_flow_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_get_config_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_get_config_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_get_config_reply_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_get_config_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_group_add_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_add_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_add_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_add_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_delete_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_delete_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_delete_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_delete_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_group_features_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_features_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_group_features_stats_reply_types_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_max_groups_all_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_select_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_indirect_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_ff_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_actions_all_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_select_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_indirect_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_ff_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_group_features_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_features_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_group_mod_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_group_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_group_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_group_modify_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_modify_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_modify_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_modify_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_group_stats_request_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_hello_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_hello_elem_t list;
+    of_object_t elt;
+    int rv;
+
+    of_hello_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_hello_elements_bind(obj, &list);
+    OF_LIST_HELLO_ELEM_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_hello_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_hello_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_hello_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_hello_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_meter_config_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_meter_config_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_config_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_config_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_config_stats_reply_entries_bind(obj, &list);
+    OF_LIST_METER_CONFIG_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_config_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_meter_config_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_config_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_config_stats_request_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_meter_features_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_meter_features_t features;
+
+    of_meter_features_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_features_stats_reply_features_bind(obj, &features);
+    loci_binlog_object(s, &features);
+}
+
+void
+of_meter_features_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_meter_features_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_meter_mod_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_meter_band_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_mod_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_mod_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_mod_meters_bind(obj, &list);
+    OF_LIST_METER_BAND_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_mod_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_meter_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_meter_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_meter_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_meter_stats_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_METER_STATS_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_meter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_stats_request_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oplink_channel_power_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_oplink_channel_power_t list;
+    of_object_t elt;
+    int rv;
+
+    of_oplink_channel_power_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_channel_power_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_oplink_channel_power_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_channel_power_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_oplink_channel_power_reply_entries_bind(obj, &list);
+    OF_LIST_OPLINK_CHANNEL_POWER_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_oplink_channel_power_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oplink_channel_power_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_channel_power_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_oplink_channel_power_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_channel_power_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oplink_port_power_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_oplink_port_power_t list;
+    of_object_t elt;
+    int rv;
+
+    of_oplink_port_power_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_port_power_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_oplink_port_power_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_port_power_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_oplink_port_power_reply_entries_bind(obj, &list);
+    OF_LIST_OPLINK_PORT_POWER_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_oplink_port_power_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oplink_port_power_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_port_power_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_oplink_port_power_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_port_power_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oplink_port_power_set_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oplink_port_power_set_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_port_power_set_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oplink_port_power_set_exp_type_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oplink_port_power_set_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oplink_port_power_set_power_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_packet_in_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    uint64_t val64;
+    of_match_t match;
+    of_octets_t octets;
+
+    of_packet_in_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_in_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_in_total_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_packet_in_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_packet_in_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_packet_in_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_packet_in_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_packet_in_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_packet_out_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+    of_octets_t octets;
+
+    of_packet_out_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_out_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_out_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_out_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    of_packet_out_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_desc_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_desc_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_DESC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_port_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_port_mod_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+
+    of_port_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_mod_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_advertise_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_port_mod_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_port_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_stats_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_port_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_port_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_port_status_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_desc_t port_desc;
+
+    of_port_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_port_status_desc_bind(obj, &port_desc);
+    loci_binlog_object(s, &port_desc);
+}
+
+void
+of_queue_get_config_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_packet_queue_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_reply_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_get_config_reply_queues_bind(obj, &list);
+    OF_LIST_PACKET_QUEUE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_get_config_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_queue_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_get_config_request_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_queue_op_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_queue_op_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_op_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_queue_op_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_queue_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_queue_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_stats_reply_entries_bind(obj, &list);
+    OF_LIST_QUEUE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_queue_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_queue_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_request_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_role_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_role_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_reply_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_reply_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_role_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_role_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_role_request_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_role_request_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_role_request_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_sdwn_add_client_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_mac_addr_t mac_addr;
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_ieee80211_ht_cap_t ht_cap;
+    of_ieee80211_vht_cap_t vht_cap;
+    of_desc_str_t desc_str;
+    of_list_bsn_tlv_data_t list;
+    of_object_t elt;
+    int rv;
+
+    of_sdwn_add_client_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_add_client_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_add_client_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_add_client_client_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_add_client_ap_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_sdwn_add_client_assoc_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_add_client_capabilities_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_add_client_cap_flags_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_add_client_ht_capabilities_bind(obj, &ht_cap);
+    loci_binlog_object(s, &ht_cap);
+
+    of_sdwn_add_client_vht_capabilities_bind(obj, &vht_cap);
+    loci_binlog_object(s, &vht_cap);
+
+    of_sdwn_add_client_supported_rates_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_sdwn_add_client_keys_bind(obj, &list);
+    OF_LIST_BSN_TLV_DATA_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_sdwn_add_lvap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_mac_addr_t mac_addr;
+    uint16_t val16;
+    of_ieee80211_ht_cap_t ht_cap;
+    of_ieee80211_vht_cap_t vht_cap;
+    of_octets_t octets;
+
+    of_sdwn_add_lvap_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_add_lvap_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_add_lvap_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_add_lvap_bssid_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_add_lvap_phy_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_add_lvap_cap_flags_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_add_lvap_ht_capabilities_bind(obj, &ht_cap);
+    loci_binlog_object(s, &ht_cap);
+
+    of_sdwn_add_lvap_vht_capabilities_bind(obj, &vht_cap);
+    loci_binlog_object(s, &vht_cap);
+
+    of_sdwn_add_lvap_beacon_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_sdwn_del_client_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_mac_addr_t mac_addr;
+    of_port_no_t port_no;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_sdwn_del_client_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_del_client_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_del_client_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_del_client_client_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_del_client_ap_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_sdwn_del_client_reason_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_del_client_deauth_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_sdwn_del_client_ban_time_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_sdwn_del_lvap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_mac_addr_t mac_addr;
+
+    of_sdwn_del_lvap_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_del_lvap_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_del_lvap_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_del_lvap_bssid_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_sdwn_get_channel_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_sdwn_get_channel_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_channel_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_get_channel_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_channel_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_get_channel_reply_channel_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_sdwn_get_channel_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_sdwn_get_channel_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_channel_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_get_channel_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_channel_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_get_channel_request_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_sdwn_get_clients_reply_crypto_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_mac_addr_t mac_addr;
+    of_ieee80211_ht_cap_t ht_cap;
+    of_ieee80211_vht_cap_t vht_cap;
+    of_desc_str_t desc_str;
+    of_list_bsn_tlv_data_t list;
+    of_object_t elt;
+    int rv;
+
+    of_sdwn_get_clients_reply_crypto_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_reply_crypto_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_get_clients_reply_crypto_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_reply_crypto_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_get_clients_reply_crypto_client_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_sdwn_get_clients_reply_crypto_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_get_clients_reply_crypto_assoc_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_get_clients_reply_crypto_capabilities_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_get_clients_reply_crypto_cap_flags_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_get_clients_reply_crypto_ht_capabilities_bind(obj, &ht_cap);
+    loci_binlog_object(s, &ht_cap);
+
+    of_sdwn_get_clients_reply_crypto_vht_capabilities_bind(obj, &vht_cap);
+    loci_binlog_object(s, &vht_cap);
+
+    of_sdwn_get_clients_reply_crypto_supported_rates_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_sdwn_get_clients_reply_crypto_keys_bind(obj, &list);
+    OF_LIST_BSN_TLV_DATA_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_sdwn_get_clients_reply_lvap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_mac_addr_t mac_addr;
+
+    of_sdwn_get_clients_reply_lvap_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_reply_lvap_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_get_clients_reply_lvap_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_reply_lvap_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_get_clients_reply_lvap_client_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_sdwn_get_clients_reply_lvap_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_sdwn_get_clients_reply_normal_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_mac_addr_t mac_addr;
+    of_ieee80211_ht_cap_t ht_cap;
+    of_ieee80211_vht_cap_t vht_cap;
+    of_desc_str_t desc_str;
+
+    of_sdwn_get_clients_reply_normal_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_reply_normal_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_get_clients_reply_normal_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_reply_normal_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_get_clients_reply_normal_client_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_sdwn_get_clients_reply_normal_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_get_clients_reply_normal_assoc_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_get_clients_reply_normal_capabilities_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_get_clients_reply_normal_cap_flags_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_get_clients_reply_normal_ht_capabilities_bind(obj, &ht_cap);
+    loci_binlog_object(s, &ht_cap);
+
+    of_sdwn_get_clients_reply_normal_vht_capabilities_bind(obj, &vht_cap);
+    loci_binlog_object(s, &vht_cap);
+
+    of_sdwn_get_clients_reply_normal_supported_rates_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_sdwn_get_clients_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_sdwn_get_clients_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_get_clients_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_clients_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_get_clients_request_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_sdwn_get_remote_port_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_sdwn_get_remote_port_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_remote_port_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_remote_port_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_get_remote_port_reply_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_sdwn_get_remote_port_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_sdwn_get_remote_port_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_remote_port_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_get_remote_port_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_sdwn_ieee80211_mgmt_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_mac_addr_t mac_addr;
+    of_port_no_t port_no;
+
+    of_sdwn_ieee80211_mgmt_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_ieee80211_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_sdwn_ieee80211_mgmt_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_ieee80211_mgmt_target_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_ieee80211_mgmt_ssi_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_freq_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_sdwn_ieee80211_mgmt_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_sdwn_ieee80211_mgmt_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_ieee80211_mgmt_reply_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_sdwn_ieee80211_mgmt_reply_deny_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_sdwn_mod_lvap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_mac_addr_t mac_addr;
+    uint16_t val16;
+
+    of_sdwn_mod_lvap_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_mod_lvap_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_mod_lvap_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_mod_lvap_bssid_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_mod_lvap_config_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_mod_lvap_mask_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_sdwn_packet_in_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+    of_octets_t octets;
+
+    of_sdwn_packet_in_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_packet_in_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_packet_in_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_packet_in_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_sdwn_packet_in_hdr_version_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_sdwn_packet_in_hdr_flags_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_sdwn_packet_in_hdr_duration_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_packet_in_hdr_addr1_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_packet_in_hdr_addr2_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_packet_in_hdr_addr3_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_packet_in_hdr_seq_ctrl_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_packet_in_hdr_addr4_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_packet_in_frame_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_sdwn_port_desc_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_sdwn_entity_t list;
+    of_object_t elt;
+    int rv;
+
+    of_sdwn_port_desc_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_port_desc_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_port_desc_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_port_desc_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_sdwn_port_desc_reply_entities_bind(obj, &list);
+    OF_LIST_SDWN_ENTITY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_sdwn_port_desc_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_sdwn_port_desc_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_port_desc_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_sdwn_port_desc_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_port_desc_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_sdwn_set_channel_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_sdwn_set_channel_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_set_channel_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_sdwn_set_channel_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_set_channel_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_sdwn_set_channel_frequency_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_set_channel_beacon_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_set_config_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_set_config_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_set_config_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_set_config_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_switch_config_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_switch_config_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_switch_config_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_switch_config_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_features_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_table_features_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_table_features_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_features_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_features_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_features_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_features_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_FEATURES_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_features_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_features_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_features_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_features_stats_request_entries_bind(obj, &list);
+    OF_LIST_TABLE_FEATURES_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_mod_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_table_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_table_mod_failed_error_msg_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_table_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_table_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_stats_reply_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_stats_request_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_table_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_bsn_checksum_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_checksum_128_t checksum_128;
+
+    of_action_bsn_checksum_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_checksum_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_checksum_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_action_bsn_gentable_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_action_bsn_gentable_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_gentable_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_gentable_table_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_action_bsn_gentable_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_action_bsn_mirror_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_action_bsn_mirror_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_mirror_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_dest_port_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_vlan_tag_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_copy_stage_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_bsn_set_tunnel_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_bsn_set_tunnel_dst_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_circuit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_oxm_t oxm;
+
+    of_action_circuit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_circuit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_circuit_hlength_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_circuit_field_bind(obj, &oxm);
+    loci_binlog_object(s, &oxm);
+}
+
+void
+of_action_copy_ttl_in_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_copy_ttl_out_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_mpls_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_nw_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_group_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_group_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_checksum_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_checksum_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_checksum_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_gentable_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_gentable_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_gentable_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_mirror_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_mirror_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_mirror_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_set_tunnel_dst_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_set_tunnel_dst_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_circuit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_circuit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_circuit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_id_circuit_hlength_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_copy_ttl_in_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_copy_ttl_out_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_dec_mpls_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_dec_nw_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_group_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_nicira_dec_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_dec_ttl_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_dec_ttl_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_move_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_move_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_move_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_pop_nsh_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_pop_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_pop_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_push_nsh_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_push_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_push_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_resubmit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_resubmit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_resubmit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_resubmit_table_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_resubmit_table_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_resubmit_table_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_ofdpa_pop_cw_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_ofdpa_pop_cw_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_ofdpa_pop_cw_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_ofdpa_pop_l2_header_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_ofdpa_pop_l2_header_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_ofdpa_pop_l2_header_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_ofdpa_push_cw_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_ofdpa_push_cw_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_ofdpa_push_cw_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_ofdpa_push_l2_header_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_ofdpa_push_l2_header_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_ofdpa_push_l2_header_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_oplink_att_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_oplink_att_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_oplink_att_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_id_oplink_att_hlength_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_output_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_pop_mpls_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_pop_pbb_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_pop_vlan_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_push_mpls_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_push_pbb_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_push_vlan_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_field_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_mpls_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_nw_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_queue_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_nicira_dec_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_dec_ttl_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_dec_ttl_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_move_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_move_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_move_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_n_bits_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_dst_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_nicira_move_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_nicira_pop_nsh_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_pop_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_pop_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_push_nsh_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_push_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_push_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_resubmit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_nicira_resubmit_table_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_table_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_table_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_ofdpa_pop_cw_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_ofdpa_pop_cw_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_ofdpa_pop_cw_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_ofdpa_pop_l2_header_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_ofdpa_pop_l2_header_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_ofdpa_pop_l2_header_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_ofdpa_push_cw_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_ofdpa_push_cw_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_ofdpa_push_cw_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_ofdpa_push_l2_header_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_ofdpa_push_l2_header_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_ofdpa_push_l2_header_exp_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_oplink_att_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_oxm_t oxm;
+
+    of_action_oplink_att_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_oplink_att_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_oplink_att_hlength_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_oplink_att_field_bind(obj, &oxm);
+    loci_binlog_object(s, &oxm);
+}
+
+void
+of_action_output_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint16_t val16;
+
+    of_action_output_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_action_output_max_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_pop_mpls_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_pop_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_pop_pbb_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_pop_vlan_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_push_mpls_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_push_pbb_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_pbb_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_push_vlan_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_vlan_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_set_field_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_oxm_t oxm;
+
+    of_action_set_field_field_bind(obj, &oxm);
+    loci_binlog_object(s, &oxm);
+}
+
+void
+of_action_set_mpls_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_mpls_ttl_mpls_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_nw_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_nw_ttl_nw_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_queue_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_controller_connection_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    of_desc_str_t desc_str;
+
+    of_bsn_controller_connection_state_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_controller_connection_auxiliary_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_controller_connection_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connection_uri_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+    of_str64_t str64;
+    of_desc_str_t desc_str;
+
+    of_bsn_debug_counter_desc_stats_entry_counter_id_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bsn_debug_counter_desc_stats_entry_name_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    of_bsn_debug_counter_desc_stats_entry_description_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_debug_counter_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_debug_counter_stats_entry_counter_id_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bsn_debug_counter_stats_entry_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_flow_checksum_bucket_stats_entry_checksum_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_generic_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_stats_entry_tlvs_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_bucket_stats_entry_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_desc_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_table_name_t table_name;
+    uint32_t val32;
+
+    of_bsn_gentable_desc_stats_entry_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_desc_stats_entry_name_get(obj, &table_name);
+    LOCI_BINLOG_tab_name(s, table_name);
+
+    of_bsn_gentable_desc_stats_entry_buckets_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_desc_stats_entry_max_entries_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_checksum_128_t checksum_128;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_desc_stats_entry_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_desc_stats_entry_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_desc_stats_entry_value_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_stats_entry_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_stats_entry_stats_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    uint32_t val32;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_stats_entry_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_stats_entry_entry_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_stats_entry_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_interface_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    of_ipv4_t ipv4;
+
+    of_bsn_interface_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_interface_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_bsn_interface_ipv4_addr_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_interface_ipv4_netmask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_lacp_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+    uint8_t val8;
+
+    of_bsn_lacp_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_lacp_stats_entry_actor_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_actor_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_stats_entry_actor_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_actor_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_actor_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_convergence_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_lacp_stats_entry_partner_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_partner_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_stats_entry_partner_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_partner_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_partner_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_port_counter_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_port_counter_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_port_counter_stats_entry_values_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_desc_str_t desc_str;
+
+    of_bsn_switch_pipeline_stats_entry_pipeline_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_table_checksum_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint64_t val64;
+
+    of_bsn_table_checksum_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_table_checksum_stats_entry_checksum_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_actor_key_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_key_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_actor_port_num_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_port_num_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_actor_port_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_port_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_actor_state_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_actor_state_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_actor_system_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_actor_system_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_actor_system_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_system_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_anchor_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_anchor_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_apply_bytes_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_apply_bytes_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_apply_packets_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_apply_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_auto_negotiation_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_auto_negotiation_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_broadcast_query_timeout_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_broadcast_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_broadcast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_bucket_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_bucket_value_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_circuit_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_circuit_id_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_convergence_status_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_convergence_status_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_cpu_lag_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_crc_enabled_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_crc_enabled_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_data_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_data_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_data_mask_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_data_mask_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_decap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_decap_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_drop_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_dscp_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_dscp_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_ecn_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_ecn_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_egress_only_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_egress_port_group_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_egress_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_enhanced_hash_capability_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_eth_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_eth_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_eth_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_external_gateway_ip_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_external_gateway_ip_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_external_gateway_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_external_gateway_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_external_ip_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_external_ip_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_external_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_external_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_external_netmask_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_external_netmask_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_generation_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_generation_id_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_hash_gtp_header_match_first_header_byte_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_tlv_hash_gtp_header_match_first_header_mask_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint16_t val16;
+
+    of_bsn_tlv_hash_gtp_port_match_match_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_tlv_hash_gtp_port_match_src_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_tlv_hash_gtp_port_match_dst_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_hash_packet_field_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_hash_packet_field_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_hash_packet_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_hash_packet_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_hash_seed_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_hash_seed_seed1_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_tlv_hash_seed_seed2_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_hash_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_hash_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_header_size_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_header_size_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_icmp_code_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_icmp_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_icmp_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_icmp_id_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_icmp_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_icmp_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_icmpv6_chksum_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_idle_notification_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_idle_time_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_idle_time_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_idle_timeout_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_idle_timeout_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_igmp_snooping_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_ingress_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_internal_gateway_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_internal_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_internal_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_interval_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_interval_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_ip_proto_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_ip_proto_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_ipv4_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv4_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv4_netmask_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_netmask_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv4_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv6_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_bsn_tlv_ipv6_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_bsn_tlv_ipv6_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_bsn_tlv_ipv6_dst_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_bsn_tlv_ipv6_prefix_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+    uint8_t val8;
+
+    of_bsn_tlv_ipv6_prefix_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_bsn_tlv_ipv6_prefix_prefix_length_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_ipv6_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_bsn_tlv_ipv6_src_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_bsn_tlv_known_multicast_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_known_multicast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_l3_dst_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_l3_interface_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_l3_src_class_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_l3_src_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_loopback_port_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_bsn_tlv_loopback_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_tlv_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_mac_mask_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_mac_mask_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_miss_packets_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_miss_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_mpls_control_word_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_mpls_control_word_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_mpls_label_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_mpls_label_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_mpls_sequenced_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_mpls_sequenced_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_multicast_interface_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_multicast_interface_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_name_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_name_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_ndp_offload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_ndp_static_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_negate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_next_hop_ipv4_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_next_hop_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_next_hop_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_offset_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_offset_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_parent_port_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_bsn_tlv_parent_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_tlv_partner_key_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_key_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_partner_port_num_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_port_num_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_partner_port_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_port_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_partner_state_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_partner_state_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_partner_system_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_partner_system_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_partner_system_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_system_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_port_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_bsn_tlv_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_tlv_port_usage_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_port_usage_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_port_vxlan_mode_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_priority_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_qos_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_qos_priority_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_queue_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_queue_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_queue_weight_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_queue_weight_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_rate_limit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_rate_limit_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_rate_unit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_rate_unit_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_reference_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_tlv_reference_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_reference_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_reply_packets_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_reply_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_request_packets_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_request_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_rx_bytes_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_rx_bytes_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_rx_packets_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_rx_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_sampling_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_sampling_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_set_loopback_mode_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_status_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_status_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_sub_agent_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_sub_agent_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_tcp_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_tcp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_tcp_flags_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_tcp_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_tcp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_ttl_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_ttl_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_tunnel_capability_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_tunnel_capability_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_tx_bytes_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_tx_bytes_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_tx_packets_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_tx_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_udf_anchor_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_anchor_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udf_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_id_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udf_length_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_length_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udf_offset_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_offset_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udp_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udp_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_uint64_list_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_uint64_list_value_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_unicast_query_timeout_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_unicast_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_unicast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_unknown_multicast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_untagged_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_use_packet_state_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_use_packet_state_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_vfi_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_vfi_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_vfp_class_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vfp_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vlan_mac_list_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_vlan_mac_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_vlan_mac_list_key_bind(obj, &list);
+    OF_LIST_BSN_VLAN_MAC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_vlan_pcp_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_vlan_pcp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_vlan_vid_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_vlan_vid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_vlan_vid_mask_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_vni_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vni_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vpn_key_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vpn_key_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vrf_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vrf_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_vlan_counter_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vlan_counter_stats_entry_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vlan_counter_stats_entry_values_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_vlan_mac_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+
+    of_bsn_vlan_mac_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vlan_mac_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_vport_l2gre_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_ipv4_t ipv4;
+    uint8_t val8;
+    of_port_name_t port_name;
+
+    of_bsn_vport_l2gre_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_loopback_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_local_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_nh_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_src_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dst_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dscp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_vpn_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_rate_limit_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bsn_vport_q_in_q_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_name_t port_name;
+
+    of_bsn_vport_q_in_q_port_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_q_in_q_ingress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_ingress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bsn_vrf_counter_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vrf_counter_stats_entry_vrf_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vrf_counter_stats_entry_values_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bucket_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_port_no_t port_no;
+    uint32_t val32;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bucket_weight_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bucket_watch_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bucket_watch_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bucket_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bucket_counter_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bucket_counter_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bucket_counter_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_calient_flow_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+    of_port_no_t port_no;
+    of_str6_t str6;
+    of_str64_t str64;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_calient_flow_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_flow_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_calient_flow_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_calient_flow_stats_entry_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_calient_flow_stats_entry_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_calient_flow_stats_entry_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_calient_flow_stats_entry_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_calient_flow_stats_entry_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_calient_flow_stats_entry_admin_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_flow_stats_entry_oper_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_flow_stats_entry_oper_capability_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_flow_stats_entry_alarm_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_flow_stats_entry_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_calient_flow_stats_entry_port_power_get(obj, &str6);
+    LOCI_BINLOG_str6(s, str6);
+
+    of_calient_flow_stats_entry_connected_port_power_get(obj, &str6);
+    LOCI_BINLOG_str6(s, str6);
+
+    of_calient_flow_stats_entry_cflow_name_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    of_calient_flow_stats_entry_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_calient_flow_stats_entry_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_calient_port_desc_prop_optical_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_str6_t str6;
+    uint64_t val64;
+    uint16_t val16;
+    of_str32_t str32;
+    of_str64_t str64;
+
+    of_calient_port_desc_prop_optical_in_admin_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_desc_prop_optical_in_oper_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_desc_prop_optical_in_oper_capability_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_desc_prop_optical_out_admin_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_desc_prop_optical_out_oper_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_desc_prop_optical_out_oper_capability_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_desc_prop_optical_inport_power_get(obj, &str6);
+    LOCI_BINLOG_str6(s, str6);
+
+    of_calient_port_desc_prop_optical_outport_power_get(obj, &str6);
+    LOCI_BINLOG_str6(s, str6);
+
+    of_calient_port_desc_prop_optical_in_peer_node_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_calient_port_desc_prop_optical_out_peer_node_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_calient_port_desc_prop_optical_in_peer_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_calient_port_desc_prop_optical_out_peer_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_calient_port_desc_prop_optical_in_circuit_id_get(obj, &str32);
+    LOCI_BINLOG_str32(s, str32);
+
+    of_calient_port_desc_prop_optical_out_circuit_id_get(obj, &str32);
+    LOCI_BINLOG_str32(s, str32);
+
+    of_calient_port_desc_prop_optical_in_alias_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    of_calient_port_desc_prop_optical_out_alias_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+}
+
+void
+of_calient_port_desc_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+    of_list_calient_port_desc_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_calient_port_desc_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_calient_port_desc_stats_entry_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_calient_port_desc_stats_entry_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_calient_port_desc_stats_entry_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_calient_port_desc_stats_entry_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_calient_port_desc_stats_entry_properties_bind(obj, &list);
+    OF_LIST_CALIENT_PORT_DESC_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_calient_port_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_str6_t str6;
+    of_str32_t str32;
+
+    of_calient_port_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_calient_port_stats_entry_in_admin_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_in_oper_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_in_oper_capability_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_in_alarm_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_inport_power_get(obj, &str6);
+    LOCI_BINLOG_str6(s, str6);
+
+    of_calient_port_stats_entry_outport_power_get(obj, &str6);
+    LOCI_BINLOG_str6(s, str6);
+
+    of_calient_port_stats_entry_out_admin_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_out_oper_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_out_oper_capability_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_out_alarm_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_calient_port_stats_entry_in_circuit_id_get(obj, &str32);
+    LOCI_BINLOG_str32(s, str32);
+
+    of_calient_port_stats_entry_out_circuit_id_get(obj, &str32);
+    LOCI_BINLOG_str32(s, str32);
+}
+
+void
+of_exp_ext_ad_id_port_otn_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_bitmap_128_t bitmap_128;
+    of_bitmap_256_t bitmap_256;
+
+    of_exp_ext_ad_id_port_otn_namespace_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_exp_ext_ad_id_port_otn_ns_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_exp_ext_ad_id_port_otn_sapi_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+
+    of_exp_ext_ad_id_port_otn_dapi_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+
+    of_exp_ext_ad_id_port_otn_opspec_get(obj, &bitmap_256);
+    LOCI_BINLOG_bitmap_256(s, bitmap_256);
+}
+
+void
+of_exp_ext_ad_id_sonet_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_bitmap_128_t bitmap_128;
+
+    of_exp_ext_ad_id_sonet_namespace_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_exp_ext_ad_id_sonet_ns_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_exp_ext_ad_id_sonet_id_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+}
+
+void
+of_exp_port_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+    of_list_exp_port_desc_prop_optical_transport_t list;
+    of_object_t elt;
+    int rv;
+
+    of_exp_port_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_exp_port_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_exp_port_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_exp_port_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_exp_port_properties_bind(obj, &list);
+    OF_LIST_EXP_PORT_DESC_PROP_OPTICAL_TRANSPORT_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_exp_port_adjacency_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+    of_list_exp_port_adjacency_id_t list;
+    of_object_t elt;
+    int rv;
+
+    of_exp_port_adjacency_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_exp_port_adjacency_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_exp_port_adjacency_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_exp_port_adjacency_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_exp_port_adjacency_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_exp_port_adjacency_properties_bind(obj, &list);
+    OF_LIST_EXP_PORT_ADJACENCY_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_exp_port_adjacency_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_exp_ext_ad_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_exp_port_adjacency_id_ad_id_bind(obj, &list);
+    OF_LIST_EXP_EXT_AD_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_exp_port_des_prop_header_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_exp_port_desc_prop_optical_transport_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_list_exp_port_optical_transport_layer_stack_t list;
+    of_object_t elt;
+    int rv;
+
+    of_exp_port_desc_prop_optical_transport_port_signal_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_exp_port_desc_prop_optical_transport_reserved_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_exp_port_desc_prop_optical_transport_features_bind(obj, &list);
+    OF_LIST_EXP_PORT_OPTICAL_TRANSPORT_LAYER_STACK_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_exp_port_optical_transport_layer_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_exp_port_optical_transport_layer_entry_layer_class_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_exp_port_optical_transport_layer_entry_signal_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_exp_port_optical_transport_layer_entry_adaptation_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_exp_port_optical_transport_layer_stack_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_list_exp_port_optical_transport_layer_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_exp_port_optical_transport_layer_stack_feature_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_exp_port_optical_transport_layer_stack_value_bind(obj, &list);
+    OF_LIST_EXP_PORT_OPTICAL_TRANSPORT_LAYER_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_stats_entry_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_entry_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_entry_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_desc_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_entry_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    of_list_bucket_counter_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_ref_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_group_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_group_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_entry_bucket_stats_bind(obj, &list);
+    OF_LIST_BUCKET_COUNTER_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_hello_elem_versionbitmap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_hello_elem_versionbitmap_bitmaps_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_ieee80211_ht_cap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    uint8_t val8;
+    of_ieee80211_mcs_info_t mcs_info;
+    uint32_t val32;
+
+    of_ieee80211_ht_cap_cap_info_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_ieee80211_ht_cap_ampdu_params_info_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_ieee80211_ht_cap_mcs_bind(obj, &mcs_info);
+    loci_binlog_object(s, &mcs_info);
+
+    of_ieee80211_ht_cap_extended_ht_cap_info_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_ieee80211_ht_cap_tx_BF_cap_info_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_ieee80211_ht_cap_antenna_selection_info_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_ieee80211_mcs_info_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ieee80211_mcs_rx_mask_t mcs_rx_mask;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_ieee80211_mcs_info_rx_mask_get(obj, &mcs_rx_mask);
+    LOCI_BINLOG_mcs_rx_mask(s, mcs_rx_mask);
+
+    of_ieee80211_mcs_info_rx_highest_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_ieee80211_mcs_info_tx_params_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_ieee80211_vht_cap_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_ieee80211_vht_mcs_info_t vht_mcs_info;
+
+    of_ieee80211_vht_cap_cap_info_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_ieee80211_vht_cap_mcs_bind(obj, &vht_mcs_info);
+    loci_binlog_object(s, &vht_mcs_info);
+}
+
+void
+of_ieee80211_vht_mcs_info_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_ieee80211_vht_mcs_info_rx_vht_mcs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_ieee80211_vht_mcs_info_rx_highest_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_ieee80211_vht_mcs_info_tx_vht_mcs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_ieee80211_vht_mcs_info_tx_highest_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_instruction_apply_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_apply_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_bsn_arp_offload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_arp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_arp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_auto_negotiation_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_auto_negotiation_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_auto_negotiation_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_deny_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_deny_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_deny_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_dhcp_offload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_dhcp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_dhcp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_disable_l3_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_disable_l3_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_disable_l3_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_disable_split_horizon_check_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_disable_split_horizon_check_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_disable_split_horizon_check_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_disable_src_mac_check_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_disable_src_mac_check_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_disable_vlan_counters_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_disable_vlan_counters_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_hash_select_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_hash_select_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_hash_select_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_instruction_bsn_hash_select_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_internal_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_internal_priority_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_internal_priority_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_instruction_bsn_internal_priority_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_ndp_offload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_ndp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_ndp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_packet_of_death_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_packet_of_death_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_packet_of_death_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_permit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_permit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_permit_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_prioritize_pdus_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_prioritize_pdus_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_prioritize_pdus_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_require_vlan_xlate_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_require_vlan_xlate_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_span_destination_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_span_destination_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_span_destination_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_clear_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_goto_table_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_instruction_goto_table_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_instruction_id_apply_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_bsn_arp_offload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_arp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_arp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_auto_negotiation_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_auto_negotiation_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_deny_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_deny_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_deny_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_dhcp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_dhcp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_disable_l3_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_disable_l3_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_disable_l3_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_disable_split_horizon_check_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_disable_split_horizon_check_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_disable_split_horizon_check_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_disable_src_mac_check_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_disable_src_mac_check_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_disable_vlan_counters_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_disable_vlan_counters_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_hash_select_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_hash_select_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_hash_select_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_internal_priority_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_internal_priority_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_internal_priority_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_ndp_offload_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_ndp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_ndp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_packet_of_death_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_packet_of_death_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_packet_of_death_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_permit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_permit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_permit_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_prioritize_pdus_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_prioritize_pdus_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_require_vlan_xlate_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_require_vlan_xlate_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_span_destination_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_span_destination_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_span_destination_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_clear_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_goto_table_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_meter_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_write_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_write_metadata_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_meter_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_meter_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_write_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_write_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_write_metadata_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_instruction_write_metadata_metadata_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_instruction_write_metadata_metadata_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_match_v3_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_oxm_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_match_v3_oxm_list_bind(obj, &list);
+    OF_LIST_OXM_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_band_drop_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_meter_band_drop_rate_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_drop_burst_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_meter_band_dscp_remark_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_meter_band_dscp_remark_rate_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_dscp_remark_burst_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_dscp_remark_prec_level_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_meter_band_experimenter_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_meter_band_experimenter_rate_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_experimenter_burst_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_experimenter_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_meter_band_stats_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_meter_band_stats_packet_band_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_meter_band_stats_byte_band_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_meter_config_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    uint32_t val32;
+    of_list_meter_band_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_config_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_config_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_config_entries_bind(obj, &list);
+    OF_LIST_METER_BAND_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_features_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_meter_features_max_meter_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_features_band_types_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_max_bands_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_meter_features_max_color_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_meter_stats_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    of_list_meter_band_stats_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_stats_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_stats_flow_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_stats_packet_in_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_meter_stats_byte_in_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_meter_stats_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_stats_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_stats_band_stats_bind(obj, &list);
+    OF_LIST_METER_BAND_STATS_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_oplink_channel_power_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oplink_channel_power_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oplink_channel_power_out_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oplink_channel_power_channel_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oplink_channel_power_power_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oplink_port_power_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oplink_port_power_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oplink_port_power_power_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_arp_op_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_arp_op_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_arp_op_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_arp_op_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_arp_op_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_arp_sha_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_sha_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_sha_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_sha_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_arp_sha_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_spa_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_spa_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_arp_spa_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_spa_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_arp_spa_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_arp_tha_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_tha_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_tha_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_tha_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_arp_tha_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_tpa_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_tpa_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_arp_tpa_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_tpa_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_arp_tpa_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_egr_port_group_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_egr_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_egr_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_egr_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_global_vrf_allowed_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_global_vrf_allowed_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_global_vrf_allowed_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_in_ports_128_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_128_t bitmap_128;
+
+    of_oxm_bsn_in_ports_128_value_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+}
+
+void
+of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_128_t bitmap_128;
+
+    of_oxm_bsn_in_ports_128_masked_value_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+
+    of_oxm_bsn_in_ports_128_masked_value_mask_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+}
+
+void
+of_oxm_bsn_in_ports_512_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_512_t bitmap_512;
+
+    of_oxm_bsn_in_ports_512_value_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+}
+
+void
+of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_512_t bitmap_512;
+
+    of_oxm_bsn_in_ports_512_masked_value_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+
+    of_oxm_bsn_in_ports_512_masked_value_mask_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+}
+
+void
+of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_ingress_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_ingress_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_ingress_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_inner_eth_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_bsn_inner_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_eth_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_bsn_inner_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_inner_vlan_vid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_inner_vlan_vid_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_bsn_inner_vlan_vid_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_bsn_ip_fragmentation_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_ip_fragmentation_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_ip_fragmentation_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_ip_fragmentation_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_l2_cache_hit_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_l2_cache_hit_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_l2_cache_hit_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_l2_cache_hit_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_dst_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_dst_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_dst_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_interface_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_interface_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_interface_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_src_class_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_src_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_src_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_src_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_lag_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_lag_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_lag_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_lag_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_lag_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_tcp_flags_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_tcp_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_bsn_tcp_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_bsn_udf0_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf0_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf0_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf0_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf0_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf1_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf1_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf1_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf1_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf1_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf2_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf2_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf2_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf2_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf2_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf3_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf3_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf3_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf3_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf3_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf4_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf4_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf4_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf4_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf4_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf5_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf5_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf5_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf5_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf5_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf6_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf6_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf6_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf6_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf6_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf7_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf7_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf7_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf7_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf7_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vfi_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_vfi_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_bsn_vfi_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_vfi_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_bsn_vfi_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vlan_xlate_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vrf_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vrf_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vrf_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vrf_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vrf_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vxlan_network_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vxlan_network_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vxlan_network_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vxlan_network_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_circuit_och_sigid_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_circuit_sig_id_t sig_id;
+
+    of_oxm_circuit_och_sigid_value_get(obj, &sig_id);
+    LOCI_BINLOG_circuit_sig_id(s, sig_id);
+}
+
+void
+of_oxm_circuit_och_sigid_basic_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_circuit_sig_id_t sig_id;
+
+    of_oxm_circuit_och_sigid_basic_value_get(obj, &sig_id);
+    LOCI_BINLOG_circuit_sig_id(s, sig_id);
+}
+
+void
+of_oxm_circuit_och_sigid_basic_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_circuit_sig_id_t sig_id;
+
+    of_oxm_circuit_och_sigid_basic_masked_value_get(obj, &sig_id);
+    LOCI_BINLOG_circuit_sig_id(s, sig_id);
+
+    of_oxm_circuit_och_sigid_basic_masked_value_mask_get(obj, &sig_id);
+    LOCI_BINLOG_circuit_sig_id(s, sig_id);
+}
+
+void
+of_oxm_circuit_och_sigid_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_circuit_sig_id_t sig_id;
+
+    of_oxm_circuit_och_sigid_masked_value_get(obj, &sig_id);
+    LOCI_BINLOG_circuit_sig_id(s, sig_id);
+
+    of_oxm_circuit_och_sigid_masked_value_mask_get(obj, &sig_id);
+    LOCI_BINLOG_circuit_sig_id(s, sig_id);
+}
+
+void
+of_oxm_circuit_och_sigtype_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_circuit_och_sigtype_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_circuit_och_sigtype_basic_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_circuit_och_sigtype_basic_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_circuit_och_sigtype_basic_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_circuit_och_sigtype_basic_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_circuit_och_sigtype_basic_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_circuit_och_sigtype_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_circuit_och_sigtype_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_circuit_och_sigtype_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_encap_eth_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_encap_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_encap_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_encap_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_encap_eth_type_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_encap_eth_type_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_encap_eth_type_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_eth_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_eth_type_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_eth_type_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_eth_type_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_exp_och_sigid_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_och_sig_id_t och_sig_id;
+
+    of_oxm_exp_och_sigid_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_och_sigid_value_get(obj, &och_sig_id);
+    LOCI_BINLOG_och_sig_id(s, och_sig_id);
+}
+
+void
+of_oxm_exp_och_sigid_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_och_sig_id_t och_sig_id;
+
+    of_oxm_exp_och_sigid_masked_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_och_sigid_masked_value_get(obj, &och_sig_id);
+    LOCI_BINLOG_och_sig_id(s, och_sig_id);
+
+    of_oxm_exp_och_sigid_masked_value_mask_get(obj, &och_sig_id);
+    LOCI_BINLOG_och_sig_id(s, och_sig_id);
+}
+
+void
+of_oxm_exp_och_sigtype_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_oxm_exp_och_sigtype_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_och_sigtype_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_exp_och_sigtype_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_oxm_exp_och_sigtype_masked_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_och_sigtype_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_exp_och_sigtype_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_exp_odu_sigid_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_odu_sig_id_t odu_sig_id;
+
+    of_oxm_exp_odu_sigid_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_odu_sigid_value_get(obj, &odu_sig_id);
+    LOCI_BINLOG_odu_sig_id(s, odu_sig_id);
+}
+
+void
+of_oxm_exp_odu_sigid_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_odu_sig_id_t odu_sig_id;
+
+    of_oxm_exp_odu_sigid_masked_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_odu_sigid_masked_value_get(obj, &odu_sig_id);
+    LOCI_BINLOG_odu_sig_id(s, odu_sig_id);
+
+    of_oxm_exp_odu_sigid_masked_value_mask_get(obj, &odu_sig_id);
+    LOCI_BINLOG_odu_sig_id(s, odu_sig_id);
+}
+
+void
+of_oxm_exp_odu_sigtype_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_oxm_exp_odu_sigtype_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_odu_sigtype_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_exp_odu_sigtype_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_oxm_exp_odu_sigtype_masked_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_oxm_exp_odu_sigtype_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_exp_odu_sigtype_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv4_code_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv4_code_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_code_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv4_code_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv4_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv4_type_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_type_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv4_type_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv6_code_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv6_code_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_code_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv6_code_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv6_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv6_type_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_type_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv6_type_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_in_phy_port_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_phy_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_phy_port_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_phy_port_masked_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_oxm_in_phy_port_masked_value_mask_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_port_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_port_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_port_masked_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_oxm_in_port_masked_value_mask_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_ip_dscp_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_dscp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_dscp_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_dscp_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_dscp_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ip_ecn_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_ecn_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_ecn_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_ecn_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_ecn_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ip_proto_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_proto_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_proto_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_proto_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_proto_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ipv4_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_dst_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_ipv4_dst_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_src_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_ipv4_src_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv6_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_dst_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_dst_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_dst_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_exthdr_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_ipv6_exthdr_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_ipv6_exthdr_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_ipv6_exthdr_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_ipv6_exthdr_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_ipv6_flabel_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ipv6_flabel_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_ipv6_flabel_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ipv6_flabel_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ipv6_flabel_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_ipv6_nd_sll_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_sll_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_sll_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_ipv6_nd_sll_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_target_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_nd_target_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_nd_target_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_nd_target_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_nd_target_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_nd_tll_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_tll_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_tll_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_ipv6_nd_tll_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_src_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_src_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_src_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_metadata_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_metadata_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_oxm_metadata_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_metadata_masked_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_oxm_metadata_masked_value_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_oxm_mpls_bos_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_bos_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_mpls_bos_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_bos_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_mpls_bos_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_mpls_label_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_mpls_label_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_mpls_label_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_mpls_label_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_mpls_label_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_mpls_tc_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_tc_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_mpls_tc_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_tc_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_mpls_tc_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsh_c1_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c1_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c1_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c1_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c1_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c2_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c2_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c2_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c2_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c2_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c3_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c3_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c3_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c3_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c3_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c4_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c4_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c4_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c4_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c4_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_mdtype_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_mdtype_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsh_mdtype_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_mdtype_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsh_mdtype_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsh_np_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_np_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsh_np_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_np_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsh_np_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsi_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsi_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsi_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsi_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsi_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsp_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsp_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsp_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsp_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsp_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_och_sigatt_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_och_sigatt_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_och_sigatt_basic_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_och_sigatt_basic_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_och_sigatt_basic_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_och_sigatt_basic_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_och_sigatt_basic_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_och_sigatt_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_och_sigatt_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_och_sigatt_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_ofdpa_mpls_l2_port_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ofdpa_mpls_l2_port_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_mpls_l2_port_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_ofdpa_mpls_l2_port_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ofdpa_mpls_l2_port_masked_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_mpls_l2_port_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_mpls_l2_port_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_ofdpa_mpls_type_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ofdpa_mpls_type_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_mpls_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_ofdpa_mpls_type_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ofdpa_mpls_type_masked_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_mpls_type_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_ofdpa_mpls_type_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_ofdpa_ovid_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ofdpa_ovid_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_ovid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_ofdpa_ovid_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ofdpa_ovid_masked_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_ovid_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_ofdpa_ovid_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_ofdpa_qos_index_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_oxm_ofdpa_qos_index_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_qos_index_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ofdpa_qos_index_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_oxm_ofdpa_qos_index_masked_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ofdpa_qos_index_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ofdpa_qos_index_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ovs_tcp_flags_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ovs_tcp_flags_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ovs_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ovs_tcp_flags_masked_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ovs_tcp_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_ovs_tcp_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_sctp_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_sctp_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_sctp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_sctp_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_sctp_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_sctp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tcp_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tcp_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tcp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tcp_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tcp_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tcp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_flags_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tun_flags_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tun_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_gbp_flags_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gbp_flags_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gbp_flags_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gbp_flags_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gbp_flags_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tun_gbp_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_gbp_id_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tun_gbp_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_gbp_id_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tun_gbp_id_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_gpe_flags_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_flags_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_flags_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_flags_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gpe_flags_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_np_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_np_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_np_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_np_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gpe_np_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tunnel_id_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_tunnel_id_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_oxm_tunnel_id_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_tunnel_id_masked_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_oxm_tunnel_id_masked_value_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_oxm_tunnel_ipv4_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_dst_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_tunnel_ipv4_dst_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_src_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_tunnel_ipv4_src_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_udp_dst_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_udp_dst_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_udp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_udp_src_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_udp_src_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_udp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_vlan_pcp_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_vlan_pcp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_vlan_pcp_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_vlan_pcp_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_vlan_pcp_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_vlan_vid_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_vlan_vid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_vlan_vid_masked_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_vlan_vid_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_vlan_vid_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_packet_queue_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_queue_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_packet_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_queue_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_queue_properties_bind(obj, &list);
+    OF_LIST_QUEUE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+
+    of_port_desc_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_desc_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_desc_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_port_desc_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_curr_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_advertised_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_supported_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_peer_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_curr_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_max_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_desc_prop_optical_transport_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_port_desc_prop_optical_transport_port_signal_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_port_desc_prop_optical_transport_reserved_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_port_desc_prop_optical_transport_port_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_port_optical_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+    of_list_port_desc_prop_optical_transport_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_optical_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_optical_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_optical_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_port_optical_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_optical_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_optical_desc_bind(obj, &list);
+    OF_LIST_PORT_DESC_PROP_OPTICAL_TRANSPORT_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_optical_transport_application_code_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    uint8_t val8;
+    of_app_code_t app_code;
+
+    of_port_optical_transport_application_code_feature_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_optical_transport_application_code_oic_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_port_optical_transport_application_code_app_code_get(obj, &app_code);
+    LOCI_BINLOG_app_code(s, app_code);
+}
+
+void
+of_port_optical_transport_layer_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_port_optical_transport_layer_entry_layer_class_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_port_optical_transport_layer_entry_signal_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_port_optical_transport_layer_entry_adaptation_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_port_optical_transport_layer_stack_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_list_port_optical_transport_layer_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_optical_transport_layer_stack_feature_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_optical_transport_layer_stack_entries_bind(obj, &list);
+    OF_LIST_PORT_OPTICAL_TRANSPORT_LAYER_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint64_t val64;
+    uint32_t val32;
+
+    of_port_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_stats_entry_rx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_frame_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_over_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_crc_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_collisions_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_queue_prop_max_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_max_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_prop_min_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_min_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_queue_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_entry_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_sdwn_entity_accesspoint_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_port_name_t port_name;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_sdwn_entity_accesspoint_if_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_sdwn_entity_accesspoint_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_sdwn_entity_accesspoint_config_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_entity_accesspoint_bssid_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_entity_accesspoint_phy_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_sdwn_entity_accesspoint_curr_freq_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_accesspoint_curr_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_accesspoint_max_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_accesspoint_ssid_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_sdwn_entity_band_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_ieee80211_ht_cap_t ht_cap;
+    of_ieee80211_vht_cap_t vht_cap;
+
+    of_sdwn_entity_band_index_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_band_band_no_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_entity_band_cap_flags_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_entity_band_ht_capabilities_bind(obj, &ht_cap);
+    loci_binlog_object(s, &ht_cap);
+
+    of_sdwn_entity_band_vht_capabilities_bind(obj, &vht_cap);
+    loci_binlog_object(s, &vht_cap);
+}
+
+void
+of_sdwn_entity_freq_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_sdwn_entity_freq_index_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_freq_band_no_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_entity_freq_freq_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_freq_max_tx_power_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_sdwn_entity_nic_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_mac_addr_t mac_addr;
+
+    of_sdwn_entity_nic_index_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_nic_mac_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_sdwn_entity_rate_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_sdwn_entity_rate_index_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_sdwn_entity_rate_band_no_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_sdwn_entity_rate_rate_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_sdwn_entity_related_switch_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_sdwn_entity_related_switch_datapath_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_table_feature_prop_apply_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_actions_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_apply_actions_miss_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_actions_miss_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_apply_setfield_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_setfield_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_setfield_miss_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_instructions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_instruction_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_instructions_instruction_ids_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_instructions_miss_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_instruction_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_instructions_miss_instruction_ids_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_match_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_match_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_next_tables_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint8_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_next_tables_next_table_ids_bind(obj, &list);
+    OF_LIST_UINT8_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_next_tables_miss_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint8_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_next_tables_miss_next_table_ids_bind(obj, &list);
+    OF_LIST_UINT8_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_wildcards_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_wildcards_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_actions_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_actions_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_actions_miss_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_actions_miss_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_setfield_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_setfield_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_setfield_miss_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_setfield_miss_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_features_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_table_name_t table_name;
+    uint64_t val64;
+    uint32_t val32;
+    of_list_table_feature_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_features_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_features_name_get(obj, &table_name);
+    LOCI_BINLOG_tab_name(s, table_name);
+
+    of_table_features_metadata_match_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_features_metadata_write_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_features_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_max_entries_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_features_properties_bind(obj, &list);
+    OF_LIST_TABLE_FEATURE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_stats_entry_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_table_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_stats_entry_active_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_lookup_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_table_stats_entry_matched_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_uint32_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_uint32_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_uint64_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_uint64_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_uint8_OF_VERSION_1_3_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_uint8_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_aggregate_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_aggregate_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_reply_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_aggregate_stats_reply_flow_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_aggregate_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_aggregate_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_aggregate_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_aggregate_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_aggregate_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_aggregate_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_aggregate_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_aggregate_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_async_config_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_async_config_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_async_config_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_async_config_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_async_get_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_async_config_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_async_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_async_get_reply_properties_bind(obj, &list);
+    OF_LIST_ASYNC_CONFIG_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_async_get_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_async_config_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_async_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_async_get_request_properties_bind(obj, &list);
+    OF_LIST_ASYNC_CONFIG_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_async_set_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_async_config_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_async_set_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_async_set_properties_bind(obj, &list);
+    OF_LIST_ASYNC_CONFIG_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bad_action_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_action_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_action_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_action_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_instruction_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_instruction_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_instruction_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_instruction_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_match_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_match_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_match_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_match_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_property_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_property_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_property_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_property_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bad_request_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bad_request_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bad_request_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bad_request_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_barrier_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_barrier_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_barrier_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_arp_idle_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_ipv4_t ipv4;
+
+    of_bsn_arp_idle_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_arp_idle_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_arp_idle_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_arp_idle_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_arp_idle_ipv4_addr_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_bw_clear_data_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_clear_data_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_clear_data_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_clear_data_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_clear_data_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_get_reply_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_get_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_bw_enable_set_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_bw_enable_set_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_bw_enable_set_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_bw_enable_set_request_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_controller_connections_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_controller_connection_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_controller_connections_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_controller_connections_reply_connections_bind(obj, &list);
+    OF_LIST_BSN_CONTROLLER_CONNECTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_controller_connections_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_controller_connections_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connections_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_debug_counter_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_debug_counter_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_debug_counter_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_debug_counter_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_debug_counter_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_debug_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_debug_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_debug_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_DEBUG_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_debug_counter_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_debug_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_debug_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_debug_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_error_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+    of_octets_t octets;
+
+    of_bsn_error_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_error_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_error_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_error_err_msg_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_bsn_error_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_flow_checksum_bucket_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_flow_checksum_bucket_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_flow_checksum_bucket_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_flow_checksum_bucket_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_FLOW_CHECKSUM_BUCKET_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_bsn_flow_checksum_bucket_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_flow_checksum_bucket_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_checksum_bucket_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_flow_idle_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint16_t val16;
+    uint8_t val8;
+    of_match_t match;
+
+    of_bsn_flow_idle_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_bsn_flow_idle_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_flow_idle_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_flow_idle_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_get_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_get_reply_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_flow_idle_enable_get_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_get_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_get_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_set_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_set_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_flow_idle_enable_set_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_flow_idle_enable_set_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_flow_idle_enable_set_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_flow_idle_enable_set_request_enable_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_generic_async_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_str64_t str64;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_generic_async_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_async_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_async_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_generic_async_name_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_async_tlvs_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_generic_command_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_str64_t str64;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_generic_command_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_command_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_command_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_generic_command_name_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_command_tlvs_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_generic_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_generic_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_generic_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_generic_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENERIC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_generic_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_str64_t str64;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_generic_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_generic_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_generic_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_generic_stats_request_name_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_stats_request_tlvs_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_bucket_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_bucket_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_bucket_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_bucket_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_BUCKET_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_bucket_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_bucket_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_bucket_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_bucket_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_bucket_stats_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_gentable_clear_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_clear_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_clear_reply_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_clear_reply_deleted_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_clear_reply_error_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_clear_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_clear_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_clear_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_clear_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_clear_request_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    of_bsn_gentable_clear_request_checksum_mask_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_entry_add_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_add_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_add_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_add_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_entry_add_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_add_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_add_value_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_delete_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_delete_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_delete_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_delete_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_delete_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_entry_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_entry_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_desc_stats_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_entry_desc_stats_request_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    of_bsn_gentable_entry_desc_stats_request_checksum_mask_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_entry_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_entry_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_ENTRY_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_entry_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_entry_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_entry_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_entry_stats_request_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_entry_stats_request_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    of_bsn_gentable_entry_stats_request_checksum_mask_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_set_buckets_size_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_set_buckets_size_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_set_buckets_size_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_set_buckets_size_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_set_buckets_size_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_set_buckets_size_buckets_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_gentable_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_GENTABLE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_gentable_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_gentable_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_gentable_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_interfaces_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_interface_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_get_interfaces_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_get_interfaces_reply_interfaces_bind(obj, &list);
+    OF_LIST_BSN_INTERFACE_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_get_interfaces_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_interfaces_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_interfaces_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_get_mirroring_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_reply_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_get_mirroring_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_get_mirroring_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_mirroring_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_mirroring_request_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_get_switch_pipeline_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_desc_str_t desc_str;
+
+    of_bsn_get_switch_pipeline_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_get_switch_pipeline_reply_pipeline_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_get_switch_pipeline_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_get_switch_pipeline_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_get_switch_pipeline_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_image_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+
+    of_bsn_image_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_image_desc_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_image_desc_stats_reply_image_checksum_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_bsn_image_desc_stats_reply_startup_config_checksum_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_image_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_image_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_image_desc_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_image_desc_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_lacp_convergence_notif_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+
+    of_bsn_lacp_convergence_notif_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_convergence_notif_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_convergence_notif_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lacp_convergence_notif_convergence_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_lacp_convergence_notif_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_lacp_convergence_notif_actor_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_actor_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_convergence_notif_actor_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_actor_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_actor_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_convergence_notif_partner_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_convergence_notif_partner_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_lacp_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_lacp_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_lacp_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_lacp_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_lacp_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_LACP_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_lacp_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_lacp_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_lacp_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lacp_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_log_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_log_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_log_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_log_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_log_loglevel_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_log_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_command_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_lua_command_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_command_reply_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_command_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_lua_command_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_command_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_command_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_notification_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_bsn_lua_notification_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_notification_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_notification_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_notification_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_lua_upload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_str64_t str64;
+    of_octets_t octets;
+
+    of_bsn_lua_upload_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_upload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_lua_upload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_lua_upload_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_lua_upload_filename_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    of_bsn_lua_upload_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_pdu_rx_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_rx_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_rx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_timeout_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_rx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_pdu_rx_timeout_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_rx_timeout_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_rx_timeout_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_rx_timeout_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_rx_timeout_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+
+    of_bsn_pdu_tx_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_reply_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_pdu_tx_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    uint8_t val8;
+    of_octets_t octets;
+
+    of_bsn_pdu_tx_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_pdu_tx_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_tx_interval_ms_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_pdu_tx_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_pdu_tx_request_slot_num_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_pdu_tx_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_port_counter_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_port_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_port_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_port_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_port_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_PORT_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_port_counter_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_bsn_port_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_port_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_port_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_port_counter_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_set_aux_cxns_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_aux_cxns_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_num_aux_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_aux_cxns_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_aux_cxns_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_aux_cxns_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_aux_cxns_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_aux_cxns_request_num_aux_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_lacp_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+
+    of_bsn_set_lacp_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_lacp_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_lacp_reply_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_set_lacp_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+
+    of_bsn_set_lacp_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_lacp_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_lacp_request_enabled_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_lacp_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_set_lacp_request_actor_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_lacp_request_actor_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_set_lacp_request_actor_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_lacp_request_actor_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_lacp_request_actor_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_set_mirroring_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_set_mirroring_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_mirroring_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_mirroring_report_mirror_ports_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_bsn_set_pktin_suppression_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_pktin_suppression_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_pktin_suppression_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint16_t val16;
+    uint64_t val64;
+
+    of_bsn_set_pktin_suppression_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_pktin_suppression_request_enabled_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_set_pktin_suppression_request_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_set_pktin_suppression_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_bsn_set_switch_pipeline_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_set_switch_pipeline_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_switch_pipeline_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_set_switch_pipeline_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_desc_str_t desc_str;
+
+    of_bsn_set_switch_pipeline_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_set_switch_pipeline_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_set_switch_pipeline_request_pipeline_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_switch_pipeline_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_switch_pipeline_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_switch_pipeline_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_switch_pipeline_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_SWITCH_PIPELINE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_switch_pipeline_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_switch_pipeline_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_switch_pipeline_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_switch_pipeline_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_table_checksum_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_table_checksum_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_table_checksum_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_table_checksum_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_table_checksum_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_TABLE_CHECKSUM_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_table_checksum_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_table_checksum_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_table_checksum_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_checksum_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_table_set_buckets_size_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_bsn_table_set_buckets_size_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_set_buckets_size_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_table_set_buckets_size_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_table_set_buckets_size_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_table_set_buckets_size_buckets_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_takeover_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_takeover_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_takeover_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_takeover_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_time_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_bsn_time_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_time_reply_time_ms_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_time_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_time_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_time_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_create_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_reply_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_create_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_bsn_vport_t bsn_vport;
+
+    of_bsn_virtual_port_create_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_create_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_create_request_vport_bind(obj, &bsn_vport);
+    loci_binlog_object(s, &bsn_vport);
+}
+
+void
+of_bsn_virtual_port_remove_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_reply_status_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_virtual_port_remove_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_virtual_port_remove_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_virtual_port_remove_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_virtual_port_remove_request_vport_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_vlan_counter_clear_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_vlan_counter_clear_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_clear_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_clear_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vlan_counter_clear_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_vlan_counter_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_vlan_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vlan_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vlan_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vlan_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_VLAN_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_vlan_counter_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_vlan_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vlan_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vlan_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vlan_counter_stats_request_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_vrf_counter_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bsn_vrf_counter_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vrf_counter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vrf_counter_stats_reply_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_reply_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vrf_counter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_BSN_VRF_COUNTER_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_vrf_counter_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_bsn_vrf_counter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vrf_counter_stats_request_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_vrf_counter_stats_request_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vrf_counter_stats_request_vrf_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bundle_add_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bundle_add_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bundle_add_msg_bundle_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bundle_add_msg_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bundle_add_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bundle_ctrl_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_bundle_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bundle_ctrl_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bundle_ctrl_msg_bundle_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bundle_ctrl_msg_bundle_ctrl_type_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bundle_ctrl_msg_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bundle_ctrl_msg_properties_bind(obj, &list);
+    OF_LIST_BUNDLE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bundle_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_bundle_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bundle_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bundle_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_desc_str_t desc_str;
+    of_serial_num_t ser_num;
+
+    of_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_desc_stats_reply_mfr_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_hw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_sw_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+
+    of_desc_stats_reply_serial_num_get(obj, &ser_num);
+    LOCI_BINLOG_ser_num(s, ser_num);
+
+    of_desc_stats_reply_dp_desc_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_echo_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_reply_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_echo_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_echo_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_echo_request_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_features_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+
+    of_features_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_datapath_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_features_reply_n_buffers_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_features_reply_n_tables_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_features_reply_auxiliary_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_features_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_features_reply_reserved_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_features_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_features_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_flow_add_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_add_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_add_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_add_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_add_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_add_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_add_importance_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_add_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_add_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_importance_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_delete_strict_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_delete_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_delete_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_delete_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_delete_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_delete_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_delete_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_delete_strict_importance_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_delete_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_delete_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_mod_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_flow_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_flow_modify_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_importance_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_modify_strict_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint8_t val8;
+    uint16_t val16;
+    of_port_no_t port_no;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_modify_strict_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_modify_strict_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_modify_strict_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_modify_strict_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_modify_strict_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_modify_strict_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_modify_strict_importance_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_modify_strict_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_modify_strict_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_monitor_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_flow_monitor_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_monitor_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_monitor_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_flow_removed_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    uint16_t val16;
+    uint8_t val8;
+    of_match_t match;
+
+    of_flow_removed_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_removed_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_removed_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_flow_removed_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_removed_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_removed_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_removed_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_removed_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_flow_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_flow_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_reply_entries_bind(obj, &list);
+    OF_LIST_FLOW_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_flow_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    of_port_no_t port_no;
+    uint64_t val64;
+    of_match_t match;
+
+    of_flow_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_flow_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_stats_request_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_request_out_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_flow_stats_request_out_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_request_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_cookie_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_request_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+}
+
+void
+of_get_config_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_get_config_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_get_config_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_get_config_reply_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_get_config_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_get_config_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_group_add_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_add_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_add_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_add_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_add_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_delete_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_delete_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_delete_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_delete_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_delete_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_desc_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_DESC_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_group_features_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_features_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_group_features_stats_reply_types_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_max_groups_all_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_select_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_indirect_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_max_groups_ff_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_features_stats_reply_actions_all_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_select_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_indirect_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_reply_actions_ff_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_group_features_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_features_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_features_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_group_mod_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_group_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_group_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_group_modify_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_modify_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_modify_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_modify_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_modify_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_group_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_reply_entries_bind(obj, &list);
+    OF_LIST_GROUP_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_group_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_group_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_group_stats_request_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_hello_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_hello_elem_t list;
+    of_object_t elt;
+    int rv;
+
+    of_hello_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_hello_elements_bind(obj, &list);
+    OF_LIST_HELLO_ELEM_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_hello_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_hello_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_hello_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_hello_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_meter_config_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_meter_config_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_config_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_config_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_config_stats_reply_entries_bind(obj, &list);
+    OF_LIST_METER_CONFIG_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_config_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_meter_config_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_config_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_config_stats_request_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_meter_features_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_meter_features_t features;
+
+    of_meter_features_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_features_stats_reply_features_bind(obj, &features);
+    loci_binlog_object(s, &features);
+}
+
+void
+of_meter_features_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_meter_features_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_meter_mod_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_meter_band_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_mod_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_mod_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_mod_bands_bind(obj, &list);
+    OF_LIST_METER_BAND_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_mod_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_meter_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_meter_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_meter_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_meter_stats_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_stats_reply_entries_bind(obj, &list);
+    OF_LIST_METER_STATS_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_meter_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_stats_request_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_packet_in_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+    uint64_t val64;
+    of_match_t match;
+    of_octets_t octets;
+
+    of_packet_in_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_in_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_in_total_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_packet_in_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_packet_in_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_packet_in_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_packet_in_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    of_packet_in_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_packet_out_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+    of_octets_t octets;
+
+    of_packet_out_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_packet_out_buffer_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_out_in_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_out_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    of_packet_out_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_desc_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_DESC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_port_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_port_mod_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_list_port_mod_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_mod_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_mod_properties_bind(obj, &list);
+    OF_LIST_PORT_MOD_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_mod_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_port_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_port_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_port_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_stats_reply_entries_bind(obj, &list);
+    OF_LIST_PORT_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_port_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_port_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_port_status_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_port_desc_t port_desc;
+
+    of_port_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_port_status_desc_bind(obj, &port_desc);
+    loci_binlog_object(s, &port_desc);
+}
+
+void
+of_queue_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_queue_desc_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_QUEUE_DESC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_queue_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_queue_desc_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_desc_stats_request_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_queue_op_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_queue_op_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_op_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_queue_op_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_queue_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_queue_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_stats_reply_entries_bind(obj, &list);
+    OF_LIST_QUEUE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_no_t port_no;
+
+    of_queue_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_queue_stats_request_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_request_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_requestforward_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_requestforward_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_requestforward_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_requestforward_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_role_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_role_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_reply_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_reply_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_role_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_role_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_role_request_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_role_request_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_request_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_role_request_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_role_status_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    uint64_t val64;
+    of_list_role_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_role_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_status_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_role_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_role_status_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_role_status_properties_bind(obj, &list);
+    OF_LIST_ROLE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_set_config_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_set_config_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_set_config_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_set_config_miss_send_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_switch_config_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_switch_config_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_switch_config_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_switch_config_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_desc_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_desc_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_desc_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_desc_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_desc_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_DESC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_desc_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_table_desc_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_desc_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_table_features_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_table_features_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_table_features_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_features_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_features_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_features_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_features_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_FEATURES_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_features_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_features_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_features_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_features_stats_request_entries_bind(obj, &list);
+    OF_LIST_TABLE_FEATURES_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_mod_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_list_table_mod_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_mod_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_mod_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_mod_properties_bind(obj, &list);
+    OF_LIST_TABLE_MOD_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_mod_failed_error_msg_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_octets_t octets;
+
+    of_table_mod_failed_error_msg_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_mod_failed_error_msg_code_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_table_mod_failed_error_msg_data_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_table_stats_reply_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_list_table_stats_entry_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_stats_reply_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_reply_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_stats_reply_entries_bind(obj, &list);
+    OF_LIST_TABLE_STATS_ENTRY_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_stats_request_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_table_stats_request_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_stats_request_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_table_status_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+    of_table_desc_t table_desc;
+
+    of_table_status_xid_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_status_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_status_reason_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+
+    of_table_status_table_bind(obj, &table_desc);
+    loci_binlog_object(s, &table_desc);
+}
+
+void
+of_action_bsn_checksum_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_checksum_128_t checksum_128;
+
+    of_action_bsn_checksum_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_checksum_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_checksum_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_action_bsn_gentable_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_action_bsn_gentable_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_gentable_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_gentable_table_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_action_bsn_gentable_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_action_bsn_mirror_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_action_bsn_mirror_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_mirror_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_dest_port_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_vlan_tag_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_mirror_copy_stage_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_bsn_set_tunnel_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_bsn_set_tunnel_dst_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_bsn_set_tunnel_dst_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_copy_ttl_in_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_copy_ttl_out_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_mpls_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_dec_nw_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_group_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_group_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_checksum_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_checksum_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_checksum_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_gentable_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_gentable_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_gentable_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_mirror_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_mirror_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_mirror_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_id_bsn_set_tunnel_dst_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_bsn_set_tunnel_dst_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_action_id_copy_ttl_in_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_copy_ttl_out_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_dec_mpls_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_dec_nw_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_group_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_nicira_dec_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_dec_ttl_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_dec_ttl_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_move_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_move_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_move_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_pop_nsh_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_pop_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_pop_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_push_nsh_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_push_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_push_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_resubmit_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_resubmit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_resubmit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_nicira_resubmit_table_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_id_nicira_resubmit_table_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_id_nicira_resubmit_table_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_id_output_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_pop_mpls_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_pop_pbb_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_pop_vlan_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_push_mpls_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_push_pbb_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_push_vlan_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_field_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_mpls_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_nw_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_id_set_queue_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_nicira_dec_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_dec_ttl_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_dec_ttl_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_move_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_move_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_move_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_n_bits_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_dst_ofs_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_move_src_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_action_nicira_move_dst_get(obj, &val32);
+    LOCI_BINLOG_ipv4(s, val32);
+}
+
+void
+of_action_nicira_pop_nsh_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_pop_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_pop_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_push_nsh_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_action_nicira_push_nsh_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_push_nsh_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_nicira_resubmit_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_nicira_resubmit_table_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t val8;
+
+    of_action_nicira_resubmit_table_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_action_nicira_resubmit_table_subtype_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_in_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_action_nicira_resubmit_table_table_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_output_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint16_t val16;
+
+    of_action_output_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_action_output_max_len_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_action_pop_mpls_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_pop_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_pop_pbb_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_pop_vlan_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_action_push_mpls_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_mpls_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_push_pbb_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_pbb_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_push_vlan_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_action_push_vlan_ethertype_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_action_set_field_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_oxm_t oxm;
+
+    of_action_set_field_field_bind(obj, &oxm);
+    loci_binlog_object(s, &oxm);
+}
+
+void
+of_action_set_mpls_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_mpls_ttl_mpls_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_nw_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_action_set_nw_ttl_nw_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_action_set_queue_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_action_set_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_async_config_prop_experimenter_master_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_async_config_prop_experimenter_slave_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_async_config_prop_flow_removed_master_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_flow_removed_master_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_flow_removed_slave_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_flow_removed_slave_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_packet_in_master_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_packet_in_master_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_packet_in_slave_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_packet_in_slave_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_port_status_master_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_port_status_master_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_port_status_slave_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_port_status_slave_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_requestforward_master_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_requestforward_master_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_requestforward_slave_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_requestforward_slave_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_role_status_master_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_role_status_master_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_role_status_slave_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_role_status_slave_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_table_status_master_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_table_status_master_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_async_config_prop_table_status_slave_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_async_config_prop_table_status_slave_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_bsn_controller_connection_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    of_desc_str_t desc_str;
+
+    of_bsn_controller_connection_state_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_controller_connection_auxiliary_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_controller_connection_role_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_bsn_controller_connection_uri_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+    of_str64_t str64;
+    of_desc_str_t desc_str;
+
+    of_bsn_debug_counter_desc_stats_entry_counter_id_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bsn_debug_counter_desc_stats_entry_name_get(obj, &str64);
+    LOCI_BINLOG_str64(s, str64);
+
+    of_bsn_debug_counter_desc_stats_entry_description_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_debug_counter_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_debug_counter_stats_entry_counter_id_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bsn_debug_counter_stats_entry_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_flow_checksum_bucket_stats_entry_checksum_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_generic_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_generic_stats_entry_tlvs_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_bucket_stats_entry_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_gentable_desc_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_table_name_t table_name;
+    uint32_t val32;
+
+    of_bsn_gentable_desc_stats_entry_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_desc_stats_entry_name_get(obj, &table_name);
+    LOCI_BINLOG_tab_name(s, table_name);
+
+    of_bsn_gentable_desc_stats_entry_buckets_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_desc_stats_entry_max_entries_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_checksum_128_t checksum_128;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_gentable_entry_desc_stats_entry_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_desc_stats_entry_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_desc_stats_entry_value_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_entry_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_stats_entry_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_gentable_entry_stats_entry_stats_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_gentable_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    uint32_t val32;
+    of_checksum_128_t checksum_128;
+
+    of_bsn_gentable_stats_entry_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_gentable_stats_entry_entry_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_gentable_stats_entry_checksum_get(obj, &checksum_128);
+    LOCI_BINLOG_checksum_128(s, checksum_128);
+}
+
+void
+of_bsn_interface_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    of_ipv4_t ipv4;
+
+    of_bsn_interface_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_interface_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_bsn_interface_ipv4_addr_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_interface_ipv4_netmask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_lacp_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+    uint8_t val8;
+
+    of_bsn_lacp_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_lacp_stats_entry_actor_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_actor_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_stats_entry_actor_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_actor_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_actor_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_convergence_status_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_lacp_stats_entry_partner_sys_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_partner_sys_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_lacp_stats_entry_partner_port_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_partner_port_num_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_lacp_stats_entry_partner_key_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_port_counter_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_port_counter_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_port_counter_stats_entry_values_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_desc_str_t desc_str;
+
+    of_bsn_switch_pipeline_stats_entry_pipeline_get(obj, &desc_str);
+    LOCI_BINLOG_desc_str(s, desc_str);
+}
+
+void
+of_bsn_table_checksum_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint64_t val64;
+
+    of_bsn_table_checksum_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_table_checksum_stats_entry_checksum_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_actor_key_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_key_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_actor_port_num_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_port_num_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_actor_port_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_port_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_actor_state_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_actor_state_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_actor_system_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_actor_system_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_actor_system_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_actor_system_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_anchor_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_anchor_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_apply_bytes_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_apply_bytes_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_apply_packets_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_apply_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_auto_negotiation_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_auto_negotiation_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_broadcast_query_timeout_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_broadcast_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_broadcast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_bucket_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_bucket_value_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_circuit_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_circuit_id_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_convergence_status_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_convergence_status_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_cpu_lag_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_crc_enabled_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_crc_enabled_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_data_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_data_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_data_mask_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_data_mask_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_decap_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_decap_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_drop_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_dscp_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_dscp_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_ecn_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_ecn_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_egress_only_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_egress_port_group_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_egress_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_enhanced_hash_capability_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_eth_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_eth_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_eth_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_external_gateway_ip_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_external_gateway_ip_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_external_gateway_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_external_gateway_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_external_ip_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_external_ip_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_external_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_external_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_external_netmask_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_external_netmask_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_generation_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_generation_id_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_hash_gtp_header_match_first_header_byte_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_tlv_hash_gtp_header_match_first_header_mask_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint16_t val16;
+
+    of_bsn_tlv_hash_gtp_port_match_match_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_tlv_hash_gtp_port_match_src_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_tlv_hash_gtp_port_match_dst_port_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_hash_packet_field_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_hash_packet_field_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_hash_packet_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_hash_packet_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_hash_seed_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_hash_seed_seed1_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_tlv_hash_seed_seed2_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_hash_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_hash_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_header_size_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_header_size_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_icmp_code_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_icmp_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_icmp_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_icmp_id_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_icmp_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_icmp_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_icmpv6_chksum_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_idle_notification_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_idle_time_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_idle_time_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_idle_timeout_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_idle_timeout_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_igmp_snooping_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_ingress_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_internal_gateway_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_internal_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_internal_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_interval_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_interval_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_ip_proto_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_ip_proto_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_ipv4_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv4_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv4_netmask_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_netmask_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv4_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_ipv6_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_bsn_tlv_ipv6_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_bsn_tlv_ipv6_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_bsn_tlv_ipv6_dst_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_bsn_tlv_ipv6_prefix_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+    uint8_t val8;
+
+    of_bsn_tlv_ipv6_prefix_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_bsn_tlv_ipv6_prefix_prefix_length_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_ipv6_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_bsn_tlv_ipv6_src_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_bsn_tlv_known_multicast_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_known_multicast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_l3_dst_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_l3_interface_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_l3_src_class_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_l3_src_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_loopback_port_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_bsn_tlv_loopback_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_tlv_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_mac_mask_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_mac_mask_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_miss_packets_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_miss_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_mpls_control_word_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_mpls_control_word_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_mpls_label_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_mpls_label_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_mpls_sequenced_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_mpls_sequenced_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_multicast_interface_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_multicast_interface_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_name_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_octets_t octets;
+
+    of_bsn_tlv_name_value_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_bsn_tlv_ndp_offload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_ndp_static_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_negate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_bsn_tlv_next_hop_ipv4_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_bsn_tlv_next_hop_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_next_hop_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_offset_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_offset_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_parent_port_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_bsn_tlv_parent_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_tlv_partner_key_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_key_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_partner_port_num_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_port_num_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_partner_port_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_port_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_partner_state_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_partner_state_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_partner_system_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_bsn_tlv_partner_system_mac_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_tlv_partner_system_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_partner_system_priority_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_port_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_bsn_tlv_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_bsn_tlv_port_usage_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_port_usage_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_port_vxlan_mode_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_priority_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_qos_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_qos_priority_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_queue_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_queue_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_queue_weight_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_queue_weight_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_rate_limit_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_rate_limit_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_rate_unit_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_rate_unit_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_reference_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_list_bsn_tlv_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_tlv_reference_table_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_reference_key_bind(obj, &list);
+    OF_LIST_BSN_TLV_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_reply_packets_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_reply_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_request_packets_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_request_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_rx_bytes_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_rx_bytes_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_rx_packets_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_rx_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_sampling_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_sampling_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_set_loopback_mode_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_status_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_status_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_sub_agent_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_sub_agent_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_tcp_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_tcp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_tcp_flags_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_tcp_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_tcp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_ttl_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_ttl_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_tunnel_capability_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_tunnel_capability_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_tx_bytes_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_tx_bytes_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_tx_packets_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bsn_tlv_tx_packets_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_bsn_tlv_udf_anchor_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_anchor_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udf_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_id_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udf_length_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_length_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udf_offset_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udf_offset_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udp_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_udp_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_udp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_uint64_list_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_uint64_list_value_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_unicast_query_timeout_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_unicast_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_unicast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_unknown_multicast_rate_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_untagged_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_tlv_use_packet_state_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_use_packet_state_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_vfi_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_vfi_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_vfp_class_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vfp_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vlan_mac_list_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_bsn_vlan_mac_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_tlv_vlan_mac_list_key_bind(obj, &list);
+    OF_LIST_BSN_VLAN_MAC_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_tlv_vlan_pcp_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_bsn_tlv_vlan_pcp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_bsn_tlv_vlan_vid_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_vlan_vid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_bsn_tlv_vlan_vid_mask_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_bsn_tlv_vni_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vni_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vpn_key_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vpn_key_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vrf_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_bsn_tlv_vrf_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_bsn_vlan_counter_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vlan_counter_stats_entry_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vlan_counter_stats_entry_values_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bsn_vlan_mac_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_mac_addr_t mac_addr;
+
+    of_bsn_vlan_mac_vlan_vid_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vlan_mac_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_bsn_vport_l2gre_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_ipv4_t ipv4;
+    uint8_t val8;
+    of_port_name_t port_name;
+
+    of_bsn_vport_l2gre_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_loopback_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bsn_vport_l2gre_local_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_nh_mac_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_bsn_vport_l2gre_src_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dst_ip_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_bsn_vport_l2gre_dscp_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_ttl_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_bsn_vport_l2gre_vpn_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_rate_limit_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_l2gre_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bsn_vport_q_in_q_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+    of_port_name_t port_name;
+
+    of_bsn_vport_q_in_q_port_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_bsn_vport_q_in_q_ingress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_ingress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_tpid_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_bsn_vport_q_in_q_egress_vlan_id_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bsn_vport_q_in_q_if_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+}
+
+void
+of_bsn_vrf_counter_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_uint64_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bsn_vrf_counter_stats_entry_vrf_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bsn_vrf_counter_stats_entry_values_bind(obj, &list);
+    OF_LIST_UINT64_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bucket_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    of_port_no_t port_no;
+    uint32_t val32;
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    of_bucket_weight_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_bucket_watch_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_bucket_watch_group_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_bucket_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_bucket_counter_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_bucket_counter_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_bucket_counter_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_flow_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    uint16_t val16;
+    uint64_t val64;
+    of_match_t match;
+    of_list_instruction_t list;
+    of_object_t elt;
+    int rv;
+
+    of_flow_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_flow_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_flow_stats_entry_priority_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_idle_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_hard_timeout_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_flow_stats_entry_importance_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_flow_stats_entry_cookie_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_flow_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_flow_stats_entry_match_get(obj, &match);
+    LOCI_BINLOG_match(s, match);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_flow_stats_entry_instructions_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_desc_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    of_list_bucket_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_desc_stats_entry_group_type_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_group_desc_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_desc_stats_entry_buckets_bind(obj, &list);
+    OF_LIST_BUCKET_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_group_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    of_list_bucket_counter_t list;
+    of_object_t elt;
+    int rv;
+
+    of_group_stats_entry_group_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_ref_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_packet_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_group_stats_entry_byte_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_group_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_group_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_group_stats_entry_bucket_stats_bind(obj, &list);
+    OF_LIST_BUCKET_COUNTER_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_hello_elem_versionbitmap_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_hello_elem_versionbitmap_bitmaps_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_apply_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_apply_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_bsn_arp_offload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_arp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_arp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_auto_negotiation_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_auto_negotiation_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_auto_negotiation_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_deny_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_deny_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_deny_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_dhcp_offload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_dhcp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_dhcp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_disable_l3_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_disable_l3_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_disable_l3_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_disable_src_mac_check_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_disable_src_mac_check_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_disable_vlan_counters_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_disable_vlan_counters_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_hash_select_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_hash_select_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_hash_select_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_instruction_bsn_hash_select_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_internal_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_internal_priority_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_internal_priority_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_instruction_bsn_internal_priority_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_ndp_offload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_ndp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_ndp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_packet_of_death_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_packet_of_death_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_packet_of_death_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_permit_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_permit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_permit_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_prioritize_pdus_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_prioritize_pdus_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_prioritize_pdus_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_require_vlan_xlate_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_require_vlan_xlate_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_bsn_span_destination_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_bsn_span_destination_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_bsn_span_destination_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_clear_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_goto_table_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_instruction_goto_table_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_instruction_id_apply_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_bsn_arp_offload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_arp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_arp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_auto_negotiation_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_auto_negotiation_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_deny_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_deny_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_deny_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_dhcp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_dhcp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_disable_l3_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_disable_l3_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_disable_l3_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_disable_src_mac_check_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_disable_src_mac_check_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_disable_vlan_counters_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_disable_vlan_counters_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_hash_select_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_hash_select_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_hash_select_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_internal_priority_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_internal_priority_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_internal_priority_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_ndp_offload_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_ndp_offload_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_ndp_offload_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_packet_of_death_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_packet_of_death_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_packet_of_death_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_permit_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_permit_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_permit_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_prioritize_pdus_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_prioritize_pdus_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_require_vlan_xlate_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_require_vlan_xlate_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_bsn_span_destination_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_id_bsn_span_destination_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_instruction_id_bsn_span_destination_subtype_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_id_clear_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_goto_table_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_meter_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_write_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_id_write_metadata_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+}
+
+void
+of_instruction_meter_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_instruction_meter_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_instruction_write_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_instruction_write_actions_actions_bind(obj, &list);
+    OF_LIST_ACTION_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_instruction_write_metadata_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_instruction_write_metadata_metadata_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_instruction_write_metadata_metadata_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_match_v3_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_oxm_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_match_v3_oxm_list_bind(obj, &list);
+    OF_LIST_OXM_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_band_drop_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_meter_band_drop_rate_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_drop_burst_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_meter_band_dscp_remark_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_meter_band_dscp_remark_rate_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_dscp_remark_burst_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_dscp_remark_prec_level_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_meter_band_experimenter_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_meter_band_experimenter_rate_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_experimenter_burst_size_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_band_experimenter_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_meter_band_stats_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_meter_band_stats_packet_band_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_meter_band_stats_byte_band_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_meter_config_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+    uint32_t val32;
+    of_list_meter_band_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_config_flags_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+
+    of_meter_config_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_config_entries_bind(obj, &list);
+    OF_LIST_METER_BAND_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_meter_features_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint8_t val8;
+
+    of_meter_features_max_meter_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_features_band_types_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_capabilities_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_meter_features_max_bands_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_meter_features_max_color_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_meter_stats_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+    of_list_meter_band_stats_t list;
+    of_object_t elt;
+    int rv;
+
+    of_meter_stats_meter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_stats_flow_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_stats_packet_in_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_meter_stats_byte_in_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_meter_stats_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_meter_stats_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_meter_stats_band_stats_bind(obj, &list);
+    OF_LIST_METER_BAND_STATS_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_oxm_arp_op_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_arp_op_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_arp_op_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_arp_op_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_arp_op_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_arp_sha_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_sha_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_sha_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_sha_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_arp_sha_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_spa_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_spa_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_arp_spa_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_spa_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_arp_spa_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_arp_tha_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_tha_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_tha_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_arp_tha_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_arp_tha_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_arp_tpa_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_tpa_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_arp_tpa_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_arp_tpa_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_arp_tpa_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_egr_port_group_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_egr_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_egr_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_egr_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_in_ports_128_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_128_t bitmap_128;
+
+    of_oxm_bsn_in_ports_128_value_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+}
+
+void
+of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_128_t bitmap_128;
+
+    of_oxm_bsn_in_ports_128_masked_value_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+
+    of_oxm_bsn_in_ports_128_masked_value_mask_get(obj, &bitmap_128);
+    LOCI_BINLOG_bitmap_128(s, bitmap_128);
+}
+
+void
+of_oxm_bsn_in_ports_512_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_512_t bitmap_512;
+
+    of_oxm_bsn_in_ports_512_value_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+}
+
+void
+of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_bitmap_512_t bitmap_512;
+
+    of_oxm_bsn_in_ports_512_masked_value_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+
+    of_oxm_bsn_in_ports_512_masked_value_mask_get(obj, &bitmap_512);
+    LOCI_BINLOG_bitmap_512(s, bitmap_512);
+}
+
+void
+of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_ingress_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_ingress_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_ingress_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_inner_eth_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_bsn_inner_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_eth_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_bsn_inner_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_bsn_inner_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_inner_vlan_vid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_inner_vlan_vid_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_bsn_inner_vlan_vid_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_bsn_ip_fragmentation_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_ip_fragmentation_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_ip_fragmentation_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_ip_fragmentation_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_l2_cache_hit_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_l2_cache_hit_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_bsn_l2_cache_hit_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_bsn_l2_cache_hit_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_interface_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_interface_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_interface_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_src_class_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_src_class_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_l3_src_class_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_l3_src_class_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_lag_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_lag_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_lag_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_lag_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_lag_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_tcp_flags_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_tcp_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_bsn_tcp_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_bsn_udf0_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf0_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf0_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf0_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf0_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf1_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf1_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf1_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf1_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf1_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf2_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf2_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf2_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf2_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf2_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf3_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf3_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf3_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf3_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf3_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf4_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf4_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf4_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf4_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf4_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf5_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf5_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf5_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf5_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf5_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf6_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf6_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf6_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf6_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf6_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_udf7_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf7_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_udf7_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_udf7_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_udf7_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vfi_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_vfi_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_bsn_vfi_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_bsn_vfi_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_bsn_vfi_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vlan_xlate_port_group_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vrf_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vrf_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vrf_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vrf_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vrf_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_bsn_vxlan_network_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vxlan_network_id_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_bsn_vxlan_network_id_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_bsn_vxlan_network_id_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_encap_eth_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_encap_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_encap_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_encap_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_encap_eth_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_encap_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_encap_eth_type_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_encap_eth_type_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_encap_eth_type_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_eth_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_dst_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_dst_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_eth_dst_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_src_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_eth_src_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_eth_src_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_eth_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_eth_type_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_eth_type_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_eth_type_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_eth_type_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_icmpv4_code_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv4_code_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_code_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv4_code_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv4_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv4_type_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv4_type_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv4_type_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv6_code_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_code_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv6_code_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_code_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv6_code_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_icmpv6_type_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_type_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_icmpv6_type_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_icmpv6_type_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_icmpv6_type_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_in_phy_port_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_phy_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_phy_port_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_phy_port_masked_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_oxm_in_phy_port_masked_value_mask_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_port_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_port_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_in_port_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+
+    of_oxm_in_port_masked_value_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_oxm_in_port_masked_value_mask_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+}
+
+void
+of_oxm_ip_dscp_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_dscp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_dscp_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_dscp_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_dscp_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ip_ecn_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_ecn_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_ecn_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_ecn_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_ecn_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ip_proto_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_proto_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_ip_proto_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_ip_proto_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_ip_proto_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_ipv4_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_dst_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_ipv4_dst_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv4_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_ipv4_src_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_ipv4_src_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_ipv6_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_dst_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_dst_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_dst_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_exthdr_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_ipv6_exthdr_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_ipv6_exthdr_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_ipv6_exthdr_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_ipv6_exthdr_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_ipv6_flabel_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ipv6_flabel_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_ipv6_flabel_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_ipv6_flabel_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ipv6_flabel_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_ipv6_nd_sll_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_sll_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_sll_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_ipv6_nd_sll_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_target_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_nd_target_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_nd_target_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_nd_target_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_nd_target_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_nd_tll_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_tll_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_mac_addr_t mac_addr;
+
+    of_oxm_ipv6_nd_tll_masked_value_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_oxm_ipv6_nd_tll_masked_value_mask_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+}
+
+void
+of_oxm_ipv6_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_src_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_ipv6_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv6_t ipv6;
+
+    of_oxm_ipv6_src_masked_value_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+
+    of_oxm_ipv6_src_masked_value_mask_get(obj, &ipv6);
+    LOCI_BINLOG_ipv6(s, ipv6);
+}
+
+void
+of_oxm_metadata_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_metadata_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_oxm_metadata_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_metadata_masked_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_oxm_metadata_masked_value_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_oxm_mpls_bos_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_bos_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_mpls_bos_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_bos_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_mpls_bos_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_mpls_label_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_mpls_label_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_mpls_label_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_mpls_label_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_mpls_label_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_mpls_tc_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_tc_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_mpls_tc_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_mpls_tc_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_mpls_tc_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsh_c1_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c1_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c1_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c1_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c1_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c2_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c2_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c2_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c2_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c2_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c3_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c3_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c3_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c3_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c3_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_c4_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c4_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsh_c4_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsh_c4_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsh_c4_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_nsh_mdtype_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_mdtype_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsh_mdtype_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_mdtype_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsh_mdtype_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsh_np_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_np_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsh_np_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsh_np_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsh_np_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsi_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsi_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_nsi_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_nsi_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_nsi_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_nsp_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsp_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_oxm_nsp_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_oxm_nsp_masked_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_nsp_masked_value_mask_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_oxm_ovs_tcp_flags_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ovs_tcp_flags_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ovs_tcp_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_oxm_ovs_tcp_flags_masked_experimenter_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_oxm_ovs_tcp_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_ovs_tcp_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_pbb_uca_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_pbb_uca_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_pbb_uca_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_pbb_uca_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_pbb_uca_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_sctp_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_sctp_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_sctp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_sctp_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_sctp_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_sctp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_sctp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tcp_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tcp_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tcp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tcp_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tcp_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tcp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tcp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_flags_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_flags_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tun_flags_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_flags_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tun_flags_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_gbp_flags_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gbp_flags_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gbp_flags_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gbp_flags_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gbp_flags_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tun_gbp_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_gbp_id_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_tun_gbp_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_tun_gbp_id_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_tun_gbp_id_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_tun_gpe_flags_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_flags_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_flags_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_flags_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gpe_flags_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_np_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_np_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_tun_gpe_np_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_tun_gpe_np_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_tun_gpe_np_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_tunnel_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_tunnel_id_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_oxm_tunnel_id_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_oxm_tunnel_id_masked_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_oxm_tunnel_id_masked_value_mask_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_oxm_tunnel_ipv4_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_dst_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_dst_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_tunnel_ipv4_dst_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_src_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_ipv4_t ipv4;
+
+    of_oxm_tunnel_ipv4_src_masked_value_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+
+    of_oxm_tunnel_ipv4_src_masked_value_mask_get(obj, &ipv4);
+    LOCI_BINLOG_ipv4(s, ipv4);
+}
+
+void
+of_oxm_udp_dst_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_dst_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_udp_dst_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_dst_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_udp_dst_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_udp_src_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_src_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_udp_src_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_udp_src_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_udp_src_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_oxm_vlan_pcp_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_vlan_pcp_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_oxm_vlan_pcp_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_oxm_vlan_pcp_masked_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_oxm_vlan_pcp_masked_value_mask_get(obj, &val8);
+    LOCI_BINLOG_x8(s, val8);
+}
+
+void
+of_oxm_vlan_vid_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_vlan_vid_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_oxm_vlan_vid_masked_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_oxm_vlan_vid_masked_value_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_oxm_vlan_vid_masked_value_mask_get(obj, &val16);
+    LOCI_BINLOG_x16(s, val16);
+}
+
+void
+of_packet_queue_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_port_no_t port_no;
+    of_list_queue_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_packet_queue_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_packet_queue_port_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_packet_queue_properties_bind(obj, &list);
+    OF_LIST_QUEUE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    of_mac_addr_t mac_addr;
+    of_port_name_t port_name;
+    uint32_t val32;
+    of_list_port_desc_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_desc_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_desc_hw_addr_get(obj, &mac_addr);
+    LOCI_BINLOG_mac(s, mac_addr);
+
+    of_port_desc_name_get(obj, &port_name);
+    LOCI_BINLOG_port_name(s, port_name);
+
+    of_port_desc_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_state_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_desc_properties_bind(obj, &list);
+    OF_LIST_PORT_DESC_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_desc_prop_bsn_forward_error_correction_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_port_desc_prop_bsn_forward_error_correction_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_prop_bsn_forward_error_correction_exp_type_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_bsn_forward_error_correction_configured_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_bsn_forward_error_correction_enabled_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_desc_prop_bsn_generation_id_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint64_t val64;
+
+    of_port_desc_prop_bsn_generation_id_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_prop_bsn_generation_id_exp_type_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_bsn_generation_id_generation_id_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+}
+
+void
+of_port_desc_prop_bsn_uplink_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_port_desc_prop_bsn_uplink_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_prop_bsn_uplink_exp_type_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_desc_prop_ethernet_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_port_desc_prop_ethernet_curr_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_ethernet_advertised_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_prop_ethernet_supported_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_prop_ethernet_peer_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_prop_ethernet_curr_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_ethernet_max_speed_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_desc_prop_optical_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_port_desc_prop_optical_supported_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_port_desc_prop_optical_tx_min_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_optical_tx_max_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_optical_tx_grid_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_optical_rx_min_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_optical_rx_max_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_optical_rx_grid_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_optical_tx_pwr_min_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_desc_prop_optical_tx_pwr_max_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_mod_prop_ethernet_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_port_mod_prop_ethernet_advertise_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_port_mod_prop_optical_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_port_mod_prop_optical_configure_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_mod_prop_optical_freq_ldma_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_mod_prop_optical_fl_offset_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_mod_prop_optical_grid_span_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_mod_prop_optical_tx_pwr_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_port_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint32_t val32;
+    uint64_t val64;
+    of_list_port_stats_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_port_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_port_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_entry_rx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_dropped_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_rx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_port_stats_entry_properties_bind(obj, &list);
+    OF_LIST_PORT_STATS_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_port_stats_prop_ethernet_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_port_stats_prop_ethernet_rx_frame_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_prop_ethernet_rx_over_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_prop_ethernet_rx_crc_err_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_port_stats_prop_ethernet_collisions_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_port_stats_prop_optical_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    uint16_t val16;
+
+    of_port_stats_prop_optical_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_prop_optical_tx_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_prop_optical_tx_offset_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_prop_optical_tx_grid_span_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_prop_optical_rx_freq_lmda_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_prop_optical_rx_offset_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_prop_optical_rx_grid_span_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_port_stats_prop_optical_tx_pwr_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_stats_prop_optical_rx_pwr_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_stats_prop_optical_bias_current_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+
+    of_port_stats_prop_optical_temperature_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_desc_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_list_queue_desc_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_desc_port_no_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_desc_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_desc_properties_bind(obj, &list);
+    OF_LIST_QUEUE_DESC_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_queue_desc_prop_bsn_queue_name_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+    of_octets_t octets;
+
+    of_queue_desc_prop_bsn_queue_name_experimenter_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_queue_desc_prop_bsn_queue_name_exp_type_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_desc_prop_bsn_queue_name_name_get(obj, &octets);
+    LOCI_BINLOG_octets(s, octets);
+}
+
+void
+of_queue_desc_prop_max_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_desc_prop_max_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_desc_prop_min_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_desc_prop_min_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_prop_max_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_max_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_prop_min_rate_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t val16;
+
+    of_queue_prop_min_rate_rate_get(obj, &val16);
+    LOCI_BINLOG_u16(s, val16);
+}
+
+void
+of_queue_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_port_no_t port_no;
+    uint32_t val32;
+    uint64_t val64;
+    of_list_queue_stats_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_queue_stats_entry_port_no_get(obj, &port_no);
+    LOCI_BINLOG_port_no(s, port_no);
+
+    of_queue_stats_entry_queue_id_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_stats_entry_tx_bytes_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_packets_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_tx_errors_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_queue_stats_entry_duration_sec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_queue_stats_entry_duration_nsec_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_queue_stats_entry_properties_bind(obj, &list);
+    OF_LIST_QUEUE_STATS_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_desc_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+
+    of_table_desc_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_desc_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+}
+
+void
+of_table_feature_prop_apply_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_actions_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_apply_actions_miss_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_actions_miss_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_apply_setfield_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_setfield_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_apply_setfield_miss_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_instructions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_instruction_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_instructions_instruction_ids_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_instructions_miss_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_instruction_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_instructions_miss_instruction_ids_bind(obj, &list);
+    OF_LIST_INSTRUCTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_match_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_match_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_next_tables_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint8_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_next_tables_next_table_ids_bind(obj, &list);
+    OF_LIST_UINT8_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_next_tables_miss_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint8_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_next_tables_miss_next_table_ids_bind(obj, &list);
+    OF_LIST_UINT8_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_table_sync_from_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint8_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_table_sync_from_table_ids_bind(obj, &list);
+    OF_LIST_UINT8_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_wildcards_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_wildcards_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_actions_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_actions_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_actions_miss_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_action_id_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_actions_miss_action_ids_bind(obj, &list);
+    OF_LIST_ACTION_ID_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_setfield_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_setfield_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_feature_prop_write_setfield_miss_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    of_list_uint32_t list;
+    of_object_t elt;
+    int rv;
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_feature_prop_write_setfield_miss_oxm_ids_bind(obj, &list);
+    OF_LIST_UINT32_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_features_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    of_table_name_t table_name;
+    uint64_t val64;
+    uint32_t val32;
+    of_list_table_feature_prop_t list;
+    of_object_t elt;
+    int rv;
+
+    of_table_features_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_features_name_get(obj, &table_name);
+    LOCI_BINLOG_tab_name(s, table_name);
+
+    of_table_features_metadata_match_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_features_metadata_write_get(obj, &val64);
+    LOCI_BINLOG_x64(s, val64);
+
+    of_table_features_config_get(obj, &val32);
+    LOCI_BINLOG_x32(s, val32);
+
+    of_table_features_max_entries_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_LIST);
+    of_table_features_properties_bind(obj, &list);
+    OF_LIST_TABLE_FEATURE_PROP_ITER(&list, &elt, rv) {
+        loci_binlog_object(s, (of_object_t *)&elt);
+    }
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+void
+of_table_mod_prop_eviction_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_table_mod_prop_eviction_flags_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_table_mod_prop_vacancy_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_table_mod_prop_vacancy_vacancy_down_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_mod_prop_vacancy_vacancy_up_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_mod_prop_vacancy_vacancy_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+void
+of_table_stats_entry_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+    uint32_t val32;
+    uint64_t val64;
+
+    of_table_stats_entry_table_id_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+
+    of_table_stats_entry_active_count_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+
+    of_table_stats_entry_lookup_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+
+    of_table_stats_entry_matched_count_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_uint32_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint32_t val32;
+
+    of_uint32_value_get(obj, &val32);
+    LOCI_BINLOG_u32(s, val32);
+}
+
+void
+of_uint64_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint64_t val64;
+
+    of_uint64_value_get(obj, &val64);
+    LOCI_BINLOG_u64(s, val64);
+}
+
+void
+of_uint8_OF_VERSION_1_4_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint8_t val8;
+
+    of_uint8_value_get(obj, &val8);
+    LOCI_BINLOG_u8(s, val8);
+}
+
+const char *const loci_binlog_match_field_names[] = {
+    "in_port",
+    "in_phy_port",
+    "metadata",
+    "eth_dst",
+    "eth_src",
+    "eth_type",
+    "vlan_vid",
+    "vlan_pcp",
+    "ip_dscp",
+    "ip_ecn",
+    "ip_proto",
+    "ipv4_src",
+    "ipv4_dst",
+    "tcp_src",
+    "tcp_dst",
+    "udp_src",
+    "udp_dst",
+    "sctp_src",
+    "sctp_dst",
+    "icmpv4_type",
+    "icmpv4_code",
+    "arp_op",
+    "arp_spa",
+    "arp_tpa",
+    "arp_sha",
+    "arp_tha",
+    "ipv6_src",
+    "ipv6_dst",
+    "ipv6_flabel",
+    "icmpv6_type",
+    "icmpv6_code",
+    "ipv6_nd_target",
+    "ipv6_nd_sll",
+    "ipv6_nd_tll",
+    "mpls_label",
+    "mpls_tc",
+    "mpls_bos",
+    "tunnel_id",
+    "ipv6_exthdr",
+    "pbb_uca",
+    "circuit_och_sigtype_basic",
+    "circuit_och_sigid_basic",
+    "och_sigatt_basic",
+    "tunnel_ipv4_src",
+    "tunnel_ipv4_dst",
+    "tun_gbp_id",
+    "tun_gbp_flags",
+    "tun_flags",
+    "tun_gpe_np",
+    "tun_gpe_flags",
+    "nsp",
+    "nsi",
+    "nsh_c1",
+    "nsh_c2",
+    "nsh_c3",
+    "nsh_c4",
+    "nsh_mdtype",
+    "nsh_np",
+    "encap_eth_src",
+    "encap_eth_dst",
+    "encap_eth_type",
+    "bsn_in_ports_128",
+    "bsn_lag_id",
+    "bsn_vrf",
+    "bsn_global_vrf_allowed",
+    "bsn_l3_interface_class_id",
+    "bsn_l3_src_class_id",
+    "bsn_l3_dst_class_id",
+    "bsn_egr_port_group_id",
+    "bsn_udf0",
+    "bsn_udf1",
+    "bsn_udf2",
+    "bsn_udf3",
+    "bsn_udf4",
+    "bsn_udf5",
+    "bsn_udf6",
+    "bsn_udf7",
+    "bsn_tcp_flags",
+    "bsn_vlan_xlate_port_group_id",
+    "bsn_l2_cache_hit",
+    "bsn_in_ports_512",
+    "bsn_ingress_port_group_id",
+    "bsn_vxlan_network_id",
+    "bsn_inner_eth_dst",
+    "bsn_inner_eth_src",
+    "bsn_inner_vlan_vid",
+    "bsn_vfi",
+    "bsn_ip_fragmentation",
+    "circuit_och_sigtype",
+    "circuit_och_sigid",
+    "och_sigatt",
+    "exp_odu_sigtype",
+    "exp_odu_sigid",
+    "exp_och_sigtype",
+    "ofdpa_qos_index",
+    "exp_och_sigid",
+    "ofdpa_mpls_l2_port",
+    "ofdpa_ovid",
+    "ofdpa_mpls_type",
+    "ovs_tcp_flags",
+};
+
+const int loci_binlog_match_field_count = 100;
+
+#define LOCI_BINLOG_MATCH_FIELD(s, idx, width, value, mask) do {   \
+        uint8_t *_out = loci_stream_reserve(s, 2 + 2 * (width));    \
+        if (_out != NULL) {                                         \
+            _out[0] = (idx);                                        \
+            _out[1] = (width);                                      \
+            MEMCPY(_out + 2, (value), (width));                     \
+            MEMCPY(_out + 2 + (width), (mask), (width));            \
+            loci_stream_advance(s, 2 + 2 * (width));                \
+        }                                                           \
+    } while (0)
+
+/**
+ * Log the active fields of a match
+ */
+void
+loci_binlog_match(loci_stream_t *s, of_match_t *match)
+{
+    uint8_t *out;
+
+    if ((out = loci_stream_reserve(s, 2)) == NULL) {
+        return;
+    }
+    out[0] = LOCI_BINLOG_TAG_MATCH;
+    out[1] = (uint8_t)match->version;
+    loci_stream_advance(s, 2);
+
+    if (OF_MATCH_MASK_IN_PORT_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 0, sizeof(match->fields.in_port),
+            &match->fields.in_port, &match->masks.in_port);
+    }
+
+    if (OF_MATCH_MASK_IN_PHY_PORT_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 1, sizeof(match->fields.in_phy_port),
+            &match->fields.in_phy_port, &match->masks.in_phy_port);
+    }
+
+    if (OF_MATCH_MASK_METADATA_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 2, sizeof(match->fields.metadata),
+            &match->fields.metadata, &match->masks.metadata);
+    }
+
+    if (OF_MATCH_MASK_ETH_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 3, sizeof(match->fields.eth_dst),
+            &match->fields.eth_dst, &match->masks.eth_dst);
+    }
+
+    if (OF_MATCH_MASK_ETH_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 4, sizeof(match->fields.eth_src),
+            &match->fields.eth_src, &match->masks.eth_src);
+    }
+
+    if (OF_MATCH_MASK_ETH_TYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 5, sizeof(match->fields.eth_type),
+            &match->fields.eth_type, &match->masks.eth_type);
+    }
+
+    if (OF_MATCH_MASK_VLAN_VID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 6, sizeof(match->fields.vlan_vid),
+            &match->fields.vlan_vid, &match->masks.vlan_vid);
+    }
+
+    if (OF_MATCH_MASK_VLAN_PCP_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 7, sizeof(match->fields.vlan_pcp),
+            &match->fields.vlan_pcp, &match->masks.vlan_pcp);
+    }
+
+    if (OF_MATCH_MASK_IP_DSCP_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 8, sizeof(match->fields.ip_dscp),
+            &match->fields.ip_dscp, &match->masks.ip_dscp);
+    }
+
+    if (OF_MATCH_MASK_IP_ECN_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 9, sizeof(match->fields.ip_ecn),
+            &match->fields.ip_ecn, &match->masks.ip_ecn);
+    }
+
+    if (OF_MATCH_MASK_IP_PROTO_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 10, sizeof(match->fields.ip_proto),
+            &match->fields.ip_proto, &match->masks.ip_proto);
+    }
+
+    if (OF_MATCH_MASK_IPV4_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 11, sizeof(match->fields.ipv4_src),
+            &match->fields.ipv4_src, &match->masks.ipv4_src);
+    }
+
+    if (OF_MATCH_MASK_IPV4_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 12, sizeof(match->fields.ipv4_dst),
+            &match->fields.ipv4_dst, &match->masks.ipv4_dst);
+    }
+
+    if (OF_MATCH_MASK_TCP_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 13, sizeof(match->fields.tcp_src),
+            &match->fields.tcp_src, &match->masks.tcp_src);
+    }
+
+    if (OF_MATCH_MASK_TCP_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 14, sizeof(match->fields.tcp_dst),
+            &match->fields.tcp_dst, &match->masks.tcp_dst);
+    }
+
+    if (OF_MATCH_MASK_UDP_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 15, sizeof(match->fields.udp_src),
+            &match->fields.udp_src, &match->masks.udp_src);
+    }
+
+    if (OF_MATCH_MASK_UDP_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 16, sizeof(match->fields.udp_dst),
+            &match->fields.udp_dst, &match->masks.udp_dst);
+    }
+
+    if (OF_MATCH_MASK_SCTP_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 17, sizeof(match->fields.sctp_src),
+            &match->fields.sctp_src, &match->masks.sctp_src);
+    }
+
+    if (OF_MATCH_MASK_SCTP_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 18, sizeof(match->fields.sctp_dst),
+            &match->fields.sctp_dst, &match->masks.sctp_dst);
+    }
+
+    if (OF_MATCH_MASK_ICMPV4_TYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 19, sizeof(match->fields.icmpv4_type),
+            &match->fields.icmpv4_type, &match->masks.icmpv4_type);
+    }
+
+    if (OF_MATCH_MASK_ICMPV4_CODE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 20, sizeof(match->fields.icmpv4_code),
+            &match->fields.icmpv4_code, &match->masks.icmpv4_code);
+    }
+
+    if (OF_MATCH_MASK_ARP_OP_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 21, sizeof(match->fields.arp_op),
+            &match->fields.arp_op, &match->masks.arp_op);
+    }
+
+    if (OF_MATCH_MASK_ARP_SPA_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 22, sizeof(match->fields.arp_spa),
+            &match->fields.arp_spa, &match->masks.arp_spa);
+    }
+
+    if (OF_MATCH_MASK_ARP_TPA_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 23, sizeof(match->fields.arp_tpa),
+            &match->fields.arp_tpa, &match->masks.arp_tpa);
+    }
+
+    if (OF_MATCH_MASK_ARP_SHA_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 24, sizeof(match->fields.arp_sha),
+            &match->fields.arp_sha, &match->masks.arp_sha);
+    }
+
+    if (OF_MATCH_MASK_ARP_THA_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 25, sizeof(match->fields.arp_tha),
+            &match->fields.arp_tha, &match->masks.arp_tha);
+    }
+
+    if (OF_MATCH_MASK_IPV6_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 26, sizeof(match->fields.ipv6_src),
+            &match->fields.ipv6_src, &match->masks.ipv6_src);
+    }
+
+    if (OF_MATCH_MASK_IPV6_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 27, sizeof(match->fields.ipv6_dst),
+            &match->fields.ipv6_dst, &match->masks.ipv6_dst);
+    }
+
+    if (OF_MATCH_MASK_IPV6_FLABEL_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 28, sizeof(match->fields.ipv6_flabel),
+            &match->fields.ipv6_flabel, &match->masks.ipv6_flabel);
+    }
+
+    if (OF_MATCH_MASK_ICMPV6_TYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 29, sizeof(match->fields.icmpv6_type),
+            &match->fields.icmpv6_type, &match->masks.icmpv6_type);
+    }
+
+    if (OF_MATCH_MASK_ICMPV6_CODE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 30, sizeof(match->fields.icmpv6_code),
+            &match->fields.icmpv6_code, &match->masks.icmpv6_code);
+    }
+
+    if (OF_MATCH_MASK_IPV6_ND_TARGET_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 31, sizeof(match->fields.ipv6_nd_target),
+            &match->fields.ipv6_nd_target, &match->masks.ipv6_nd_target);
+    }
+
+    if (OF_MATCH_MASK_IPV6_ND_SLL_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 32, sizeof(match->fields.ipv6_nd_sll),
+            &match->fields.ipv6_nd_sll, &match->masks.ipv6_nd_sll);
+    }
+
+    if (OF_MATCH_MASK_IPV6_ND_TLL_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 33, sizeof(match->fields.ipv6_nd_tll),
+            &match->fields.ipv6_nd_tll, &match->masks.ipv6_nd_tll);
+    }
+
+    if (OF_MATCH_MASK_MPLS_LABEL_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 34, sizeof(match->fields.mpls_label),
+            &match->fields.mpls_label, &match->masks.mpls_label);
+    }
+
+    if (OF_MATCH_MASK_MPLS_TC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 35, sizeof(match->fields.mpls_tc),
+            &match->fields.mpls_tc, &match->masks.mpls_tc);
+    }
+
+    if (OF_MATCH_MASK_MPLS_BOS_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 36, sizeof(match->fields.mpls_bos),
+            &match->fields.mpls_bos, &match->masks.mpls_bos);
+    }
+
+    if (OF_MATCH_MASK_TUNNEL_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 37, sizeof(match->fields.tunnel_id),
+            &match->fields.tunnel_id, &match->masks.tunnel_id);
+    }
+
+    if (OF_MATCH_MASK_IPV6_EXTHDR_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 38, sizeof(match->fields.ipv6_exthdr),
+            &match->fields.ipv6_exthdr, &match->masks.ipv6_exthdr);
+    }
+
+    if (OF_MATCH_MASK_PBB_UCA_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 39, sizeof(match->fields.pbb_uca),
+            &match->fields.pbb_uca, &match->masks.pbb_uca);
+    }
+
+    if (OF_MATCH_MASK_CIRCUIT_OCH_SIGTYPE_BASIC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 40, sizeof(match->fields.circuit_och_sigtype_basic),
+            &match->fields.circuit_och_sigtype_basic, &match->masks.circuit_och_sigtype_basic);
+    }
+
+    if (OF_MATCH_MASK_CIRCUIT_OCH_SIGID_BASIC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 41, sizeof(match->fields.circuit_och_sigid_basic),
+            &match->fields.circuit_och_sigid_basic, &match->masks.circuit_och_sigid_basic);
+    }
+
+    if (OF_MATCH_MASK_OCH_SIGATT_BASIC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 42, sizeof(match->fields.och_sigatt_basic),
+            &match->fields.och_sigatt_basic, &match->masks.och_sigatt_basic);
+    }
+
+    if (OF_MATCH_MASK_TUNNEL_IPV4_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 43, sizeof(match->fields.tunnel_ipv4_src),
+            &match->fields.tunnel_ipv4_src, &match->masks.tunnel_ipv4_src);
+    }
+
+    if (OF_MATCH_MASK_TUNNEL_IPV4_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 44, sizeof(match->fields.tunnel_ipv4_dst),
+            &match->fields.tunnel_ipv4_dst, &match->masks.tunnel_ipv4_dst);
+    }
+
+    if (OF_MATCH_MASK_TUN_GBP_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 45, sizeof(match->fields.tun_gbp_id),
+            &match->fields.tun_gbp_id, &match->masks.tun_gbp_id);
+    }
+
+    if (OF_MATCH_MASK_TUN_GBP_FLAGS_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 46, sizeof(match->fields.tun_gbp_flags),
+            &match->fields.tun_gbp_flags, &match->masks.tun_gbp_flags);
+    }
+
+    if (OF_MATCH_MASK_TUN_FLAGS_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 47, sizeof(match->fields.tun_flags),
+            &match->fields.tun_flags, &match->masks.tun_flags);
+    }
+
+    if (OF_MATCH_MASK_TUN_GPE_NP_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 48, sizeof(match->fields.tun_gpe_np),
+            &match->fields.tun_gpe_np, &match->masks.tun_gpe_np);
+    }
+
+    if (OF_MATCH_MASK_TUN_GPE_FLAGS_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 49, sizeof(match->fields.tun_gpe_flags),
+            &match->fields.tun_gpe_flags, &match->masks.tun_gpe_flags);
+    }
+
+    if (OF_MATCH_MASK_NSP_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 50, sizeof(match->fields.nsp),
+            &match->fields.nsp, &match->masks.nsp);
+    }
+
+    if (OF_MATCH_MASK_NSI_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 51, sizeof(match->fields.nsi),
+            &match->fields.nsi, &match->masks.nsi);
+    }
+
+    if (OF_MATCH_MASK_NSH_C1_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 52, sizeof(match->fields.nsh_c1),
+            &match->fields.nsh_c1, &match->masks.nsh_c1);
+    }
+
+    if (OF_MATCH_MASK_NSH_C2_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 53, sizeof(match->fields.nsh_c2),
+            &match->fields.nsh_c2, &match->masks.nsh_c2);
+    }
+
+    if (OF_MATCH_MASK_NSH_C3_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 54, sizeof(match->fields.nsh_c3),
+            &match->fields.nsh_c3, &match->masks.nsh_c3);
+    }
+
+    if (OF_MATCH_MASK_NSH_C4_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 55, sizeof(match->fields.nsh_c4),
+            &match->fields.nsh_c4, &match->masks.nsh_c4);
+    }
+
+    if (OF_MATCH_MASK_NSH_MDTYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 56, sizeof(match->fields.nsh_mdtype),
+            &match->fields.nsh_mdtype, &match->masks.nsh_mdtype);
+    }
+
+    if (OF_MATCH_MASK_NSH_NP_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 57, sizeof(match->fields.nsh_np),
+            &match->fields.nsh_np, &match->masks.nsh_np);
+    }
+
+    if (OF_MATCH_MASK_ENCAP_ETH_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 58, sizeof(match->fields.encap_eth_src),
+            &match->fields.encap_eth_src, &match->masks.encap_eth_src);
+    }
+
+    if (OF_MATCH_MASK_ENCAP_ETH_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 59, sizeof(match->fields.encap_eth_dst),
+            &match->fields.encap_eth_dst, &match->masks.encap_eth_dst);
+    }
+
+    if (OF_MATCH_MASK_ENCAP_ETH_TYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 60, sizeof(match->fields.encap_eth_type),
+            &match->fields.encap_eth_type, &match->masks.encap_eth_type);
+    }
+
+    if (OF_MATCH_MASK_BSN_IN_PORTS_128_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 61, sizeof(match->fields.bsn_in_ports_128),
+            &match->fields.bsn_in_ports_128, &match->masks.bsn_in_ports_128);
+    }
+
+    if (OF_MATCH_MASK_BSN_LAG_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 62, sizeof(match->fields.bsn_lag_id),
+            &match->fields.bsn_lag_id, &match->masks.bsn_lag_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_VRF_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 63, sizeof(match->fields.bsn_vrf),
+            &match->fields.bsn_vrf, &match->masks.bsn_vrf);
+    }
+
+    if (OF_MATCH_MASK_BSN_GLOBAL_VRF_ALLOWED_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 64, sizeof(match->fields.bsn_global_vrf_allowed),
+            &match->fields.bsn_global_vrf_allowed, &match->masks.bsn_global_vrf_allowed);
+    }
+
+    if (OF_MATCH_MASK_BSN_L3_INTERFACE_CLASS_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 65, sizeof(match->fields.bsn_l3_interface_class_id),
+            &match->fields.bsn_l3_interface_class_id, &match->masks.bsn_l3_interface_class_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_L3_SRC_CLASS_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 66, sizeof(match->fields.bsn_l3_src_class_id),
+            &match->fields.bsn_l3_src_class_id, &match->masks.bsn_l3_src_class_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_L3_DST_CLASS_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 67, sizeof(match->fields.bsn_l3_dst_class_id),
+            &match->fields.bsn_l3_dst_class_id, &match->masks.bsn_l3_dst_class_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_EGR_PORT_GROUP_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 68, sizeof(match->fields.bsn_egr_port_group_id),
+            &match->fields.bsn_egr_port_group_id, &match->masks.bsn_egr_port_group_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF0_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 69, sizeof(match->fields.bsn_udf0),
+            &match->fields.bsn_udf0, &match->masks.bsn_udf0);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF1_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 70, sizeof(match->fields.bsn_udf1),
+            &match->fields.bsn_udf1, &match->masks.bsn_udf1);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF2_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 71, sizeof(match->fields.bsn_udf2),
+            &match->fields.bsn_udf2, &match->masks.bsn_udf2);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF3_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 72, sizeof(match->fields.bsn_udf3),
+            &match->fields.bsn_udf3, &match->masks.bsn_udf3);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF4_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 73, sizeof(match->fields.bsn_udf4),
+            &match->fields.bsn_udf4, &match->masks.bsn_udf4);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF5_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 74, sizeof(match->fields.bsn_udf5),
+            &match->fields.bsn_udf5, &match->masks.bsn_udf5);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF6_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 75, sizeof(match->fields.bsn_udf6),
+            &match->fields.bsn_udf6, &match->masks.bsn_udf6);
+    }
+
+    if (OF_MATCH_MASK_BSN_UDF7_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 76, sizeof(match->fields.bsn_udf7),
+            &match->fields.bsn_udf7, &match->masks.bsn_udf7);
+    }
+
+    if (OF_MATCH_MASK_BSN_TCP_FLAGS_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 77, sizeof(match->fields.bsn_tcp_flags),
+            &match->fields.bsn_tcp_flags, &match->masks.bsn_tcp_flags);
+    }
+
+    if (OF_MATCH_MASK_BSN_VLAN_XLATE_PORT_GROUP_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 78, sizeof(match->fields.bsn_vlan_xlate_port_group_id),
+            &match->fields.bsn_vlan_xlate_port_group_id, &match->masks.bsn_vlan_xlate_port_group_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_L2_CACHE_HIT_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 79, sizeof(match->fields.bsn_l2_cache_hit),
+            &match->fields.bsn_l2_cache_hit, &match->masks.bsn_l2_cache_hit);
+    }
+
+    if (OF_MATCH_MASK_BSN_IN_PORTS_512_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 80, sizeof(match->fields.bsn_in_ports_512),
+            &match->fields.bsn_in_ports_512, &match->masks.bsn_in_ports_512);
+    }
+
+    if (OF_MATCH_MASK_BSN_INGRESS_PORT_GROUP_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 81, sizeof(match->fields.bsn_ingress_port_group_id),
+            &match->fields.bsn_ingress_port_group_id, &match->masks.bsn_ingress_port_group_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_VXLAN_NETWORK_ID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 82, sizeof(match->fields.bsn_vxlan_network_id),
+            &match->fields.bsn_vxlan_network_id, &match->masks.bsn_vxlan_network_id);
+    }
+
+    if (OF_MATCH_MASK_BSN_INNER_ETH_DST_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 83, sizeof(match->fields.bsn_inner_eth_dst),
+            &match->fields.bsn_inner_eth_dst, &match->masks.bsn_inner_eth_dst);
+    }
+
+    if (OF_MATCH_MASK_BSN_INNER_ETH_SRC_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 84, sizeof(match->fields.bsn_inner_eth_src),
+            &match->fields.bsn_inner_eth_src, &match->masks.bsn_inner_eth_src);
+    }
+
+    if (OF_MATCH_MASK_BSN_INNER_VLAN_VID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 85, sizeof(match->fields.bsn_inner_vlan_vid),
+            &match->fields.bsn_inner_vlan_vid, &match->masks.bsn_inner_vlan_vid);
+    }
+
+    if (OF_MATCH_MASK_BSN_VFI_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 86, sizeof(match->fields.bsn_vfi),
+            &match->fields.bsn_vfi, &match->masks.bsn_vfi);
+    }
+
+    if (OF_MATCH_MASK_BSN_IP_FRAGMENTATION_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 87, sizeof(match->fields.bsn_ip_fragmentation),
+            &match->fields.bsn_ip_fragmentation, &match->masks.bsn_ip_fragmentation);
+    }
+
+    if (OF_MATCH_MASK_CIRCUIT_OCH_SIGTYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 88, sizeof(match->fields.circuit_och_sigtype),
+            &match->fields.circuit_och_sigtype, &match->masks.circuit_och_sigtype);
+    }
+
+    if (OF_MATCH_MASK_CIRCUIT_OCH_SIGID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 89, sizeof(match->fields.circuit_och_sigid),
+            &match->fields.circuit_och_sigid, &match->masks.circuit_och_sigid);
+    }
+
+    if (OF_MATCH_MASK_OCH_SIGATT_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 90, sizeof(match->fields.och_sigatt),
+            &match->fields.och_sigatt, &match->masks.och_sigatt);
+    }
+
+    if (OF_MATCH_MASK_EXP_ODU_SIGTYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 91, sizeof(match->fields.exp_odu_sigtype),
+            &match->fields.exp_odu_sigtype, &match->masks.exp_odu_sigtype);
+    }
+
+    if (OF_MATCH_MASK_EXP_ODU_SIGID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 92, 2 * sizeof(uint16_t),
+            &match->fields.exp_odu_sigid, &match->masks.exp_odu_sigid);
+    }
+
+    if (OF_MATCH_MASK_EXP_OCH_SIGTYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 93, sizeof(match->fields.exp_och_sigtype),
+            &match->fields.exp_och_sigtype, &match->masks.exp_och_sigtype);
+    }
+
+    if (OF_MATCH_MASK_OFDPA_QOS_INDEX_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 94, sizeof(match->fields.ofdpa_qos_index),
+            &match->fields.ofdpa_qos_index, &match->masks.ofdpa_qos_index);
+    }
+
+    if (OF_MATCH_MASK_EXP_OCH_SIGID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 95, sizeof(match->fields.exp_och_sigid),
+            &match->fields.exp_och_sigid, &match->masks.exp_och_sigid);
+    }
+
+    if (OF_MATCH_MASK_OFDPA_MPLS_L2_PORT_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 96, sizeof(match->fields.ofdpa_mpls_l2_port),
+            &match->fields.ofdpa_mpls_l2_port, &match->masks.ofdpa_mpls_l2_port);
+    }
+
+    if (OF_MATCH_MASK_OFDPA_OVID_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 97, sizeof(match->fields.ofdpa_ovid),
+            &match->fields.ofdpa_ovid, &match->masks.ofdpa_ovid);
+    }
+
+    if (OF_MATCH_MASK_OFDPA_MPLS_TYPE_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 98, sizeof(match->fields.ofdpa_mpls_type),
+            &match->fields.ofdpa_mpls_type, &match->masks.ofdpa_mpls_type);
+    }
+
+    if (OF_MATCH_MASK_OVS_TCP_FLAGS_ACTIVE_TEST(match)) {
+        LOCI_BINLOG_MATCH_FIELD(s, 99, sizeof(match->fields.ovs_tcp_flags),
+            &match->fields.ovs_tcp_flags, &match->masks.ovs_tcp_flags);
+    }
+
+    loci_stream_putc(s, LOCI_BINLOG_MATCH_END);
+}
+
+static const loci_obj_binlog_f binlog_funs_v1[OF_OBJECT_COUNT] = {
+    unknown_binlog, /* of_object, not a valid specific type */
+    of_aggregate_stats_reply_OF_VERSION_1_0_binlog,
+    of_aggregate_stats_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bad_action_error_msg_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bad_request_error_msg_OF_VERSION_1_0_binlog,
+    of_barrier_reply_OF_VERSION_1_0_binlog,
+    of_barrier_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_bw_clear_data_reply_OF_VERSION_1_0_binlog,
+    of_bsn_bw_clear_data_request_OF_VERSION_1_0_binlog,
+    of_bsn_bw_enable_get_reply_OF_VERSION_1_0_binlog,
+    of_bsn_bw_enable_get_request_OF_VERSION_1_0_binlog,
+    of_bsn_bw_enable_set_reply_OF_VERSION_1_0_binlog,
+    of_bsn_bw_enable_set_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_get_interfaces_reply_OF_VERSION_1_0_binlog,
+    of_bsn_get_interfaces_request_OF_VERSION_1_0_binlog,
+    of_bsn_get_ip_mask_reply_OF_VERSION_1_0_binlog,
+    of_bsn_get_ip_mask_request_OF_VERSION_1_0_binlog,
+    of_bsn_get_l2_table_reply_OF_VERSION_1_0_binlog,
+    of_bsn_get_l2_table_request_OF_VERSION_1_0_binlog,
+    of_bsn_get_mirroring_reply_OF_VERSION_1_0_binlog,
+    of_bsn_get_mirroring_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_hybrid_get_reply_OF_VERSION_1_0_binlog,
+    of_bsn_hybrid_get_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_pdu_rx_reply_OF_VERSION_1_0_binlog,
+    of_bsn_pdu_rx_request_OF_VERSION_1_0_binlog,
+    of_bsn_pdu_rx_timeout_OF_VERSION_1_0_binlog,
+    of_bsn_pdu_tx_reply_OF_VERSION_1_0_binlog,
+    of_bsn_pdu_tx_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_set_ip_mask_OF_VERSION_1_0_binlog,
+    of_bsn_set_l2_table_reply_OF_VERSION_1_0_binlog,
+    of_bsn_set_l2_table_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_set_mirroring_OF_VERSION_1_0_binlog,
+    of_bsn_set_pktin_suppression_reply_OF_VERSION_1_0_binlog,
+    of_bsn_set_pktin_suppression_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_shell_command_OF_VERSION_1_0_binlog,
+    of_bsn_shell_output_OF_VERSION_1_0_binlog,
+    of_bsn_shell_status_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_virtual_port_create_reply_OF_VERSION_1_0_binlog,
+    of_bsn_virtual_port_create_request_OF_VERSION_1_0_binlog,
+    of_bsn_virtual_port_remove_reply_OF_VERSION_1_0_binlog,
+    of_bsn_virtual_port_remove_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_desc_stats_reply_OF_VERSION_1_0_binlog,
+    of_desc_stats_request_OF_VERSION_1_0_binlog,
+    of_echo_reply_OF_VERSION_1_0_binlog,
+    of_echo_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_features_reply_OF_VERSION_1_0_binlog,
+    of_features_request_OF_VERSION_1_0_binlog,
+    of_flow_add_OF_VERSION_1_0_binlog,
+    of_flow_delete_OF_VERSION_1_0_binlog,
+    of_flow_delete_strict_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    of_flow_mod_failed_error_msg_OF_VERSION_1_0_binlog,
+    of_flow_modify_OF_VERSION_1_0_binlog,
+    of_flow_modify_strict_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    of_flow_removed_OF_VERSION_1_0_binlog,
+    of_flow_stats_reply_OF_VERSION_1_0_binlog,
+    of_flow_stats_request_OF_VERSION_1_0_binlog,
+    of_get_config_reply_OF_VERSION_1_0_binlog,
+    of_get_config_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_hello_OF_VERSION_1_0_binlog,
+    of_hello_failed_error_msg_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_nicira_controller_role_reply_OF_VERSION_1_0_binlog,
+    of_nicira_controller_role_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_packet_in_OF_VERSION_1_0_binlog,
+    of_packet_out_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_mod_OF_VERSION_1_0_binlog,
+    of_port_mod_failed_error_msg_OF_VERSION_1_0_binlog,
+    of_port_stats_reply_OF_VERSION_1_0_binlog,
+    of_port_stats_request_OF_VERSION_1_0_binlog,
+    of_port_status_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_get_config_reply_OF_VERSION_1_0_binlog,
+    of_queue_get_config_request_OF_VERSION_1_0_binlog,
+    of_queue_op_failed_error_msg_OF_VERSION_1_0_binlog,
+    of_queue_stats_reply_OF_VERSION_1_0_binlog,
+    of_queue_stats_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_set_config_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_mod_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    of_table_stats_reply_OF_VERSION_1_0_binlog,
+    of_table_stats_request_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_bsn_checksum_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    of_action_bsn_mirror_OF_VERSION_1_0_binlog,
+    of_action_bsn_set_tunnel_dst_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_enqueue_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_nicira_dec_ttl_OF_VERSION_1_0_binlog,
+    of_action_nicira_move_OF_VERSION_1_0_binlog,
+    of_action_nicira_pop_nsh_OF_VERSION_1_0_binlog,
+    of_action_nicira_push_nsh_OF_VERSION_1_0_binlog,
+    of_action_nicira_resubmit_OF_VERSION_1_0_binlog,
+    of_action_nicira_resubmit_table_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_output_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_dl_dst_OF_VERSION_1_0_binlog,
+    of_action_set_dl_src_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_nw_dst_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    of_action_set_nw_src_OF_VERSION_1_0_binlog,
+    of_action_set_nw_tos_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_tp_dst_OF_VERSION_1_0_binlog,
+    of_action_set_tp_src_OF_VERSION_1_0_binlog,
+    of_action_set_vlan_pcp_OF_VERSION_1_0_binlog,
+    of_action_set_vlan_vid_OF_VERSION_1_0_binlog,
+    of_action_strip_vlan_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_interface_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_vport_l2gre_OF_VERSION_1_0_binlog,
+    of_bsn_vport_q_in_q_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_flow_stats_entry_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_match_v1_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_packet_queue_OF_VERSION_1_0_binlog,
+    of_port_desc_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_stats_entry_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_prop_min_rate_OF_VERSION_1_0_binlog,
+    of_queue_stats_entry_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_stats_entry_OF_VERSION_1_0_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog
+};
+
+static const loci_obj_binlog_f binlog_funs_v2[OF_OBJECT_COUNT] = {
+    unknown_binlog, /* of_object, not a valid specific type */
+    of_aggregate_stats_reply_OF_VERSION_1_1_binlog,
+    of_aggregate_stats_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bad_action_error_msg_OF_VERSION_1_1_binlog,
+    of_bad_instruction_error_msg_OF_VERSION_1_1_binlog,
+    of_bad_match_error_msg_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_bad_request_error_msg_OF_VERSION_1_1_binlog,
+    of_barrier_reply_OF_VERSION_1_1_binlog,
+    of_barrier_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_bw_clear_data_reply_OF_VERSION_1_1_binlog,
+    of_bsn_bw_clear_data_request_OF_VERSION_1_1_binlog,
+    of_bsn_bw_enable_get_reply_OF_VERSION_1_1_binlog,
+    of_bsn_bw_enable_get_request_OF_VERSION_1_1_binlog,
+    of_bsn_bw_enable_set_reply_OF_VERSION_1_1_binlog,
+    of_bsn_bw_enable_set_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_get_interfaces_reply_OF_VERSION_1_1_binlog,
+    of_bsn_get_interfaces_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_get_mirroring_reply_OF_VERSION_1_1_binlog,
+    of_bsn_get_mirroring_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_pdu_rx_reply_OF_VERSION_1_1_binlog,
+    of_bsn_pdu_rx_request_OF_VERSION_1_1_binlog,
+    of_bsn_pdu_rx_timeout_OF_VERSION_1_1_binlog,
+    of_bsn_pdu_tx_reply_OF_VERSION_1_1_binlog,
+    of_bsn_pdu_tx_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_set_mirroring_OF_VERSION_1_1_binlog,
+    of_bsn_set_pktin_suppression_reply_OF_VERSION_1_1_binlog,
+    of_bsn_set_pktin_suppression_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_virtual_port_create_reply_OF_VERSION_1_1_binlog,
+    of_bsn_virtual_port_create_request_OF_VERSION_1_1_binlog,
+    of_bsn_virtual_port_remove_reply_OF_VERSION_1_1_binlog,
+    of_bsn_virtual_port_remove_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_desc_stats_reply_OF_VERSION_1_1_binlog,
+    of_desc_stats_request_OF_VERSION_1_1_binlog,
+    of_echo_reply_OF_VERSION_1_1_binlog,
+    of_echo_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_features_reply_OF_VERSION_1_1_binlog,
+    of_features_request_OF_VERSION_1_1_binlog,
+    of_flow_add_OF_VERSION_1_1_binlog,
+    of_flow_delete_OF_VERSION_1_1_binlog,
+    of_flow_delete_strict_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_flow_mod_failed_error_msg_OF_VERSION_1_1_binlog,
+    of_flow_modify_OF_VERSION_1_1_binlog,
+    of_flow_modify_strict_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_flow_removed_OF_VERSION_1_1_binlog,
+    of_flow_stats_reply_OF_VERSION_1_1_binlog,
+    of_flow_stats_request_OF_VERSION_1_1_binlog,
+    of_get_config_reply_OF_VERSION_1_1_binlog,
+    of_get_config_request_OF_VERSION_1_1_binlog,
+    of_group_add_OF_VERSION_1_1_binlog,
+    of_group_delete_OF_VERSION_1_1_binlog,
+    of_group_desc_stats_reply_OF_VERSION_1_1_binlog,
+    of_group_desc_stats_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_group_mod_failed_error_msg_OF_VERSION_1_1_binlog,
+    of_group_modify_OF_VERSION_1_1_binlog,
+    of_group_stats_reply_OF_VERSION_1_1_binlog,
+    of_group_stats_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_hello_OF_VERSION_1_1_binlog,
+    of_hello_failed_error_msg_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_packet_in_OF_VERSION_1_1_binlog,
+    of_packet_out_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_mod_OF_VERSION_1_1_binlog,
+    of_port_mod_failed_error_msg_OF_VERSION_1_1_binlog,
+    of_port_stats_reply_OF_VERSION_1_1_binlog,
+    of_port_stats_request_OF_VERSION_1_1_binlog,
+    of_port_status_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_get_config_reply_OF_VERSION_1_1_binlog,
+    of_queue_get_config_request_OF_VERSION_1_1_binlog,
+    of_queue_op_failed_error_msg_OF_VERSION_1_1_binlog,
+    of_queue_stats_reply_OF_VERSION_1_1_binlog,
+    of_queue_stats_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_set_config_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_switch_config_failed_error_msg_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_mod_OF_VERSION_1_1_binlog,
+    of_table_mod_failed_error_msg_OF_VERSION_1_1_binlog,
+    of_table_stats_reply_OF_VERSION_1_1_binlog,
+    of_table_stats_request_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_bsn_checksum_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_action_bsn_mirror_OF_VERSION_1_1_binlog,
+    of_action_bsn_set_tunnel_dst_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_action_copy_ttl_in_OF_VERSION_1_1_binlog,
+    of_action_copy_ttl_out_OF_VERSION_1_1_binlog,
+    of_action_dec_mpls_ttl_OF_VERSION_1_1_binlog,
+    of_action_dec_nw_ttl_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_group_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_nicira_dec_ttl_OF_VERSION_1_1_binlog,
+    of_action_nicira_move_OF_VERSION_1_1_binlog,
+    of_action_nicira_pop_nsh_OF_VERSION_1_1_binlog,
+    of_action_nicira_push_nsh_OF_VERSION_1_1_binlog,
+    of_action_nicira_resubmit_OF_VERSION_1_1_binlog,
+    of_action_nicira_resubmit_table_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_output_OF_VERSION_1_1_binlog,
+    of_action_pop_mpls_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_action_pop_vlan_OF_VERSION_1_1_binlog,
+    of_action_push_mpls_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_action_push_vlan_OF_VERSION_1_1_binlog,
+    of_action_set_dl_dst_OF_VERSION_1_1_binlog,
+    of_action_set_dl_src_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_action_set_mpls_label_OF_VERSION_1_1_binlog,
+    of_action_set_mpls_tc_OF_VERSION_1_1_binlog,
+    of_action_set_mpls_ttl_OF_VERSION_1_1_binlog,
+    of_action_set_nw_dst_OF_VERSION_1_1_binlog,
+    of_action_set_nw_ecn_OF_VERSION_1_1_binlog,
+    of_action_set_nw_src_OF_VERSION_1_1_binlog,
+    of_action_set_nw_tos_OF_VERSION_1_1_binlog,
+    of_action_set_nw_ttl_OF_VERSION_1_1_binlog,
+    of_action_set_queue_OF_VERSION_1_1_binlog,
+    of_action_set_tp_dst_OF_VERSION_1_1_binlog,
+    of_action_set_tp_src_OF_VERSION_1_1_binlog,
+    of_action_set_vlan_pcp_OF_VERSION_1_1_binlog,
+    of_action_set_vlan_vid_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_interface_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_vport_l2gre_OF_VERSION_1_1_binlog,
+    of_bsn_vport_q_in_q_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_bucket_OF_VERSION_1_1_binlog,
+    of_bucket_counter_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_flow_stats_entry_OF_VERSION_1_1_binlog,
+    of_group_desc_stats_entry_OF_VERSION_1_1_binlog,
+    of_group_stats_entry_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_instruction_apply_actions_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_instruction_clear_actions_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_instruction_goto_table_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_instruction_write_actions_OF_VERSION_1_1_binlog,
+    of_instruction_write_metadata_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    of_match_v2_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_packet_queue_OF_VERSION_1_1_binlog,
+    of_port_desc_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_stats_entry_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_prop_min_rate_OF_VERSION_1_1_binlog,
+    of_queue_stats_entry_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_stats_entry_OF_VERSION_1_1_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog
+};
+
+static const loci_obj_binlog_f binlog_funs_v3[OF_OBJECT_COUNT] = {
+    unknown_binlog, /* of_object, not a valid specific type */
+    of_aggregate_stats_reply_OF_VERSION_1_2_binlog,
+    of_aggregate_stats_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bad_action_error_msg_OF_VERSION_1_2_binlog,
+    of_bad_instruction_error_msg_OF_VERSION_1_2_binlog,
+    of_bad_match_error_msg_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_bad_request_error_msg_OF_VERSION_1_2_binlog,
+    of_barrier_reply_OF_VERSION_1_2_binlog,
+    of_barrier_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_bw_clear_data_reply_OF_VERSION_1_2_binlog,
+    of_bsn_bw_clear_data_request_OF_VERSION_1_2_binlog,
+    of_bsn_bw_enable_get_reply_OF_VERSION_1_2_binlog,
+    of_bsn_bw_enable_get_request_OF_VERSION_1_2_binlog,
+    of_bsn_bw_enable_set_reply_OF_VERSION_1_2_binlog,
+    of_bsn_bw_enable_set_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_get_interfaces_reply_OF_VERSION_1_2_binlog,
+    of_bsn_get_interfaces_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_get_mirroring_reply_OF_VERSION_1_2_binlog,
+    of_bsn_get_mirroring_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_pdu_rx_reply_OF_VERSION_1_2_binlog,
+    of_bsn_pdu_rx_request_OF_VERSION_1_2_binlog,
+    of_bsn_pdu_rx_timeout_OF_VERSION_1_2_binlog,
+    of_bsn_pdu_tx_reply_OF_VERSION_1_2_binlog,
+    of_bsn_pdu_tx_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_set_mirroring_OF_VERSION_1_2_binlog,
+    of_bsn_set_pktin_suppression_reply_OF_VERSION_1_2_binlog,
+    of_bsn_set_pktin_suppression_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_virtual_port_create_reply_OF_VERSION_1_2_binlog,
+    of_bsn_virtual_port_create_request_OF_VERSION_1_2_binlog,
+    of_bsn_virtual_port_remove_reply_OF_VERSION_1_2_binlog,
+    of_bsn_virtual_port_remove_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_desc_stats_reply_OF_VERSION_1_2_binlog,
+    of_desc_stats_request_OF_VERSION_1_2_binlog,
+    of_echo_reply_OF_VERSION_1_2_binlog,
+    of_echo_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_features_reply_OF_VERSION_1_2_binlog,
+    of_features_request_OF_VERSION_1_2_binlog,
+    of_flow_add_OF_VERSION_1_2_binlog,
+    of_flow_delete_OF_VERSION_1_2_binlog,
+    of_flow_delete_strict_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_flow_mod_failed_error_msg_OF_VERSION_1_2_binlog,
+    of_flow_modify_OF_VERSION_1_2_binlog,
+    of_flow_modify_strict_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_flow_removed_OF_VERSION_1_2_binlog,
+    of_flow_stats_reply_OF_VERSION_1_2_binlog,
+    of_flow_stats_request_OF_VERSION_1_2_binlog,
+    of_get_config_reply_OF_VERSION_1_2_binlog,
+    of_get_config_request_OF_VERSION_1_2_binlog,
+    of_group_add_OF_VERSION_1_2_binlog,
+    of_group_delete_OF_VERSION_1_2_binlog,
+    of_group_desc_stats_reply_OF_VERSION_1_2_binlog,
+    of_group_desc_stats_request_OF_VERSION_1_2_binlog,
+    of_group_features_stats_reply_OF_VERSION_1_2_binlog,
+    of_group_features_stats_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_group_mod_failed_error_msg_OF_VERSION_1_2_binlog,
+    of_group_modify_OF_VERSION_1_2_binlog,
+    of_group_stats_reply_OF_VERSION_1_2_binlog,
+    of_group_stats_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_hello_OF_VERSION_1_2_binlog,
+    of_hello_failed_error_msg_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_packet_in_OF_VERSION_1_2_binlog,
+    of_packet_out_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_mod_OF_VERSION_1_2_binlog,
+    of_port_mod_failed_error_msg_OF_VERSION_1_2_binlog,
+    of_port_stats_reply_OF_VERSION_1_2_binlog,
+    of_port_stats_request_OF_VERSION_1_2_binlog,
+    of_port_status_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_get_config_reply_OF_VERSION_1_2_binlog,
+    of_queue_get_config_request_OF_VERSION_1_2_binlog,
+    of_queue_op_failed_error_msg_OF_VERSION_1_2_binlog,
+    of_queue_stats_reply_OF_VERSION_1_2_binlog,
+    of_queue_stats_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_role_reply_OF_VERSION_1_2_binlog,
+    of_role_request_OF_VERSION_1_2_binlog,
+    of_role_request_failed_error_msg_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_set_config_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_switch_config_failed_error_msg_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_mod_OF_VERSION_1_2_binlog,
+    of_table_mod_failed_error_msg_OF_VERSION_1_2_binlog,
+    of_table_stats_reply_OF_VERSION_1_2_binlog,
+    of_table_stats_request_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_bsn_checksum_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_action_bsn_mirror_OF_VERSION_1_2_binlog,
+    of_action_bsn_set_tunnel_dst_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_action_copy_ttl_in_OF_VERSION_1_2_binlog,
+    of_action_copy_ttl_out_OF_VERSION_1_2_binlog,
+    of_action_dec_mpls_ttl_OF_VERSION_1_2_binlog,
+    of_action_dec_nw_ttl_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_group_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_nicira_dec_ttl_OF_VERSION_1_2_binlog,
+    of_action_nicira_move_OF_VERSION_1_2_binlog,
+    of_action_nicira_pop_nsh_OF_VERSION_1_2_binlog,
+    of_action_nicira_push_nsh_OF_VERSION_1_2_binlog,
+    of_action_nicira_resubmit_OF_VERSION_1_2_binlog,
+    of_action_nicira_resubmit_table_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_output_OF_VERSION_1_2_binlog,
+    of_action_pop_mpls_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_action_pop_vlan_OF_VERSION_1_2_binlog,
+    of_action_push_mpls_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_action_push_vlan_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_field_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_mpls_ttl_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_nw_ttl_OF_VERSION_1_2_binlog,
+    of_action_set_queue_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_interface_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_vport_l2gre_OF_VERSION_1_2_binlog,
+    of_bsn_vport_q_in_q_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_bucket_OF_VERSION_1_2_binlog,
+    of_bucket_counter_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_flow_stats_entry_OF_VERSION_1_2_binlog,
+    of_group_desc_stats_entry_OF_VERSION_1_2_binlog,
+    of_group_stats_entry_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_instruction_apply_actions_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_instruction_clear_actions_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    of_instruction_goto_table_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_instruction_write_actions_OF_VERSION_1_2_binlog,
+    of_instruction_write_metadata_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_match_v3_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_arp_op_OF_VERSION_1_2_binlog,
+    of_oxm_arp_op_masked_OF_VERSION_1_2_binlog,
+    of_oxm_arp_sha_OF_VERSION_1_2_binlog,
+    of_oxm_arp_sha_masked_OF_VERSION_1_2_binlog,
+    of_oxm_arp_spa_OF_VERSION_1_2_binlog,
+    of_oxm_arp_spa_masked_OF_VERSION_1_2_binlog,
+    of_oxm_arp_tha_OF_VERSION_1_2_binlog,
+    of_oxm_arp_tha_masked_OF_VERSION_1_2_binlog,
+    of_oxm_arp_tpa_OF_VERSION_1_2_binlog,
+    of_oxm_arp_tpa_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_egr_port_group_id_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_in_ports_128_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_in_ports_512_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_bsn_ip_fragmentation_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l2_cache_hit_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l3_src_class_id_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_lag_id_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_lag_id_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_tcp_flags_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf0_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf0_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf1_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf1_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf2_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf2_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf3_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf3_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf4_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf4_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf5_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf5_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf6_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf6_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf7_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_udf7_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_vrf_OF_VERSION_1_2_binlog,
+    of_oxm_bsn_vrf_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_encap_eth_dst_OF_VERSION_1_2_binlog,
+    of_oxm_encap_eth_dst_masked_OF_VERSION_1_2_binlog,
+    of_oxm_encap_eth_src_OF_VERSION_1_2_binlog,
+    of_oxm_encap_eth_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_encap_eth_type_OF_VERSION_1_2_binlog,
+    of_oxm_encap_eth_type_masked_OF_VERSION_1_2_binlog,
+    of_oxm_eth_dst_OF_VERSION_1_2_binlog,
+    of_oxm_eth_dst_masked_OF_VERSION_1_2_binlog,
+    of_oxm_eth_src_OF_VERSION_1_2_binlog,
+    of_oxm_eth_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_eth_type_OF_VERSION_1_2_binlog,
+    of_oxm_eth_type_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_icmpv4_code_OF_VERSION_1_2_binlog,
+    of_oxm_icmpv4_code_masked_OF_VERSION_1_2_binlog,
+    of_oxm_icmpv4_type_OF_VERSION_1_2_binlog,
+    of_oxm_icmpv4_type_masked_OF_VERSION_1_2_binlog,
+    of_oxm_icmpv6_code_OF_VERSION_1_2_binlog,
+    of_oxm_icmpv6_code_masked_OF_VERSION_1_2_binlog,
+    of_oxm_icmpv6_type_OF_VERSION_1_2_binlog,
+    of_oxm_icmpv6_type_masked_OF_VERSION_1_2_binlog,
+    of_oxm_in_phy_port_OF_VERSION_1_2_binlog,
+    of_oxm_in_phy_port_masked_OF_VERSION_1_2_binlog,
+    of_oxm_in_port_OF_VERSION_1_2_binlog,
+    of_oxm_in_port_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ip_dscp_OF_VERSION_1_2_binlog,
+    of_oxm_ip_dscp_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ip_ecn_OF_VERSION_1_2_binlog,
+    of_oxm_ip_ecn_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ip_proto_OF_VERSION_1_2_binlog,
+    of_oxm_ip_proto_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ipv4_dst_OF_VERSION_1_2_binlog,
+    of_oxm_ipv4_dst_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ipv4_src_OF_VERSION_1_2_binlog,
+    of_oxm_ipv4_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_dst_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_dst_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_ipv6_flabel_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_flabel_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_nd_sll_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_nd_target_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_nd_target_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_nd_tll_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_src_OF_VERSION_1_2_binlog,
+    of_oxm_ipv6_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_metadata_OF_VERSION_1_2_binlog,
+    of_oxm_metadata_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_mpls_label_OF_VERSION_1_2_binlog,
+    of_oxm_mpls_label_masked_OF_VERSION_1_2_binlog,
+    of_oxm_mpls_tc_OF_VERSION_1_2_binlog,
+    of_oxm_mpls_tc_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c1_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c1_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c2_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c2_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c3_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c3_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c4_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_c4_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_mdtype_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_mdtype_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_np_OF_VERSION_1_2_binlog,
+    of_oxm_nsh_np_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsi_OF_VERSION_1_2_binlog,
+    of_oxm_nsi_masked_OF_VERSION_1_2_binlog,
+    of_oxm_nsp_OF_VERSION_1_2_binlog,
+    of_oxm_nsp_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_ovs_tcp_flags_OF_VERSION_1_2_binlog,
+    of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_sctp_dst_OF_VERSION_1_2_binlog,
+    of_oxm_sctp_dst_masked_OF_VERSION_1_2_binlog,
+    of_oxm_sctp_src_OF_VERSION_1_2_binlog,
+    of_oxm_sctp_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tcp_dst_OF_VERSION_1_2_binlog,
+    of_oxm_tcp_dst_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tcp_src_OF_VERSION_1_2_binlog,
+    of_oxm_tcp_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tun_flags_OF_VERSION_1_2_binlog,
+    of_oxm_tun_flags_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gbp_flags_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gbp_flags_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gbp_id_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gbp_id_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gpe_flags_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gpe_flags_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gpe_np_OF_VERSION_1_2_binlog,
+    of_oxm_tun_gpe_np_masked_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_tunnel_ipv4_dst_OF_VERSION_1_2_binlog,
+    of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_2_binlog,
+    of_oxm_tunnel_ipv4_src_OF_VERSION_1_2_binlog,
+    of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_udp_dst_OF_VERSION_1_2_binlog,
+    of_oxm_udp_dst_masked_OF_VERSION_1_2_binlog,
+    of_oxm_udp_src_OF_VERSION_1_2_binlog,
+    of_oxm_udp_src_masked_OF_VERSION_1_2_binlog,
+    of_oxm_vlan_pcp_OF_VERSION_1_2_binlog,
+    of_oxm_vlan_pcp_masked_OF_VERSION_1_2_binlog,
+    of_oxm_vlan_vid_OF_VERSION_1_2_binlog,
+    of_oxm_vlan_vid_masked_OF_VERSION_1_2_binlog,
+    of_packet_queue_OF_VERSION_1_2_binlog,
+    of_port_desc_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_stats_entry_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_prop_max_rate_OF_VERSION_1_2_binlog,
+    of_queue_prop_min_rate_OF_VERSION_1_2_binlog,
+    of_queue_stats_entry_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_stats_entry_OF_VERSION_1_2_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog
+};
+
+static const loci_obj_binlog_f binlog_funs_v4[OF_OBJECT_COUNT] = {
+    unknown_binlog, /* of_object, not a valid specific type */
+    of_aggregate_stats_reply_OF_VERSION_1_3_binlog,
+    of_aggregate_stats_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_async_get_reply_OF_VERSION_1_3_binlog,
+    of_async_get_request_OF_VERSION_1_3_binlog,
+    of_async_set_OF_VERSION_1_3_binlog,
+    of_bad_action_error_msg_OF_VERSION_1_3_binlog,
+    of_bad_instruction_error_msg_OF_VERSION_1_3_binlog,
+    of_bad_match_error_msg_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_bad_request_error_msg_OF_VERSION_1_3_binlog,
+    of_barrier_reply_OF_VERSION_1_3_binlog,
+    of_barrier_request_OF_VERSION_1_3_binlog,
+    of_bsn_arp_idle_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_bsn_bw_clear_data_reply_OF_VERSION_1_3_binlog,
+    of_bsn_bw_clear_data_request_OF_VERSION_1_3_binlog,
+    of_bsn_bw_enable_get_reply_OF_VERSION_1_3_binlog,
+    of_bsn_bw_enable_get_request_OF_VERSION_1_3_binlog,
+    of_bsn_bw_enable_set_reply_OF_VERSION_1_3_binlog,
+    of_bsn_bw_enable_set_request_OF_VERSION_1_3_binlog,
+    of_bsn_controller_connections_reply_OF_VERSION_1_3_binlog,
+    of_bsn_controller_connections_request_OF_VERSION_1_3_binlog,
+    of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_debug_counter_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_debug_counter_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_error_OF_VERSION_1_3_binlog,
+    of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_flow_idle_OF_VERSION_1_3_binlog,
+    of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_3_binlog,
+    of_bsn_flow_idle_enable_get_request_OF_VERSION_1_3_binlog,
+    of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_3_binlog,
+    of_bsn_flow_idle_enable_set_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_generic_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_generic_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_bucket_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_clear_reply_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_clear_request_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_add_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_delete_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_set_buckets_size_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_get_interfaces_reply_OF_VERSION_1_3_binlog,
+    of_bsn_get_interfaces_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_get_mirroring_reply_OF_VERSION_1_3_binlog,
+    of_bsn_get_mirroring_request_OF_VERSION_1_3_binlog,
+    of_bsn_get_switch_pipeline_reply_OF_VERSION_1_3_binlog,
+    of_bsn_get_switch_pipeline_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_image_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_image_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_lacp_convergence_notif_OF_VERSION_1_3_binlog,
+    of_bsn_lacp_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_lacp_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_log_OF_VERSION_1_3_binlog,
+    of_bsn_lua_command_reply_OF_VERSION_1_3_binlog,
+    of_bsn_lua_command_request_OF_VERSION_1_3_binlog,
+    of_bsn_lua_notification_OF_VERSION_1_3_binlog,
+    of_bsn_lua_upload_OF_VERSION_1_3_binlog,
+    of_bsn_pdu_rx_reply_OF_VERSION_1_3_binlog,
+    of_bsn_pdu_rx_request_OF_VERSION_1_3_binlog,
+    of_bsn_pdu_rx_timeout_OF_VERSION_1_3_binlog,
+    of_bsn_pdu_tx_reply_OF_VERSION_1_3_binlog,
+    of_bsn_pdu_tx_request_OF_VERSION_1_3_binlog,
+    of_bsn_port_counter_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_port_counter_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_role_status_OF_VERSION_1_3_binlog,
+    of_bsn_set_aux_cxns_reply_OF_VERSION_1_3_binlog,
+    of_bsn_set_aux_cxns_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_set_lacp_reply_OF_VERSION_1_3_binlog,
+    of_bsn_set_lacp_request_OF_VERSION_1_3_binlog,
+    of_bsn_set_mirroring_OF_VERSION_1_3_binlog,
+    of_bsn_set_pktin_suppression_reply_OF_VERSION_1_3_binlog,
+    of_bsn_set_pktin_suppression_request_OF_VERSION_1_3_binlog,
+    of_bsn_set_switch_pipeline_reply_OF_VERSION_1_3_binlog,
+    of_bsn_set_switch_pipeline_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_switch_pipeline_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_table_checksum_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_table_checksum_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_table_set_buckets_size_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_bsn_time_reply_OF_VERSION_1_3_binlog,
+    of_bsn_time_request_OF_VERSION_1_3_binlog,
+    of_bsn_virtual_port_create_reply_OF_VERSION_1_3_binlog,
+    of_bsn_virtual_port_create_request_OF_VERSION_1_3_binlog,
+    of_bsn_virtual_port_remove_reply_OF_VERSION_1_3_binlog,
+    of_bsn_virtual_port_remove_request_OF_VERSION_1_3_binlog,
+    of_bsn_vlan_counter_clear_OF_VERSION_1_3_binlog,
+    of_bsn_vlan_counter_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_vlan_counter_stats_request_OF_VERSION_1_3_binlog,
+    of_bsn_vrf_counter_stats_reply_OF_VERSION_1_3_binlog,
+    of_bsn_vrf_counter_stats_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_calient_flow_stats_reply_OF_VERSION_1_3_binlog,
+    of_calient_flow_stats_request_OF_VERSION_1_3_binlog,
+    of_calient_port_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_calient_port_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_calient_port_stats_reply_OF_VERSION_1_3_binlog,
+    of_calient_port_stats_request_OF_VERSION_1_3_binlog,
+    of_calient_port_status_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_circuit_port_status_OF_VERSION_1_3_binlog,
+    of_circuit_ports_reply_OF_VERSION_1_3_binlog,
+    of_circuit_ports_request_OF_VERSION_1_3_binlog,
+    of_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_echo_reply_OF_VERSION_1_3_binlog,
+    of_echo_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_exp_port_adjacency_reply_OF_VERSION_1_3_binlog,
+    of_exp_port_adjacency_request_OF_VERSION_1_3_binlog,
+    of_exp_port_desc_reply_OF_VERSION_1_3_binlog,
+    of_exp_port_desc_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_features_reply_OF_VERSION_1_3_binlog,
+    of_features_request_OF_VERSION_1_3_binlog,
+    of_flow_add_OF_VERSION_1_3_binlog,
+    of_flow_delete_OF_VERSION_1_3_binlog,
+    of_flow_delete_strict_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_flow_mod_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_flow_modify_OF_VERSION_1_3_binlog,
+    of_flow_modify_strict_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_flow_removed_OF_VERSION_1_3_binlog,
+    of_flow_stats_reply_OF_VERSION_1_3_binlog,
+    of_flow_stats_request_OF_VERSION_1_3_binlog,
+    of_get_config_reply_OF_VERSION_1_3_binlog,
+    of_get_config_request_OF_VERSION_1_3_binlog,
+    of_group_add_OF_VERSION_1_3_binlog,
+    of_group_delete_OF_VERSION_1_3_binlog,
+    of_group_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_group_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_group_features_stats_reply_OF_VERSION_1_3_binlog,
+    of_group_features_stats_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_group_mod_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_group_modify_OF_VERSION_1_3_binlog,
+    of_group_stats_reply_OF_VERSION_1_3_binlog,
+    of_group_stats_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_hello_OF_VERSION_1_3_binlog,
+    of_hello_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_meter_config_stats_reply_OF_VERSION_1_3_binlog,
+    of_meter_config_stats_request_OF_VERSION_1_3_binlog,
+    of_meter_features_stats_reply_OF_VERSION_1_3_binlog,
+    of_meter_features_stats_request_OF_VERSION_1_3_binlog,
+    of_meter_mod_OF_VERSION_1_3_binlog,
+    of_meter_mod_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_meter_stats_reply_OF_VERSION_1_3_binlog,
+    of_meter_stats_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oplink_channel_power_reply_OF_VERSION_1_3_binlog,
+    of_oplink_channel_power_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_oplink_port_power_reply_OF_VERSION_1_3_binlog,
+    of_oplink_port_power_request_OF_VERSION_1_3_binlog,
+    of_oplink_port_power_set_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_packet_in_OF_VERSION_1_3_binlog,
+    of_packet_out_OF_VERSION_1_3_binlog,
+    of_port_desc_stats_reply_OF_VERSION_1_3_binlog,
+    of_port_desc_stats_request_OF_VERSION_1_3_binlog,
+    of_port_mod_OF_VERSION_1_3_binlog,
+    of_port_mod_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_port_stats_reply_OF_VERSION_1_3_binlog,
+    of_port_stats_request_OF_VERSION_1_3_binlog,
+    of_port_status_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_get_config_reply_OF_VERSION_1_3_binlog,
+    of_queue_get_config_request_OF_VERSION_1_3_binlog,
+    of_queue_op_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_queue_stats_reply_OF_VERSION_1_3_binlog,
+    of_queue_stats_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_role_reply_OF_VERSION_1_3_binlog,
+    of_role_request_OF_VERSION_1_3_binlog,
+    of_role_request_failed_error_msg_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_sdwn_add_client_OF_VERSION_1_3_binlog,
+    of_sdwn_add_lvap_OF_VERSION_1_3_binlog,
+    of_sdwn_del_client_OF_VERSION_1_3_binlog,
+    of_sdwn_del_lvap_OF_VERSION_1_3_binlog,
+    of_sdwn_get_channel_reply_OF_VERSION_1_3_binlog,
+    of_sdwn_get_channel_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_sdwn_get_clients_reply_crypto_OF_VERSION_1_3_binlog,
+    of_sdwn_get_clients_reply_lvap_OF_VERSION_1_3_binlog,
+    of_sdwn_get_clients_reply_normal_OF_VERSION_1_3_binlog,
+    of_sdwn_get_clients_request_OF_VERSION_1_3_binlog,
+    of_sdwn_get_remote_port_reply_OF_VERSION_1_3_binlog,
+    of_sdwn_get_remote_port_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_sdwn_ieee80211_mgmt_OF_VERSION_1_3_binlog,
+    of_sdwn_ieee80211_mgmt_reply_OF_VERSION_1_3_binlog,
+    of_sdwn_mod_lvap_OF_VERSION_1_3_binlog,
+    of_sdwn_packet_in_OF_VERSION_1_3_binlog,
+    of_sdwn_port_desc_reply_OF_VERSION_1_3_binlog,
+    of_sdwn_port_desc_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_sdwn_set_channel_OF_VERSION_1_3_binlog,
+    of_set_config_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_switch_config_failed_error_msg_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_features_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_table_features_stats_reply_OF_VERSION_1_3_binlog,
+    of_table_features_stats_request_OF_VERSION_1_3_binlog,
+    of_table_mod_OF_VERSION_1_3_binlog,
+    of_table_mod_failed_error_msg_OF_VERSION_1_3_binlog,
+    of_table_stats_reply_OF_VERSION_1_3_binlog,
+    of_table_stats_request_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_bsn_checksum_OF_VERSION_1_3_binlog,
+    of_action_bsn_gentable_OF_VERSION_1_3_binlog,
+    of_action_bsn_mirror_OF_VERSION_1_3_binlog,
+    of_action_bsn_set_tunnel_dst_OF_VERSION_1_3_binlog,
+    of_action_circuit_OF_VERSION_1_3_binlog,
+    of_action_copy_ttl_in_OF_VERSION_1_3_binlog,
+    of_action_copy_ttl_out_OF_VERSION_1_3_binlog,
+    of_action_dec_mpls_ttl_OF_VERSION_1_3_binlog,
+    of_action_dec_nw_ttl_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_group_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_id_bsn_checksum_OF_VERSION_1_3_binlog,
+    of_action_id_bsn_gentable_OF_VERSION_1_3_binlog,
+    of_action_id_bsn_mirror_OF_VERSION_1_3_binlog,
+    of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_3_binlog,
+    of_action_id_circuit_OF_VERSION_1_3_binlog,
+    of_action_id_copy_ttl_in_OF_VERSION_1_3_binlog,
+    of_action_id_copy_ttl_out_OF_VERSION_1_3_binlog,
+    of_action_id_dec_mpls_ttl_OF_VERSION_1_3_binlog,
+    of_action_id_dec_nw_ttl_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_action_id_group_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_action_id_nicira_dec_ttl_OF_VERSION_1_3_binlog,
+    of_action_id_nicira_move_OF_VERSION_1_3_binlog,
+    of_action_id_nicira_pop_nsh_OF_VERSION_1_3_binlog,
+    of_action_id_nicira_push_nsh_OF_VERSION_1_3_binlog,
+    of_action_id_nicira_resubmit_OF_VERSION_1_3_binlog,
+    of_action_id_nicira_resubmit_table_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_action_id_ofdpa_pop_cw_OF_VERSION_1_3_binlog,
+    of_action_id_ofdpa_pop_l2_header_OF_VERSION_1_3_binlog,
+    of_action_id_ofdpa_push_cw_OF_VERSION_1_3_binlog,
+    of_action_id_ofdpa_push_l2_header_OF_VERSION_1_3_binlog,
+    of_action_id_oplink_att_OF_VERSION_1_3_binlog,
+    of_action_id_output_OF_VERSION_1_3_binlog,
+    of_action_id_pop_mpls_OF_VERSION_1_3_binlog,
+    of_action_id_pop_pbb_OF_VERSION_1_3_binlog,
+    of_action_id_pop_vlan_OF_VERSION_1_3_binlog,
+    of_action_id_push_mpls_OF_VERSION_1_3_binlog,
+    of_action_id_push_pbb_OF_VERSION_1_3_binlog,
+    of_action_id_push_vlan_OF_VERSION_1_3_binlog,
+    of_action_id_set_field_OF_VERSION_1_3_binlog,
+    of_action_id_set_mpls_ttl_OF_VERSION_1_3_binlog,
+    of_action_id_set_nw_ttl_OF_VERSION_1_3_binlog,
+    of_action_id_set_queue_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_action_nicira_dec_ttl_OF_VERSION_1_3_binlog,
+    of_action_nicira_move_OF_VERSION_1_3_binlog,
+    of_action_nicira_pop_nsh_OF_VERSION_1_3_binlog,
+    of_action_nicira_push_nsh_OF_VERSION_1_3_binlog,
+    of_action_nicira_resubmit_OF_VERSION_1_3_binlog,
+    of_action_nicira_resubmit_table_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_action_ofdpa_pop_cw_OF_VERSION_1_3_binlog,
+    of_action_ofdpa_pop_l2_header_OF_VERSION_1_3_binlog,
+    of_action_ofdpa_push_cw_OF_VERSION_1_3_binlog,
+    of_action_ofdpa_push_l2_header_OF_VERSION_1_3_binlog,
+    of_action_oplink_att_OF_VERSION_1_3_binlog,
+    of_action_output_OF_VERSION_1_3_binlog,
+    of_action_pop_mpls_OF_VERSION_1_3_binlog,
+    of_action_pop_pbb_OF_VERSION_1_3_binlog,
+    of_action_pop_vlan_OF_VERSION_1_3_binlog,
+    of_action_push_mpls_OF_VERSION_1_3_binlog,
+    of_action_push_pbb_OF_VERSION_1_3_binlog,
+    of_action_push_vlan_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_field_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_mpls_ttl_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_nw_ttl_OF_VERSION_1_3_binlog,
+    of_action_set_queue_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_controller_connection_OF_VERSION_1_3_binlog,
+    of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_debug_counter_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_generic_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_desc_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_entry_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_gentable_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_interface_OF_VERSION_1_3_binlog,
+    of_bsn_lacp_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_port_counter_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_table_checksum_stats_entry_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_bsn_tlv_actor_key_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_actor_port_num_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_actor_port_priority_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_actor_state_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_actor_system_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_actor_system_priority_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_anchor_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_apply_bytes_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_apply_packets_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_auto_negotiation_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_broadcast_rate_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_bucket_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_circuit_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_convergence_status_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_cpu_lag_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_crc_enabled_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_data_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_data_mask_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_decap_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_drop_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_dscp_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ecn_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_egress_only_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_egress_port_group_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_eth_dst_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_eth_src_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_eth_type_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_external_gateway_ip_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_external_gateway_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_external_ip_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_external_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_external_netmask_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_generation_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_hash_packet_field_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_hash_packet_type_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_hash_seed_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_hash_type_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_header_size_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_icmp_code_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_icmp_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_icmp_type_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_idle_notification_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_idle_time_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_idle_timeout_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_igmp_snooping_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_internal_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_interval_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ip_proto_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv4_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv4_dst_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv4_netmask_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv4_src_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv6_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv6_dst_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv6_prefix_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ipv6_src_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_known_multicast_rate_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_l3_src_class_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_loopback_port_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_mac_mask_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_miss_packets_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_mpls_control_word_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_mpls_label_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_mpls_sequenced_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_multicast_interface_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_name_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ndp_offload_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ndp_static_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_negate_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_next_hop_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_offset_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_parent_port_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_partner_key_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_partner_port_num_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_partner_port_priority_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_partner_state_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_partner_system_mac_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_partner_system_priority_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_port_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_port_usage_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_priority_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_qos_priority_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_queue_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_queue_weight_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_rate_limit_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_rate_unit_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_reference_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_reply_packets_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_request_packets_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_rx_bytes_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_rx_packets_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_sampling_rate_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_set_loopback_mode_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_status_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_sub_agent_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_tcp_dst_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_tcp_flags_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_tcp_src_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_ttl_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_tunnel_capability_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_tx_bytes_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_tx_packets_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_udf_anchor_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_udf_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_udf_length_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_udf_offset_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_udp_dst_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_udp_src_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_uint64_list_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_unicast_rate_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_untagged_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_use_packet_state_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vfi_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vfp_class_id_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vlan_mac_list_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vlan_pcp_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vlan_vid_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vni_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vpn_key_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vrf_OF_VERSION_1_3_binlog,
+    of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_3_binlog,
+    of_bsn_vlan_counter_stats_entry_OF_VERSION_1_3_binlog,
+    of_bsn_vlan_mac_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_bsn_vport_l2gre_OF_VERSION_1_3_binlog,
+    of_bsn_vport_q_in_q_OF_VERSION_1_3_binlog,
+    of_bsn_vrf_counter_stats_entry_OF_VERSION_1_3_binlog,
+    of_bucket_OF_VERSION_1_3_binlog,
+    of_bucket_counter_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_calient_flow_stats_entry_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_calient_port_desc_prop_optical_OF_VERSION_1_3_binlog,
+    of_calient_port_desc_stats_entry_OF_VERSION_1_3_binlog,
+    of_calient_port_stats_entry_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_exp_ext_ad_id_port_otn_OF_VERSION_1_3_binlog,
+    of_exp_ext_ad_id_sonet_OF_VERSION_1_3_binlog,
+    of_exp_port_OF_VERSION_1_3_binlog,
+    of_exp_port_adjacency_OF_VERSION_1_3_binlog,
+    of_exp_port_adjacency_id_OF_VERSION_1_3_binlog,
+    of_exp_port_des_prop_header_OF_VERSION_1_3_binlog,
+    of_exp_port_desc_prop_optical_transport_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_exp_port_optical_transport_layer_entry_OF_VERSION_1_3_binlog,
+    of_exp_port_optical_transport_layer_stack_OF_VERSION_1_3_binlog,
+    of_flow_stats_entry_OF_VERSION_1_3_binlog,
+    of_group_desc_stats_entry_OF_VERSION_1_3_binlog,
+    of_group_stats_entry_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_hello_elem_versionbitmap_OF_VERSION_1_3_binlog,
+    of_ieee80211_ht_cap_OF_VERSION_1_3_binlog,
+    of_ieee80211_mcs_info_OF_VERSION_1_3_binlog,
+    of_ieee80211_vht_cap_OF_VERSION_1_3_binlog,
+    of_ieee80211_vht_mcs_info_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_instruction_apply_actions_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_instruction_bsn_arp_offload_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_auto_negotiation_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_deny_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_dhcp_offload_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_disable_l3_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_disable_split_horizon_check_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_hash_select_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_internal_priority_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_ndp_offload_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_packet_of_death_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_permit_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_prioritize_pdus_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_3_binlog,
+    of_instruction_bsn_span_destination_OF_VERSION_1_3_binlog,
+    of_instruction_clear_actions_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_instruction_goto_table_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_instruction_id_apply_actions_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_instruction_id_bsn_arp_offload_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_deny_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_disable_l3_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_disable_split_horizon_check_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_hash_select_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_internal_priority_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_ndp_offload_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_packet_of_death_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_permit_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_3_binlog,
+    of_instruction_id_bsn_span_destination_OF_VERSION_1_3_binlog,
+    of_instruction_id_clear_actions_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_instruction_id_goto_table_OF_VERSION_1_3_binlog,
+    of_instruction_id_meter_OF_VERSION_1_3_binlog,
+    of_instruction_id_write_actions_OF_VERSION_1_3_binlog,
+    of_instruction_id_write_metadata_OF_VERSION_1_3_binlog,
+    of_instruction_meter_OF_VERSION_1_3_binlog,
+    of_instruction_write_actions_OF_VERSION_1_3_binlog,
+    of_instruction_write_metadata_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_match_v3_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_meter_band_drop_OF_VERSION_1_3_binlog,
+    of_meter_band_dscp_remark_OF_VERSION_1_3_binlog,
+    of_meter_band_experimenter_OF_VERSION_1_3_binlog,
+    of_meter_band_stats_OF_VERSION_1_3_binlog,
+    of_meter_config_OF_VERSION_1_3_binlog,
+    of_meter_features_OF_VERSION_1_3_binlog,
+    of_meter_stats_OF_VERSION_1_3_binlog,
+    of_oplink_channel_power_OF_VERSION_1_3_binlog,
+    of_oplink_port_power_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_oxm_arp_op_OF_VERSION_1_3_binlog,
+    of_oxm_arp_op_masked_OF_VERSION_1_3_binlog,
+    of_oxm_arp_sha_OF_VERSION_1_3_binlog,
+    of_oxm_arp_sha_masked_OF_VERSION_1_3_binlog,
+    of_oxm_arp_spa_OF_VERSION_1_3_binlog,
+    of_oxm_arp_spa_masked_OF_VERSION_1_3_binlog,
+    of_oxm_arp_tha_OF_VERSION_1_3_binlog,
+    of_oxm_arp_tha_masked_OF_VERSION_1_3_binlog,
+    of_oxm_arp_tpa_OF_VERSION_1_3_binlog,
+    of_oxm_arp_tpa_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_egr_port_group_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_in_ports_128_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_in_ports_512_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_inner_eth_dst_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_inner_eth_src_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_ip_fragmentation_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l2_cache_hit_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l3_src_class_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_lag_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_lag_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_tcp_flags_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf0_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf0_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf1_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf1_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf2_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf2_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf3_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf3_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf4_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf4_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf5_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf5_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf6_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf6_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf7_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_udf7_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vfi_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vfi_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vrf_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vrf_masked_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vxlan_network_id_OF_VERSION_1_3_binlog,
+    of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigid_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigid_basic_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigid_basic_masked_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigid_masked_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigtype_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigtype_basic_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigtype_basic_masked_OF_VERSION_1_3_binlog,
+    of_oxm_circuit_och_sigtype_masked_OF_VERSION_1_3_binlog,
+    of_oxm_encap_eth_dst_OF_VERSION_1_3_binlog,
+    of_oxm_encap_eth_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_encap_eth_src_OF_VERSION_1_3_binlog,
+    of_oxm_encap_eth_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_encap_eth_type_OF_VERSION_1_3_binlog,
+    of_oxm_encap_eth_type_masked_OF_VERSION_1_3_binlog,
+    of_oxm_eth_dst_OF_VERSION_1_3_binlog,
+    of_oxm_eth_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_eth_src_OF_VERSION_1_3_binlog,
+    of_oxm_eth_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_eth_type_OF_VERSION_1_3_binlog,
+    of_oxm_eth_type_masked_OF_VERSION_1_3_binlog,
+    of_oxm_exp_och_sigid_OF_VERSION_1_3_binlog,
+    of_oxm_exp_och_sigid_masked_OF_VERSION_1_3_binlog,
+    of_oxm_exp_och_sigtype_OF_VERSION_1_3_binlog,
+    of_oxm_exp_och_sigtype_masked_OF_VERSION_1_3_binlog,
+    of_oxm_exp_odu_sigid_OF_VERSION_1_3_binlog,
+    of_oxm_exp_odu_sigid_masked_OF_VERSION_1_3_binlog,
+    of_oxm_exp_odu_sigtype_OF_VERSION_1_3_binlog,
+    of_oxm_exp_odu_sigtype_masked_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv4_code_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv4_code_masked_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv4_type_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv4_type_masked_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv6_code_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv6_code_masked_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv6_type_OF_VERSION_1_3_binlog,
+    of_oxm_icmpv6_type_masked_OF_VERSION_1_3_binlog,
+    of_oxm_in_phy_port_OF_VERSION_1_3_binlog,
+    of_oxm_in_phy_port_masked_OF_VERSION_1_3_binlog,
+    of_oxm_in_port_OF_VERSION_1_3_binlog,
+    of_oxm_in_port_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ip_dscp_OF_VERSION_1_3_binlog,
+    of_oxm_ip_dscp_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ip_ecn_OF_VERSION_1_3_binlog,
+    of_oxm_ip_ecn_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ip_proto_OF_VERSION_1_3_binlog,
+    of_oxm_ip_proto_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv4_dst_OF_VERSION_1_3_binlog,
+    of_oxm_ipv4_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv4_src_OF_VERSION_1_3_binlog,
+    of_oxm_ipv4_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_dst_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_exthdr_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_exthdr_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_flabel_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_flabel_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_nd_sll_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_nd_target_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_nd_target_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_nd_tll_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_src_OF_VERSION_1_3_binlog,
+    of_oxm_ipv6_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_metadata_OF_VERSION_1_3_binlog,
+    of_oxm_metadata_masked_OF_VERSION_1_3_binlog,
+    of_oxm_mpls_bos_OF_VERSION_1_3_binlog,
+    of_oxm_mpls_bos_masked_OF_VERSION_1_3_binlog,
+    of_oxm_mpls_label_OF_VERSION_1_3_binlog,
+    of_oxm_mpls_label_masked_OF_VERSION_1_3_binlog,
+    of_oxm_mpls_tc_OF_VERSION_1_3_binlog,
+    of_oxm_mpls_tc_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c1_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c1_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c2_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c2_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c3_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c3_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c4_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_c4_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_mdtype_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_mdtype_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_np_OF_VERSION_1_3_binlog,
+    of_oxm_nsh_np_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsi_OF_VERSION_1_3_binlog,
+    of_oxm_nsi_masked_OF_VERSION_1_3_binlog,
+    of_oxm_nsp_OF_VERSION_1_3_binlog,
+    of_oxm_nsp_masked_OF_VERSION_1_3_binlog,
+    of_oxm_och_sigatt_OF_VERSION_1_3_binlog,
+    of_oxm_och_sigatt_basic_OF_VERSION_1_3_binlog,
+    of_oxm_och_sigatt_basic_masked_OF_VERSION_1_3_binlog,
+    of_oxm_och_sigatt_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_mpls_l2_port_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_mpls_l2_port_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_mpls_type_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_mpls_type_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_ovid_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_ovid_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_qos_index_OF_VERSION_1_3_binlog,
+    of_oxm_ofdpa_qos_index_masked_OF_VERSION_1_3_binlog,
+    of_oxm_ovs_tcp_flags_OF_VERSION_1_3_binlog,
+    of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_sctp_dst_OF_VERSION_1_3_binlog,
+    of_oxm_sctp_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_sctp_src_OF_VERSION_1_3_binlog,
+    of_oxm_sctp_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tcp_dst_OF_VERSION_1_3_binlog,
+    of_oxm_tcp_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tcp_src_OF_VERSION_1_3_binlog,
+    of_oxm_tcp_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tun_flags_OF_VERSION_1_3_binlog,
+    of_oxm_tun_flags_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gbp_flags_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gbp_flags_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gbp_id_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gbp_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gpe_flags_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gpe_flags_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gpe_np_OF_VERSION_1_3_binlog,
+    of_oxm_tun_gpe_np_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tunnel_id_OF_VERSION_1_3_binlog,
+    of_oxm_tunnel_id_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tunnel_ipv4_dst_OF_VERSION_1_3_binlog,
+    of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_tunnel_ipv4_src_OF_VERSION_1_3_binlog,
+    of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_udp_dst_OF_VERSION_1_3_binlog,
+    of_oxm_udp_dst_masked_OF_VERSION_1_3_binlog,
+    of_oxm_udp_src_OF_VERSION_1_3_binlog,
+    of_oxm_udp_src_masked_OF_VERSION_1_3_binlog,
+    of_oxm_vlan_pcp_OF_VERSION_1_3_binlog,
+    of_oxm_vlan_pcp_masked_OF_VERSION_1_3_binlog,
+    of_oxm_vlan_vid_OF_VERSION_1_3_binlog,
+    of_oxm_vlan_vid_masked_OF_VERSION_1_3_binlog,
+    of_packet_queue_OF_VERSION_1_3_binlog,
+    of_port_desc_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_desc_prop_optical_transport_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_optical_OF_VERSION_1_3_binlog,
+    of_port_optical_transport_application_code_OF_VERSION_1_3_binlog,
+    of_port_optical_transport_layer_entry_OF_VERSION_1_3_binlog,
+    of_port_optical_transport_layer_stack_OF_VERSION_1_3_binlog,
+    of_port_stats_entry_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_prop_max_rate_OF_VERSION_1_3_binlog,
+    of_queue_prop_min_rate_OF_VERSION_1_3_binlog,
+    of_queue_stats_entry_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_sdwn_entity_accesspoint_OF_VERSION_1_3_binlog,
+    of_sdwn_entity_band_OF_VERSION_1_3_binlog,
+    of_sdwn_entity_freq_OF_VERSION_1_3_binlog,
+    of_sdwn_entity_nic_OF_VERSION_1_3_binlog,
+    of_sdwn_entity_rate_OF_VERSION_1_3_binlog,
+    of_sdwn_entity_related_switch_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_feature_prop_apply_actions_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_apply_actions_miss_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_apply_setfield_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_feature_prop_instructions_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_instructions_miss_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_match_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_next_tables_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_next_tables_miss_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    of_table_feature_prop_wildcards_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_write_actions_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_write_actions_miss_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_write_setfield_OF_VERSION_1_3_binlog,
+    of_table_feature_prop_write_setfield_miss_OF_VERSION_1_3_binlog,
+    of_table_features_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_stats_entry_OF_VERSION_1_3_binlog,
+    of_uint32_OF_VERSION_1_3_binlog,
+    of_uint64_OF_VERSION_1_3_binlog,
+    of_uint8_OF_VERSION_1_3_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog
+};
+
+static const loci_obj_binlog_f binlog_funs_v5[OF_OBJECT_COUNT] = {
+    unknown_binlog, /* of_object, not a valid specific type */
+    of_aggregate_stats_reply_OF_VERSION_1_4_binlog,
+    of_aggregate_stats_request_OF_VERSION_1_4_binlog,
+    of_async_config_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_async_get_reply_OF_VERSION_1_4_binlog,
+    of_async_get_request_OF_VERSION_1_4_binlog,
+    of_async_set_OF_VERSION_1_4_binlog,
+    of_bad_action_error_msg_OF_VERSION_1_4_binlog,
+    of_bad_instruction_error_msg_OF_VERSION_1_4_binlog,
+    of_bad_match_error_msg_OF_VERSION_1_4_binlog,
+    of_bad_property_error_msg_OF_VERSION_1_4_binlog,
+    of_bad_request_error_msg_OF_VERSION_1_4_binlog,
+    of_barrier_reply_OF_VERSION_1_4_binlog,
+    of_barrier_request_OF_VERSION_1_4_binlog,
+    of_bsn_arp_idle_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_bsn_bw_clear_data_reply_OF_VERSION_1_4_binlog,
+    of_bsn_bw_clear_data_request_OF_VERSION_1_4_binlog,
+    of_bsn_bw_enable_get_reply_OF_VERSION_1_4_binlog,
+    of_bsn_bw_enable_get_request_OF_VERSION_1_4_binlog,
+    of_bsn_bw_enable_set_reply_OF_VERSION_1_4_binlog,
+    of_bsn_bw_enable_set_request_OF_VERSION_1_4_binlog,
+    of_bsn_controller_connections_reply_OF_VERSION_1_4_binlog,
+    of_bsn_controller_connections_request_OF_VERSION_1_4_binlog,
+    of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_debug_counter_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_debug_counter_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_error_OF_VERSION_1_4_binlog,
+    of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_flow_idle_OF_VERSION_1_4_binlog,
+    of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_4_binlog,
+    of_bsn_flow_idle_enable_get_request_OF_VERSION_1_4_binlog,
+    of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_4_binlog,
+    of_bsn_flow_idle_enable_set_request_OF_VERSION_1_4_binlog,
+    of_bsn_generic_async_OF_VERSION_1_4_binlog,
+    of_bsn_generic_command_OF_VERSION_1_4_binlog,
+    of_bsn_generic_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_generic_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_bucket_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_clear_reply_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_clear_request_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_add_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_delete_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_set_buckets_size_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_get_interfaces_reply_OF_VERSION_1_4_binlog,
+    of_bsn_get_interfaces_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_get_mirroring_reply_OF_VERSION_1_4_binlog,
+    of_bsn_get_mirroring_request_OF_VERSION_1_4_binlog,
+    of_bsn_get_switch_pipeline_reply_OF_VERSION_1_4_binlog,
+    of_bsn_get_switch_pipeline_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_image_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_image_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_lacp_convergence_notif_OF_VERSION_1_4_binlog,
+    of_bsn_lacp_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_lacp_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_log_OF_VERSION_1_4_binlog,
+    of_bsn_lua_command_reply_OF_VERSION_1_4_binlog,
+    of_bsn_lua_command_request_OF_VERSION_1_4_binlog,
+    of_bsn_lua_notification_OF_VERSION_1_4_binlog,
+    of_bsn_lua_upload_OF_VERSION_1_4_binlog,
+    of_bsn_pdu_rx_reply_OF_VERSION_1_4_binlog,
+    of_bsn_pdu_rx_request_OF_VERSION_1_4_binlog,
+    of_bsn_pdu_rx_timeout_OF_VERSION_1_4_binlog,
+    of_bsn_pdu_tx_reply_OF_VERSION_1_4_binlog,
+    of_bsn_pdu_tx_request_OF_VERSION_1_4_binlog,
+    of_bsn_port_counter_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_port_counter_stats_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_bsn_set_aux_cxns_reply_OF_VERSION_1_4_binlog,
+    of_bsn_set_aux_cxns_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_set_lacp_reply_OF_VERSION_1_4_binlog,
+    of_bsn_set_lacp_request_OF_VERSION_1_4_binlog,
+    of_bsn_set_mirroring_OF_VERSION_1_4_binlog,
+    of_bsn_set_pktin_suppression_reply_OF_VERSION_1_4_binlog,
+    of_bsn_set_pktin_suppression_request_OF_VERSION_1_4_binlog,
+    of_bsn_set_switch_pipeline_reply_OF_VERSION_1_4_binlog,
+    of_bsn_set_switch_pipeline_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_switch_pipeline_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_table_checksum_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_table_checksum_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_table_set_buckets_size_OF_VERSION_1_4_binlog,
+    of_bsn_takeover_OF_VERSION_1_4_binlog,
+    of_bsn_time_reply_OF_VERSION_1_4_binlog,
+    of_bsn_time_request_OF_VERSION_1_4_binlog,
+    of_bsn_virtual_port_create_reply_OF_VERSION_1_4_binlog,
+    of_bsn_virtual_port_create_request_OF_VERSION_1_4_binlog,
+    of_bsn_virtual_port_remove_reply_OF_VERSION_1_4_binlog,
+    of_bsn_virtual_port_remove_request_OF_VERSION_1_4_binlog,
+    of_bsn_vlan_counter_clear_OF_VERSION_1_4_binlog,
+    of_bsn_vlan_counter_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_vlan_counter_stats_request_OF_VERSION_1_4_binlog,
+    of_bsn_vrf_counter_stats_reply_OF_VERSION_1_4_binlog,
+    of_bsn_vrf_counter_stats_request_OF_VERSION_1_4_binlog,
+    of_bundle_add_msg_OF_VERSION_1_4_binlog,
+    of_bundle_ctrl_msg_OF_VERSION_1_4_binlog,
+    of_bundle_failed_error_msg_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_echo_reply_OF_VERSION_1_4_binlog,
+    of_echo_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_features_reply_OF_VERSION_1_4_binlog,
+    of_features_request_OF_VERSION_1_4_binlog,
+    of_flow_add_OF_VERSION_1_4_binlog,
+    of_flow_delete_OF_VERSION_1_4_binlog,
+    of_flow_delete_strict_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_flow_mod_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_flow_modify_OF_VERSION_1_4_binlog,
+    of_flow_modify_strict_OF_VERSION_1_4_binlog,
+    of_flow_monitor_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_flow_removed_OF_VERSION_1_4_binlog,
+    of_flow_stats_reply_OF_VERSION_1_4_binlog,
+    of_flow_stats_request_OF_VERSION_1_4_binlog,
+    of_get_config_reply_OF_VERSION_1_4_binlog,
+    of_get_config_request_OF_VERSION_1_4_binlog,
+    of_group_add_OF_VERSION_1_4_binlog,
+    of_group_delete_OF_VERSION_1_4_binlog,
+    of_group_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_group_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_group_features_stats_reply_OF_VERSION_1_4_binlog,
+    of_group_features_stats_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_group_mod_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_group_modify_OF_VERSION_1_4_binlog,
+    of_group_stats_reply_OF_VERSION_1_4_binlog,
+    of_group_stats_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_hello_OF_VERSION_1_4_binlog,
+    of_hello_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_meter_config_stats_reply_OF_VERSION_1_4_binlog,
+    of_meter_config_stats_request_OF_VERSION_1_4_binlog,
+    of_meter_features_stats_reply_OF_VERSION_1_4_binlog,
+    of_meter_features_stats_request_OF_VERSION_1_4_binlog,
+    of_meter_mod_OF_VERSION_1_4_binlog,
+    of_meter_mod_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_meter_stats_reply_OF_VERSION_1_4_binlog,
+    of_meter_stats_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_packet_in_OF_VERSION_1_4_binlog,
+    of_packet_out_OF_VERSION_1_4_binlog,
+    of_port_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_port_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_port_mod_OF_VERSION_1_4_binlog,
+    of_port_mod_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_port_stats_reply_OF_VERSION_1_4_binlog,
+    of_port_stats_request_OF_VERSION_1_4_binlog,
+    of_port_status_OF_VERSION_1_4_binlog,
+    of_queue_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_queue_desc_stats_request_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_op_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_queue_stats_reply_OF_VERSION_1_4_binlog,
+    of_queue_stats_request_OF_VERSION_1_4_binlog,
+    of_requestforward_OF_VERSION_1_4_binlog,
+    of_role_reply_OF_VERSION_1_4_binlog,
+    of_role_request_OF_VERSION_1_4_binlog,
+    of_role_request_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_role_status_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_set_config_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_switch_config_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_table_desc_stats_reply_OF_VERSION_1_4_binlog,
+    of_table_desc_stats_request_OF_VERSION_1_4_binlog,
+    of_table_features_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_table_features_stats_reply_OF_VERSION_1_4_binlog,
+    of_table_features_stats_request_OF_VERSION_1_4_binlog,
+    of_table_mod_OF_VERSION_1_4_binlog,
+    of_table_mod_failed_error_msg_OF_VERSION_1_4_binlog,
+    of_table_stats_reply_OF_VERSION_1_4_binlog,
+    of_table_stats_request_OF_VERSION_1_4_binlog,
+    of_table_status_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_bsn_checksum_OF_VERSION_1_4_binlog,
+    of_action_bsn_gentable_OF_VERSION_1_4_binlog,
+    of_action_bsn_mirror_OF_VERSION_1_4_binlog,
+    of_action_bsn_set_tunnel_dst_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_action_copy_ttl_in_OF_VERSION_1_4_binlog,
+    of_action_copy_ttl_out_OF_VERSION_1_4_binlog,
+    of_action_dec_mpls_ttl_OF_VERSION_1_4_binlog,
+    of_action_dec_nw_ttl_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_group_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_id_bsn_checksum_OF_VERSION_1_4_binlog,
+    of_action_id_bsn_gentable_OF_VERSION_1_4_binlog,
+    of_action_id_bsn_mirror_OF_VERSION_1_4_binlog,
+    of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_action_id_copy_ttl_in_OF_VERSION_1_4_binlog,
+    of_action_id_copy_ttl_out_OF_VERSION_1_4_binlog,
+    of_action_id_dec_mpls_ttl_OF_VERSION_1_4_binlog,
+    of_action_id_dec_nw_ttl_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_action_id_group_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_action_id_nicira_dec_ttl_OF_VERSION_1_4_binlog,
+    of_action_id_nicira_move_OF_VERSION_1_4_binlog,
+    of_action_id_nicira_pop_nsh_OF_VERSION_1_4_binlog,
+    of_action_id_nicira_push_nsh_OF_VERSION_1_4_binlog,
+    of_action_id_nicira_resubmit_OF_VERSION_1_4_binlog,
+    of_action_id_nicira_resubmit_table_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_id_output_OF_VERSION_1_4_binlog,
+    of_action_id_pop_mpls_OF_VERSION_1_4_binlog,
+    of_action_id_pop_pbb_OF_VERSION_1_4_binlog,
+    of_action_id_pop_vlan_OF_VERSION_1_4_binlog,
+    of_action_id_push_mpls_OF_VERSION_1_4_binlog,
+    of_action_id_push_pbb_OF_VERSION_1_4_binlog,
+    of_action_id_push_vlan_OF_VERSION_1_4_binlog,
+    of_action_id_set_field_OF_VERSION_1_4_binlog,
+    of_action_id_set_mpls_ttl_OF_VERSION_1_4_binlog,
+    of_action_id_set_nw_ttl_OF_VERSION_1_4_binlog,
+    of_action_id_set_queue_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_action_nicira_dec_ttl_OF_VERSION_1_4_binlog,
+    of_action_nicira_move_OF_VERSION_1_4_binlog,
+    of_action_nicira_pop_nsh_OF_VERSION_1_4_binlog,
+    of_action_nicira_push_nsh_OF_VERSION_1_4_binlog,
+    of_action_nicira_resubmit_OF_VERSION_1_4_binlog,
+    of_action_nicira_resubmit_table_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_output_OF_VERSION_1_4_binlog,
+    of_action_pop_mpls_OF_VERSION_1_4_binlog,
+    of_action_pop_pbb_OF_VERSION_1_4_binlog,
+    of_action_pop_vlan_OF_VERSION_1_4_binlog,
+    of_action_push_mpls_OF_VERSION_1_4_binlog,
+    of_action_push_pbb_OF_VERSION_1_4_binlog,
+    of_action_push_vlan_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_field_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_mpls_ttl_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_action_set_nw_ttl_OF_VERSION_1_4_binlog,
+    of_action_set_queue_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_async_config_prop_experimenter_master_OF_VERSION_1_4_binlog,
+    of_async_config_prop_experimenter_slave_OF_VERSION_1_4_binlog,
+    of_async_config_prop_flow_removed_master_OF_VERSION_1_4_binlog,
+    of_async_config_prop_flow_removed_slave_OF_VERSION_1_4_binlog,
+    of_async_config_prop_packet_in_master_OF_VERSION_1_4_binlog,
+    of_async_config_prop_packet_in_slave_OF_VERSION_1_4_binlog,
+    of_async_config_prop_port_status_master_OF_VERSION_1_4_binlog,
+    of_async_config_prop_port_status_slave_OF_VERSION_1_4_binlog,
+    of_async_config_prop_requestforward_master_OF_VERSION_1_4_binlog,
+    of_async_config_prop_requestforward_slave_OF_VERSION_1_4_binlog,
+    of_async_config_prop_role_status_master_OF_VERSION_1_4_binlog,
+    of_async_config_prop_role_status_slave_OF_VERSION_1_4_binlog,
+    of_async_config_prop_table_status_master_OF_VERSION_1_4_binlog,
+    of_async_config_prop_table_status_slave_OF_VERSION_1_4_binlog,
+    of_bsn_controller_connection_OF_VERSION_1_4_binlog,
+    of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_debug_counter_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_generic_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_desc_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_entry_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_gentable_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_interface_OF_VERSION_1_4_binlog,
+    of_bsn_lacp_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_port_counter_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_table_checksum_stats_entry_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_bsn_tlv_actor_key_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_actor_port_num_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_actor_port_priority_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_actor_state_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_actor_system_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_actor_system_priority_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_anchor_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_apply_bytes_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_apply_packets_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_auto_negotiation_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_broadcast_rate_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_bucket_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_circuit_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_convergence_status_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_cpu_lag_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_crc_enabled_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_data_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_data_mask_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_decap_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_drop_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_dscp_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ecn_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_egress_only_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_egress_port_group_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_eth_dst_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_eth_src_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_eth_type_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_external_gateway_ip_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_external_gateway_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_external_ip_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_external_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_external_netmask_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_generation_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_hash_packet_field_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_hash_packet_type_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_hash_seed_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_hash_type_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_header_size_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_icmp_code_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_icmp_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_icmp_type_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_idle_notification_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_idle_time_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_idle_timeout_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_igmp_snooping_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_internal_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_interval_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ip_proto_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv4_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv4_dst_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv4_netmask_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv4_src_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv6_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv6_dst_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv6_prefix_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ipv6_src_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_known_multicast_rate_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_l3_src_class_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_loopback_port_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_mac_mask_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_miss_packets_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_mpls_control_word_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_mpls_label_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_mpls_sequenced_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_multicast_interface_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_name_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ndp_offload_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ndp_static_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_negate_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_next_hop_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_offset_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_parent_port_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_partner_key_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_partner_port_num_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_partner_port_priority_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_partner_state_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_partner_system_mac_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_partner_system_priority_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_port_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_port_usage_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_priority_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_qos_priority_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_queue_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_queue_weight_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_rate_limit_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_rate_unit_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_reference_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_reply_packets_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_request_packets_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_rx_bytes_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_rx_packets_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_sampling_rate_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_set_loopback_mode_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_status_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_sub_agent_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_tcp_dst_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_tcp_flags_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_tcp_src_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_ttl_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_tunnel_capability_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_tx_bytes_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_tx_packets_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_udf_anchor_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_udf_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_udf_length_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_udf_offset_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_udp_dst_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_udp_src_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_uint64_list_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_unicast_rate_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_untagged_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_use_packet_state_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vfi_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vfp_class_id_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vlan_mac_list_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vlan_pcp_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vlan_vid_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vni_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vpn_key_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vrf_OF_VERSION_1_4_binlog,
+    of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_4_binlog,
+    of_bsn_vlan_counter_stats_entry_OF_VERSION_1_4_binlog,
+    of_bsn_vlan_mac_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_bsn_vport_l2gre_OF_VERSION_1_4_binlog,
+    of_bsn_vport_q_in_q_OF_VERSION_1_4_binlog,
+    of_bsn_vrf_counter_stats_entry_OF_VERSION_1_4_binlog,
+    of_bucket_OF_VERSION_1_4_binlog,
+    of_bucket_counter_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_flow_stats_entry_OF_VERSION_1_4_binlog,
+    of_group_desc_stats_entry_OF_VERSION_1_4_binlog,
+    of_group_stats_entry_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_hello_elem_versionbitmap_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_instruction_apply_actions_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_instruction_bsn_arp_offload_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_auto_negotiation_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_deny_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_dhcp_offload_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_disable_l3_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_hash_select_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_internal_priority_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_ndp_offload_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_packet_of_death_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_permit_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_prioritize_pdus_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_4_binlog,
+    of_instruction_bsn_span_destination_OF_VERSION_1_4_binlog,
+    of_instruction_clear_actions_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_instruction_goto_table_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_instruction_id_apply_actions_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_instruction_id_bsn_arp_offload_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_deny_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_disable_l3_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_hash_select_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_internal_priority_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_ndp_offload_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_packet_of_death_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_permit_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_4_binlog,
+    of_instruction_id_bsn_span_destination_OF_VERSION_1_4_binlog,
+    of_instruction_id_clear_actions_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_instruction_id_goto_table_OF_VERSION_1_4_binlog,
+    of_instruction_id_meter_OF_VERSION_1_4_binlog,
+    of_instruction_id_write_actions_OF_VERSION_1_4_binlog,
+    of_instruction_id_write_metadata_OF_VERSION_1_4_binlog,
+    of_instruction_meter_OF_VERSION_1_4_binlog,
+    of_instruction_write_actions_OF_VERSION_1_4_binlog,
+    of_instruction_write_metadata_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_match_v3_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_meter_band_drop_OF_VERSION_1_4_binlog,
+    of_meter_band_dscp_remark_OF_VERSION_1_4_binlog,
+    of_meter_band_experimenter_OF_VERSION_1_4_binlog,
+    of_meter_band_stats_OF_VERSION_1_4_binlog,
+    of_meter_config_OF_VERSION_1_4_binlog,
+    of_meter_features_OF_VERSION_1_4_binlog,
+    of_meter_stats_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_arp_op_OF_VERSION_1_4_binlog,
+    of_oxm_arp_op_masked_OF_VERSION_1_4_binlog,
+    of_oxm_arp_sha_OF_VERSION_1_4_binlog,
+    of_oxm_arp_sha_masked_OF_VERSION_1_4_binlog,
+    of_oxm_arp_spa_OF_VERSION_1_4_binlog,
+    of_oxm_arp_spa_masked_OF_VERSION_1_4_binlog,
+    of_oxm_arp_tha_OF_VERSION_1_4_binlog,
+    of_oxm_arp_tha_masked_OF_VERSION_1_4_binlog,
+    of_oxm_arp_tpa_OF_VERSION_1_4_binlog,
+    of_oxm_arp_tpa_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_egr_port_group_id_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_bsn_in_ports_128_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_in_ports_512_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_inner_eth_dst_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_inner_eth_src_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_ip_fragmentation_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_l2_cache_hit_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_l3_src_class_id_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_lag_id_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_lag_id_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_tcp_flags_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf0_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf0_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf1_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf1_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf2_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf2_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf3_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf3_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf4_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf4_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf5_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf5_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf6_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf6_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf7_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_udf7_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vfi_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vfi_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vrf_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vrf_masked_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vxlan_network_id_OF_VERSION_1_4_binlog,
+    of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_encap_eth_dst_OF_VERSION_1_4_binlog,
+    of_oxm_encap_eth_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_encap_eth_src_OF_VERSION_1_4_binlog,
+    of_oxm_encap_eth_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_encap_eth_type_OF_VERSION_1_4_binlog,
+    of_oxm_encap_eth_type_masked_OF_VERSION_1_4_binlog,
+    of_oxm_eth_dst_OF_VERSION_1_4_binlog,
+    of_oxm_eth_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_eth_src_OF_VERSION_1_4_binlog,
+    of_oxm_eth_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_eth_type_OF_VERSION_1_4_binlog,
+    of_oxm_eth_type_masked_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_icmpv4_code_OF_VERSION_1_4_binlog,
+    of_oxm_icmpv4_code_masked_OF_VERSION_1_4_binlog,
+    of_oxm_icmpv4_type_OF_VERSION_1_4_binlog,
+    of_oxm_icmpv4_type_masked_OF_VERSION_1_4_binlog,
+    of_oxm_icmpv6_code_OF_VERSION_1_4_binlog,
+    of_oxm_icmpv6_code_masked_OF_VERSION_1_4_binlog,
+    of_oxm_icmpv6_type_OF_VERSION_1_4_binlog,
+    of_oxm_icmpv6_type_masked_OF_VERSION_1_4_binlog,
+    of_oxm_in_phy_port_OF_VERSION_1_4_binlog,
+    of_oxm_in_phy_port_masked_OF_VERSION_1_4_binlog,
+    of_oxm_in_port_OF_VERSION_1_4_binlog,
+    of_oxm_in_port_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ip_dscp_OF_VERSION_1_4_binlog,
+    of_oxm_ip_dscp_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ip_ecn_OF_VERSION_1_4_binlog,
+    of_oxm_ip_ecn_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ip_proto_OF_VERSION_1_4_binlog,
+    of_oxm_ip_proto_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv4_dst_OF_VERSION_1_4_binlog,
+    of_oxm_ipv4_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv4_src_OF_VERSION_1_4_binlog,
+    of_oxm_ipv4_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_dst_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_exthdr_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_exthdr_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_flabel_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_flabel_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_nd_sll_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_nd_target_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_nd_target_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_nd_tll_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_src_OF_VERSION_1_4_binlog,
+    of_oxm_ipv6_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_metadata_OF_VERSION_1_4_binlog,
+    of_oxm_metadata_masked_OF_VERSION_1_4_binlog,
+    of_oxm_mpls_bos_OF_VERSION_1_4_binlog,
+    of_oxm_mpls_bos_masked_OF_VERSION_1_4_binlog,
+    of_oxm_mpls_label_OF_VERSION_1_4_binlog,
+    of_oxm_mpls_label_masked_OF_VERSION_1_4_binlog,
+    of_oxm_mpls_tc_OF_VERSION_1_4_binlog,
+    of_oxm_mpls_tc_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c1_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c1_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c2_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c2_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c3_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c3_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c4_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_c4_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_mdtype_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_mdtype_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_np_OF_VERSION_1_4_binlog,
+    of_oxm_nsh_np_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsi_OF_VERSION_1_4_binlog,
+    of_oxm_nsi_masked_OF_VERSION_1_4_binlog,
+    of_oxm_nsp_OF_VERSION_1_4_binlog,
+    of_oxm_nsp_masked_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_oxm_ovs_tcp_flags_OF_VERSION_1_4_binlog,
+    of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_4_binlog,
+    of_oxm_pbb_uca_OF_VERSION_1_4_binlog,
+    of_oxm_pbb_uca_masked_OF_VERSION_1_4_binlog,
+    of_oxm_sctp_dst_OF_VERSION_1_4_binlog,
+    of_oxm_sctp_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_sctp_src_OF_VERSION_1_4_binlog,
+    of_oxm_sctp_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tcp_dst_OF_VERSION_1_4_binlog,
+    of_oxm_tcp_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tcp_src_OF_VERSION_1_4_binlog,
+    of_oxm_tcp_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tun_flags_OF_VERSION_1_4_binlog,
+    of_oxm_tun_flags_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gbp_flags_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gbp_flags_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gbp_id_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gbp_id_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gpe_flags_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gpe_flags_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gpe_np_OF_VERSION_1_4_binlog,
+    of_oxm_tun_gpe_np_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tunnel_id_OF_VERSION_1_4_binlog,
+    of_oxm_tunnel_id_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tunnel_ipv4_dst_OF_VERSION_1_4_binlog,
+    of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_tunnel_ipv4_src_OF_VERSION_1_4_binlog,
+    of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_udp_dst_OF_VERSION_1_4_binlog,
+    of_oxm_udp_dst_masked_OF_VERSION_1_4_binlog,
+    of_oxm_udp_src_OF_VERSION_1_4_binlog,
+    of_oxm_udp_src_masked_OF_VERSION_1_4_binlog,
+    of_oxm_vlan_pcp_OF_VERSION_1_4_binlog,
+    of_oxm_vlan_pcp_masked_OF_VERSION_1_4_binlog,
+    of_oxm_vlan_vid_OF_VERSION_1_4_binlog,
+    of_oxm_vlan_vid_masked_OF_VERSION_1_4_binlog,
+    of_packet_queue_OF_VERSION_1_4_binlog,
+    of_port_desc_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_desc_prop_bsn_forward_error_correction_OF_VERSION_1_4_binlog,
+    of_port_desc_prop_bsn_generation_id_OF_VERSION_1_4_binlog,
+    of_port_desc_prop_bsn_uplink_OF_VERSION_1_4_binlog,
+    of_port_desc_prop_ethernet_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_port_desc_prop_optical_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_mod_prop_ethernet_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_port_mod_prop_optical_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_port_stats_entry_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_port_stats_prop_ethernet_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_port_stats_prop_optical_OF_VERSION_1_4_binlog,
+    of_queue_desc_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_desc_prop_bsn_queue_name_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_queue_desc_prop_max_rate_OF_VERSION_1_4_binlog,
+    of_queue_desc_prop_min_rate_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_queue_prop_max_rate_OF_VERSION_1_4_binlog,
+    of_queue_prop_min_rate_OF_VERSION_1_4_binlog,
+    of_queue_stats_entry_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_desc_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_table_feature_prop_apply_actions_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_apply_actions_miss_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_apply_setfield_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    of_table_feature_prop_instructions_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_instructions_miss_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_match_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_next_tables_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_next_tables_miss_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_table_sync_from_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_wildcards_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_write_actions_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_write_actions_miss_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_write_setfield_OF_VERSION_1_4_binlog,
+    of_table_feature_prop_write_setfield_miss_OF_VERSION_1_4_binlog,
+    of_table_features_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_table_mod_prop_eviction_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    of_table_mod_prop_vacancy_OF_VERSION_1_4_binlog,
+    of_table_stats_entry_OF_VERSION_1_4_binlog,
+    of_uint32_OF_VERSION_1_4_binlog,
+    of_uint64_OF_VERSION_1_4_binlog,
+    of_uint8_OF_VERSION_1_4_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog,
+    unknown_binlog
+};
+
+static const loci_obj_binlog_f *const binlog_funs[] = {
+    [1] = binlog_funs_v1,
+    [2] = binlog_funs_v2,
+    [3] = binlog_funs_v3,
+    [4] = binlog_funs_v4,
+    [5] = binlog_funs_v5,
+};
+
+static void
+binlog_fields(loci_stream_t *s, of_object_t *obj)
+{
+    if ((obj->object_id > 0) && (obj->object_id < OF_OBJECT_COUNT) &&
+            OF_VERSION_OKAY(obj->version)) {
+        binlog_funs[obj->version][obj->object_id](s, obj);
+    } else {
+        unknown_binlog(s, obj);
+    }
+}
+
+/**
+ * Log a nested object as an OBJECT ... END field sequence
+ */
+void
+loci_binlog_object(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t object_id = (uint16_t)obj->object_id;
+    uint8_t *out;
+
+    if ((out = loci_stream_reserve(s, 4)) == NULL) {
+        return;
+    }
+    out[0] = LOCI_BINLOG_TAG_OBJECT;
+    MEMCPY(out + 1, &object_id, sizeof(object_id));
+    out[3] = (uint8_t)obj->version;
+    loci_stream_advance(s, 4);
+
+    binlog_fields(s, obj);
+
+    loci_stream_putc(s, LOCI_BINLOG_TAG_END);
+}
+
+/**
+ * Write a binary log record for any OF object
+ * @param s The output stream
+ * @param obj The object to log
+ * @returns OF_ERROR_NONE or the stream error
+ */
+int
+of_object_binlog(loci_stream_t *s, of_object_t *obj)
+{
+    uint16_t object_id = (uint16_t)obj->object_id;
+    uint32_t length;
+    uint8_t *hdr;
+
+    if (loci_stream_reserve(s, LOCI_BINLOG_HEADER_LENGTH) == NULL) {
+        return s->error;
+    }
+
+    /* Keep the header in the buffer until the length is known */
+    s->hold = s->pos;
+    loci_stream_advance(s, LOCI_BINLOG_HEADER_LENGTH);
+
+    binlog_fields(s, obj);
+
+    if (s->error == OF_ERROR_NONE) {
+        hdr = s->buf + s->hold;
+        length = s->pos - s->hold;
+        MEMCPY(hdr, &length, sizeof(length));
+        MEMCPY(hdr + 4, &object_id, sizeof(object_id));
+        hdr[6] = (uint8_t)obj->version;
+        hdr[7] = LOCI_BINLOG_HOST_FLAGS;
+    }
+    s->hold = -1;
+
+    return s->error;
+}
@@ -0,0 +1,426 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_packet.c
+ *
+ * Packet header parsing into an of_match_t.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_packet.h>
+
+#define ETH_HEADER_LENGTH 14
+#define VLAN_HEADER_LENGTH 4
+#define MPLS_HEADER_LENGTH 4
+#define IPV4_HEADER_LENGTH 20
+#define IPV6_HEADER_LENGTH 40
+#define IPV6_EXT_HEADER_LENGTH 8
+#define ARP_HEADER_LENGTH 28
+#define ND_HEADER_LENGTH 24
+
+#define ETH_TYPE_IPV4 0x0800
+#define ETH_TYPE_ARP 0x0806
+#define ETH_TYPE_VLAN 0x8100
+#define ETH_TYPE_IPV6 0x86dd
+#define ETH_TYPE_MPLS 0x8847
+#define ETH_TYPE_MPLS_MCAST 0x8848
+#define ETH_TYPE_QINQ 0x88a8
+
+/* Smallest Ethernet II type; a smaller value is an 802.3 length */
+#define ETH_TYPE_MIN 0x0600
+/* eth_type of an 802.3 frame, as in OpenFlow 1.0 */
+#define ETH_TYPE_NOT_ETH_TYPE 0x05ff
+
+#define IP_PROTO_HOPOPTS 0
+#define IP_PROTO_ICMP 1
+#define IP_PROTO_TCP 6
+#define IP_PROTO_UDP 17
+#define IP_PROTO_ROUTING 43
+#define IP_PROTO_FRAGMENT 44
+#define IP_PROTO_ICMPV6 58
+#define IP_PROTO_DSTOPTS 60
+#define IP_PROTO_SCTP 132
+
+#define ICMPV6_ND_SOLICIT 135
+#define ICMPV6_ND_ADVERT 136
+#define ND_OPT_SLL 1
+#define ND_OPT_TLL 2
+
+#define VLAN_VID_PRESENT 0x1000
+
+/* Groups with fields past the Ethernet header */
+#define FIELDS_L3 (LOCI_PACKET_FIELDS_MPLS | LOCI_PACKET_FIELDS_IP | \
+                   LOCI_PACKET_FIELDS_ARP | LOCI_PACKET_FIELDS_L4 | \
+                   LOCI_PACKET_FIELDS_ND)
+/* Groups with fields past the IP header */
+#define FIELDS_L4 (LOCI_PACKET_FIELDS_L4 | LOCI_PACKET_FIELDS_ND)
+
+/**
+ * ICMPv6 neighbor solicitation or advertisement: the target and the
+ * link layer address option
+ */
+static int
+nd_parse(uint8_t *pkt, int len, uint8_t type, of_match_t *match)
+{
+    uint8_t opt_type;
+    int offset, opt_len;
+
+    if (len < ND_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+    buf_ipv6_get(pkt + 8, &match->fields.ipv6_nd_target);
+    OF_MATCH_MASK_IPV6_ND_TARGET_EXACT_SET(match);
+
+    for (offset = ND_HEADER_LENGTH; offset + 8 <= len; offset += opt_len) {
+        opt_type = pkt[offset];
+        opt_len = pkt[offset + 1] * 8;
+        if (opt_len == 0 || offset + opt_len > len) {
+            return OF_ERROR_PARSE;
+        }
+        if (opt_type == ND_OPT_SLL && type == ICMPV6_ND_SOLICIT) {
+            buf_mac_get(pkt + offset + 2, &match->fields.ipv6_nd_sll);
+            OF_MATCH_MASK_IPV6_ND_SLL_EXACT_SET(match);
+        } else if (opt_type == ND_OPT_TLL && type == ICMPV6_ND_ADVERT) {
+            buf_mac_get(pkt + offset + 2, &match->fields.ipv6_nd_tll);
+            OF_MATCH_MASK_IPV6_ND_TLL_EXACT_SET(match);
+        }
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/* The L4 header of an IPv4 or IPv6 packet */
+static int
+l4_parse(uint8_t *pkt, int len, uint8_t proto, uint32_t fields,
+         of_match_t *match)
+{
+    uint16_t src, dst;
+    uint8_t type, code;
+
+    switch (proto) {
+    case IP_PROTO_TCP:
+    case IP_PROTO_UDP:
+    case IP_PROTO_SCTP:
+        if (!(fields & LOCI_PACKET_FIELDS_L4)) {
+            return OF_ERROR_NONE;
+        }
+        if (len < 4) {
+            return OF_ERROR_PARSE;
+        }
+        buf_u16_get(pkt, &src);
+        buf_u16_get(pkt + 2, &dst);
+        if (proto == IP_PROTO_TCP) {
+            match->fields.tcp_src = src;
+            match->fields.tcp_dst = dst;
+            OF_MATCH_MASK_TCP_SRC_EXACT_SET(match);
+            OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+        } else if (proto == IP_PROTO_UDP) {
+            match->fields.udp_src = src;
+            match->fields.udp_dst = dst;
+            OF_MATCH_MASK_UDP_SRC_EXACT_SET(match);
+            OF_MATCH_MASK_UDP_DST_EXACT_SET(match);
+        } else {
+            match->fields.sctp_src = src;
+            match->fields.sctp_dst = dst;
+            OF_MATCH_MASK_SCTP_SRC_EXACT_SET(match);
+            OF_MATCH_MASK_SCTP_DST_EXACT_SET(match);
+        }
+        return OF_ERROR_NONE;
+    case IP_PROTO_ICMP:
+        if (!(fields & LOCI_PACKET_FIELDS_L4)) {
+            return OF_ERROR_NONE;
+        }
+        if (len < 2) {
+            return OF_ERROR_PARSE;
+        }
+        match->fields.icmpv4_type = pkt[0];
+        match->fields.icmpv4_code = pkt[1];
+        OF_MATCH_MASK_ICMPV4_TYPE_EXACT_SET(match);
+        OF_MATCH_MASK_ICMPV4_CODE_EXACT_SET(match);
+        return OF_ERROR_NONE;
+    case IP_PROTO_ICMPV6:
+        if (len < 4) {
+            return OF_ERROR_PARSE;
+        }
+        type = pkt[0];
+        code = pkt[1];
+        if (fields & LOCI_PACKET_FIELDS_L4) {
+            match->fields.icmpv6_code = code;
+            OF_MATCH_MASK_ICMPV6_CODE_EXACT_SET(match);
+        }
+        if ((fields & LOCI_PACKET_FIELDS_ND) && code == 0 &&
+            (type == ICMPV6_ND_SOLICIT || type == ICMPV6_ND_ADVERT)) {
+            match->fields.icmpv6_type = type;
+            OF_MATCH_MASK_ICMPV6_TYPE_EXACT_SET(match);
+            return nd_parse(pkt, len, type, match);
+        }
+        if (fields & LOCI_PACKET_FIELDS_L4) {
+            match->fields.icmpv6_type = type;
+            OF_MATCH_MASK_ICMPV6_TYPE_EXACT_SET(match);
+        }
+        return OF_ERROR_NONE;
+    default:
+        return OF_ERROR_NONE;
+    }
+}
+
+static int
+ipv4_parse(uint8_t *pkt, int len, uint32_t fields, of_match_t *match)
+{
+    uint16_t total_len, frag;
+    uint8_t tos, proto;
+    int ihl;
+
+    if (len < IPV4_HEADER_LENGTH || (pkt[0] >> 4) != 4) {
+        return OF_ERROR_PARSE;
+    }
+    ihl = (pkt[0] & 0xf) * 4;
+    buf_u16_get(pkt + 2, &total_len);
+    if (ihl < IPV4_HEADER_LENGTH || ihl > len || total_len < ihl) {
+        return OF_ERROR_PARSE;
+    }
+    /* Drop the Ethernet padding; a truncated packet keeps what it has */
+    if (total_len < len) {
+        len = total_len;
+    }
+    tos = pkt[1];
+    proto = pkt[9];
+
+    if (fields & LOCI_PACKET_FIELDS_IP) {
+        match->fields.ip_dscp = tos >> 2;
+        match->fields.ip_ecn = tos & 3;
+        buf_u32_get(pkt + 12, &match->fields.ipv4_src);
+        buf_u32_get(pkt + 16, &match->fields.ipv4_dst);
+        OF_MATCH_MASK_IP_DSCP_EXACT_SET(match);
+        OF_MATCH_MASK_IP_ECN_EXACT_SET(match);
+        OF_MATCH_MASK_IPV4_SRC_EXACT_SET(match);
+        OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    }
+    if (!(fields & (LOCI_PACKET_FIELDS_IP | FIELDS_L4))) {
+        return OF_ERROR_NONE;
+    }
+    match->fields.ip_proto = proto;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+
+    /* Only the first fragment has the L4 header */
+    buf_u16_get(pkt + 6, &frag);
+    if (!(fields & FIELDS_L4) || (frag & 0x1fff) != 0) {
+        return OF_ERROR_NONE;
+    }
+
+    return l4_parse(pkt + ihl, len - ihl, proto, fields, match);
+}
+
+static int
+ipv6_parse(uint8_t *pkt, int len, uint32_t fields, of_match_t *match)
+{
+    uint32_t vtc_flow;
+    uint16_t payload_len, frag;
+    uint8_t next, tc;
+    int offset, first = 1;
+
+    if (len < IPV6_HEADER_LENGTH || (pkt[0] >> 4) != 6) {
+        return OF_ERROR_PARSE;
+    }
+    buf_u32_get(pkt, &vtc_flow);
+    buf_u16_get(pkt + 4, &payload_len);
+    /* A payload length of 0 is a jumbogram */
+    if (payload_len != 0 && IPV6_HEADER_LENGTH + payload_len < len) {
+        len = IPV6_HEADER_LENGTH + payload_len;
+    }
+    next = pkt[6];
+
+    if (fields & LOCI_PACKET_FIELDS_IP) {
+        tc = (vtc_flow >> 20) & 0xff;
+        match->fields.ip_dscp = tc >> 2;
+        match->fields.ip_ecn = tc & 3;
+        match->fields.ipv6_flabel = vtc_flow & 0xfffff;
+        buf_ipv6_get(pkt + 8, &match->fields.ipv6_src);
+        buf_ipv6_get(pkt + 24, &match->fields.ipv6_dst);
+        OF_MATCH_MASK_IP_DSCP_EXACT_SET(match);
+        OF_MATCH_MASK_IP_ECN_EXACT_SET(match);
+        OF_MATCH_MASK_IPV6_FLABEL_EXACT_SET(match);
+        OF_MATCH_MASK_IPV6_SRC_EXACT_SET(match);
+        OF_MATCH_MASK_IPV6_DST_EXACT_SET(match);
+    }
+    if (!(fields & (LOCI_PACKET_FIELDS_IP | FIELDS_L4))) {
+        return OF_ERROR_NONE;
+    }
+
+    /* ip_proto is the protocol after the extension headers */
+    offset = IPV6_HEADER_LENGTH;
+    for (;;) {
+        if (next == IP_PROTO_HOPOPTS || next == IP_PROTO_ROUTING ||
+            next == IP_PROTO_DSTOPTS) {
+            if (offset + IPV6_EXT_HEADER_LENGTH > len) {
+                return OF_ERROR_PARSE;
+            }
+            next = pkt[offset];
+            offset += (pkt[offset + 1] + 1) * 8;
+        } else if (next == IP_PROTO_FRAGMENT) {
+            if (offset + IPV6_EXT_HEADER_LENGTH > len) {
+                return OF_ERROR_PARSE;
+            }
+            next = pkt[offset];
+            buf_u16_get(pkt + offset + 2, &frag);
+            first = (frag & 0xfff8) == 0;
+            offset += IPV6_EXT_HEADER_LENGTH;
+        } else {
+            break;
+        }
+    }
+    if (offset > len) {
+        return OF_ERROR_PARSE;
+    }
+    match->fields.ip_proto = next;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+
+    if (!(fields & FIELDS_L4) || !first) {
+        return OF_ERROR_NONE;
+    }
+
+    return l4_parse(pkt + offset, len - offset, next, fields, match);
+}
+
+/* Ethernet/IPv4 ARP; other hardware or protocol types set no fields */
+static int
+arp_parse(uint8_t *pkt, int len, uint32_t fields, of_match_t *match)
+{
+    uint16_t htype, ptype;
+
+    if (!(fields & LOCI_PACKET_FIELDS_ARP)) {
+        return OF_ERROR_NONE;
+    }
+    if (len < ARP_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+    buf_u16_get(pkt, &htype);
+    buf_u16_get(pkt + 2, &ptype);
+    if (htype != 1 || ptype != ETH_TYPE_IPV4 || pkt[4] != 6 || pkt[5] != 4) {
+        return OF_ERROR_NONE;
+    }
+    buf_u16_get(pkt + 6, &match->fields.arp_op);
+    buf_mac_get(pkt + 8, &match->fields.arp_sha);
+    buf_u32_get(pkt + 14, &match->fields.arp_spa);
+    buf_mac_get(pkt + 18, &match->fields.arp_tha);
+    buf_u32_get(pkt + 24, &match->fields.arp_tpa);
+    OF_MATCH_MASK_ARP_OP_EXACT_SET(match);
+    OF_MATCH_MASK_ARP_SHA_EXACT_SET(match);
+    OF_MATCH_MASK_ARP_SPA_EXACT_SET(match);
+    OF_MATCH_MASK_ARP_THA_EXACT_SET(match);
+    OF_MATCH_MASK_ARP_TPA_EXACT_SET(match);
+
+    return OF_ERROR_NONE;
+}
+
+/* The top label of an MPLS packet */
+static int
+mpls_parse(uint8_t *pkt, int len, uint32_t fields, of_match_t *match)
+{
+    uint32_t lse;
+
+    if (!(fields & LOCI_PACKET_FIELDS_MPLS)) {
+        return OF_ERROR_NONE;
+    }
+    if (len < MPLS_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+    buf_u32_get(pkt, &lse);
+    match->fields.mpls_label = lse >> 12;
+    match->fields.mpls_tc = (lse >> 9) & 7;
+    match->fields.mpls_bos = (lse >> 8) & 1;
+    OF_MATCH_MASK_MPLS_LABEL_EXACT_SET(match);
+    OF_MATCH_MASK_MPLS_TC_EXACT_SET(match);
+    OF_MATCH_MASK_MPLS_BOS_EXACT_SET(match);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Parse the headers of a packet into an exact match
+ * @param version The version of the match, for the vlan_vid encoding
+ * @param pkt The packet, starting at the Ethernet header
+ * @param len Length of pkt
+ * @param fields The LOCI_PACKET_FIELDS_ groups to set
+ * @param match Cleared, then filled in
+ * @returns 0 or OF_ERROR_PARSE if a header is short or malformed
+ *
+ * On OF_ERROR_PARSE the match has the fields of the headers before the
+ * bad one, so a packet_in truncated by miss_send_len can still be used
+ * for the fields it has.
+ */
+int
+loci_packet_match(of_version_t version, uint8_t *pkt, int len,
+                  uint32_t fields, of_match_t *match)
+{
+    uint16_t eth_type, tci;
+    int offset;
+
+    MEMSET(match, 0, sizeof(*match));
+    match->version = version;
+
+    if (len < ETH_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+    if (fields & LOCI_PACKET_FIELDS_ETH) {
+        buf_mac_get(pkt, &match->fields.eth_dst);
+        buf_mac_get(pkt + 6, &match->fields.eth_src);
+        OF_MATCH_MASK_ETH_DST_EXACT_SET(match);
+        OF_MATCH_MASK_ETH_SRC_EXACT_SET(match);
+    }
+    buf_u16_get(pkt + 12, &eth_type);
+    offset = ETH_HEADER_LENGTH;
+
+    if (eth_type == ETH_TYPE_VLAN || eth_type == ETH_TYPE_QINQ) {
+        if (len < offset + VLAN_HEADER_LENGTH) {
+            return OF_ERROR_PARSE;
+        }
+        buf_u16_get(pkt + offset, &tci);
+        buf_u16_get(pkt + offset + 2, &eth_type);
+        offset += VLAN_HEADER_LENGTH;
+        if (fields & LOCI_PACKET_FIELDS_VLAN) {
+            match->fields.vlan_vid = tci & 0xfff;
+            if (version >= OF_VERSION_1_2) {
+                match->fields.vlan_vid |= VLAN_VID_PRESENT;
+            }
+            match->fields.vlan_pcp = tci >> 13;
+            OF_MATCH_MASK_VLAN_VID_EXACT_SET(match);
+            OF_MATCH_MASK_VLAN_PCP_EXACT_SET(match);
+        }
+    } else if (fields & LOCI_PACKET_FIELDS_VLAN) {
+        match->fields.vlan_vid = OF_MATCH_UNTAGGED_VLAN_ID(version);
+        OF_MATCH_MASK_VLAN_VID_EXACT_SET(match);
+    }
+    if (eth_type < ETH_TYPE_MIN) {
+        eth_type = ETH_TYPE_NOT_ETH_TYPE;
+    }
+
+    if (!(fields & (LOCI_PACKET_FIELDS_ETH | FIELDS_L3))) {
+        return OF_ERROR_NONE;
+    }
+    match->fields.eth_type = eth_type;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+
+    if (!(fields & FIELDS_L3)) {
+        return OF_ERROR_NONE;
+    }
+
+    switch (eth_type) {
+    case ETH_TYPE_IPV4:
+        return ipv4_parse(pkt + offset, len - offset, fields, match);
+    case ETH_TYPE_IPV6:
+        return ipv6_parse(pkt + offset, len - offset, fields, match);
+    case ETH_TYPE_ARP:
+        return arp_parse(pkt + offset, len - offset, fields, match);
+    case ETH_TYPE_MPLS:
+    case ETH_TYPE_MPLS_MCAST:
+        return mpls_parse(pkt + offset, len - offset, fields, match);
+    default:
+        return OF_ERROR_NONE;
+    }
+}
@@ -0,0 +1,890 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_parse.c
+ *
+ * Text parser for matches and flows; see loci_parse.h for the syntax.
+ *
+ * All scanning is done on (start, end) spans of the input so nothing
+ * is copied or allocated per token.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_parse.h>
+#include <loci/loci_match_fields.h>
+
+#define KEY_IS(p, len, lit) \
+    ((len) == sizeof(lit) - 1 && MEMCMP((p), (lit), sizeof(lit) - 1) == 0)
+
+static inline int
+is_sep(char c)
+{
+    return c == ',' || c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static inline int
+hex_val(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * Parse a decimal or 0x prefixed hex integer spanning [p, end)
+ */
+
+static int
+parse_u64(const char *p, const char *end, uint64_t *val)
+{
+    uint64_t v = 0;
+    int d;
+
+    if (p >= end) {
+        return OF_ERROR_PARSE;
+    }
+
+    if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        p += 2;
+        if (end - p > 16) {
+            return OF_ERROR_PARSE;
+        }
+        while (p < end) {
+            if ((d = hex_val(*p++)) < 0) {
+                return OF_ERROR_PARSE;
+            }
+            v = (v << 4) | d;
+        }
+    } else {
+        while (p < end) {
+            if (*p < '0' || *p > '9') {
+                return OF_ERROR_PARSE;
+            }
+            d = *p++ - '0';
+            if (v > (UINT64_MAX - d) / 10) {
+                return OF_ERROR_PARSE;
+            }
+            v = v * 10 + d;
+        }
+    }
+
+    *val = v;
+    return OF_ERROR_NONE;
+}
+
+static int
+parse_uint(const char *p, const char *end, uint64_t max, uint64_t *val)
+{
+    if (parse_u64(p, end, val) < 0 || *val > max) {
+        return OF_ERROR_PARSE;
+    }
+    return OF_ERROR_NONE;
+}
+
+static int
+parse_port(const char *p, const char *end, of_port_no_t *port)
+{
+    int len = end - p;
+    uint64_t v;
+
+    if (len > 0 && (*p < '0' || *p > '9')) {
+        if (KEY_IS(p, len, "in_port")) {
+            *port = OF_PORT_DEST_IN_PORT;
+        } else if (KEY_IS(p, len, "table")) {
+            *port = OF_PORT_DEST_USE_TABLE;
+        } else if (KEY_IS(p, len, "normal")) {
+            *port = OF_PORT_DEST_NORMAL;
+        } else if (KEY_IS(p, len, "flood")) {
+            *port = OF_PORT_DEST_FLOOD;
+        } else if (KEY_IS(p, len, "all")) {
+            *port = OF_PORT_DEST_ALL;
+        } else if (KEY_IS(p, len, "controller")) {
+            *port = OF_PORT_DEST_CONTROLLER;
+        } else if (KEY_IS(p, len, "local")) {
+            *port = OF_PORT_DEST_LOCAL;
+        } else if (KEY_IS(p, len, "any")) {
+            *port = OF_PORT_DEST_NONE;
+        } else {
+            return OF_ERROR_PARSE;
+        }
+        return OF_ERROR_NONE;
+    }
+
+    if (parse_uint(p, end, UINT32_MAX, &v) < 0) {
+        return OF_ERROR_PARSE;
+    }
+    *port = (of_port_no_t)v;
+    return OF_ERROR_NONE;
+}
+
+static int
+parse_ipv4(const char *p, const char *end, uint32_t *val)
+{
+    uint32_t v = 0, octet;
+    int i, digits;
+
+    for (i = 0; i < 4; i++) {
+        if (i > 0) {
+            if (p >= end || *p++ != '.') {
+                return OF_ERROR_PARSE;
+            }
+        }
+        octet = 0;
+        digits = 0;
+        while (p < end && *p >= '0' && *p <= '9' && digits < 3) {
+            octet = octet * 10 + (*p++ - '0');
+            digits++;
+        }
+        if (digits == 0 || octet > 255) {
+            return OF_ERROR_PARSE;
+        }
+        v = (v << 8) | octet;
+    }
+
+    if (p != end) {
+        return OF_ERROR_PARSE;
+    }
+    *val = v;
+    return OF_ERROR_NONE;
+}
+
+static int
+parse_mac(const char *p, const char *end, uint8_t *addr)
+{
+    int i, hi, lo;
+
+    if (end - p != 17) {
+        return OF_ERROR_PARSE;
+    }
+    for (i = 0; i < OF_MAC_ADDR_BYTES; i++, p += 3) {
+        if ((hi = hex_val(p[0])) < 0 || (lo = hex_val(p[1])) < 0 ||
+                (i < OF_MAC_ADDR_BYTES - 1 && p[2] != ':')) {
+            return OF_ERROR_PARSE;
+        }
+        addr[i] = (hi << 4) | lo;
+    }
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Parse an IPv6 address with optional :: compression
+ */
+
+static int
+parse_ipv6(const char *p, const char *end, uint8_t *addr)
+{
+    uint16_t groups[8];
+    int count = 0, gap = -1, i, d, digits;
+    uint32_t v;
+
+    if (end - p >= 2 && p[0] == ':' && p[1] == ':') {
+        gap = 0;
+        p += 2;
+    }
+
+    while (p < end) {
+        if (count == 8) {
+            return OF_ERROR_PARSE;
+        }
+        v = 0;
+        digits = 0;
+        while (p < end && (d = hex_val(*p)) >= 0) {
+            if (++digits > 4) {
+                return OF_ERROR_PARSE;
+            }
+            v = (v << 4) | d;
+            p++;
+        }
+        if (digits == 0) {
+            return OF_ERROR_PARSE;
+        }
+        groups[count++] = v;
+        if (p == end) {
+            break;
+        }
+        if (*p++ != ':') {
+            return OF_ERROR_PARSE;
+        }
+        if (p < end && *p == ':') {
+            if (gap >= 0) {
+                return OF_ERROR_PARSE;
+            }
+            gap = count;
+            p++;
+        } else if (p == end) {
+            return OF_ERROR_PARSE;
+        }
+    }
+
+    if ((gap < 0 && count != 8) || (gap >= 0 && count == 8)) {
+        return OF_ERROR_PARSE;
+    }
+
+    MEMSET(addr, 0, OF_IPV6_BYTES);
+    for (i = 0; i < count; i++) {
+        d = (gap >= 0 && i >= gap) ? i + 8 - count : i;
+        addr[2 * d] = groups[i] >> 8;
+        addr[2 * d + 1] = groups[i] & 0xff;
+    }
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Parse a 0x prefixed hex string into 'count' words, least
+ * significant word first
+ */
+
+static int
+parse_hex_words(const char *p, const char *end, uint64_t *words, int count)
+{
+    int d, i;
+
+    if (end - p < 3 || p[0] != '0' || (p[1] != 'x' && p[1] != 'X') ||
+            end - p - 2 > 16 * count) {
+        return OF_ERROR_PARSE;
+    }
+
+    MEMSET(words, 0, 8 * count);
+    for (i = 0, end--; end >= p + 2; end--, i++) {
+        if ((d = hex_val(*end)) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        words[i / 16] |= (uint64_t)d << (4 * (i % 16));
+    }
+    return OF_ERROR_NONE;
+}
+
+static void
+prefix_mask(uint8_t *mask, int bytes, int prefix)
+{
+    int i;
+
+    for (i = 0; i < bytes; i++, prefix -= 8) {
+        mask[i] = prefix >= 8 ? 0xff : (prefix <= 0 ? 0 : 0xff << (8 - prefix));
+    }
+}
+
+static void
+store_uint(uint8_t *dst, int size, uint64_t v)
+{
+    uint8_t v8;
+    uint16_t v16;
+    uint32_t v32;
+
+    switch (size) {
+    case 1: v8 = v; MEMCPY(dst, &v8, 1); break;
+    case 2: v16 = v; MEMCPY(dst, &v16, 2); break;
+    case 4: v32 = v; MEMCPY(dst, &v32, 4); break;
+    default: MEMCPY(dst, &v, 8); break;
+    }
+}
+
+/**
+ * Parse one value[/mask] for a match field into the match
+ */
+
+static int
+parse_field(const loci_match_field_t *field, const char *p, const char *end,
+            of_match_t *match)
+{
+    uint8_t *value = LOCI_MATCH_FIELD_VALUE(match, field);
+    uint8_t *mask = LOCI_MATCH_FIELD_MASK(match, field);
+    const char *slash = memchr(p, '/', end - p);
+    const char *vend = slash != NULL ? slash : end;
+    const char *m = vend + 1;
+    uint64_t v, max, words[8];
+    uint32_t ipv4;
+    of_port_no_t port;
+
+    switch (field->kind) {
+    case LOCI_MATCH_FIELD_U8:
+    case LOCI_MATCH_FIELD_U16:
+    case LOCI_MATCH_FIELD_U32:
+    case LOCI_MATCH_FIELD_U64:
+        max = field->size == 8 ? UINT64_MAX : (1ULL << (8 * field->size)) - 1;
+        if (field->offset == offsetof(of_match_fields_t, in_port) ||
+                field->offset == offsetof(of_match_fields_t, in_phy_port)) {
+            if (parse_port(p, vend, &port) < 0) {
+                return OF_ERROR_PARSE;
+            }
+            v = port;
+        } else if (parse_uint(p, vend, max, &v) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        store_uint(value, field->size, v);
+        if (slash != NULL) {
+            if (parse_uint(m, end, max, &v) < 0) {
+                return OF_ERROR_PARSE;
+            }
+            store_uint(mask, field->size, v);
+        } else {
+            MEMSET(mask, 0xff, field->size);
+        }
+        break;
+    case LOCI_MATCH_FIELD_IPV4:
+        if (parse_ipv4(p, vend, &ipv4) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        MEMCPY(value, &ipv4, sizeof(ipv4));
+        if (slash == NULL) {
+            ipv4 = 0xffffffff;
+        } else if (memchr(m, '.', end - m) != NULL) {
+            if (parse_ipv4(m, end, &ipv4) < 0) {
+                return OF_ERROR_PARSE;
+            }
+        } else {
+            if (parse_uint(m, end, 32, &v) < 0) {
+                return OF_ERROR_PARSE;
+            }
+            ipv4 = v == 0 ? 0 : 0xffffffff << (32 - v);
+        }
+        MEMCPY(mask, &ipv4, sizeof(ipv4));
+        break;
+    case LOCI_MATCH_FIELD_MAC:
+        if (parse_mac(p, vend, value) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        if (slash == NULL) {
+            MEMSET(mask, 0xff, OF_MAC_ADDR_BYTES);
+        } else if (parse_mac(m, end, mask) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        break;
+    case LOCI_MATCH_FIELD_IPV6:
+        if (parse_ipv6(p, vend, value) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        if (slash == NULL) {
+            MEMSET(mask, 0xff, OF_IPV6_BYTES);
+        } else if (memchr(m, ':', end - m) != NULL) {
+            if (parse_ipv6(m, end, mask) < 0) {
+                return OF_ERROR_PARSE;
+            }
+        } else {
+            if (parse_uint(m, end, 128, &v) < 0) {
+                return OF_ERROR_PARSE;
+            }
+            prefix_mask(mask, OF_IPV6_BYTES, v);
+        }
+        break;
+    case LOCI_MATCH_FIELD_BITMAP_128:
+    case LOCI_MATCH_FIELD_BITMAP_512:
+        /* of_bitmap_128_t stores the high word first */
+        if (parse_hex_words(p, vend, words, field->size / 8) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        if (field->kind == LOCI_MATCH_FIELD_BITMAP_128) {
+            v = words[0];
+            words[0] = words[1];
+            words[1] = v;
+        }
+        MEMCPY(value, words, field->size);
+        if (slash == NULL) {
+            MEMSET(mask, 0xff, field->size);
+            break;
+        }
+        if (parse_hex_words(m, end, words, field->size / 8) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        if (field->kind == LOCI_MATCH_FIELD_BITMAP_128) {
+            v = words[0];
+            words[0] = words[1];
+            words[1] = v;
+        }
+        MEMCPY(mask, words, field->size);
+        break;
+    default:
+        /* Signal ids have no text form */
+        return OF_ERROR_PARSE;
+    }
+
+    of_memmask(value, mask, field->size);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Scan the next key=value token
+ * @returns OF_ERROR_NONE, OF_ERROR_RANGE at the end of the input or
+ * OF_ERROR_PARSE
+ *
+ * On return *pp points at the start of the token.
+ */
+
+static int
+next_token(const char **pp, const char *end, const char **key_end,
+           const char **val, const char **val_end)
+{
+    const char *p = *pp;
+
+    while (p < end && is_sep(*p)) {
+        p++;
+    }
+    *pp = p;
+    if (p == end) {
+        return OF_ERROR_RANGE;
+    }
+
+    while (p < end && *p != '=' && !is_sep(*p)) {
+        p++;
+    }
+    *key_end = p;
+    if (p == end || *p != '=') {
+        return OF_ERROR_PARSE;
+    }
+    *val = ++p;
+    while (p < end && !is_sep(*p)) {
+        p++;
+    }
+    *val_end = p;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Parse a match
+ * @param str The text; need not be NUL terminated
+ * @param len Length of str
+ * @param match Filled with the parsed match; it is cleared first and
+ * its version is left as OF_VERSION_UNKNOWN
+ * @param errp If not NULL, set to the offending token on error
+ * @returns OF_ERROR_NONE or OF_ERROR_PARSE
+ */
+
+int
+loci_match_parse(const char *str, int len, of_match_t *match,
+                 const char **errp)
+{
+    const char *p = str, *end = str + len;
+    const char *key_end, *val, *val_end;
+    const loci_match_field_t *field;
+    int rv;
+
+    MEMSET(match, 0, sizeof(*match));
+
+    while ((rv = next_token(&p, end, &key_end, &val, &val_end)) == 0) {
+        if ((field = loci_match_field_lookup(p, key_end - p)) == NULL ||
+                parse_field(field, val, val_end, match) < 0) {
+            break;
+        }
+        p = val_end;
+    }
+
+    if (rv == OF_ERROR_RANGE) {
+        return OF_ERROR_NONE;
+    }
+    if (errp != NULL) {
+        *errp = p;
+    }
+    return OF_ERROR_PARSE;
+}
+
+/**
+ * Parse one action; [p, end) is "name[:arg[:arg]]"
+ */
+
+static int
+parse_action(const char *p, const char *end, loci_flow_t *flow)
+{
+    loci_flow_action_t *act;
+    const char *name_end, *arg, *arg_end, *arg2 = NULL;
+    of_port_no_t port;
+    uint64_t v;
+    int len;
+
+    name_end = memchr(p, ':', end - p);
+    if (name_end == NULL) {
+        name_end = end;
+        arg = arg_end = end;
+    } else {
+        arg = name_end + 1;
+        arg_end = memchr(arg, ':', end - arg);
+        if (arg_end == NULL) {
+            arg_end = end;
+        } else {
+            arg2 = arg_end + 1;
+        }
+    }
+    len = name_end - p;
+
+    if (KEY_IS(p, len, "drop")) {
+        return arg == end ? OF_ERROR_NONE : OF_ERROR_PARSE;
+    }
+
+    if (KEY_IS(p, len, "goto_table")) {
+        if (flow->goto_table >= 0 || arg2 != NULL ||
+                parse_uint(arg, arg_end, 0xff, &v) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        flow->goto_table = v;
+        return OF_ERROR_NONE;
+    }
+
+    if (flow->action_count == LOCI_FLOW_MAX_ACTIONS) {
+        return OF_ERROR_PARSE;
+    }
+    act = &flow->actions[flow->action_count];
+    act->arg = 0;
+    act->arg16 = 0;
+
+    if (KEY_IS(p, len, "output")) {
+        act->type = LOCI_FLOW_ACTION_OUTPUT;
+        if (parse_port(arg, arg_end, &port) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        act->arg = port;
+        if (arg2 != NULL) {
+            if (parse_uint(arg2, end, 0xffff, &v) < 0) {
+                return OF_ERROR_PARSE;
+            }
+            act->arg16 = v;
+        } else if (port == OF_PORT_DEST_CONTROLLER) {
+            /* Send the whole packet */
+            act->arg16 = 0xffff;
+        }
+    } else if (arg2 != NULL) {
+        return OF_ERROR_PARSE;
+    } else if (KEY_IS(p, len, "group")) {
+        act->type = LOCI_FLOW_ACTION_GROUP;
+        if (parse_uint(arg, arg_end, UINT32_MAX, &v) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        act->arg = v;
+    } else if (KEY_IS(p, len, "set_queue")) {
+        act->type = LOCI_FLOW_ACTION_SET_QUEUE;
+        if (parse_uint(arg, arg_end, UINT32_MAX, &v) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        act->arg = v;
+    } else if (KEY_IS(p, len, "push_vlan") || KEY_IS(p, len, "push_mpls") ||
+               KEY_IS(p, len, "pop_mpls")) {
+        act->type = p[1] == 'o' ? LOCI_FLOW_ACTION_POP_MPLS :
+            (p[5] == 'v' ? LOCI_FLOW_ACTION_PUSH_VLAN : LOCI_FLOW_ACTION_PUSH_MPLS);
+        if (parse_uint(arg, arg_end, 0xffff, &v) < 0) {
+            return OF_ERROR_PARSE;
+        }
+        act->arg16 = v;
+    } else if (KEY_IS(p, len, "pop_vlan") && arg == end) {
+        act->type = LOCI_FLOW_ACTION_POP_VLAN;
+    } else if (KEY_IS(p, len, "dec_nw_ttl") && arg == end) {
+        act->type = LOCI_FLOW_ACTION_DEC_NW_TTL;
+    } else {
+        return OF_ERROR_PARSE;
+    }
+
+    flow->action_count++;
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Parse a flow
+ * @param str The text; need not be NUL terminated
+ * @param len Length of str
+ * @param flow Filled with the parsed flow
+ * @param errp If not NULL, set to the offending token on error
+ * @returns OF_ERROR_NONE or OF_ERROR_PARSE
+ *
+ * Unspecified values default to priority 0x8000, no buffer, any out
+ * port and any out group.
+ */
+
+int
+loci_flow_parse(const char *str, int len, loci_flow_t *flow,
+                const char **errp)
+{
+    const char *p = str, *end = str + len;
+    const char *key_end, *val, *val_end, *slash, *a, *a_end;
+    const loci_match_field_t *field;
+    of_port_no_t port;
+    uint64_t v;
+    int klen, rv;
+
+    MEMSET(&flow->match, 0, sizeof(flow->match));
+    flow->cookie = 0;
+    flow->cookie_mask = 0;
+    flow->buffer_id = OF_BUFFER_ID_NO_BUFFER;
+    flow->out_port = OF_PORT_DEST_NONE;
+    flow->out_group = 0xffffffff;
+    flow->priority = 0x8000;
+    flow->idle_timeout = 0;
+    flow->hard_timeout = 0;
+    flow->importance = 0;
+    flow->flags = 0;
+    flow->table_id = 0;
+    flow->goto_table = -1;
+    flow->action_count = 0;
+
+    while ((rv = next_token(&p, end, &key_end, &val, &val_end)) == 0) {
+        klen = key_end - p;
+
+        if ((field = loci_match_field_lookup(p, klen)) != NULL) {
+            if (parse_field(field, val, val_end, &flow->match) < 0) {
+                break;
+            }
+        } else if (KEY_IS(p, klen, "actions")) {
+            /* The action list runs to the end of the input */
+            for (a = val; a < end; a = a_end) {
+                while (a < end && is_sep(*a)) {
+                    a++;
+                }
+                if (a == end) {
+                    break;
+                }
+                a_end = a;
+                while (a_end < end && !is_sep(*a_end)) {
+                    a_end++;
+                }
+                if (parse_action(a, a_end, flow) < 0) {
+                    if (errp != NULL) {
+                        *errp = a;
+                    }
+                    return OF_ERROR_PARSE;
+                }
+            }
+            return OF_ERROR_NONE;
+        } else if (KEY_IS(p, klen, "cookie")) {
+            slash = memchr(val, '/', val_end - val);
+            if (parse_u64(val, slash != NULL ? slash : val_end, &v) < 0) {
+                break;
+            }
+            flow->cookie = v;
+            if (slash != NULL) {
+                if (parse_u64(slash + 1, val_end, &v) < 0) {
+                    break;
+                }
+                flow->cookie_mask = v;
+            }
+        } else if (KEY_IS(p, klen, "out_port")) {
+            if (parse_port(val, val_end, &port) < 0) {
+                break;
+            }
+            flow->out_port = port;
+        } else if (KEY_IS(p, klen, "table")) {
+            if (parse_uint(val, val_end, 0xff, &v) < 0) {
+                break;
+            }
+            flow->table_id = v;
+        } else if (KEY_IS(p, klen, "buffer_id") ||
+                   KEY_IS(p, klen, "out_group")) {
+            if (parse_uint(val, val_end, UINT32_MAX, &v) < 0) {
+                break;
+            }
+            if (p[0] == 'b') {
+                flow->buffer_id = v;
+            } else {
+                flow->out_group = v;
+            }
+        } else {
+            uint16_t *dst;
+
+            if (KEY_IS(p, klen, "priority")) {
+                dst = &flow->priority;
+            } else if (KEY_IS(p, klen, "idle_timeout")) {
+                dst = &flow->idle_timeout;
+            } else if (KEY_IS(p, klen, "hard_timeout")) {
+                dst = &flow->hard_timeout;
+            } else if (KEY_IS(p, klen, "importance")) {
+                dst = &flow->importance;
+            } else if (KEY_IS(p, klen, "flags")) {
+                dst = &flow->flags;
+            } else {
+                break;
+            }
+            if (parse_uint(val, val_end, 0xffff, &v) < 0) {
+                break;
+            }
+            *dst = v;
+        }
+        p = val_end;
+    }
+
+    if (rv == OF_ERROR_RANGE) {
+        return OF_ERROR_NONE;
+    }
+    if (errp != NULL) {
+        *errp = p;
+    }
+    return OF_ERROR_PARSE;
+}
+
+/**
+ * Append one action to an action list
+ */
+
+static int
+action_append(of_list_action_t *list, loci_flow_action_t *act)
+{
+    of_version_t version = list->version;
+    of_object_t elt;
+    of_object_id_t id;
+    int rv;
+
+    switch (act->type) {
+    case LOCI_FLOW_ACTION_OUTPUT: id = OF_ACTION_OUTPUT; break;
+    case LOCI_FLOW_ACTION_GROUP: id = OF_ACTION_GROUP; break;
+    case LOCI_FLOW_ACTION_SET_QUEUE: id = OF_ACTION_SET_QUEUE; break;
+    case LOCI_FLOW_ACTION_PUSH_VLAN: id = OF_ACTION_PUSH_VLAN; break;
+    case LOCI_FLOW_ACTION_POP_VLAN:
+        /* OF 1.0 calls this strip_vlan */
+        id = version == OF_VERSION_1_0 ? OF_ACTION_STRIP_VLAN : OF_ACTION_POP_VLAN;
+        break;
+    case LOCI_FLOW_ACTION_PUSH_MPLS: id = OF_ACTION_PUSH_MPLS; break;
+    case LOCI_FLOW_ACTION_POP_MPLS: id = OF_ACTION_POP_MPLS; break;
+    case LOCI_FLOW_ACTION_DEC_NW_TTL: id = OF_ACTION_DEC_NW_TTL; break;
+    default: return OF_ERROR_PARAM;
+    }
+
+    if (of_object_fixed_len[version][id] < 0) {
+        return OF_ERROR_COMPAT;
+    }
+
+    of_object_init_map[id](&elt, version, -1, 1);
+    if ((rv = of_list_action_append_bind(list, &elt)) < 0) {
+        return rv;
+    }
+
+    switch (act->type) {
+    case LOCI_FLOW_ACTION_OUTPUT:
+        of_action_output_port_set(&elt, act->arg);
+        of_action_output_max_len_set(&elt, act->arg16);
+        break;
+    case LOCI_FLOW_ACTION_GROUP:
+        of_action_group_group_id_set(&elt, act->arg);
+        break;
+    case LOCI_FLOW_ACTION_SET_QUEUE:
+        of_action_set_queue_queue_id_set(&elt, act->arg);
+        break;
+    case LOCI_FLOW_ACTION_PUSH_VLAN:
+        of_action_push_vlan_ethertype_set(&elt, act->arg16);
+        break;
+    case LOCI_FLOW_ACTION_PUSH_MPLS:
+        of_action_push_mpls_ethertype_set(&elt, act->arg16);
+        break;
+    case LOCI_FLOW_ACTION_POP_MPLS:
+        of_action_pop_mpls_ethertype_set(&elt, act->arg16);
+        break;
+    default:
+        break;
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Fill in a flow add message from a parsed flow
+ * @param obj A flow add as returned by of_flow_add_new
+ * @param flow The parsed flow; its match version is set to that of obj
+ * @returns OF_ERROR_NONE, OF_ERROR_COMPAT if the flow can't be
+ * expressed in the version of obj, or OF_ERROR_RESOURCE
+ */
+
+int
+loci_flow_add_fill(of_flow_add_t *obj, loci_flow_t *flow)
+{
+    of_version_t version = obj->version;
+    of_list_action_t actions;
+    of_list_instruction_t instructions;
+    of_object_t ins;
+    int i, rv;
+
+    if (version == OF_VERSION_1_0 &&
+            (flow->table_id != 0 || flow->cookie_mask != 0 ||
+             flow->goto_table >= 0 || flow->out_group != 0xffffffff)) {
+        return OF_ERROR_COMPAT;
+    }
+    if (version < OF_VERSION_1_4 && flow->importance != 0) {
+        return OF_ERROR_COMPAT;
+    }
+
+    of_flow_add_cookie_set(obj, flow->cookie);
+    of_flow_add_idle_timeout_set(obj, flow->idle_timeout);
+    of_flow_add_hard_timeout_set(obj, flow->hard_timeout);
+    of_flow_add_priority_set(obj, flow->priority);
+    of_flow_add_buffer_id_set(obj, flow->buffer_id);
+    of_flow_add_out_port_set(obj, flow->out_port);
+    of_flow_add_flags_set(obj, flow->flags);
+    if (version >= OF_VERSION_1_1) {
+        of_flow_add_table_id_set(obj, flow->table_id);
+        of_flow_add_cookie_mask_set(obj, flow->cookie_mask);
+        of_flow_add_out_group_set(obj, flow->out_group);
+    }
+    if (version >= OF_VERSION_1_4) {
+        of_flow_add_importance_set(obj, flow->importance);
+    }
+
+    flow->match.version = version;
+    if ((rv = of_flow_add_match_set(obj, &flow->match)) < 0) {
+        return rv;
+    }
+
+    if (version == OF_VERSION_1_0) {
+        of_flow_add_actions_bind(obj, &actions);
+    } else {
+        of_flow_add_instructions_bind(obj, &instructions);
+        if (flow->action_count > 0) {
+            of_instruction_apply_actions_init(&ins, version, -1, 1);
+            if ((rv = of_list_instruction_append_bind(&instructions, &ins)) < 0) {
+                return rv;
+            }
+            of_instruction_apply_actions_actions_bind(&ins, &actions);
+        }
+    }
+
+    for (i = 0; i < flow->action_count; i++) {
+        if ((rv = action_append(&actions, &flow->actions[i])) < 0) {
+            return rv;
+        }
+    }
+
+    if (flow->goto_table >= 0) {
+        of_instruction_goto_table_init(&ins, version, -1, 1);
+        if ((rv = of_list_instruction_append_bind(&instructions, &ins)) < 0) {
+            return rv;
+        }
+        of_instruction_goto_table_table_id_set(&ins, flow->goto_table);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Parse a flow and build the flow add message for it
+ * @param version The OpenFlow version of the message
+ * @param str The text; need not be NUL terminated
+ * @param len Length of str
+ * @param rv If not NULL, set to the error code on failure
+ * @returns The new message or NULL on error
+ */
+
+of_flow_add_t *
+loci_flow_add_parse(of_version_t version, const char *str, int len, int *rv)
+{
+    loci_flow_t flow;
+    of_flow_add_t *obj;
+    int err;
+
+    if ((err = loci_flow_parse(str, len, &flow, NULL)) < 0) {
+        goto error;
+    }
+    if ((obj = of_flow_add_new(version)) == NULL) {
+        err = OF_ERROR_RESOURCE;
+        goto error;
+    }
+    if ((err = loci_flow_add_fill(obj, &flow)) < 0) {
+        of_flow_add_delete(obj);
+        goto error;
+    }
+    return obj;
+
+error:
+    if (rv != NULL) {
+        *rv = err;
+    }
+    return NULL;
+}
@@ -0,0 +1,492 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_pdu_sched.c
+ *
+ * Timer wheel scheduler of BSN PDU tx and rx slots.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_hash.h>
+#include <loci/loci_pdu_sched.h>
+
+#define BUCKET_MASK (LOCI_PDU_WHEEL_BUCKETS - 1)
+
+/* Experimenter message type and the BSN subtype of rx_timeout */
+#define EXPERIMENTER_TYPE 4
+#define SUBTYPE_RX_TIMEOUT 0x23
+
+/* Offsets in of_bsn_pdu_rx_timeout; the port is 16 bits in 1.0 */
+#define EXPERIMENTER_OFFSET 8
+#define SUBTYPE_OFFSET 12
+#define PORT_NO_OFFSET 16
+#define SLOT_NUM_OFFSET_1_0 18
+#define SLOT_NUM_OFFSET 20
+#define RX_TIMEOUT_BYTES_1_0 19
+#define RX_TIMEOUT_BYTES 21
+
+/****************************************************************
+ * Index
+ ****************************************************************/
+
+static uint64_t
+timer_hash(int kind, of_port_no_t port_no, uint8_t slot_num)
+{
+    uint64_t key = ((uint64_t)port_no << 16) | (slot_num << 8) | kind;
+
+    return loci_hash_finish(loci_hash_word(loci_hash_start(0), key));
+}
+
+/* Returns the pointer to the timer, or to the end of its slot's chain */
+static loci_pdu_timer_t **
+slot_find(loci_pdu_sched_t *sched, int kind, of_port_no_t port_no,
+          uint8_t slot_num)
+{
+    loci_pdu_timer_t **prev;
+    uint64_t hash = timer_hash(kind, port_no, slot_num);
+
+    for (prev = &sched->slots[hash & (sched->n_slots - 1)]; *prev != NULL;
+         prev = &(*prev)->next) {
+        if ((*prev)->port_no == port_no && (*prev)->slot_num == slot_num &&
+            (*prev)->kind == kind) {
+            break;
+        }
+    }
+
+    return prev;
+}
+
+static void
+slots_grow(loci_pdu_sched_t *sched)
+{
+    loci_pdu_timer_t **slots, *timer, *next;
+    uint32_t n_slots = sched->n_slots * 2;
+    uint32_t i, slot;
+
+    if ((slots = MALLOC(n_slots * sizeof(*slots))) == NULL) {
+        return;
+    }
+    MEMSET(slots, 0, n_slots * sizeof(*slots));
+    for (i = 0; i < sched->n_slots; i++) {
+        for (timer = sched->slots[i]; timer != NULL; timer = next) {
+            next = timer->next;
+            slot = timer_hash(timer->kind, timer->port_no, timer->slot_num) &
+                (n_slots - 1);
+            timer->next = slots[slot];
+            slots[slot] = timer;
+        }
+    }
+    FREE(sched->slots);
+    sched->slots = slots;
+    sched->n_slots = n_slots;
+}
+
+/****************************************************************
+ * Wheel
+ ****************************************************************/
+
+/*
+ * The level is the first whose tick is longer than the time left, and
+ * the bucket the timer's expiry in ticks of the level.  A timer due now
+ * goes in the level 0 bucket about to be fired.
+ */
+static void
+wheel_insert(loci_pdu_sched_t *sched, loci_pdu_timer_t *timer)
+{
+    loci_pdu_timer_t **head;
+    uint64_t left = timer->expires - sched->now;
+    int level;
+
+    for (level = 0; level < LOCI_PDU_WHEEL_LEVELS - 1; level++) {
+        if ((left >> ((level + 1) * LOCI_PDU_WHEEL_BITS)) == 0) {
+            break;
+        }
+    }
+
+    head = &sched->wheel[level][(timer->expires >>
+                                 (level * LOCI_PDU_WHEEL_BITS)) & BUCKET_MASK];
+    timer->level = level;
+    timer->wheel_next = *head;
+    timer->wheel_prev = head;
+    if (*head != NULL) {
+        (*head)->wheel_prev = &timer->wheel_next;
+    }
+    *head = timer;
+    sched->level_count[level]++;
+}
+
+static void
+wheel_unlink(loci_pdu_sched_t *sched, loci_pdu_timer_t *timer)
+{
+    *timer->wheel_prev = timer->wheel_next;
+    if (timer->wheel_next != NULL) {
+        timer->wheel_next->wheel_prev = timer->wheel_prev;
+    }
+    sched->level_count[timer->level]--;
+}
+
+/* Take all the timers of a bucket */
+static loci_pdu_timer_t *
+bucket_detach(loci_pdu_sched_t *sched, int level, int bucket)
+{
+    loci_pdu_timer_t *timers = sched->wheel[level][bucket], *timer;
+
+    sched->wheel[level][bucket] = NULL;
+    for (timer = timers; timer != NULL; timer = timer->wheel_next) {
+        sched->level_count[level]--;
+    }
+
+    return timers;
+}
+
+/*
+ * Move down the buckets the clock just reached: those of every level
+ * whose tick starts now, from the top down
+ */
+static void
+wheel_cascade(loci_pdu_sched_t *sched)
+{
+    loci_pdu_timer_t *timer, *next;
+    int level, top;
+    int bits;
+
+    for (top = 0; top < LOCI_PDU_WHEEL_LEVELS - 1; top++) {
+        bits = (top + 1) * LOCI_PDU_WHEEL_BITS;
+        if ((sched->now & ((1ULL << bits) - 1)) != 0) {
+            break;
+        }
+    }
+
+    for (level = top; level > 0; level--) {
+        timer = bucket_detach(sched, level,
+            (sched->now >> (level * LOCI_PDU_WHEEL_BITS)) & BUCKET_MASK);
+        for (; timer != NULL; timer = next) {
+            next = timer->wheel_next;
+            wheel_insert(sched, timer);
+        }
+    }
+}
+
+static void
+timeout_write(loci_pdu_sched_t *sched, loci_pdu_timer_t *timer,
+              loci_stream_t *timeouts)
+{
+    uint8_t *buf;
+    int bytes;
+
+    bytes = sched->version == OF_VERSION_1_0 ?
+        RX_TIMEOUT_BYTES_1_0 : RX_TIMEOUT_BYTES;
+    if ((buf = loci_stream_reserve(timeouts, bytes)) == NULL) {
+        return;
+    }
+
+    buf_u8_set(buf + OF_MESSAGE_VERSION_OFFSET, sched->version);
+    buf_u8_set(buf + OF_MESSAGE_TYPE_OFFSET, EXPERIMENTER_TYPE);
+    buf_u16_set(buf + OF_MESSAGE_LENGTH_OFFSET, bytes);
+    buf_u32_set(buf + OF_MESSAGE_XID_OFFSET, sched->xid++);
+    buf_u32_set(buf + EXPERIMENTER_OFFSET, OF_EXPERIMENTER_ID_BSN);
+    buf_u32_set(buf + SUBTYPE_OFFSET, SUBTYPE_RX_TIMEOUT);
+    if (sched->version == OF_VERSION_1_0) {
+        buf_u16_set(buf + PORT_NO_OFFSET, (uint16_t)timer->port_no);
+        buf_u8_set(buf + SLOT_NUM_OFFSET_1_0, timer->slot_num);
+    } else {
+        buf_u32_set(buf + PORT_NO_OFFSET, timer->port_no);
+        buf_u8_set(buf + SLOT_NUM_OFFSET, timer->slot_num);
+    }
+    loci_stream_advance(timeouts, bytes);
+}
+
+/****************************************************************
+ * Scheduler
+ ****************************************************************/
+
+/**
+ * Initialize a scheduler with no slots
+ * @param sched The scheduler
+ * @param version Version of the rx_timeout messages
+ * @param now The time, in milliseconds
+ * @returns 0, OF_ERROR_VERSION or OF_ERROR_RESOURCE
+ */
+int
+loci_pdu_sched_init(loci_pdu_sched_t *sched, of_version_t version,
+                    uint64_t now)
+{
+    MEMSET(sched, 0, sizeof(*sched));
+    if (!OF_VERSION_OKAY(version)) {
+        return OF_ERROR_VERSION;
+    }
+
+    sched->version = version;
+    sched->now = now;
+    sched->n_slots = LOCI_PDU_SCHED_SLOTS;
+    if ((sched->slots = MALLOC(sched->n_slots * sizeof(*sched->slots))) ==
+        NULL) {
+        loci_pdu_sched_cleanup(sched);
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(sched->slots, 0, sched->n_slots * sizeof(*sched->slots));
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Free the slots of a scheduler
+ */
+void
+loci_pdu_sched_cleanup(loci_pdu_sched_t *sched)
+{
+    loci_pdu_timer_t *timer, *next;
+    uint32_t i;
+
+    for (i = 0; sched->slots != NULL && i < sched->n_slots; i++) {
+        for (timer = sched->slots[i]; timer != NULL; timer = next) {
+            next = timer->next;
+            FREE(timer);
+        }
+    }
+    FREE(sched->slots);
+    MEMSET(sched, 0, sizeof(*sched));
+}
+
+/**
+ * Start a slot, or restart it with a new interval and PDU
+ * @param sched The scheduler
+ * @param kind LOCI_PDU_TX or LOCI_PDU_RX
+ * @param port_no The port
+ * @param slot_num The slot of the port
+ * @param interval_ms tx_interval_ms or timeout_ms, not 0
+ * @param data The PDU to send, or the one expected; copied
+ * @param len Length of data
+ * @returns 0, OF_ERROR_PARAM or OF_ERROR_RESOURCE
+ *
+ * A tx slot first sends on the next tick, an rx slot times out after
+ * interval_ms.  On error the scheduler is unchanged.
+ */
+int
+loci_pdu_sched_add(loci_pdu_sched_t *sched, int kind, of_port_no_t port_no,
+                   uint8_t slot_num, uint32_t interval_ms,
+                   const uint8_t *data, int len)
+{
+    loci_pdu_timer_t **prev, *timer, *old;
+
+    if ((kind != LOCI_PDU_TX && kind != LOCI_PDU_RX) || interval_ms == 0 ||
+        len < 0 || len > 0xffff) {
+        return OF_ERROR_PARAM;
+    }
+
+    prev = slot_find(sched, kind, port_no, slot_num);
+    old = *prev;
+
+    /* A restarted slot keeps its memory if the PDU fits */
+    if (old != NULL && old->data_len == len) {
+        timer = old;
+        wheel_unlink(sched, timer);
+    } else {
+        if ((timer = MALLOC(sizeof(*timer) + len)) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        timer->port_no = port_no;
+        timer->slot_num = slot_num;
+        timer->kind = kind;
+        timer->data_len = len;
+        if (old != NULL) {
+            timer->next = old->next;
+            wheel_unlink(sched, old);
+            FREE(old);
+        } else {
+            timer->next = NULL;
+            sched->count++;
+        }
+        *prev = timer;
+    }
+
+    if (len > 0) {
+        MEMCPY(timer->data, data, len);
+    }
+    timer->interval_ms = interval_ms;
+    timer->expires = sched->now + (kind == LOCI_PDU_TX ? 1 : interval_ms);
+    wheel_insert(sched, timer);
+
+    if (old == NULL && sched->count > sched->n_slots) {
+        slots_grow(sched);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Stop a slot
+ * @param sched The scheduler
+ * @param kind LOCI_PDU_TX or LOCI_PDU_RX
+ * @param port_no The port
+ * @param slot_num The slot of the port
+ * @returns 0 or OF_ERROR_RANGE if there is no such slot
+ */
+int
+loci_pdu_sched_delete(loci_pdu_sched_t *sched, int kind, of_port_no_t port_no,
+                      uint8_t slot_num)
+{
+    loci_pdu_timer_t **prev, *timer;
+
+    prev = slot_find(sched, kind, port_no, slot_num);
+    if ((timer = *prev) == NULL) {
+        return OF_ERROR_RANGE;
+    }
+    *prev = timer->next;
+    wheel_unlink(sched, timer);
+    FREE(timer);
+    sched->count--;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Find a slot
+ * @param sched The scheduler
+ * @param kind LOCI_PDU_TX or LOCI_PDU_RX
+ * @param port_no The port
+ * @param slot_num The slot of the port
+ * @returns The slot's timer or NULL
+ */
+loci_pdu_timer_t *
+loci_pdu_sched_lookup(loci_pdu_sched_t *sched, int kind, of_port_no_t port_no,
+                      uint8_t slot_num)
+{
+    return *slot_find(sched, kind, port_no, slot_num);
+}
+
+/**
+ * Apply a PDU request to a scheduler
+ * @param sched The scheduler
+ * @param msg An of_bsn_pdu_tx_request or of_bsn_pdu_rx_request
+ * @returns 0, an error from loci_pdu_sched_add or OF_ERROR_COMPAT for
+ * other messages
+ *
+ * A request with an interval or timeout of 0 stops the slot, if it was
+ * started.
+ */
+int
+loci_pdu_sched_apply(loci_pdu_sched_t *sched, of_object_t *msg)
+{
+    of_octets_t data;
+    of_port_no_t port_no;
+    uint32_t interval_ms;
+    uint8_t slot_num;
+    int kind;
+
+    switch (msg->object_id) {
+    case OF_BSN_PDU_TX_REQUEST:
+        kind = LOCI_PDU_TX;
+        of_bsn_pdu_tx_request_tx_interval_ms_get(msg, &interval_ms);
+        of_bsn_pdu_tx_request_port_no_get(msg, &port_no);
+        of_bsn_pdu_tx_request_slot_num_get(msg, &slot_num);
+        of_bsn_pdu_tx_request_data_get(msg, &data);
+        break;
+    case OF_BSN_PDU_RX_REQUEST:
+        kind = LOCI_PDU_RX;
+        of_bsn_pdu_rx_request_timeout_ms_get(msg, &interval_ms);
+        of_bsn_pdu_rx_request_port_no_get(msg, &port_no);
+        of_bsn_pdu_rx_request_slot_num_get(msg, &slot_num);
+        of_bsn_pdu_rx_request_data_get(msg, &data);
+        break;
+    default:
+        return OF_ERROR_COMPAT;
+    }
+
+    if (interval_ms == 0) {
+        loci_pdu_sched_delete(sched, kind, port_no, slot_num);
+        return OF_ERROR_NONE;
+    }
+
+    return loci_pdu_sched_add(sched, kind, port_no, slot_num, interval_ms,
+                              data.data, data.bytes);
+}
+
+/**
+ * Restart the timeout of an rx slot on a PDU received
+ * @param sched The scheduler
+ * @param port_no The port it came in on
+ * @param slot_num The slot it is for
+ * @returns 0 or OF_ERROR_RANGE if there is no such slot
+ */
+int
+loci_pdu_sched_rx(loci_pdu_sched_t *sched, of_port_no_t port_no,
+                  uint8_t slot_num)
+{
+    loci_pdu_timer_t *timer;
+
+    if ((timer = *slot_find(sched, LOCI_PDU_RX, port_no, slot_num)) == NULL) {
+        return OF_ERROR_RANGE;
+    }
+    wheel_unlink(sched, timer);
+    timer->expires = sched->now + timer->interval_ms;
+    wheel_insert(sched, timer);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Advance the clock, firing the slots due
+ * @param sched The scheduler
+ * @param now The time, in milliseconds; earlier times are ignored
+ * @param tx Sends the PDU of a tx slot
+ * @param cookie Passed to tx
+ * @param timeouts Where the rx_timeout messages are written
+ * @returns The number of slots fired, or the error of the stream
+ *
+ * Slots fire in order of tick, in no order within a tick, and a slot
+ * due more than once in the time advanced over fires every time.
+ * The slots fire and restart even if the stream fails.
+ */
+int
+loci_pdu_sched_advance(loci_pdu_sched_t *sched, uint64_t now,
+                       loci_pdu_sched_tx_f tx, void *cookie,
+                       loci_stream_t *timeouts)
+{
+    loci_pdu_timer_t *timer, *next;
+    uint64_t skip;
+    int fired = 0;
+    int level;
+
+    while (sched->now < now) {
+        /*
+         * Nothing fires before a level above the empty ones moves
+         * down, at the next multiple of its tick
+         */
+        skip = 0;
+        for (level = 0; level < LOCI_PDU_WHEEL_LEVELS &&
+                 sched->level_count[level] == 0; level++) {
+            skip = (skip << LOCI_PDU_WHEEL_BITS) | BUCKET_MASK;
+        }
+        if (level == LOCI_PDU_WHEEL_LEVELS || (sched->now | skip) >= now) {
+            sched->now = now;
+            break;
+        }
+        sched->now |= skip;
+
+        sched->now++;
+        wheel_cascade(sched);
+        timer = bucket_detach(sched, 0, sched->now & BUCKET_MASK);
+        for (; timer != NULL; timer = next) {
+            next = timer->wheel_next;
+            if (timer->kind == LOCI_PDU_TX) {
+                if (tx(cookie, timer->port_no, timer->slot_num, timer->data,
+                       timer->data_len) < 0) {
+                    sched->tx_errors++;
+                }
+            } else {
+                timeout_write(sched, timer, timeouts);
+            }
+            timer->expires += timer->interval_ms;
+            wheel_insert(sched, timer);
+            fired++;
+        }
+    }
+
+    return timeouts->error < 0 ? timeouts->error : fired;
+}
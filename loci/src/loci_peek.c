@@ -0,0 +1,172 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_peek.c
+ *
+ * Field extraction from wire buffers, without objects.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_peek.h>
+
+/* OpenFlow message type of packet_in, in all versions */
+#define PACKET_IN_TYPE 10
+
+/* OXM type_len of in_port */
+#define OXM_IN_PORT 0x80000004
+
+/**
+ * Find in_port in an OXM list
+ * @param oxms Start of the OXMs
+ * @param len Length of the OXMs
+ * @param in_port Set to the port if it is found
+ *
+ * The OXMs before in_port must fit in the list.
+ */
+static int
+oxm_in_port_find(uint8_t *oxms, int len, of_port_no_t *in_port)
+{
+    uint32_t type_len;
+    int offset = 0, oxm_len;
+
+    while (offset + 4 <= len) {
+        buf_u32_get(oxms + offset, &type_len);
+        oxm_len = 4 + (type_len & 0xff);
+        if (offset + oxm_len > len) {
+            return OF_ERROR_PARSE;
+        }
+        if (type_len == OXM_IN_PORT) {
+            buf_u32_get(oxms + offset + 4, in_port);
+            return OF_ERROR_NONE;
+        }
+        offset += oxm_len;
+    }
+
+    return offset == len ? OF_ERROR_NONE : OF_ERROR_PARSE;
+}
+
+/* OpenFlow 1.0 */
+static int
+packet_in_peek_v1(uint8_t *buf, int len, loci_packet_in_t *pi)
+{
+    uint16_t in_port;
+
+    if (len < 18) {
+        return OF_ERROR_PARSE;
+    }
+    buf_u32_get(buf + 8, &pi->buffer_id);
+    buf_u16_get(buf + 12, &pi->total_len);
+    buf_u16_get(buf + 14, &in_port);
+    pi->in_port = in_port;
+    buf_u8_get(buf + 16, &pi->reason);
+    pi->data = buf + 18;
+    pi->data_len = len - 18;
+
+    return OF_ERROR_NONE;
+}
+
+/* OpenFlow 1.1 */
+static int
+packet_in_peek_v2(uint8_t *buf, int len, loci_packet_in_t *pi)
+{
+    if (len < 24) {
+        return OF_ERROR_PARSE;
+    }
+    buf_u32_get(buf + 8, &pi->buffer_id);
+    buf_u32_get(buf + 12, &pi->in_port);
+    buf_u16_get(buf + 20, &pi->total_len);
+    buf_u8_get(buf + 22, &pi->reason);
+    buf_u8_get(buf + 23, &pi->table_id);
+    pi->data = buf + 24;
+    pi->data_len = len - 24;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * OpenFlow 1.2 and later: the match is at match_offset and followed
+ * by 2 bytes of padding and the data
+ */
+static int
+packet_in_peek_oxm(uint8_t *buf, int len, int match_offset,
+                   loci_packet_in_t *pi)
+{
+    uint16_t match_type, match_len;
+    int data_offset;
+
+    if (len < match_offset + 4) {
+        return OF_ERROR_PARSE;
+    }
+    buf_u32_get(buf + 8, &pi->buffer_id);
+    buf_u16_get(buf + 12, &pi->total_len);
+    buf_u8_get(buf + 14, &pi->reason);
+    buf_u8_get(buf + 15, &pi->table_id);
+
+    buf_u16_get(buf + match_offset, &match_type);
+    buf_u16_get(buf + match_offset + 2, &match_len);
+    if (match_type != OF_MATCH_TYPE_OXM || match_len < 4) {
+        return OF_ERROR_PARSE;
+    }
+    data_offset = match_offset + OF_MATCH_BYTES(match_len) + 2;
+    if (data_offset > len) {
+        return OF_ERROR_PARSE;
+    }
+    pi->data = buf + data_offset;
+    pi->data_len = len - data_offset;
+
+    return oxm_in_port_find(buf + match_offset + 4, match_len - 4,
+                            &pi->in_port);
+}
+
+/**
+ * Peek at a packet_in
+ * @param buf The message
+ * @param len Length of buf
+ * @param pi Filled in with the fields of the message
+ * @returns 0, OF_ERROR_PARSE if buf isn't a well formed packet_in or
+ * OF_ERROR_VERSION
+ *
+ * The message length is taken from the header and must be at most len.
+ * pi->data points into buf.
+ */
+int
+loci_packet_in_peek(uint8_t *buf, int len, loci_packet_in_t *pi)
+{
+    int msg_len, rv;
+
+    MEMSET(pi, 0, sizeof(*pi));
+
+    if (len < OF_MESSAGE_HEADER_LENGTH ||
+        of_message_type_get(buf) != PACKET_IN_TYPE) {
+        return OF_ERROR_PARSE;
+    }
+    msg_len = of_message_length_get(buf);
+    if (msg_len > len) {
+        return OF_ERROR_PARSE;
+    }
+    pi->version = of_message_version_get(buf);
+    pi->xid = of_message_xid_get(buf);
+
+    switch (pi->version) {
+    case OF_VERSION_1_0:
+        return packet_in_peek_v1(buf, msg_len, pi);
+    case OF_VERSION_1_1:
+        return packet_in_peek_v2(buf, msg_len, pi);
+    case OF_VERSION_1_2:
+        return packet_in_peek_oxm(buf, msg_len, 16, pi);
+    case OF_VERSION_1_3:
+    case OF_VERSION_1_4:
+        if ((rv = packet_in_peek_oxm(buf, msg_len, 24, pi)) < 0) {
+            return rv;
+        }
+        buf_u64_get(buf + 16, &pi->cookie);
+        return OF_ERROR_NONE;
+    default:
+        return OF_ERROR_VERSION;
+    }
+}
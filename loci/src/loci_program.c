@@ -0,0 +1,1194 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_program.c
+ *
+ * Compilation of instruction and action lists into programs, and
+ * their interpreter.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_program.h>
+
+#define ETH_HEADER_LENGTH 14
+#define VLAN_HEADER_LENGTH 4
+#define MPLS_HEADER_LENGTH 4
+#define IPV4_HEADER_LENGTH 20
+#define IPV6_HEADER_LENGTH 40
+#define IPV6_EXT_HEADER_LENGTH 8
+
+#define ETH_TYPE_IPV4 0x0800
+#define ETH_TYPE_VLAN 0x8100
+#define ETH_TYPE_IPV6 0x86dd
+#define ETH_TYPE_MPLS 0x8847
+#define ETH_TYPE_MPLS_MCAST 0x8848
+#define ETH_TYPE_QINQ 0x88a8
+
+#define IP_PROTO_HOPOPTS 0
+#define IP_PROTO_TCP 6
+#define IP_PROTO_UDP 17
+#define IP_PROTO_ROUTING 43
+#define IP_PROTO_FRAGMENT 44
+#define IP_PROTO_ICMPV6 58
+#define IP_PROTO_DSTOPTS 60
+#define IP_PROTO_SCTP 132
+
+#define MPLS_BOS 0x100
+
+/* Table of resubmit meaning the table of the flow doing it */
+#define RESUBMIT_TABLE_IN 0xff
+
+#define OP_ALLOC_INIT 8
+
+/* Width in bits of each loci_field_t */
+static const uint8_t field_bits[LOCI_FIELD_COUNT] = {
+    48, 48, 12, 3, 6, 2, 8, 32, 32, 16, 16, 20, 3, 8, 128, 128
+};
+
+/****************************************************************
+ * Compilation
+ ****************************************************************/
+
+static uint64_t
+field_mask(int field)
+{
+    return field_bits[field] >= 64 ? ~0ULL : (1ULL << field_bits[field]) - 1;
+}
+
+static loci_op_t *
+op_append(loci_program_t *prog, uint8_t code)
+{
+    loci_op_t *ops, *op;
+    int alloc_ops;
+
+    if (prog->n_ops == prog->alloc_ops) {
+        alloc_ops = prog->alloc_ops ? prog->alloc_ops * 2 : OP_ALLOC_INIT;
+        ops = MALLOC(alloc_ops * sizeof(*ops));
+        if (ops == NULL) {
+            return NULL;
+        }
+        if (prog->n_ops > 0) {
+            MEMCPY(ops, prog->ops, prog->n_ops * sizeof(*ops));
+        }
+        FREE(prog->ops);
+        prog->ops = ops;
+        prog->alloc_ops = alloc_ops;
+    }
+
+    op = &prog->ops[prog->n_ops++];
+    MEMSET(op, 0, sizeof(*op));
+    op->code = code;
+
+    return op;
+}
+
+static int
+op_append_set_field(loci_program_t *prog, int field, uint64_t value,
+                    uint16_t vlan_push)
+{
+    loci_op_t *op;
+
+    if ((op = op_append(prog, LOCI_OP_SET_FIELD)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    op->field = field;
+    op->mask = field_mask(field);
+    op->value = value & op->mask;
+    op->arg16 = vlan_push;
+
+    return OF_ERROR_NONE;
+}
+
+static int
+op_append_arg(loci_program_t *prog, uint8_t code, uint32_t arg32,
+              uint16_t arg16)
+{
+    loci_op_t *op;
+
+    if ((op = op_append(prog, code)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    op->arg32 = arg32;
+    op->arg16 = arg16;
+
+    return OF_ERROR_NONE;
+}
+
+static uint64_t
+mac_value(of_mac_addr_t *mac)
+{
+    uint64_t value = 0;
+    int i;
+
+    for (i = 0; i < OF_MAC_ADDR_BYTES; i++) {
+        value = (value << 8) | mac->addr[i];
+    }
+
+    return value;
+}
+
+/**
+ * The field of an NXM or OXM header, for Nicira move
+ *
+ * @returns A loci_field_t or -1 for a field that can't be moved
+ */
+static int
+nxm_field(uint32_t header)
+{
+    switch (header >> 9) {
+    case (0x0000 << 7) | 1: return LOCI_FIELD_ETH_DST;
+    case (0x0000 << 7) | 2: return LOCI_FIELD_ETH_SRC;
+    case (0x0000 << 7) | 7: return LOCI_FIELD_IPV4_SRC;
+    case (0x0000 << 7) | 8: return LOCI_FIELD_IPV4_DST;
+    case (0x0000 << 7) | 9: return LOCI_FIELD_L4_SRC;
+    case (0x0000 << 7) | 10: return LOCI_FIELD_L4_DST;
+    case (0x0000 << 7) | 11: return LOCI_FIELD_L4_SRC;
+    case (0x0000 << 7) | 12: return LOCI_FIELD_L4_DST;
+    case (0x0001 << 7) | 28: return LOCI_FIELD_IP_ECN;
+    case (0x0001 << 7) | 29: return LOCI_FIELD_IP_TTL;
+    case (0x8000 << 7) | 3: return LOCI_FIELD_ETH_DST;
+    case (0x8000 << 7) | 4: return LOCI_FIELD_ETH_SRC;
+    case (0x8000 << 7) | 6: return LOCI_FIELD_VLAN_VID;
+    case (0x8000 << 7) | 7: return LOCI_FIELD_VLAN_PCP;
+    case (0x8000 << 7) | 8: return LOCI_FIELD_IP_DSCP;
+    case (0x8000 << 7) | 9: return LOCI_FIELD_IP_ECN;
+    case (0x8000 << 7) | 11: return LOCI_FIELD_IPV4_SRC;
+    case (0x8000 << 7) | 12: return LOCI_FIELD_IPV4_DST;
+    case (0x8000 << 7) | 13: return LOCI_FIELD_L4_SRC;
+    case (0x8000 << 7) | 14: return LOCI_FIELD_L4_DST;
+    case (0x8000 << 7) | 15: return LOCI_FIELD_L4_SRC;
+    case (0x8000 << 7) | 16: return LOCI_FIELD_L4_DST;
+    case (0x8000 << 7) | 17: return LOCI_FIELD_L4_SRC;
+    case (0x8000 << 7) | 18: return LOCI_FIELD_L4_DST;
+    case (0x8000 << 7) | 34: return LOCI_FIELD_MPLS_LABEL;
+    case (0x8000 << 7) | 35: return LOCI_FIELD_MPLS_TC;
+    default: return -1;
+    }
+}
+
+static int
+compile_move(loci_program_t *prog, of_action_nicira_move_t *action)
+{
+    loci_op_t *op;
+    uint32_t src, dst;
+    uint16_t n_bits, src_ofs, dst_ofs;
+    int src_field, dst_field;
+
+    of_action_nicira_move_src_get(action, &src);
+    of_action_nicira_move_dst_get(action, &dst);
+    of_action_nicira_move_n_bits_get(action, &n_bits);
+    of_action_nicira_move_src_ofs_get(action, &src_ofs);
+    of_action_nicira_move_dst_ofs_get(action, &dst_ofs);
+
+    src_field = nxm_field(src);
+    dst_field = nxm_field(dst);
+    if (src_field < 0 || dst_field < 0 || n_bits == 0 ||
+        src_ofs + n_bits > field_bits[src_field] ||
+        dst_ofs + n_bits > field_bits[dst_field]) {
+        return OF_ERROR_COMPAT;
+    }
+
+    if ((op = op_append(prog, LOCI_OP_MOVE)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    op->src_field = src_field;
+    op->field = dst_field;
+    op->n_bits = n_bits;
+    op->src_ofs = src_ofs;
+    op->dst_ofs = dst_ofs;
+
+    return OF_ERROR_NONE;
+}
+
+static int
+compile_set_field(loci_program_t *prog, of_action_set_field_t *action)
+{
+    of_oxm_t oxm;
+    loci_op_t *op;
+    of_mac_addr_t mac;
+    uint64_t u64;
+    uint32_t u32;
+    uint16_t u16;
+    uint8_t u8;
+
+    of_action_set_field_field_bind(action, &oxm);
+
+    switch (oxm.object_id) {
+    case OF_OXM_ETH_DST:
+        of_oxm_eth_dst_value_get(&oxm, &mac);
+        return op_append_set_field(prog, LOCI_FIELD_ETH_DST, mac_value(&mac),
+                                   0);
+    case OF_OXM_ETH_SRC:
+        of_oxm_eth_src_value_get(&oxm, &mac);
+        return op_append_set_field(prog, LOCI_FIELD_ETH_SRC, mac_value(&mac),
+                                   0);
+    case OF_OXM_VLAN_VID:
+        of_oxm_vlan_vid_value_get(&oxm, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_VLAN_VID, u16, 0);
+    case OF_OXM_VLAN_PCP:
+        of_oxm_vlan_pcp_value_get(&oxm, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_VLAN_PCP, u8, 0);
+    case OF_OXM_IP_DSCP:
+        of_oxm_ip_dscp_value_get(&oxm, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_IP_DSCP, u8, 0);
+    case OF_OXM_IP_ECN:
+        of_oxm_ip_ecn_value_get(&oxm, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_IP_ECN, u8, 0);
+    case OF_OXM_IPV4_SRC:
+        of_oxm_ipv4_src_value_get(&oxm, &u32);
+        return op_append_set_field(prog, LOCI_FIELD_IPV4_SRC, u32, 0);
+    case OF_OXM_IPV4_DST:
+        of_oxm_ipv4_dst_value_get(&oxm, &u32);
+        return op_append_set_field(prog, LOCI_FIELD_IPV4_DST, u32, 0);
+    case OF_OXM_TCP_SRC:
+        of_oxm_tcp_src_value_get(&oxm, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_SRC, u16, 0);
+    case OF_OXM_TCP_DST:
+        of_oxm_tcp_dst_value_get(&oxm, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_DST, u16, 0);
+    case OF_OXM_UDP_SRC:
+        of_oxm_udp_src_value_get(&oxm, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_SRC, u16, 0);
+    case OF_OXM_UDP_DST:
+        of_oxm_udp_dst_value_get(&oxm, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_DST, u16, 0);
+    case OF_OXM_SCTP_SRC:
+        of_oxm_sctp_src_value_get(&oxm, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_SRC, u16, 0);
+    case OF_OXM_SCTP_DST:
+        of_oxm_sctp_dst_value_get(&oxm, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_DST, u16, 0);
+    case OF_OXM_MPLS_LABEL:
+        of_oxm_mpls_label_value_get(&oxm, &u32);
+        return op_append_set_field(prog, LOCI_FIELD_MPLS_LABEL, u32, 0);
+    case OF_OXM_MPLS_TC:
+        of_oxm_mpls_tc_value_get(&oxm, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_MPLS_TC, u8, 0);
+    case OF_OXM_IPV6_SRC:
+    case OF_OXM_IPV6_DST:
+        if ((op = op_append(prog, LOCI_OP_SET_FIELD)) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        if (oxm.object_id == OF_OXM_IPV6_SRC) {
+            op->field = LOCI_FIELD_IPV6_SRC;
+            of_oxm_ipv6_src_value_get(&oxm, &op->ipv6);
+        } else {
+            op->field = LOCI_FIELD_IPV6_DST;
+            of_oxm_ipv6_dst_value_get(&oxm, &op->ipv6);
+        }
+        return OF_ERROR_NONE;
+    case OF_OXM_TUNNEL_ID:
+        of_oxm_tunnel_id_value_get(&oxm, &u64);
+        if ((op = op_append(prog, LOCI_OP_SET_TUNNEL_ID)) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        op->value = u64;
+        return OF_ERROR_NONE;
+    default:
+        return OF_ERROR_COMPAT;
+    }
+}
+
+static int
+compile_action(loci_program_t *prog, of_object_t *action)
+{
+    of_mac_addr_t mac;
+    of_port_no_t port;
+    uint32_t u32;
+    uint16_t u16;
+    uint8_t u8;
+    int rv;
+
+    switch (action->object_id) {
+    case OF_ACTION_OUTPUT:
+        of_action_output_port_get(action, &port);
+        of_action_output_max_len_get(action, &u16);
+        return op_append_arg(prog, LOCI_OP_OUTPUT, port, u16);
+    case OF_ACTION_ENQUEUE:
+        of_action_enqueue_queue_id_get(action, &u32);
+        if ((rv = op_append_arg(prog, LOCI_OP_SET_QUEUE, u32, 0)) < 0) {
+            return rv;
+        }
+        of_action_enqueue_port_get(action, &port);
+        return op_append_arg(prog, LOCI_OP_OUTPUT, port, 0xffff);
+    case OF_ACTION_SET_QUEUE:
+        of_action_set_queue_queue_id_get(action, &u32);
+        return op_append_arg(prog, LOCI_OP_SET_QUEUE, u32, 0);
+    case OF_ACTION_GROUP:
+        of_action_group_group_id_get(action, &u32);
+        return op_append_arg(prog, LOCI_OP_GROUP, u32, 0);
+    case OF_ACTION_PUSH_VLAN:
+        of_action_push_vlan_ethertype_get(action, &u16);
+        return op_append_arg(prog, LOCI_OP_PUSH_VLAN, 0, u16);
+    case OF_ACTION_POP_VLAN:
+    case OF_ACTION_STRIP_VLAN:
+        return op_append_arg(prog, LOCI_OP_POP_VLAN, 0, 0);
+    case OF_ACTION_PUSH_MPLS:
+        of_action_push_mpls_ethertype_get(action, &u16);
+        return op_append_arg(prog, LOCI_OP_PUSH_MPLS, 0, u16);
+    case OF_ACTION_POP_MPLS:
+        of_action_pop_mpls_ethertype_get(action, &u16);
+        return op_append_arg(prog, LOCI_OP_POP_MPLS, 0, u16);
+    case OF_ACTION_DEC_NW_TTL:
+    case OF_ACTION_NICIRA_DEC_TTL:
+        return op_append_arg(prog, LOCI_OP_DEC_NW_TTL, 0, 0);
+    case OF_ACTION_DEC_MPLS_TTL:
+        return op_append_arg(prog, LOCI_OP_DEC_MPLS_TTL, 0, 0);
+    case OF_ACTION_SET_FIELD:
+        return compile_set_field(prog, action);
+
+    /* OpenFlow 1.0 and 1.1 set actions; 1.0 pushes a tag if there is none */
+    case OF_ACTION_SET_VLAN_VID:
+        of_action_set_vlan_vid_vlan_vid_get(action, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_VLAN_VID, u16,
+            action->version == OF_VERSION_1_0 ? ETH_TYPE_VLAN : 0);
+    case OF_ACTION_SET_VLAN_PCP:
+        of_action_set_vlan_pcp_vlan_pcp_get(action, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_VLAN_PCP, u8,
+            action->version == OF_VERSION_1_0 ? ETH_TYPE_VLAN : 0);
+    case OF_ACTION_SET_DL_SRC:
+        of_action_set_dl_src_dl_addr_get(action, &mac);
+        return op_append_set_field(prog, LOCI_FIELD_ETH_SRC, mac_value(&mac),
+                                   0);
+    case OF_ACTION_SET_DL_DST:
+        of_action_set_dl_dst_dl_addr_get(action, &mac);
+        return op_append_set_field(prog, LOCI_FIELD_ETH_DST, mac_value(&mac),
+                                   0);
+    case OF_ACTION_SET_NW_SRC:
+        of_action_set_nw_src_nw_addr_get(action, &u32);
+        return op_append_set_field(prog, LOCI_FIELD_IPV4_SRC, u32, 0);
+    case OF_ACTION_SET_NW_DST:
+        of_action_set_nw_dst_nw_addr_get(action, &u32);
+        return op_append_set_field(prog, LOCI_FIELD_IPV4_DST, u32, 0);
+    case OF_ACTION_SET_NW_TOS:
+        of_action_set_nw_tos_nw_tos_get(action, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_IP_DSCP, u8 >> 2, 0);
+    case OF_ACTION_SET_NW_ECN:
+        of_action_set_nw_ecn_nw_ecn_get(action, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_IP_ECN, u8, 0);
+    case OF_ACTION_SET_NW_TTL:
+        of_action_set_nw_ttl_nw_ttl_get(action, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_IP_TTL, u8, 0);
+    case OF_ACTION_SET_TP_SRC:
+        of_action_set_tp_src_tp_port_get(action, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_SRC, u16, 0);
+    case OF_ACTION_SET_TP_DST:
+        of_action_set_tp_dst_tp_port_get(action, &u16);
+        return op_append_set_field(prog, LOCI_FIELD_L4_DST, u16, 0);
+    case OF_ACTION_SET_MPLS_LABEL:
+        of_action_set_mpls_label_mpls_label_get(action, &u32);
+        return op_append_set_field(prog, LOCI_FIELD_MPLS_LABEL, u32, 0);
+    case OF_ACTION_SET_MPLS_TC:
+        of_action_set_mpls_tc_mpls_tc_get(action, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_MPLS_TC, u8, 0);
+    case OF_ACTION_SET_MPLS_TTL:
+        of_action_set_mpls_ttl_mpls_ttl_get(action, &u8);
+        return op_append_set_field(prog, LOCI_FIELD_MPLS_TTL, u8, 0);
+
+    /* Experimenter actions */
+    case OF_ACTION_NICIRA_RESUBMIT:
+        of_action_nicira_resubmit_in_port_get(action, &u16);
+        return op_append_arg(prog, LOCI_OP_RESUBMIT, u16, RESUBMIT_TABLE_IN);
+    case OF_ACTION_NICIRA_RESUBMIT_TABLE:
+        of_action_nicira_resubmit_table_in_port_get(action, &u16);
+        of_action_nicira_resubmit_table_table_get(action, &u8);
+        return op_append_arg(prog, LOCI_OP_RESUBMIT, u16, u8);
+    case OF_ACTION_NICIRA_MOVE:
+        return compile_move(prog, action);
+    case OF_ACTION_BSN_MIRROR:
+        of_action_bsn_mirror_dest_port_get(action, &u32);
+        return op_append_arg(prog, LOCI_OP_OUTPUT, u32, 0xffff);
+    case OF_ACTION_BSN_SET_TUNNEL_DST:
+        of_action_bsn_set_tunnel_dst_dst_get(action, &u32);
+        return op_append_arg(prog, LOCI_OP_SET_TUNNEL_DST, u32, 0);
+
+    default:
+        return OF_ERROR_COMPAT;
+    }
+}
+
+static int
+compile_action_list(loci_program_t *prog, of_list_action_t *actions)
+{
+    of_object_t action;
+    int rv;
+
+    OF_LIST_ACTION_ITER(actions, &action, rv) {
+        if ((rv = compile_action(prog, &action)) < 0) {
+            return rv;
+        }
+    }
+
+    return rv == OF_ERROR_RANGE ? OF_ERROR_NONE : rv;
+}
+
+/* The BSN instructions that only set a flag, and those with an argument */
+static const struct {
+    of_object_id_t object_id;
+    uint32_t flag;
+} bsn_instructions[] = {
+    { OF_INSTRUCTION_BSN_ARP_OFFLOAD, LOCI_PROGRAM_BSN_ARP_OFFLOAD },
+    { OF_INSTRUCTION_BSN_AUTO_NEGOTIATION, LOCI_PROGRAM_BSN_AUTO_NEGOTIATION },
+    { OF_INSTRUCTION_BSN_DENY, LOCI_PROGRAM_BSN_DENY },
+    { OF_INSTRUCTION_BSN_DHCP_OFFLOAD, LOCI_PROGRAM_BSN_DHCP_OFFLOAD },
+    { OF_INSTRUCTION_BSN_DISABLE_L3, LOCI_PROGRAM_BSN_DISABLE_L3 },
+    { OF_INSTRUCTION_BSN_DISABLE_SPLIT_HORIZON_CHECK,
+      LOCI_PROGRAM_BSN_DISABLE_SPLIT_HORIZON_CHECK },
+    { OF_INSTRUCTION_BSN_DISABLE_SRC_MAC_CHECK,
+      LOCI_PROGRAM_BSN_DISABLE_SRC_MAC_CHECK },
+    { OF_INSTRUCTION_BSN_DISABLE_VLAN_COUNTERS,
+      LOCI_PROGRAM_BSN_DISABLE_VLAN_COUNTERS },
+    { OF_INSTRUCTION_BSN_HASH_SELECT, LOCI_PROGRAM_BSN_HASH_SELECT },
+    { OF_INSTRUCTION_BSN_INTERNAL_PRIORITY,
+      LOCI_PROGRAM_BSN_INTERNAL_PRIORITY },
+    { OF_INSTRUCTION_BSN_NDP_OFFLOAD, LOCI_PROGRAM_BSN_NDP_OFFLOAD },
+    { OF_INSTRUCTION_BSN_PACKET_OF_DEATH, LOCI_PROGRAM_BSN_PACKET_OF_DEATH },
+    { OF_INSTRUCTION_BSN_PERMIT, LOCI_PROGRAM_BSN_PERMIT },
+    { OF_INSTRUCTION_BSN_PRIORITIZE_PDUS, LOCI_PROGRAM_BSN_PRIORITIZE_PDUS },
+    { OF_INSTRUCTION_BSN_REQUIRE_VLAN_XLATE,
+      LOCI_PROGRAM_BSN_REQUIRE_VLAN_XLATE },
+    { OF_INSTRUCTION_BSN_SPAN_DESTINATION, LOCI_PROGRAM_BSN_SPAN_DESTINATION },
+};
+
+/**
+ * Record an instruction other than apply_actions and write_actions
+ */
+static int
+compile_instruction(loci_program_t *prog, of_object_t *instruction)
+{
+    int i;
+
+    switch (instruction->object_id) {
+    case OF_INSTRUCTION_GOTO_TABLE:
+        of_instruction_goto_table_table_id_get(instruction, &prog->table_id);
+        prog->flags |= LOCI_PROGRAM_GOTO_TABLE;
+        return OF_ERROR_NONE;
+    case OF_INSTRUCTION_WRITE_METADATA:
+        of_instruction_write_metadata_metadata_get(instruction,
+                                                   &prog->metadata);
+        of_instruction_write_metadata_metadata_mask_get(instruction,
+                                                        &prog->metadata_mask);
+        prog->flags |= LOCI_PROGRAM_WRITE_METADATA;
+        return OF_ERROR_NONE;
+    case OF_INSTRUCTION_METER:
+        of_instruction_meter_meter_id_get(instruction, &prog->meter_id);
+        prog->flags |= LOCI_PROGRAM_METER;
+        return OF_ERROR_NONE;
+    case OF_INSTRUCTION_CLEAR_ACTIONS:
+        prog->flags |= LOCI_PROGRAM_CLEAR_ACTIONS;
+        return OF_ERROR_NONE;
+    case OF_INSTRUCTION_BSN_HASH_SELECT:
+        of_instruction_bsn_hash_select_flags_get(instruction,
+            &prog->bsn_hash_select_flags);
+        break;
+    case OF_INSTRUCTION_BSN_INTERNAL_PRIORITY:
+        of_instruction_bsn_internal_priority_value_get(instruction,
+            &prog->bsn_internal_priority);
+        break;
+    default:
+        break;
+    }
+
+    for (i = 0; i < (int)(sizeof(bsn_instructions) /
+                          sizeof(bsn_instructions[0])); i++) {
+        if (bsn_instructions[i].object_id == instruction->object_id) {
+            prog->bsn_flags |= bsn_instructions[i].flag;
+            return OF_ERROR_NONE;
+        }
+    }
+
+    return OF_ERROR_COMPAT;
+}
+
+/**
+ * Compile an instruction list
+ * @param prog The program, uninitialized
+ * @param instructions The instructions of a flow
+ * @returns An error code
+ *
+ * The apply actions are compiled first, then the write actions, the
+ * order of their instructions in the list aside.  On error the program
+ * is left empty.
+ */
+int
+loci_program_compile(loci_program_t *prog, of_list_instruction_t *instructions)
+{
+    of_object_t instruction;
+    of_list_action_t actions;
+    int rv, pass;
+
+    MEMSET(prog, 0, sizeof(*prog));
+
+    for (pass = 0; pass < 2; pass++) {
+        OF_LIST_INSTRUCTION_ITER(instructions, &instruction, rv) {
+            switch (instruction.object_id) {
+            case OF_INSTRUCTION_APPLY_ACTIONS:
+                if (pass == 0) {
+                    of_instruction_apply_actions_actions_bind(&instruction,
+                                                              &actions);
+                    rv = compile_action_list(prog, &actions);
+                }
+                break;
+            case OF_INSTRUCTION_WRITE_ACTIONS:
+                if (pass == 1) {
+                    of_instruction_write_actions_actions_bind(&instruction,
+                                                              &actions);
+                    rv = compile_action_list(prog, &actions);
+                    prog->flags |= LOCI_PROGRAM_WRITE_ACTIONS;
+                }
+                break;
+            default:
+                if (pass == 0) {
+                    rv = compile_instruction(prog, &instruction);
+                }
+                break;
+            }
+            if (rv < 0) {
+                loci_program_cleanup(prog);
+                return rv;
+            }
+        }
+        if (rv != OF_ERROR_RANGE) {
+            loci_program_cleanup(prog);
+            return rv;
+        }
+        if (pass == 0) {
+            prog->n_apply = prog->n_ops;
+        }
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Compile an action list, as of an OpenFlow 1.0 flow or a packet out
+ * @param prog The program, uninitialized
+ * @param actions The actions
+ * @returns An error code
+ *
+ * All ops are apply actions.  On error the program is left empty.
+ */
+int
+loci_program_compile_actions(loci_program_t *prog, of_list_action_t *actions)
+{
+    int rv;
+
+    MEMSET(prog, 0, sizeof(*prog));
+
+    if ((rv = compile_action_list(prog, actions)) < 0) {
+        loci_program_cleanup(prog);
+        return rv;
+    }
+    prog->n_apply = prog->n_ops;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Free the ops of a program
+ * @param prog The program
+ */
+void
+loci_program_cleanup(loci_program_t *prog)
+{
+    FREE(prog->ops);
+    MEMSET(prog, 0, sizeof(*prog));
+}
+
+/****************************************************************
+ * Interpreter
+ ****************************************************************/
+
+/* Where the headers of a packet are; -1 for those it doesn't have */
+typedef struct layout_s {
+    int vlan;           /* TCI of the outer tag */
+    int eth_type;       /* Ethertype after the tags */
+    int l3;             /* Top MPLS label or IP header */
+    uint16_t l3_type;
+    int l4;             /* TCP, UDP, SCTP or ICMPv6 header */
+    uint8_t l4_proto;
+} layout_t;
+
+/* Checksums covering a field */
+#define CSUM_IP 0x1
+#define CSUM_L4 0x2
+
+typedef struct field_loc_s {
+    int offset;
+    int bytes;
+    int shift;
+    int csum;
+} field_loc_t;
+
+static inline uint16_t
+get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static inline void
+put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v;
+}
+
+static void
+layout_parse(const uint8_t *data, int len, layout_t *l)
+{
+    uint16_t type;
+    uint8_t proto;
+    int off, ext_len;
+
+    l->vlan = l->eth_type = l->l3 = l->l4 = -1;
+    l->l3_type = 0;
+    l->l4_proto = 0;
+
+    if (len < ETH_HEADER_LENGTH) {
+        return;
+    }
+
+    off = 12;
+    type = get16(data + off);
+    if (type == ETH_TYPE_VLAN || type == ETH_TYPE_QINQ) {
+        l->vlan = off + 2;
+    }
+    while (type == ETH_TYPE_VLAN || type == ETH_TYPE_QINQ) {
+        off += VLAN_HEADER_LENGTH;
+        if (off + 2 > len) {
+            return;
+        }
+        type = get16(data + off);
+    }
+    l->eth_type = off;
+    off += 2;
+
+    switch (type) {
+    case ETH_TYPE_MPLS:
+    case ETH_TYPE_MPLS_MCAST:
+        if (off + MPLS_HEADER_LENGTH <= len) {
+            l->l3 = off;
+            l->l3_type = type;
+        }
+        return;
+    case ETH_TYPE_IPV4:
+        if (off + IPV4_HEADER_LENGTH > len || (data[off] >> 4) != 4 ||
+            (data[off] & 0xf) * 4 < IPV4_HEADER_LENGTH ||
+            off + (data[off] & 0xf) * 4 > len) {
+            return;
+        }
+        l->l3 = off;
+        l->l3_type = type;
+        proto = data[off + 9];
+        if ((get16(data + off + 6) & 0x1fff) != 0) {
+            return;
+        }
+        off += (data[off] & 0xf) * 4;
+        break;
+    case ETH_TYPE_IPV6:
+        if (off + IPV6_HEADER_LENGTH > len) {
+            return;
+        }
+        l->l3 = off;
+        l->l3_type = type;
+        proto = data[off + 6];
+        off += IPV6_HEADER_LENGTH;
+        while (proto == IP_PROTO_HOPOPTS || proto == IP_PROTO_ROUTING ||
+               proto == IP_PROTO_DSTOPTS || proto == IP_PROTO_FRAGMENT) {
+            if (off + IPV6_EXT_HEADER_LENGTH > len) {
+                return;
+            }
+            if (proto == IP_PROTO_FRAGMENT) {
+                if ((get16(data + off + 2) & 0xfff8) != 0) {
+                    return;
+                }
+                ext_len = IPV6_EXT_HEADER_LENGTH;
+            } else {
+                ext_len = (data[off + 1] + 1) * 8;
+            }
+            proto = data[off];
+            off += ext_len;
+        }
+        break;
+    default:
+        return;
+    }
+
+    switch (proto) {
+    case IP_PROTO_TCP:
+        ext_len = 20;
+        break;
+    case IP_PROTO_UDP:
+        ext_len = 8;
+        break;
+    case IP_PROTO_SCTP:
+        ext_len = 12;
+        break;
+    case IP_PROTO_ICMPV6:
+        ext_len = 4;
+        break;
+    default:
+        return;
+    }
+    if (off + ext_len <= len) {
+        l->l4 = off;
+        l->l4_proto = proto;
+    }
+}
+
+/**
+ * Where a field is in a packet
+ *
+ * @returns 0, or -1 if the packet doesn't have the field's header
+ */
+static int
+field_locate(const layout_t *l, int field, field_loc_t *loc)
+{
+    int ipv4 = l->l3_type == ETH_TYPE_IPV4;
+    int ipv6 = l->l3_type == ETH_TYPE_IPV6;
+    int mpls = l->l3 >= 0 && !ipv4 && !ipv6;
+
+    loc->shift = 0;
+    loc->csum = 0;
+
+    switch (field) {
+    case LOCI_FIELD_ETH_DST:
+    case LOCI_FIELD_ETH_SRC:
+        if (l->eth_type < 0) {
+            return -1;
+        }
+        loc->offset = field == LOCI_FIELD_ETH_DST ? 0 : 6;
+        loc->bytes = 6;
+        return 0;
+    case LOCI_FIELD_VLAN_VID:
+    case LOCI_FIELD_VLAN_PCP:
+        if (l->vlan < 0) {
+            return -1;
+        }
+        loc->offset = l->vlan;
+        loc->bytes = 2;
+        loc->shift = field == LOCI_FIELD_VLAN_PCP ? 13 : 0;
+        return 0;
+    case LOCI_FIELD_IP_DSCP:
+    case LOCI_FIELD_IP_ECN:
+        if (ipv4) {
+            loc->offset = l->l3 + 1;
+            loc->bytes = 1;
+            loc->shift = field == LOCI_FIELD_IP_DSCP ? 2 : 0;
+            loc->csum = CSUM_IP;
+        } else if (ipv6) {
+            loc->offset = l->l3;
+            loc->bytes = 4;
+            loc->shift = field == LOCI_FIELD_IP_DSCP ? 22 : 20;
+        } else {
+            return -1;
+        }
+        return 0;
+    case LOCI_FIELD_IP_TTL:
+        if (ipv4) {
+            loc->offset = l->l3 + 8;
+            loc->csum = CSUM_IP;
+        } else if (ipv6) {
+            loc->offset = l->l3 + 7;
+        } else {
+            return -1;
+        }
+        loc->bytes = 1;
+        return 0;
+    case LOCI_FIELD_IPV4_SRC:
+    case LOCI_FIELD_IPV4_DST:
+        if (!ipv4) {
+            return -1;
+        }
+        loc->offset = l->l3 + (field == LOCI_FIELD_IPV4_SRC ? 12 : 16);
+        loc->bytes = 4;
+        loc->csum = CSUM_IP | CSUM_L4;
+        return 0;
+    case LOCI_FIELD_IPV6_SRC:
+    case LOCI_FIELD_IPV6_DST:
+        if (!ipv6) {
+            return -1;
+        }
+        loc->offset = l->l3 + (field == LOCI_FIELD_IPV6_SRC ? 8 : 24);
+        loc->bytes = 16;
+        loc->csum = CSUM_L4;
+        return 0;
+    case LOCI_FIELD_L4_SRC:
+    case LOCI_FIELD_L4_DST:
+        if (l->l4 < 0 || l->l4_proto == IP_PROTO_ICMPV6) {
+            return -1;
+        }
+        loc->offset = l->l4 + (field == LOCI_FIELD_L4_SRC ? 0 : 2);
+        loc->bytes = 2;
+        loc->csum = CSUM_L4;
+        return 0;
+    case LOCI_FIELD_MPLS_LABEL:
+    case LOCI_FIELD_MPLS_TC:
+    case LOCI_FIELD_MPLS_TTL:
+        if (!mpls) {
+            return -1;
+        }
+        loc->offset = l->l3;
+        loc->bytes = 4;
+        loc->shift = field == LOCI_FIELD_MPLS_LABEL ? 12 :
+            field == LOCI_FIELD_MPLS_TC ? 9 : 0;
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+static uint64_t
+field_load(const uint8_t *data, const field_loc_t *loc)
+{
+    uint64_t word = 0;
+    int i;
+
+    for (i = 0; i < loc->bytes; i++) {
+        word = (word << 8) | data[loc->offset + i];
+    }
+
+    return word;
+}
+
+static void
+field_store(uint8_t *data, const field_loc_t *loc, uint64_t word)
+{
+    int i;
+
+    for (i = loc->bytes - 1; i >= 0; i--) {
+        data[loc->offset + i] = word;
+        word >>= 8;
+    }
+}
+
+/* Ones' complement sum of the 16 bit words of p, len even */
+static uint32_t
+csum_sum(const uint8_t *p, int len)
+{
+    uint32_t sum = 0;
+    int i;
+
+    for (i = 0; i < len; i += 2) {
+        sum += get16(p + i);
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return sum;
+}
+
+/**
+ * Update a checksum for words whose sum went from old to new, as in
+ * RFC 1624: HC' = ~(~HC + ~m + m')
+ */
+static void
+csum_update(uint8_t *csum, uint32_t old, uint32_t new, int udp)
+{
+    uint32_t sum;
+
+    if (udp && get16(csum) == 0) {
+        return;
+    }
+    sum = (~get16(csum) & 0xffff) + (~old & 0xffff) + new;
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    sum = ~sum & 0xffff;
+    if (udp && sum == 0) {
+        sum = 0xffff;
+    }
+    put16(csum, sum);
+}
+
+/**
+ * Write bits of a field, and update the checksums covering it
+ *
+ * If src is given it's the new content of the field's bytes; otherwise
+ * the bits of mask are set from value.
+ */
+static void
+field_write(uint8_t *data, const layout_t *l, const field_loc_t *loc,
+            uint64_t value, uint64_t mask, const uint8_t *src)
+{
+    uint32_t old = 0, new;
+    uint64_t word;
+    int start = loc->offset, len = loc->bytes;
+
+    if (loc->csum) {
+        /* Sum the 16 bit words holding the field */
+        if ((start - l->l3) & 1) {
+            start--;
+            len++;
+        }
+        len += len & 1;
+        old = csum_sum(data + start, len);
+    }
+
+    if (src != NULL) {
+        MEMCPY(data + loc->offset, src, loc->bytes);
+    } else {
+        word = field_load(data, loc);
+        word &= ~(mask << loc->shift);
+        word |= (value & mask) << loc->shift;
+        field_store(data, loc, word);
+    }
+
+    if (!loc->csum) {
+        return;
+    }
+    new = csum_sum(data + start, len);
+    if (new == old) {
+        return;
+    }
+    if (loc->csum & CSUM_IP) {
+        csum_update(data + l->l3 + 10, old, new, 0);
+    }
+    if ((loc->csum & CSUM_L4) && l->l4 >= 0) {
+        switch (l->l4_proto) {
+        case IP_PROTO_TCP:
+            csum_update(data + l->l4 + 16, old, new, 0);
+            break;
+        case IP_PROTO_UDP:
+            csum_update(data + l->l4 + 6, old, new,
+                        l->l3_type == ETH_TYPE_IPV4);
+            break;
+        case IP_PROTO_ICMPV6:
+            csum_update(data + l->l4 + 2, old, new, 0);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* Make room for a header of len bytes at offset; -1 without headroom */
+static int
+header_insert(loci_program_packet_t *pkt, int offset, int len)
+{
+    if (pkt->headroom < len) {
+        return -1;
+    }
+    pkt->data -= len;
+    pkt->len += len;
+    pkt->headroom -= len;
+    MEMMOVE(pkt->data, pkt->data + len, offset);
+
+    return 0;
+}
+
+static void
+header_remove(loci_program_packet_t *pkt, int offset, int len)
+{
+    MEMMOVE(pkt->data + len, pkt->data, offset);
+    pkt->data += len;
+    pkt->len -= len;
+    pkt->headroom += len;
+}
+
+static int
+push_vlan(loci_program_packet_t *pkt, layout_t *l, uint16_t ethertype)
+{
+    uint16_t tci = l->vlan >= 0 ? get16(pkt->data + l->vlan) : 0;
+
+    if (l->eth_type < 0) {
+        return OF_ERROR_NONE;
+    }
+    if (header_insert(pkt, 12, VLAN_HEADER_LENGTH) < 0) {
+        return OF_ERROR_RESOURCE;
+    }
+    put16(pkt->data + 12, ethertype);
+    put16(pkt->data + 14, tci);
+    layout_parse(pkt->data, pkt->len, l);
+
+    return OF_ERROR_NONE;
+}
+
+static int
+push_mpls(loci_program_packet_t *pkt, layout_t *l, uint16_t ethertype)
+{
+    uint32_t lse;
+    int offset;
+
+    if (l->eth_type < 0) {
+        return OF_ERROR_NONE;
+    }
+
+    /* The new label copies the old one, or the TTL of IP */
+    if (l->l3_type == ETH_TYPE_MPLS || l->l3_type == ETH_TYPE_MPLS_MCAST) {
+        lse = ((uint32_t)get16(pkt->data + l->l3) << 16 |
+               get16(pkt->data + l->l3 + 2)) & ~MPLS_BOS;
+    } else if (l->l3_type == ETH_TYPE_IPV4) {
+        lse = MPLS_BOS | pkt->data[l->l3 + 8];
+    } else if (l->l3_type == ETH_TYPE_IPV6) {
+        lse = MPLS_BOS | pkt->data[l->l3 + 7];
+    } else {
+        lse = MPLS_BOS;
+    }
+
+    offset = l->eth_type + 2;
+    if (header_insert(pkt, offset, MPLS_HEADER_LENGTH) < 0) {
+        return OF_ERROR_RESOURCE;
+    }
+    put16(pkt->data + l->eth_type, ethertype);
+    put16(pkt->data + offset, lse >> 16);
+    put16(pkt->data + offset + 2, lse);
+    layout_parse(pkt->data, pkt->len, l);
+
+    return OF_ERROR_NONE;
+}
+
+static int
+dec_ttl(uint8_t *data, layout_t *l, int field)
+{
+    field_loc_t loc;
+    uint64_t ttl;
+
+    if (field_locate(l, field, &loc) < 0) {
+        return OF_ERROR_NONE;
+    }
+    ttl = (field_load(data, &loc) >> loc.shift) & 0xff;
+    if (ttl <= 1) {
+        return OF_ERROR_RANGE;
+    }
+    field_write(data, l, &loc, ttl - 1, 0xff, NULL);
+
+    return OF_ERROR_NONE;
+}
+
+static int
+op_set_field(loci_program_packet_t *pkt, layout_t *l, const loci_op_t *op)
+{
+    field_loc_t loc;
+    int rv;
+
+    if (l->vlan < 0 && op->arg16 != 0) {
+        if ((rv = push_vlan(pkt, l, op->arg16)) < 0) {
+            return rv;
+        }
+    }
+    if (field_locate(l, op->field, &loc) < 0) {
+        return OF_ERROR_NONE;
+    }
+    if (op->field == LOCI_FIELD_IPV6_SRC || op->field == LOCI_FIELD_IPV6_DST) {
+        field_write(pkt->data, l, &loc, 0, 0, op->ipv6.addr);
+    } else {
+        field_write(pkt->data, l, &loc, op->value, op->mask, NULL);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+static void
+op_move(uint8_t *data, layout_t *l, const loci_op_t *op)
+{
+    field_loc_t src, dst;
+    uint64_t value, mask;
+
+    if (field_locate(l, op->src_field, &src) < 0 ||
+        field_locate(l, op->field, &dst) < 0) {
+        return;
+    }
+    mask = op->n_bits >= 64 ? ~0ULL : (1ULL << op->n_bits) - 1;
+    value = (field_load(data, &src) >> (src.shift + op->src_ofs)) & mask;
+    field_write(data, l, &dst, value << op->dst_ofs, mask << op->dst_ofs,
+                NULL);
+}
+
+/**
+ * Run ops on a packet
+ * @param ops The ops
+ * @param n_ops Number of ops
+ * @param pkt The packet, changed in place
+ * @param env Callbacks and state
+ * @returns An error code
+ *
+ * OF_ERROR_RANGE means a TTL decrement found a TTL of 0 or 1; the
+ * packet should be dropped or sent to the controller.  OF_ERROR_RESOURCE
+ * means a push found too little headroom.  The ops before the failing
+ * one have been run.
+ */
+int
+loci_program_run_ops(const loci_op_t *ops, int n_ops,
+                     loci_program_packet_t *pkt, loci_program_env_t *env)
+{
+    const loci_op_t *op;
+    layout_t l;
+    int i, rv = OF_ERROR_NONE;
+
+    layout_parse(pkt->data, pkt->len, &l);
+
+    for (i = 0; i < n_ops && rv == OF_ERROR_NONE; i++) {
+        op = &ops[i];
+        switch (op->code) {
+        case LOCI_OP_OUTPUT:
+            if (env->output != NULL) {
+                env->output(env->cookie, op->arg32, op->arg16, pkt->data,
+                            pkt->len);
+            }
+            break;
+        case LOCI_OP_GROUP:
+            if (env->group != NULL) {
+                env->group(env->cookie, op->arg32, pkt->data, pkt->len);
+            }
+            break;
+        case LOCI_OP_SET_QUEUE:
+            env->queue_id = op->arg32;
+            break;
+        case LOCI_OP_RESUBMIT:
+            if (env->resubmit != NULL) {
+                env->resubmit(env->cookie, op->arg32, op->arg16, pkt->data,
+                              pkt->len);
+            }
+            break;
+        case LOCI_OP_PUSH_VLAN:
+            rv = push_vlan(pkt, &l, op->arg16);
+            break;
+        case LOCI_OP_POP_VLAN:
+            if (l.vlan >= 0) {
+                header_remove(pkt, 12, VLAN_HEADER_LENGTH);
+                layout_parse(pkt->data, pkt->len, &l);
+            }
+            break;
+        case LOCI_OP_PUSH_MPLS:
+            rv = push_mpls(pkt, &l, op->arg16);
+            break;
+        case LOCI_OP_POP_MPLS:
+            if (l.l3_type == ETH_TYPE_MPLS || l.l3_type == ETH_TYPE_MPLS_MCAST) {
+                header_remove(pkt, l.l3, MPLS_HEADER_LENGTH);
+                put16(pkt->data + l.eth_type, op->arg16);
+                layout_parse(pkt->data, pkt->len, &l);
+            }
+            break;
+        case LOCI_OP_SET_FIELD:
+            rv = op_set_field(pkt, &l, op);
+            break;
+        case LOCI_OP_MOVE:
+            op_move(pkt->data, &l, op);
+            break;
+        case LOCI_OP_DEC_NW_TTL:
+            rv = dec_ttl(pkt->data, &l, LOCI_FIELD_IP_TTL);
+            break;
+        case LOCI_OP_DEC_MPLS_TTL:
+            rv = dec_ttl(pkt->data, &l, LOCI_FIELD_MPLS_TTL);
+            break;
+        case LOCI_OP_SET_TUNNEL_ID:
+            env->tunnel_id = op->value;
+            break;
+        case LOCI_OP_SET_TUNNEL_DST:
+            env->tunnel_dst = op->arg32;
+            break;
+        default:
+            rv = OF_ERROR_PARAM;
+            break;
+        }
+    }
+
+    return rv;
+}
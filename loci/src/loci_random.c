@@ -0,0 +1,717 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file loci_random.c
+ *
+ * Deterministic random object generator.  The per-class functions are
+ * generated in loci_obj_random.c; this file holds the generator state,
+ * the value generators and the list and child helpers they call.
+ */
+
+#include <loci/loci.h>
+#include <loci/loci_random.h>
+#include <loci/loci_class_metadata.h>
+#include "loci_int.h"
+
+#define CHANCE(r, percent) (loci_random_range(r, 100) < (uint32_t)(percent))
+
+#define ETH_TYPE_IPV4 0x0800
+#define ETH_TYPE_ARP 0x0806
+#define ETH_TYPE_VLAN 0x8100
+#define ETH_TYPE_IPV6 0x86dd
+
+#define IP_PROTO_ICMP 1
+#define IP_PROTO_TCP 6
+#define IP_PROTO_UDP 17
+
+static const uint16_t service_ports[] = {
+    22, 53, 80, 123, 179, 443, 3306, 6633, 6653, 8080,
+};
+
+static const of_port_no_t reserved_ports[] = {
+    OF_PORT_DEST_IN_PORT,
+    OF_PORT_DEST_FLOOD,
+    OF_PORT_DEST_ALL,
+    OF_PORT_DEST_CONTROLLER,
+    OF_PORT_DEST_LOCAL,
+};
+
+#define ARRAY_SIZE(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+/**
+ * Set a configuration to the defaults
+ * @param config The configuration to initialize
+ */
+void
+loci_random_config_init(loci_random_config_t *config)
+{
+    MEMSET(config, 0, sizeof(*config));
+    config->list_max = 4;
+    config->depth_max = 2;
+    config->octets_max = 32;
+    config->packet_min = 64;
+    config->packet_max = 256;
+    config->match_fields = 50;
+    config->match_masked = 25;
+}
+
+static int
+clamp(int val, int min, int max)
+{
+    return val < min ? min : (val > max ? max : val);
+}
+
+/**
+ * Initialize a generator
+ * @param r The generator
+ * @param config The configuration, or NULL for the defaults
+ *
+ * Out of range configuration values are clamped.
+ */
+void
+loci_random_init(loci_random_t *r, const loci_random_config_t *config)
+{
+    MEMSET(r, 0, sizeof(*r));
+    if (config != NULL) {
+        r->config = *config;
+    } else {
+        loci_random_config_init(&r->config);
+    }
+
+    r->config.list_max = clamp(r->config.list_max, 0, 1024);
+    r->config.depth_max = clamp(r->config.depth_max, 0,
+                                LOCI_RANDOM_DEPTH_MAX - 1);
+    r->config.octets_max = clamp(r->config.octets_max, 0,
+                                 LOCI_RANDOM_DATA_MAX);
+    r->config.packet_min = clamp(r->config.packet_min, 64,
+                                 LOCI_RANDOM_DATA_MAX);
+    r->config.packet_max = clamp(r->config.packet_max, r->config.packet_min,
+                                 LOCI_RANDOM_DATA_MAX);
+    r->config.match_fields = clamp(r->config.match_fields, 0, 100);
+    r->config.match_masked = clamp(r->config.match_masked, 0, 100);
+
+    r->state = r->config.seed;
+}
+
+/**
+ * Release the scratch buffers of a generator
+ * @param r The generator
+ */
+void
+loci_random_cleanup(loci_random_t *r)
+{
+    int i;
+
+    for (i = 0; i < LOCI_RANDOM_DEPTH_MAX; i++) {
+        of_wire_buffer_free(r->scratch[i]);
+        r->scratch[i] = NULL;
+    }
+}
+
+/****************************************************************
+ *
+ * Objects
+ *
+ ****************************************************************/
+
+/*
+ * Initialize obj as an empty object of class id in wbuf, pushing its
+ * wire type and length as of_<cls>_new does.
+ */
+static void
+object_bind(of_object_t *obj, of_object_id_t id, of_version_t version,
+            of_wire_buffer_t *wbuf)
+{
+    of_object_init_map[id](obj, version, -1, 1);
+    obj->wbuf = wbuf;
+    of_wire_buffer_grow(wbuf, obj->length);
+    of_object_wire_type_set(obj);
+    of_object_wire_length_set(obj, obj->length);
+}
+
+static int
+scratch_bind(loci_random_t *r, of_object_t *obj, of_object_id_t id,
+             of_version_t version, int depth)
+{
+    of_wire_buffer_t *wbuf;
+
+    if (depth >= LOCI_RANDOM_DEPTH_MAX) {
+        return OF_ERROR_RESOURCE;
+    }
+    if ((wbuf = r->scratch[depth]) == NULL) {
+        if ((wbuf = of_wire_buffer_new(OF_WIRE_BUFFER_MAX_LENGTH)) == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        r->scratch[depth] = wbuf;
+    }
+    wbuf->current_bytes = 0;
+    object_bind(obj, id, version, wbuf);
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Build a random list in a scratch buffer
+ * @param r The generator
+ * @param list The list object to initialize
+ * @param list_id The class of the list
+ * @param version The OpenFlow version
+ * @param ids The element classes to choose from
+ * @param count The number of entries in ids
+ * @param depth The nesting depth of the elements
+ *
+ * The list is valid until the next list or child is built at the same
+ * depth; the caller copies it into its parent with the list setter.
+ * Elements that no longer fit in the list are left out.
+ */
+int
+loci_random_list(loci_random_t *r, of_object_t *list, of_object_id_t list_id,
+                 of_version_t version, const of_object_id_t *ids, int count,
+                 int depth)
+{
+    of_object_t elt;
+    int i, n, rv;
+
+    if ((rv = scratch_bind(r, list, list_id, version, depth)) < 0) {
+        return rv;
+    }
+    if (count == 0 || depth > r->config.depth_max) {
+        return OF_ERROR_NONE;
+    }
+
+    n = loci_random_range(r, r->config.list_max + 1);
+    for (i = 0; i < n; i++) {
+        of_object_init_map[ids[loci_random_range(r, count)]](
+            &elt, version, -1, 1);
+        if (of_list_append_bind(list, &elt) < 0) {
+            break;
+        }
+        if ((rv = loci_random_object(r, &elt, depth)) < 0) {
+            return rv;
+        }
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Build a random child object in a scratch buffer
+ * @param r The generator
+ * @param obj The object to initialize
+ * @param version The OpenFlow version
+ * @param ids The classes to choose from
+ * @param count The number of entries in ids
+ * @param depth The nesting depth of obj
+ *
+ * As with loci_random_list, the caller copies the child into its
+ * parent with the member setter.
+ */
+int
+loci_random_child(loci_random_t *r, of_object_t *obj, of_version_t version,
+                  const of_object_id_t *ids, int count, int depth)
+{
+    int rv;
+
+    if (count == 0) {
+        return OF_ERROR_PARAM;
+    }
+    if ((rv = scratch_bind(r, obj, ids[loci_random_range(r, count)],
+                           version, depth)) < 0) {
+        return rv;
+    }
+
+    return loci_random_object(r, obj, depth);
+}
+
+/**
+ * Allocate a random object
+ * @param r The generator
+ * @param id The class of the object; must not be a virtual class
+ * @param version The OpenFlow version
+ * @returns The object, or NULL if the class does not exist in the
+ * version or the object could not be built
+ */
+of_object_t *
+loci_random_new(loci_random_t *r, of_object_id_t id, of_version_t version)
+{
+    of_object_t *obj;
+
+    if (id <= OF_OBJECT || id >= OF_OBJECT_COUNT ||
+            !OF_VERSION_OKAY(version) ||
+            of_object_fixed_len[version][id] < 0) {
+        return NULL;
+    }
+
+    if ((obj = of_object_new(OF_WIRE_BUFFER_MAX_LENGTH)) == NULL) {
+        return NULL;
+    }
+    object_bind(obj, id, version, obj->wbuf);
+    LOCI_OBJECT_NEW_HOOK(obj);
+
+    if (loci_random_object(r, obj, 0) < 0) {
+        of_object_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+/**
+ * Allocate a random message of any type valid for a version
+ * @param r The generator
+ * @param version The OpenFlow version
+ */
+of_object_t *
+loci_random_message_new(loci_random_t *r, of_version_t version)
+{
+    const of_object_id_t *ids;
+    int count;
+
+    if ((ids = loci_random_message_ids(version, &count)) == NULL ||
+            count == 0) {
+        return NULL;
+    }
+
+    return loci_random_new(r, ids[loci_random_range(r, count)], version);
+}
+
+/**
+ * Set every member of an existing object to random values
+ * @param r The generator
+ * @param obj An object from of_<cls>_new
+ */
+int
+of_object_random(loci_random_t *r, of_object_t *obj)
+{
+    return loci_random_object(r, obj, 0);
+}
+
+/****************************************************************
+ *
+ * Values
+ *
+ ****************************************************************/
+
+/**
+ * A port number; mostly front panel ports, sometimes a reserved port
+ */
+of_port_no_t
+loci_random_port_no(loci_random_t *r)
+{
+    if (loci_random_range(r, 8) == 0) {
+        return reserved_ports[loci_random_range(r, ARRAY_SIZE(reserved_ports))];
+    }
+    return 1 + loci_random_range(r, 48);
+}
+
+/**
+ * An address in 10.0.0.0/8
+ */
+of_ipv4_t
+loci_random_ipv4(loci_random_t *r)
+{
+    return 0x0a000000 | (loci_random_u64(r) & 0xffffff);
+}
+
+/**
+ * A locally administered unicast address
+ */
+void
+loci_random_mac(loci_random_t *r, of_mac_addr_t *mac)
+{
+    loci_random_bytes(r, mac->addr, sizeof(mac->addr));
+    mac->addr[0] = (mac->addr[0] & 0xfc) | 0x02;
+}
+
+/**
+ * A unique local address, in fd00::/8
+ */
+void
+loci_random_ipv6(loci_random_t *r, of_ipv6_t *ipv6)
+{
+    loci_random_bytes(r, ipv6->addr, sizeof(ipv6->addr));
+    ipv6->addr[0] = 0xfd;
+}
+
+void
+loci_random_bytes(loci_random_t *r, void *buf, int len)
+{
+    uint8_t *p = buf;
+    uint64_t val;
+    int i;
+
+    for (i = 0; i + 8 <= len; i += 8) {
+        val = loci_random_u64(r);
+        MEMCPY(p + i, &val, 8);
+    }
+    if (i < len) {
+        val = loci_random_u64(r);
+        MEMCPY(p + i, &val, len - i);
+    }
+}
+
+/**
+ * A short lower case name, NUL padded to len bytes
+ */
+void
+loci_random_string(loci_random_t *r, char *buf, int len)
+{
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+    int i, n;
+
+    MEMSET(buf, 0, len);
+    if (len < 2) {
+        return;
+    }
+    n = 1 + loci_random_range(r, len - 1 < 12 ? len - 1 : 12);
+    for (i = 0; i < n; i++) {
+        buf[i] = chars[loci_random_range(r, sizeof(chars) - 1)];
+    }
+}
+
+/**
+ * Up to octets_max random bytes, in the generator's data buffer
+ */
+void
+loci_random_octets(loci_random_t *r, of_octets_t *octets)
+{
+    octets->bytes = loci_random_range(r, r->config.octets_max + 1);
+    octets->data = r->data;
+    loci_random_bytes(r, r->data, octets->bytes);
+}
+
+/****************************************************************
+ *
+ * Matches
+ *
+ ****************************************************************/
+
+static uint32_t
+prefix_mask(int len)
+{
+    return len == 0 ? 0 : 0xffffffff << (32 - len);
+}
+
+static void
+match_ipv4(loci_random_t *r, of_ipv4_t *field, of_ipv4_t *mask)
+{
+    *field = loci_random_ipv4(r);
+    if (CHANCE(r, r->config.match_masked)) {
+        *mask = prefix_mask(8 + loci_random_range(r, 24));
+        *field &= *mask;
+    } else {
+        *mask = 0xffffffff;
+    }
+}
+
+static void
+match_ipv6(loci_random_t *r, of_ipv6_t *field, of_ipv6_t *mask)
+{
+    int bytes = 16;
+
+    loci_random_ipv6(r, field);
+    if (CHANCE(r, r->config.match_masked)) {
+        bytes = 8;
+        MEMSET(field->addr + bytes, 0, 16 - bytes);
+    }
+    MEMSET(mask->addr, 0, 16);
+    MEMSET(mask->addr, 0xff, bytes);
+}
+
+static void
+match_mac(loci_random_t *r, of_version_t version, of_mac_addr_t *field,
+          of_mac_addr_t *mask)
+{
+    loci_random_mac(r, field);
+    MEMSET(mask->addr, 0xff, sizeof(mask->addr));
+    /* OpenFlow 1.0 can't mask Ethernet addresses */
+    if (version > OF_VERSION_1_0 && CHANCE(r, r->config.match_masked)) {
+        MEMSET(mask->addr + 3, 0, 3);
+        MEMSET(field->addr + 3, 0, 3);
+    }
+}
+
+static uint16_t
+ephemeral_port(loci_random_t *r)
+{
+    return 32768 + loci_random_range(r, 28232);
+}
+
+/**
+ * A random match for a version
+ * @param r The generator
+ * @param version The OpenFlow version
+ * @param match The match to fill in
+ *
+ * The match is for an L2, ARP, IPv4 or IPv6 flow, the last two with
+ * TCP, UDP or ICMP.  Its prerequisites are always consistent; the
+ * other fields are each matched with probability match_fields.
+ *
+ * OpenFlow 1.0 and 1.1 matches have no ARP, IPv6 or ICMP shapes and
+ * carry L4 ports in the TCP fields.  An OpenFlow 1.1 match must match
+ * exactly on its non-maskable fields, so those are always set.
+ */
+void
+loci_random_match(loci_random_t *r, of_version_t version, of_match_t *match)
+{
+    int fields = r->config.match_fields;
+    int oxm = version >= OF_VERSION_1_2;
+    int all = version == OF_VERSION_1_1;
+    int shape;
+    uint8_t ip_proto;
+
+    MEMSET(match, 0, sizeof(*match));
+    match->version = version;
+
+    if (all || CHANCE(r, fields)) {
+        match->fields.in_port = 1 + loci_random_range(r, 48);
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(match);
+    }
+    if (CHANCE(r, fields)) {
+        match_mac(r, version, &match->fields.eth_src, &match->masks.eth_src);
+    }
+    if (CHANCE(r, fields)) {
+        match_mac(r, version, &match->fields.eth_dst, &match->masks.eth_dst);
+    }
+    if (all || CHANCE(r, fields)) {
+        match->fields.vlan_vid = 1 + loci_random_range(r, 4094);
+        if (oxm) {
+            match->fields.vlan_vid |= 0x1000; /* OFPVID_PRESENT */
+        }
+        OF_MATCH_MASK_VLAN_VID_EXACT_SET(match);
+        if (all || CHANCE(r, fields)) {
+            match->fields.vlan_pcp = loci_random_range(r, 8);
+            OF_MATCH_MASK_VLAN_PCP_EXACT_SET(match);
+        }
+    }
+    if (all || (oxm && CHANCE(r, fields))) {
+        match->fields.metadata = loci_random_u64(r);
+        match->masks.metadata = ~(uint64_t)0;
+        if (CHANCE(r, r->config.match_masked)) {
+            match->masks.metadata = 0xffffffff00000000ULL;
+            match->fields.metadata &= match->masks.metadata;
+        }
+    }
+    if (all) {
+        OF_MATCH_MASK_MPLS_LABEL_EXACT_SET(match);
+        OF_MATCH_MASK_MPLS_TC_EXACT_SET(match);
+    }
+
+    /* L2 only, IPv4 TCP, IPv4 UDP, then IPv4 ICMP, ARP and IPv6 */
+    shape = all ? 1 + loci_random_range(r, 2) :
+        loci_random_range(r, oxm ? 6 : 3);
+    if (shape == 0) {
+        if (CHANCE(r, fields)) {
+            match->fields.eth_type = ETH_TYPE_IPV4;
+            OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+        }
+        return;
+    }
+
+    if (shape == 4) {
+        match->fields.eth_type = ETH_TYPE_ARP;
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+        if (CHANCE(r, fields)) {
+            match->fields.arp_op = 1 + loci_random_range(r, 2);
+            OF_MATCH_MASK_ARP_OP_EXACT_SET(match);
+        }
+        if (CHANCE(r, fields)) {
+            match_ipv4(r, &match->fields.arp_spa, &match->masks.arp_spa);
+        }
+        if (CHANCE(r, fields)) {
+            match_ipv4(r, &match->fields.arp_tpa, &match->masks.arp_tpa);
+        }
+        if (CHANCE(r, fields)) {
+            loci_random_mac(r, &match->fields.arp_sha);
+            OF_MATCH_MASK_ARP_SHA_EXACT_SET(match);
+        }
+        return;
+    }
+
+    ip_proto = shape == 2 ? IP_PROTO_UDP :
+        (shape == 3 ? IP_PROTO_ICMP : IP_PROTO_TCP);
+    if (shape == 5) {
+        if (loci_random_range(r, 2)) {
+            ip_proto = IP_PROTO_UDP;
+        }
+        match->fields.eth_type = ETH_TYPE_IPV6;
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+        if (CHANCE(r, fields)) {
+            match_ipv6(r, &match->fields.ipv6_src, &match->masks.ipv6_src);
+        }
+        if (CHANCE(r, fields)) {
+            match_ipv6(r, &match->fields.ipv6_dst, &match->masks.ipv6_dst);
+        }
+        if (CHANCE(r, fields)) {
+            match->fields.ipv6_flabel = loci_random_u64(r) & 0xfffff;
+            OF_MATCH_MASK_IPV6_FLABEL_EXACT_SET(match);
+        }
+    } else {
+        match->fields.eth_type = ETH_TYPE_IPV4;
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+        if (CHANCE(r, fields)) {
+            match_ipv4(r, &match->fields.ipv4_src, &match->masks.ipv4_src);
+        }
+        if (CHANCE(r, fields)) {
+            match_ipv4(r, &match->fields.ipv4_dst, &match->masks.ipv4_dst);
+        }
+    }
+    if (all || CHANCE(r, fields)) {
+        match->fields.ip_dscp = loci_random_range(r, 64);
+        OF_MATCH_MASK_IP_DSCP_EXACT_SET(match);
+    }
+    if (oxm && CHANCE(r, fields)) {
+        match->fields.ip_ecn = loci_random_range(r, 4);
+        OF_MATCH_MASK_IP_ECN_EXACT_SET(match);
+    }
+
+    match->fields.ip_proto = ip_proto;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+
+    if (ip_proto == IP_PROTO_ICMP) {
+        match->fields.icmpv4_type = loci_random_range(r, 2) ? 8 : 0;
+        OF_MATCH_MASK_ICMPV4_TYPE_EXACT_SET(match);
+        if (CHANCE(r, fields)) {
+            match->fields.icmpv4_code = 0;
+            OF_MATCH_MASK_ICMPV4_CODE_EXACT_SET(match);
+        }
+    } else if (ip_proto == IP_PROTO_UDP && oxm) {
+        if (CHANCE(r, fields)) {
+            match->fields.udp_src = ephemeral_port(r);
+            OF_MATCH_MASK_UDP_SRC_EXACT_SET(match);
+        }
+        if (CHANCE(r, fields)) {
+            match->fields.udp_dst = service_ports[
+                loci_random_range(r, ARRAY_SIZE(service_ports))];
+            OF_MATCH_MASK_UDP_DST_EXACT_SET(match);
+        }
+    } else {
+        if (all || CHANCE(r, fields)) {
+            match->fields.tcp_src = ephemeral_port(r);
+            OF_MATCH_MASK_TCP_SRC_EXACT_SET(match);
+        }
+        if (all || CHANCE(r, fields)) {
+            match->fields.tcp_dst = service_ports[
+                loci_random_range(r, ARRAY_SIZE(service_ports))];
+            OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+        }
+    }
+}
+
+/****************************************************************
+ *
+ * Packets
+ *
+ ****************************************************************/
+
+static void
+put16(uint8_t *p, uint16_t val)
+{
+    p[0] = val >> 8;
+    p[1] = val;
+}
+
+static void
+put32(uint8_t *p, uint32_t val)
+{
+    put16(p, val >> 16);
+    put16(p + 2, val);
+}
+
+static uint16_t
+ipv4_checksum(const uint8_t *p, int len)
+{
+    uint32_t sum = 0;
+    int i;
+
+    for (i = 0; i < len; i += 2) {
+        sum += (p[i] << 8) | p[i + 1];
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return ~sum;
+}
+
+/**
+ * A random Ethernet frame, in the generator's data buffer
+ * @param r The generator
+ * @param octets Set to the frame
+ *
+ * Frames are between packet_min and packet_max bytes, without FCS.  A
+ * quarter carry an 802.1Q tag.  Most are IPv4 TCP or UDP with a random
+ * payload; one in eight is an ARP request or reply.
+ */
+void
+loci_random_packet(loci_random_t *r, of_octets_t *octets)
+{
+    uint8_t *p = r->data;
+    of_mac_addr_t mac;
+    int len, off, l3;
+    uint8_t ip_proto;
+
+    len = r->config.packet_min +
+        loci_random_range(r, r->config.packet_max - r->config.packet_min + 1);
+    loci_random_bytes(r, p, len);
+
+    loci_random_mac(r, &mac);
+    MEMCPY(p, mac.addr, 6);
+    loci_random_mac(r, &mac);
+    MEMCPY(p + 6, mac.addr, 6);
+    off = 12;
+    if (loci_random_range(r, 4) == 0) {
+        put16(p + off, ETH_TYPE_VLAN);
+        put16(p + off + 2, (loci_random_range(r, 8) << 13) |
+              (1 + loci_random_range(r, 4094)));
+        off += 4;
+    }
+
+    if (loci_random_range(r, 8) == 0) {
+        put16(p + off, ETH_TYPE_ARP);
+        l3 = off + 2;
+        put16(p + l3, 1);               /* Ethernet */
+        put16(p + l3 + 2, ETH_TYPE_IPV4);
+        p[l3 + 4] = 6;
+        p[l3 + 5] = 4;
+        put16(p + l3 + 6, 1 + loci_random_range(r, 2));
+        MEMCPY(p + l3 + 8, p + 6, 6);
+        put32(p + l3 + 14, loci_random_ipv4(r));
+        MEMSET(p + l3 + 18, 0, 6);
+        put32(p + l3 + 24, loci_random_ipv4(r));
+        MEMSET(p + l3 + 28, 0, len - (l3 + 28));
+    } else {
+        put16(p + off, ETH_TYPE_IPV4);
+        l3 = off + 2;
+        ip_proto = loci_random_range(r, 3) ? IP_PROTO_TCP : IP_PROTO_UDP;
+        p[l3] = 0x45;
+        p[l3 + 1] = loci_random_range(r, 64) << 2;
+        put16(p + l3 + 2, len - l3);
+        put16(p + l3 + 6, 0x4000);      /* Don't fragment */
+        p[l3 + 8] = 64;
+        p[l3 + 9] = ip_proto;
+        put16(p + l3 + 10, 0);
+        put32(p + l3 + 12, loci_random_ipv4(r));
+        put32(p + l3 + 16, loci_random_ipv4(r));
+        put16(p + l3 + 10, ipv4_checksum(p + l3, 20));
+
+        put16(p + l3 + 20, ephemeral_port(r));
+        put16(p + l3 + 22, service_ports[
+                  loci_random_range(r, ARRAY_SIZE(service_ports))]);
+        if (ip_proto == IP_PROTO_TCP) {
+            p[l3 + 32] = 0x50;          /* 20 byte header */
+            p[l3 + 33] = 0x18;          /* PSH, ACK */
+            put16(p + l3 + 36, 0);      /* Checksum not computed */
+            put16(p + l3 + 38, 0);
+        } else {
+            put16(p + l3 + 24, len - (l3 + 20));
+            put16(p + l3 + 26, 0);      /* No checksum */
+        }
+    }
+
+    octets->data = p;
+    octets->bytes = len;
+}
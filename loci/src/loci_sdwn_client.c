@@ -0,0 +1,410 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_sdwn_client.c
+ *
+ * Bulk decode and encode of SDWN client messages.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_sdwn_client.h>
+
+/* OpenFlow 1.3 message types */
+#define EXPERIMENTER_TYPE 4
+#define MULTIPART_REPLY_TYPE 19
+
+/* Experimenter stats type, and the SDWN subtypes */
+#define STATS_TYPE_EXPERIMENTER 0xffff
+#define SUBTYPE_ADD_CLIENT 1
+#define SUBTYPE_GET_CLIENTS 2
+
+/* Offsets in of_sdwn_get_clients_reply */
+#define REPLY_FLAGS_OFFSET 10
+#define REPLY_CLIENT_TYPE_OFFSET 24
+#define REPLY_MAC_OFFSET 28
+/* Of the assoc_id; the normal and crypto kinds have the rest after it */
+#define REPLY_CLIENT_OFFSET 34
+
+/* Offsets in of_sdwn_add_client */
+#define ADD_MAC_OFFSET 16
+#define ADD_AP_OFFSET 24
+#define ADD_CLIENT_OFFSET 28
+
+/*
+ * Offsets from the assoc_id, the same in both messages: assoc_id,
+ * capabilities, cap_flags, ht_capabilities, vht_capabilities,
+ * supported_rates, keys
+ */
+#define CAPABILITIES_OFFSET 2
+#define CAP_FLAGS_OFFSET 4
+#define HT_CAP_OFFSET 6
+#define VHT_CAP_OFFSET (HT_CAP_OFFSET + LOCI_SDWN_HT_CAP_BYTES)
+#define RATES_OFFSET (VHT_CAP_OFFSET + LOCI_SDWN_VHT_CAP_BYTES)
+#define KEYS_OFFSET (RATES_OFFSET + OF_DESC_STR_LEN)
+
+/* Check that a list of TLVs fills len exactly */
+static int
+tlvs_check(uint8_t *buf, int len)
+{
+    uint16_t tlv_len;
+    int offset = 0;
+
+    while (offset < len) {
+        if (offset + 4 > len) {
+            return OF_ERROR_PARSE;
+        }
+        buf_u16_get(buf + offset + 2, &tlv_len);
+        if (tlv_len < 4 || offset + tlv_len > len) {
+            return OF_ERROR_PARSE;
+        }
+        offset += tlv_len;
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/* Read the fields from assoc_id on, and the keys up to end */
+static int
+client_read(uint8_t *buf, int end, loci_sdwn_client_t *client)
+{
+    buf_u16_get(buf, &client->assoc_id);
+    buf_u16_get(buf + CAPABILITIES_OFFSET, &client->capabilities);
+    buf_u16_get(buf + CAP_FLAGS_OFFSET, &client->cap_flags);
+    MEMCPY(client->ht_capabilities, buf + HT_CAP_OFFSET,
+           LOCI_SDWN_HT_CAP_BYTES);
+    MEMCPY(client->vht_capabilities, buf + VHT_CAP_OFFSET,
+           LOCI_SDWN_VHT_CAP_BYTES);
+    client->supported_rates = buf + RATES_OFFSET;
+    if (end > KEYS_OFFSET) {
+        client->keys = buf + KEYS_OFFSET;
+        client->keys_len = end - KEYS_OFFSET;
+        return tlvs_check(client->keys, client->keys_len);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/* Write the fields from assoc_id on, and the keys */
+static void
+client_write(uint8_t *buf, const loci_sdwn_client_t *client)
+{
+    buf_u16_set(buf, client->assoc_id);
+    buf_u16_set(buf + CAPABILITIES_OFFSET, client->capabilities);
+    buf_u16_set(buf + CAP_FLAGS_OFFSET, client->cap_flags);
+    MEMCPY(buf + HT_CAP_OFFSET, client->ht_capabilities,
+           LOCI_SDWN_HT_CAP_BYTES);
+    MEMCPY(buf + VHT_CAP_OFFSET, client->vht_capabilities,
+           LOCI_SDWN_VHT_CAP_BYTES);
+    if (client->supported_rates != NULL) {
+        MEMCPY(buf + RATES_OFFSET, client->supported_rates, OF_DESC_STR_LEN);
+    } else {
+        MEMSET(buf + RATES_OFFSET, 0, OF_DESC_STR_LEN);
+    }
+    if (client->keys_len > 0) {
+        MEMCPY(buf + KEYS_OFFSET, client->keys, client->keys_len);
+    }
+}
+
+/****************************************************************
+ * Decoding
+ ****************************************************************/
+
+static int
+reply_peek(uint8_t *buf, int len, loci_sdwn_client_t *client)
+{
+    uint8_t type;
+
+    buf_u8_get(buf + REPLY_CLIENT_TYPE_OFFSET, &type);
+    client->type = type;
+    switch (type) {
+    case LOCI_SDWN_CLIENT_LVAP:
+        if (len != LOCI_SDWN_REPLY_LVAP_BYTES) {
+            return OF_ERROR_PARSE;
+        }
+        break;
+    case LOCI_SDWN_CLIENT_NORMAL:
+        if (len != LOCI_SDWN_REPLY_BYTES) {
+            return OF_ERROR_PARSE;
+        }
+        break;
+    case LOCI_SDWN_CLIENT_CRYPTO:
+        if (len < LOCI_SDWN_REPLY_BYTES) {
+            return OF_ERROR_PARSE;
+        }
+        break;
+    default:
+        return OF_ERROR_PARSE;
+    }
+    buf_mac_get(buf + REPLY_MAC_OFFSET, &client->mac);
+    if (type == LOCI_SDWN_CLIENT_LVAP) {
+        return OF_ERROR_NONE;
+    }
+
+    return client_read(buf + REPLY_CLIENT_OFFSET, len - REPLY_CLIENT_OFFSET,
+                       client);
+}
+
+static int
+add_client_peek(uint8_t *buf, int len, loci_sdwn_client_t *client)
+{
+    if (len < LOCI_SDWN_ADD_CLIENT_BYTES) {
+        return OF_ERROR_PARSE;
+    }
+    client->type = LOCI_SDWN_CLIENT_NORMAL;
+    buf_mac_get(buf + ADD_MAC_OFFSET, &client->mac);
+    buf_u32_get(buf + ADD_AP_OFFSET, &client->ap);
+    if (len > LOCI_SDWN_ADD_CLIENT_BYTES) {
+        client->type = LOCI_SDWN_CLIENT_CRYPTO;
+    }
+
+    return client_read(buf + ADD_CLIENT_OFFSET, len - ADD_CLIENT_OFFSET,
+                       client);
+}
+
+/**
+ * Peek at an of_sdwn_get_clients_reply or of_sdwn_add_client
+ * @param buf The message
+ * @param len Length of buf
+ * @param client Filled in with the client
+ * @returns 0, OF_ERROR_PARSE if buf isn't a well formed client message
+ * or OF_ERROR_VERSION
+ *
+ * The message length is taken from the header and must be at most len.
+ * The type of a client from an add_client is crypto if it has keys,
+ * else normal.
+ */
+int
+loci_sdwn_client_peek(uint8_t *buf, int len, loci_sdwn_client_t *client)
+{
+    int msg_len;
+    uint8_t type;
+
+    MEMSET(client, 0, sizeof(*client));
+
+    if (len < OF_MESSAGE_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+    if (of_message_version_get(buf) != OF_VERSION_1_3) {
+        return OF_ERROR_VERSION;
+    }
+    msg_len = of_message_length_get(buf);
+    if (msg_len > len || msg_len < OF_MESSAGE_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+
+    type = of_message_type_get(buf);
+    if (type == MULTIPART_REPLY_TYPE &&
+        msg_len >= REPLY_MAC_OFFSET &&
+        of_message_stats_type_get(buf) == STATS_TYPE_EXPERIMENTER &&
+        of_message_stats_experimenter_id_get(buf) ==
+        OF_EXPERIMENTER_ID_SDWN &&
+        of_message_stats_experimenter_subtype_get(buf) ==
+        SUBTYPE_GET_CLIENTS) {
+        return reply_peek(buf, msg_len, client);
+    }
+    if (type == EXPERIMENTER_TYPE &&
+        msg_len >= ADD_MAC_OFFSET &&
+        of_message_experimenter_id_get(buf) == OF_EXPERIMENTER_ID_SDWN &&
+        of_message_experimenter_subtype_get(buf) == SUBTYPE_ADD_CLIENT) {
+        return add_client_peek(buf, msg_len, client);
+    }
+
+    return OF_ERROR_PARSE;
+}
+
+/**
+ * Decode back to back client messages into an array of clients
+ * @param buf The messages
+ * @param len Length of buf
+ * @param clients Where to put the clients
+ * @param max Most clients to read
+ * @param more If not NULL, set to whether the last message is a reply
+ * with OF_STATS_REPLY_FLAG_REPLY_MORE, so the poll has more to come
+ * @returns Number of clients read; OF_ERROR_RESOURCE if there are more
+ * than max, or as loci_sdwn_client_peek for the first message that
+ * isn't a client
+ *
+ * buf must hold whole messages.
+ */
+int
+loci_sdwn_clients_decode(uint8_t *buf, int len, loci_sdwn_client_t *clients,
+                         int max, int *more)
+{
+    uint16_t flags = 0;
+    int n, rv, offset = 0;
+
+    for (n = 0; offset < len; n++) {
+        if (n == max) {
+            return OF_ERROR_RESOURCE;
+        }
+        if ((rv = loci_sdwn_client_peek(buf + offset, len - offset,
+                                        &clients[n])) < 0) {
+            return rv;
+        }
+        flags = 0;
+        if (of_message_type_get(buf + offset) == MULTIPART_REPLY_TYPE) {
+            buf_u16_get(buf + offset + REPLY_FLAGS_OFFSET, &flags);
+        }
+        offset += of_message_length_get(buf + offset);
+    }
+    if (more != NULL) {
+        *more = (flags & OF_STATS_REPLY_FLAG_REPLY_MORE) != 0;
+    }
+
+    return n;
+}
+
+/****************************************************************
+ * Encoding
+ ****************************************************************/
+
+/* Wire length of a client's message, or 0 if it's too long */
+static int
+reply_bytes(const loci_sdwn_client_t *client)
+{
+    int bytes;
+
+    switch (client->type) {
+    case LOCI_SDWN_CLIENT_LVAP:
+        return LOCI_SDWN_REPLY_LVAP_BYTES;
+    case LOCI_SDWN_CLIENT_NORMAL:
+        return LOCI_SDWN_REPLY_BYTES;
+    case LOCI_SDWN_CLIENT_CRYPTO:
+        bytes = LOCI_SDWN_REPLY_BYTES + client->keys_len;
+        return bytes <= OF_WIRE_BUFFER_MAX_LENGTH ? bytes : 0;
+    default:
+        return 0;
+    }
+}
+
+static int
+add_client_bytes(const loci_sdwn_client_t *client)
+{
+    int bytes = LOCI_SDWN_ADD_CLIENT_BYTES + client->keys_len;
+
+    return bytes <= OF_WIRE_BUFFER_MAX_LENGTH ? bytes : 0;
+}
+
+static void
+header_write(uint8_t *buf, uint8_t type, int bytes, uint32_t xid)
+{
+    buf_u8_set(buf + OF_MESSAGE_VERSION_OFFSET, OF_VERSION_1_3);
+    buf_u8_set(buf + OF_MESSAGE_TYPE_OFFSET, type);
+    buf_u16_set(buf + OF_MESSAGE_LENGTH_OFFSET, bytes);
+    buf_u32_set(buf + OF_MESSAGE_XID_OFFSET, xid);
+}
+
+/**
+ * Encode clients as back to back of_sdwn_get_clients_reply messages
+ * @param buf Where to put the messages
+ * @param len Length of buf
+ * @param xid Of the request being answered
+ * @param clients The clients
+ * @param count Number of clients
+ * @param next Index of the first client to encode; moved past the
+ * clients encoded
+ * @returns Number of bytes written; OF_ERROR_RESOURCE if the next
+ * client doesn't fit, or OF_ERROR_PARAM if it has an unknown type or
+ * too many keys for a message
+ *
+ * Each client gets the kind of reply of its type; only crypto replies
+ * carry keys.  OF_STATS_REPLY_FLAG_REPLY_MORE is set on all but the
+ * reply of the last client.
+ */
+int
+loci_sdwn_clients_reply_encode(uint8_t *buf, int len, uint32_t xid,
+                               const loci_sdwn_client_t *clients, int count,
+                               int *next)
+{
+    const loci_sdwn_client_t *client;
+    int bytes, offset = 0;
+    uint8_t *msg;
+
+    for (; *next < count; (*next)++) {
+        client = &clients[*next];
+        if ((bytes = reply_bytes(client)) == 0) {
+            return offset > 0 ? offset : OF_ERROR_PARAM;
+        }
+        if (offset + bytes > len) {
+            break;
+        }
+        msg = buf + offset;
+        MEMSET(msg, 0, REPLY_CLIENT_OFFSET);
+        header_write(msg, MULTIPART_REPLY_TYPE, bytes, xid);
+        buf_u16_set(msg + OF_MESSAGE_STATS_TYPE_OFFSET,
+                    STATS_TYPE_EXPERIMENTER);
+        if (*next < count - 1) {
+            buf_u16_set(msg + REPLY_FLAGS_OFFSET,
+                        OF_STATS_REPLY_FLAG_REPLY_MORE);
+        }
+        buf_u32_set(msg + OF_MESSAGE_STATS_EXPERIMENTER_ID_OFFSET,
+                    OF_EXPERIMENTER_ID_SDWN);
+        buf_u32_set(msg + OF_MESSAGE_STATS_EXPERIMENTER_SUBTYPE_OFFSET,
+                    SUBTYPE_GET_CLIENTS);
+        buf_u8_set(msg + REPLY_CLIENT_TYPE_OFFSET, client->type);
+        MEMCPY(msg + REPLY_MAC_OFFSET, &client->mac, OF_MAC_ADDR_BYTES);
+        if (client->type != LOCI_SDWN_CLIENT_LVAP) {
+            client_write(msg + REPLY_CLIENT_OFFSET, client);
+        }
+        offset += bytes;
+    }
+    if (offset == 0 && *next < count) {
+        return OF_ERROR_RESOURCE;
+    }
+
+    return offset;
+}
+
+/**
+ * Encode clients as back to back of_sdwn_add_client messages
+ * @param buf Where to put the messages
+ * @param len Length of buf
+ * @param xid Of the messages
+ * @param clients The clients
+ * @param count Number of clients
+ * @param next As loci_sdwn_clients_reply_encode
+ * @returns As loci_sdwn_clients_reply_encode
+ *
+ * The type of the clients isn't sent; each message carries the keys
+ * of its client, if any.
+ */
+int
+loci_sdwn_add_clients_encode(uint8_t *buf, int len, uint32_t xid,
+                             const loci_sdwn_client_t *clients, int count,
+                             int *next)
+{
+    const loci_sdwn_client_t *client;
+    int bytes, offset = 0;
+    uint8_t *msg;
+
+    for (; *next < count; (*next)++) {
+        client = &clients[*next];
+        if ((bytes = add_client_bytes(client)) == 0) {
+            return offset > 0 ? offset : OF_ERROR_PARAM;
+        }
+        if (offset + bytes > len) {
+            break;
+        }
+        msg = buf + offset;
+        MEMSET(msg, 0, ADD_CLIENT_OFFSET);
+        header_write(msg, EXPERIMENTER_TYPE, bytes, xid);
+        buf_u32_set(msg + OF_MESSAGE_EXPERIMENTER_ID_OFFSET,
+                    OF_EXPERIMENTER_ID_SDWN);
+        buf_u32_set(msg + OF_MESSAGE_EXPERIMENTER_SUBTYPE_OFFSET,
+                    SUBTYPE_ADD_CLIENT);
+        MEMCPY(msg + ADD_MAC_OFFSET, &client->mac, OF_MAC_ADDR_BYTES);
+        buf_u32_set(msg + ADD_AP_OFFSET, client->ap);
+        client_write(msg + ADD_CLIENT_OFFSET, client);
+        offset += bytes;
+    }
+    if (offset == 0 && *next < count) {
+        return OF_ERROR_RESOURCE;
+    }
+
+    return offset;
+}
@@ -0,0 +1,366 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_sdwn_mgmt.c
+ *
+ * Peek, filter, dispatch and reply for SDWN management frames.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_hash.h>
+#include <loci/loci_sdwn_mgmt.h>
+
+/* OpenFlow 1.3 message type of experimenter messages */
+#define EXPERIMENTER_TYPE 4
+
+/* SDWN subtypes */
+#define SUBTYPE_PACKET_IN 2
+#define SUBTYPE_MGMT 9
+#define SUBTYPE_MGMT_REPLY 10
+
+/* Offsets in of_sdwn_ieee80211_mgmt */
+#define MGMT_TYPE_OFFSET 16
+#define MGMT_ADDR_OFFSET 17
+#define MGMT_TARGET_OFFSET 23
+#define MGMT_SSI_OFFSET 29
+#define MGMT_FREQ_OFFSET 33
+#define MGMT_IF_NO_OFFSET 37
+
+/* Offsets in of_sdwn_packet_in, the frame header decoded */
+#define PACKET_IN_IF_NO_OFFSET 16
+#define PACKET_IN_FC_OFFSET 20
+#define PACKET_IN_ADDR1_OFFSET 24
+#define PACKET_IN_ADDR2_OFFSET 30
+#define PACKET_IN_ADDR3_OFFSET 36
+#define PACKET_IN_SEQ_CTRL_OFFSET 42
+#define PACKET_IN_FRAME_OFFSET 50
+
+/* Offsets in of_sdwn_ieee80211_mgmt_reply */
+#define REPLY_IF_NO_OFFSET 16
+#define REPLY_DENY_OFFSET 23
+
+/* Management frame subtypes of the frame control */
+#define FC_TYPE_MGMT 0
+#define FC_ASSOC_REQ 0
+#define FC_REASSOC_REQ 2
+#define FC_PROBE_REQ 4
+#define FC_AUTH 11
+
+struct loci_sdwn_mgmt_slot_s {
+    uint64_t key;               /* 0 for none */
+    uint64_t start;             /* Of the window */
+    uint32_t count;             /* Events let through in the window */
+};
+
+/* The SDWN subtype of an experimenter message, or -1 */
+static int
+sdwn_subtype_get(uint8_t *buf, int len)
+{
+    if (len < OF_MESSAGE_EXPERIMENTER_SUBTYPE_OFFSET + 4 ||
+        of_message_type_get(buf) != EXPERIMENTER_TYPE ||
+        of_message_experimenter_id_get(buf) != OF_EXPERIMENTER_ID_SDWN) {
+        return -1;
+    }
+
+    return of_message_experimenter_subtype_get(buf);
+}
+
+/* The type of a frame from its frame control */
+static uint8_t
+frame_type(uint8_t frame_control)
+{
+    if (((frame_control >> 2) & 0x3) != FC_TYPE_MGMT) {
+        return IEEE80211_MGMT;
+    }
+
+    switch (frame_control >> 4) {
+    case FC_ASSOC_REQ:
+    case FC_REASSOC_REQ:
+        return IEEE80211_ASSOC;
+    case FC_PROBE_REQ:
+        return IEEE80211_PROBE;
+    case FC_AUTH:
+        return IEEE80211_AUTH;
+    default:
+        return IEEE80211_MGMT;
+    }
+}
+
+static int
+mgmt_peek(uint8_t *buf, int len, loci_sdwn_mgmt_t *mgmt)
+{
+    if (len < LOCI_SDWN_MGMT_BYTES) {
+        return OF_ERROR_PARSE;
+    }
+    mgmt->object_id = OF_SDWN_IEEE80211_MGMT;
+    buf_u8_get(buf + MGMT_TYPE_OFFSET, &mgmt->type);
+    if (mgmt->type >= LOCI_SDWN_MGMT_TYPES) {
+        return OF_ERROR_PARSE;
+    }
+    buf_mac_get(buf + MGMT_ADDR_OFFSET, &mgmt->addr);
+    buf_mac_get(buf + MGMT_TARGET_OFFSET, &mgmt->target);
+    buf_u32_get(buf + MGMT_SSI_OFFSET, &mgmt->ssi);
+    buf_u32_get(buf + MGMT_FREQ_OFFSET, &mgmt->freq);
+    buf_u32_get(buf + MGMT_IF_NO_OFFSET, &mgmt->if_no);
+
+    return OF_ERROR_NONE;
+}
+
+static int
+packet_in_peek(uint8_t *buf, int len, loci_sdwn_mgmt_t *mgmt)
+{
+    if (len < PACKET_IN_FRAME_OFFSET) {
+        return OF_ERROR_PARSE;
+    }
+    mgmt->object_id = OF_SDWN_PACKET_IN;
+    buf_u32_get(buf + PACKET_IN_IF_NO_OFFSET, &mgmt->if_no);
+    buf_u8_get(buf + PACKET_IN_FC_OFFSET, &mgmt->frame_control);
+    mgmt->type = frame_type(mgmt->frame_control);
+    buf_mac_get(buf + PACKET_IN_ADDR1_OFFSET, &mgmt->target);
+    buf_mac_get(buf + PACKET_IN_ADDR2_OFFSET, &mgmt->addr);
+    buf_mac_get(buf + PACKET_IN_ADDR3_OFFSET, &mgmt->bssid);
+    buf_u16_get(buf + PACKET_IN_SEQ_CTRL_OFFSET, &mgmt->seq_ctrl);
+    mgmt->frame = buf + PACKET_IN_FRAME_OFFSET;
+    mgmt->frame_len = len - PACKET_IN_FRAME_OFFSET;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Peek at an of_sdwn_ieee80211_mgmt or of_sdwn_packet_in
+ * @param buf The message
+ * @param len Length of buf
+ * @param mgmt Filled in with the frame
+ * @returns 0, OF_ERROR_PARSE if buf isn't a well formed management
+ * frame message or OF_ERROR_VERSION
+ *
+ * The message length is taken from the header and must be at most len.
+ */
+int
+loci_sdwn_mgmt_peek(uint8_t *buf, int len, loci_sdwn_mgmt_t *mgmt)
+{
+    int msg_len;
+
+    MEMSET(mgmt, 0, sizeof(*mgmt));
+
+    if (len < OF_MESSAGE_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+    if (of_message_version_get(buf) != OF_VERSION_1_3) {
+        return OF_ERROR_VERSION;
+    }
+    msg_len = of_message_length_get(buf);
+    if (msg_len > len) {
+        return OF_ERROR_PARSE;
+    }
+    mgmt->msg = buf;
+    mgmt->msg_len = msg_len;
+    mgmt->xid = of_message_xid_get(buf);
+
+    switch (sdwn_subtype_get(buf, msg_len)) {
+    case SUBTYPE_MGMT:
+        return mgmt_peek(buf, msg_len, mgmt);
+    case SUBTYPE_PACKET_IN:
+        return packet_in_peek(buf, msg_len, mgmt);
+    default:
+        return OF_ERROR_PARSE;
+    }
+}
+
+/****************************************************************
+ * Filter
+ ****************************************************************/
+
+/**
+ * Initialize a filter
+ * @param filter The filter
+ * @param slots Clients the filter keeps track of, rounded up to a
+ * power of 2
+ * @param window Length of a window, in the unit of the clock
+ * @param burst Events let through per client and type in a window
+ * @returns 0, OF_ERROR_PARAM or OF_ERROR_RESOURCE
+ */
+int
+loci_sdwn_mgmt_filter_init(loci_sdwn_mgmt_filter_t *filter, int slots,
+                           uint64_t window, int burst)
+{
+    uint32_t n = 1;
+
+    MEMSET(filter, 0, sizeof(*filter));
+    if (slots <= 0 || slots > (1 << 24) || burst <= 0) {
+        return OF_ERROR_PARAM;
+    }
+    while (n < (uint32_t)slots) {
+        n <<= 1;
+    }
+    if ((filter->slots = MALLOC(n * sizeof(*filter->slots))) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    MEMSET(filter->slots, 0, n * sizeof(*filter->slots));
+    filter->mask = n - 1;
+    filter->window = window;
+    filter->burst = burst;
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Free the slots of a filter
+ * @param filter The filter
+ */
+void
+loci_sdwn_mgmt_filter_cleanup(loci_sdwn_mgmt_filter_t *filter)
+{
+    FREE(filter->slots);
+    filter->slots = NULL;
+}
+
+/**
+ * Check an event against a filter
+ * @param filter The filter
+ * @param mgmt The event
+ * @param now The time
+ * @returns 1 to let the event through, 0 to drop it
+ *
+ * Events are counted per client address and type, whatever the
+ * interface, so the same probe heard on two radios counts against one
+ * burst.
+ * The time must not go backwards.
+ */
+int
+loci_sdwn_mgmt_filter_check(loci_sdwn_mgmt_filter_t *filter,
+                            const loci_sdwn_mgmt_t *mgmt, uint64_t now)
+{
+    loci_sdwn_mgmt_slot_t *slot;
+    const uint8_t *a = mgmt->addr.addr;
+    uint64_t key;
+
+    /* Never 0, which marks a free slot */
+    key = ((uint64_t)(mgmt->type + 1) << 48) |
+        ((uint64_t)a[0] << 40) | ((uint64_t)a[1] << 32) |
+        ((uint64_t)a[2] << 24) | ((uint64_t)a[3] << 16) |
+        ((uint64_t)a[4] << 8) | a[5];
+    slot = &filter->slots[loci_hash_finish(key) & filter->mask];
+
+    if (slot->key != key || now - slot->start >= filter->window) {
+        slot->key = key;
+        slot->start = now;
+        slot->count = 1;
+    } else if (slot->count < filter->burst) {
+        slot->count++;
+    } else {
+        filter->dropped++;
+        return 0;
+    }
+    filter->passed++;
+
+    return 1;
+}
+
+/****************************************************************
+ * Dispatch and reply
+ ****************************************************************/
+
+/**
+ * Dispatch the management frames in a buffer of messages
+ * @param buf The messages
+ * @param len Length of buf
+ * @param handlers The handler of each frame type, NULL to ignore the
+ * type
+ * @param filter If not NULL, the filter frames with a handler must
+ * pass
+ * @param now The time, for the filter
+ * @param cookie Passed to the handlers
+ * @returns Number of frames handled; OF_ERROR_PARSE if a message is
+ * cut short or a management frame malformed, OF_ERROR_VERSION, or
+ * the error a handler returns
+ *
+ * Other messages are skipped.  A handler may build its reply over
+ * the message.
+ */
+int
+loci_sdwn_mgmt_dispatch(uint8_t *buf, int len,
+                        loci_sdwn_mgmt_handler_f *handlers,
+                        loci_sdwn_mgmt_filter_t *filter,
+                        uint64_t now, void *cookie)
+{
+    loci_sdwn_mgmt_t mgmt;
+    loci_sdwn_mgmt_handler_f handler;
+    int msg_len, rv, subtype, n = 0, offset = 0;
+
+    while (offset < len) {
+        if (len - offset < OF_MESSAGE_HEADER_LENGTH) {
+            return OF_ERROR_PARSE;
+        }
+        msg_len = of_message_length_get(buf + offset);
+        if (msg_len < OF_MESSAGE_HEADER_LENGTH || msg_len > len - offset) {
+            return OF_ERROR_PARSE;
+        }
+        subtype = sdwn_subtype_get(buf + offset, msg_len);
+        if (subtype == SUBTYPE_MGMT || subtype == SUBTYPE_PACKET_IN) {
+            if ((rv = loci_sdwn_mgmt_peek(buf + offset, msg_len,
+                                          &mgmt)) < 0) {
+                return rv;
+            }
+            handler = handlers[mgmt.type];
+            if (handler != NULL &&
+                (filter == NULL ||
+                 loci_sdwn_mgmt_filter_check(filter, &mgmt, now))) {
+                if ((rv = handler(cookie, &mgmt)) < 0) {
+                    return rv;
+                }
+                n++;
+            }
+        }
+        offset += msg_len;
+    }
+
+    return n;
+}
+
+/**
+ * Build an of_sdwn_ieee80211_mgmt_reply over the event it answers
+ * @param buf The of_sdwn_ieee80211_mgmt
+ * @param len Length of buf
+ * @param deny Whether the access point is to deny the client
+ * @returns Length of the reply; OF_ERROR_PARSE if buf isn't an
+ * of_sdwn_ieee80211_mgmt, or OF_ERROR_VERSION
+ *
+ * The reply keeps the header and xid of the event; the if_no moves
+ * ahead of where the reply's fields end.
+ */
+int
+loci_sdwn_mgmt_reply_build(uint8_t *buf, int len, uint8_t deny)
+{
+    of_port_no_t if_no;
+    int msg_len;
+
+    if (len < OF_MESSAGE_HEADER_LENGTH) {
+        return OF_ERROR_PARSE;
+    }
+    if (of_message_version_get(buf) != OF_VERSION_1_3) {
+        return OF_ERROR_VERSION;
+    }
+    msg_len = of_message_length_get(buf);
+    if (msg_len > len || msg_len < LOCI_SDWN_MGMT_BYTES ||
+        sdwn_subtype_get(buf, msg_len) != SUBTYPE_MGMT) {
+        return OF_ERROR_PARSE;
+    }
+
+    buf_u32_get(buf + MGMT_IF_NO_OFFSET, &if_no);
+    buf_u16_set(buf + OF_MESSAGE_LENGTH_OFFSET, LOCI_SDWN_MGMT_REPLY_BYTES);
+    buf_u32_set(buf + OF_MESSAGE_EXPERIMENTER_SUBTYPE_OFFSET,
+                SUBTYPE_MGMT_REPLY);
+    buf_u32_set(buf + REPLY_IF_NO_OFFSET, if_no);
+    /* The pad, over the event's addr */
+    MEMSET(buf + REPLY_IF_NO_OFFSET + 4, 0,
+           REPLY_DENY_OFFSET - REPLY_IF_NO_OFFSET - 4);
+    buf_u8_set(buf + REPLY_DENY_OFFSET, deny);
+
+    return LOCI_SDWN_MGMT_REPLY_BYTES;
+}
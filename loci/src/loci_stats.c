@@ -0,0 +1,164 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_stats.c
+ *
+ * Instrumentation counter storage, snapshots and display
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_stats.h>
+
+#define STATS_WORDS (sizeof(loci_stats_t) / sizeof(uint64_t))
+
+static const char *const validate_reason_names[LOCI_STATS_VALIDATE_REASON_COUNT] = {
+    "short",
+    "length",
+    "version",
+};
+
+#if defined(LOCI_STATS_ENABLE)
+
+/*
+ * Per-thread counter blocks are pushed on a list the first time a
+ * thread counts something and are never freed.
+ */
+struct stats_block {
+    struct stats_block *next;
+    loci_stats_t stats;
+};
+
+static struct stats_block *stats_blocks;
+
+__thread loci_stats_t *loci_stats_local;
+
+loci_stats_t *
+loci_stats_local_init(void)
+{
+    struct stats_block *block;
+
+    if ((block = (struct stats_block *)MALLOC(sizeof(*block))) == NULL) {
+        return NULL;
+    }
+    MEMSET(block, 0, sizeof(*block));
+
+    block->next = __atomic_load_n(&stats_blocks, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&stats_blocks, &block->next, block, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+        ;
+    }
+
+    loci_stats_local = &block->stats;
+    return loci_stats_local;
+}
+
+#endif /* LOCI_STATS_ENABLE */
+
+/**
+ * Sum the counters of all threads
+ * @param stats Filled with the totals
+ *
+ * Counts made while the snapshot is taken may or may not be included.
+ */
+
+void
+loci_stats_snapshot(loci_stats_t *stats)
+{
+    MEMSET(stats, 0, sizeof(*stats));
+
+#if defined(LOCI_STATS_ENABLE)
+    {
+        struct stats_block *block;
+        uint64_t *dst = (uint64_t *)stats;
+        const uint64_t *src;
+        int i;
+
+        for (block = __atomic_load_n(&stats_blocks, __ATOMIC_ACQUIRE);
+             block != NULL; block = block->next) {
+            src = (const uint64_t *)&block->stats;
+            for (i = 0; i < STATS_WORDS; i++) {
+                dst[i] += __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+            }
+        }
+    }
+#endif
+}
+
+/**
+ * Reset the counters of all threads
+ *
+ * Counts made concurrently by other threads may be lost.  Prefer
+ * taking the difference of two snapshots where that matters.
+ */
+
+void
+loci_stats_clear(void)
+{
+#if defined(LOCI_STATS_ENABLE)
+    struct stats_block *block;
+    uint64_t *words;
+    int i;
+
+    for (block = __atomic_load_n(&stats_blocks, __ATOMIC_ACQUIRE);
+         block != NULL; block = block->next) {
+        words = (uint64_t *)&block->stats;
+        for (i = 0; i < STATS_WORDS; i++) {
+            __atomic_store_n(&words[i], 0, __ATOMIC_RELAXED);
+        }
+    }
+#endif
+}
+
+static int
+object_active(const loci_stats_object_t *os)
+{
+    const uint64_t *words = (const uint64_t *)os;
+    int i;
+
+    for (i = 0; i < sizeof(*os) / sizeof(uint64_t); i++) {
+        if (words[i] != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Display a snapshot; only object types with a non-zero counter are
+ * listed
+ */
+
+int
+loci_stats_show(loci_writer_f writer, void *cookie, const loci_stats_t *stats)
+{
+    const loci_stats_object_t *os;
+    int out = 0;
+    int id, r;
+
+    for (id = 0; id < OF_OBJECT_COUNT; id++) {
+        os = &stats->objects[id];
+        if (!object_active(os)) {
+            continue;
+        }
+        out += writer(cookie, "%s allocs=%" PRIu64 " alloc_bytes=%" PRIu64
+                      " frees=%" PRIu64 " parses=%" PRIu64,
+                      of_object_id_str[id], os->allocs, os->alloc_bytes,
+                      os->frees, os->parses);
+        for (r = 0; r < LOCI_STATS_VALIDATE_REASON_COUNT; r++) {
+            out += writer(cookie, " validate_%s=%" PRIu64,
+                          validate_reason_names[r], os->validate_failures[r]);
+        }
+        out += writer(cookie, " list_append_failures=%" PRIu64 "\n",
+                      os->list_append_failures);
+    }
+
+    out += writer(cookie, "replace_data calls=%" PRIu64 " move_bytes=%" PRIu64 "\n",
+                  stats->replace_data_calls, stats->replace_data_move_bytes);
+
+    return out;
+}
@@ -0,0 +1,187 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_stream.c
+ *
+ * Buffered output stream for the structured serializers.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_stream.h>
+
+static const char hex_digits[] = "0123456789abcdef";
+
+/**
+ * Initialize a stream over a caller supplied buffer
+ * @param s The stream
+ * @param buf The output buffer
+ * @param size Capacity of buf
+ * @param flush Optional function to drain buf when it fills
+ * @param cookie Passed to flush
+ */
+
+void
+loci_stream_init(loci_stream_t *s, uint8_t *buf, int size,
+                 loci_stream_flush_f flush, void *cookie)
+{
+    s->buf = buf;
+    s->size = size;
+    s->pos = 0;
+    s->total = 0;
+    s->hold = -1;
+    s->error = OF_ERROR_NONE;
+    s->flush = flush;
+    s->cookie = cookie;
+}
+
+/**
+ * Make room for 'bytes' more bytes in the stream buffer
+ * @returns OF_ERROR_NONE or the (latched) stream error
+ *
+ * Flushes everything before the hold offset.  Held bytes are moved
+ * to the start of the buffer so the caller can still patch them.
+ */
+
+int
+loci_stream_make_room(loci_stream_t *s, int bytes)
+{
+    int keep_from;
+    int rv;
+
+    if (s->error != OF_ERROR_NONE) {
+        return s->error;
+    }
+
+    if (s->flush != NULL) {
+        keep_from = (s->hold >= 0) ? s->hold : s->pos;
+        if (keep_from > 0) {
+            if ((rv = s->flush(s->cookie, s->buf, keep_from)) < 0) {
+                s->error = rv;
+                return rv;
+            }
+            s->total += keep_from;
+            MEMMOVE(s->buf, s->buf + keep_from, s->pos - keep_from);
+            s->pos -= keep_from;
+            if (s->hold >= 0) {
+                s->hold = 0;
+            }
+        }
+        if (s->size - s->pos >= bytes) {
+            return OF_ERROR_NONE;
+        }
+    }
+
+    s->error = OF_ERROR_RESOURCE;
+    return s->error;
+}
+
+/**
+ * Write path for data that does not fit in the remaining buffer
+ */
+
+void
+loci_stream_write_slow(loci_stream_t *s, const void *data, int len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    int n;
+
+    while (len > 0 && s->error == OF_ERROR_NONE) {
+        if (s->pos == s->size && loci_stream_make_room(s, 1) < 0) {
+            return;
+        }
+        n = s->size - s->pos;
+        if (n > len) {
+            n = len;
+        }
+        MEMCPY(s->buf + s->pos, src, n);
+        s->pos += n;
+        src += n;
+        len -= n;
+    }
+}
+
+/**
+ * Flush any pending output
+ * @returns Total bytes written to the stream or a negative error code
+ */
+
+int
+loci_stream_finish(loci_stream_t *s)
+{
+    int rv;
+
+    if (s->error != OF_ERROR_NONE) {
+        return s->error;
+    }
+
+    if (s->flush != NULL && s->pos > 0) {
+        if ((rv = s->flush(s->cookie, s->buf, s->pos)) < 0) {
+            s->error = rv;
+            return rv;
+        }
+        s->total += s->pos;
+        s->pos = 0;
+    }
+
+    return LOCI_STREAM_LENGTH(s);
+}
+
+/**
+ * Write an unsigned integer in decimal
+ */
+
+void
+loci_stream_dec(loci_stream_t *s, uint64_t val)
+{
+    char tmp[20];
+    uint8_t *out;
+    int i = sizeof(tmp);
+
+    do {
+        tmp[--i] = '0' + (val % 10);
+        val /= 10;
+    } while (val != 0);
+
+    if ((out = loci_stream_reserve(s, sizeof(tmp) - i)) == NULL) {
+        return;
+    }
+    MEMCPY(out, tmp + i, sizeof(tmp) - i);
+    loci_stream_advance(s, sizeof(tmp) - i);
+}
+
+/**
+ * Write bytes as lower case hex digits, two per byte
+ */
+
+void
+loci_stream_hex(loci_stream_t *s, const uint8_t *data, int len)
+{
+    uint8_t *out;
+    int i, n;
+
+    while (len > 0 && s->error == OF_ERROR_NONE) {
+        n = (s->size - s->pos) / 2;
+        if (n == 0) {
+            if (loci_stream_make_room(s, 2) < 0) {
+                return;
+            }
+            continue;
+        }
+        if (n > len) {
+            n = len;
+        }
+        out = s->buf + s->pos;
+        for (i = 0; i < n; i++) {
+            out[2 * i] = hex_digits[data[i] >> 4];
+            out[2 * i + 1] = hex_digits[data[i] & 0xf];
+        }
+        s->pos += 2 * n;
+        data += n;
+        len -= n;
+    }
+}
@@ -0,0 +1,335 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_template.c
+ *
+ * Message templates: field discovery by probing.
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_template.h>
+#include <loci/loci_match_fields.h>
+
+#define PROBE_BYTES_MAX OF_IPV6_BYTES
+
+typedef enum probe_kind_e {
+    PROBE_U8,
+    PROBE_U16,
+    PROBE_U32,
+    PROBE_U64,
+    PROBE_MAC,
+    PROBE_IPV6,
+    PROBE_MATCH,
+} probe_kind_t;
+
+typedef struct probe_s {
+    probe_kind_t kind;
+    of_object_t *obj;
+    union {
+        loci_template_u8_set_f u8;
+        loci_template_u16_set_f u16;
+        loci_template_u32_set_f u32;
+        loci_template_u64_set_f u64;
+        loci_template_mac_set_f mac;
+        loci_template_ipv6_set_f ipv6;
+        loci_template_match_set_f match;
+    } set;
+    /* PROBE_MATCH */
+    const of_match_t *match;
+    const loci_match_field_t *field;
+} probe_t;
+
+/* Big-endian bytes to an integer */
+static uint64_t
+be_value(const uint8_t *val, int width)
+{
+    uint64_t v = 0;
+    int i;
+
+    for (i = 0; i < width; i++) {
+        v = (v << 8) | val[i];
+    }
+    return v;
+}
+
+/* Store an integer in host order in a field of of_match_fields_t */
+static void
+match_value_set(uint8_t *dst, int size, uint64_t v)
+{
+    uint8_t u8 = v;
+    uint16_t u16 = v;
+    uint32_t u32 = v;
+
+    switch (size) {
+    case 1:
+        MEMCPY(dst, &u8, 1);
+        break;
+    case 2:
+        MEMCPY(dst, &u16, 2);
+        break;
+    case 4:
+        MEMCPY(dst, &u32, 4);
+        break;
+    default:
+        MEMCPY(dst, &v, 8);
+        break;
+    }
+}
+
+/**
+ * Set the probed field to the big-endian value val
+ */
+static int
+probe_apply(loci_template_t *t, probe_t *p, const uint8_t *val, int width)
+{
+    of_mac_addr_t mac;
+    of_ipv6_t ipv6;
+    of_match_t match;
+
+    switch (p->kind) {
+    case PROBE_U8:
+        p->set.u8(p->obj, be_value(val, width));
+        break;
+    case PROBE_U16:
+        p->set.u16(p->obj, be_value(val, width));
+        break;
+    case PROBE_U32:
+        p->set.u32(p->obj, be_value(val, width));
+        break;
+    case PROBE_U64:
+        p->set.u64(p->obj, be_value(val, width));
+        break;
+    case PROBE_MAC:
+        MEMCPY(mac.addr, val, OF_MAC_ADDR_BYTES);
+        p->set.mac(p->obj, mac);
+        break;
+    case PROBE_IPV6:
+        MEMCPY(ipv6.addr, val, OF_IPV6_BYTES);
+        p->set.ipv6(p->obj, ipv6);
+        break;
+    case PROBE_MATCH:
+        match = *p->match;
+        if (p->field->kind == LOCI_MATCH_FIELD_MAC ||
+            p->field->kind == LOCI_MATCH_FIELD_IPV6) {
+            MEMCPY(LOCI_MATCH_FIELD_VALUE(&match, p->field), val, width);
+        } else {
+            match_value_set(LOCI_MATCH_FIELD_VALUE(&match, p->field),
+                            p->field->size, be_value(val, width));
+        }
+        return p->set.match(t->msg, &match);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/* Put the message back as it was when the template was made */
+static void
+probe_restore(loci_template_t *t, probe_t *p)
+{
+    if (p->kind == PROBE_MATCH && t->msg->length != t->length) {
+        of_match_t match = *p->match;
+
+        (void)p->set.match(t->msg, &match);
+    }
+    if (t->msg->length == t->length) {
+        MEMCPY(OF_OBJECT_BUFFER_INDEX(t->msg, 0), t->image, t->length);
+    }
+}
+
+/**
+ * Find the field a probe sets and add it to the template
+ * @param width Size of the value set, in bytes
+ * @param exact Whether the wire field must be as wide as the value;
+ * otherwise it may hold only its low order bytes
+ * @returns Index of the field or a negative error code
+ */
+static int
+field_probe(loci_template_t *t, probe_t *p, int width, int exact)
+{
+    uint8_t a[PROBE_BYTES_MAX], b[PROBE_BYTES_MAX];
+    uint8_t *buf, *scratch;
+    loci_template_field_t *f;
+    int i, lo, hi, wire, rv = OF_ERROR_PARAM;
+
+    if (t->msg == NULL || t->field_count == LOCI_TEMPLATE_FIELDS_MAX) {
+        return OF_ERROR_RESOURCE;
+    }
+    if (p->obj != NULL && p->obj->wbuf != t->msg->wbuf) {
+        return OF_ERROR_PARAM;
+    }
+    if ((scratch = MALLOC(t->length)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+
+    /* Every byte differs between the values, and within each */
+    for (i = 0; i < width; i++) {
+        a[i] = 0x10 + i;
+        b[i] = 0xa0 + i;
+    }
+
+    if (probe_apply(t, p, a, width) < 0 || t->msg->length != t->length) {
+        goto out;
+    }
+    MEMCPY(scratch, OF_OBJECT_BUFFER_INDEX(t->msg, 0), t->length);
+    if (probe_apply(t, p, b, width) < 0 || t->msg->length != t->length) {
+        goto out;
+    }
+    buf = OF_OBJECT_BUFFER_INDEX(t->msg, 0);
+
+    for (lo = 0; lo < t->length && scratch[lo] == buf[lo]; lo++);
+    for (hi = t->length - 1; hi >= lo && scratch[hi] == buf[hi]; hi--);
+    wire = hi - lo + 1;
+    if (wire <= 0 || wire > width || (exact && wire != width) ||
+        (!exact && wire != 1 && wire != 2 && wire != 4 && wire != 8)) {
+        goto out;
+    }
+    /* The wire holds the value, or its low order bytes */
+    if (MEMCMP(scratch + lo, a + width - wire, wire) != 0 ||
+        MEMCMP(buf + lo, b + width - wire, wire) != 0) {
+        goto out;
+    }
+
+    f = &t->fields[t->field_count];
+    f->offset = lo;
+    f->width = wire;
+    f->pad = 0;
+    rv = t->field_count++;
+
+out:
+    probe_restore(t, p);
+    FREE(scratch);
+    return rv;
+}
+
+/**
+ * Make a template from a message
+ * @param t The template
+ * @param msg A top level message
+ *
+ * msg must stay alive and unchanged while fields are added.
+ */
+int
+loci_template_init(loci_template_t *t, of_object_t *msg)
+{
+    MEMSET(t, 0, sizeof(*t));
+
+    if (msg->parent != NULL || msg->wbuf == NULL || msg->length <= 0) {
+        return OF_ERROR_PARAM;
+    }
+    if ((t->image = MALLOC(msg->length)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    MEMCPY(t->image, OF_OBJECT_BUFFER_INDEX(msg, 0), msg->length);
+    t->msg = msg;
+    t->object_id = msg->object_id;
+    t->version = msg->version;
+    t->length = msg->length;
+
+    return OF_ERROR_NONE;
+}
+
+void
+loci_template_cleanup(loci_template_t *t)
+{
+    FREE(t->image);
+    MEMSET(t, 0, sizeof(*t));
+}
+
+int
+loci_template_field_u8(loci_template_t *t, of_object_t *obj,
+                       loci_template_u8_set_f set)
+{
+    probe_t p = { .kind = PROBE_U8, .obj = obj, .set.u8 = set };
+
+    return field_probe(t, &p, 1, 1);
+}
+
+int
+loci_template_field_u16(loci_template_t *t, of_object_t *obj,
+                        loci_template_u16_set_f set)
+{
+    probe_t p = { .kind = PROBE_U16, .obj = obj, .set.u16 = set };
+
+    return field_probe(t, &p, 2, 0);
+}
+
+int
+loci_template_field_u32(loci_template_t *t, of_object_t *obj,
+                        loci_template_u32_set_f set)
+{
+    probe_t p = { .kind = PROBE_U32, .obj = obj, .set.u32 = set };
+
+    return field_probe(t, &p, 4, 0);
+}
+
+int
+loci_template_field_u64(loci_template_t *t, of_object_t *obj,
+                        loci_template_u64_set_f set)
+{
+    probe_t p = { .kind = PROBE_U64, .obj = obj, .set.u64 = set };
+
+    return field_probe(t, &p, 8, 0);
+}
+
+int
+loci_template_field_mac(loci_template_t *t, of_object_t *obj,
+                        loci_template_mac_set_f set)
+{
+    probe_t p = { .kind = PROBE_MAC, .obj = obj, .set.mac = set };
+
+    return field_probe(t, &p, OF_MAC_ADDR_BYTES, 1);
+}
+
+int
+loci_template_field_ipv6(loci_template_t *t, of_object_t *obj,
+                         loci_template_ipv6_set_f set)
+{
+    probe_t p = { .kind = PROBE_IPV6, .obj = obj, .set.ipv6 = set };
+
+    return field_probe(t, &p, OF_IPV6_BYTES, 1);
+}
+
+int
+loci_template_field_match(loci_template_t *t, loci_template_match_set_f set,
+                          const of_match_t *match, const char *name)
+{
+    const loci_match_field_t *field;
+    probe_t p = { .kind = PROBE_MATCH, .set.match = set, .match = match };
+    const uint8_t *mask;
+    int i, exact;
+
+    field = loci_match_field_lookup(name, strlen(name));
+    if (field == NULL) {
+        return OF_ERROR_PARAM;
+    }
+    switch (field->kind) {
+    case LOCI_MATCH_FIELD_U8:
+    case LOCI_MATCH_FIELD_U16:
+    case LOCI_MATCH_FIELD_U32:
+    case LOCI_MATCH_FIELD_U64:
+    case LOCI_MATCH_FIELD_IPV4:
+        exact = 0;
+        break;
+    case LOCI_MATCH_FIELD_MAC:
+    case LOCI_MATCH_FIELD_IPV6:
+        exact = 1;
+        break;
+    default:
+        return OF_ERROR_PARAM;
+    }
+
+    mask = LOCI_MATCH_FIELD_MASK(match, field);
+    for (i = 0; i < field->size; i++) {
+        if (mask[i] != 0xff) {
+            return OF_ERROR_PARAM;
+        }
+    }
+
+    p.field = field;
+    return field_probe(t, &p, field->size, exact);
+}
@@ -0,0 +1,56 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * loci_trace.c
+ *
+ * Static tracepoint semaphores and argument helpers
+ *
+ ****************************************************************/
+
+#include <loci/loci.h>
+#include <loci/loci_trace.h>
+
+#if defined(LOCI_TRACE_ENABLE)
+
+/*
+ * Tracers increment a probe's semaphore while attached to it.  The
+ * semaphores must live in the .probes section to be found.
+ */
+#define LOCI_TRACE_DEFINE(probe)                                        \
+    volatile unsigned short LOCI_TRACE_SEMAPHORE(probe)                 \
+    __attribute__((unused, section(".probes")))
+
+LOCI_TRACE_DEFINE(new_from_message);
+LOCI_TRACE_DEFINE(object_new);
+LOCI_TRACE_DEFINE(object_delete);
+LOCI_TRACE_DEFINE(validate_fail);
+LOCI_TRACE_DEFINE(validate_message_fail);
+LOCI_TRACE_DEFINE(replace_data);
+LOCI_TRACE_DEFINE(match_serialize);
+
+/**
+ * The xid of a message object, or 0 if the object is not a message or
+ * has no wire buffer
+ */
+
+uint32_t
+loci_trace_xid(of_object_t *obj)
+{
+    uint32_t xid;
+
+    if (obj->object_id == OF_OBJECT ||
+        obj->object_id >= OF_MESSAGE_OBJECT_COUNT ||
+        obj->length < OF_MESSAGE_MIN_LENGTH ||
+        obj->wbuf == NULL || obj->wbuf->buf == NULL) {
+        return 0;
+    }
+
+    of_object_xid_get(obj, &xid);
+    return xid;
+}
+
+#endif /* LOCI_TRACE_ENABLE */
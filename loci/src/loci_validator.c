@@ -14,9 +14,17 @@
 #include "loci_log.h"
 #include <loci/loci.h>
 #include <loci/loci_validator.h>
+#include <loci/loci_stats.h>
+#include <loci/loci_trace.h>
 
 #define VALIDATOR_LOG(...) LOCI_LOG_ERROR("Validator Error: " __VA_ARGS__)
 
+#define VALIDATOR_FAIL(object_id, reason) do {                          \
+        LOCI_STATS_VALIDATE_FAILURE(object_id, LOCI_STATS_VALIDATE_##reason); \
+        LOCI_TRACE(validate_fail, object_id, LOCI_STATS_VALIDATE_##reason, len); \
+        return -1;                                                      \
+    } while (0)
+
 
 /* Forward declarations */
 static int __attribute__((unused)) loci_validate_of_action_OF_VERSION_1_0(uint8_t *data, int len, int *out_len);
@@ -2263,14 +2271,14 @@ static int
 loci_validate_of_action_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, LENGTH);
     }
 
     len = wire_len;
@@ -2316,14 +2324,14 @@ static int
 loci_validate_of_action_experimenter_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -2347,14 +2355,14 @@ static int
 loci_validate_of_action_bsn_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -2380,7 +2388,7 @@ static int
 loci_validate_of_action_bsn_checksum_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, SHORT);
     }
 
     len = 28;
@@ -2388,7 +2396,7 @@ loci_validate_of_action_bsn_checksum_OF_VERSION_1_0(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, LENGTH);
     }
 
 
@@ -2402,7 +2410,7 @@ static int
 loci_validate_of_action_bsn_mirror_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, SHORT);
     }
 
     len = 24;
@@ -2410,7 +2418,7 @@ loci_validate_of_action_bsn_mirror_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, LENGTH);
     }
 
 
@@ -2424,7 +2432,7 @@ static int
 loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, SHORT);
     }
 
     len = 16;
@@ -2432,7 +2440,7 @@ loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_0(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, LENGTH);
     }
 
 
@@ -2446,7 +2454,7 @@ static int
 loci_validate_of_action_enqueue_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ENQUEUE, SHORT);
     }
 
     len = 16;
@@ -2454,7 +2462,7 @@ loci_validate_of_action_enqueue_OF_VERSION_1_0(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ENQUEUE, LENGTH);
     }
 
 
@@ -2468,14 +2476,14 @@ static int
 loci_validate_of_action_nicira_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, LENGTH);
     }
 
     len = wire_len;
@@ -2507,7 +2515,7 @@ static int
 loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, SHORT);
     }
 
     len = 16;
@@ -2515,7 +2523,7 @@ loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_0(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, LENGTH);
     }
 
 
@@ -2529,7 +2537,7 @@ static int
 loci_validate_of_action_nicira_move_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, SHORT);
     }
 
     len = 24;
@@ -2537,7 +2545,7 @@ loci_validate_of_action_nicira_move_OF_VERSION_1_0(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, LENGTH);
     }
 
 
@@ -2551,7 +2559,7 @@ static int
 loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, SHORT);
     }
 
     len = 16;
@@ -2559,7 +2567,7 @@ loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_0(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, LENGTH);
     }
 
 
@@ -2573,7 +2581,7 @@ static int
 loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, SHORT);
     }
 
     len = 16;
@@ -2581,7 +2589,7 @@ loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_0(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, LENGTH);
     }
 
 
@@ -2595,7 +2603,7 @@ static int
 loci_validate_of_action_nicira_resubmit_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, SHORT);
     }
 
     len = 16;
@@ -2603,7 +2611,7 @@ loci_validate_of_action_nicira_resubmit_OF_VERSION_1_0(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, LENGTH);
     }
 
 
@@ -2617,7 +2625,7 @@ static int
 loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, SHORT);
     }
 
     len = 16;
@@ -2625,7 +2633,7 @@ loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_0(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, LENGTH);
     }
 
 
@@ -2639,7 +2647,7 @@ static int
 loci_validate_of_action_output_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, SHORT);
     }
 
     len = 8;
@@ -2647,7 +2655,7 @@ loci_validate_of_action_output_OF_VERSION_1_0(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, LENGTH);
     }
 
 
@@ -2661,7 +2669,7 @@ static int
 loci_validate_of_action_set_dl_dst_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_DST, SHORT);
     }
 
     len = 16;
@@ -2669,7 +2677,7 @@ loci_validate_of_action_set_dl_dst_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_DST, LENGTH);
     }
 
 
@@ -2683,7 +2691,7 @@ static int
 loci_validate_of_action_set_dl_src_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_SRC, SHORT);
     }
 
     len = 16;
@@ -2691,7 +2699,7 @@ loci_validate_of_action_set_dl_src_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_SRC, LENGTH);
     }
 
 
@@ -2705,7 +2713,7 @@ static int
 loci_validate_of_action_set_nw_dst_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_DST, SHORT);
     }
 
     len = 8;
@@ -2713,7 +2721,7 @@ loci_validate_of_action_set_nw_dst_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_DST, LENGTH);
     }
 
 
@@ -2727,7 +2735,7 @@ static int
 loci_validate_of_action_set_nw_src_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_SRC, SHORT);
     }
 
     len = 8;
@@ -2735,7 +2743,7 @@ loci_validate_of_action_set_nw_src_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_SRC, LENGTH);
     }
 
 
@@ -2749,7 +2757,7 @@ static int
 loci_validate_of_action_set_nw_tos_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TOS, SHORT);
     }
 
     len = 8;
@@ -2757,7 +2765,7 @@ loci_validate_of_action_set_nw_tos_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TOS, LENGTH);
     }
 
 
@@ -2771,7 +2779,7 @@ static int
 loci_validate_of_action_set_tp_dst_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_DST, SHORT);
     }
 
     len = 8;
@@ -2779,7 +2787,7 @@ loci_validate_of_action_set_tp_dst_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_DST, LENGTH);
     }
 
 
@@ -2793,7 +2801,7 @@ static int
 loci_validate_of_action_set_tp_src_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_SRC, SHORT);
     }
 
     len = 8;
@@ -2801,7 +2809,7 @@ loci_validate_of_action_set_tp_src_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_SRC, LENGTH);
     }
 
 
@@ -2815,7 +2823,7 @@ static int
 loci_validate_of_action_set_vlan_pcp_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_PCP, SHORT);
     }
 
     len = 8;
@@ -2823,7 +2831,7 @@ loci_validate_of_action_set_vlan_pcp_OF_VERSION_1_0(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_PCP, LENGTH);
     }
 
 
@@ -2837,7 +2845,7 @@ static int
 loci_validate_of_action_set_vlan_vid_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_VID, SHORT);
     }
 
     len = 8;
@@ -2845,7 +2853,7 @@ loci_validate_of_action_set_vlan_vid_OF_VERSION_1_0(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_VID, LENGTH);
     }
 
 
@@ -2859,7 +2867,7 @@ static int
 loci_validate_of_action_strip_vlan_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_STRIP_VLAN, SHORT);
     }
 
     len = 8;
@@ -2867,7 +2875,7 @@ loci_validate_of_action_strip_vlan_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_STRIP_VLAN, LENGTH);
     }
 
 
@@ -2881,14 +2889,14 @@ static int
 loci_validate_of_header_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -2954,14 +2962,14 @@ static int
 loci_validate_of_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -2995,7 +3003,7 @@ static int
 loci_validate_of_aggregate_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, SHORT);
     }
 
     len = 36;
@@ -3003,7 +3011,7 @@ loci_validate_of_aggregate_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, LENGTH);
     }
 
 
@@ -3017,14 +3025,14 @@ static int
 loci_validate_of_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -3058,7 +3066,7 @@ static int
 loci_validate_of_aggregate_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, SHORT);
     }
 
     len = 56;
@@ -3066,7 +3074,7 @@ loci_validate_of_aggregate_stats_request_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -3081,14 +3089,14 @@ static int
 loci_validate_of_error_msg_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -3120,14 +3128,14 @@ static int
 loci_validate_of_bad_action_error_msg_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -3143,14 +3151,14 @@ static int
 loci_validate_of_bad_request_error_msg_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -3166,7 +3174,7 @@ static int
 loci_validate_of_barrier_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, SHORT);
     }
 
     len = 8;
@@ -3174,7 +3182,7 @@ loci_validate_of_barrier_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, LENGTH);
     }
 
 
@@ -3188,7 +3196,7 @@ static int
 loci_validate_of_barrier_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, SHORT);
     }
 
     len = 8;
@@ -3196,7 +3204,7 @@ loci_validate_of_barrier_request_OF_VERSION_1_0(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, LENGTH);
     }
 
 
@@ -3210,14 +3218,14 @@ static int
 loci_validate_of_experimenter_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -3241,14 +3249,14 @@ static int
 loci_validate_of_bsn_header_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -3336,7 +3344,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, SHORT);
     }
 
     len = 20;
@@ -3344,7 +3352,7 @@ loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, LENGTH);
     }
 
 
@@ -3358,7 +3366,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, SHORT);
     }
 
     len = 16;
@@ -3366,7 +3374,7 @@ loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_0(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, LENGTH);
     }
 
 
@@ -3380,7 +3388,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, SHORT);
     }
 
     len = 20;
@@ -3388,7 +3396,7 @@ loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, LENGTH);
     }
 
 
@@ -3402,7 +3410,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -3410,7 +3418,7 @@ loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_0(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, LENGTH);
     }
 
 
@@ -3424,7 +3432,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, SHORT);
     }
 
     len = 24;
@@ -3432,7 +3440,7 @@ loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, LENGTH);
     }
 
 
@@ -3446,7 +3454,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, SHORT);
     }
 
     len = 20;
@@ -3454,7 +3462,7 @@ loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_0(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, LENGTH);
     }
 
 
@@ -3468,14 +3476,14 @@ static int
 loci_validate_of_bsn_get_interfaces_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -3496,7 +3504,7 @@ static int
 loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, SHORT);
     }
 
     len = 16;
@@ -3504,7 +3512,7 @@ loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_0(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, LENGTH);
     }
 
 
@@ -3518,7 +3526,7 @@ static int
 loci_validate_of_bsn_get_ip_mask_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_IP_MASK_REPLY, SHORT);
     }
 
     len = 24;
@@ -3526,7 +3534,7 @@ loci_validate_of_bsn_get_ip_mask_reply_OF_VERSION_1_0(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_IP_MASK_REPLY, LENGTH);
     }
 
 
@@ -3540,7 +3548,7 @@ static int
 loci_validate_of_bsn_get_ip_mask_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_IP_MASK_REQUEST, SHORT);
     }
 
     len = 24;
@@ -3548,7 +3556,7 @@ loci_validate_of_bsn_get_ip_mask_request_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_IP_MASK_REQUEST, LENGTH);
     }
 
 
@@ -3562,7 +3570,7 @@ static int
 loci_validate_of_bsn_get_l2_table_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_L2_TABLE_REPLY, SHORT);
     }
 
     len = 24;
@@ -3570,7 +3578,7 @@ loci_validate_of_bsn_get_l2_table_reply_OF_VERSION_1_0(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_L2_TABLE_REPLY, LENGTH);
     }
 
 
@@ -3584,7 +3592,7 @@ static int
 loci_validate_of_bsn_get_l2_table_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_L2_TABLE_REQUEST, SHORT);
     }
 
     len = 16;
@@ -3592,7 +3600,7 @@ loci_validate_of_bsn_get_l2_table_request_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_L2_TABLE_REQUEST, LENGTH);
     }
 
 
@@ -3606,7 +3614,7 @@ static int
 loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, SHORT);
     }
 
     len = 20;
@@ -3614,7 +3622,7 @@ loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, LENGTH);
     }
 
 
@@ -3628,7 +3636,7 @@ static int
 loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, SHORT);
     }
 
     len = 20;
@@ -3636,7 +3644,7 @@ loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_0(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, LENGTH);
     }
 
 
@@ -3650,7 +3658,7 @@ static int
 loci_validate_of_bsn_hybrid_get_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HYBRID_GET_REPLY, SHORT);
     }
 
     len = 24;
@@ -3658,7 +3666,7 @@ loci_validate_of_bsn_hybrid_get_reply_OF_VERSION_1_0(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HYBRID_GET_REPLY, LENGTH);
     }
 
 
@@ -3672,7 +3680,7 @@ static int
 loci_validate_of_bsn_hybrid_get_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HYBRID_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -3680,7 +3688,7 @@ loci_validate_of_bsn_hybrid_get_request_OF_VERSION_1_0(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HYBRID_GET_REQUEST, LENGTH);
     }
 
 
@@ -3694,7 +3702,7 @@ static int
 loci_validate_of_bsn_interface_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_INTERFACE, SHORT);
     }
 
     len = 32;
@@ -3710,7 +3718,7 @@ static int
 loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 23) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, SHORT);
     }
 
     len = 23;
@@ -3718,7 +3726,7 @@ loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_0(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 23) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, LENGTH);
     }
 
 
@@ -3732,14 +3740,14 @@ static int
 loci_validate_of_bsn_pdu_rx_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -3755,7 +3763,7 @@ static int
 loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 19) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, SHORT);
     }
 
     len = 19;
@@ -3763,7 +3771,7 @@ loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_0(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 19) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, LENGTH);
     }
 
 
@@ -3777,7 +3785,7 @@ static int
 loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 23) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, SHORT);
     }
 
     len = 23;
@@ -3785,7 +3793,7 @@ loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_0(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 23) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, LENGTH);
     }
 
 
@@ -3799,14 +3807,14 @@ static int
 loci_validate_of_bsn_pdu_tx_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -3822,7 +3830,7 @@ static int
 loci_validate_of_bsn_set_ip_mask_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_IP_MASK, SHORT);
     }
 
     len = 24;
@@ -3830,7 +3838,7 @@ loci_validate_of_bsn_set_ip_mask_OF_VERSION_1_0(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_IP_MASK, LENGTH);
     }
 
 
@@ -3844,7 +3852,7 @@ static int
 loci_validate_of_bsn_set_l2_table_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_L2_TABLE_REPLY, SHORT);
     }
 
     len = 24;
@@ -3852,7 +3860,7 @@ loci_validate_of_bsn_set_l2_table_reply_OF_VERSION_1_0(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_L2_TABLE_REPLY, LENGTH);
     }
 
 
@@ -3866,7 +3874,7 @@ static int
 loci_validate_of_bsn_set_l2_table_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_L2_TABLE_REQUEST, SHORT);
     }
 
     len = 24;
@@ -3874,7 +3882,7 @@ loci_validate_of_bsn_set_l2_table_request_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_L2_TABLE_REQUEST, LENGTH);
     }
 
 
@@ -3888,7 +3896,7 @@ static int
 loci_validate_of_bsn_set_mirroring_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, SHORT);
     }
 
     len = 20;
@@ -3896,7 +3904,7 @@ loci_validate_of_bsn_set_mirroring_OF_VERSION_1_0(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, LENGTH);
     }
 
 
@@ -3910,7 +3918,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, SHORT);
     }
 
     len = 20;
@@ -3918,7 +3926,7 @@ loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_0(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, LENGTH);
     }
 
 
@@ -3932,7 +3940,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, SHORT);
     }
 
     len = 32;
@@ -3940,7 +3948,7 @@ loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_0(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, LENGTH);
     }
 
 
@@ -3954,14 +3962,14 @@ static int
 loci_validate_of_bsn_shell_command_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SHELL_COMMAND, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SHELL_COMMAND, LENGTH);
     }
 
     len = wire_len;
@@ -3977,14 +3985,14 @@ static int
 loci_validate_of_bsn_shell_output_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SHELL_OUTPUT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SHELL_OUTPUT, LENGTH);
     }
 
     len = wire_len;
@@ -4000,7 +4008,7 @@ static int
 loci_validate_of_bsn_shell_status_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SHELL_STATUS, SHORT);
     }
 
     len = 20;
@@ -4008,7 +4016,7 @@ loci_validate_of_bsn_shell_status_OF_VERSION_1_0(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SHELL_STATUS, LENGTH);
     }
 
 
@@ -4022,14 +4030,14 @@ static int
 loci_validate_of_experimenter_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -4051,14 +4059,14 @@ static int
 loci_validate_of_bsn_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -4078,14 +4086,14 @@ static int
 loci_validate_of_experimenter_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -4107,14 +4115,14 @@ static int
 loci_validate_of_bsn_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -4134,7 +4142,7 @@ static int
 loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, SHORT);
     }
 
     len = 24;
@@ -4142,7 +4150,7 @@ loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_0(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, LENGTH);
     }
 
 
@@ -4156,14 +4164,14 @@ static int
 loci_validate_of_bsn_vport_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, LENGTH);
     }
 
     len = wire_len;
@@ -4187,14 +4195,14 @@ static int
 loci_validate_of_bsn_virtual_port_create_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -4211,7 +4219,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, SHORT);
     }
 
     len = 20;
@@ -4219,7 +4227,7 @@ loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_0(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, LENGTH);
     }
 
 
@@ -4233,7 +4241,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, SHORT);
     }
 
     len = 20;
@@ -4241,7 +4249,7 @@ loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_0(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, LENGTH);
     }
 
 
@@ -4255,7 +4263,7 @@ static int
 loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, SHORT);
     }
 
     len = 60;
@@ -4263,7 +4271,7 @@ loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_0(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, LENGTH);
     }
 
 
@@ -4277,7 +4285,7 @@ static int
 loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, SHORT);
     }
 
     len = 32;
@@ -4285,7 +4293,7 @@ loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_0(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, LENGTH);
     }
 
 
@@ -4299,7 +4307,7 @@ static int
 loci_validate_of_desc_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 1068) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, SHORT);
     }
 
     len = 1068;
@@ -4307,7 +4315,7 @@ loci_validate_of_desc_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 1068) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, LENGTH);
     }
 
 
@@ -4321,7 +4329,7 @@ static int
 loci_validate_of_desc_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 12;
@@ -4329,7 +4337,7 @@ loci_validate_of_desc_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -4343,14 +4351,14 @@ static int
 loci_validate_of_echo_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -4366,14 +4374,14 @@ static int
 loci_validate_of_echo_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -4389,14 +4397,14 @@ static int
 loci_validate_of_features_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -4417,7 +4425,7 @@ static int
 loci_validate_of_features_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, SHORT);
     }
 
     len = 8;
@@ -4425,7 +4433,7 @@ loci_validate_of_features_request_OF_VERSION_1_0(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, LENGTH);
     }
 
 
@@ -4439,14 +4447,14 @@ static int
 loci_validate_of_flow_mod_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -4482,14 +4490,14 @@ static int
 loci_validate_of_flow_add_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -4511,14 +4519,14 @@ static int
 loci_validate_of_flow_delete_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -4540,14 +4548,14 @@ static int
 loci_validate_of_flow_delete_strict_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -4569,14 +4577,14 @@ static int
 loci_validate_of_flow_mod_failed_error_msg_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -4592,14 +4600,14 @@ static int
 loci_validate_of_flow_modify_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -4621,14 +4629,14 @@ static int
 loci_validate_of_flow_modify_strict_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -4650,7 +4658,7 @@ static int
 loci_validate_of_flow_removed_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, SHORT);
     }
 
     len = 88;
@@ -4658,7 +4666,7 @@ loci_validate_of_flow_removed_OF_VERSION_1_0(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, LENGTH);
     }
 
 
@@ -4673,14 +4681,14 @@ static int
 loci_validate_of_flow_stats_entry_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -4702,14 +4710,14 @@ static int
 loci_validate_of_flow_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -4730,7 +4738,7 @@ static int
 loci_validate_of_flow_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, SHORT);
     }
 
     len = 56;
@@ -4738,7 +4746,7 @@ loci_validate_of_flow_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, LENGTH);
     }
 
 
@@ -4753,7 +4761,7 @@ static int
 loci_validate_of_get_config_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, SHORT);
     }
 
     len = 12;
@@ -4761,7 +4769,7 @@ loci_validate_of_get_config_reply_OF_VERSION_1_0(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, LENGTH);
     }
 
 
@@ -4775,7 +4783,7 @@ static int
 loci_validate_of_get_config_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 8;
@@ -4783,7 +4791,7 @@ loci_validate_of_get_config_request_OF_VERSION_1_0(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -4797,7 +4805,7 @@ static int
 loci_validate_of_hello_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, SHORT);
     }
 
     len = 8;
@@ -4805,7 +4813,7 @@ loci_validate_of_hello_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, LENGTH);
     }
 
 
@@ -4819,14 +4827,14 @@ static int
 loci_validate_of_hello_failed_error_msg_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -4842,7 +4850,7 @@ static int
 loci_validate_of_match_v1_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V1, SHORT);
     }
 
     len = 40;
@@ -4858,14 +4866,14 @@ static int
 loci_validate_of_nicira_header_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -4889,7 +4897,7 @@ static int
 loci_validate_of_nicira_controller_role_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_CONTROLLER_ROLE_REPLY, SHORT);
     }
 
     len = 20;
@@ -4897,7 +4905,7 @@ loci_validate_of_nicira_controller_role_reply_OF_VERSION_1_0(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_CONTROLLER_ROLE_REPLY, LENGTH);
     }
 
 
@@ -4911,7 +4919,7 @@ static int
 loci_validate_of_nicira_controller_role_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_CONTROLLER_ROLE_REQUEST, SHORT);
     }
 
     len = 20;
@@ -4919,7 +4927,7 @@ loci_validate_of_nicira_controller_role_request_OF_VERSION_1_0(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_CONTROLLER_ROLE_REQUEST, LENGTH);
     }
 
 
@@ -4933,14 +4941,14 @@ static int
 loci_validate_of_packet_in_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, LENGTH);
     }
 
     len = wire_len;
@@ -4956,14 +4964,14 @@ static int
 loci_validate_of_packet_out_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     len = wire_len;
@@ -4974,7 +4982,7 @@ loci_validate_of_packet_out_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 
 
     if (16 + wire_len_actions > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     if (loci_validate_of_list_action_OF_VERSION_1_0(data + 16, wire_len_actions, out_len) < 0) {
@@ -4990,14 +4998,14 @@ static int
 loci_validate_of_packet_queue_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, LENGTH);
     }
 
     len = wire_len;
@@ -5018,7 +5026,7 @@ static int
 loci_validate_of_port_desc_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 48) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC, SHORT);
     }
 
     len = 48;
@@ -5034,7 +5042,7 @@ static int
 loci_validate_of_port_mod_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, SHORT);
     }
 
     len = 32;
@@ -5042,7 +5050,7 @@ loci_validate_of_port_mod_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, LENGTH);
     }
 
 
@@ -5056,14 +5064,14 @@ static int
 loci_validate_of_port_mod_failed_error_msg_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -5079,7 +5087,7 @@ static int
 loci_validate_of_port_stats_entry_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 104) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_ENTRY, SHORT);
     }
 
     len = 104;
@@ -5095,14 +5103,14 @@ static int
 loci_validate_of_port_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -5123,7 +5131,7 @@ static int
 loci_validate_of_port_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, SHORT);
     }
 
     len = 20;
@@ -5131,7 +5139,7 @@ loci_validate_of_port_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, LENGTH);
     }
 
 
@@ -5145,7 +5153,7 @@ static int
 loci_validate_of_port_status_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, SHORT);
     }
 
     len = 64;
@@ -5153,7 +5161,7 @@ loci_validate_of_port_status_OF_VERSION_1_0(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, LENGTH);
     }
 
 
@@ -5167,14 +5175,14 @@ static int
 loci_validate_of_queue_get_config_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -5195,7 +5203,7 @@ static int
 loci_validate_of_queue_get_config_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 12;
@@ -5203,7 +5211,7 @@ loci_validate_of_queue_get_config_request_OF_VERSION_1_0(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -5217,14 +5225,14 @@ static int
 loci_validate_of_queue_op_failed_error_msg_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -5240,14 +5248,14 @@ static int
 loci_validate_of_queue_prop_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -5269,7 +5277,7 @@ static int
 loci_validate_of_queue_prop_min_rate_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, SHORT);
     }
 
     len = 16;
@@ -5277,7 +5285,7 @@ loci_validate_of_queue_prop_min_rate_OF_VERSION_1_0(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, LENGTH);
     }
 
 
@@ -5291,7 +5299,7 @@ static int
 loci_validate_of_queue_stats_entry_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_ENTRY, SHORT);
     }
 
     len = 32;
@@ -5307,14 +5315,14 @@ static int
 loci_validate_of_queue_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -5335,7 +5343,7 @@ static int
 loci_validate_of_queue_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, SHORT);
     }
 
     len = 20;
@@ -5343,7 +5351,7 @@ loci_validate_of_queue_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -5357,7 +5365,7 @@ static int
 loci_validate_of_set_config_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, SHORT);
     }
 
     len = 12;
@@ -5365,7 +5373,7 @@ loci_validate_of_set_config_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, LENGTH);
     }
 
 
@@ -5379,7 +5387,7 @@ static int
 loci_validate_of_table_mod_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, SHORT);
     }
 
     len = 16;
@@ -5387,7 +5395,7 @@ loci_validate_of_table_mod_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, LENGTH);
     }
 
 
@@ -5401,7 +5409,7 @@ static int
 loci_validate_of_table_stats_entry_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_ENTRY, SHORT);
     }
 
     len = 64;
@@ -5417,14 +5425,14 @@ static int
 loci_validate_of_table_stats_reply_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -5445,7 +5453,7 @@ static int
 loci_validate_of_table_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, SHORT);
     }
 
     len = 12;
@@ -5453,7 +5461,7 @@ loci_validate_of_table_stats_request_OF_VERSION_1_0(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -5679,14 +5687,14 @@ static int
 loci_validate_of_action_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, LENGTH);
     }
 
     len = wire_len;
@@ -5758,14 +5766,14 @@ static int
 loci_validate_of_action_experimenter_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -5789,14 +5797,14 @@ static int
 loci_validate_of_action_bsn_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -5822,7 +5830,7 @@ static int
 loci_validate_of_action_bsn_checksum_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, SHORT);
     }
 
     len = 28;
@@ -5830,7 +5838,7 @@ loci_validate_of_action_bsn_checksum_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, LENGTH);
     }
 
 
@@ -5844,7 +5852,7 @@ static int
 loci_validate_of_action_bsn_mirror_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, SHORT);
     }
 
     len = 24;
@@ -5852,7 +5860,7 @@ loci_validate_of_action_bsn_mirror_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, LENGTH);
     }
 
 
@@ -5866,7 +5874,7 @@ static int
 loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, SHORT);
     }
 
     len = 16;
@@ -5874,7 +5882,7 @@ loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_1(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, LENGTH);
     }
 
 
@@ -5888,7 +5896,7 @@ static int
 loci_validate_of_action_copy_ttl_in_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, SHORT);
     }
 
     len = 8;
@@ -5896,7 +5904,7 @@ loci_validate_of_action_copy_ttl_in_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, LENGTH);
     }
 
 
@@ -5910,7 +5918,7 @@ static int
 loci_validate_of_action_copy_ttl_out_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, SHORT);
     }
 
     len = 8;
@@ -5918,7 +5926,7 @@ loci_validate_of_action_copy_ttl_out_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, LENGTH);
     }
 
 
@@ -5932,7 +5940,7 @@ static int
 loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -5940,7 +5948,7 @@ loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, LENGTH);
     }
 
 
@@ -5954,7 +5962,7 @@ static int
 loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -5962,7 +5970,7 @@ loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, LENGTH);
     }
 
 
@@ -5976,7 +5984,7 @@ static int
 loci_validate_of_action_group_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, SHORT);
     }
 
     len = 8;
@@ -5984,7 +5992,7 @@ loci_validate_of_action_group_OF_VERSION_1_1(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, LENGTH);
     }
 
 
@@ -5998,14 +6006,14 @@ static int
 loci_validate_of_action_nicira_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, LENGTH);
     }
 
     len = wire_len;
@@ -6037,7 +6045,7 @@ static int
 loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, SHORT);
     }
 
     len = 16;
@@ -6045,7 +6053,7 @@ loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_1(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, LENGTH);
     }
 
 
@@ -6059,7 +6067,7 @@ static int
 loci_validate_of_action_nicira_move_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, SHORT);
     }
 
     len = 24;
@@ -6067,7 +6075,7 @@ loci_validate_of_action_nicira_move_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, LENGTH);
     }
 
 
@@ -6081,7 +6089,7 @@ static int
 loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, SHORT);
     }
 
     len = 16;
@@ -6089,7 +6097,7 @@ loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_1(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, LENGTH);
     }
 
 
@@ -6103,7 +6111,7 @@ static int
 loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, SHORT);
     }
 
     len = 16;
@@ -6111,7 +6119,7 @@ loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_1(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, LENGTH);
     }
 
 
@@ -6125,7 +6133,7 @@ static int
 loci_validate_of_action_nicira_resubmit_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, SHORT);
     }
 
     len = 16;
@@ -6133,7 +6141,7 @@ loci_validate_of_action_nicira_resubmit_OF_VERSION_1_1(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, LENGTH);
     }
 
 
@@ -6147,7 +6155,7 @@ static int
 loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, SHORT);
     }
 
     len = 16;
@@ -6155,7 +6163,7 @@ loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_1(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, LENGTH);
     }
 
 
@@ -6169,7 +6177,7 @@ static int
 loci_validate_of_action_output_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, SHORT);
     }
 
     len = 16;
@@ -6177,7 +6185,7 @@ loci_validate_of_action_output_OF_VERSION_1_1(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, LENGTH);
     }
 
 
@@ -6191,7 +6199,7 @@ static int
 loci_validate_of_action_pop_mpls_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, SHORT);
     }
 
     len = 8;
@@ -6199,7 +6207,7 @@ loci_validate_of_action_pop_mpls_OF_VERSION_1_1(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, LENGTH);
     }
 
 
@@ -6213,7 +6221,7 @@ static int
 loci_validate_of_action_pop_vlan_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, SHORT);
     }
 
     len = 8;
@@ -6221,7 +6229,7 @@ loci_validate_of_action_pop_vlan_OF_VERSION_1_1(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, LENGTH);
     }
 
 
@@ -6235,7 +6243,7 @@ static int
 loci_validate_of_action_push_mpls_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, SHORT);
     }
 
     len = 8;
@@ -6243,7 +6251,7 @@ loci_validate_of_action_push_mpls_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, LENGTH);
     }
 
 
@@ -6257,7 +6265,7 @@ static int
 loci_validate_of_action_push_vlan_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, SHORT);
     }
 
     len = 8;
@@ -6265,7 +6273,7 @@ loci_validate_of_action_push_vlan_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, LENGTH);
     }
 
 
@@ -6279,7 +6287,7 @@ static int
 loci_validate_of_action_set_dl_dst_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_DST, SHORT);
     }
 
     len = 16;
@@ -6287,7 +6295,7 @@ loci_validate_of_action_set_dl_dst_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_DST, LENGTH);
     }
 
 
@@ -6301,7 +6309,7 @@ static int
 loci_validate_of_action_set_dl_src_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_SRC, SHORT);
     }
 
     len = 16;
@@ -6309,7 +6317,7 @@ loci_validate_of_action_set_dl_src_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_DL_SRC, LENGTH);
     }
 
 
@@ -6323,7 +6331,7 @@ static int
 loci_validate_of_action_set_mpls_label_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_LABEL, SHORT);
     }
 
     len = 8;
@@ -6331,7 +6339,7 @@ loci_validate_of_action_set_mpls_label_OF_VERSION_1_1(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_LABEL, LENGTH);
     }
 
 
@@ -6345,7 +6353,7 @@ static int
 loci_validate_of_action_set_mpls_tc_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TC, SHORT);
     }
 
     len = 8;
@@ -6353,7 +6361,7 @@ loci_validate_of_action_set_mpls_tc_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TC, LENGTH);
     }
 
 
@@ -6367,7 +6375,7 @@ static int
 loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -6375,7 +6383,7 @@ loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, LENGTH);
     }
 
 
@@ -6389,7 +6397,7 @@ static int
 loci_validate_of_action_set_nw_dst_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_DST, SHORT);
     }
 
     len = 8;
@@ -6397,7 +6405,7 @@ loci_validate_of_action_set_nw_dst_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_DST, LENGTH);
     }
 
 
@@ -6411,7 +6419,7 @@ static int
 loci_validate_of_action_set_nw_ecn_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_ECN, SHORT);
     }
 
     len = 8;
@@ -6419,7 +6427,7 @@ loci_validate_of_action_set_nw_ecn_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_ECN, LENGTH);
     }
 
 
@@ -6433,7 +6441,7 @@ static int
 loci_validate_of_action_set_nw_src_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_SRC, SHORT);
     }
 
     len = 8;
@@ -6441,7 +6449,7 @@ loci_validate_of_action_set_nw_src_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_SRC, LENGTH);
     }
 
 
@@ -6455,7 +6463,7 @@ static int
 loci_validate_of_action_set_nw_tos_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TOS, SHORT);
     }
 
     len = 8;
@@ -6463,7 +6471,7 @@ loci_validate_of_action_set_nw_tos_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TOS, LENGTH);
     }
 
 
@@ -6477,7 +6485,7 @@ static int
 loci_validate_of_action_set_nw_ttl_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -6485,7 +6493,7 @@ loci_validate_of_action_set_nw_ttl_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, LENGTH);
     }
 
 
@@ -6499,7 +6507,7 @@ static int
 loci_validate_of_action_set_queue_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, SHORT);
     }
 
     len = 8;
@@ -6507,7 +6515,7 @@ loci_validate_of_action_set_queue_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, LENGTH);
     }
 
 
@@ -6521,7 +6529,7 @@ static int
 loci_validate_of_action_set_tp_dst_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_DST, SHORT);
     }
 
     len = 8;
@@ -6529,7 +6537,7 @@ loci_validate_of_action_set_tp_dst_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_DST, LENGTH);
     }
 
 
@@ -6543,7 +6551,7 @@ static int
 loci_validate_of_action_set_tp_src_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_SRC, SHORT);
     }
 
     len = 8;
@@ -6551,7 +6559,7 @@ loci_validate_of_action_set_tp_src_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_TP_SRC, LENGTH);
     }
 
 
@@ -6565,7 +6573,7 @@ static int
 loci_validate_of_action_set_vlan_pcp_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_PCP, SHORT);
     }
 
     len = 8;
@@ -6573,7 +6581,7 @@ loci_validate_of_action_set_vlan_pcp_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_PCP, LENGTH);
     }
 
 
@@ -6587,7 +6595,7 @@ static int
 loci_validate_of_action_set_vlan_vid_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_VID, SHORT);
     }
 
     len = 8;
@@ -6595,7 +6603,7 @@ loci_validate_of_action_set_vlan_vid_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_VLAN_VID, LENGTH);
     }
 
 
@@ -6609,14 +6617,14 @@ static int
 loci_validate_of_header_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -6684,14 +6692,14 @@ static int
 loci_validate_of_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -6729,7 +6737,7 @@ static int
 loci_validate_of_aggregate_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, SHORT);
     }
 
     len = 40;
@@ -6737,7 +6745,7 @@ loci_validate_of_aggregate_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, LENGTH);
     }
 
 
@@ -6751,14 +6759,14 @@ static int
 loci_validate_of_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -6796,7 +6804,7 @@ static int
 loci_validate_of_aggregate_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, SHORT);
     }
 
     len = 136;
@@ -6804,7 +6812,7 @@ loci_validate_of_aggregate_stats_request_OF_VERSION_1_1(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -6819,14 +6827,14 @@ static int
 loci_validate_of_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -6868,14 +6876,14 @@ static int
 loci_validate_of_bad_action_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -6891,14 +6899,14 @@ static int
 loci_validate_of_bad_instruction_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -6914,14 +6922,14 @@ static int
 loci_validate_of_bad_match_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -6937,14 +6945,14 @@ static int
 loci_validate_of_bad_request_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -6960,7 +6968,7 @@ static int
 loci_validate_of_barrier_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, SHORT);
     }
 
     len = 8;
@@ -6968,7 +6976,7 @@ loci_validate_of_barrier_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, LENGTH);
     }
 
 
@@ -6982,7 +6990,7 @@ static int
 loci_validate_of_barrier_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, SHORT);
     }
 
     len = 8;
@@ -6990,7 +6998,7 @@ loci_validate_of_barrier_request_OF_VERSION_1_1(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, LENGTH);
     }
 
 
@@ -7004,14 +7012,14 @@ static int
 loci_validate_of_experimenter_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -7035,14 +7043,14 @@ static int
 loci_validate_of_bsn_header_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -7106,7 +7114,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, SHORT);
     }
 
     len = 20;
@@ -7114,7 +7122,7 @@ loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_1(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, LENGTH);
     }
 
 
@@ -7128,7 +7136,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, SHORT);
     }
 
     len = 16;
@@ -7136,7 +7144,7 @@ loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_1(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, LENGTH);
     }
 
 
@@ -7150,7 +7158,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, SHORT);
     }
 
     len = 20;
@@ -7158,7 +7166,7 @@ loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_1(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, LENGTH);
     }
 
 
@@ -7172,7 +7180,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -7180,7 +7188,7 @@ loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_1(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, LENGTH);
     }
 
 
@@ -7194,7 +7202,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, SHORT);
     }
 
     len = 24;
@@ -7202,7 +7210,7 @@ loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_1(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, LENGTH);
     }
 
 
@@ -7216,7 +7224,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, SHORT);
     }
 
     len = 20;
@@ -7224,7 +7232,7 @@ loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_1(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, LENGTH);
     }
 
 
@@ -7238,14 +7246,14 @@ static int
 loci_validate_of_bsn_get_interfaces_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -7266,7 +7274,7 @@ static int
 loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, SHORT);
     }
 
     len = 16;
@@ -7274,7 +7282,7 @@ loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_1(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, LENGTH);
     }
 
 
@@ -7288,7 +7296,7 @@ static int
 loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, SHORT);
     }
 
     len = 20;
@@ -7296,7 +7304,7 @@ loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_1(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, LENGTH);
     }
 
 
@@ -7310,7 +7318,7 @@ static int
 loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, SHORT);
     }
 
     len = 20;
@@ -7318,7 +7326,7 @@ loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_1(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, LENGTH);
     }
 
 
@@ -7332,7 +7340,7 @@ static int
 loci_validate_of_bsn_interface_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_INTERFACE, SHORT);
     }
 
     len = 32;
@@ -7348,7 +7356,7 @@ static int
 loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, SHORT);
     }
 
     len = 25;
@@ -7356,7 +7364,7 @@ loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, LENGTH);
     }
 
 
@@ -7370,14 +7378,14 @@ static int
 loci_validate_of_bsn_pdu_rx_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -7393,7 +7401,7 @@ static int
 loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, SHORT);
     }
 
     len = 21;
@@ -7401,7 +7409,7 @@ loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, LENGTH);
     }
 
 
@@ -7415,7 +7423,7 @@ static int
 loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, SHORT);
     }
 
     len = 25;
@@ -7423,7 +7431,7 @@ loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, LENGTH);
     }
 
 
@@ -7437,14 +7445,14 @@ static int
 loci_validate_of_bsn_pdu_tx_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -7460,7 +7468,7 @@ static int
 loci_validate_of_bsn_set_mirroring_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, SHORT);
     }
 
     len = 20;
@@ -7468,7 +7476,7 @@ loci_validate_of_bsn_set_mirroring_OF_VERSION_1_1(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, LENGTH);
     }
 
 
@@ -7482,7 +7490,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, SHORT);
     }
 
     len = 20;
@@ -7490,7 +7498,7 @@ loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_1(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, LENGTH);
     }
 
 
@@ -7504,7 +7512,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, SHORT);
     }
 
     len = 32;
@@ -7512,7 +7520,7 @@ loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_1(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, LENGTH);
     }
 
 
@@ -7526,14 +7534,14 @@ static int
 loci_validate_of_experimenter_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -7555,14 +7563,14 @@ static int
 loci_validate_of_bsn_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -7582,14 +7590,14 @@ static int
 loci_validate_of_experimenter_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -7611,14 +7619,14 @@ static int
 loci_validate_of_bsn_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -7638,7 +7646,7 @@ static int
 loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, SHORT);
     }
 
     len = 24;
@@ -7646,7 +7654,7 @@ loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_1(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, LENGTH);
     }
 
 
@@ -7660,14 +7668,14 @@ static int
 loci_validate_of_bsn_vport_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, LENGTH);
     }
 
     len = wire_len;
@@ -7691,14 +7699,14 @@ static int
 loci_validate_of_bsn_virtual_port_create_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -7715,7 +7723,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, SHORT);
     }
 
     len = 20;
@@ -7723,7 +7731,7 @@ loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_1(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, LENGTH);
     }
 
 
@@ -7737,7 +7745,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, SHORT);
     }
 
     len = 20;
@@ -7745,7 +7753,7 @@ loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_1(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, LENGTH);
     }
 
 
@@ -7759,7 +7767,7 @@ static int
 loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, SHORT);
     }
 
     len = 64;
@@ -7767,7 +7775,7 @@ loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_1(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, LENGTH);
     }
 
 
@@ -7781,7 +7789,7 @@ static int
 loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, SHORT);
     }
 
     len = 32;
@@ -7789,7 +7797,7 @@ loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, LENGTH);
     }
 
 
@@ -7803,14 +7811,14 @@ static int
 loci_validate_of_bucket_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, LENGTH);
     }
 
     len = wire_len;
@@ -7831,7 +7839,7 @@ static int
 loci_validate_of_bucket_counter_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET_COUNTER, SHORT);
     }
 
     len = 16;
@@ -7847,7 +7855,7 @@ static int
 loci_validate_of_desc_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, SHORT);
     }
 
     len = 1072;
@@ -7855,7 +7863,7 @@ loci_validate_of_desc_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, LENGTH);
     }
 
 
@@ -7869,7 +7877,7 @@ static int
 loci_validate_of_desc_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -7877,7 +7885,7 @@ loci_validate_of_desc_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -7891,14 +7899,14 @@ static int
 loci_validate_of_echo_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -7914,14 +7922,14 @@ static int
 loci_validate_of_echo_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -7937,14 +7945,14 @@ static int
 loci_validate_of_features_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -7965,7 +7973,7 @@ static int
 loci_validate_of_features_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, SHORT);
     }
 
     len = 8;
@@ -7973,7 +7981,7 @@ loci_validate_of_features_request_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, LENGTH);
     }
 
 
@@ -7987,14 +7995,14 @@ static int
 loci_validate_of_flow_mod_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -8030,14 +8038,14 @@ static int
 loci_validate_of_flow_add_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -8059,14 +8067,14 @@ static int
 loci_validate_of_flow_delete_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -8088,14 +8096,14 @@ static int
 loci_validate_of_flow_delete_strict_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -8117,14 +8125,14 @@ static int
 loci_validate_of_flow_mod_failed_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -8140,14 +8148,14 @@ static int
 loci_validate_of_flow_modify_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -8169,14 +8177,14 @@ static int
 loci_validate_of_flow_modify_strict_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -8198,7 +8206,7 @@ static int
 loci_validate_of_flow_removed_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, SHORT);
     }
 
     len = 136;
@@ -8206,7 +8214,7 @@ loci_validate_of_flow_removed_OF_VERSION_1_1(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, LENGTH);
     }
 
 
@@ -8221,14 +8229,14 @@ static int
 loci_validate_of_flow_stats_entry_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -8250,14 +8258,14 @@ static int
 loci_validate_of_flow_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -8278,7 +8286,7 @@ static int
 loci_validate_of_flow_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, SHORT);
     }
 
     len = 136;
@@ -8286,7 +8294,7 @@ loci_validate_of_flow_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 136) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, LENGTH);
     }
 
 
@@ -8301,7 +8309,7 @@ static int
 loci_validate_of_get_config_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, SHORT);
     }
 
     len = 12;
@@ -8309,7 +8317,7 @@ loci_validate_of_get_config_reply_OF_VERSION_1_1(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, LENGTH);
     }
 
 
@@ -8323,7 +8331,7 @@ static int
 loci_validate_of_get_config_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 8;
@@ -8331,7 +8339,7 @@ loci_validate_of_get_config_request_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -8345,14 +8353,14 @@ static int
 loci_validate_of_group_mod_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -8383,14 +8391,14 @@ static int
 loci_validate_of_group_add_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -8411,14 +8419,14 @@ static int
 loci_validate_of_group_delete_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -8439,14 +8447,14 @@ static int
 loci_validate_of_group_desc_stats_entry_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -8467,14 +8475,14 @@ static int
 loci_validate_of_group_desc_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -8495,7 +8503,7 @@ static int
 loci_validate_of_group_desc_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -8503,7 +8511,7 @@ loci_validate_of_group_desc_stats_request_OF_VERSION_1_1(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -8517,14 +8525,14 @@ static int
 loci_validate_of_group_mod_failed_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -8540,14 +8548,14 @@ static int
 loci_validate_of_group_modify_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -8568,14 +8576,14 @@ static int
 loci_validate_of_group_stats_entry_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -8596,14 +8604,14 @@ static int
 loci_validate_of_group_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -8624,7 +8632,7 @@ static int
 loci_validate_of_group_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -8632,7 +8640,7 @@ loci_validate_of_group_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, LENGTH);
     }
 
 
@@ -8646,7 +8654,7 @@ static int
 loci_validate_of_hello_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, SHORT);
     }
 
     len = 8;
@@ -8654,7 +8662,7 @@ loci_validate_of_hello_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, LENGTH);
     }
 
 
@@ -8668,14 +8676,14 @@ static int
 loci_validate_of_hello_failed_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -8691,14 +8699,14 @@ static int
 loci_validate_of_instruction_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, LENGTH);
     }
 
     len = wire_len;
@@ -8730,14 +8738,14 @@ static int
 loci_validate_of_instruction_apply_actions_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -8758,7 +8766,7 @@ static int
 loci_validate_of_instruction_clear_actions_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, SHORT);
     }
 
     len = 8;
@@ -8766,7 +8774,7 @@ loci_validate_of_instruction_clear_actions_OF_VERSION_1_1(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, LENGTH);
     }
 
 
@@ -8780,14 +8788,14 @@ static int
 loci_validate_of_instruction_experimenter_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -8807,7 +8815,7 @@ static int
 loci_validate_of_instruction_goto_table_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, SHORT);
     }
 
     len = 8;
@@ -8815,7 +8823,7 @@ loci_validate_of_instruction_goto_table_OF_VERSION_1_1(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, LENGTH);
     }
 
 
@@ -8829,14 +8837,14 @@ static int
 loci_validate_of_instruction_write_actions_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -8857,7 +8865,7 @@ static int
 loci_validate_of_instruction_write_metadata_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, SHORT);
     }
 
     len = 24;
@@ -8865,7 +8873,7 @@ loci_validate_of_instruction_write_metadata_OF_VERSION_1_1(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, LENGTH);
     }
 
 
@@ -8879,7 +8887,7 @@ static int
 loci_validate_of_match_v2_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V2, SHORT);
     }
 
     len = 88;
@@ -8887,7 +8895,7 @@ loci_validate_of_match_v2_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V2, LENGTH);
     }
 
 
@@ -8901,14 +8909,14 @@ static int
 loci_validate_of_nicira_header_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -8928,14 +8936,14 @@ static int
 loci_validate_of_packet_in_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, LENGTH);
     }
 
     len = wire_len;
@@ -8951,14 +8959,14 @@ static int
 loci_validate_of_packet_out_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     len = wire_len;
@@ -8969,7 +8977,7 @@ loci_validate_of_packet_out_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 
 
     if (24 + wire_len_actions > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     if (loci_validate_of_list_action_OF_VERSION_1_1(data + 24, wire_len_actions, out_len) < 0) {
@@ -8985,14 +8993,14 @@ static int
 loci_validate_of_packet_queue_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, LENGTH);
     }
 
     len = wire_len;
@@ -9013,7 +9021,7 @@ static int
 loci_validate_of_port_desc_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC, SHORT);
     }
 
     len = 64;
@@ -9029,7 +9037,7 @@ static int
 loci_validate_of_port_mod_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, SHORT);
     }
 
     len = 40;
@@ -9037,7 +9045,7 @@ loci_validate_of_port_mod_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, LENGTH);
     }
 
 
@@ -9051,14 +9059,14 @@ static int
 loci_validate_of_port_mod_failed_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -9074,7 +9082,7 @@ static int
 loci_validate_of_port_stats_entry_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 104) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_ENTRY, SHORT);
     }
 
     len = 104;
@@ -9090,14 +9098,14 @@ static int
 loci_validate_of_port_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -9118,7 +9126,7 @@ static int
 loci_validate_of_port_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -9126,7 +9134,7 @@ loci_validate_of_port_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, LENGTH);
     }
 
 
@@ -9140,7 +9148,7 @@ static int
 loci_validate_of_port_status_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, SHORT);
     }
 
     len = 80;
@@ -9148,7 +9156,7 @@ loci_validate_of_port_status_OF_VERSION_1_1(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, LENGTH);
     }
 
 
@@ -9162,14 +9170,14 @@ static int
 loci_validate_of_queue_get_config_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -9190,7 +9198,7 @@ static int
 loci_validate_of_queue_get_config_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 16;
@@ -9198,7 +9206,7 @@ loci_validate_of_queue_get_config_request_OF_VERSION_1_1(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -9212,14 +9220,14 @@ static int
 loci_validate_of_queue_op_failed_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -9235,14 +9243,14 @@ static int
 loci_validate_of_queue_prop_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -9264,7 +9272,7 @@ static int
 loci_validate_of_queue_prop_min_rate_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, SHORT);
     }
 
     len = 16;
@@ -9272,7 +9280,7 @@ loci_validate_of_queue_prop_min_rate_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, LENGTH);
     }
 
 
@@ -9286,7 +9294,7 @@ static int
 loci_validate_of_queue_stats_entry_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_ENTRY, SHORT);
     }
 
     len = 32;
@@ -9302,14 +9310,14 @@ static int
 loci_validate_of_queue_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -9330,7 +9338,7 @@ static int
 loci_validate_of_queue_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -9338,7 +9346,7 @@ loci_validate_of_queue_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -9352,7 +9360,7 @@ static int
 loci_validate_of_set_config_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, SHORT);
     }
 
     len = 12;
@@ -9360,7 +9368,7 @@ loci_validate_of_set_config_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, LENGTH);
     }
 
 
@@ -9374,14 +9382,14 @@ static int
 loci_validate_of_switch_config_failed_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -9397,7 +9405,7 @@ static int
 loci_validate_of_table_mod_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, SHORT);
     }
 
     len = 16;
@@ -9405,7 +9413,7 @@ loci_validate_of_table_mod_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, LENGTH);
     }
 
 
@@ -9419,14 +9427,14 @@ static int
 loci_validate_of_table_mod_failed_error_msg_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -9442,7 +9450,7 @@ static int
 loci_validate_of_table_stats_entry_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_ENTRY, SHORT);
     }
 
     len = 88;
@@ -9458,14 +9466,14 @@ static int
 loci_validate_of_table_stats_reply_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -9486,7 +9494,7 @@ static int
 loci_validate_of_table_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -9494,7 +9502,7 @@ loci_validate_of_table_stats_request_OF_VERSION_1_1(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -9735,14 +9743,14 @@ static int
 loci_validate_of_action_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, LENGTH);
     }
 
     len = wire_len;
@@ -9792,14 +9800,14 @@ static int
 loci_validate_of_action_experimenter_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -9823,14 +9831,14 @@ static int
 loci_validate_of_action_bsn_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -9856,7 +9864,7 @@ static int
 loci_validate_of_action_bsn_checksum_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, SHORT);
     }
 
     len = 28;
@@ -9864,7 +9872,7 @@ loci_validate_of_action_bsn_checksum_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, LENGTH);
     }
 
 
@@ -9878,7 +9886,7 @@ static int
 loci_validate_of_action_bsn_mirror_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, SHORT);
     }
 
     len = 24;
@@ -9886,7 +9894,7 @@ loci_validate_of_action_bsn_mirror_OF_VERSION_1_2(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, LENGTH);
     }
 
 
@@ -9900,7 +9908,7 @@ static int
 loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, SHORT);
     }
 
     len = 16;
@@ -9908,7 +9916,7 @@ loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_2(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, LENGTH);
     }
 
 
@@ -9922,7 +9930,7 @@ static int
 loci_validate_of_action_copy_ttl_in_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, SHORT);
     }
 
     len = 8;
@@ -9930,7 +9938,7 @@ loci_validate_of_action_copy_ttl_in_OF_VERSION_1_2(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, LENGTH);
     }
 
 
@@ -9944,7 +9952,7 @@ static int
 loci_validate_of_action_copy_ttl_out_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, SHORT);
     }
 
     len = 8;
@@ -9952,7 +9960,7 @@ loci_validate_of_action_copy_ttl_out_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, LENGTH);
     }
 
 
@@ -9966,7 +9974,7 @@ static int
 loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -9974,7 +9982,7 @@ loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, LENGTH);
     }
 
 
@@ -9988,7 +9996,7 @@ static int
 loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -9996,7 +10004,7 @@ loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_2(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, LENGTH);
     }
 
 
@@ -10010,7 +10018,7 @@ static int
 loci_validate_of_action_group_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, SHORT);
     }
 
     len = 8;
@@ -10018,7 +10026,7 @@ loci_validate_of_action_group_OF_VERSION_1_2(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, LENGTH);
     }
 
 
@@ -10032,14 +10040,14 @@ static int
 loci_validate_of_action_nicira_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, LENGTH);
     }
 
     len = wire_len;
@@ -10071,7 +10079,7 @@ static int
 loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, SHORT);
     }
 
     len = 16;
@@ -10079,7 +10087,7 @@ loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_2(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, LENGTH);
     }
 
 
@@ -10093,7 +10101,7 @@ static int
 loci_validate_of_action_nicira_move_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, SHORT);
     }
 
     len = 24;
@@ -10101,7 +10109,7 @@ loci_validate_of_action_nicira_move_OF_VERSION_1_2(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, LENGTH);
     }
 
 
@@ -10115,7 +10123,7 @@ static int
 loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, SHORT);
     }
 
     len = 16;
@@ -10123,7 +10131,7 @@ loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_2(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, LENGTH);
     }
 
 
@@ -10137,7 +10145,7 @@ static int
 loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, SHORT);
     }
 
     len = 16;
@@ -10145,7 +10153,7 @@ loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_2(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, LENGTH);
     }
 
 
@@ -10159,7 +10167,7 @@ static int
 loci_validate_of_action_nicira_resubmit_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, SHORT);
     }
 
     len = 16;
@@ -10167,7 +10175,7 @@ loci_validate_of_action_nicira_resubmit_OF_VERSION_1_2(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, LENGTH);
     }
 
 
@@ -10181,7 +10189,7 @@ static int
 loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, SHORT);
     }
 
     len = 16;
@@ -10189,7 +10197,7 @@ loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_2(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, LENGTH);
     }
 
 
@@ -10203,7 +10211,7 @@ static int
 loci_validate_of_action_output_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, SHORT);
     }
 
     len = 16;
@@ -10211,7 +10219,7 @@ loci_validate_of_action_output_OF_VERSION_1_2(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, LENGTH);
     }
 
 
@@ -10225,7 +10233,7 @@ static int
 loci_validate_of_action_pop_mpls_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, SHORT);
     }
 
     len = 8;
@@ -10233,7 +10241,7 @@ loci_validate_of_action_pop_mpls_OF_VERSION_1_2(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, LENGTH);
     }
 
 
@@ -10247,7 +10255,7 @@ static int
 loci_validate_of_action_pop_vlan_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, SHORT);
     }
 
     len = 8;
@@ -10255,7 +10263,7 @@ loci_validate_of_action_pop_vlan_OF_VERSION_1_2(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, LENGTH);
     }
 
 
@@ -10269,7 +10277,7 @@ static int
 loci_validate_of_action_push_mpls_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, SHORT);
     }
 
     len = 8;
@@ -10277,7 +10285,7 @@ loci_validate_of_action_push_mpls_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, LENGTH);
     }
 
 
@@ -10291,7 +10299,7 @@ static int
 loci_validate_of_action_push_vlan_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, SHORT);
     }
 
     len = 8;
@@ -10299,7 +10307,7 @@ loci_validate_of_action_push_vlan_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, LENGTH);
     }
 
 
@@ -10313,7 +10321,7 @@ static int
 loci_validate_of_oxm_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM, SHORT);
     }
 
 
@@ -10640,14 +10648,14 @@ static int
 loci_validate_of_action_set_field_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_FIELD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_FIELD, LENGTH);
     }
 
     len = wire_len;
@@ -10663,7 +10671,7 @@ static int
 loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -10671,7 +10679,7 @@ loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, LENGTH);
     }
 
 
@@ -10685,7 +10693,7 @@ static int
 loci_validate_of_action_set_nw_ttl_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -10693,7 +10701,7 @@ loci_validate_of_action_set_nw_ttl_OF_VERSION_1_2(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, LENGTH);
     }
 
 
@@ -10707,7 +10715,7 @@ static int
 loci_validate_of_action_set_queue_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, SHORT);
     }
 
     len = 8;
@@ -10715,7 +10723,7 @@ loci_validate_of_action_set_queue_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, LENGTH);
     }
 
 
@@ -10729,14 +10737,14 @@ static int
 loci_validate_of_header_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -10808,14 +10816,14 @@ static int
 loci_validate_of_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -10855,7 +10863,7 @@ static int
 loci_validate_of_aggregate_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, SHORT);
     }
 
     len = 40;
@@ -10863,7 +10871,7 @@ loci_validate_of_aggregate_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, LENGTH);
     }
 
 
@@ -10877,14 +10885,14 @@ static int
 loci_validate_of_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -10924,14 +10932,14 @@ static int
 loci_validate_of_aggregate_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -10948,14 +10956,14 @@ static int
 loci_validate_of_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -11001,14 +11009,14 @@ static int
 loci_validate_of_bad_action_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -11024,14 +11032,14 @@ static int
 loci_validate_of_bad_instruction_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -11047,14 +11055,14 @@ static int
 loci_validate_of_bad_match_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -11070,14 +11078,14 @@ static int
 loci_validate_of_bad_request_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -11093,7 +11101,7 @@ static int
 loci_validate_of_barrier_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, SHORT);
     }
 
     len = 8;
@@ -11101,7 +11109,7 @@ loci_validate_of_barrier_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, LENGTH);
     }
 
 
@@ -11115,7 +11123,7 @@ static int
 loci_validate_of_barrier_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, SHORT);
     }
 
     len = 8;
@@ -11123,7 +11131,7 @@ loci_validate_of_barrier_request_OF_VERSION_1_2(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, LENGTH);
     }
 
 
@@ -11137,14 +11145,14 @@ static int
 loci_validate_of_experimenter_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -11168,14 +11176,14 @@ static int
 loci_validate_of_bsn_header_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -11239,7 +11247,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, SHORT);
     }
 
     len = 20;
@@ -11247,7 +11255,7 @@ loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_2(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, LENGTH);
     }
 
 
@@ -11261,7 +11269,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, SHORT);
     }
 
     len = 16;
@@ -11269,7 +11277,7 @@ loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_2(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, LENGTH);
     }
 
 
@@ -11283,7 +11291,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, SHORT);
     }
 
     len = 20;
@@ -11291,7 +11299,7 @@ loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_2(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, LENGTH);
     }
 
 
@@ -11305,7 +11313,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -11313,7 +11321,7 @@ loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_2(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, LENGTH);
     }
 
 
@@ -11327,7 +11335,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, SHORT);
     }
 
     len = 24;
@@ -11335,7 +11343,7 @@ loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_2(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, LENGTH);
     }
 
 
@@ -11349,7 +11357,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, SHORT);
     }
 
     len = 20;
@@ -11357,7 +11365,7 @@ loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_2(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, LENGTH);
     }
 
 
@@ -11371,14 +11379,14 @@ static int
 loci_validate_of_bsn_get_interfaces_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -11399,7 +11407,7 @@ static int
 loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, SHORT);
     }
 
     len = 16;
@@ -11407,7 +11415,7 @@ loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_2(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, LENGTH);
     }
 
 
@@ -11421,7 +11429,7 @@ static int
 loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, SHORT);
     }
 
     len = 20;
@@ -11429,7 +11437,7 @@ loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_2(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, LENGTH);
     }
 
 
@@ -11443,7 +11451,7 @@ static int
 loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, SHORT);
     }
 
     len = 20;
@@ -11451,7 +11459,7 @@ loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_2(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, LENGTH);
     }
 
 
@@ -11465,7 +11473,7 @@ static int
 loci_validate_of_bsn_interface_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_INTERFACE, SHORT);
     }
 
     len = 32;
@@ -11481,7 +11489,7 @@ static int
 loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, SHORT);
     }
 
     len = 25;
@@ -11489,7 +11497,7 @@ loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, LENGTH);
     }
 
 
@@ -11503,14 +11511,14 @@ static int
 loci_validate_of_bsn_pdu_rx_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -11526,7 +11534,7 @@ static int
 loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, SHORT);
     }
 
     len = 21;
@@ -11534,7 +11542,7 @@ loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_2(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, LENGTH);
     }
 
 
@@ -11548,7 +11556,7 @@ static int
 loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, SHORT);
     }
 
     len = 25;
@@ -11556,7 +11564,7 @@ loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, LENGTH);
     }
 
 
@@ -11570,14 +11578,14 @@ static int
 loci_validate_of_bsn_pdu_tx_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -11593,7 +11601,7 @@ static int
 loci_validate_of_bsn_set_mirroring_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, SHORT);
     }
 
     len = 20;
@@ -11601,7 +11609,7 @@ loci_validate_of_bsn_set_mirroring_OF_VERSION_1_2(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, LENGTH);
     }
 
 
@@ -11615,7 +11623,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, SHORT);
     }
 
     len = 20;
@@ -11623,7 +11631,7 @@ loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_2(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, LENGTH);
     }
 
 
@@ -11637,7 +11645,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, SHORT);
     }
 
     len = 32;
@@ -11645,7 +11653,7 @@ loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_2(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, LENGTH);
     }
 
 
@@ -11659,14 +11667,14 @@ static int
 loci_validate_of_experimenter_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -11688,14 +11696,14 @@ static int
 loci_validate_of_bsn_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -11715,14 +11723,14 @@ static int
 loci_validate_of_experimenter_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -11744,14 +11752,14 @@ static int
 loci_validate_of_bsn_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -11771,7 +11779,7 @@ static int
 loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, SHORT);
     }
 
     len = 24;
@@ -11779,7 +11787,7 @@ loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_2(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, LENGTH);
     }
 
 
@@ -11793,14 +11801,14 @@ static int
 loci_validate_of_bsn_vport_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, LENGTH);
     }
 
     len = wire_len;
@@ -11824,14 +11832,14 @@ static int
 loci_validate_of_bsn_virtual_port_create_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -11848,7 +11856,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, SHORT);
     }
 
     len = 20;
@@ -11856,7 +11864,7 @@ loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_2(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, LENGTH);
     }
 
 
@@ -11870,7 +11878,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, SHORT);
     }
 
     len = 20;
@@ -11878,7 +11886,7 @@ loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_2(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, LENGTH);
     }
 
 
@@ -11892,7 +11900,7 @@ static int
 loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, SHORT);
     }
 
     len = 64;
@@ -11900,7 +11908,7 @@ loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_2(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, LENGTH);
     }
 
 
@@ -11914,7 +11922,7 @@ static int
 loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, SHORT);
     }
 
     len = 32;
@@ -11922,7 +11930,7 @@ loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, LENGTH);
     }
 
 
@@ -11936,14 +11944,14 @@ static int
 loci_validate_of_bucket_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, LENGTH);
     }
 
     len = wire_len;
@@ -11964,7 +11972,7 @@ static int
 loci_validate_of_bucket_counter_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET_COUNTER, SHORT);
     }
 
     len = 16;
@@ -11980,7 +11988,7 @@ static int
 loci_validate_of_desc_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, SHORT);
     }
 
     len = 1072;
@@ -11988,7 +11996,7 @@ loci_validate_of_desc_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, LENGTH);
     }
 
 
@@ -12002,7 +12010,7 @@ static int
 loci_validate_of_desc_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -12010,7 +12018,7 @@ loci_validate_of_desc_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -12024,14 +12032,14 @@ static int
 loci_validate_of_echo_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -12047,14 +12055,14 @@ static int
 loci_validate_of_echo_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -12070,14 +12078,14 @@ static int
 loci_validate_of_experimenter_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -12097,14 +12105,14 @@ static int
 loci_validate_of_features_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -12125,7 +12133,7 @@ static int
 loci_validate_of_features_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, SHORT);
     }
 
     len = 8;
@@ -12133,7 +12141,7 @@ loci_validate_of_features_request_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, LENGTH);
     }
 
 
@@ -12147,14 +12155,14 @@ static int
 loci_validate_of_flow_mod_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -12186,14 +12194,14 @@ static int
 loci_validate_of_flow_add_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -12211,14 +12219,14 @@ static int
 loci_validate_of_flow_delete_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -12236,14 +12244,14 @@ static int
 loci_validate_of_flow_delete_strict_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -12261,14 +12269,14 @@ static int
 loci_validate_of_flow_mod_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -12284,14 +12292,14 @@ static int
 loci_validate_of_flow_modify_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -12309,14 +12317,14 @@ static int
 loci_validate_of_flow_modify_strict_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -12334,14 +12342,14 @@ static int
 loci_validate_of_flow_removed_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, LENGTH);
     }
 
     len = wire_len;
@@ -12358,14 +12366,14 @@ static int
 loci_validate_of_flow_stats_entry_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -12383,14 +12391,14 @@ static int
 loci_validate_of_flow_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -12411,14 +12419,14 @@ static int
 loci_validate_of_flow_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -12435,7 +12443,7 @@ static int
 loci_validate_of_get_config_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, SHORT);
     }
 
     len = 12;
@@ -12443,7 +12451,7 @@ loci_validate_of_get_config_reply_OF_VERSION_1_2(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, LENGTH);
     }
 
 
@@ -12457,7 +12465,7 @@ static int
 loci_validate_of_get_config_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 8;
@@ -12465,7 +12473,7 @@ loci_validate_of_get_config_request_OF_VERSION_1_2(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -12479,14 +12487,14 @@ static int
 loci_validate_of_group_mod_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -12517,14 +12525,14 @@ static int
 loci_validate_of_group_add_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -12545,14 +12553,14 @@ static int
 loci_validate_of_group_delete_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -12573,14 +12581,14 @@ static int
 loci_validate_of_group_desc_stats_entry_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -12601,14 +12609,14 @@ static int
 loci_validate_of_group_desc_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -12629,7 +12637,7 @@ static int
 loci_validate_of_group_desc_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -12637,7 +12645,7 @@ loci_validate_of_group_desc_stats_request_OF_VERSION_1_2(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -12651,7 +12659,7 @@ static int
 loci_validate_of_group_features_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REPLY, SHORT);
     }
 
     len = 56;
@@ -12659,7 +12667,7 @@ loci_validate_of_group_features_stats_reply_OF_VERSION_1_2(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REPLY, LENGTH);
     }
 
 
@@ -12673,7 +12681,7 @@ static int
 loci_validate_of_group_features_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -12681,7 +12689,7 @@ loci_validate_of_group_features_stats_request_OF_VERSION_1_2(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REQUEST, LENGTH);
     }
 
 
@@ -12695,14 +12703,14 @@ static int
 loci_validate_of_group_mod_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -12718,14 +12726,14 @@ static int
 loci_validate_of_group_modify_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -12746,14 +12754,14 @@ static int
 loci_validate_of_group_stats_entry_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -12774,14 +12782,14 @@ static int
 loci_validate_of_group_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -12802,7 +12810,7 @@ static int
 loci_validate_of_group_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -12810,7 +12818,7 @@ loci_validate_of_group_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, LENGTH);
     }
 
 
@@ -12824,7 +12832,7 @@ static int
 loci_validate_of_hello_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, SHORT);
     }
 
     len = 8;
@@ -12832,7 +12840,7 @@ loci_validate_of_hello_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, LENGTH);
     }
 
 
@@ -12846,14 +12854,14 @@ static int
 loci_validate_of_hello_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -12869,14 +12877,14 @@ static int
 loci_validate_of_instruction_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, LENGTH);
     }
 
     len = wire_len;
@@ -12908,14 +12916,14 @@ static int
 loci_validate_of_instruction_apply_actions_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -12936,7 +12944,7 @@ static int
 loci_validate_of_instruction_clear_actions_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, SHORT);
     }
 
     len = 8;
@@ -12944,7 +12952,7 @@ loci_validate_of_instruction_clear_actions_OF_VERSION_1_2(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, LENGTH);
     }
 
 
@@ -12958,14 +12966,14 @@ static int
 loci_validate_of_instruction_experimenter_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -12985,7 +12993,7 @@ static int
 loci_validate_of_instruction_goto_table_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, SHORT);
     }
 
     len = 8;
@@ -12993,7 +13001,7 @@ loci_validate_of_instruction_goto_table_OF_VERSION_1_2(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, LENGTH);
     }
 
 
@@ -13007,14 +13015,14 @@ static int
 loci_validate_of_instruction_write_actions_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -13035,7 +13043,7 @@ static int
 loci_validate_of_instruction_write_metadata_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, SHORT);
     }
 
     len = 24;
@@ -13043,7 +13051,7 @@ loci_validate_of_instruction_write_metadata_OF_VERSION_1_2(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, LENGTH);
     }
 
 
@@ -13057,14 +13065,14 @@ static int
 loci_validate_of_match_v3_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V3, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V3, LENGTH);
     }
 
     len = wire_len;
@@ -13085,14 +13093,14 @@ static int
 loci_validate_of_nicira_header_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -13112,7 +13120,7 @@ static int
 loci_validate_of_oxm_arp_op_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_OP, SHORT);
     }
 
     len = 6;
@@ -13128,7 +13136,7 @@ static int
 loci_validate_of_oxm_arp_op_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_OP_MASKED, SHORT);
     }
 
     len = 8;
@@ -13144,7 +13152,7 @@ static int
 loci_validate_of_oxm_arp_sha_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SHA, SHORT);
     }
 
     len = 10;
@@ -13160,7 +13168,7 @@ static int
 loci_validate_of_oxm_arp_sha_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SHA_MASKED, SHORT);
     }
 
     len = 16;
@@ -13176,7 +13184,7 @@ static int
 loci_validate_of_oxm_arp_spa_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SPA, SHORT);
     }
 
     len = 8;
@@ -13192,7 +13200,7 @@ static int
 loci_validate_of_oxm_arp_spa_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SPA_MASKED, SHORT);
     }
 
     len = 12;
@@ -13208,7 +13216,7 @@ static int
 loci_validate_of_oxm_arp_tha_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_THA, SHORT);
     }
 
     len = 10;
@@ -13224,7 +13232,7 @@ static int
 loci_validate_of_oxm_arp_tha_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_THA_MASKED, SHORT);
     }
 
     len = 16;
@@ -13240,7 +13248,7 @@ static int
 loci_validate_of_oxm_arp_tpa_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_TPA, SHORT);
     }
 
     len = 8;
@@ -13256,7 +13264,7 @@ static int
 loci_validate_of_oxm_arp_tpa_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_TPA_MASKED, SHORT);
     }
 
     len = 12;
@@ -13272,7 +13280,7 @@ static int
 loci_validate_of_oxm_bsn_egr_port_group_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_EGR_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -13288,7 +13296,7 @@ static int
 loci_validate_of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_EGR_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -13304,7 +13312,7 @@ static int
 loci_validate_of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_GLOBAL_VRF_ALLOWED, SHORT);
     }
 
     len = 5;
@@ -13320,7 +13328,7 @@ static int
 loci_validate_of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_GLOBAL_VRF_ALLOWED_MASKED, SHORT);
     }
 
     len = 6;
@@ -13336,7 +13344,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_128_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_128, SHORT);
     }
 
     len = 20;
@@ -13352,7 +13360,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_128_MASKED, SHORT);
     }
 
     len = 36;
@@ -13368,7 +13376,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_512_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 68) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_512, SHORT);
     }
 
     len = 68;
@@ -13384,7 +13392,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 132) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_512_MASKED, SHORT);
     }
 
     len = 132;
@@ -13400,7 +13408,7 @@ static int
 loci_validate_of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INGRESS_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -13416,7 +13424,7 @@ static int
 loci_validate_of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INGRESS_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -13432,7 +13440,7 @@ static int
 loci_validate_of_oxm_bsn_ip_fragmentation_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IP_FRAGMENTATION, SHORT);
     }
 
     len = 5;
@@ -13448,7 +13456,7 @@ static int
 loci_validate_of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IP_FRAGMENTATION_MASKED, SHORT);
     }
 
     len = 6;
@@ -13464,7 +13472,7 @@ static int
 loci_validate_of_oxm_bsn_l2_cache_hit_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L2_CACHE_HIT, SHORT);
     }
 
     len = 5;
@@ -13480,7 +13488,7 @@ static int
 loci_validate_of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L2_CACHE_HIT_MASKED, SHORT);
     }
 
     len = 6;
@@ -13496,7 +13504,7 @@ static int
 loci_validate_of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_DST_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -13512,7 +13520,7 @@ static int
 loci_validate_of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_DST_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -13528,7 +13536,7 @@ static int
 loci_validate_of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_INTERFACE_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -13544,7 +13552,7 @@ static int
 loci_validate_of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_INTERFACE_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -13560,7 +13568,7 @@ static int
 loci_validate_of_oxm_bsn_l3_src_class_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_SRC_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -13576,7 +13584,7 @@ static int
 loci_validate_of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_SRC_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -13592,7 +13600,7 @@ static int
 loci_validate_of_oxm_bsn_lag_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_LAG_ID, SHORT);
     }
 
     len = 8;
@@ -13608,7 +13616,7 @@ static int
 loci_validate_of_oxm_bsn_lag_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_LAG_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -13624,7 +13632,7 @@ static int
 loci_validate_of_oxm_bsn_tcp_flags_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_TCP_FLAGS, SHORT);
     }
 
     len = 6;
@@ -13640,7 +13648,7 @@ static int
 loci_validate_of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_TCP_FLAGS_MASKED, SHORT);
     }
 
     len = 8;
@@ -13656,7 +13664,7 @@ static int
 loci_validate_of_oxm_bsn_udf0_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF0, SHORT);
     }
 
     len = 8;
@@ -13672,7 +13680,7 @@ static int
 loci_validate_of_oxm_bsn_udf0_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF0_MASKED, SHORT);
     }
 
     len = 12;
@@ -13688,7 +13696,7 @@ static int
 loci_validate_of_oxm_bsn_udf1_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF1, SHORT);
     }
 
     len = 8;
@@ -13704,7 +13712,7 @@ static int
 loci_validate_of_oxm_bsn_udf1_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF1_MASKED, SHORT);
     }
 
     len = 12;
@@ -13720,7 +13728,7 @@ static int
 loci_validate_of_oxm_bsn_udf2_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF2, SHORT);
     }
 
     len = 8;
@@ -13736,7 +13744,7 @@ static int
 loci_validate_of_oxm_bsn_udf2_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF2_MASKED, SHORT);
     }
 
     len = 12;
@@ -13752,7 +13760,7 @@ static int
 loci_validate_of_oxm_bsn_udf3_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF3, SHORT);
     }
 
     len = 8;
@@ -13768,7 +13776,7 @@ static int
 loci_validate_of_oxm_bsn_udf3_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF3_MASKED, SHORT);
     }
 
     len = 12;
@@ -13784,7 +13792,7 @@ static int
 loci_validate_of_oxm_bsn_udf4_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF4, SHORT);
     }
 
     len = 8;
@@ -13800,7 +13808,7 @@ static int
 loci_validate_of_oxm_bsn_udf4_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF4_MASKED, SHORT);
     }
 
     len = 12;
@@ -13816,7 +13824,7 @@ static int
 loci_validate_of_oxm_bsn_udf5_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF5, SHORT);
     }
 
     len = 8;
@@ -13832,7 +13840,7 @@ static int
 loci_validate_of_oxm_bsn_udf5_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF5_MASKED, SHORT);
     }
 
     len = 12;
@@ -13848,7 +13856,7 @@ static int
 loci_validate_of_oxm_bsn_udf6_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF6, SHORT);
     }
 
     len = 8;
@@ -13864,7 +13872,7 @@ static int
 loci_validate_of_oxm_bsn_udf6_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF6_MASKED, SHORT);
     }
 
     len = 12;
@@ -13880,7 +13888,7 @@ static int
 loci_validate_of_oxm_bsn_udf7_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF7, SHORT);
     }
 
     len = 8;
@@ -13896,7 +13904,7 @@ static int
 loci_validate_of_oxm_bsn_udf7_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF7_MASKED, SHORT);
     }
 
     len = 12;
@@ -13912,7 +13920,7 @@ static int
 loci_validate_of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VLAN_XLATE_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -13928,7 +13936,7 @@ static int
 loci_validate_of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VLAN_XLATE_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -13944,7 +13952,7 @@ static int
 loci_validate_of_oxm_bsn_vrf_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VRF, SHORT);
     }
 
     len = 8;
@@ -13960,7 +13968,7 @@ static int
 loci_validate_of_oxm_bsn_vrf_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VRF_MASKED, SHORT);
     }
 
     len = 12;
@@ -13976,7 +13984,7 @@ static int
 loci_validate_of_oxm_encap_eth_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -13992,7 +14000,7 @@ static int
 loci_validate_of_oxm_encap_eth_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -14008,7 +14016,7 @@ static int
 loci_validate_of_oxm_encap_eth_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -14024,7 +14032,7 @@ static int
 loci_validate_of_oxm_encap_eth_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -14040,7 +14048,7 @@ static int
 loci_validate_of_oxm_encap_eth_type_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -14056,7 +14064,7 @@ static int
 loci_validate_of_oxm_encap_eth_type_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_TYPE_MASKED, SHORT);
     }
 
     len = 8;
@@ -14072,7 +14080,7 @@ static int
 loci_validate_of_oxm_eth_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -14088,7 +14096,7 @@ static int
 loci_validate_of_oxm_eth_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -14104,7 +14112,7 @@ static int
 loci_validate_of_oxm_eth_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -14120,7 +14128,7 @@ static int
 loci_validate_of_oxm_eth_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -14136,7 +14144,7 @@ static int
 loci_validate_of_oxm_eth_type_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -14152,7 +14160,7 @@ static int
 loci_validate_of_oxm_eth_type_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_TYPE_MASKED, SHORT);
     }
 
     len = 8;
@@ -14168,7 +14176,7 @@ static int
 loci_validate_of_oxm_icmpv4_code_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_CODE, SHORT);
     }
 
     len = 5;
@@ -14184,7 +14192,7 @@ static int
 loci_validate_of_oxm_icmpv4_code_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_CODE_MASKED, SHORT);
     }
 
     len = 6;
@@ -14200,7 +14208,7 @@ static int
 loci_validate_of_oxm_icmpv4_type_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_TYPE, SHORT);
     }
 
     len = 5;
@@ -14216,7 +14224,7 @@ static int
 loci_validate_of_oxm_icmpv4_type_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_TYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -14232,7 +14240,7 @@ static int
 loci_validate_of_oxm_icmpv6_code_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_CODE, SHORT);
     }
 
     len = 5;
@@ -14248,7 +14256,7 @@ static int
 loci_validate_of_oxm_icmpv6_code_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_CODE_MASKED, SHORT);
     }
 
     len = 6;
@@ -14264,7 +14272,7 @@ static int
 loci_validate_of_oxm_icmpv6_type_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_TYPE, SHORT);
     }
 
     len = 5;
@@ -14280,7 +14288,7 @@ static int
 loci_validate_of_oxm_icmpv6_type_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_TYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -14296,7 +14304,7 @@ static int
 loci_validate_of_oxm_in_phy_port_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PHY_PORT, SHORT);
     }
 
     len = 8;
@@ -14312,7 +14320,7 @@ static int
 loci_validate_of_oxm_in_phy_port_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PHY_PORT_MASKED, SHORT);
     }
 
     len = 12;
@@ -14328,7 +14336,7 @@ static int
 loci_validate_of_oxm_in_port_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PORT, SHORT);
     }
 
     len = 8;
@@ -14344,7 +14352,7 @@ static int
 loci_validate_of_oxm_in_port_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PORT_MASKED, SHORT);
     }
 
     len = 12;
@@ -14360,7 +14368,7 @@ static int
 loci_validate_of_oxm_ip_dscp_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_DSCP, SHORT);
     }
 
     len = 5;
@@ -14376,7 +14384,7 @@ static int
 loci_validate_of_oxm_ip_dscp_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_DSCP_MASKED, SHORT);
     }
 
     len = 6;
@@ -14392,7 +14400,7 @@ static int
 loci_validate_of_oxm_ip_ecn_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_ECN, SHORT);
     }
 
     len = 5;
@@ -14408,7 +14416,7 @@ static int
 loci_validate_of_oxm_ip_ecn_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_ECN_MASKED, SHORT);
     }
 
     len = 6;
@@ -14424,7 +14432,7 @@ static int
 loci_validate_of_oxm_ip_proto_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_PROTO, SHORT);
     }
 
     len = 5;
@@ -14440,7 +14448,7 @@ static int
 loci_validate_of_oxm_ip_proto_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_PROTO_MASKED, SHORT);
     }
 
     len = 6;
@@ -14456,7 +14464,7 @@ static int
 loci_validate_of_oxm_ipv4_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -14472,7 +14480,7 @@ static int
 loci_validate_of_oxm_ipv4_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_DST_MASKED, SHORT);
     }
 
     len = 12;
@@ -14488,7 +14496,7 @@ static int
 loci_validate_of_oxm_ipv4_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -14504,7 +14512,7 @@ static int
 loci_validate_of_oxm_ipv4_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_SRC_MASKED, SHORT);
     }
 
     len = 12;
@@ -14520,7 +14528,7 @@ static int
 loci_validate_of_oxm_ipv6_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_DST, SHORT);
     }
 
     len = 20;
@@ -14536,7 +14544,7 @@ static int
 loci_validate_of_oxm_ipv6_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_DST_MASKED, SHORT);
     }
 
     len = 36;
@@ -14552,7 +14560,7 @@ static int
 loci_validate_of_oxm_ipv6_flabel_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_FLABEL, SHORT);
     }
 
     len = 8;
@@ -14568,7 +14576,7 @@ static int
 loci_validate_of_oxm_ipv6_flabel_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_FLABEL_MASKED, SHORT);
     }
 
     len = 12;
@@ -14584,7 +14592,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_sll_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_SLL, SHORT);
     }
 
     len = 10;
@@ -14600,7 +14608,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_SLL_MASKED, SHORT);
     }
 
     len = 16;
@@ -14616,7 +14624,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_target_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TARGET, SHORT);
     }
 
     len = 20;
@@ -14632,7 +14640,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_target_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TARGET_MASKED, SHORT);
     }
 
     len = 36;
@@ -14648,7 +14656,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_tll_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TLL, SHORT);
     }
 
     len = 10;
@@ -14664,7 +14672,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TLL_MASKED, SHORT);
     }
 
     len = 16;
@@ -14680,7 +14688,7 @@ static int
 loci_validate_of_oxm_ipv6_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_SRC, SHORT);
     }
 
     len = 20;
@@ -14696,7 +14704,7 @@ static int
 loci_validate_of_oxm_ipv6_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_SRC_MASKED, SHORT);
     }
 
     len = 36;
@@ -14712,7 +14720,7 @@ static int
 loci_validate_of_oxm_metadata_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_METADATA, SHORT);
     }
 
     len = 12;
@@ -14728,7 +14736,7 @@ static int
 loci_validate_of_oxm_metadata_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_METADATA_MASKED, SHORT);
     }
 
     len = 20;
@@ -14744,7 +14752,7 @@ static int
 loci_validate_of_oxm_mpls_label_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_LABEL, SHORT);
     }
 
     len = 8;
@@ -14760,7 +14768,7 @@ static int
 loci_validate_of_oxm_mpls_label_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_LABEL_MASKED, SHORT);
     }
 
     len = 12;
@@ -14776,7 +14784,7 @@ static int
 loci_validate_of_oxm_mpls_tc_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_TC, SHORT);
     }
 
     len = 5;
@@ -14792,7 +14800,7 @@ static int
 loci_validate_of_oxm_mpls_tc_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_TC_MASKED, SHORT);
     }
 
     len = 6;
@@ -14808,7 +14816,7 @@ static int
 loci_validate_of_oxm_nsh_c1_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C1, SHORT);
     }
 
     len = 8;
@@ -14824,7 +14832,7 @@ static int
 loci_validate_of_oxm_nsh_c1_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C1_MASKED, SHORT);
     }
 
     len = 12;
@@ -14840,7 +14848,7 @@ static int
 loci_validate_of_oxm_nsh_c2_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C2, SHORT);
     }
 
     len = 8;
@@ -14856,7 +14864,7 @@ static int
 loci_validate_of_oxm_nsh_c2_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C2_MASKED, SHORT);
     }
 
     len = 12;
@@ -14872,7 +14880,7 @@ static int
 loci_validate_of_oxm_nsh_c3_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C3, SHORT);
     }
 
     len = 8;
@@ -14888,7 +14896,7 @@ static int
 loci_validate_of_oxm_nsh_c3_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C3_MASKED, SHORT);
     }
 
     len = 12;
@@ -14904,7 +14912,7 @@ static int
 loci_validate_of_oxm_nsh_c4_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C4, SHORT);
     }
 
     len = 8;
@@ -14920,7 +14928,7 @@ static int
 loci_validate_of_oxm_nsh_c4_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C4_MASKED, SHORT);
     }
 
     len = 12;
@@ -14936,7 +14944,7 @@ static int
 loci_validate_of_oxm_nsh_mdtype_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_MDTYPE, SHORT);
     }
 
     len = 5;
@@ -14952,7 +14960,7 @@ static int
 loci_validate_of_oxm_nsh_mdtype_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_MDTYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -14968,7 +14976,7 @@ static int
 loci_validate_of_oxm_nsh_np_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_NP, SHORT);
     }
 
     len = 5;
@@ -14984,7 +14992,7 @@ static int
 loci_validate_of_oxm_nsh_np_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_NP_MASKED, SHORT);
     }
 
     len = 6;
@@ -15000,7 +15008,7 @@ static int
 loci_validate_of_oxm_nsi_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSI, SHORT);
     }
 
     len = 5;
@@ -15016,7 +15024,7 @@ static int
 loci_validate_of_oxm_nsi_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSI_MASKED, SHORT);
     }
 
     len = 6;
@@ -15032,7 +15040,7 @@ static int
 loci_validate_of_oxm_nsp_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSP, SHORT);
     }
 
     len = 8;
@@ -15048,7 +15056,7 @@ static int
 loci_validate_of_oxm_nsp_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSP_MASKED, SHORT);
     }
 
     len = 12;
@@ -15064,7 +15072,7 @@ static int
 loci_validate_of_oxm_ovs_tcp_flags_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OVS_TCP_FLAGS, SHORT);
     }
 
     len = 10;
@@ -15080,7 +15088,7 @@ static int
 loci_validate_of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OVS_TCP_FLAGS_MASKED, SHORT);
     }
 
     len = 12;
@@ -15096,7 +15104,7 @@ static int
 loci_validate_of_oxm_sctp_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_DST, SHORT);
     }
 
     len = 6;
@@ -15112,7 +15120,7 @@ static int
 loci_validate_of_oxm_sctp_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -15128,7 +15136,7 @@ static int
 loci_validate_of_oxm_sctp_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_SRC, SHORT);
     }
 
     len = 6;
@@ -15144,7 +15152,7 @@ static int
 loci_validate_of_oxm_sctp_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -15160,7 +15168,7 @@ static int
 loci_validate_of_oxm_tcp_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_DST, SHORT);
     }
 
     len = 6;
@@ -15176,7 +15184,7 @@ static int
 loci_validate_of_oxm_tcp_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -15192,7 +15200,7 @@ static int
 loci_validate_of_oxm_tcp_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_SRC, SHORT);
     }
 
     len = 6;
@@ -15208,7 +15216,7 @@ static int
 loci_validate_of_oxm_tcp_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -15224,7 +15232,7 @@ static int
 loci_validate_of_oxm_tun_flags_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_FLAGS, SHORT);
     }
 
     len = 6;
@@ -15240,7 +15248,7 @@ static int
 loci_validate_of_oxm_tun_flags_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_FLAGS_MASKED, SHORT);
     }
 
     len = 8;
@@ -15256,7 +15264,7 @@ static int
 loci_validate_of_oxm_tun_gbp_flags_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_FLAGS, SHORT);
     }
 
     len = 5;
@@ -15272,7 +15280,7 @@ static int
 loci_validate_of_oxm_tun_gbp_flags_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_FLAGS_MASKED, SHORT);
     }
 
     len = 6;
@@ -15288,7 +15296,7 @@ static int
 loci_validate_of_oxm_tun_gbp_id_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_ID, SHORT);
     }
 
     len = 6;
@@ -15304,7 +15312,7 @@ static int
 loci_validate_of_oxm_tun_gbp_id_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_ID_MASKED, SHORT);
     }
 
     len = 8;
@@ -15320,7 +15328,7 @@ static int
 loci_validate_of_oxm_tun_gpe_flags_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_FLAGS, SHORT);
     }
 
     len = 5;
@@ -15336,7 +15344,7 @@ static int
 loci_validate_of_oxm_tun_gpe_flags_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_FLAGS_MASKED, SHORT);
     }
 
     len = 6;
@@ -15352,7 +15360,7 @@ static int
 loci_validate_of_oxm_tun_gpe_np_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_NP, SHORT);
     }
 
     len = 5;
@@ -15368,7 +15376,7 @@ static int
 loci_validate_of_oxm_tun_gpe_np_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_NP_MASKED, SHORT);
     }
 
     len = 6;
@@ -15384,7 +15392,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -15400,7 +15408,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_DST_MASKED, SHORT);
     }
 
     len = 12;
@@ -15416,7 +15424,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -15432,7 +15440,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_SRC_MASKED, SHORT);
     }
 
     len = 12;
@@ -15448,7 +15456,7 @@ static int
 loci_validate_of_oxm_udp_dst_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_DST, SHORT);
     }
 
     len = 6;
@@ -15464,7 +15472,7 @@ static int
 loci_validate_of_oxm_udp_dst_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -15480,7 +15488,7 @@ static int
 loci_validate_of_oxm_udp_src_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_SRC, SHORT);
     }
 
     len = 6;
@@ -15496,7 +15504,7 @@ static int
 loci_validate_of_oxm_udp_src_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -15512,7 +15520,7 @@ static int
 loci_validate_of_oxm_vlan_pcp_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_PCP, SHORT);
     }
 
     len = 5;
@@ -15528,7 +15536,7 @@ static int
 loci_validate_of_oxm_vlan_pcp_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_PCP_MASKED, SHORT);
     }
 
     len = 6;
@@ -15544,7 +15552,7 @@ static int
 loci_validate_of_oxm_vlan_vid_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_VID, SHORT);
     }
 
     len = 6;
@@ -15560,7 +15568,7 @@ static int
 loci_validate_of_oxm_vlan_vid_masked_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_VID_MASKED, SHORT);
     }
 
     len = 8;
@@ -15576,14 +15584,14 @@ static int
 loci_validate_of_packet_in_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, LENGTH);
     }
 
     len = wire_len;
@@ -15600,14 +15608,14 @@ static int
 loci_validate_of_packet_out_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     len = wire_len;
@@ -15618,7 +15626,7 @@ loci_validate_of_packet_out_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 
 
     if (24 + wire_len_actions > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     if (loci_validate_of_list_action_OF_VERSION_1_2(data + 24, wire_len_actions, out_len) < 0) {
@@ -15634,14 +15642,14 @@ static int
 loci_validate_of_packet_queue_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 8, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, LENGTH);
     }
 
     len = wire_len;
@@ -15662,7 +15670,7 @@ static int
 loci_validate_of_port_desc_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC, SHORT);
     }
 
     len = 64;
@@ -15678,7 +15686,7 @@ static int
 loci_validate_of_port_mod_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, SHORT);
     }
 
     len = 40;
@@ -15686,7 +15694,7 @@ loci_validate_of_port_mod_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, LENGTH);
     }
 
 
@@ -15700,14 +15708,14 @@ static int
 loci_validate_of_port_mod_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -15723,7 +15731,7 @@ static int
 loci_validate_of_port_stats_entry_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 104) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_ENTRY, SHORT);
     }
 
     len = 104;
@@ -15739,14 +15747,14 @@ static int
 loci_validate_of_port_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -15767,7 +15775,7 @@ static int
 loci_validate_of_port_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -15775,7 +15783,7 @@ loci_validate_of_port_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, LENGTH);
     }
 
 
@@ -15789,7 +15797,7 @@ static int
 loci_validate_of_port_status_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, SHORT);
     }
 
     len = 80;
@@ -15797,7 +15805,7 @@ loci_validate_of_port_status_OF_VERSION_1_2(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, LENGTH);
     }
 
 
@@ -15811,14 +15819,14 @@ static int
 loci_validate_of_queue_get_config_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -15839,7 +15847,7 @@ static int
 loci_validate_of_queue_get_config_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 16;
@@ -15847,7 +15855,7 @@ loci_validate_of_queue_get_config_request_OF_VERSION_1_2(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -15861,14 +15869,14 @@ static int
 loci_validate_of_queue_op_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -15884,14 +15892,14 @@ static int
 loci_validate_of_queue_prop_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -15917,14 +15925,14 @@ static int
 loci_validate_of_queue_prop_experimenter_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -15944,7 +15952,7 @@ static int
 loci_validate_of_queue_prop_max_rate_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MAX_RATE, SHORT);
     }
 
     len = 16;
@@ -15952,7 +15960,7 @@ loci_validate_of_queue_prop_max_rate_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MAX_RATE, LENGTH);
     }
 
 
@@ -15966,7 +15974,7 @@ static int
 loci_validate_of_queue_prop_min_rate_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, SHORT);
     }
 
     len = 16;
@@ -15974,7 +15982,7 @@ loci_validate_of_queue_prop_min_rate_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, LENGTH);
     }
 
 
@@ -15988,7 +15996,7 @@ static int
 loci_validate_of_queue_stats_entry_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_ENTRY, SHORT);
     }
 
     len = 32;
@@ -16004,14 +16012,14 @@ static int
 loci_validate_of_queue_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -16032,7 +16040,7 @@ static int
 loci_validate_of_queue_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -16040,7 +16048,7 @@ loci_validate_of_queue_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -16054,7 +16062,7 @@ static int
 loci_validate_of_role_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REPLY, SHORT);
     }
 
     len = 24;
@@ -16062,7 +16070,7 @@ loci_validate_of_role_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REPLY, LENGTH);
     }
 
 
@@ -16076,7 +16084,7 @@ static int
 loci_validate_of_role_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST, SHORT);
     }
 
     len = 24;
@@ -16084,7 +16092,7 @@ loci_validate_of_role_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST, LENGTH);
     }
 
 
@@ -16098,14 +16106,14 @@ static int
 loci_validate_of_role_request_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -16121,7 +16129,7 @@ static int
 loci_validate_of_set_config_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, SHORT);
     }
 
     len = 12;
@@ -16129,7 +16137,7 @@ loci_validate_of_set_config_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, LENGTH);
     }
 
 
@@ -16143,14 +16151,14 @@ static int
 loci_validate_of_switch_config_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -16166,7 +16174,7 @@ static int
 loci_validate_of_table_mod_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, SHORT);
     }
 
     len = 16;
@@ -16174,7 +16182,7 @@ loci_validate_of_table_mod_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, LENGTH);
     }
 
 
@@ -16188,14 +16196,14 @@ static int
 loci_validate_of_table_mod_failed_error_msg_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -16211,7 +16219,7 @@ static int
 loci_validate_of_table_stats_entry_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 128) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_ENTRY, SHORT);
     }
 
     len = 128;
@@ -16227,14 +16235,14 @@ static int
 loci_validate_of_table_stats_reply_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -16255,7 +16263,7 @@ static int
 loci_validate_of_table_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -16263,7 +16271,7 @@ loci_validate_of_table_stats_request_OF_VERSION_1_2(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -17224,14 +17232,14 @@ static int
 loci_validate_of_action_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, LENGTH);
     }
 
     len = wire_len;
@@ -17285,14 +17293,14 @@ static int
 loci_validate_of_action_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID, LENGTH);
     }
 
     len = wire_len;
@@ -17346,14 +17354,14 @@ static int
 loci_validate_of_action_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -17383,14 +17391,14 @@ static int
 loci_validate_of_action_bsn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -17418,14 +17426,14 @@ static int
 loci_validate_of_action_id_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -17455,14 +17463,14 @@ static int
 loci_validate_of_action_id_bsn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -17490,7 +17498,7 @@ static int
 loci_validate_of_action_bsn_checksum_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, SHORT);
     }
 
     len = 28;
@@ -17498,7 +17506,7 @@ loci_validate_of_action_bsn_checksum_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, LENGTH);
     }
 
 
@@ -17512,7 +17520,7 @@ static int
 loci_validate_of_action_id_bsn_checksum_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_CHECKSUM, SHORT);
     }
 
     len = 12;
@@ -17520,7 +17528,7 @@ loci_validate_of_action_id_bsn_checksum_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_CHECKSUM, LENGTH);
     }
 
 
@@ -17534,14 +17542,14 @@ static int
 loci_validate_of_action_bsn_gentable_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_GENTABLE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_GENTABLE, LENGTH);
     }
 
     len = wire_len;
@@ -17562,7 +17570,7 @@ static int
 loci_validate_of_action_id_bsn_gentable_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_GENTABLE, SHORT);
     }
 
     len = 12;
@@ -17570,7 +17578,7 @@ loci_validate_of_action_id_bsn_gentable_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_GENTABLE, LENGTH);
     }
 
 
@@ -17584,7 +17592,7 @@ static int
 loci_validate_of_action_bsn_mirror_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, SHORT);
     }
 
     len = 24;
@@ -17592,7 +17600,7 @@ loci_validate_of_action_bsn_mirror_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, LENGTH);
     }
 
 
@@ -17606,7 +17614,7 @@ static int
 loci_validate_of_action_id_bsn_mirror_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_MIRROR, SHORT);
     }
 
     len = 12;
@@ -17614,7 +17622,7 @@ loci_validate_of_action_id_bsn_mirror_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_MIRROR, LENGTH);
     }
 
 
@@ -17628,7 +17636,7 @@ static int
 loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, SHORT);
     }
 
     len = 16;
@@ -17636,7 +17644,7 @@ loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, LENGTH);
     }
 
 
@@ -17650,7 +17658,7 @@ static int
 loci_validate_of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_SET_TUNNEL_DST, SHORT);
     }
 
     len = 12;
@@ -17658,7 +17666,7 @@ loci_validate_of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_SET_TUNNEL_DST, LENGTH);
     }
 
 
@@ -17672,7 +17680,7 @@ static int
 loci_validate_of_oxm_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM, SHORT);
     }
 
 
@@ -18087,14 +18095,14 @@ static int
 loci_validate_of_action_circuit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_CIRCUIT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_CIRCUIT, LENGTH);
     }
 
     len = wire_len;
@@ -18110,7 +18118,7 @@ static int
 loci_validate_of_action_id_circuit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_CIRCUIT, SHORT);
     }
 
     len = 12;
@@ -18118,7 +18126,7 @@ loci_validate_of_action_id_circuit_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_CIRCUIT, LENGTH);
     }
 
 
@@ -18132,7 +18140,7 @@ static int
 loci_validate_of_action_copy_ttl_in_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, SHORT);
     }
 
     len = 8;
@@ -18140,7 +18148,7 @@ loci_validate_of_action_copy_ttl_in_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, LENGTH);
     }
 
 
@@ -18154,7 +18162,7 @@ static int
 loci_validate_of_action_id_copy_ttl_in_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_IN, SHORT);
     }
 
     len = 4;
@@ -18162,7 +18170,7 @@ loci_validate_of_action_id_copy_ttl_in_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_IN, LENGTH);
     }
 
 
@@ -18176,7 +18184,7 @@ static int
 loci_validate_of_action_copy_ttl_out_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, SHORT);
     }
 
     len = 8;
@@ -18184,7 +18192,7 @@ loci_validate_of_action_copy_ttl_out_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, LENGTH);
     }
 
 
@@ -18198,7 +18206,7 @@ static int
 loci_validate_of_action_id_copy_ttl_out_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_OUT, SHORT);
     }
 
     len = 4;
@@ -18206,7 +18214,7 @@ loci_validate_of_action_id_copy_ttl_out_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_OUT, LENGTH);
     }
 
 
@@ -18220,7 +18228,7 @@ static int
 loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -18228,7 +18236,7 @@ loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, LENGTH);
     }
 
 
@@ -18242,7 +18250,7 @@ static int
 loci_validate_of_action_id_dec_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_MPLS_TTL, SHORT);
     }
 
     len = 4;
@@ -18250,7 +18258,7 @@ loci_validate_of_action_id_dec_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_MPLS_TTL, LENGTH);
     }
 
 
@@ -18264,7 +18272,7 @@ static int
 loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -18272,7 +18280,7 @@ loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, LENGTH);
     }
 
 
@@ -18286,7 +18294,7 @@ static int
 loci_validate_of_action_id_dec_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_NW_TTL, SHORT);
     }
 
     len = 4;
@@ -18294,7 +18302,7 @@ loci_validate_of_action_id_dec_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_NW_TTL, LENGTH);
     }
 
 
@@ -18308,7 +18316,7 @@ static int
 loci_validate_of_action_group_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, SHORT);
     }
 
     len = 8;
@@ -18316,7 +18324,7 @@ loci_validate_of_action_group_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, LENGTH);
     }
 
 
@@ -18330,7 +18338,7 @@ static int
 loci_validate_of_action_id_group_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_GROUP, SHORT);
     }
 
     len = 4;
@@ -18338,7 +18346,7 @@ loci_validate_of_action_id_group_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_GROUP, LENGTH);
     }
 
 
@@ -18352,14 +18360,14 @@ static int
 loci_validate_of_action_nicira_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, LENGTH);
     }
 
     len = wire_len;
@@ -18391,14 +18399,14 @@ static int
 loci_validate_of_action_id_nicira_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA, LENGTH);
     }
 
     len = wire_len;
@@ -18430,7 +18438,7 @@ static int
 loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, SHORT);
     }
 
     len = 16;
@@ -18438,7 +18446,7 @@ loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, LENGTH);
     }
 
 
@@ -18452,7 +18460,7 @@ static int
 loci_validate_of_action_id_nicira_dec_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_DEC_TTL, SHORT);
     }
 
     len = 10;
@@ -18460,7 +18468,7 @@ loci_validate_of_action_id_nicira_dec_ttl_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_DEC_TTL, LENGTH);
     }
 
 
@@ -18474,7 +18482,7 @@ static int
 loci_validate_of_action_nicira_move_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, SHORT);
     }
 
     len = 24;
@@ -18482,7 +18490,7 @@ loci_validate_of_action_nicira_move_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, LENGTH);
     }
 
 
@@ -18496,7 +18504,7 @@ static int
 loci_validate_of_action_id_nicira_move_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_MOVE, SHORT);
     }
 
     len = 10;
@@ -18504,7 +18512,7 @@ loci_validate_of_action_id_nicira_move_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_MOVE, LENGTH);
     }
 
 
@@ -18518,7 +18526,7 @@ static int
 loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, SHORT);
     }
 
     len = 16;
@@ -18526,7 +18534,7 @@ loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, LENGTH);
     }
 
 
@@ -18540,7 +18548,7 @@ static int
 loci_validate_of_action_id_nicira_pop_nsh_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_POP_NSH, SHORT);
     }
 
     len = 10;
@@ -18548,7 +18556,7 @@ loci_validate_of_action_id_nicira_pop_nsh_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_POP_NSH, LENGTH);
     }
 
 
@@ -18562,7 +18570,7 @@ static int
 loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, SHORT);
     }
 
     len = 16;
@@ -18570,7 +18578,7 @@ loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, LENGTH);
     }
 
 
@@ -18584,7 +18592,7 @@ static int
 loci_validate_of_action_id_nicira_push_nsh_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_PUSH_NSH, SHORT);
     }
 
     len = 10;
@@ -18592,7 +18600,7 @@ loci_validate_of_action_id_nicira_push_nsh_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_PUSH_NSH, LENGTH);
     }
 
 
@@ -18606,7 +18614,7 @@ static int
 loci_validate_of_action_nicira_resubmit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, SHORT);
     }
 
     len = 16;
@@ -18614,7 +18622,7 @@ loci_validate_of_action_nicira_resubmit_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, LENGTH);
     }
 
 
@@ -18628,7 +18636,7 @@ static int
 loci_validate_of_action_id_nicira_resubmit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT, SHORT);
     }
 
     len = 10;
@@ -18636,7 +18644,7 @@ loci_validate_of_action_id_nicira_resubmit_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT, LENGTH);
     }
 
 
@@ -18650,7 +18658,7 @@ static int
 loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, SHORT);
     }
 
     len = 16;
@@ -18658,7 +18666,7 @@ loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, LENGTH);
     }
 
 
@@ -18672,7 +18680,7 @@ static int
 loci_validate_of_action_id_nicira_resubmit_table_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT_TABLE, SHORT);
     }
 
     len = 10;
@@ -18680,7 +18688,7 @@ loci_validate_of_action_id_nicira_resubmit_table_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT_TABLE, LENGTH);
     }
 
 
@@ -18694,14 +18702,14 @@ static int
 loci_validate_of_action_ofdpa_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA, LENGTH);
     }
 
     len = wire_len;
@@ -18729,14 +18737,14 @@ static int
 loci_validate_of_action_id_ofdpa_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA, LENGTH);
     }
 
     len = wire_len;
@@ -18764,7 +18772,7 @@ static int
 loci_validate_of_action_ofdpa_pop_cw_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_POP_CW, SHORT);
     }
 
     len = 16;
@@ -18772,7 +18780,7 @@ loci_validate_of_action_ofdpa_pop_cw_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_POP_CW, LENGTH);
     }
 
 
@@ -18786,7 +18794,7 @@ static int
 loci_validate_of_action_id_ofdpa_pop_cw_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_POP_CW, SHORT);
     }
 
     len = 10;
@@ -18794,7 +18802,7 @@ loci_validate_of_action_id_ofdpa_pop_cw_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_POP_CW, LENGTH);
     }
 
 
@@ -18808,7 +18816,7 @@ static int
 loci_validate_of_action_ofdpa_pop_l2_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_POP_L2_HEADER, SHORT);
     }
 
     len = 16;
@@ -18816,7 +18824,7 @@ loci_validate_of_action_ofdpa_pop_l2_header_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_POP_L2_HEADER, LENGTH);
     }
 
 
@@ -18830,7 +18838,7 @@ static int
 loci_validate_of_action_id_ofdpa_pop_l2_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_POP_L2_HEADER, SHORT);
     }
 
     len = 10;
@@ -18838,7 +18846,7 @@ loci_validate_of_action_id_ofdpa_pop_l2_header_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_POP_L2_HEADER, LENGTH);
     }
 
 
@@ -18852,7 +18860,7 @@ static int
 loci_validate_of_action_ofdpa_push_cw_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_PUSH_CW, SHORT);
     }
 
     len = 16;
@@ -18860,7 +18868,7 @@ loci_validate_of_action_ofdpa_push_cw_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_PUSH_CW, LENGTH);
     }
 
 
@@ -18874,7 +18882,7 @@ static int
 loci_validate_of_action_id_ofdpa_push_cw_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_PUSH_CW, SHORT);
     }
 
     len = 10;
@@ -18882,7 +18890,7 @@ loci_validate_of_action_id_ofdpa_push_cw_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_PUSH_CW, LENGTH);
     }
 
 
@@ -18896,7 +18904,7 @@ static int
 loci_validate_of_action_ofdpa_push_l2_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_PUSH_L2_HEADER, SHORT);
     }
 
     len = 16;
@@ -18904,7 +18912,7 @@ loci_validate_of_action_ofdpa_push_l2_header_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OFDPA_PUSH_L2_HEADER, LENGTH);
     }
 
 
@@ -18918,7 +18926,7 @@ static int
 loci_validate_of_action_id_ofdpa_push_l2_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_PUSH_L2_HEADER, SHORT);
     }
 
     len = 10;
@@ -18926,7 +18934,7 @@ loci_validate_of_action_id_ofdpa_push_l2_header_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OFDPA_PUSH_L2_HEADER, LENGTH);
     }
 
 
@@ -18940,14 +18948,14 @@ static int
 loci_validate_of_action_oplink_att_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OPLINK_ATT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OPLINK_ATT, LENGTH);
     }
 
     len = wire_len;
@@ -18963,7 +18971,7 @@ static int
 loci_validate_of_action_id_oplink_att_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OPLINK_ATT, SHORT);
     }
 
     len = 12;
@@ -18971,7 +18979,7 @@ loci_validate_of_action_id_oplink_att_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OPLINK_ATT, LENGTH);
     }
 
 
@@ -18985,7 +18993,7 @@ static int
 loci_validate_of_action_output_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, SHORT);
     }
 
     len = 16;
@@ -18993,7 +19001,7 @@ loci_validate_of_action_output_OF_VERSION_1_3(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, LENGTH);
     }
 
 
@@ -19007,7 +19015,7 @@ static int
 loci_validate_of_action_id_output_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OUTPUT, SHORT);
     }
 
     len = 4;
@@ -19015,7 +19023,7 @@ loci_validate_of_action_id_output_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OUTPUT, LENGTH);
     }
 
 
@@ -19029,7 +19037,7 @@ static int
 loci_validate_of_action_pop_mpls_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, SHORT);
     }
 
     len = 8;
@@ -19037,7 +19045,7 @@ loci_validate_of_action_pop_mpls_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, LENGTH);
     }
 
 
@@ -19051,7 +19059,7 @@ static int
 loci_validate_of_action_id_pop_mpls_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_MPLS, SHORT);
     }
 
     len = 4;
@@ -19059,7 +19067,7 @@ loci_validate_of_action_id_pop_mpls_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_MPLS, LENGTH);
     }
 
 
@@ -19073,7 +19081,7 @@ static int
 loci_validate_of_action_pop_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_PBB, SHORT);
     }
 
     len = 8;
@@ -19081,7 +19089,7 @@ loci_validate_of_action_pop_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_PBB, LENGTH);
     }
 
 
@@ -19095,7 +19103,7 @@ static int
 loci_validate_of_action_id_pop_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_PBB, SHORT);
     }
 
     len = 4;
@@ -19103,7 +19111,7 @@ loci_validate_of_action_id_pop_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_PBB, LENGTH);
     }
 
 
@@ -19117,7 +19125,7 @@ static int
 loci_validate_of_action_pop_vlan_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, SHORT);
     }
 
     len = 8;
@@ -19125,7 +19133,7 @@ loci_validate_of_action_pop_vlan_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, LENGTH);
     }
 
 
@@ -19139,7 +19147,7 @@ static int
 loci_validate_of_action_id_pop_vlan_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_VLAN, SHORT);
     }
 
     len = 4;
@@ -19147,7 +19155,7 @@ loci_validate_of_action_id_pop_vlan_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_VLAN, LENGTH);
     }
 
 
@@ -19161,7 +19169,7 @@ static int
 loci_validate_of_action_push_mpls_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, SHORT);
     }
 
     len = 8;
@@ -19169,7 +19177,7 @@ loci_validate_of_action_push_mpls_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, LENGTH);
     }
 
 
@@ -19183,7 +19191,7 @@ static int
 loci_validate_of_action_id_push_mpls_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_MPLS, SHORT);
     }
 
     len = 4;
@@ -19191,7 +19199,7 @@ loci_validate_of_action_id_push_mpls_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_MPLS, LENGTH);
     }
 
 
@@ -19205,7 +19213,7 @@ static int
 loci_validate_of_action_push_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_PBB, SHORT);
     }
 
     len = 8;
@@ -19213,7 +19221,7 @@ loci_validate_of_action_push_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_PBB, LENGTH);
     }
 
 
@@ -19227,7 +19235,7 @@ static int
 loci_validate_of_action_id_push_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_PBB, SHORT);
     }
 
     len = 4;
@@ -19235,7 +19243,7 @@ loci_validate_of_action_id_push_pbb_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_PBB, LENGTH);
     }
 
 
@@ -19249,7 +19257,7 @@ static int
 loci_validate_of_action_push_vlan_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, SHORT);
     }
 
     len = 8;
@@ -19257,7 +19265,7 @@ loci_validate_of_action_push_vlan_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, LENGTH);
     }
 
 
@@ -19271,7 +19279,7 @@ static int
 loci_validate_of_action_id_push_vlan_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_VLAN, SHORT);
     }
 
     len = 4;
@@ -19279,7 +19287,7 @@ loci_validate_of_action_id_push_vlan_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_VLAN, LENGTH);
     }
 
 
@@ -19293,14 +19301,14 @@ static int
 loci_validate_of_action_set_field_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_FIELD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_FIELD, LENGTH);
     }
 
     len = wire_len;
@@ -19316,7 +19324,7 @@ static int
 loci_validate_of_action_id_set_field_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_FIELD, SHORT);
     }
 
     len = 4;
@@ -19324,7 +19332,7 @@ loci_validate_of_action_id_set_field_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_FIELD, LENGTH);
     }
 
 
@@ -19338,7 +19346,7 @@ static int
 loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -19346,7 +19354,7 @@ loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, LENGTH);
     }
 
 
@@ -19360,7 +19368,7 @@ static int
 loci_validate_of_action_id_set_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_MPLS_TTL, SHORT);
     }
 
     len = 4;
@@ -19368,7 +19376,7 @@ loci_validate_of_action_id_set_mpls_ttl_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_MPLS_TTL, LENGTH);
     }
 
 
@@ -19382,7 +19390,7 @@ static int
 loci_validate_of_action_set_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -19390,7 +19398,7 @@ loci_validate_of_action_set_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, LENGTH);
     }
 
 
@@ -19404,7 +19412,7 @@ static int
 loci_validate_of_action_id_set_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_NW_TTL, SHORT);
     }
 
     len = 4;
@@ -19412,7 +19420,7 @@ loci_validate_of_action_id_set_nw_ttl_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_NW_TTL, LENGTH);
     }
 
 
@@ -19426,7 +19434,7 @@ static int
 loci_validate_of_action_set_queue_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, SHORT);
     }
 
     len = 8;
@@ -19434,7 +19442,7 @@ loci_validate_of_action_set_queue_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, LENGTH);
     }
 
 
@@ -19448,7 +19456,7 @@ static int
 loci_validate_of_action_id_set_queue_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_QUEUE, SHORT);
     }
 
     len = 4;
@@ -19456,7 +19464,7 @@ loci_validate_of_action_id_set_queue_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_QUEUE, LENGTH);
     }
 
 
@@ -19470,14 +19478,14 @@ static int
 loci_validate_of_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -19557,14 +19565,14 @@ static int
 loci_validate_of_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -19614,7 +19622,7 @@ static int
 loci_validate_of_aggregate_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, SHORT);
     }
 
     len = 40;
@@ -19622,7 +19630,7 @@ loci_validate_of_aggregate_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, LENGTH);
     }
 
 
@@ -19636,14 +19644,14 @@ static int
 loci_validate_of_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -19693,14 +19701,14 @@ static int
 loci_validate_of_aggregate_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -19717,7 +19725,7 @@ static int
 loci_validate_of_async_get_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REPLY, SHORT);
     }
 
     len = 32;
@@ -19725,7 +19733,7 @@ loci_validate_of_async_get_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REPLY, LENGTH);
     }
 
 
@@ -19739,7 +19747,7 @@ static int
 loci_validate_of_async_get_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REQUEST, SHORT);
     }
 
     len = 32;
@@ -19747,7 +19755,7 @@ loci_validate_of_async_get_request_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REQUEST, LENGTH);
     }
 
 
@@ -19761,7 +19769,7 @@ static int
 loci_validate_of_async_set_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_SET, SHORT);
     }
 
     len = 32;
@@ -19769,7 +19777,7 @@ loci_validate_of_async_set_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_SET, LENGTH);
     }
 
 
@@ -19783,14 +19791,14 @@ static int
 loci_validate_of_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -19840,14 +19848,14 @@ static int
 loci_validate_of_bad_action_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -19863,14 +19871,14 @@ static int
 loci_validate_of_bad_instruction_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -19886,14 +19894,14 @@ static int
 loci_validate_of_bad_match_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -19909,14 +19917,14 @@ static int
 loci_validate_of_bad_request_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -19932,7 +19940,7 @@ static int
 loci_validate_of_barrier_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, SHORT);
     }
 
     len = 8;
@@ -19940,7 +19948,7 @@ loci_validate_of_barrier_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, LENGTH);
     }
 
 
@@ -19954,7 +19962,7 @@ static int
 loci_validate_of_barrier_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, SHORT);
     }
 
     len = 8;
@@ -19962,7 +19970,7 @@ loci_validate_of_barrier_request_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, LENGTH);
     }
 
 
@@ -19976,14 +19984,14 @@ static int
 loci_validate_of_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -20015,14 +20023,14 @@ static int
 loci_validate_of_bsn_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -20150,7 +20158,7 @@ static int
 loci_validate_of_bsn_arp_idle_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ARP_IDLE, SHORT);
     }
 
     len = 24;
@@ -20158,7 +20166,7 @@ loci_validate_of_bsn_arp_idle_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ARP_IDLE, LENGTH);
     }
 
 
@@ -20172,14 +20180,14 @@ static int
 loci_validate_of_experimenter_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -20201,14 +20209,14 @@ static int
 loci_validate_of_bsn_base_error_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BASE_ERROR, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BASE_ERROR, LENGTH);
     }
 
     len = wire_len;
@@ -20230,7 +20238,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, SHORT);
     }
 
     len = 20;
@@ -20238,7 +20246,7 @@ loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, LENGTH);
     }
 
 
@@ -20252,7 +20260,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, SHORT);
     }
 
     len = 16;
@@ -20260,7 +20268,7 @@ loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, LENGTH);
     }
 
 
@@ -20274,7 +20282,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, SHORT);
     }
 
     len = 20;
@@ -20282,7 +20290,7 @@ loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, LENGTH);
     }
 
 
@@ -20296,7 +20304,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -20304,7 +20312,7 @@ loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, LENGTH);
     }
 
 
@@ -20318,7 +20326,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, SHORT);
     }
 
     len = 24;
@@ -20326,7 +20334,7 @@ loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, LENGTH);
     }
 
 
@@ -20340,7 +20348,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, SHORT);
     }
 
     len = 20;
@@ -20348,7 +20356,7 @@ loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, LENGTH);
     }
 
 
@@ -20362,7 +20370,7 @@ static int
 loci_validate_of_bsn_controller_connection_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 264) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTION, SHORT);
     }
 
     len = 264;
@@ -20378,14 +20386,14 @@ static int
 loci_validate_of_bsn_controller_connections_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -20406,7 +20414,7 @@ static int
 loci_validate_of_bsn_controller_connections_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -20414,7 +20422,7 @@ loci_validate_of_bsn_controller_connections_request_OF_VERSION_1_3(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REQUEST, LENGTH);
     }
 
 
@@ -20428,7 +20436,7 @@ static int
 loci_validate_of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 328) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY, SHORT);
     }
 
     len = 328;
@@ -20444,14 +20452,14 @@ static int
 loci_validate_of_experimenter_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -20483,14 +20491,14 @@ static int
 loci_validate_of_bsn_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -20542,14 +20550,14 @@ static int
 loci_validate_of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -20570,14 +20578,14 @@ static int
 loci_validate_of_experimenter_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -20609,14 +20617,14 @@ static int
 loci_validate_of_bsn_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -20668,7 +20676,7 @@ static int
 loci_validate_of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -20676,7 +20684,7 @@ loci_validate_of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_3(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -20690,7 +20698,7 @@ static int
 loci_validate_of_bsn_debug_counter_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_ENTRY, SHORT);
     }
 
     len = 16;
@@ -20706,14 +20714,14 @@ static int
 loci_validate_of_bsn_debug_counter_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -20734,7 +20742,7 @@ static int
 loci_validate_of_bsn_debug_counter_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -20742,7 +20750,7 @@ loci_validate_of_bsn_debug_counter_stats_request_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -20756,14 +20764,14 @@ static int
 loci_validate_of_bsn_error_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ERROR, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ERROR, LENGTH);
     }
 
     len = wire_len;
@@ -20779,7 +20787,7 @@ static int
 loci_validate_of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_ENTRY, SHORT);
     }
 
     len = 8;
@@ -20795,14 +20803,14 @@ static int
 loci_validate_of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -20823,7 +20831,7 @@ static int
 loci_validate_of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST, SHORT);
     }
 
     len = 25;
@@ -20831,7 +20839,7 @@ loci_validate_of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_3(uint8_t *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST, LENGTH);
     }
 
 
@@ -20845,14 +20853,14 @@ static int
 loci_validate_of_bsn_flow_idle_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE, LENGTH);
     }
 
     len = wire_len;
@@ -20869,7 +20877,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY, SHORT);
     }
 
     len = 20;
@@ -20877,7 +20885,7 @@ loci_validate_of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY, LENGTH);
     }
 
 
@@ -20891,7 +20899,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_get_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -20899,7 +20907,7 @@ loci_validate_of_bsn_flow_idle_enable_get_request_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST, LENGTH);
     }
 
 
@@ -20913,7 +20921,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY, SHORT);
     }
 
     len = 24;
@@ -20921,7 +20929,7 @@ loci_validate_of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY, LENGTH);
     }
 
 
@@ -20935,7 +20943,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_set_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST, SHORT);
     }
 
     len = 20;
@@ -20943,7 +20951,7 @@ loci_validate_of_bsn_flow_idle_enable_set_request_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST, LENGTH);
     }
 
 
@@ -20957,14 +20965,14 @@ static int
 loci_validate_of_bsn_generic_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 2) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 2) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -20985,14 +20993,14 @@ static int
 loci_validate_of_bsn_generic_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21013,14 +21021,14 @@ static int
 loci_validate_of_bsn_generic_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -21041,7 +21049,7 @@ static int
 loci_validate_of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_ENTRY, SHORT);
     }
 
     len = 16;
@@ -21057,14 +21065,14 @@ static int
 loci_validate_of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21085,7 +21093,7 @@ static int
 loci_validate_of_bsn_gentable_bucket_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REQUEST, SHORT);
     }
 
     len = 26;
@@ -21093,7 +21101,7 @@ loci_validate_of_bsn_gentable_bucket_stats_request_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REQUEST, LENGTH);
     }
 
 
@@ -21107,7 +21115,7 @@ static int
 loci_validate_of_bsn_gentable_clear_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REPLY, SHORT);
     }
 
     len = 28;
@@ -21115,7 +21123,7 @@ loci_validate_of_bsn_gentable_clear_reply_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REPLY, LENGTH);
     }
 
 
@@ -21129,7 +21137,7 @@ static int
 loci_validate_of_bsn_gentable_clear_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REQUEST, SHORT);
     }
 
     len = 52;
@@ -21137,7 +21145,7 @@ loci_validate_of_bsn_gentable_clear_request_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REQUEST, LENGTH);
     }
 
 
@@ -21151,7 +21159,7 @@ static int
 loci_validate_of_bsn_gentable_desc_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 48) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_ENTRY, SHORT);
     }
 
     len = 48;
@@ -21159,7 +21167,7 @@ loci_validate_of_bsn_gentable_desc_stats_entry_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 48) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_ENTRY, LENGTH);
     }
 
 
@@ -21173,14 +21181,14 @@ static int
 loci_validate_of_bsn_gentable_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21201,7 +21209,7 @@ static int
 loci_validate_of_bsn_gentable_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -21209,7 +21217,7 @@ loci_validate_of_bsn_gentable_desc_stats_request_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -21223,14 +21231,14 @@ static int
 loci_validate_of_bsn_gentable_entry_add_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -21241,7 +21249,7 @@ loci_validate_of_bsn_gentable_entry_add_OF_VERSION_1_3(uint8_t *data, int len, i
 
 
     if (36 + wire_len_key > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_ADD, LENGTH);
     }
 
     if (loci_validate_of_list_bsn_tlv_OF_VERSION_1_3(data + 36, wire_len_key, out_len) < 0) {
@@ -21258,14 +21266,14 @@ static int
 loci_validate_of_bsn_gentable_entry_delete_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -21286,14 +21294,14 @@ static int
 loci_validate_of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -21304,7 +21312,7 @@ loci_validate_of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_3(uint8_t *dat
 
 
     if (20 + wire_len_key > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY, LENGTH);
     }
 
     if (loci_validate_of_list_bsn_tlv_OF_VERSION_1_3(data + 20, wire_len_key, out_len) < 0) {
@@ -21321,14 +21329,14 @@ static int
 loci_validate_of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21349,7 +21357,7 @@ static int
 loci_validate_of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 60;
@@ -21357,7 +21365,7 @@ loci_validate_of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_3(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -21371,14 +21379,14 @@ static int
 loci_validate_of_bsn_gentable_entry_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -21389,7 +21397,7 @@ loci_validate_of_bsn_gentable_entry_stats_entry_OF_VERSION_1_3(uint8_t *data, in
 
 
     if (4 + wire_len_key > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_ENTRY, LENGTH);
     }
 
     if (loci_validate_of_list_bsn_tlv_OF_VERSION_1_3(data + 4, wire_len_key, out_len) < 0) {
@@ -21406,14 +21414,14 @@ static int
 loci_validate_of_bsn_gentable_entry_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21434,7 +21442,7 @@ static int
 loci_validate_of_bsn_gentable_entry_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REQUEST, SHORT);
     }
 
     len = 60;
@@ -21442,7 +21450,7 @@ loci_validate_of_bsn_gentable_entry_stats_request_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REQUEST, LENGTH);
     }
 
 
@@ -21456,7 +21464,7 @@ static int
 loci_validate_of_bsn_gentable_set_buckets_size_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_SET_BUCKETS_SIZE, SHORT);
     }
 
     len = 24;
@@ -21464,7 +21472,7 @@ loci_validate_of_bsn_gentable_set_buckets_size_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_SET_BUCKETS_SIZE, LENGTH);
     }
 
 
@@ -21478,7 +21486,7 @@ static int
 loci_validate_of_bsn_gentable_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_ENTRY, SHORT);
     }
 
     len = 24;
@@ -21494,14 +21502,14 @@ static int
 loci_validate_of_bsn_gentable_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21522,7 +21530,7 @@ static int
 loci_validate_of_bsn_gentable_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -21530,7 +21538,7 @@ loci_validate_of_bsn_gentable_stats_request_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -21544,14 +21552,14 @@ static int
 loci_validate_of_bsn_get_interfaces_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21572,7 +21580,7 @@ static int
 loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, SHORT);
     }
 
     len = 16;
@@ -21580,7 +21588,7 @@ loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, LENGTH);
     }
 
 
@@ -21594,7 +21602,7 @@ static int
 loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, SHORT);
     }
 
     len = 20;
@@ -21602,7 +21610,7 @@ loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, LENGTH);
     }
 
 
@@ -21616,7 +21624,7 @@ static int
 loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, SHORT);
     }
 
     len = 20;
@@ -21624,7 +21632,7 @@ loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, LENGTH);
     }
 
 
@@ -21638,7 +21646,7 @@ static int
 loci_validate_of_bsn_get_switch_pipeline_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REPLY, SHORT);
     }
 
     len = 272;
@@ -21646,7 +21654,7 @@ loci_validate_of_bsn_get_switch_pipeline_reply_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REPLY, LENGTH);
     }
 
 
@@ -21660,7 +21668,7 @@ static int
 loci_validate_of_bsn_get_switch_pipeline_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REQUEST, SHORT);
     }
 
     len = 16;
@@ -21668,7 +21676,7 @@ loci_validate_of_bsn_get_switch_pipeline_request_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REQUEST, LENGTH);
     }
 
 
@@ -21682,7 +21690,7 @@ static int
 loci_validate_of_bsn_image_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 536) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REPLY, SHORT);
     }
 
     len = 536;
@@ -21690,7 +21698,7 @@ loci_validate_of_bsn_image_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 536) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REPLY, LENGTH);
     }
 
 
@@ -21704,7 +21712,7 @@ static int
 loci_validate_of_bsn_image_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -21712,7 +21720,7 @@ loci_validate_of_bsn_image_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -21726,7 +21734,7 @@ static int
 loci_validate_of_bsn_interface_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_INTERFACE, SHORT);
     }
 
     len = 32;
@@ -21742,7 +21750,7 @@ static int
 loci_validate_of_bsn_lacp_convergence_notif_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_CONVERGENCE_NOTIF, SHORT);
     }
 
     len = 52;
@@ -21750,7 +21758,7 @@ loci_validate_of_bsn_lacp_convergence_notif_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_CONVERGENCE_NOTIF, LENGTH);
     }
 
 
@@ -21764,7 +21772,7 @@ static int
 loci_validate_of_bsn_lacp_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_ENTRY, SHORT);
     }
 
     len = 36;
@@ -21780,14 +21788,14 @@ static int
 loci_validate_of_bsn_lacp_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21808,7 +21816,7 @@ static int
 loci_validate_of_bsn_lacp_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -21816,7 +21824,7 @@ loci_validate_of_bsn_lacp_stats_request_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REQUEST, LENGTH);
     }
 
 
@@ -21830,14 +21838,14 @@ static int
 loci_validate_of_bsn_log_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 17) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LOG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 17) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LOG, LENGTH);
     }
 
     len = wire_len;
@@ -21853,14 +21861,14 @@ static int
 loci_validate_of_bsn_lua_command_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -21876,14 +21884,14 @@ static int
 loci_validate_of_bsn_lua_command_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -21899,14 +21907,14 @@ static int
 loci_validate_of_bsn_lua_notification_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_NOTIFICATION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_NOTIFICATION, LENGTH);
     }
 
     len = wire_len;
@@ -21922,14 +21930,14 @@ static int
 loci_validate_of_bsn_lua_upload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 82) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_UPLOAD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 82) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_UPLOAD, LENGTH);
     }
 
     len = wire_len;
@@ -21945,7 +21953,7 @@ static int
 loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, SHORT);
     }
 
     len = 25;
@@ -21953,7 +21961,7 @@ loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, LENGTH);
     }
 
 
@@ -21967,14 +21975,14 @@ static int
 loci_validate_of_bsn_pdu_rx_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -21990,7 +21998,7 @@ static int
 loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, SHORT);
     }
 
     len = 21;
@@ -21998,7 +22006,7 @@ loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, LENGTH);
     }
 
 
@@ -22012,7 +22020,7 @@ static int
 loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, SHORT);
     }
 
     len = 25;
@@ -22020,7 +22028,7 @@ loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, LENGTH);
     }
 
 
@@ -22034,14 +22042,14 @@ static int
 loci_validate_of_bsn_pdu_tx_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -22057,14 +22065,14 @@ static int
 loci_validate_of_bsn_port_counter_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -22085,14 +22093,14 @@ static int
 loci_validate_of_bsn_port_counter_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -22113,7 +22121,7 @@ static int
 loci_validate_of_bsn_port_counter_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 28;
@@ -22121,7 +22129,7 @@ loci_validate_of_bsn_port_counter_stats_request_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -22135,7 +22143,7 @@ static int
 loci_validate_of_bsn_role_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ROLE_STATUS, SHORT);
     }
 
     len = 32;
@@ -22143,7 +22151,7 @@ loci_validate_of_bsn_role_status_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ROLE_STATUS, LENGTH);
     }
 
 
@@ -22157,7 +22165,7 @@ static int
 loci_validate_of_bsn_set_aux_cxns_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REPLY, SHORT);
     }
 
     len = 24;
@@ -22165,7 +22173,7 @@ loci_validate_of_bsn_set_aux_cxns_reply_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REPLY, LENGTH);
     }
 
 
@@ -22179,7 +22187,7 @@ static int
 loci_validate_of_bsn_set_aux_cxns_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REQUEST, SHORT);
     }
 
     len = 20;
@@ -22187,7 +22195,7 @@ loci_validate_of_bsn_set_aux_cxns_request_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REQUEST, LENGTH);
     }
 
 
@@ -22201,7 +22209,7 @@ static int
 loci_validate_of_bsn_set_lacp_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REPLY, SHORT);
     }
 
     len = 24;
@@ -22209,7 +22217,7 @@ loci_validate_of_bsn_set_lacp_reply_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REPLY, LENGTH);
     }
 
 
@@ -22223,7 +22231,7 @@ static int
 loci_validate_of_bsn_set_lacp_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 38) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REQUEST, SHORT);
     }
 
     len = 38;
@@ -22231,7 +22239,7 @@ loci_validate_of_bsn_set_lacp_request_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 38) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REQUEST, LENGTH);
     }
 
 
@@ -22245,7 +22253,7 @@ static int
 loci_validate_of_bsn_set_mirroring_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, SHORT);
     }
 
     len = 20;
@@ -22253,7 +22261,7 @@ loci_validate_of_bsn_set_mirroring_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, LENGTH);
     }
 
 
@@ -22267,7 +22275,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, SHORT);
     }
 
     len = 20;
@@ -22275,7 +22283,7 @@ loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, LENGTH);
     }
 
 
@@ -22289,7 +22297,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, SHORT);
     }
 
     len = 32;
@@ -22297,7 +22305,7 @@ loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, LENGTH);
     }
 
 
@@ -22311,7 +22319,7 @@ static int
 loci_validate_of_bsn_set_switch_pipeline_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REPLY, SHORT);
     }
 
     len = 20;
@@ -22319,7 +22327,7 @@ loci_validate_of_bsn_set_switch_pipeline_reply_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REPLY, LENGTH);
     }
 
 
@@ -22333,7 +22341,7 @@ static int
 loci_validate_of_bsn_set_switch_pipeline_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REQUEST, SHORT);
     }
 
     len = 272;
@@ -22341,7 +22349,7 @@ loci_validate_of_bsn_set_switch_pipeline_request_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REQUEST, LENGTH);
     }
 
 
@@ -22355,7 +22363,7 @@ static int
 loci_validate_of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 256) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_ENTRY, SHORT);
     }
 
     len = 256;
@@ -22371,14 +22379,14 @@ static int
 loci_validate_of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -22399,7 +22407,7 @@ static int
 loci_validate_of_bsn_switch_pipeline_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -22407,7 +22415,7 @@ loci_validate_of_bsn_switch_pipeline_stats_request_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -22421,7 +22429,7 @@ static int
 loci_validate_of_bsn_table_checksum_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_ENTRY, SHORT);
     }
 
     len = 9;
@@ -22437,14 +22445,14 @@ static int
 loci_validate_of_bsn_table_checksum_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -22465,7 +22473,7 @@ static int
 loci_validate_of_bsn_table_checksum_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -22473,7 +22481,7 @@ loci_validate_of_bsn_table_checksum_stats_request_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REQUEST, LENGTH);
     }
 
 
@@ -22487,7 +22495,7 @@ static int
 loci_validate_of_bsn_table_set_buckets_size_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_SET_BUCKETS_SIZE, SHORT);
     }
 
     len = 24;
@@ -22495,7 +22503,7 @@ loci_validate_of_bsn_table_set_buckets_size_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_SET_BUCKETS_SIZE, LENGTH);
     }
 
 
@@ -22509,7 +22517,7 @@ static int
 loci_validate_of_bsn_time_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REPLY, SHORT);
     }
 
     len = 24;
@@ -22517,7 +22525,7 @@ loci_validate_of_bsn_time_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REPLY, LENGTH);
     }
 
 
@@ -22531,7 +22539,7 @@ static int
 loci_validate_of_bsn_time_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REQUEST, SHORT);
     }
 
     len = 16;
@@ -22539,7 +22547,7 @@ loci_validate_of_bsn_time_request_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REQUEST, LENGTH);
     }
 
 
@@ -22553,14 +22561,14 @@ static int
 loci_validate_of_bsn_tlv_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV, LENGTH);
     }
 
     len = wire_len;
@@ -22868,7 +22876,7 @@ static int
 loci_validate_of_bsn_tlv_actor_key_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_KEY, SHORT);
     }
 
     len = 6;
@@ -22876,7 +22884,7 @@ loci_validate_of_bsn_tlv_actor_key_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_KEY, LENGTH);
     }
 
 
@@ -22890,7 +22898,7 @@ static int
 loci_validate_of_bsn_tlv_actor_port_num_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_NUM, SHORT);
     }
 
     len = 6;
@@ -22898,7 +22906,7 @@ loci_validate_of_bsn_tlv_actor_port_num_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_NUM, LENGTH);
     }
 
 
@@ -22912,7 +22920,7 @@ static int
 loci_validate_of_bsn_tlv_actor_port_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -22920,7 +22928,7 @@ loci_validate_of_bsn_tlv_actor_port_priority_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_PRIORITY, LENGTH);
     }
 
 
@@ -22934,7 +22942,7 @@ static int
 loci_validate_of_bsn_tlv_actor_state_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_STATE, SHORT);
     }
 
     len = 5;
@@ -22942,7 +22950,7 @@ loci_validate_of_bsn_tlv_actor_state_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_STATE, LENGTH);
     }
 
 
@@ -22956,7 +22964,7 @@ static int
 loci_validate_of_bsn_tlv_actor_system_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_MAC, SHORT);
     }
 
     len = 10;
@@ -22964,7 +22972,7 @@ loci_validate_of_bsn_tlv_actor_system_mac_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_MAC, LENGTH);
     }
 
 
@@ -22978,7 +22986,7 @@ static int
 loci_validate_of_bsn_tlv_actor_system_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -22986,7 +22994,7 @@ loci_validate_of_bsn_tlv_actor_system_priority_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_PRIORITY, LENGTH);
     }
 
 
@@ -23000,7 +23008,7 @@ static int
 loci_validate_of_bsn_tlv_anchor_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ANCHOR, SHORT);
     }
 
     len = 6;
@@ -23008,7 +23016,7 @@ loci_validate_of_bsn_tlv_anchor_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ANCHOR, LENGTH);
     }
 
 
@@ -23022,7 +23030,7 @@ static int
 loci_validate_of_bsn_tlv_apply_bytes_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_BYTES, SHORT);
     }
 
     len = 12;
@@ -23030,7 +23038,7 @@ loci_validate_of_bsn_tlv_apply_bytes_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_BYTES, LENGTH);
     }
 
 
@@ -23044,7 +23052,7 @@ static int
 loci_validate_of_bsn_tlv_apply_packets_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_PACKETS, SHORT);
     }
 
     len = 12;
@@ -23052,7 +23060,7 @@ loci_validate_of_bsn_tlv_apply_packets_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_PACKETS, LENGTH);
     }
 
 
@@ -23066,7 +23074,7 @@ static int
 loci_validate_of_bsn_tlv_auto_negotiation_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_AUTO_NEGOTIATION, SHORT);
     }
 
     len = 5;
@@ -23074,7 +23082,7 @@ loci_validate_of_bsn_tlv_auto_negotiation_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_AUTO_NEGOTIATION, LENGTH);
     }
 
 
@@ -23088,7 +23096,7 @@ static int
 loci_validate_of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_QUERY_TIMEOUT, SHORT);
     }
 
     len = 8;
@@ -23096,7 +23104,7 @@ loci_validate_of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_QUERY_TIMEOUT, LENGTH);
     }
 
 
@@ -23110,7 +23118,7 @@ static int
 loci_validate_of_bsn_tlv_broadcast_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_RATE, SHORT);
     }
 
     len = 8;
@@ -23118,7 +23126,7 @@ loci_validate_of_bsn_tlv_broadcast_rate_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_RATE, LENGTH);
     }
 
 
@@ -23132,14 +23140,14 @@ static int
 loci_validate_of_bsn_tlv_bucket_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BUCKET, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BUCKET, LENGTH);
     }
 
     len = wire_len;
@@ -23160,14 +23168,14 @@ static int
 loci_validate_of_bsn_tlv_circuit_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CIRCUIT_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CIRCUIT_ID, LENGTH);
     }
 
     len = wire_len;
@@ -23183,7 +23191,7 @@ static int
 loci_validate_of_bsn_tlv_convergence_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CONVERGENCE_STATUS, SHORT);
     }
 
     len = 5;
@@ -23191,7 +23199,7 @@ loci_validate_of_bsn_tlv_convergence_status_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CONVERGENCE_STATUS, LENGTH);
     }
 
 
@@ -23205,7 +23213,7 @@ static int
 loci_validate_of_bsn_tlv_cpu_lag_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CPU_LAG, SHORT);
     }
 
     len = 4;
@@ -23213,7 +23221,7 @@ loci_validate_of_bsn_tlv_cpu_lag_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CPU_LAG, LENGTH);
     }
 
 
@@ -23227,7 +23235,7 @@ static int
 loci_validate_of_bsn_tlv_crc_enabled_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CRC_ENABLED, SHORT);
     }
 
     len = 5;
@@ -23235,7 +23243,7 @@ loci_validate_of_bsn_tlv_crc_enabled_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CRC_ENABLED, LENGTH);
     }
 
 
@@ -23249,14 +23257,14 @@ static int
 loci_validate_of_bsn_tlv_data_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA, LENGTH);
     }
 
     len = wire_len;
@@ -23272,14 +23280,14 @@ static int
 loci_validate_of_bsn_tlv_data_mask_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA_MASK, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA_MASK, LENGTH);
     }
 
     len = wire_len;
@@ -23295,7 +23303,7 @@ static int
 loci_validate_of_bsn_tlv_decap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DECAP, SHORT);
     }
 
     len = 6;
@@ -23303,7 +23311,7 @@ loci_validate_of_bsn_tlv_decap_OF_VERSION_1_3(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DECAP, LENGTH);
     }
 
 
@@ -23317,7 +23325,7 @@ static int
 loci_validate_of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DISABLE_SRC_MAC_CHECK, SHORT);
     }
 
     len = 4;
@@ -23325,7 +23333,7 @@ loci_validate_of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DISABLE_SRC_MAC_CHECK, LENGTH);
     }
 
 
@@ -23339,7 +23347,7 @@ static int
 loci_validate_of_bsn_tlv_drop_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DROP, SHORT);
     }
 
     len = 4;
@@ -23347,7 +23355,7 @@ loci_validate_of_bsn_tlv_drop_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DROP, LENGTH);
     }
 
 
@@ -23361,7 +23369,7 @@ static int
 loci_validate_of_bsn_tlv_dscp_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DSCP, SHORT);
     }
 
     len = 6;
@@ -23369,7 +23377,7 @@ loci_validate_of_bsn_tlv_dscp_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DSCP, LENGTH);
     }
 
 
@@ -23383,7 +23391,7 @@ static int
 loci_validate_of_bsn_tlv_ecn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ECN, SHORT);
     }
 
     len = 5;
@@ -23391,7 +23399,7 @@ loci_validate_of_bsn_tlv_ecn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ECN, LENGTH);
     }
 
 
@@ -23405,7 +23413,7 @@ static int
 loci_validate_of_bsn_tlv_egress_only_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_ONLY, SHORT);
     }
 
     len = 4;
@@ -23413,7 +23421,7 @@ loci_validate_of_bsn_tlv_egress_only_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_ONLY, LENGTH);
     }
 
 
@@ -23427,7 +23435,7 @@ static int
 loci_validate_of_bsn_tlv_egress_port_group_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -23435,7 +23443,7 @@ loci_validate_of_bsn_tlv_egress_port_group_id_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_PORT_GROUP_ID, LENGTH);
     }
 
 
@@ -23449,7 +23457,7 @@ static int
 loci_validate_of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ENHANCED_HASH_CAPABILITY, SHORT);
     }
 
     len = 12;
@@ -23457,7 +23465,7 @@ loci_validate_of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ENHANCED_HASH_CAPABILITY, LENGTH);
     }
 
 
@@ -23471,7 +23479,7 @@ static int
 loci_validate_of_bsn_tlv_eth_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -23479,7 +23487,7 @@ loci_validate_of_bsn_tlv_eth_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_DST, LENGTH);
     }
 
 
@@ -23493,7 +23501,7 @@ static int
 loci_validate_of_bsn_tlv_eth_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -23501,7 +23509,7 @@ loci_validate_of_bsn_tlv_eth_src_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_SRC, LENGTH);
     }
 
 
@@ -23515,7 +23523,7 @@ static int
 loci_validate_of_bsn_tlv_eth_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -23523,7 +23531,7 @@ loci_validate_of_bsn_tlv_eth_type_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_TYPE, LENGTH);
     }
 
 
@@ -23537,7 +23545,7 @@ static int
 loci_validate_of_bsn_tlv_external_gateway_ip_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_IP, SHORT);
     }
 
     len = 8;
@@ -23545,7 +23553,7 @@ loci_validate_of_bsn_tlv_external_gateway_ip_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_IP, LENGTH);
     }
 
 
@@ -23559,7 +23567,7 @@ static int
 loci_validate_of_bsn_tlv_external_gateway_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_MAC, SHORT);
     }
 
     len = 10;
@@ -23567,7 +23575,7 @@ loci_validate_of_bsn_tlv_external_gateway_mac_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_MAC, LENGTH);
     }
 
 
@@ -23581,7 +23589,7 @@ static int
 loci_validate_of_bsn_tlv_external_ip_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_IP, SHORT);
     }
 
     len = 8;
@@ -23589,7 +23597,7 @@ loci_validate_of_bsn_tlv_external_ip_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_IP, LENGTH);
     }
 
 
@@ -23603,7 +23611,7 @@ static int
 loci_validate_of_bsn_tlv_external_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_MAC, SHORT);
     }
 
     len = 10;
@@ -23611,7 +23619,7 @@ loci_validate_of_bsn_tlv_external_mac_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_MAC, LENGTH);
     }
 
 
@@ -23625,7 +23633,7 @@ static int
 loci_validate_of_bsn_tlv_external_netmask_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_NETMASK, SHORT);
     }
 
     len = 8;
@@ -23633,7 +23641,7 @@ loci_validate_of_bsn_tlv_external_netmask_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_NETMASK, LENGTH);
     }
 
 
@@ -23647,7 +23655,7 @@ static int
 loci_validate_of_bsn_tlv_generation_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_GENERATION_ID, SHORT);
     }
 
     len = 12;
@@ -23655,7 +23663,7 @@ loci_validate_of_bsn_tlv_generation_id_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_GENERATION_ID, LENGTH);
     }
 
 
@@ -23669,7 +23677,7 @@ static int
 loci_validate_of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_HEADER_MATCH, SHORT);
     }
 
     len = 6;
@@ -23677,7 +23685,7 @@ loci_validate_of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_HEADER_MATCH, LENGTH);
     }
 
 
@@ -23691,7 +23699,7 @@ static int
 loci_validate_of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_PORT_MATCH, SHORT);
     }
 
     len = 9;
@@ -23699,7 +23707,7 @@ loci_validate_of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_PORT_MATCH, LENGTH);
     }
 
 
@@ -23713,7 +23721,7 @@ static int
 loci_validate_of_bsn_tlv_hash_packet_field_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_FIELD, SHORT);
     }
 
     len = 12;
@@ -23721,7 +23729,7 @@ loci_validate_of_bsn_tlv_hash_packet_field_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_FIELD, LENGTH);
     }
 
 
@@ -23735,7 +23743,7 @@ static int
 loci_validate_of_bsn_tlv_hash_packet_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_TYPE, SHORT);
     }
 
     len = 5;
@@ -23743,7 +23751,7 @@ loci_validate_of_bsn_tlv_hash_packet_type_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_TYPE, LENGTH);
     }
 
 
@@ -23757,7 +23765,7 @@ static int
 loci_validate_of_bsn_tlv_hash_seed_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_SEED, SHORT);
     }
 
     len = 12;
@@ -23765,7 +23773,7 @@ loci_validate_of_bsn_tlv_hash_seed_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_SEED, LENGTH);
     }
 
 
@@ -23779,7 +23787,7 @@ static int
 loci_validate_of_bsn_tlv_hash_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_TYPE, SHORT);
     }
 
     len = 5;
@@ -23787,7 +23795,7 @@ loci_validate_of_bsn_tlv_hash_type_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_TYPE, LENGTH);
     }
 
 
@@ -23801,7 +23809,7 @@ static int
 loci_validate_of_bsn_tlv_header_size_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HEADER_SIZE, SHORT);
     }
 
     len = 8;
@@ -23809,7 +23817,7 @@ loci_validate_of_bsn_tlv_header_size_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HEADER_SIZE, LENGTH);
     }
 
 
@@ -23823,7 +23831,7 @@ static int
 loci_validate_of_bsn_tlv_icmp_code_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_CODE, SHORT);
     }
 
     len = 5;
@@ -23831,7 +23839,7 @@ loci_validate_of_bsn_tlv_icmp_code_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_CODE, LENGTH);
     }
 
 
@@ -23845,7 +23853,7 @@ static int
 loci_validate_of_bsn_tlv_icmp_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_ID, SHORT);
     }
 
     len = 6;
@@ -23853,7 +23861,7 @@ loci_validate_of_bsn_tlv_icmp_id_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_ID, LENGTH);
     }
 
 
@@ -23867,7 +23875,7 @@ static int
 loci_validate_of_bsn_tlv_icmp_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_TYPE, SHORT);
     }
 
     len = 5;
@@ -23875,7 +23883,7 @@ loci_validate_of_bsn_tlv_icmp_type_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_TYPE, LENGTH);
     }
 
 
@@ -23889,7 +23897,7 @@ static int
 loci_validate_of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMPV6_CHKSUM, SHORT);
     }
 
     len = 6;
@@ -23897,7 +23905,7 @@ loci_validate_of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMPV6_CHKSUM, LENGTH);
     }
 
 
@@ -23911,7 +23919,7 @@ static int
 loci_validate_of_bsn_tlv_idle_notification_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_NOTIFICATION, SHORT);
     }
 
     len = 4;
@@ -23919,7 +23927,7 @@ loci_validate_of_bsn_tlv_idle_notification_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_NOTIFICATION, LENGTH);
     }
 
 
@@ -23933,7 +23941,7 @@ static int
 loci_validate_of_bsn_tlv_idle_time_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIME, SHORT);
     }
 
     len = 12;
@@ -23941,7 +23949,7 @@ loci_validate_of_bsn_tlv_idle_time_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIME, LENGTH);
     }
 
 
@@ -23955,7 +23963,7 @@ static int
 loci_validate_of_bsn_tlv_idle_timeout_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIMEOUT, SHORT);
     }
 
     len = 8;
@@ -23963,7 +23971,7 @@ loci_validate_of_bsn_tlv_idle_timeout_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIMEOUT, LENGTH);
     }
 
 
@@ -23977,7 +23985,7 @@ static int
 loci_validate_of_bsn_tlv_igmp_snooping_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IGMP_SNOOPING, SHORT);
     }
 
     len = 4;
@@ -23985,7 +23993,7 @@ loci_validate_of_bsn_tlv_igmp_snooping_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IGMP_SNOOPING, LENGTH);
     }
 
 
@@ -23999,7 +24007,7 @@ static int
 loci_validate_of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INGRESS_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -24007,7 +24015,7 @@ loci_validate_of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INGRESS_PORT_GROUP_ID, LENGTH);
     }
 
 
@@ -24021,7 +24029,7 @@ static int
 loci_validate_of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_GATEWAY_MAC, SHORT);
     }
 
     len = 10;
@@ -24029,7 +24037,7 @@ loci_validate_of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_GATEWAY_MAC, LENGTH);
     }
 
 
@@ -24043,7 +24051,7 @@ static int
 loci_validate_of_bsn_tlv_internal_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_MAC, SHORT);
     }
 
     len = 10;
@@ -24051,7 +24059,7 @@ loci_validate_of_bsn_tlv_internal_mac_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_MAC, LENGTH);
     }
 
 
@@ -24065,7 +24073,7 @@ static int
 loci_validate_of_bsn_tlv_interval_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERVAL, SHORT);
     }
 
     len = 8;
@@ -24073,7 +24081,7 @@ loci_validate_of_bsn_tlv_interval_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERVAL, LENGTH);
     }
 
 
@@ -24087,7 +24095,7 @@ static int
 loci_validate_of_bsn_tlv_ip_proto_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IP_PROTO, SHORT);
     }
 
     len = 5;
@@ -24095,7 +24103,7 @@ loci_validate_of_bsn_tlv_ip_proto_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IP_PROTO, LENGTH);
     }
 
 
@@ -24109,7 +24117,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4, SHORT);
     }
 
     len = 8;
@@ -24117,7 +24125,7 @@ loci_validate_of_bsn_tlv_ipv4_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4, LENGTH);
     }
 
 
@@ -24131,7 +24139,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -24139,7 +24147,7 @@ loci_validate_of_bsn_tlv_ipv4_dst_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_DST, LENGTH);
     }
 
 
@@ -24153,7 +24161,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_netmask_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_NETMASK, SHORT);
     }
 
     len = 8;
@@ -24161,7 +24169,7 @@ loci_validate_of_bsn_tlv_ipv4_netmask_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_NETMASK, LENGTH);
     }
 
 
@@ -24175,7 +24183,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -24183,7 +24191,7 @@ loci_validate_of_bsn_tlv_ipv4_src_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_SRC, LENGTH);
     }
 
 
@@ -24197,7 +24205,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6, SHORT);
     }
 
     len = 20;
@@ -24205,7 +24213,7 @@ loci_validate_of_bsn_tlv_ipv6_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6, LENGTH);
     }
 
 
@@ -24219,7 +24227,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_DST, SHORT);
     }
 
     len = 20;
@@ -24227,7 +24235,7 @@ loci_validate_of_bsn_tlv_ipv6_dst_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_DST, LENGTH);
     }
 
 
@@ -24241,7 +24249,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_prefix_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_PREFIX, SHORT);
     }
 
     len = 21;
@@ -24249,7 +24257,7 @@ loci_validate_of_bsn_tlv_ipv6_prefix_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_PREFIX, LENGTH);
     }
 
 
@@ -24263,7 +24271,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_SRC, SHORT);
     }
 
     len = 20;
@@ -24271,7 +24279,7 @@ loci_validate_of_bsn_tlv_ipv6_src_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_SRC, LENGTH);
     }
 
 
@@ -24285,7 +24293,7 @@ static int
 loci_validate_of_bsn_tlv_known_multicast_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_KNOWN_MULTICAST_RATE, SHORT);
     }
 
     len = 8;
@@ -24293,7 +24301,7 @@ loci_validate_of_bsn_tlv_known_multicast_rate_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_KNOWN_MULTICAST_RATE, LENGTH);
     }
 
 
@@ -24307,7 +24315,7 @@ static int
 loci_validate_of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L2_MULTICAST_LOOKUP, SHORT);
     }
 
     len = 4;
@@ -24315,7 +24323,7 @@ loci_validate_of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L2_MULTICAST_LOOKUP, LENGTH);
     }
 
 
@@ -24329,7 +24337,7 @@ static int
 loci_validate_of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_DST_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -24337,7 +24345,7 @@ loci_validate_of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_DST_CLASS_ID, LENGTH);
     }
 
 
@@ -24351,7 +24359,7 @@ static int
 loci_validate_of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_INTERFACE_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -24359,7 +24367,7 @@ loci_validate_of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_INTERFACE_CLASS_ID, LENGTH);
     }
 
 
@@ -24373,7 +24381,7 @@ static int
 loci_validate_of_bsn_tlv_l3_src_class_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_SRC_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -24381,7 +24389,7 @@ loci_validate_of_bsn_tlv_l3_src_class_id_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_SRC_CLASS_ID, LENGTH);
     }
 
 
@@ -24395,7 +24403,7 @@ static int
 loci_validate_of_bsn_tlv_loopback_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_LOOPBACK_PORT, SHORT);
     }
 
     len = 8;
@@ -24403,7 +24411,7 @@ loci_validate_of_bsn_tlv_loopback_port_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_LOOPBACK_PORT, LENGTH);
     }
 
 
@@ -24417,7 +24425,7 @@ static int
 loci_validate_of_bsn_tlv_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC, SHORT);
     }
 
     len = 10;
@@ -24425,7 +24433,7 @@ loci_validate_of_bsn_tlv_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC, LENGTH);
     }
 
 
@@ -24439,7 +24447,7 @@ static int
 loci_validate_of_bsn_tlv_mac_mask_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC_MASK, SHORT);
     }
 
     len = 10;
@@ -24447,7 +24455,7 @@ loci_validate_of_bsn_tlv_mac_mask_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC_MASK, LENGTH);
     }
 
 
@@ -24461,7 +24469,7 @@ static int
 loci_validate_of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MCG_TYPE_VXLAN, SHORT);
     }
 
     len = 4;
@@ -24469,7 +24477,7 @@ loci_validate_of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MCG_TYPE_VXLAN, LENGTH);
     }
 
 
@@ -24483,7 +24491,7 @@ static int
 loci_validate_of_bsn_tlv_miss_packets_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MISS_PACKETS, SHORT);
     }
 
     len = 12;
@@ -24491,7 +24499,7 @@ loci_validate_of_bsn_tlv_miss_packets_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MISS_PACKETS, LENGTH);
     }
 
 
@@ -24505,7 +24513,7 @@ static int
 loci_validate_of_bsn_tlv_mpls_control_word_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_CONTROL_WORD, SHORT);
     }
 
     len = 5;
@@ -24513,7 +24521,7 @@ loci_validate_of_bsn_tlv_mpls_control_word_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_CONTROL_WORD, LENGTH);
     }
 
 
@@ -24527,7 +24535,7 @@ static int
 loci_validate_of_bsn_tlv_mpls_label_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_LABEL, SHORT);
     }
 
     len = 8;
@@ -24535,7 +24543,7 @@ loci_validate_of_bsn_tlv_mpls_label_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_LABEL, LENGTH);
     }
 
 
@@ -24549,7 +24557,7 @@ static int
 loci_validate_of_bsn_tlv_mpls_sequenced_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_SEQUENCED, SHORT);
     }
 
     len = 5;
@@ -24557,7 +24565,7 @@ loci_validate_of_bsn_tlv_mpls_sequenced_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_SEQUENCED, LENGTH);
     }
 
 
@@ -24571,7 +24579,7 @@ static int
 loci_validate_of_bsn_tlv_multicast_interface_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MULTICAST_INTERFACE_ID, SHORT);
     }
 
     len = 8;
@@ -24579,7 +24587,7 @@ loci_validate_of_bsn_tlv_multicast_interface_id_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MULTICAST_INTERFACE_ID, LENGTH);
     }
 
 
@@ -24593,14 +24601,14 @@ static int
 loci_validate_of_bsn_tlv_name_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NAME, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NAME, LENGTH);
     }
 
     len = wire_len;
@@ -24616,7 +24624,7 @@ static int
 loci_validate_of_bsn_tlv_ndp_offload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_OFFLOAD, SHORT);
     }
 
     len = 4;
@@ -24624,7 +24632,7 @@ loci_validate_of_bsn_tlv_ndp_offload_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_OFFLOAD, LENGTH);
     }
 
 
@@ -24638,7 +24646,7 @@ static int
 loci_validate_of_bsn_tlv_ndp_static_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_STATIC, SHORT);
     }
 
     len = 4;
@@ -24646,7 +24654,7 @@ loci_validate_of_bsn_tlv_ndp_static_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_STATIC, LENGTH);
     }
 
 
@@ -24660,7 +24668,7 @@ static int
 loci_validate_of_bsn_tlv_negate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEGATE, SHORT);
     }
 
     len = 4;
@@ -24668,7 +24676,7 @@ loci_validate_of_bsn_tlv_negate_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEGATE, LENGTH);
     }
 
 
@@ -24682,7 +24690,7 @@ static int
 loci_validate_of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_IPV4, SHORT);
     }
 
     len = 8;
@@ -24690,7 +24698,7 @@ loci_validate_of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_IPV4, LENGTH);
     }
 
 
@@ -24704,7 +24712,7 @@ static int
 loci_validate_of_bsn_tlv_next_hop_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_MAC, SHORT);
     }
 
     len = 10;
@@ -24712,7 +24720,7 @@ loci_validate_of_bsn_tlv_next_hop_mac_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_MAC, LENGTH);
     }
 
 
@@ -24726,7 +24734,7 @@ static int
 loci_validate_of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXTHOP_TYPE_VXLAN, SHORT);
     }
 
     len = 4;
@@ -24734,7 +24742,7 @@ loci_validate_of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXTHOP_TYPE_VXLAN, LENGTH);
     }
 
 
@@ -24748,7 +24756,7 @@ static int
 loci_validate_of_bsn_tlv_offset_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_OFFSET, SHORT);
     }
 
     len = 6;
@@ -24756,7 +24764,7 @@ loci_validate_of_bsn_tlv_offset_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_OFFSET, LENGTH);
     }
 
 
@@ -24770,7 +24778,7 @@ static int
 loci_validate_of_bsn_tlv_parent_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARENT_PORT, SHORT);
     }
 
     len = 8;
@@ -24778,7 +24786,7 @@ loci_validate_of_bsn_tlv_parent_port_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARENT_PORT, LENGTH);
     }
 
 
@@ -24792,7 +24800,7 @@ static int
 loci_validate_of_bsn_tlv_partner_key_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_KEY, SHORT);
     }
 
     len = 6;
@@ -24800,7 +24808,7 @@ loci_validate_of_bsn_tlv_partner_key_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_KEY, LENGTH);
     }
 
 
@@ -24814,7 +24822,7 @@ static int
 loci_validate_of_bsn_tlv_partner_port_num_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_NUM, SHORT);
     }
 
     len = 6;
@@ -24822,7 +24830,7 @@ loci_validate_of_bsn_tlv_partner_port_num_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_NUM, LENGTH);
     }
 
 
@@ -24836,7 +24844,7 @@ static int
 loci_validate_of_bsn_tlv_partner_port_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -24844,7 +24852,7 @@ loci_validate_of_bsn_tlv_partner_port_priority_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_PRIORITY, LENGTH);
     }
 
 
@@ -24858,7 +24866,7 @@ static int
 loci_validate_of_bsn_tlv_partner_state_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_STATE, SHORT);
     }
 
     len = 5;
@@ -24866,7 +24874,7 @@ loci_validate_of_bsn_tlv_partner_state_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_STATE, LENGTH);
     }
 
 
@@ -24880,7 +24888,7 @@ static int
 loci_validate_of_bsn_tlv_partner_system_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_MAC, SHORT);
     }
 
     len = 10;
@@ -24888,7 +24896,7 @@ loci_validate_of_bsn_tlv_partner_system_mac_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_MAC, LENGTH);
     }
 
 
@@ -24902,7 +24910,7 @@ static int
 loci_validate_of_bsn_tlv_partner_system_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -24910,7 +24918,7 @@ loci_validate_of_bsn_tlv_partner_system_priority_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_PRIORITY, LENGTH);
     }
 
 
@@ -24924,7 +24932,7 @@ static int
 loci_validate_of_bsn_tlv_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT, SHORT);
     }
 
     len = 8;
@@ -24932,7 +24940,7 @@ loci_validate_of_bsn_tlv_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT, LENGTH);
     }
 
 
@@ -24946,7 +24954,7 @@ static int
 loci_validate_of_bsn_tlv_port_usage_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_USAGE, SHORT);
     }
 
     len = 6;
@@ -24954,7 +24962,7 @@ loci_validate_of_bsn_tlv_port_usage_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_USAGE, LENGTH);
     }
 
 
@@ -24968,7 +24976,7 @@ static int
 loci_validate_of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_VXLAN_MODE, SHORT);
     }
 
     len = 5;
@@ -24976,7 +24984,7 @@ loci_validate_of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_VXLAN_MODE, LENGTH);
     }
 
 
@@ -24990,7 +24998,7 @@ static int
 loci_validate_of_bsn_tlv_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PRIORITY, SHORT);
     }
 
     len = 8;
@@ -24998,7 +25006,7 @@ loci_validate_of_bsn_tlv_priority_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PRIORITY, LENGTH);
     }
 
 
@@ -25012,7 +25020,7 @@ static int
 loci_validate_of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PUSH_VLAN_ON_INGRESS, SHORT);
     }
 
     len = 4;
@@ -25020,7 +25028,7 @@ loci_validate_of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PUSH_VLAN_ON_INGRESS, LENGTH);
     }
 
 
@@ -25034,7 +25042,7 @@ static int
 loci_validate_of_bsn_tlv_qos_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QOS_PRIORITY, SHORT);
     }
 
     len = 8;
@@ -25042,7 +25050,7 @@ loci_validate_of_bsn_tlv_qos_priority_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QOS_PRIORITY, LENGTH);
     }
 
 
@@ -25056,7 +25064,7 @@ static int
 loci_validate_of_bsn_tlv_queue_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_ID, SHORT);
     }
 
     len = 8;
@@ -25064,7 +25072,7 @@ loci_validate_of_bsn_tlv_queue_id_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_ID, LENGTH);
     }
 
 
@@ -25078,7 +25086,7 @@ static int
 loci_validate_of_bsn_tlv_queue_weight_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_WEIGHT, SHORT);
     }
 
     len = 8;
@@ -25086,7 +25094,7 @@ loci_validate_of_bsn_tlv_queue_weight_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_WEIGHT, LENGTH);
     }
 
 
@@ -25100,7 +25108,7 @@ static int
 loci_validate_of_bsn_tlv_rate_limit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_LIMIT, SHORT);
     }
 
     len = 8;
@@ -25108,7 +25116,7 @@ loci_validate_of_bsn_tlv_rate_limit_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_LIMIT, LENGTH);
     }
 
 
@@ -25122,7 +25130,7 @@ static int
 loci_validate_of_bsn_tlv_rate_unit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_UNIT, SHORT);
     }
 
     len = 5;
@@ -25130,7 +25138,7 @@ loci_validate_of_bsn_tlv_rate_unit_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_UNIT, LENGTH);
     }
 
 
@@ -25144,14 +25152,14 @@ static int
 loci_validate_of_bsn_tlv_reference_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REFERENCE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REFERENCE, LENGTH);
     }
 
     len = wire_len;
@@ -25172,7 +25180,7 @@ static int
 loci_validate_of_bsn_tlv_reply_packets_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REPLY_PACKETS, SHORT);
     }
 
     len = 12;
@@ -25180,7 +25188,7 @@ loci_validate_of_bsn_tlv_reply_packets_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REPLY_PACKETS, LENGTH);
     }
 
 
@@ -25194,7 +25202,7 @@ static int
 loci_validate_of_bsn_tlv_request_packets_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REQUEST_PACKETS, SHORT);
     }
 
     len = 12;
@@ -25202,7 +25210,7 @@ loci_validate_of_bsn_tlv_request_packets_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REQUEST_PACKETS, LENGTH);
     }
 
 
@@ -25216,7 +25224,7 @@ static int
 loci_validate_of_bsn_tlv_rx_bytes_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_BYTES, SHORT);
     }
 
     len = 12;
@@ -25224,7 +25232,7 @@ loci_validate_of_bsn_tlv_rx_bytes_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_BYTES, LENGTH);
     }
 
 
@@ -25238,7 +25246,7 @@ static int
 loci_validate_of_bsn_tlv_rx_packets_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_PACKETS, SHORT);
     }
 
     len = 12;
@@ -25246,7 +25254,7 @@ loci_validate_of_bsn_tlv_rx_packets_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_PACKETS, LENGTH);
     }
 
 
@@ -25260,7 +25268,7 @@ static int
 loci_validate_of_bsn_tlv_sampling_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SAMPLING_RATE, SHORT);
     }
 
     len = 8;
@@ -25268,7 +25276,7 @@ loci_validate_of_bsn_tlv_sampling_rate_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SAMPLING_RATE, LENGTH);
     }
 
 
@@ -25282,7 +25290,7 @@ static int
 loci_validate_of_bsn_tlv_set_loopback_mode_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SET_LOOPBACK_MODE, SHORT);
     }
 
     len = 4;
@@ -25290,7 +25298,7 @@ loci_validate_of_bsn_tlv_set_loopback_mode_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SET_LOOPBACK_MODE, LENGTH);
     }
 
 
@@ -25304,7 +25312,7 @@ static int
 loci_validate_of_bsn_tlv_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STATUS, SHORT);
     }
 
     len = 5;
@@ -25312,7 +25320,7 @@ loci_validate_of_bsn_tlv_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STATUS, LENGTH);
     }
 
 
@@ -25326,7 +25334,7 @@ static int
 loci_validate_of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L2_ON_INGRESS, SHORT);
     }
 
     len = 4;
@@ -25334,7 +25342,7 @@ loci_validate_of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L2_ON_INGRESS, LENGTH);
     }
 
 
@@ -25348,7 +25356,7 @@ static int
 loci_validate_of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L3_ON_INGRESS, SHORT);
     }
 
     len = 4;
@@ -25356,7 +25364,7 @@ loci_validate_of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L3_ON_INGRESS, LENGTH);
     }
 
 
@@ -25370,7 +25378,7 @@ static int
 loci_validate_of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_VLAN_ON_EGRESS, SHORT);
     }
 
     len = 4;
@@ -25378,7 +25386,7 @@ loci_validate_of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_VLAN_ON_EGRESS, LENGTH);
     }
 
 
@@ -25392,7 +25400,7 @@ static int
 loci_validate_of_bsn_tlv_sub_agent_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SUB_AGENT_ID, SHORT);
     }
 
     len = 8;
@@ -25400,7 +25408,7 @@ loci_validate_of_bsn_tlv_sub_agent_id_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SUB_AGENT_ID, LENGTH);
     }
 
 
@@ -25414,7 +25422,7 @@ static int
 loci_validate_of_bsn_tlv_tcp_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_DST, SHORT);
     }
 
     len = 6;
@@ -25422,7 +25430,7 @@ loci_validate_of_bsn_tlv_tcp_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_DST, LENGTH);
     }
 
 
@@ -25436,7 +25444,7 @@ static int
 loci_validate_of_bsn_tlv_tcp_flags_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_FLAGS, SHORT);
     }
 
     len = 6;
@@ -25444,7 +25452,7 @@ loci_validate_of_bsn_tlv_tcp_flags_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_FLAGS, LENGTH);
     }
 
 
@@ -25458,7 +25466,7 @@ static int
 loci_validate_of_bsn_tlv_tcp_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_SRC, SHORT);
     }
 
     len = 6;
@@ -25466,7 +25474,7 @@ loci_validate_of_bsn_tlv_tcp_src_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_SRC, LENGTH);
     }
 
 
@@ -25480,7 +25488,7 @@ static int
 loci_validate_of_bsn_tlv_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TTL, SHORT);
     }
 
     len = 6;
@@ -25488,7 +25496,7 @@ loci_validate_of_bsn_tlv_ttl_OF_VERSION_1_3(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TTL, LENGTH);
     }
 
 
@@ -25502,7 +25510,7 @@ static int
 loci_validate_of_bsn_tlv_tunnel_capability_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TUNNEL_CAPABILITY, SHORT);
     }
 
     len = 12;
@@ -25510,7 +25518,7 @@ loci_validate_of_bsn_tlv_tunnel_capability_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TUNNEL_CAPABILITY, LENGTH);
     }
 
 
@@ -25524,7 +25532,7 @@ static int
 loci_validate_of_bsn_tlv_tx_bytes_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_BYTES, SHORT);
     }
 
     len = 12;
@@ -25532,7 +25540,7 @@ loci_validate_of_bsn_tlv_tx_bytes_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_BYTES, LENGTH);
     }
 
 
@@ -25546,7 +25554,7 @@ static int
 loci_validate_of_bsn_tlv_tx_packets_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_PACKETS, SHORT);
     }
 
     len = 12;
@@ -25554,7 +25562,7 @@ loci_validate_of_bsn_tlv_tx_packets_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_PACKETS, LENGTH);
     }
 
 
@@ -25568,7 +25576,7 @@ static int
 loci_validate_of_bsn_tlv_udf_anchor_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ANCHOR, SHORT);
     }
 
     len = 6;
@@ -25576,7 +25584,7 @@ loci_validate_of_bsn_tlv_udf_anchor_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ANCHOR, LENGTH);
     }
 
 
@@ -25590,7 +25598,7 @@ static int
 loci_validate_of_bsn_tlv_udf_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ID, SHORT);
     }
 
     len = 6;
@@ -25598,7 +25606,7 @@ loci_validate_of_bsn_tlv_udf_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ID, LENGTH);
     }
 
 
@@ -25612,7 +25620,7 @@ static int
 loci_validate_of_bsn_tlv_udf_length_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_LENGTH, SHORT);
     }
 
     len = 6;
@@ -25620,7 +25628,7 @@ loci_validate_of_bsn_tlv_udf_length_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_LENGTH, LENGTH);
     }
 
 
@@ -25634,7 +25642,7 @@ static int
 loci_validate_of_bsn_tlv_udf_offset_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_OFFSET, SHORT);
     }
 
     len = 6;
@@ -25642,7 +25650,7 @@ loci_validate_of_bsn_tlv_udf_offset_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_OFFSET, LENGTH);
     }
 
 
@@ -25656,7 +25664,7 @@ static int
 loci_validate_of_bsn_tlv_udp_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_DST, SHORT);
     }
 
     len = 6;
@@ -25664,7 +25672,7 @@ loci_validate_of_bsn_tlv_udp_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_DST, LENGTH);
     }
 
 
@@ -25678,7 +25686,7 @@ static int
 loci_validate_of_bsn_tlv_udp_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_SRC, SHORT);
     }
 
     len = 6;
@@ -25686,7 +25694,7 @@ loci_validate_of_bsn_tlv_udp_src_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_SRC, LENGTH);
     }
 
 
@@ -25700,14 +25708,14 @@ static int
 loci_validate_of_bsn_tlv_uint64_list_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UINT64_LIST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UINT64_LIST, LENGTH);
     }
 
     len = wire_len;
@@ -25728,7 +25736,7 @@ static int
 loci_validate_of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_QUERY_TIMEOUT, SHORT);
     }
 
     len = 8;
@@ -25736,7 +25744,7 @@ loci_validate_of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_QUERY_TIMEOUT, LENGTH);
     }
 
 
@@ -25750,7 +25758,7 @@ static int
 loci_validate_of_bsn_tlv_unicast_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_RATE, SHORT);
     }
 
     len = 8;
@@ -25758,7 +25766,7 @@ loci_validate_of_bsn_tlv_unicast_rate_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_RATE, LENGTH);
     }
 
 
@@ -25772,7 +25780,7 @@ static int
 loci_validate_of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNKNOWN_MULTICAST_RATE, SHORT);
     }
 
     len = 8;
@@ -25780,7 +25788,7 @@ loci_validate_of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNKNOWN_MULTICAST_RATE, LENGTH);
     }
 
 
@@ -25794,7 +25802,7 @@ static int
 loci_validate_of_bsn_tlv_untagged_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNTAGGED, SHORT);
     }
 
     len = 4;
@@ -25802,7 +25810,7 @@ loci_validate_of_bsn_tlv_untagged_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNTAGGED, LENGTH);
     }
 
 
@@ -25816,7 +25824,7 @@ static int
 loci_validate_of_bsn_tlv_use_packet_state_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_USE_PACKET_STATE, SHORT);
     }
 
     len = 5;
@@ -25824,7 +25832,7 @@ loci_validate_of_bsn_tlv_use_packet_state_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_USE_PACKET_STATE, LENGTH);
     }
 
 
@@ -25838,7 +25846,7 @@ static int
 loci_validate_of_bsn_tlv_vfi_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFI, SHORT);
     }
 
     len = 6;
@@ -25846,7 +25854,7 @@ loci_validate_of_bsn_tlv_vfi_OF_VERSION_1_3(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFI, LENGTH);
     }
 
 
@@ -25860,7 +25868,7 @@ static int
 loci_validate_of_bsn_tlv_vfp_class_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFP_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -25868,7 +25876,7 @@ loci_validate_of_bsn_tlv_vfp_class_id_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFP_CLASS_ID, LENGTH);
     }
 
 
@@ -25882,14 +25890,14 @@ static int
 loci_validate_of_bsn_tlv_vlan_mac_list_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_MAC_LIST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_MAC_LIST, LENGTH);
     }
 
     len = wire_len;
@@ -25910,7 +25918,7 @@ static int
 loci_validate_of_bsn_tlv_vlan_pcp_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_PCP, SHORT);
     }
 
     len = 5;
@@ -25918,7 +25926,7 @@ loci_validate_of_bsn_tlv_vlan_pcp_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_PCP, LENGTH);
     }
 
 
@@ -25932,7 +25940,7 @@ static int
 loci_validate_of_bsn_tlv_vlan_vid_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID, SHORT);
     }
 
     len = 6;
@@ -25940,7 +25948,7 @@ loci_validate_of_bsn_tlv_vlan_vid_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID, LENGTH);
     }
 
 
@@ -25954,7 +25962,7 @@ static int
 loci_validate_of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID_MASK, SHORT);
     }
 
     len = 6;
@@ -25962,7 +25970,7 @@ loci_validate_of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID_MASK, LENGTH);
     }
 
 
@@ -25976,7 +25984,7 @@ static int
 loci_validate_of_bsn_tlv_vni_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VNI, SHORT);
     }
 
     len = 8;
@@ -25984,7 +25992,7 @@ loci_validate_of_bsn_tlv_vni_OF_VERSION_1_3(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VNI, LENGTH);
     }
 
 
@@ -25998,7 +26006,7 @@ static int
 loci_validate_of_bsn_tlv_vpn_key_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VPN_KEY, SHORT);
     }
 
     len = 8;
@@ -26006,7 +26014,7 @@ loci_validate_of_bsn_tlv_vpn_key_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VPN_KEY, LENGTH);
     }
 
 
@@ -26020,7 +26028,7 @@ static int
 loci_validate_of_bsn_tlv_vrf_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VRF, SHORT);
     }
 
     len = 8;
@@ -26028,7 +26036,7 @@ loci_validate_of_bsn_tlv_vrf_OF_VERSION_1_3(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VRF, LENGTH);
     }
 
 
@@ -26042,7 +26050,7 @@ static int
 loci_validate_of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VXLAN_EGRESS_LAG, SHORT);
     }
 
     len = 4;
@@ -26050,7 +26058,7 @@ loci_validate_of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VXLAN_EGRESS_LAG, LENGTH);
     }
 
 
@@ -26064,7 +26072,7 @@ static int
 loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, SHORT);
     }
 
     len = 24;
@@ -26072,7 +26080,7 @@ loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, LENGTH);
     }
 
 
@@ -26086,14 +26094,14 @@ static int
 loci_validate_of_bsn_vport_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, LENGTH);
     }
 
     len = wire_len;
@@ -26117,14 +26125,14 @@ static int
 loci_validate_of_bsn_virtual_port_create_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -26141,7 +26149,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, SHORT);
     }
 
     len = 20;
@@ -26149,7 +26157,7 @@ loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, LENGTH);
     }
 
 
@@ -26163,7 +26171,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, SHORT);
     }
 
     len = 20;
@@ -26171,7 +26179,7 @@ loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, LENGTH);
     }
 
 
@@ -26185,7 +26193,7 @@ static int
 loci_validate_of_bsn_vlan_counter_clear_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_CLEAR, SHORT);
     }
 
     len = 18;
@@ -26193,7 +26201,7 @@ loci_validate_of_bsn_vlan_counter_clear_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_CLEAR, LENGTH);
     }
 
 
@@ -26207,14 +26215,14 @@ static int
 loci_validate_of_bsn_vlan_counter_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -26235,14 +26243,14 @@ static int
 loci_validate_of_bsn_vlan_counter_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26263,7 +26271,7 @@ static int
 loci_validate_of_bsn_vlan_counter_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 26;
@@ -26271,7 +26279,7 @@ loci_validate_of_bsn_vlan_counter_stats_request_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -26285,7 +26293,7 @@ static int
 loci_validate_of_bsn_vlan_mac_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_MAC, SHORT);
     }
 
     len = 8;
@@ -26301,7 +26309,7 @@ static int
 loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, SHORT);
     }
 
     len = 64;
@@ -26309,7 +26317,7 @@ loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, LENGTH);
     }
 
 
@@ -26323,7 +26331,7 @@ static int
 loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, SHORT);
     }
 
     len = 32;
@@ -26331,7 +26339,7 @@ loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, LENGTH);
     }
 
 
@@ -26345,14 +26353,14 @@ static int
 loci_validate_of_bsn_vrf_counter_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -26373,14 +26381,14 @@ static int
 loci_validate_of_bsn_vrf_counter_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26401,7 +26409,7 @@ static int
 loci_validate_of_bsn_vrf_counter_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 28;
@@ -26409,7 +26417,7 @@ loci_validate_of_bsn_vrf_counter_stats_request_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -26423,14 +26431,14 @@ static int
 loci_validate_of_bucket_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, LENGTH);
     }
 
     len = wire_len;
@@ -26451,7 +26459,7 @@ static int
 loci_validate_of_bucket_counter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET_COUNTER, SHORT);
     }
 
     len = 16;
@@ -26467,14 +26475,14 @@ static int
 loci_validate_of_calient_flow_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 128) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_FLOW_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 128) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_FLOW_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -26492,14 +26500,14 @@ static int
 loci_validate_of_calient_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26525,14 +26533,14 @@ static int
 loci_validate_of_calient_flow_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_FLOW_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_FLOW_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26553,14 +26561,14 @@ static int
 loci_validate_of_calient_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -26586,14 +26594,14 @@ static int
 loci_validate_of_calient_flow_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_FLOW_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_FLOW_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -26610,14 +26618,14 @@ static int
 loci_validate_of_calient_port_desc_prop_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -26639,7 +26647,7 @@ static int
 loci_validate_of_calient_port_desc_prop_optical_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 240) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_PROP_OPTICAL, SHORT);
     }
 
     len = 240;
@@ -26647,7 +26655,7 @@ loci_validate_of_calient_port_desc_prop_optical_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 240) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_PROP_OPTICAL, LENGTH);
     }
 
 
@@ -26661,14 +26669,14 @@ static int
 loci_validate_of_calient_port_desc_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -26689,14 +26697,14 @@ static int
 loci_validate_of_calient_port_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26717,7 +26725,7 @@ static int
 loci_validate_of_calient_port_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -26725,7 +26733,7 @@ loci_validate_of_calient_port_desc_stats_request_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -26739,7 +26747,7 @@ static int
 loci_validate_of_calient_port_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 104) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATS_ENTRY, SHORT);
     }
 
     len = 104;
@@ -26747,7 +26755,7 @@ loci_validate_of_calient_port_stats_entry_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 104) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATS_ENTRY, LENGTH);
     }
 
 
@@ -26761,14 +26769,14 @@ static int
 loci_validate_of_calient_port_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26789,7 +26797,7 @@ static int
 loci_validate_of_calient_port_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATS_REQUEST, SHORT);
     }
 
     len = 32;
@@ -26797,7 +26805,7 @@ loci_validate_of_calient_port_stats_request_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATS_REQUEST, LENGTH);
     }
 
 
@@ -26811,14 +26819,14 @@ static int
 loci_validate_of_calient_port_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATUS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_CALIENT_PORT_STATUS, LENGTH);
     }
 
     len = wire_len;
@@ -26834,7 +26842,7 @@ static int
 loci_validate_of_circuit_port_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_CIRCUIT_PORT_STATUS, SHORT);
     }
 
     len = 72;
@@ -26842,7 +26850,7 @@ loci_validate_of_circuit_port_status_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_CIRCUIT_PORT_STATUS, LENGTH);
     }
 
 
@@ -26856,14 +26864,14 @@ static int
 loci_validate_of_circuit_ports_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CIRCUIT_PORTS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CIRCUIT_PORTS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26884,7 +26892,7 @@ static int
 loci_validate_of_circuit_ports_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CIRCUIT_PORTS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -26892,7 +26900,7 @@ loci_validate_of_circuit_ports_request_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_CIRCUIT_PORTS_REQUEST, LENGTH);
     }
 
 
@@ -26906,7 +26914,7 @@ static int
 loci_validate_of_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, SHORT);
     }
 
     len = 1072;
@@ -26914,7 +26922,7 @@ loci_validate_of_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, LENGTH);
     }
 
 
@@ -26928,7 +26936,7 @@ static int
 loci_validate_of_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -26936,7 +26944,7 @@ loci_validate_of_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -26950,14 +26958,14 @@ static int
 loci_validate_of_echo_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -26973,14 +26981,14 @@ static int
 loci_validate_of_echo_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -26996,14 +27004,14 @@ static int
 loci_validate_of_exp_ext_ad_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_EXT_AD_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_EXT_AD_ID, LENGTH);
     }
 
     len = wire_len;
@@ -27027,7 +27035,7 @@ static int
 loci_validate_of_exp_ext_ad_id_port_otn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_EXT_AD_ID_PORT_OTN, SHORT);
     }
 
     len = 72;
@@ -27035,7 +27043,7 @@ loci_validate_of_exp_ext_ad_id_port_otn_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 72) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_EXT_AD_ID_PORT_OTN, LENGTH);
     }
 
 
@@ -27049,7 +27057,7 @@ static int
 loci_validate_of_exp_ext_ad_id_sonet_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_EXT_AD_ID_SONET, SHORT);
     }
 
     len = 24;
@@ -27057,7 +27065,7 @@ loci_validate_of_exp_ext_ad_id_sonet_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_EXT_AD_ID_SONET, LENGTH);
     }
 
 
@@ -27071,14 +27079,14 @@ static int
 loci_validate_of_exp_optical_ext_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_OPTICAL_EXT_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_OPTICAL_EXT_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -27102,14 +27110,14 @@ static int
 loci_validate_of_exp_optical_ext_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_OPTICAL_EXT_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_OPTICAL_EXT_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -27133,14 +27141,14 @@ static int
 loci_validate_of_exp_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT, LENGTH);
     }
 
     len = wire_len;
@@ -27161,14 +27169,14 @@ static int
 loci_validate_of_exp_port_adjacency_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY, LENGTH);
     }
 
     len = wire_len;
@@ -27189,14 +27197,14 @@ static int
 loci_validate_of_exp_port_adjacency_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY_ID, LENGTH);
     }
 
     len = wire_len;
@@ -27217,14 +27225,14 @@ static int
 loci_validate_of_exp_port_adjacency_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -27245,7 +27253,7 @@ static int
 loci_validate_of_exp_port_adjacency_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY_REQUEST, SHORT);
     }
 
     len = 24;
@@ -27253,7 +27261,7 @@ loci_validate_of_exp_port_adjacency_request_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_ADJACENCY_REQUEST, LENGTH);
     }
 
 
@@ -27267,7 +27275,7 @@ static int
 loci_validate_of_exp_port_des_prop_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DES_PROP_HEADER, SHORT);
     }
 
     len = 4;
@@ -27275,7 +27283,7 @@ loci_validate_of_exp_port_des_prop_header_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DES_PROP_HEADER, LENGTH);
     }
 
 
@@ -27289,14 +27297,14 @@ static int
 loci_validate_of_exp_port_desc_prop_optical_transport_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DESC_PROP_OPTICAL_TRANSPORT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DESC_PROP_OPTICAL_TRANSPORT, LENGTH);
     }
 
     len = wire_len;
@@ -27317,14 +27325,14 @@ static int
 loci_validate_of_exp_port_desc_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DESC_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DESC_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -27345,7 +27353,7 @@ static int
 loci_validate_of_exp_port_desc_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DESC_REQUEST, SHORT);
     }
 
     len = 24;
@@ -27353,7 +27361,7 @@ loci_validate_of_exp_port_desc_request_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_DESC_REQUEST, LENGTH);
     }
 
 
@@ -27367,14 +27375,14 @@ static int
 loci_validate_of_exp_port_optical_transport_feature_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_OPTICAL_TRANSPORT_FEATURE_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_OPTICAL_TRANSPORT_FEATURE_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -27394,7 +27402,7 @@ static int
 loci_validate_of_exp_port_optical_transport_layer_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_OPTICAL_TRANSPORT_LAYER_ENTRY, SHORT);
     }
 
     len = 8;
@@ -27410,14 +27418,14 @@ static int
 loci_validate_of_exp_port_optical_transport_layer_stack_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_OPTICAL_TRANSPORT_LAYER_STACK, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXP_PORT_OPTICAL_TRANSPORT_LAYER_STACK, LENGTH);
     }
 
     len = wire_len;
@@ -27438,7 +27446,7 @@ static int
 loci_validate_of_features_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, SHORT);
     }
 
     len = 32;
@@ -27446,7 +27454,7 @@ loci_validate_of_features_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, LENGTH);
     }
 
 
@@ -27460,7 +27468,7 @@ static int
 loci_validate_of_features_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, SHORT);
     }
 
     len = 8;
@@ -27468,7 +27476,7 @@ loci_validate_of_features_request_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, LENGTH);
     }
 
 
@@ -27482,14 +27490,14 @@ static int
 loci_validate_of_flow_mod_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -27521,14 +27529,14 @@ static int
 loci_validate_of_flow_add_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -27546,14 +27554,14 @@ static int
 loci_validate_of_flow_delete_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -27571,14 +27579,14 @@ static int
 loci_validate_of_flow_delete_strict_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -27596,14 +27604,14 @@ static int
 loci_validate_of_flow_mod_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -27619,14 +27627,14 @@ static int
 loci_validate_of_flow_modify_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -27644,14 +27652,14 @@ static int
 loci_validate_of_flow_modify_strict_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -27669,14 +27677,14 @@ static int
 loci_validate_of_flow_removed_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, LENGTH);
     }
 
     len = wire_len;
@@ -27693,14 +27701,14 @@ static int
 loci_validate_of_flow_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -27718,14 +27726,14 @@ static int
 loci_validate_of_flow_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -27746,14 +27754,14 @@ static int
 loci_validate_of_flow_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -27770,7 +27778,7 @@ static int
 loci_validate_of_get_config_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, SHORT);
     }
 
     len = 12;
@@ -27778,7 +27786,7 @@ loci_validate_of_get_config_reply_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, LENGTH);
     }
 
 
@@ -27792,7 +27800,7 @@ static int
 loci_validate_of_get_config_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 8;
@@ -27800,7 +27808,7 @@ loci_validate_of_get_config_request_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -27814,14 +27822,14 @@ static int
 loci_validate_of_group_mod_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -27852,14 +27860,14 @@ static int
 loci_validate_of_group_add_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -27880,14 +27888,14 @@ static int
 loci_validate_of_group_delete_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -27908,14 +27916,14 @@ static int
 loci_validate_of_group_desc_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -27936,14 +27944,14 @@ static int
 loci_validate_of_group_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -27964,7 +27972,7 @@ static int
 loci_validate_of_group_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -27972,7 +27980,7 @@ loci_validate_of_group_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -27986,7 +27994,7 @@ static int
 loci_validate_of_group_features_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REPLY, SHORT);
     }
 
     len = 56;
@@ -27994,7 +28002,7 @@ loci_validate_of_group_features_stats_reply_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REPLY, LENGTH);
     }
 
 
@@ -28008,7 +28016,7 @@ static int
 loci_validate_of_group_features_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -28016,7 +28024,7 @@ loci_validate_of_group_features_stats_request_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REQUEST, LENGTH);
     }
 
 
@@ -28030,14 +28038,14 @@ static int
 loci_validate_of_group_mod_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -28053,14 +28061,14 @@ static int
 loci_validate_of_group_modify_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -28081,14 +28089,14 @@ static int
 loci_validate_of_group_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -28109,14 +28117,14 @@ static int
 loci_validate_of_group_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -28137,7 +28145,7 @@ static int
 loci_validate_of_group_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -28145,7 +28153,7 @@ loci_validate_of_group_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, LENGTH);
     }
 
 
@@ -28159,14 +28167,14 @@ static int
 loci_validate_of_hello_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, LENGTH);
     }
 
     len = wire_len;
@@ -28187,14 +28195,14 @@ static int
 loci_validate_of_hello_elem_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM, LENGTH);
     }
 
     len = wire_len;
@@ -28216,14 +28224,14 @@ static int
 loci_validate_of_hello_elem_versionbitmap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM_VERSIONBITMAP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM_VERSIONBITMAP, LENGTH);
     }
 
     len = wire_len;
@@ -28244,14 +28252,14 @@ static int
 loci_validate_of_hello_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -28267,7 +28275,7 @@ static int
 loci_validate_of_ieee80211_mcs_info_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_IEEE80211_MCS_INFO, SHORT);
     }
 
     len = 16;
@@ -28283,7 +28291,7 @@ static int
 loci_validate_of_ieee80211_ht_cap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_IEEE80211_HT_CAP, SHORT);
     }
 
     len = 26;
@@ -28299,7 +28307,7 @@ static int
 loci_validate_of_ieee80211_vht_mcs_info_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_IEEE80211_VHT_MCS_INFO, SHORT);
     }
 
     len = 8;
@@ -28315,7 +28323,7 @@ static int
 loci_validate_of_ieee80211_vht_cap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_IEEE80211_VHT_CAP, SHORT);
     }
 
     len = 12;
@@ -28331,14 +28339,14 @@ static int
 loci_validate_of_instruction_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, LENGTH);
     }
 
     len = wire_len;
@@ -28372,14 +28380,14 @@ static int
 loci_validate_of_instruction_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID, LENGTH);
     }
 
     len = wire_len;
@@ -28413,14 +28421,14 @@ static int
 loci_validate_of_instruction_apply_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -28441,7 +28449,7 @@ static int
 loci_validate_of_instruction_id_apply_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_APPLY_ACTIONS, SHORT);
     }
 
     len = 4;
@@ -28449,7 +28457,7 @@ loci_validate_of_instruction_id_apply_actions_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_APPLY_ACTIONS, LENGTH);
     }
 
 
@@ -28463,14 +28471,14 @@ static int
 loci_validate_of_instruction_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -28492,14 +28500,14 @@ static int
 loci_validate_of_instruction_bsn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -28551,14 +28559,14 @@ static int
 loci_validate_of_instruction_id_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -28580,14 +28588,14 @@ static int
 loci_validate_of_instruction_id_bsn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -28639,7 +28647,7 @@ static int
 loci_validate_of_instruction_bsn_arp_offload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_ARP_OFFLOAD, SHORT);
     }
 
     len = 16;
@@ -28647,7 +28655,7 @@ loci_validate_of_instruction_bsn_arp_offload_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_ARP_OFFLOAD, LENGTH);
     }
 
 
@@ -28661,7 +28669,7 @@ static int
 loci_validate_of_instruction_id_bsn_arp_offload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_ARP_OFFLOAD, SHORT);
     }
 
     len = 12;
@@ -28669,7 +28677,7 @@ loci_validate_of_instruction_id_bsn_arp_offload_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_ARP_OFFLOAD, LENGTH);
     }
 
 
@@ -28683,7 +28691,7 @@ static int
 loci_validate_of_instruction_bsn_auto_negotiation_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_AUTO_NEGOTIATION, SHORT);
     }
 
     len = 16;
@@ -28691,7 +28699,7 @@ loci_validate_of_instruction_bsn_auto_negotiation_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_AUTO_NEGOTIATION, LENGTH);
     }
 
 
@@ -28705,7 +28713,7 @@ static int
 loci_validate_of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_AUTO_NEGOTIATION, SHORT);
     }
 
     len = 12;
@@ -28713,7 +28721,7 @@ loci_validate_of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_3(uint8_t *dat
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_AUTO_NEGOTIATION, LENGTH);
     }
 
 
@@ -28727,7 +28735,7 @@ static int
 loci_validate_of_instruction_bsn_deny_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DENY, SHORT);
     }
 
     len = 16;
@@ -28735,7 +28743,7 @@ loci_validate_of_instruction_bsn_deny_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DENY, LENGTH);
     }
 
 
@@ -28749,7 +28757,7 @@ static int
 loci_validate_of_instruction_id_bsn_deny_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DENY, SHORT);
     }
 
     len = 12;
@@ -28757,7 +28765,7 @@ loci_validate_of_instruction_id_bsn_deny_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DENY, LENGTH);
     }
 
 
@@ -28771,7 +28779,7 @@ static int
 loci_validate_of_instruction_bsn_dhcp_offload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DHCP_OFFLOAD, SHORT);
     }
 
     len = 16;
@@ -28779,7 +28787,7 @@ loci_validate_of_instruction_bsn_dhcp_offload_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DHCP_OFFLOAD, LENGTH);
     }
 
 
@@ -28793,7 +28801,7 @@ static int
 loci_validate_of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DHCP_OFFLOAD, SHORT);
     }
 
     len = 12;
@@ -28801,7 +28809,7 @@ loci_validate_of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DHCP_OFFLOAD, LENGTH);
     }
 
 
@@ -28815,7 +28823,7 @@ static int
 loci_validate_of_instruction_bsn_disable_l3_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_L3, SHORT);
     }
 
     len = 16;
@@ -28823,7 +28831,7 @@ loci_validate_of_instruction_bsn_disable_l3_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_L3, LENGTH);
     }
 
 
@@ -28837,7 +28845,7 @@ static int
 loci_validate_of_instruction_id_bsn_disable_l3_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_L3, SHORT);
     }
 
     len = 12;
@@ -28845,7 +28853,7 @@ loci_validate_of_instruction_id_bsn_disable_l3_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_L3, LENGTH);
     }
 
 
@@ -28859,7 +28867,7 @@ static int
 loci_validate_of_instruction_bsn_disable_split_horizon_check_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_SPLIT_HORIZON_CHECK, SHORT);
     }
 
     len = 16;
@@ -28867,7 +28875,7 @@ loci_validate_of_instruction_bsn_disable_split_horizon_check_OF_VERSION_1_3(uint
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_SPLIT_HORIZON_CHECK, LENGTH);
     }
 
 
@@ -28881,7 +28889,7 @@ static int
 loci_validate_of_instruction_id_bsn_disable_split_horizon_check_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_SPLIT_HORIZON_CHECK, SHORT);
     }
 
     len = 12;
@@ -28889,7 +28897,7 @@ loci_validate_of_instruction_id_bsn_disable_split_horizon_check_OF_VERSION_1_3(u
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_SPLIT_HORIZON_CHECK, LENGTH);
     }
 
 
@@ -28903,7 +28911,7 @@ static int
 loci_validate_of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_SRC_MAC_CHECK, SHORT);
     }
 
     len = 16;
@@ -28911,7 +28919,7 @@ loci_validate_of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_3(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_SRC_MAC_CHECK, LENGTH);
     }
 
 
@@ -28925,7 +28933,7 @@ static int
 loci_validate_of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_SRC_MAC_CHECK, SHORT);
     }
 
     len = 12;
@@ -28933,7 +28941,7 @@ loci_validate_of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_3(uint8_t
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_SRC_MAC_CHECK, LENGTH);
     }
 
 
@@ -28947,7 +28955,7 @@ static int
 loci_validate_of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_VLAN_COUNTERS, SHORT);
     }
 
     len = 16;
@@ -28955,7 +28963,7 @@ loci_validate_of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_3(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_VLAN_COUNTERS, LENGTH);
     }
 
 
@@ -28969,7 +28977,7 @@ static int
 loci_validate_of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_VLAN_COUNTERS, SHORT);
     }
 
     len = 12;
@@ -28977,7 +28985,7 @@ loci_validate_of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_3(uint8_t
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_VLAN_COUNTERS, LENGTH);
     }
 
 
@@ -28991,7 +28999,7 @@ static int
 loci_validate_of_instruction_bsn_hash_select_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_HASH_SELECT, SHORT);
     }
 
     len = 16;
@@ -28999,7 +29007,7 @@ loci_validate_of_instruction_bsn_hash_select_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_HASH_SELECT, LENGTH);
     }
 
 
@@ -29013,7 +29021,7 @@ static int
 loci_validate_of_instruction_id_bsn_hash_select_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_HASH_SELECT, SHORT);
     }
 
     len = 12;
@@ -29021,7 +29029,7 @@ loci_validate_of_instruction_id_bsn_hash_select_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_HASH_SELECT, LENGTH);
     }
 
 
@@ -29035,7 +29043,7 @@ static int
 loci_validate_of_instruction_bsn_internal_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_INTERNAL_PRIORITY, SHORT);
     }
 
     len = 16;
@@ -29043,7 +29051,7 @@ loci_validate_of_instruction_bsn_internal_priority_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_INTERNAL_PRIORITY, LENGTH);
     }
 
 
@@ -29057,7 +29065,7 @@ static int
 loci_validate_of_instruction_id_bsn_internal_priority_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_INTERNAL_PRIORITY, SHORT);
     }
 
     len = 12;
@@ -29065,7 +29073,7 @@ loci_validate_of_instruction_id_bsn_internal_priority_OF_VERSION_1_3(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_INTERNAL_PRIORITY, LENGTH);
     }
 
 
@@ -29079,7 +29087,7 @@ static int
 loci_validate_of_instruction_bsn_ndp_offload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_NDP_OFFLOAD, SHORT);
     }
 
     len = 16;
@@ -29087,7 +29095,7 @@ loci_validate_of_instruction_bsn_ndp_offload_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_NDP_OFFLOAD, LENGTH);
     }
 
 
@@ -29101,7 +29109,7 @@ static int
 loci_validate_of_instruction_id_bsn_ndp_offload_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_NDP_OFFLOAD, SHORT);
     }
 
     len = 12;
@@ -29109,7 +29117,7 @@ loci_validate_of_instruction_id_bsn_ndp_offload_OF_VERSION_1_3(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_NDP_OFFLOAD, LENGTH);
     }
 
 
@@ -29123,7 +29131,7 @@ static int
 loci_validate_of_instruction_bsn_packet_of_death_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PACKET_OF_DEATH, SHORT);
     }
 
     len = 16;
@@ -29131,7 +29139,7 @@ loci_validate_of_instruction_bsn_packet_of_death_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PACKET_OF_DEATH, LENGTH);
     }
 
 
@@ -29145,7 +29153,7 @@ static int
 loci_validate_of_instruction_id_bsn_packet_of_death_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PACKET_OF_DEATH, SHORT);
     }
 
     len = 12;
@@ -29153,7 +29161,7 @@ loci_validate_of_instruction_id_bsn_packet_of_death_OF_VERSION_1_3(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PACKET_OF_DEATH, LENGTH);
     }
 
 
@@ -29167,7 +29175,7 @@ static int
 loci_validate_of_instruction_bsn_permit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PERMIT, SHORT);
     }
 
     len = 16;
@@ -29175,7 +29183,7 @@ loci_validate_of_instruction_bsn_permit_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PERMIT, LENGTH);
     }
 
 
@@ -29189,7 +29197,7 @@ static int
 loci_validate_of_instruction_id_bsn_permit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PERMIT, SHORT);
     }
 
     len = 12;
@@ -29197,7 +29205,7 @@ loci_validate_of_instruction_id_bsn_permit_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PERMIT, LENGTH);
     }
 
 
@@ -29211,7 +29219,7 @@ static int
 loci_validate_of_instruction_bsn_prioritize_pdus_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PRIORITIZE_PDUS, SHORT);
     }
 
     len = 16;
@@ -29219,7 +29227,7 @@ loci_validate_of_instruction_bsn_prioritize_pdus_OF_VERSION_1_3(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PRIORITIZE_PDUS, LENGTH);
     }
 
 
@@ -29233,7 +29241,7 @@ static int
 loci_validate_of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PRIORITIZE_PDUS, SHORT);
     }
 
     len = 12;
@@ -29241,7 +29249,7 @@ loci_validate_of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_3(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PRIORITIZE_PDUS, LENGTH);
     }
 
 
@@ -29255,7 +29263,7 @@ static int
 loci_validate_of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_REQUIRE_VLAN_XLATE, SHORT);
     }
 
     len = 16;
@@ -29263,7 +29271,7 @@ loci_validate_of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_3(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_REQUIRE_VLAN_XLATE, LENGTH);
     }
 
 
@@ -29277,7 +29285,7 @@ static int
 loci_validate_of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_REQUIRE_VLAN_XLATE, SHORT);
     }
 
     len = 12;
@@ -29285,7 +29293,7 @@ loci_validate_of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_3(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_REQUIRE_VLAN_XLATE, LENGTH);
     }
 
 
@@ -29299,7 +29307,7 @@ static int
 loci_validate_of_instruction_bsn_span_destination_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_SPAN_DESTINATION, SHORT);
     }
 
     len = 16;
@@ -29307,7 +29315,7 @@ loci_validate_of_instruction_bsn_span_destination_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_SPAN_DESTINATION, LENGTH);
     }
 
 
@@ -29321,7 +29329,7 @@ static int
 loci_validate_of_instruction_id_bsn_span_destination_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_SPAN_DESTINATION, SHORT);
     }
 
     len = 12;
@@ -29329,7 +29337,7 @@ loci_validate_of_instruction_id_bsn_span_destination_OF_VERSION_1_3(uint8_t *dat
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_SPAN_DESTINATION, LENGTH);
     }
 
 
@@ -29343,7 +29351,7 @@ static int
 loci_validate_of_instruction_clear_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, SHORT);
     }
 
     len = 8;
@@ -29351,7 +29359,7 @@ loci_validate_of_instruction_clear_actions_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, LENGTH);
     }
 
 
@@ -29365,7 +29373,7 @@ static int
 loci_validate_of_instruction_id_clear_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_CLEAR_ACTIONS, SHORT);
     }
 
     len = 4;
@@ -29373,7 +29381,7 @@ loci_validate_of_instruction_id_clear_actions_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_CLEAR_ACTIONS, LENGTH);
     }
 
 
@@ -29387,7 +29395,7 @@ static int
 loci_validate_of_instruction_goto_table_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, SHORT);
     }
 
     len = 8;
@@ -29395,7 +29403,7 @@ loci_validate_of_instruction_goto_table_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, LENGTH);
     }
 
 
@@ -29409,7 +29417,7 @@ static int
 loci_validate_of_instruction_id_goto_table_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_GOTO_TABLE, SHORT);
     }
 
     len = 4;
@@ -29417,7 +29425,7 @@ loci_validate_of_instruction_id_goto_table_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_GOTO_TABLE, LENGTH);
     }
 
 
@@ -29431,7 +29439,7 @@ static int
 loci_validate_of_instruction_meter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_METER, SHORT);
     }
 
     len = 8;
@@ -29439,7 +29447,7 @@ loci_validate_of_instruction_meter_OF_VERSION_1_3(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_METER, LENGTH);
     }
 
 
@@ -29453,7 +29461,7 @@ static int
 loci_validate_of_instruction_id_meter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_METER, SHORT);
     }
 
     len = 4;
@@ -29461,7 +29469,7 @@ loci_validate_of_instruction_id_meter_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_METER, LENGTH);
     }
 
 
@@ -29475,14 +29483,14 @@ static int
 loci_validate_of_instruction_write_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -29503,7 +29511,7 @@ static int
 loci_validate_of_instruction_id_write_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_ACTIONS, SHORT);
     }
 
     len = 4;
@@ -29511,7 +29519,7 @@ loci_validate_of_instruction_id_write_actions_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_ACTIONS, LENGTH);
     }
 
 
@@ -29525,7 +29533,7 @@ static int
 loci_validate_of_instruction_write_metadata_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, SHORT);
     }
 
     len = 24;
@@ -29533,7 +29541,7 @@ loci_validate_of_instruction_write_metadata_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, LENGTH);
     }
 
 
@@ -29547,7 +29555,7 @@ static int
 loci_validate_of_instruction_id_write_metadata_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_METADATA, SHORT);
     }
 
     len = 4;
@@ -29555,7 +29563,7 @@ loci_validate_of_instruction_id_write_metadata_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_METADATA, LENGTH);
     }
 
 
@@ -29569,14 +29577,14 @@ static int
 loci_validate_of_match_v3_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V3, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V3, LENGTH);
     }
 
     len = wire_len;
@@ -29597,14 +29605,14 @@ static int
 loci_validate_of_meter_band_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND, LENGTH);
     }
 
     len = wire_len;
@@ -29630,7 +29638,7 @@ static int
 loci_validate_of_meter_band_drop_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DROP, SHORT);
     }
 
     len = 16;
@@ -29638,7 +29646,7 @@ loci_validate_of_meter_band_drop_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DROP, LENGTH);
     }
 
 
@@ -29652,7 +29660,7 @@ static int
 loci_validate_of_meter_band_dscp_remark_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DSCP_REMARK, SHORT);
     }
 
     len = 16;
@@ -29660,7 +29668,7 @@ loci_validate_of_meter_band_dscp_remark_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DSCP_REMARK, LENGTH);
     }
 
 
@@ -29674,7 +29682,7 @@ static int
 loci_validate_of_meter_band_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_EXPERIMENTER, SHORT);
     }
 
     len = 16;
@@ -29682,7 +29690,7 @@ loci_validate_of_meter_band_experimenter_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_EXPERIMENTER, LENGTH);
     }
 
 
@@ -29696,7 +29704,7 @@ static int
 loci_validate_of_meter_band_stats_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_STATS, SHORT);
     }
 
     len = 16;
@@ -29712,14 +29720,14 @@ static int
 loci_validate_of_meter_config_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG, LENGTH);
     }
 
     len = wire_len;
@@ -29740,14 +29748,14 @@ static int
 loci_validate_of_meter_config_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -29768,7 +29776,7 @@ static int
 loci_validate_of_meter_config_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -29776,7 +29784,7 @@ loci_validate_of_meter_config_stats_request_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REQUEST, LENGTH);
     }
 
 
@@ -29790,7 +29798,7 @@ static int
 loci_validate_of_meter_features_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES, SHORT);
     }
 
     len = 16;
@@ -29806,7 +29814,7 @@ static int
 loci_validate_of_meter_features_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REPLY, SHORT);
     }
 
     len = 32;
@@ -29814,7 +29822,7 @@ loci_validate_of_meter_features_stats_reply_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REPLY, LENGTH);
     }
 
 
@@ -29829,7 +29837,7 @@ static int
 loci_validate_of_meter_features_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -29837,7 +29845,7 @@ loci_validate_of_meter_features_stats_request_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REQUEST, LENGTH);
     }
 
 
@@ -29851,14 +29859,14 @@ static int
 loci_validate_of_meter_mod_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -29879,14 +29887,14 @@ static int
 loci_validate_of_meter_mod_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -29902,14 +29910,14 @@ static int
 loci_validate_of_meter_stats_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS, LENGTH);
     }
 
     len = wire_len;
@@ -29930,14 +29938,14 @@ static int
 loci_validate_of_meter_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -29958,7 +29966,7 @@ static int
 loci_validate_of_meter_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -29966,7 +29974,7 @@ loci_validate_of_meter_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -29980,14 +29988,14 @@ static int
 loci_validate_of_nicira_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -30007,7 +30015,7 @@ static int
 loci_validate_of_oplink_channel_power_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_CHANNEL_POWER, SHORT);
     }
 
     len = 8;
@@ -30023,14 +30031,14 @@ static int
 loci_validate_of_oplink_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -30054,14 +30062,14 @@ static int
 loci_validate_of_oplink_channel_power_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_CHANNEL_POWER_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_CHANNEL_POWER_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -30082,14 +30090,14 @@ static int
 loci_validate_of_oplink_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -30113,7 +30121,7 @@ static int
 loci_validate_of_oplink_channel_power_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_CHANNEL_POWER_REQUEST, SHORT);
     }
 
     len = 24;
@@ -30121,7 +30129,7 @@ loci_validate_of_oplink_channel_power_request_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_CHANNEL_POWER_REQUEST, LENGTH);
     }
 
 
@@ -30135,14 +30143,14 @@ static int
 loci_validate_of_oplink_exp_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_EXP_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_EXP_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -30164,7 +30172,7 @@ static int
 loci_validate_of_oplink_port_power_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_PORT_POWER, SHORT);
     }
 
     len = 4;
@@ -30180,14 +30188,14 @@ static int
 loci_validate_of_oplink_port_power_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_PORT_POWER_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_PORT_POWER_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -30208,7 +30216,7 @@ static int
 loci_validate_of_oplink_port_power_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_PORT_POWER_REQUEST, SHORT);
     }
 
     len = 24;
@@ -30216,7 +30224,7 @@ loci_validate_of_oplink_port_power_request_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_PORT_POWER_REQUEST, LENGTH);
     }
 
 
@@ -30230,7 +30238,7 @@ static int
 loci_validate_of_oplink_port_power_set_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_PORT_POWER_SET, SHORT);
     }
 
     len = 20;
@@ -30238,7 +30246,7 @@ loci_validate_of_oplink_port_power_set_OF_VERSION_1_3(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OPLINK_PORT_POWER_SET, LENGTH);
     }
 
 
@@ -30252,7 +30260,7 @@ static int
 loci_validate_of_oxm_arp_op_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_OP, SHORT);
     }
 
     len = 6;
@@ -30268,7 +30276,7 @@ static int
 loci_validate_of_oxm_arp_op_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_OP_MASKED, SHORT);
     }
 
     len = 8;
@@ -30284,7 +30292,7 @@ static int
 loci_validate_of_oxm_arp_sha_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SHA, SHORT);
     }
 
     len = 10;
@@ -30300,7 +30308,7 @@ static int
 loci_validate_of_oxm_arp_sha_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SHA_MASKED, SHORT);
     }
 
     len = 16;
@@ -30316,7 +30324,7 @@ static int
 loci_validate_of_oxm_arp_spa_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SPA, SHORT);
     }
 
     len = 8;
@@ -30332,7 +30340,7 @@ static int
 loci_validate_of_oxm_arp_spa_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SPA_MASKED, SHORT);
     }
 
     len = 12;
@@ -30348,7 +30356,7 @@ static int
 loci_validate_of_oxm_arp_tha_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_THA, SHORT);
     }
 
     len = 10;
@@ -30364,7 +30372,7 @@ static int
 loci_validate_of_oxm_arp_tha_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_THA_MASKED, SHORT);
     }
 
     len = 16;
@@ -30380,7 +30388,7 @@ static int
 loci_validate_of_oxm_arp_tpa_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_TPA, SHORT);
     }
 
     len = 8;
@@ -30396,7 +30404,7 @@ static int
 loci_validate_of_oxm_arp_tpa_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_TPA_MASKED, SHORT);
     }
 
     len = 12;
@@ -30412,7 +30420,7 @@ static int
 loci_validate_of_oxm_bsn_egr_port_group_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_EGR_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -30428,7 +30436,7 @@ static int
 loci_validate_of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_EGR_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -30444,7 +30452,7 @@ static int
 loci_validate_of_oxm_bsn_global_vrf_allowed_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_GLOBAL_VRF_ALLOWED, SHORT);
     }
 
     len = 5;
@@ -30460,7 +30468,7 @@ static int
 loci_validate_of_oxm_bsn_global_vrf_allowed_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_GLOBAL_VRF_ALLOWED_MASKED, SHORT);
     }
 
     len = 6;
@@ -30476,7 +30484,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_128_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_128, SHORT);
     }
 
     len = 20;
@@ -30492,7 +30500,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_128_MASKED, SHORT);
     }
 
     len = 36;
@@ -30508,7 +30516,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_512_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 68) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_512, SHORT);
     }
 
     len = 68;
@@ -30524,7 +30532,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 132) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_512_MASKED, SHORT);
     }
 
     len = 132;
@@ -30540,7 +30548,7 @@ static int
 loci_validate_of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INGRESS_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -30556,7 +30564,7 @@ static int
 loci_validate_of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INGRESS_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -30572,7 +30580,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -30588,7 +30596,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -30604,7 +30612,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -30620,7 +30628,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -30636,7 +30644,7 @@ static int
 loci_validate_of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_VLAN_VID, SHORT);
     }
 
     len = 6;
@@ -30652,7 +30660,7 @@ static int
 loci_validate_of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_VLAN_VID_MASKED, SHORT);
     }
 
     len = 8;
@@ -30668,7 +30676,7 @@ static int
 loci_validate_of_oxm_bsn_ip_fragmentation_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IP_FRAGMENTATION, SHORT);
     }
 
     len = 5;
@@ -30684,7 +30692,7 @@ static int
 loci_validate_of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IP_FRAGMENTATION_MASKED, SHORT);
     }
 
     len = 6;
@@ -30700,7 +30708,7 @@ static int
 loci_validate_of_oxm_bsn_l2_cache_hit_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L2_CACHE_HIT, SHORT);
     }
 
     len = 5;
@@ -30716,7 +30724,7 @@ static int
 loci_validate_of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L2_CACHE_HIT_MASKED, SHORT);
     }
 
     len = 6;
@@ -30732,7 +30740,7 @@ static int
 loci_validate_of_oxm_bsn_l3_dst_class_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_DST_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -30748,7 +30756,7 @@ static int
 loci_validate_of_oxm_bsn_l3_dst_class_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_DST_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -30764,7 +30772,7 @@ static int
 loci_validate_of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_INTERFACE_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -30780,7 +30788,7 @@ static int
 loci_validate_of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_INTERFACE_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -30796,7 +30804,7 @@ static int
 loci_validate_of_oxm_bsn_l3_src_class_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_SRC_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -30812,7 +30820,7 @@ static int
 loci_validate_of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_SRC_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -30828,7 +30836,7 @@ static int
 loci_validate_of_oxm_bsn_lag_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_LAG_ID, SHORT);
     }
 
     len = 8;
@@ -30844,7 +30852,7 @@ static int
 loci_validate_of_oxm_bsn_lag_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_LAG_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -30860,7 +30868,7 @@ static int
 loci_validate_of_oxm_bsn_tcp_flags_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_TCP_FLAGS, SHORT);
     }
 
     len = 6;
@@ -30876,7 +30884,7 @@ static int
 loci_validate_of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_TCP_FLAGS_MASKED, SHORT);
     }
 
     len = 8;
@@ -30892,7 +30900,7 @@ static int
 loci_validate_of_oxm_bsn_udf0_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF0, SHORT);
     }
 
     len = 8;
@@ -30908,7 +30916,7 @@ static int
 loci_validate_of_oxm_bsn_udf0_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF0_MASKED, SHORT);
     }
 
     len = 12;
@@ -30924,7 +30932,7 @@ static int
 loci_validate_of_oxm_bsn_udf1_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF1, SHORT);
     }
 
     len = 8;
@@ -30940,7 +30948,7 @@ static int
 loci_validate_of_oxm_bsn_udf1_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF1_MASKED, SHORT);
     }
 
     len = 12;
@@ -30956,7 +30964,7 @@ static int
 loci_validate_of_oxm_bsn_udf2_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF2, SHORT);
     }
 
     len = 8;
@@ -30972,7 +30980,7 @@ static int
 loci_validate_of_oxm_bsn_udf2_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF2_MASKED, SHORT);
     }
 
     len = 12;
@@ -30988,7 +30996,7 @@ static int
 loci_validate_of_oxm_bsn_udf3_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF3, SHORT);
     }
 
     len = 8;
@@ -31004,7 +31012,7 @@ static int
 loci_validate_of_oxm_bsn_udf3_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF3_MASKED, SHORT);
     }
 
     len = 12;
@@ -31020,7 +31028,7 @@ static int
 loci_validate_of_oxm_bsn_udf4_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF4, SHORT);
     }
 
     len = 8;
@@ -31036,7 +31044,7 @@ static int
 loci_validate_of_oxm_bsn_udf4_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF4_MASKED, SHORT);
     }
 
     len = 12;
@@ -31052,7 +31060,7 @@ static int
 loci_validate_of_oxm_bsn_udf5_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF5, SHORT);
     }
 
     len = 8;
@@ -31068,7 +31076,7 @@ static int
 loci_validate_of_oxm_bsn_udf5_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF5_MASKED, SHORT);
     }
 
     len = 12;
@@ -31084,7 +31092,7 @@ static int
 loci_validate_of_oxm_bsn_udf6_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF6, SHORT);
     }
 
     len = 8;
@@ -31100,7 +31108,7 @@ static int
 loci_validate_of_oxm_bsn_udf6_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF6_MASKED, SHORT);
     }
 
     len = 12;
@@ -31116,7 +31124,7 @@ static int
 loci_validate_of_oxm_bsn_udf7_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF7, SHORT);
     }
 
     len = 8;
@@ -31132,7 +31140,7 @@ static int
 loci_validate_of_oxm_bsn_udf7_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF7_MASKED, SHORT);
     }
 
     len = 12;
@@ -31148,7 +31156,7 @@ static int
 loci_validate_of_oxm_bsn_vfi_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VFI, SHORT);
     }
 
     len = 6;
@@ -31164,7 +31172,7 @@ static int
 loci_validate_of_oxm_bsn_vfi_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VFI_MASKED, SHORT);
     }
 
     len = 8;
@@ -31180,7 +31188,7 @@ static int
 loci_validate_of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VLAN_XLATE_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -31196,7 +31204,7 @@ static int
 loci_validate_of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VLAN_XLATE_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -31212,7 +31220,7 @@ static int
 loci_validate_of_oxm_bsn_vrf_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VRF, SHORT);
     }
 
     len = 8;
@@ -31228,7 +31236,7 @@ static int
 loci_validate_of_oxm_bsn_vrf_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VRF_MASKED, SHORT);
     }
 
     len = 12;
@@ -31244,7 +31252,7 @@ static int
 loci_validate_of_oxm_bsn_vxlan_network_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VXLAN_NETWORK_ID, SHORT);
     }
 
     len = 8;
@@ -31260,7 +31268,7 @@ static int
 loci_validate_of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VXLAN_NETWORK_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -31276,7 +31284,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigid_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGID, SHORT);
     }
 
     len = 10;
@@ -31292,7 +31300,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigid_basic_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGID_BASIC, SHORT);
     }
 
     len = 10;
@@ -31308,7 +31316,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigid_basic_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGID_BASIC_MASKED, SHORT);
     }
 
     len = 16;
@@ -31324,7 +31332,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigid_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGID_MASKED, SHORT);
     }
 
     len = 16;
@@ -31340,7 +31348,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigtype_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGTYPE, SHORT);
     }
 
     len = 5;
@@ -31356,7 +31364,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigtype_basic_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGTYPE_BASIC, SHORT);
     }
 
     len = 5;
@@ -31372,7 +31380,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigtype_basic_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGTYPE_BASIC_MASKED, SHORT);
     }
 
     len = 6;
@@ -31388,7 +31396,7 @@ static int
 loci_validate_of_oxm_circuit_och_sigtype_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_CIRCUIT_OCH_SIGTYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -31404,7 +31412,7 @@ static int
 loci_validate_of_oxm_encap_eth_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -31420,7 +31428,7 @@ static int
 loci_validate_of_oxm_encap_eth_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -31436,7 +31444,7 @@ static int
 loci_validate_of_oxm_encap_eth_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -31452,7 +31460,7 @@ static int
 loci_validate_of_oxm_encap_eth_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -31468,7 +31476,7 @@ static int
 loci_validate_of_oxm_encap_eth_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -31484,7 +31492,7 @@ static int
 loci_validate_of_oxm_encap_eth_type_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_TYPE_MASKED, SHORT);
     }
 
     len = 8;
@@ -31500,7 +31508,7 @@ static int
 loci_validate_of_oxm_eth_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -31516,7 +31524,7 @@ static int
 loci_validate_of_oxm_eth_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -31532,7 +31540,7 @@ static int
 loci_validate_of_oxm_eth_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -31548,7 +31556,7 @@ static int
 loci_validate_of_oxm_eth_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -31564,7 +31572,7 @@ static int
 loci_validate_of_oxm_eth_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -31580,7 +31588,7 @@ static int
 loci_validate_of_oxm_eth_type_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_TYPE_MASKED, SHORT);
     }
 
     len = 8;
@@ -31596,7 +31604,7 @@ static int
 loci_validate_of_oxm_exp_och_sigid_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 14) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_OCH_SIGID, SHORT);
     }
 
     len = 14;
@@ -31612,7 +31620,7 @@ static int
 loci_validate_of_oxm_exp_och_sigid_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_OCH_SIGID_MASKED, SHORT);
     }
 
     len = 20;
@@ -31628,7 +31636,7 @@ static int
 loci_validate_of_oxm_exp_och_sigtype_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_OCH_SIGTYPE, SHORT);
     }
 
     len = 9;
@@ -31644,7 +31652,7 @@ static int
 loci_validate_of_oxm_exp_och_sigtype_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_OCH_SIGTYPE_MASKED, SHORT);
     }
 
     len = 10;
@@ -31660,7 +31668,7 @@ static int
 loci_validate_of_oxm_exp_odu_sigid_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_ODU_SIGID, SHORT);
     }
 
 
@@ -31675,7 +31683,7 @@ static int
 loci_validate_of_oxm_exp_odu_sigid_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_ODU_SIGID_MASKED, SHORT);
     }
 
 
@@ -31690,7 +31698,7 @@ static int
 loci_validate_of_oxm_exp_odu_sigtype_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_ODU_SIGTYPE, SHORT);
     }
 
     len = 9;
@@ -31706,7 +31714,7 @@ static int
 loci_validate_of_oxm_exp_odu_sigtype_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_EXP_ODU_SIGTYPE_MASKED, SHORT);
     }
 
     len = 10;
@@ -31722,7 +31730,7 @@ static int
 loci_validate_of_oxm_icmpv4_code_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_CODE, SHORT);
     }
 
     len = 5;
@@ -31738,7 +31746,7 @@ static int
 loci_validate_of_oxm_icmpv4_code_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_CODE_MASKED, SHORT);
     }
 
     len = 6;
@@ -31754,7 +31762,7 @@ static int
 loci_validate_of_oxm_icmpv4_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_TYPE, SHORT);
     }
 
     len = 5;
@@ -31770,7 +31778,7 @@ static int
 loci_validate_of_oxm_icmpv4_type_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_TYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -31786,7 +31794,7 @@ static int
 loci_validate_of_oxm_icmpv6_code_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_CODE, SHORT);
     }
 
     len = 5;
@@ -31802,7 +31810,7 @@ static int
 loci_validate_of_oxm_icmpv6_code_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_CODE_MASKED, SHORT);
     }
 
     len = 6;
@@ -31818,7 +31826,7 @@ static int
 loci_validate_of_oxm_icmpv6_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_TYPE, SHORT);
     }
 
     len = 5;
@@ -31834,7 +31842,7 @@ static int
 loci_validate_of_oxm_icmpv6_type_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_TYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -31850,7 +31858,7 @@ static int
 loci_validate_of_oxm_in_phy_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PHY_PORT, SHORT);
     }
 
     len = 8;
@@ -31866,7 +31874,7 @@ static int
 loci_validate_of_oxm_in_phy_port_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PHY_PORT_MASKED, SHORT);
     }
 
     len = 12;
@@ -31882,7 +31890,7 @@ static int
 loci_validate_of_oxm_in_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PORT, SHORT);
     }
 
     len = 8;
@@ -31898,7 +31906,7 @@ static int
 loci_validate_of_oxm_in_port_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PORT_MASKED, SHORT);
     }
 
     len = 12;
@@ -31914,7 +31922,7 @@ static int
 loci_validate_of_oxm_ip_dscp_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_DSCP, SHORT);
     }
 
     len = 5;
@@ -31930,7 +31938,7 @@ static int
 loci_validate_of_oxm_ip_dscp_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_DSCP_MASKED, SHORT);
     }
 
     len = 6;
@@ -31946,7 +31954,7 @@ static int
 loci_validate_of_oxm_ip_ecn_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_ECN, SHORT);
     }
 
     len = 5;
@@ -31962,7 +31970,7 @@ static int
 loci_validate_of_oxm_ip_ecn_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_ECN_MASKED, SHORT);
     }
 
     len = 6;
@@ -31978,7 +31986,7 @@ static int
 loci_validate_of_oxm_ip_proto_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_PROTO, SHORT);
     }
 
     len = 5;
@@ -31994,7 +32002,7 @@ static int
 loci_validate_of_oxm_ip_proto_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_PROTO_MASKED, SHORT);
     }
 
     len = 6;
@@ -32010,7 +32018,7 @@ static int
 loci_validate_of_oxm_ipv4_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -32026,7 +32034,7 @@ static int
 loci_validate_of_oxm_ipv4_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_DST_MASKED, SHORT);
     }
 
     len = 12;
@@ -32042,7 +32050,7 @@ static int
 loci_validate_of_oxm_ipv4_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -32058,7 +32066,7 @@ static int
 loci_validate_of_oxm_ipv4_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_SRC_MASKED, SHORT);
     }
 
     len = 12;
@@ -32074,7 +32082,7 @@ static int
 loci_validate_of_oxm_ipv6_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_DST, SHORT);
     }
 
     len = 20;
@@ -32090,7 +32098,7 @@ static int
 loci_validate_of_oxm_ipv6_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_DST_MASKED, SHORT);
     }
 
     len = 36;
@@ -32106,7 +32114,7 @@ static int
 loci_validate_of_oxm_ipv6_exthdr_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_EXTHDR, SHORT);
     }
 
     len = 6;
@@ -32122,7 +32130,7 @@ static int
 loci_validate_of_oxm_ipv6_exthdr_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_EXTHDR_MASKED, SHORT);
     }
 
     len = 8;
@@ -32138,7 +32146,7 @@ static int
 loci_validate_of_oxm_ipv6_flabel_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_FLABEL, SHORT);
     }
 
     len = 8;
@@ -32154,7 +32162,7 @@ static int
 loci_validate_of_oxm_ipv6_flabel_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_FLABEL_MASKED, SHORT);
     }
 
     len = 12;
@@ -32170,7 +32178,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_sll_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_SLL, SHORT);
     }
 
     len = 10;
@@ -32186,7 +32194,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_SLL_MASKED, SHORT);
     }
 
     len = 16;
@@ -32202,7 +32210,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_target_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TARGET, SHORT);
     }
 
     len = 20;
@@ -32218,7 +32226,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_target_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TARGET_MASKED, SHORT);
     }
 
     len = 36;
@@ -32234,7 +32242,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_tll_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TLL, SHORT);
     }
 
     len = 10;
@@ -32250,7 +32258,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TLL_MASKED, SHORT);
     }
 
     len = 16;
@@ -32266,7 +32274,7 @@ static int
 loci_validate_of_oxm_ipv6_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_SRC, SHORT);
     }
 
     len = 20;
@@ -32282,7 +32290,7 @@ static int
 loci_validate_of_oxm_ipv6_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_SRC_MASKED, SHORT);
     }
 
     len = 36;
@@ -32298,7 +32306,7 @@ static int
 loci_validate_of_oxm_metadata_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_METADATA, SHORT);
     }
 
     len = 12;
@@ -32314,7 +32322,7 @@ static int
 loci_validate_of_oxm_metadata_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_METADATA_MASKED, SHORT);
     }
 
     len = 20;
@@ -32330,7 +32338,7 @@ static int
 loci_validate_of_oxm_mpls_bos_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_BOS, SHORT);
     }
 
     len = 5;
@@ -32346,7 +32354,7 @@ static int
 loci_validate_of_oxm_mpls_bos_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_BOS_MASKED, SHORT);
     }
 
     len = 6;
@@ -32362,7 +32370,7 @@ static int
 loci_validate_of_oxm_mpls_label_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_LABEL, SHORT);
     }
 
     len = 8;
@@ -32378,7 +32386,7 @@ static int
 loci_validate_of_oxm_mpls_label_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_LABEL_MASKED, SHORT);
     }
 
     len = 12;
@@ -32394,7 +32402,7 @@ static int
 loci_validate_of_oxm_mpls_tc_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_TC, SHORT);
     }
 
     len = 5;
@@ -32410,7 +32418,7 @@ static int
 loci_validate_of_oxm_mpls_tc_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_TC_MASKED, SHORT);
     }
 
     len = 6;
@@ -32426,7 +32434,7 @@ static int
 loci_validate_of_oxm_nsh_c1_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C1, SHORT);
     }
 
     len = 8;
@@ -32442,7 +32450,7 @@ static int
 loci_validate_of_oxm_nsh_c1_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C1_MASKED, SHORT);
     }
 
     len = 12;
@@ -32458,7 +32466,7 @@ static int
 loci_validate_of_oxm_nsh_c2_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C2, SHORT);
     }
 
     len = 8;
@@ -32474,7 +32482,7 @@ static int
 loci_validate_of_oxm_nsh_c2_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C2_MASKED, SHORT);
     }
 
     len = 12;
@@ -32490,7 +32498,7 @@ static int
 loci_validate_of_oxm_nsh_c3_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C3, SHORT);
     }
 
     len = 8;
@@ -32506,7 +32514,7 @@ static int
 loci_validate_of_oxm_nsh_c3_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C3_MASKED, SHORT);
     }
 
     len = 12;
@@ -32522,7 +32530,7 @@ static int
 loci_validate_of_oxm_nsh_c4_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C4, SHORT);
     }
 
     len = 8;
@@ -32538,7 +32546,7 @@ static int
 loci_validate_of_oxm_nsh_c4_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C4_MASKED, SHORT);
     }
 
     len = 12;
@@ -32554,7 +32562,7 @@ static int
 loci_validate_of_oxm_nsh_mdtype_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_MDTYPE, SHORT);
     }
 
     len = 5;
@@ -32570,7 +32578,7 @@ static int
 loci_validate_of_oxm_nsh_mdtype_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_MDTYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -32586,7 +32594,7 @@ static int
 loci_validate_of_oxm_nsh_np_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_NP, SHORT);
     }
 
     len = 5;
@@ -32602,7 +32610,7 @@ static int
 loci_validate_of_oxm_nsh_np_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_NP_MASKED, SHORT);
     }
 
     len = 6;
@@ -32618,7 +32626,7 @@ static int
 loci_validate_of_oxm_nsi_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSI, SHORT);
     }
 
     len = 5;
@@ -32634,7 +32642,7 @@ static int
 loci_validate_of_oxm_nsi_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSI_MASKED, SHORT);
     }
 
     len = 6;
@@ -32650,7 +32658,7 @@ static int
 loci_validate_of_oxm_nsp_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSP, SHORT);
     }
 
     len = 8;
@@ -32666,7 +32674,7 @@ static int
 loci_validate_of_oxm_nsp_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSP_MASKED, SHORT);
     }
 
     len = 12;
@@ -32682,7 +32690,7 @@ static int
 loci_validate_of_oxm_och_sigatt_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OCH_SIGATT, SHORT);
     }
 
     len = 8;
@@ -32698,7 +32706,7 @@ static int
 loci_validate_of_oxm_och_sigatt_basic_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OCH_SIGATT_BASIC, SHORT);
     }
 
     len = 8;
@@ -32714,7 +32722,7 @@ static int
 loci_validate_of_oxm_och_sigatt_basic_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OCH_SIGATT_BASIC_MASKED, SHORT);
     }
 
     len = 12;
@@ -32730,7 +32738,7 @@ static int
 loci_validate_of_oxm_och_sigatt_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OCH_SIGATT_MASKED, SHORT);
     }
 
     len = 12;
@@ -32746,7 +32754,7 @@ static int
 loci_validate_of_oxm_ofdpa_mpls_l2_port_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_MPLS_L2_PORT, SHORT);
     }
 
     len = 12;
@@ -32762,7 +32770,7 @@ static int
 loci_validate_of_oxm_ofdpa_mpls_l2_port_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_MPLS_L2_PORT_MASKED, SHORT);
     }
 
     len = 16;
@@ -32778,7 +32786,7 @@ static int
 loci_validate_of_oxm_ofdpa_mpls_type_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_MPLS_TYPE, SHORT);
     }
 
     len = 10;
@@ -32794,7 +32802,7 @@ static int
 loci_validate_of_oxm_ofdpa_mpls_type_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_MPLS_TYPE_MASKED, SHORT);
     }
 
     len = 12;
@@ -32810,7 +32818,7 @@ static int
 loci_validate_of_oxm_ofdpa_ovid_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_OVID, SHORT);
     }
 
     len = 10;
@@ -32826,7 +32834,7 @@ static int
 loci_validate_of_oxm_ofdpa_ovid_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_OVID_MASKED, SHORT);
     }
 
     len = 12;
@@ -32842,7 +32850,7 @@ static int
 loci_validate_of_oxm_ofdpa_qos_index_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_QOS_INDEX, SHORT);
     }
 
     len = 9;
@@ -32858,7 +32866,7 @@ static int
 loci_validate_of_oxm_ofdpa_qos_index_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OFDPA_QOS_INDEX_MASKED, SHORT);
     }
 
     len = 10;
@@ -32874,7 +32882,7 @@ static int
 loci_validate_of_oxm_ovs_tcp_flags_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OVS_TCP_FLAGS, SHORT);
     }
 
     len = 10;
@@ -32890,7 +32898,7 @@ static int
 loci_validate_of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OVS_TCP_FLAGS_MASKED, SHORT);
     }
 
     len = 12;
@@ -32906,7 +32914,7 @@ static int
 loci_validate_of_oxm_sctp_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_DST, SHORT);
     }
 
     len = 6;
@@ -32922,7 +32930,7 @@ static int
 loci_validate_of_oxm_sctp_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -32938,7 +32946,7 @@ static int
 loci_validate_of_oxm_sctp_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_SRC, SHORT);
     }
 
     len = 6;
@@ -32954,7 +32962,7 @@ static int
 loci_validate_of_oxm_sctp_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -32970,7 +32978,7 @@ static int
 loci_validate_of_oxm_tcp_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_DST, SHORT);
     }
 
     len = 6;
@@ -32986,7 +32994,7 @@ static int
 loci_validate_of_oxm_tcp_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -33002,7 +33010,7 @@ static int
 loci_validate_of_oxm_tcp_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_SRC, SHORT);
     }
 
     len = 6;
@@ -33018,7 +33026,7 @@ static int
 loci_validate_of_oxm_tcp_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -33034,7 +33042,7 @@ static int
 loci_validate_of_oxm_tun_flags_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_FLAGS, SHORT);
     }
 
     len = 6;
@@ -33050,7 +33058,7 @@ static int
 loci_validate_of_oxm_tun_flags_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_FLAGS_MASKED, SHORT);
     }
 
     len = 8;
@@ -33066,7 +33074,7 @@ static int
 loci_validate_of_oxm_tun_gbp_flags_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_FLAGS, SHORT);
     }
 
     len = 5;
@@ -33082,7 +33090,7 @@ static int
 loci_validate_of_oxm_tun_gbp_flags_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_FLAGS_MASKED, SHORT);
     }
 
     len = 6;
@@ -33098,7 +33106,7 @@ static int
 loci_validate_of_oxm_tun_gbp_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_ID, SHORT);
     }
 
     len = 6;
@@ -33114,7 +33122,7 @@ static int
 loci_validate_of_oxm_tun_gbp_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_ID_MASKED, SHORT);
     }
 
     len = 8;
@@ -33130,7 +33138,7 @@ static int
 loci_validate_of_oxm_tun_gpe_flags_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_FLAGS, SHORT);
     }
 
     len = 5;
@@ -33146,7 +33154,7 @@ static int
 loci_validate_of_oxm_tun_gpe_flags_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_FLAGS_MASKED, SHORT);
     }
 
     len = 6;
@@ -33162,7 +33170,7 @@ static int
 loci_validate_of_oxm_tun_gpe_np_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_NP, SHORT);
     }
 
     len = 5;
@@ -33178,7 +33186,7 @@ static int
 loci_validate_of_oxm_tun_gpe_np_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_NP_MASKED, SHORT);
     }
 
     len = 6;
@@ -33194,7 +33202,7 @@ static int
 loci_validate_of_oxm_tunnel_id_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_ID, SHORT);
     }
 
     len = 12;
@@ -33210,7 +33218,7 @@ static int
 loci_validate_of_oxm_tunnel_id_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_ID_MASKED, SHORT);
     }
 
     len = 20;
@@ -33226,7 +33234,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -33242,7 +33250,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_DST_MASKED, SHORT);
     }
 
     len = 12;
@@ -33258,7 +33266,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -33274,7 +33282,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_SRC_MASKED, SHORT);
     }
 
     len = 12;
@@ -33290,7 +33298,7 @@ static int
 loci_validate_of_oxm_udp_dst_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_DST, SHORT);
     }
 
     len = 6;
@@ -33306,7 +33314,7 @@ static int
 loci_validate_of_oxm_udp_dst_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -33322,7 +33330,7 @@ static int
 loci_validate_of_oxm_udp_src_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_SRC, SHORT);
     }
 
     len = 6;
@@ -33338,7 +33346,7 @@ static int
 loci_validate_of_oxm_udp_src_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -33354,7 +33362,7 @@ static int
 loci_validate_of_oxm_vlan_pcp_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_PCP, SHORT);
     }
 
     len = 5;
@@ -33370,7 +33378,7 @@ static int
 loci_validate_of_oxm_vlan_pcp_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_PCP_MASKED, SHORT);
     }
 
     len = 6;
@@ -33386,7 +33394,7 @@ static int
 loci_validate_of_oxm_vlan_vid_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_VID, SHORT);
     }
 
     len = 6;
@@ -33402,7 +33410,7 @@ static int
 loci_validate_of_oxm_vlan_vid_masked_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_VID_MASKED, SHORT);
     }
 
     len = 8;
@@ -33418,14 +33426,14 @@ static int
 loci_validate_of_packet_in_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, LENGTH);
     }
 
     len = wire_len;
@@ -33442,14 +33450,14 @@ static int
 loci_validate_of_packet_out_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     len = wire_len;
@@ -33460,7 +33468,7 @@ loci_validate_of_packet_out_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 
 
     if (24 + wire_len_actions > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     if (loci_validate_of_list_action_OF_VERSION_1_3(data + 24, wire_len_actions, out_len) < 0) {
@@ -33476,14 +33484,14 @@ static int
 loci_validate_of_packet_queue_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 8, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, LENGTH);
     }
 
     len = wire_len;
@@ -33504,7 +33512,7 @@ static int
 loci_validate_of_port_desc_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC, SHORT);
     }
 
     len = 64;
@@ -33520,7 +33528,7 @@ static int
 loci_validate_of_port_desc_prop_optical_transport_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_OPTICAL_TRANSPORT, SHORT);
     }
 
     len = 8;
@@ -33528,7 +33536,7 @@ loci_validate_of_port_desc_prop_optical_transport_OF_VERSION_1_3(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_OPTICAL_TRANSPORT, LENGTH);
     }
 
 
@@ -33542,14 +33550,14 @@ static int
 loci_validate_of_port_desc_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -33570,7 +33578,7 @@ static int
 loci_validate_of_port_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -33578,7 +33586,7 @@ loci_validate_of_port_desc_stats_request_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -33592,7 +33600,7 @@ static int
 loci_validate_of_port_mod_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, SHORT);
     }
 
     len = 40;
@@ -33600,7 +33608,7 @@ loci_validate_of_port_mod_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, LENGTH);
     }
 
 
@@ -33614,14 +33622,14 @@ static int
 loci_validate_of_port_mod_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -33637,14 +33645,14 @@ static int
 loci_validate_of_port_optical_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_OPTICAL, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_OPTICAL, LENGTH);
     }
 
     len = wire_len;
@@ -33665,7 +33673,7 @@ static int
 loci_validate_of_port_optical_transport_application_code_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_OPTICAL_TRANSPORT_APPLICATION_CODE, SHORT);
     }
 
     len = 18;
@@ -33681,7 +33689,7 @@ static int
 loci_validate_of_port_optical_transport_layer_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_OPTICAL_TRANSPORT_LAYER_ENTRY, SHORT);
     }
 
     len = 8;
@@ -33697,14 +33705,14 @@ static int
 loci_validate_of_port_optical_transport_layer_stack_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_OPTICAL_TRANSPORT_LAYER_STACK, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_OPTICAL_TRANSPORT_LAYER_STACK, LENGTH);
     }
 
     len = wire_len;
@@ -33725,7 +33733,7 @@ static int
 loci_validate_of_port_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 112) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_ENTRY, SHORT);
     }
 
     len = 112;
@@ -33741,14 +33749,14 @@ static int
 loci_validate_of_port_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -33769,7 +33777,7 @@ static int
 loci_validate_of_port_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -33777,7 +33785,7 @@ loci_validate_of_port_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, LENGTH);
     }
 
 
@@ -33791,7 +33799,7 @@ static int
 loci_validate_of_port_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, SHORT);
     }
 
     len = 80;
@@ -33799,7 +33807,7 @@ loci_validate_of_port_status_OF_VERSION_1_3(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, LENGTH);
     }
 
 
@@ -33813,14 +33821,14 @@ static int
 loci_validate_of_queue_get_config_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -33841,7 +33849,7 @@ static int
 loci_validate_of_queue_get_config_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 16;
@@ -33849,7 +33857,7 @@ loci_validate_of_queue_get_config_request_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -33863,14 +33871,14 @@ static int
 loci_validate_of_queue_op_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -33886,14 +33894,14 @@ static int
 loci_validate_of_queue_prop_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -33919,14 +33927,14 @@ static int
 loci_validate_of_queue_prop_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -33946,7 +33954,7 @@ static int
 loci_validate_of_queue_prop_max_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MAX_RATE, SHORT);
     }
 
     len = 16;
@@ -33954,7 +33962,7 @@ loci_validate_of_queue_prop_max_rate_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MAX_RATE, LENGTH);
     }
 
 
@@ -33968,7 +33976,7 @@ static int
 loci_validate_of_queue_prop_min_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, SHORT);
     }
 
     len = 16;
@@ -33976,7 +33984,7 @@ loci_validate_of_queue_prop_min_rate_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, LENGTH);
     }
 
 
@@ -33990,7 +33998,7 @@ static int
 loci_validate_of_queue_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_ENTRY, SHORT);
     }
 
     len = 40;
@@ -34006,14 +34014,14 @@ static int
 loci_validate_of_queue_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -34034,7 +34042,7 @@ static int
 loci_validate_of_queue_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -34042,7 +34050,7 @@ loci_validate_of_queue_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -34056,7 +34064,7 @@ static int
 loci_validate_of_role_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REPLY, SHORT);
     }
 
     len = 24;
@@ -34064,7 +34072,7 @@ loci_validate_of_role_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REPLY, LENGTH);
     }
 
 
@@ -34078,7 +34086,7 @@ static int
 loci_validate_of_role_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST, SHORT);
     }
 
     len = 24;
@@ -34086,7 +34094,7 @@ loci_validate_of_role_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST, LENGTH);
     }
 
 
@@ -34100,14 +34108,14 @@ static int
 loci_validate_of_role_request_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -34123,14 +34131,14 @@ static int
 loci_validate_of_sdwn_header_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -34172,14 +34180,14 @@ static int
 loci_validate_of_sdwn_add_client_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 328) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ADD_CLIENT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 328) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ADD_CLIENT, LENGTH);
     }
 
     len = wire_len;
@@ -34200,14 +34208,14 @@ static int
 loci_validate_of_sdwn_add_lvap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 68) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ADD_LVAP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 68) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ADD_LVAP, LENGTH);
     }
 
     len = wire_len;
@@ -34223,7 +34231,7 @@ static int
 loci_validate_of_sdwn_del_client_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_DEL_CLIENT, SHORT);
     }
 
     len = 34;
@@ -34231,7 +34239,7 @@ loci_validate_of_sdwn_del_client_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_DEL_CLIENT, LENGTH);
     }
 
 
@@ -34245,7 +34253,7 @@ static int
 loci_validate_of_sdwn_del_lvap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 22) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_DEL_LVAP, SHORT);
     }
 
     len = 22;
@@ -34253,7 +34261,7 @@ loci_validate_of_sdwn_del_lvap_OF_VERSION_1_3(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 22) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_DEL_LVAP, LENGTH);
     }
 
 
@@ -34267,14 +34275,14 @@ static int
 loci_validate_of_sdwn_entity_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY, LENGTH);
     }
 
     len = wire_len;
@@ -34306,14 +34314,14 @@ static int
 loci_validate_of_sdwn_entity_accesspoint_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_ACCESSPOINT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_ACCESSPOINT, LENGTH);
     }
 
     len = wire_len;
@@ -34329,7 +34337,7 @@ static int
 loci_validate_of_sdwn_entity_band_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 50) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_BAND, SHORT);
     }
 
     len = 50;
@@ -34337,7 +34345,7 @@ loci_validate_of_sdwn_entity_band_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 50) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_BAND, LENGTH);
     }
 
 
@@ -34351,7 +34359,7 @@ static int
 loci_validate_of_sdwn_entity_freq_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_FREQ, SHORT);
     }
 
     len = 20;
@@ -34359,7 +34367,7 @@ loci_validate_of_sdwn_entity_freq_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_FREQ, LENGTH);
     }
 
 
@@ -34373,7 +34381,7 @@ static int
 loci_validate_of_sdwn_entity_nic_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 14) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_NIC, SHORT);
     }
 
     len = 14;
@@ -34381,7 +34389,7 @@ loci_validate_of_sdwn_entity_nic_OF_VERSION_1_3(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 14) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_NIC, LENGTH);
     }
 
 
@@ -34395,7 +34403,7 @@ static int
 loci_validate_of_sdwn_entity_rate_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_RATE, SHORT);
     }
 
     len = 16;
@@ -34403,7 +34411,7 @@ loci_validate_of_sdwn_entity_rate_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_RATE, LENGTH);
     }
 
 
@@ -34417,7 +34425,7 @@ static int
 loci_validate_of_sdwn_entity_related_switch_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_RELATED_SWITCH, SHORT);
     }
 
     len = 12;
@@ -34425,7 +34433,7 @@ loci_validate_of_sdwn_entity_related_switch_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_ENTITY_RELATED_SWITCH, LENGTH);
     }
 
 
@@ -34439,14 +34447,14 @@ static int
 loci_validate_of_sdwn_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -34472,7 +34480,7 @@ static int
 loci_validate_of_sdwn_get_channel_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CHANNEL_REPLY, SHORT);
     }
 
     len = 28;
@@ -34480,7 +34488,7 @@ loci_validate_of_sdwn_get_channel_reply_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CHANNEL_REPLY, LENGTH);
     }
 
 
@@ -34494,14 +34502,14 @@ static int
 loci_validate_of_sdwn_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -34527,7 +34535,7 @@ static int
 loci_validate_of_sdwn_get_channel_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CHANNEL_REQUEST, SHORT);
     }
 
     len = 28;
@@ -34535,7 +34543,7 @@ loci_validate_of_sdwn_get_channel_request_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CHANNEL_REQUEST, LENGTH);
     }
 
 
@@ -34549,14 +34557,14 @@ static int
 loci_validate_of_sdwn_get_clients_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -34582,14 +34590,14 @@ static int
 loci_validate_of_sdwn_get_clients_reply_crypto_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 334) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY_CRYPTO, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 334) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY_CRYPTO, LENGTH);
     }
 
     len = wire_len;
@@ -34610,7 +34618,7 @@ static int
 loci_validate_of_sdwn_get_clients_reply_lvap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY_LVAP, SHORT);
     }
 
     len = 34;
@@ -34618,7 +34626,7 @@ loci_validate_of_sdwn_get_clients_reply_lvap_OF_VERSION_1_3(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY_LVAP, LENGTH);
     }
 
 
@@ -34632,7 +34640,7 @@ static int
 loci_validate_of_sdwn_get_clients_reply_normal_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 334) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY_NORMAL, SHORT);
     }
 
     len = 334;
@@ -34640,7 +34648,7 @@ loci_validate_of_sdwn_get_clients_reply_normal_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 334) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REPLY_NORMAL, LENGTH);
     }
 
 
@@ -34654,7 +34662,7 @@ static int
 loci_validate_of_sdwn_get_clients_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REQUEST, SHORT);
     }
 
     len = 28;
@@ -34662,7 +34670,7 @@ loci_validate_of_sdwn_get_clients_request_OF_VERSION_1_3(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_CLIENTS_REQUEST, LENGTH);
     }
 
 
@@ -34676,7 +34684,7 @@ static int
 loci_validate_of_sdwn_get_remote_port_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_REMOTE_PORT_REPLY, SHORT);
     }
 
     len = 20;
@@ -34684,7 +34692,7 @@ loci_validate_of_sdwn_get_remote_port_reply_OF_VERSION_1_3(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_REMOTE_PORT_REPLY, LENGTH);
     }
 
 
@@ -34698,7 +34706,7 @@ static int
 loci_validate_of_sdwn_get_remote_port_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_REMOTE_PORT_REQUEST, SHORT);
     }
 
     len = 16;
@@ -34706,7 +34714,7 @@ loci_validate_of_sdwn_get_remote_port_request_OF_VERSION_1_3(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_GET_REMOTE_PORT_REQUEST, LENGTH);
     }
 
 
@@ -34720,7 +34728,7 @@ static int
 loci_validate_of_sdwn_ieee80211_mgmt_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 41) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_IEEE80211_MGMT, SHORT);
     }
 
     len = 41;
@@ -34728,7 +34736,7 @@ loci_validate_of_sdwn_ieee80211_mgmt_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 41) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_IEEE80211_MGMT, LENGTH);
     }
 
 
@@ -34742,7 +34750,7 @@ static int
 loci_validate_of_sdwn_ieee80211_mgmt_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_IEEE80211_MGMT_REPLY, SHORT);
     }
 
     len = 24;
@@ -34750,7 +34758,7 @@ loci_validate_of_sdwn_ieee80211_mgmt_reply_OF_VERSION_1_3(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_IEEE80211_MGMT_REPLY, LENGTH);
     }
 
 
@@ -34764,7 +34772,7 @@ static int
 loci_validate_of_sdwn_mod_lvap_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_MOD_LVAP, SHORT);
     }
 
     len = 28;
@@ -34772,7 +34780,7 @@ loci_validate_of_sdwn_mod_lvap_OF_VERSION_1_3(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_MOD_LVAP, LENGTH);
     }
 
 
@@ -34786,14 +34794,14 @@ static int
 loci_validate_of_sdwn_packet_in_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 50) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_PACKET_IN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 50) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_PACKET_IN, LENGTH);
     }
 
     len = wire_len;
@@ -34809,14 +34817,14 @@ static int
 loci_validate_of_sdwn_port_desc_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_PORT_DESC_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_PORT_DESC_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -34837,7 +34845,7 @@ static int
 loci_validate_of_sdwn_port_desc_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_PORT_DESC_REQUEST, SHORT);
     }
 
     len = 24;
@@ -34845,7 +34853,7 @@ loci_validate_of_sdwn_port_desc_request_OF_VERSION_1_3(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_PORT_DESC_REQUEST, LENGTH);
     }
 
 
@@ -34859,7 +34867,7 @@ static int
 loci_validate_of_sdwn_set_channel_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_SET_CHANNEL, SHORT);
     }
 
     len = 28;
@@ -34867,7 +34875,7 @@ loci_validate_of_sdwn_set_channel_OF_VERSION_1_3(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_SDWN_SET_CHANNEL, LENGTH);
     }
 
 
@@ -34881,7 +34889,7 @@ static int
 loci_validate_of_set_config_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, SHORT);
     }
 
     len = 12;
@@ -34889,7 +34897,7 @@ loci_validate_of_set_config_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, LENGTH);
     }
 
 
@@ -34903,14 +34911,14 @@ static int
 loci_validate_of_switch_config_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -34926,14 +34934,14 @@ static int
 loci_validate_of_table_feature_prop_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -34985,14 +34993,14 @@ static int
 loci_validate_of_table_feature_prop_apply_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -35013,14 +35021,14 @@ static int
 loci_validate_of_table_feature_prop_apply_actions_miss_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -35041,14 +35049,14 @@ static int
 loci_validate_of_table_feature_prop_apply_setfield_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD, LENGTH);
     }
 
     len = wire_len;
@@ -35069,14 +35077,14 @@ static int
 loci_validate_of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -35097,14 +35105,14 @@ static int
 loci_validate_of_table_feature_prop_experimenter_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -35124,14 +35132,14 @@ static int
 loci_validate_of_table_feature_prop_experimenter_miss_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -35151,14 +35159,14 @@ static int
 loci_validate_of_table_feature_prop_instructions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -35179,14 +35187,14 @@ static int
 loci_validate_of_table_feature_prop_instructions_miss_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -35207,14 +35215,14 @@ static int
 loci_validate_of_table_feature_prop_match_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_MATCH, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_MATCH, LENGTH);
     }
 
     len = wire_len;
@@ -35235,14 +35243,14 @@ static int
 loci_validate_of_table_feature_prop_next_tables_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES, LENGTH);
     }
 
     len = wire_len;
@@ -35263,14 +35271,14 @@ static int
 loci_validate_of_table_feature_prop_next_tables_miss_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -35291,14 +35299,14 @@ static int
 loci_validate_of_table_feature_prop_wildcards_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WILDCARDS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WILDCARDS, LENGTH);
     }
 
     len = wire_len;
@@ -35319,14 +35327,14 @@ static int
 loci_validate_of_table_feature_prop_write_actions_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -35347,14 +35355,14 @@ static int
 loci_validate_of_table_feature_prop_write_actions_miss_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -35375,14 +35383,14 @@ static int
 loci_validate_of_table_feature_prop_write_setfield_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD, LENGTH);
     }
 
     len = wire_len;
@@ -35403,14 +35411,14 @@ static int
 loci_validate_of_table_feature_prop_write_setfield_miss_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -35431,14 +35439,14 @@ static int
 loci_validate_of_table_features_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES, LENGTH);
     }
 
     len = wire_len;
@@ -35459,14 +35467,14 @@ static int
 loci_validate_of_table_features_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -35482,14 +35490,14 @@ static int
 loci_validate_of_table_features_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -35510,14 +35518,14 @@ static int
 loci_validate_of_table_features_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -35538,7 +35546,7 @@ static int
 loci_validate_of_table_mod_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, SHORT);
     }
 
     len = 16;
@@ -35546,7 +35554,7 @@ loci_validate_of_table_mod_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, LENGTH);
     }
 
 
@@ -35560,14 +35568,14 @@ static int
 loci_validate_of_table_mod_failed_error_msg_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -35583,7 +35591,7 @@ static int
 loci_validate_of_table_stats_entry_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_ENTRY, SHORT);
     }
 
     len = 24;
@@ -35599,14 +35607,14 @@ static int
 loci_validate_of_table_stats_reply_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -35627,7 +35635,7 @@ static int
 loci_validate_of_table_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -35635,7 +35643,7 @@ loci_validate_of_table_stats_request_OF_VERSION_1_3(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -35649,7 +35657,7 @@ static int
 loci_validate_of_uint32_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_UINT32, SHORT);
     }
 
     len = 4;
@@ -35665,7 +35673,7 @@ static int
 loci_validate_of_uint64_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_UINT64, SHORT);
     }
 
     len = 8;
@@ -35681,7 +35689,7 @@ static int
 loci_validate_of_uint8_OF_VERSION_1_3(uint8_t *data, int len, int *out_len)
 {
     if (len < 1) {
-        return -1;
+        VALIDATOR_FAIL(OF_UINT8, SHORT);
     }
 
     len = 1;
@@ -36524,14 +36532,14 @@ static int
 loci_validate_of_action_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION, LENGTH);
     }
 
     len = wire_len;
@@ -36585,14 +36593,14 @@ static int
 loci_validate_of_action_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID, LENGTH);
     }
 
     len = wire_len;
@@ -36646,14 +36654,14 @@ static int
 loci_validate_of_action_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -36677,14 +36685,14 @@ static int
 loci_validate_of_action_bsn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -36712,14 +36720,14 @@ static int
 loci_validate_of_action_id_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -36743,14 +36751,14 @@ static int
 loci_validate_of_action_id_bsn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -36778,7 +36786,7 @@ static int
 loci_validate_of_action_bsn_checksum_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, SHORT);
     }
 
     len = 28;
@@ -36786,7 +36794,7 @@ loci_validate_of_action_bsn_checksum_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_CHECKSUM, LENGTH);
     }
 
 
@@ -36800,7 +36808,7 @@ static int
 loci_validate_of_action_id_bsn_checksum_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_CHECKSUM, SHORT);
     }
 
     len = 12;
@@ -36808,7 +36816,7 @@ loci_validate_of_action_id_bsn_checksum_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_CHECKSUM, LENGTH);
     }
 
 
@@ -36822,14 +36830,14 @@ static int
 loci_validate_of_action_bsn_gentable_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_GENTABLE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_GENTABLE, LENGTH);
     }
 
     len = wire_len;
@@ -36850,7 +36858,7 @@ static int
 loci_validate_of_action_id_bsn_gentable_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_GENTABLE, SHORT);
     }
 
     len = 12;
@@ -36858,7 +36866,7 @@ loci_validate_of_action_id_bsn_gentable_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_GENTABLE, LENGTH);
     }
 
 
@@ -36872,7 +36880,7 @@ static int
 loci_validate_of_action_bsn_mirror_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, SHORT);
     }
 
     len = 24;
@@ -36880,7 +36888,7 @@ loci_validate_of_action_bsn_mirror_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_MIRROR, LENGTH);
     }
 
 
@@ -36894,7 +36902,7 @@ static int
 loci_validate_of_action_id_bsn_mirror_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_MIRROR, SHORT);
     }
 
     len = 12;
@@ -36902,7 +36910,7 @@ loci_validate_of_action_id_bsn_mirror_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_MIRROR, LENGTH);
     }
 
 
@@ -36916,7 +36924,7 @@ static int
 loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, SHORT);
     }
 
     len = 16;
@@ -36924,7 +36932,7 @@ loci_validate_of_action_bsn_set_tunnel_dst_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_BSN_SET_TUNNEL_DST, LENGTH);
     }
 
 
@@ -36938,7 +36946,7 @@ static int
 loci_validate_of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_SET_TUNNEL_DST, SHORT);
     }
 
     len = 12;
@@ -36946,7 +36954,7 @@ loci_validate_of_action_id_bsn_set_tunnel_dst_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_BSN_SET_TUNNEL_DST, LENGTH);
     }
 
 
@@ -36960,7 +36968,7 @@ static int
 loci_validate_of_action_copy_ttl_in_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, SHORT);
     }
 
     len = 8;
@@ -36968,7 +36976,7 @@ loci_validate_of_action_copy_ttl_in_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_IN, LENGTH);
     }
 
 
@@ -36982,7 +36990,7 @@ static int
 loci_validate_of_action_id_copy_ttl_in_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_IN, SHORT);
     }
 
     len = 4;
@@ -36990,7 +36998,7 @@ loci_validate_of_action_id_copy_ttl_in_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_IN, LENGTH);
     }
 
 
@@ -37004,7 +37012,7 @@ static int
 loci_validate_of_action_copy_ttl_out_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, SHORT);
     }
 
     len = 8;
@@ -37012,7 +37020,7 @@ loci_validate_of_action_copy_ttl_out_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_COPY_TTL_OUT, LENGTH);
     }
 
 
@@ -37026,7 +37034,7 @@ static int
 loci_validate_of_action_id_copy_ttl_out_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_OUT, SHORT);
     }
 
     len = 4;
@@ -37034,7 +37042,7 @@ loci_validate_of_action_id_copy_ttl_out_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_COPY_TTL_OUT, LENGTH);
     }
 
 
@@ -37048,7 +37056,7 @@ static int
 loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -37056,7 +37064,7 @@ loci_validate_of_action_dec_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_MPLS_TTL, LENGTH);
     }
 
 
@@ -37070,7 +37078,7 @@ static int
 loci_validate_of_action_id_dec_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_MPLS_TTL, SHORT);
     }
 
     len = 4;
@@ -37078,7 +37086,7 @@ loci_validate_of_action_id_dec_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_MPLS_TTL, LENGTH);
     }
 
 
@@ -37092,7 +37100,7 @@ static int
 loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -37100,7 +37108,7 @@ loci_validate_of_action_dec_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_DEC_NW_TTL, LENGTH);
     }
 
 
@@ -37114,7 +37122,7 @@ static int
 loci_validate_of_action_id_dec_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_NW_TTL, SHORT);
     }
 
     len = 4;
@@ -37122,7 +37130,7 @@ loci_validate_of_action_id_dec_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_DEC_NW_TTL, LENGTH);
     }
 
 
@@ -37136,7 +37144,7 @@ static int
 loci_validate_of_action_group_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, SHORT);
     }
 
     len = 8;
@@ -37144,7 +37152,7 @@ loci_validate_of_action_group_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_GROUP, LENGTH);
     }
 
 
@@ -37158,7 +37166,7 @@ static int
 loci_validate_of_action_id_group_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_GROUP, SHORT);
     }
 
     len = 4;
@@ -37166,7 +37174,7 @@ loci_validate_of_action_id_group_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_GROUP, LENGTH);
     }
 
 
@@ -37180,14 +37188,14 @@ static int
 loci_validate_of_action_nicira_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA, LENGTH);
     }
 
     len = wire_len;
@@ -37219,14 +37227,14 @@ static int
 loci_validate_of_action_id_nicira_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA, LENGTH);
     }
 
     len = wire_len;
@@ -37258,7 +37266,7 @@ static int
 loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, SHORT);
     }
 
     len = 16;
@@ -37266,7 +37274,7 @@ loci_validate_of_action_nicira_dec_ttl_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_DEC_TTL, LENGTH);
     }
 
 
@@ -37280,7 +37288,7 @@ static int
 loci_validate_of_action_id_nicira_dec_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_DEC_TTL, SHORT);
     }
 
     len = 10;
@@ -37288,7 +37296,7 @@ loci_validate_of_action_id_nicira_dec_ttl_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_DEC_TTL, LENGTH);
     }
 
 
@@ -37302,7 +37310,7 @@ static int
 loci_validate_of_action_nicira_move_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, SHORT);
     }
 
     len = 24;
@@ -37310,7 +37318,7 @@ loci_validate_of_action_nicira_move_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_MOVE, LENGTH);
     }
 
 
@@ -37324,7 +37332,7 @@ static int
 loci_validate_of_action_id_nicira_move_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_MOVE, SHORT);
     }
 
     len = 10;
@@ -37332,7 +37340,7 @@ loci_validate_of_action_id_nicira_move_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_MOVE, LENGTH);
     }
 
 
@@ -37346,7 +37354,7 @@ static int
 loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, SHORT);
     }
 
     len = 16;
@@ -37354,7 +37362,7 @@ loci_validate_of_action_nicira_pop_nsh_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_POP_NSH, LENGTH);
     }
 
 
@@ -37368,7 +37376,7 @@ static int
 loci_validate_of_action_id_nicira_pop_nsh_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_POP_NSH, SHORT);
     }
 
     len = 10;
@@ -37376,7 +37384,7 @@ loci_validate_of_action_id_nicira_pop_nsh_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_POP_NSH, LENGTH);
     }
 
 
@@ -37390,7 +37398,7 @@ static int
 loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, SHORT);
     }
 
     len = 16;
@@ -37398,7 +37406,7 @@ loci_validate_of_action_nicira_push_nsh_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_PUSH_NSH, LENGTH);
     }
 
 
@@ -37412,7 +37420,7 @@ static int
 loci_validate_of_action_id_nicira_push_nsh_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_PUSH_NSH, SHORT);
     }
 
     len = 10;
@@ -37420,7 +37428,7 @@ loci_validate_of_action_id_nicira_push_nsh_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_PUSH_NSH, LENGTH);
     }
 
 
@@ -37434,7 +37442,7 @@ static int
 loci_validate_of_action_nicira_resubmit_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, SHORT);
     }
 
     len = 16;
@@ -37442,7 +37450,7 @@ loci_validate_of_action_nicira_resubmit_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT, LENGTH);
     }
 
 
@@ -37456,7 +37464,7 @@ static int
 loci_validate_of_action_id_nicira_resubmit_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT, SHORT);
     }
 
     len = 10;
@@ -37464,7 +37472,7 @@ loci_validate_of_action_id_nicira_resubmit_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT, LENGTH);
     }
 
 
@@ -37478,7 +37486,7 @@ static int
 loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, SHORT);
     }
 
     len = 16;
@@ -37486,7 +37494,7 @@ loci_validate_of_action_nicira_resubmit_table_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_NICIRA_RESUBMIT_TABLE, LENGTH);
     }
 
 
@@ -37500,7 +37508,7 @@ static int
 loci_validate_of_action_id_nicira_resubmit_table_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT_TABLE, SHORT);
     }
 
     len = 10;
@@ -37508,7 +37516,7 @@ loci_validate_of_action_id_nicira_resubmit_table_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_NICIRA_RESUBMIT_TABLE, LENGTH);
     }
 
 
@@ -37522,7 +37530,7 @@ static int
 loci_validate_of_action_output_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, SHORT);
     }
 
     len = 16;
@@ -37530,7 +37538,7 @@ loci_validate_of_action_output_OF_VERSION_1_4(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_OUTPUT, LENGTH);
     }
 
 
@@ -37544,7 +37552,7 @@ static int
 loci_validate_of_action_id_output_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OUTPUT, SHORT);
     }
 
     len = 4;
@@ -37552,7 +37560,7 @@ loci_validate_of_action_id_output_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_OUTPUT, LENGTH);
     }
 
 
@@ -37566,7 +37574,7 @@ static int
 loci_validate_of_action_pop_mpls_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, SHORT);
     }
 
     len = 8;
@@ -37574,7 +37582,7 @@ loci_validate_of_action_pop_mpls_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_MPLS, LENGTH);
     }
 
 
@@ -37588,7 +37596,7 @@ static int
 loci_validate_of_action_id_pop_mpls_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_MPLS, SHORT);
     }
 
     len = 4;
@@ -37596,7 +37604,7 @@ loci_validate_of_action_id_pop_mpls_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_MPLS, LENGTH);
     }
 
 
@@ -37610,7 +37618,7 @@ static int
 loci_validate_of_action_pop_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_PBB, SHORT);
     }
 
     len = 8;
@@ -37618,7 +37626,7 @@ loci_validate_of_action_pop_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_PBB, LENGTH);
     }
 
 
@@ -37632,7 +37640,7 @@ static int
 loci_validate_of_action_id_pop_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_PBB, SHORT);
     }
 
     len = 4;
@@ -37640,7 +37648,7 @@ loci_validate_of_action_id_pop_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_PBB, LENGTH);
     }
 
 
@@ -37654,7 +37662,7 @@ static int
 loci_validate_of_action_pop_vlan_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, SHORT);
     }
 
     len = 8;
@@ -37662,7 +37670,7 @@ loci_validate_of_action_pop_vlan_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_POP_VLAN, LENGTH);
     }
 
 
@@ -37676,7 +37684,7 @@ static int
 loci_validate_of_action_id_pop_vlan_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_VLAN, SHORT);
     }
 
     len = 4;
@@ -37684,7 +37692,7 @@ loci_validate_of_action_id_pop_vlan_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_POP_VLAN, LENGTH);
     }
 
 
@@ -37698,7 +37706,7 @@ static int
 loci_validate_of_action_push_mpls_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, SHORT);
     }
 
     len = 8;
@@ -37706,7 +37714,7 @@ loci_validate_of_action_push_mpls_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_MPLS, LENGTH);
     }
 
 
@@ -37720,7 +37728,7 @@ static int
 loci_validate_of_action_id_push_mpls_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_MPLS, SHORT);
     }
 
     len = 4;
@@ -37728,7 +37736,7 @@ loci_validate_of_action_id_push_mpls_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_MPLS, LENGTH);
     }
 
 
@@ -37742,7 +37750,7 @@ static int
 loci_validate_of_action_push_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_PBB, SHORT);
     }
 
     len = 8;
@@ -37750,7 +37758,7 @@ loci_validate_of_action_push_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_PBB, LENGTH);
     }
 
 
@@ -37764,7 +37772,7 @@ static int
 loci_validate_of_action_id_push_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_PBB, SHORT);
     }
 
     len = 4;
@@ -37772,7 +37780,7 @@ loci_validate_of_action_id_push_pbb_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_PBB, LENGTH);
     }
 
 
@@ -37786,7 +37794,7 @@ static int
 loci_validate_of_action_push_vlan_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, SHORT);
     }
 
     len = 8;
@@ -37794,7 +37802,7 @@ loci_validate_of_action_push_vlan_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_PUSH_VLAN, LENGTH);
     }
 
 
@@ -37808,7 +37816,7 @@ static int
 loci_validate_of_action_id_push_vlan_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_VLAN, SHORT);
     }
 
     len = 4;
@@ -37816,7 +37824,7 @@ loci_validate_of_action_id_push_vlan_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_PUSH_VLAN, LENGTH);
     }
 
 
@@ -37830,7 +37838,7 @@ static int
 loci_validate_of_oxm_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM, SHORT);
     }
 
 
@@ -38185,14 +38193,14 @@ static int
 loci_validate_of_action_set_field_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_FIELD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_FIELD, LENGTH);
     }
 
     len = wire_len;
@@ -38208,7 +38216,7 @@ static int
 loci_validate_of_action_id_set_field_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_FIELD, SHORT);
     }
 
     len = 4;
@@ -38216,7 +38224,7 @@ loci_validate_of_action_id_set_field_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_FIELD, LENGTH);
     }
 
 
@@ -38230,7 +38238,7 @@ static int
 loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, SHORT);
     }
 
     len = 8;
@@ -38238,7 +38246,7 @@ loci_validate_of_action_set_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_MPLS_TTL, LENGTH);
     }
 
 
@@ -38252,7 +38260,7 @@ static int
 loci_validate_of_action_id_set_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_MPLS_TTL, SHORT);
     }
 
     len = 4;
@@ -38260,7 +38268,7 @@ loci_validate_of_action_id_set_mpls_ttl_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_MPLS_TTL, LENGTH);
     }
 
 
@@ -38274,7 +38282,7 @@ static int
 loci_validate_of_action_set_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, SHORT);
     }
 
     len = 8;
@@ -38282,7 +38290,7 @@ loci_validate_of_action_set_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_NW_TTL, LENGTH);
     }
 
 
@@ -38296,7 +38304,7 @@ static int
 loci_validate_of_action_id_set_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_NW_TTL, SHORT);
     }
 
     len = 4;
@@ -38304,7 +38312,7 @@ loci_validate_of_action_id_set_nw_ttl_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_NW_TTL, LENGTH);
     }
 
 
@@ -38318,7 +38326,7 @@ static int
 loci_validate_of_action_set_queue_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, SHORT);
     }
 
     len = 8;
@@ -38326,7 +38334,7 @@ loci_validate_of_action_set_queue_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_SET_QUEUE, LENGTH);
     }
 
 
@@ -38340,7 +38348,7 @@ static int
 loci_validate_of_action_id_set_queue_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_QUEUE, SHORT);
     }
 
     len = 4;
@@ -38348,7 +38356,7 @@ loci_validate_of_action_id_set_queue_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ACTION_ID_SET_QUEUE, LENGTH);
     }
 
 
@@ -38362,14 +38370,14 @@ static int
 loci_validate_of_header_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -38455,14 +38463,14 @@ static int
 loci_validate_of_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -38516,7 +38524,7 @@ static int
 loci_validate_of_aggregate_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, SHORT);
     }
 
     len = 40;
@@ -38524,7 +38532,7 @@ loci_validate_of_aggregate_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REPLY, LENGTH);
     }
 
 
@@ -38538,14 +38546,14 @@ static int
 loci_validate_of_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -38599,14 +38607,14 @@ static int
 loci_validate_of_aggregate_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_AGGREGATE_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -38623,14 +38631,14 @@ static int
 loci_validate_of_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -38688,14 +38696,14 @@ static int
 loci_validate_of_async_config_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -38711,14 +38719,14 @@ static int
 loci_validate_of_async_config_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -38766,7 +38774,7 @@ static int
 loci_validate_of_async_config_prop_experimenter_master_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_EXPERIMENTER_MASTER, SHORT);
     }
 
     len = 4;
@@ -38774,7 +38782,7 @@ loci_validate_of_async_config_prop_experimenter_master_OF_VERSION_1_4(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_EXPERIMENTER_MASTER, LENGTH);
     }
 
 
@@ -38788,7 +38796,7 @@ static int
 loci_validate_of_async_config_prop_experimenter_slave_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_EXPERIMENTER_SLAVE, SHORT);
     }
 
     len = 4;
@@ -38796,7 +38804,7 @@ loci_validate_of_async_config_prop_experimenter_slave_OF_VERSION_1_4(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_EXPERIMENTER_SLAVE, LENGTH);
     }
 
 
@@ -38810,7 +38818,7 @@ static int
 loci_validate_of_async_config_prop_flow_removed_master_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_FLOW_REMOVED_MASTER, SHORT);
     }
 
     len = 8;
@@ -38818,7 +38826,7 @@ loci_validate_of_async_config_prop_flow_removed_master_OF_VERSION_1_4(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_FLOW_REMOVED_MASTER, LENGTH);
     }
 
 
@@ -38832,7 +38840,7 @@ static int
 loci_validate_of_async_config_prop_flow_removed_slave_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_FLOW_REMOVED_SLAVE, SHORT);
     }
 
     len = 8;
@@ -38840,7 +38848,7 @@ loci_validate_of_async_config_prop_flow_removed_slave_OF_VERSION_1_4(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_FLOW_REMOVED_SLAVE, LENGTH);
     }
 
 
@@ -38854,7 +38862,7 @@ static int
 loci_validate_of_async_config_prop_packet_in_master_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PACKET_IN_MASTER, SHORT);
     }
 
     len = 8;
@@ -38862,7 +38870,7 @@ loci_validate_of_async_config_prop_packet_in_master_OF_VERSION_1_4(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PACKET_IN_MASTER, LENGTH);
     }
 
 
@@ -38876,7 +38884,7 @@ static int
 loci_validate_of_async_config_prop_packet_in_slave_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PACKET_IN_SLAVE, SHORT);
     }
 
     len = 8;
@@ -38884,7 +38892,7 @@ loci_validate_of_async_config_prop_packet_in_slave_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PACKET_IN_SLAVE, LENGTH);
     }
 
 
@@ -38898,7 +38906,7 @@ static int
 loci_validate_of_async_config_prop_port_status_master_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PORT_STATUS_MASTER, SHORT);
     }
 
     len = 8;
@@ -38906,7 +38914,7 @@ loci_validate_of_async_config_prop_port_status_master_OF_VERSION_1_4(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PORT_STATUS_MASTER, LENGTH);
     }
 
 
@@ -38920,7 +38928,7 @@ static int
 loci_validate_of_async_config_prop_port_status_slave_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PORT_STATUS_SLAVE, SHORT);
     }
 
     len = 8;
@@ -38928,7 +38936,7 @@ loci_validate_of_async_config_prop_port_status_slave_OF_VERSION_1_4(uint8_t *dat
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_PORT_STATUS_SLAVE, LENGTH);
     }
 
 
@@ -38942,7 +38950,7 @@ static int
 loci_validate_of_async_config_prop_requestforward_master_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_REQUESTFORWARD_MASTER, SHORT);
     }
 
     len = 8;
@@ -38950,7 +38958,7 @@ loci_validate_of_async_config_prop_requestforward_master_OF_VERSION_1_4(uint8_t
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_REQUESTFORWARD_MASTER, LENGTH);
     }
 
 
@@ -38964,7 +38972,7 @@ static int
 loci_validate_of_async_config_prop_requestforward_slave_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_REQUESTFORWARD_SLAVE, SHORT);
     }
 
     len = 8;
@@ -38972,7 +38980,7 @@ loci_validate_of_async_config_prop_requestforward_slave_OF_VERSION_1_4(uint8_t *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_REQUESTFORWARD_SLAVE, LENGTH);
     }
 
 
@@ -38986,7 +38994,7 @@ static int
 loci_validate_of_async_config_prop_role_status_master_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_ROLE_STATUS_MASTER, SHORT);
     }
 
     len = 8;
@@ -38994,7 +39002,7 @@ loci_validate_of_async_config_prop_role_status_master_OF_VERSION_1_4(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_ROLE_STATUS_MASTER, LENGTH);
     }
 
 
@@ -39008,7 +39016,7 @@ static int
 loci_validate_of_async_config_prop_role_status_slave_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_ROLE_STATUS_SLAVE, SHORT);
     }
 
     len = 8;
@@ -39016,7 +39024,7 @@ loci_validate_of_async_config_prop_role_status_slave_OF_VERSION_1_4(uint8_t *dat
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_ROLE_STATUS_SLAVE, LENGTH);
     }
 
 
@@ -39030,7 +39038,7 @@ static int
 loci_validate_of_async_config_prop_table_status_master_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_TABLE_STATUS_MASTER, SHORT);
     }
 
     len = 8;
@@ -39038,7 +39046,7 @@ loci_validate_of_async_config_prop_table_status_master_OF_VERSION_1_4(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_TABLE_STATUS_MASTER, LENGTH);
     }
 
 
@@ -39052,7 +39060,7 @@ static int
 loci_validate_of_async_config_prop_table_status_slave_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_TABLE_STATUS_SLAVE, SHORT);
     }
 
     len = 8;
@@ -39060,7 +39068,7 @@ loci_validate_of_async_config_prop_table_status_slave_OF_VERSION_1_4(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_CONFIG_PROP_TABLE_STATUS_SLAVE, LENGTH);
     }
 
 
@@ -39074,14 +39082,14 @@ static int
 loci_validate_of_async_get_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -39102,14 +39110,14 @@ static int
 loci_validate_of_async_get_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_GET_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -39130,14 +39138,14 @@ static int
 loci_validate_of_async_set_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_SET, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ASYNC_SET, LENGTH);
     }
 
     len = wire_len;
@@ -39158,14 +39166,14 @@ static int
 loci_validate_of_bad_action_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_ACTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -39181,14 +39189,14 @@ static int
 loci_validate_of_bad_instruction_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_INSTRUCTION_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -39204,14 +39212,14 @@ static int
 loci_validate_of_bad_match_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_MATCH_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -39227,14 +39235,14 @@ static int
 loci_validate_of_bad_property_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_PROPERTY_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_PROPERTY_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -39250,14 +39258,14 @@ static int
 loci_validate_of_bad_request_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BAD_REQUEST_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -39273,7 +39281,7 @@ static int
 loci_validate_of_barrier_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, SHORT);
     }
 
     len = 8;
@@ -39281,7 +39289,7 @@ loci_validate_of_barrier_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REPLY, LENGTH);
     }
 
 
@@ -39295,7 +39303,7 @@ static int
 loci_validate_of_barrier_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, SHORT);
     }
 
     len = 8;
@@ -39303,7 +39311,7 @@ loci_validate_of_barrier_request_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BARRIER_REQUEST, LENGTH);
     }
 
 
@@ -39317,14 +39325,14 @@ static int
 loci_validate_of_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -39348,14 +39356,14 @@ static int
 loci_validate_of_bsn_header_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -39487,7 +39495,7 @@ static int
 loci_validate_of_bsn_arp_idle_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ARP_IDLE, SHORT);
     }
 
     len = 24;
@@ -39495,7 +39503,7 @@ loci_validate_of_bsn_arp_idle_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ARP_IDLE, LENGTH);
     }
 
 
@@ -39509,14 +39517,14 @@ static int
 loci_validate_of_experimenter_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -39538,14 +39546,14 @@ static int
 loci_validate_of_bsn_base_error_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BASE_ERROR, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BASE_ERROR, LENGTH);
     }
 
     len = wire_len;
@@ -39567,7 +39575,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, SHORT);
     }
 
     len = 20;
@@ -39575,7 +39583,7 @@ loci_validate_of_bsn_bw_clear_data_reply_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REPLY, LENGTH);
     }
 
 
@@ -39589,7 +39597,7 @@ static int
 loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, SHORT);
     }
 
     len = 16;
@@ -39597,7 +39605,7 @@ loci_validate_of_bsn_bw_clear_data_request_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_CLEAR_DATA_REQUEST, LENGTH);
     }
 
 
@@ -39611,7 +39619,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, SHORT);
     }
 
     len = 20;
@@ -39619,7 +39627,7 @@ loci_validate_of_bsn_bw_enable_get_reply_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REPLY, LENGTH);
     }
 
 
@@ -39633,7 +39641,7 @@ static int
 loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -39641,7 +39649,7 @@ loci_validate_of_bsn_bw_enable_get_request_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_GET_REQUEST, LENGTH);
     }
 
 
@@ -39655,7 +39663,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, SHORT);
     }
 
     len = 24;
@@ -39663,7 +39671,7 @@ loci_validate_of_bsn_bw_enable_set_reply_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REPLY, LENGTH);
     }
 
 
@@ -39677,7 +39685,7 @@ static int
 loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, SHORT);
     }
 
     len = 20;
@@ -39685,7 +39693,7 @@ loci_validate_of_bsn_bw_enable_set_request_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_BW_ENABLE_SET_REQUEST, LENGTH);
     }
 
 
@@ -39699,7 +39707,7 @@ static int
 loci_validate_of_bsn_controller_connection_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 264) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTION, SHORT);
     }
 
     len = 264;
@@ -39715,14 +39723,14 @@ static int
 loci_validate_of_bsn_controller_connections_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -39743,7 +39751,7 @@ static int
 loci_validate_of_bsn_controller_connections_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -39751,7 +39759,7 @@ loci_validate_of_bsn_controller_connections_request_OF_VERSION_1_4(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_CONTROLLER_CONNECTIONS_REQUEST, LENGTH);
     }
 
 
@@ -39765,7 +39773,7 @@ static int
 loci_validate_of_bsn_debug_counter_desc_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 328) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY, SHORT);
     }
 
     len = 328;
@@ -39781,14 +39789,14 @@ static int
 loci_validate_of_experimenter_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -39810,14 +39818,14 @@ static int
 loci_validate_of_bsn_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -39869,14 +39877,14 @@ static int
 loci_validate_of_bsn_debug_counter_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -39897,14 +39905,14 @@ static int
 loci_validate_of_experimenter_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_EXPERIMENTER_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -39926,14 +39934,14 @@ static int
 loci_validate_of_bsn_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -39985,7 +39993,7 @@ static int
 loci_validate_of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -39993,7 +40001,7 @@ loci_validate_of_bsn_debug_counter_desc_stats_request_OF_VERSION_1_4(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40007,7 +40015,7 @@ static int
 loci_validate_of_bsn_debug_counter_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_ENTRY, SHORT);
     }
 
     len = 16;
@@ -40023,14 +40031,14 @@ static int
 loci_validate_of_bsn_debug_counter_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40051,7 +40059,7 @@ static int
 loci_validate_of_bsn_debug_counter_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -40059,7 +40067,7 @@ loci_validate_of_bsn_debug_counter_stats_request_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_DEBUG_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40073,14 +40081,14 @@ static int
 loci_validate_of_bsn_error_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ERROR, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_ERROR, LENGTH);
     }
 
     len = wire_len;
@@ -40096,7 +40104,7 @@ static int
 loci_validate_of_bsn_flow_checksum_bucket_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_ENTRY, SHORT);
     }
 
     len = 8;
@@ -40112,14 +40120,14 @@ static int
 loci_validate_of_bsn_flow_checksum_bucket_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40140,7 +40148,7 @@ static int
 loci_validate_of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST, SHORT);
     }
 
     len = 25;
@@ -40148,7 +40156,7 @@ loci_validate_of_bsn_flow_checksum_bucket_stats_request_OF_VERSION_1_4(uint8_t *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40162,14 +40170,14 @@ static int
 loci_validate_of_bsn_flow_idle_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE, LENGTH);
     }
 
     len = wire_len;
@@ -40186,7 +40194,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY, SHORT);
     }
 
     len = 20;
@@ -40194,7 +40202,7 @@ loci_validate_of_bsn_flow_idle_enable_get_reply_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY, LENGTH);
     }
 
 
@@ -40208,7 +40216,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_get_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST, SHORT);
     }
 
     len = 16;
@@ -40216,7 +40224,7 @@ loci_validate_of_bsn_flow_idle_enable_get_request_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST, LENGTH);
     }
 
 
@@ -40230,7 +40238,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY, SHORT);
     }
 
     len = 24;
@@ -40238,7 +40246,7 @@ loci_validate_of_bsn_flow_idle_enable_set_reply_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY, LENGTH);
     }
 
 
@@ -40252,7 +40260,7 @@ static int
 loci_validate_of_bsn_flow_idle_enable_set_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST, SHORT);
     }
 
     len = 20;
@@ -40260,7 +40268,7 @@ loci_validate_of_bsn_flow_idle_enable_set_request_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST, LENGTH);
     }
 
 
@@ -40274,14 +40282,14 @@ static int
 loci_validate_of_bsn_generic_async_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_ASYNC, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_ASYNC, LENGTH);
     }
 
     len = wire_len;
@@ -40302,14 +40310,14 @@ static int
 loci_validate_of_bsn_generic_command_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_COMMAND, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_COMMAND, LENGTH);
     }
 
     len = wire_len;
@@ -40330,14 +40338,14 @@ static int
 loci_validate_of_bsn_generic_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 2) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 2) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -40358,14 +40366,14 @@ static int
 loci_validate_of_bsn_generic_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40386,14 +40394,14 @@ static int
 loci_validate_of_bsn_generic_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 88) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENERIC_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -40414,7 +40422,7 @@ static int
 loci_validate_of_bsn_gentable_bucket_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_ENTRY, SHORT);
     }
 
     len = 16;
@@ -40430,14 +40438,14 @@ static int
 loci_validate_of_bsn_gentable_bucket_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40458,7 +40466,7 @@ static int
 loci_validate_of_bsn_gentable_bucket_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REQUEST, SHORT);
     }
 
     len = 26;
@@ -40466,7 +40474,7 @@ loci_validate_of_bsn_gentable_bucket_stats_request_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_BUCKET_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40480,7 +40488,7 @@ static int
 loci_validate_of_bsn_gentable_clear_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REPLY, SHORT);
     }
 
     len = 28;
@@ -40488,7 +40496,7 @@ loci_validate_of_bsn_gentable_clear_reply_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REPLY, LENGTH);
     }
 
 
@@ -40502,7 +40510,7 @@ static int
 loci_validate_of_bsn_gentable_clear_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REQUEST, SHORT);
     }
 
     len = 52;
@@ -40510,7 +40518,7 @@ loci_validate_of_bsn_gentable_clear_request_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_CLEAR_REQUEST, LENGTH);
     }
 
 
@@ -40524,7 +40532,7 @@ static int
 loci_validate_of_bsn_gentable_desc_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 48) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_ENTRY, SHORT);
     }
 
     len = 48;
@@ -40532,7 +40540,7 @@ loci_validate_of_bsn_gentable_desc_stats_entry_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 48) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_ENTRY, LENGTH);
     }
 
 
@@ -40546,14 +40554,14 @@ static int
 loci_validate_of_bsn_gentable_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40574,7 +40582,7 @@ static int
 loci_validate_of_bsn_gentable_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -40582,7 +40590,7 @@ loci_validate_of_bsn_gentable_desc_stats_request_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40596,14 +40604,14 @@ static int
 loci_validate_of_bsn_gentable_entry_add_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -40614,7 +40622,7 @@ loci_validate_of_bsn_gentable_entry_add_OF_VERSION_1_4(uint8_t *data, int len, i
 
 
     if (36 + wire_len_key > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_ADD, LENGTH);
     }
 
     if (loci_validate_of_list_bsn_tlv_OF_VERSION_1_4(data + 36, wire_len_key, out_len) < 0) {
@@ -40631,14 +40639,14 @@ static int
 loci_validate_of_bsn_gentable_entry_delete_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -40659,14 +40667,14 @@ static int
 loci_validate_of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -40677,7 +40685,7 @@ loci_validate_of_bsn_gentable_entry_desc_stats_entry_OF_VERSION_1_4(uint8_t *dat
 
 
     if (20 + wire_len_key > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY, LENGTH);
     }
 
     if (loci_validate_of_list_bsn_tlv_OF_VERSION_1_4(data + 20, wire_len_key, out_len) < 0) {
@@ -40694,14 +40702,14 @@ static int
 loci_validate_of_bsn_gentable_entry_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40722,7 +40730,7 @@ static int
 loci_validate_of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 60;
@@ -40730,7 +40738,7 @@ loci_validate_of_bsn_gentable_entry_desc_stats_request_OF_VERSION_1_4(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40744,14 +40752,14 @@ static int
 loci_validate_of_bsn_gentable_entry_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -40762,7 +40770,7 @@ loci_validate_of_bsn_gentable_entry_stats_entry_OF_VERSION_1_4(uint8_t *data, in
 
 
     if (4 + wire_len_key > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_ENTRY, LENGTH);
     }
 
     if (loci_validate_of_list_bsn_tlv_OF_VERSION_1_4(data + 4, wire_len_key, out_len) < 0) {
@@ -40779,14 +40787,14 @@ static int
 loci_validate_of_bsn_gentable_entry_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40807,7 +40815,7 @@ static int
 loci_validate_of_bsn_gentable_entry_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REQUEST, SHORT);
     }
 
     len = 60;
@@ -40815,7 +40823,7 @@ loci_validate_of_bsn_gentable_entry_stats_request_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 60) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_ENTRY_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40829,7 +40837,7 @@ static int
 loci_validate_of_bsn_gentable_set_buckets_size_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_SET_BUCKETS_SIZE, SHORT);
     }
 
     len = 24;
@@ -40837,7 +40845,7 @@ loci_validate_of_bsn_gentable_set_buckets_size_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_SET_BUCKETS_SIZE, LENGTH);
     }
 
 
@@ -40851,7 +40859,7 @@ static int
 loci_validate_of_bsn_gentable_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_ENTRY, SHORT);
     }
 
     len = 24;
@@ -40867,14 +40875,14 @@ static int
 loci_validate_of_bsn_gentable_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40895,7 +40903,7 @@ static int
 loci_validate_of_bsn_gentable_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -40903,7 +40911,7 @@ loci_validate_of_bsn_gentable_stats_request_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GENTABLE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -40917,14 +40925,14 @@ static int
 loci_validate_of_bsn_get_interfaces_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -40945,7 +40953,7 @@ static int
 loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, SHORT);
     }
 
     len = 16;
@@ -40953,7 +40961,7 @@ loci_validate_of_bsn_get_interfaces_request_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_INTERFACES_REQUEST, LENGTH);
     }
 
 
@@ -40967,7 +40975,7 @@ static int
 loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, SHORT);
     }
 
     len = 20;
@@ -40975,7 +40983,7 @@ loci_validate_of_bsn_get_mirroring_reply_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REPLY, LENGTH);
     }
 
 
@@ -40989,7 +40997,7 @@ static int
 loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, SHORT);
     }
 
     len = 20;
@@ -40997,7 +41005,7 @@ loci_validate_of_bsn_get_mirroring_request_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_MIRRORING_REQUEST, LENGTH);
     }
 
 
@@ -41011,7 +41019,7 @@ static int
 loci_validate_of_bsn_get_switch_pipeline_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REPLY, SHORT);
     }
 
     len = 272;
@@ -41019,7 +41027,7 @@ loci_validate_of_bsn_get_switch_pipeline_reply_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REPLY, LENGTH);
     }
 
 
@@ -41033,7 +41041,7 @@ static int
 loci_validate_of_bsn_get_switch_pipeline_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REQUEST, SHORT);
     }
 
     len = 16;
@@ -41041,7 +41049,7 @@ loci_validate_of_bsn_get_switch_pipeline_request_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_GET_SWITCH_PIPELINE_REQUEST, LENGTH);
     }
 
 
@@ -41055,7 +41063,7 @@ static int
 loci_validate_of_bsn_image_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 536) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REPLY, SHORT);
     }
 
     len = 536;
@@ -41063,7 +41071,7 @@ loci_validate_of_bsn_image_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 536) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REPLY, LENGTH);
     }
 
 
@@ -41077,7 +41085,7 @@ static int
 loci_validate_of_bsn_image_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -41085,7 +41093,7 @@ loci_validate_of_bsn_image_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_IMAGE_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -41099,7 +41107,7 @@ static int
 loci_validate_of_bsn_interface_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_INTERFACE, SHORT);
     }
 
     len = 32;
@@ -41115,7 +41123,7 @@ static int
 loci_validate_of_bsn_lacp_convergence_notif_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_CONVERGENCE_NOTIF, SHORT);
     }
 
     len = 52;
@@ -41123,7 +41131,7 @@ loci_validate_of_bsn_lacp_convergence_notif_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 52) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_CONVERGENCE_NOTIF, LENGTH);
     }
 
 
@@ -41137,7 +41145,7 @@ static int
 loci_validate_of_bsn_lacp_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_ENTRY, SHORT);
     }
 
     len = 36;
@@ -41153,14 +41161,14 @@ static int
 loci_validate_of_bsn_lacp_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -41181,7 +41189,7 @@ static int
 loci_validate_of_bsn_lacp_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -41189,7 +41197,7 @@ loci_validate_of_bsn_lacp_stats_request_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LACP_STATS_REQUEST, LENGTH);
     }
 
 
@@ -41203,14 +41211,14 @@ static int
 loci_validate_of_bsn_log_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 17) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LOG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 17) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LOG, LENGTH);
     }
 
     len = wire_len;
@@ -41226,14 +41234,14 @@ static int
 loci_validate_of_bsn_lua_command_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -41249,14 +41257,14 @@ static int
 loci_validate_of_bsn_lua_command_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_COMMAND_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -41272,14 +41280,14 @@ static int
 loci_validate_of_bsn_lua_notification_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_NOTIFICATION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_NOTIFICATION, LENGTH);
     }
 
     len = wire_len;
@@ -41295,14 +41303,14 @@ static int
 loci_validate_of_bsn_lua_upload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 82) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_UPLOAD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 82) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_LUA_UPLOAD, LENGTH);
     }
 
     len = wire_len;
@@ -41318,7 +41326,7 @@ static int
 loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, SHORT);
     }
 
     len = 25;
@@ -41326,7 +41334,7 @@ loci_validate_of_bsn_pdu_rx_reply_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REPLY, LENGTH);
     }
 
 
@@ -41340,14 +41348,14 @@ static int
 loci_validate_of_bsn_pdu_rx_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -41363,7 +41371,7 @@ static int
 loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, SHORT);
     }
 
     len = 21;
@@ -41371,7 +41379,7 @@ loci_validate_of_bsn_pdu_rx_timeout_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_RX_TIMEOUT, LENGTH);
     }
 
 
@@ -41385,7 +41393,7 @@ static int
 loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, SHORT);
     }
 
     len = 25;
@@ -41393,7 +41401,7 @@ loci_validate_of_bsn_pdu_tx_reply_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 25) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REPLY, LENGTH);
     }
 
 
@@ -41407,14 +41415,14 @@ static int
 loci_validate_of_bsn_pdu_tx_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PDU_TX_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -41430,14 +41438,14 @@ static int
 loci_validate_of_bsn_port_counter_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -41458,14 +41466,14 @@ static int
 loci_validate_of_bsn_port_counter_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -41486,7 +41494,7 @@ static int
 loci_validate_of_bsn_port_counter_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 28;
@@ -41494,7 +41502,7 @@ loci_validate_of_bsn_port_counter_stats_request_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_PORT_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -41508,7 +41516,7 @@ static int
 loci_validate_of_bsn_set_aux_cxns_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REPLY, SHORT);
     }
 
     len = 24;
@@ -41516,7 +41524,7 @@ loci_validate_of_bsn_set_aux_cxns_reply_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REPLY, LENGTH);
     }
 
 
@@ -41530,7 +41538,7 @@ static int
 loci_validate_of_bsn_set_aux_cxns_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REQUEST, SHORT);
     }
 
     len = 20;
@@ -41538,7 +41546,7 @@ loci_validate_of_bsn_set_aux_cxns_request_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_AUX_CXNS_REQUEST, LENGTH);
     }
 
 
@@ -41552,7 +41560,7 @@ static int
 loci_validate_of_bsn_set_lacp_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REPLY, SHORT);
     }
 
     len = 24;
@@ -41560,7 +41568,7 @@ loci_validate_of_bsn_set_lacp_reply_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REPLY, LENGTH);
     }
 
 
@@ -41574,7 +41582,7 @@ static int
 loci_validate_of_bsn_set_lacp_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 38) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REQUEST, SHORT);
     }
 
     len = 38;
@@ -41582,7 +41590,7 @@ loci_validate_of_bsn_set_lacp_request_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 38) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_LACP_REQUEST, LENGTH);
     }
 
 
@@ -41596,7 +41604,7 @@ static int
 loci_validate_of_bsn_set_mirroring_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, SHORT);
     }
 
     len = 20;
@@ -41604,7 +41612,7 @@ loci_validate_of_bsn_set_mirroring_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_MIRRORING, LENGTH);
     }
 
 
@@ -41618,7 +41626,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, SHORT);
     }
 
     len = 20;
@@ -41626,7 +41634,7 @@ loci_validate_of_bsn_set_pktin_suppression_reply_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REPLY, LENGTH);
     }
 
 
@@ -41640,7 +41648,7 @@ static int
 loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, SHORT);
     }
 
     len = 32;
@@ -41648,7 +41656,7 @@ loci_validate_of_bsn_set_pktin_suppression_request_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST, LENGTH);
     }
 
 
@@ -41662,7 +41670,7 @@ static int
 loci_validate_of_bsn_set_switch_pipeline_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REPLY, SHORT);
     }
 
     len = 20;
@@ -41670,7 +41678,7 @@ loci_validate_of_bsn_set_switch_pipeline_reply_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REPLY, LENGTH);
     }
 
 
@@ -41684,7 +41692,7 @@ static int
 loci_validate_of_bsn_set_switch_pipeline_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REQUEST, SHORT);
     }
 
     len = 272;
@@ -41692,7 +41700,7 @@ loci_validate_of_bsn_set_switch_pipeline_request_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 272) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SET_SWITCH_PIPELINE_REQUEST, LENGTH);
     }
 
 
@@ -41706,7 +41714,7 @@ static int
 loci_validate_of_bsn_switch_pipeline_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 256) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_ENTRY, SHORT);
     }
 
     len = 256;
@@ -41722,14 +41730,14 @@ static int
 loci_validate_of_bsn_switch_pipeline_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -41750,7 +41758,7 @@ static int
 loci_validate_of_bsn_switch_pipeline_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -41758,7 +41766,7 @@ loci_validate_of_bsn_switch_pipeline_stats_request_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_SWITCH_PIPELINE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -41772,7 +41780,7 @@ static int
 loci_validate_of_bsn_table_checksum_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_ENTRY, SHORT);
     }
 
     len = 9;
@@ -41788,14 +41796,14 @@ static int
 loci_validate_of_bsn_table_checksum_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -41816,7 +41824,7 @@ static int
 loci_validate_of_bsn_table_checksum_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -41824,7 +41832,7 @@ loci_validate_of_bsn_table_checksum_stats_request_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_CHECKSUM_STATS_REQUEST, LENGTH);
     }
 
 
@@ -41838,7 +41846,7 @@ static int
 loci_validate_of_bsn_table_set_buckets_size_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_SET_BUCKETS_SIZE, SHORT);
     }
 
     len = 24;
@@ -41846,7 +41854,7 @@ loci_validate_of_bsn_table_set_buckets_size_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TABLE_SET_BUCKETS_SIZE, LENGTH);
     }
 
 
@@ -41860,7 +41868,7 @@ static int
 loci_validate_of_bsn_takeover_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TAKEOVER, SHORT);
     }
 
     len = 16;
@@ -41868,7 +41876,7 @@ loci_validate_of_bsn_takeover_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TAKEOVER, LENGTH);
     }
 
 
@@ -41882,7 +41890,7 @@ static int
 loci_validate_of_bsn_time_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REPLY, SHORT);
     }
 
     len = 24;
@@ -41890,7 +41898,7 @@ loci_validate_of_bsn_time_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REPLY, LENGTH);
     }
 
 
@@ -41904,7 +41912,7 @@ static int
 loci_validate_of_bsn_time_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REQUEST, SHORT);
     }
 
     len = 16;
@@ -41912,7 +41920,7 @@ loci_validate_of_bsn_time_request_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TIME_REQUEST, LENGTH);
     }
 
 
@@ -41926,14 +41934,14 @@ static int
 loci_validate_of_bsn_tlv_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV, LENGTH);
     }
 
     len = wire_len;
@@ -42241,7 +42249,7 @@ static int
 loci_validate_of_bsn_tlv_actor_key_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_KEY, SHORT);
     }
 
     len = 6;
@@ -42249,7 +42257,7 @@ loci_validate_of_bsn_tlv_actor_key_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_KEY, LENGTH);
     }
 
 
@@ -42263,7 +42271,7 @@ static int
 loci_validate_of_bsn_tlv_actor_port_num_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_NUM, SHORT);
     }
 
     len = 6;
@@ -42271,7 +42279,7 @@ loci_validate_of_bsn_tlv_actor_port_num_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_NUM, LENGTH);
     }
 
 
@@ -42285,7 +42293,7 @@ static int
 loci_validate_of_bsn_tlv_actor_port_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -42293,7 +42301,7 @@ loci_validate_of_bsn_tlv_actor_port_priority_OF_VERSION_1_4(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_PORT_PRIORITY, LENGTH);
     }
 
 
@@ -42307,7 +42315,7 @@ static int
 loci_validate_of_bsn_tlv_actor_state_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_STATE, SHORT);
     }
 
     len = 5;
@@ -42315,7 +42323,7 @@ loci_validate_of_bsn_tlv_actor_state_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_STATE, LENGTH);
     }
 
 
@@ -42329,7 +42337,7 @@ static int
 loci_validate_of_bsn_tlv_actor_system_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_MAC, SHORT);
     }
 
     len = 10;
@@ -42337,7 +42345,7 @@ loci_validate_of_bsn_tlv_actor_system_mac_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_MAC, LENGTH);
     }
 
 
@@ -42351,7 +42359,7 @@ static int
 loci_validate_of_bsn_tlv_actor_system_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -42359,7 +42367,7 @@ loci_validate_of_bsn_tlv_actor_system_priority_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ACTOR_SYSTEM_PRIORITY, LENGTH);
     }
 
 
@@ -42373,7 +42381,7 @@ static int
 loci_validate_of_bsn_tlv_anchor_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ANCHOR, SHORT);
     }
 
     len = 6;
@@ -42381,7 +42389,7 @@ loci_validate_of_bsn_tlv_anchor_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ANCHOR, LENGTH);
     }
 
 
@@ -42395,7 +42403,7 @@ static int
 loci_validate_of_bsn_tlv_apply_bytes_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_BYTES, SHORT);
     }
 
     len = 12;
@@ -42403,7 +42411,7 @@ loci_validate_of_bsn_tlv_apply_bytes_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_BYTES, LENGTH);
     }
 
 
@@ -42417,7 +42425,7 @@ static int
 loci_validate_of_bsn_tlv_apply_packets_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_PACKETS, SHORT);
     }
 
     len = 12;
@@ -42425,7 +42433,7 @@ loci_validate_of_bsn_tlv_apply_packets_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_APPLY_PACKETS, LENGTH);
     }
 
 
@@ -42439,7 +42447,7 @@ static int
 loci_validate_of_bsn_tlv_auto_negotiation_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_AUTO_NEGOTIATION, SHORT);
     }
 
     len = 5;
@@ -42447,7 +42455,7 @@ loci_validate_of_bsn_tlv_auto_negotiation_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_AUTO_NEGOTIATION, LENGTH);
     }
 
 
@@ -42461,7 +42469,7 @@ static int
 loci_validate_of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_QUERY_TIMEOUT, SHORT);
     }
 
     len = 8;
@@ -42469,7 +42477,7 @@ loci_validate_of_bsn_tlv_broadcast_query_timeout_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_QUERY_TIMEOUT, LENGTH);
     }
 
 
@@ -42483,7 +42491,7 @@ static int
 loci_validate_of_bsn_tlv_broadcast_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_RATE, SHORT);
     }
 
     len = 8;
@@ -42491,7 +42499,7 @@ loci_validate_of_bsn_tlv_broadcast_rate_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BROADCAST_RATE, LENGTH);
     }
 
 
@@ -42505,14 +42513,14 @@ static int
 loci_validate_of_bsn_tlv_bucket_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BUCKET, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_BUCKET, LENGTH);
     }
 
     len = wire_len;
@@ -42533,14 +42541,14 @@ static int
 loci_validate_of_bsn_tlv_circuit_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CIRCUIT_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CIRCUIT_ID, LENGTH);
     }
 
     len = wire_len;
@@ -42556,7 +42564,7 @@ static int
 loci_validate_of_bsn_tlv_convergence_status_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CONVERGENCE_STATUS, SHORT);
     }
 
     len = 5;
@@ -42564,7 +42572,7 @@ loci_validate_of_bsn_tlv_convergence_status_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CONVERGENCE_STATUS, LENGTH);
     }
 
 
@@ -42578,7 +42586,7 @@ static int
 loci_validate_of_bsn_tlv_cpu_lag_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CPU_LAG, SHORT);
     }
 
     len = 4;
@@ -42586,7 +42594,7 @@ loci_validate_of_bsn_tlv_cpu_lag_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CPU_LAG, LENGTH);
     }
 
 
@@ -42600,7 +42608,7 @@ static int
 loci_validate_of_bsn_tlv_crc_enabled_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CRC_ENABLED, SHORT);
     }
 
     len = 5;
@@ -42608,7 +42616,7 @@ loci_validate_of_bsn_tlv_crc_enabled_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_CRC_ENABLED, LENGTH);
     }
 
 
@@ -42622,14 +42630,14 @@ static int
 loci_validate_of_bsn_tlv_data_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA, LENGTH);
     }
 
     len = wire_len;
@@ -42645,14 +42653,14 @@ static int
 loci_validate_of_bsn_tlv_data_mask_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA_MASK, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DATA_MASK, LENGTH);
     }
 
     len = wire_len;
@@ -42668,7 +42676,7 @@ static int
 loci_validate_of_bsn_tlv_decap_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DECAP, SHORT);
     }
 
     len = 6;
@@ -42676,7 +42684,7 @@ loci_validate_of_bsn_tlv_decap_OF_VERSION_1_4(uint8_t *data, int len, int *out_l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DECAP, LENGTH);
     }
 
 
@@ -42690,7 +42698,7 @@ static int
 loci_validate_of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DISABLE_SRC_MAC_CHECK, SHORT);
     }
 
     len = 4;
@@ -42698,7 +42706,7 @@ loci_validate_of_bsn_tlv_disable_src_mac_check_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DISABLE_SRC_MAC_CHECK, LENGTH);
     }
 
 
@@ -42712,7 +42720,7 @@ static int
 loci_validate_of_bsn_tlv_drop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DROP, SHORT);
     }
 
     len = 4;
@@ -42720,7 +42728,7 @@ loci_validate_of_bsn_tlv_drop_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DROP, LENGTH);
     }
 
 
@@ -42734,7 +42742,7 @@ static int
 loci_validate_of_bsn_tlv_dscp_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DSCP, SHORT);
     }
 
     len = 6;
@@ -42742,7 +42750,7 @@ loci_validate_of_bsn_tlv_dscp_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_DSCP, LENGTH);
     }
 
 
@@ -42756,7 +42764,7 @@ static int
 loci_validate_of_bsn_tlv_ecn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ECN, SHORT);
     }
 
     len = 5;
@@ -42764,7 +42772,7 @@ loci_validate_of_bsn_tlv_ecn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ECN, LENGTH);
     }
 
 
@@ -42778,7 +42786,7 @@ static int
 loci_validate_of_bsn_tlv_egress_only_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_ONLY, SHORT);
     }
 
     len = 4;
@@ -42786,7 +42794,7 @@ loci_validate_of_bsn_tlv_egress_only_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_ONLY, LENGTH);
     }
 
 
@@ -42800,7 +42808,7 @@ static int
 loci_validate_of_bsn_tlv_egress_port_group_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -42808,7 +42816,7 @@ loci_validate_of_bsn_tlv_egress_port_group_id_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EGRESS_PORT_GROUP_ID, LENGTH);
     }
 
 
@@ -42822,7 +42830,7 @@ static int
 loci_validate_of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ENHANCED_HASH_CAPABILITY, SHORT);
     }
 
     len = 12;
@@ -42830,7 +42838,7 @@ loci_validate_of_bsn_tlv_enhanced_hash_capability_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ENHANCED_HASH_CAPABILITY, LENGTH);
     }
 
 
@@ -42844,7 +42852,7 @@ static int
 loci_validate_of_bsn_tlv_eth_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -42852,7 +42860,7 @@ loci_validate_of_bsn_tlv_eth_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_DST, LENGTH);
     }
 
 
@@ -42866,7 +42874,7 @@ static int
 loci_validate_of_bsn_tlv_eth_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -42874,7 +42882,7 @@ loci_validate_of_bsn_tlv_eth_src_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_SRC, LENGTH);
     }
 
 
@@ -42888,7 +42896,7 @@ static int
 loci_validate_of_bsn_tlv_eth_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -42896,7 +42904,7 @@ loci_validate_of_bsn_tlv_eth_type_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ETH_TYPE, LENGTH);
     }
 
 
@@ -42910,7 +42918,7 @@ static int
 loci_validate_of_bsn_tlv_external_gateway_ip_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_IP, SHORT);
     }
 
     len = 8;
@@ -42918,7 +42926,7 @@ loci_validate_of_bsn_tlv_external_gateway_ip_OF_VERSION_1_4(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_IP, LENGTH);
     }
 
 
@@ -42932,7 +42940,7 @@ static int
 loci_validate_of_bsn_tlv_external_gateway_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_MAC, SHORT);
     }
 
     len = 10;
@@ -42940,7 +42948,7 @@ loci_validate_of_bsn_tlv_external_gateway_mac_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_GATEWAY_MAC, LENGTH);
     }
 
 
@@ -42954,7 +42962,7 @@ static int
 loci_validate_of_bsn_tlv_external_ip_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_IP, SHORT);
     }
 
     len = 8;
@@ -42962,7 +42970,7 @@ loci_validate_of_bsn_tlv_external_ip_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_IP, LENGTH);
     }
 
 
@@ -42976,7 +42984,7 @@ static int
 loci_validate_of_bsn_tlv_external_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_MAC, SHORT);
     }
 
     len = 10;
@@ -42984,7 +42992,7 @@ loci_validate_of_bsn_tlv_external_mac_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_MAC, LENGTH);
     }
 
 
@@ -42998,7 +43006,7 @@ static int
 loci_validate_of_bsn_tlv_external_netmask_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_NETMASK, SHORT);
     }
 
     len = 8;
@@ -43006,7 +43014,7 @@ loci_validate_of_bsn_tlv_external_netmask_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_EXTERNAL_NETMASK, LENGTH);
     }
 
 
@@ -43020,7 +43028,7 @@ static int
 loci_validate_of_bsn_tlv_generation_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_GENERATION_ID, SHORT);
     }
 
     len = 12;
@@ -43028,7 +43036,7 @@ loci_validate_of_bsn_tlv_generation_id_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_GENERATION_ID, LENGTH);
     }
 
 
@@ -43042,7 +43050,7 @@ static int
 loci_validate_of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_HEADER_MATCH, SHORT);
     }
 
     len = 6;
@@ -43050,7 +43058,7 @@ loci_validate_of_bsn_tlv_hash_gtp_header_match_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_HEADER_MATCH, LENGTH);
     }
 
 
@@ -43064,7 +43072,7 @@ static int
 loci_validate_of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_PORT_MATCH, SHORT);
     }
 
     len = 9;
@@ -43072,7 +43080,7 @@ loci_validate_of_bsn_tlv_hash_gtp_port_match_OF_VERSION_1_4(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 9) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_GTP_PORT_MATCH, LENGTH);
     }
 
 
@@ -43086,7 +43094,7 @@ static int
 loci_validate_of_bsn_tlv_hash_packet_field_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_FIELD, SHORT);
     }
 
     len = 12;
@@ -43094,7 +43102,7 @@ loci_validate_of_bsn_tlv_hash_packet_field_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_FIELD, LENGTH);
     }
 
 
@@ -43108,7 +43116,7 @@ static int
 loci_validate_of_bsn_tlv_hash_packet_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_TYPE, SHORT);
     }
 
     len = 5;
@@ -43116,7 +43124,7 @@ loci_validate_of_bsn_tlv_hash_packet_type_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_PACKET_TYPE, LENGTH);
     }
 
 
@@ -43130,7 +43138,7 @@ static int
 loci_validate_of_bsn_tlv_hash_seed_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_SEED, SHORT);
     }
 
     len = 12;
@@ -43138,7 +43146,7 @@ loci_validate_of_bsn_tlv_hash_seed_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_SEED, LENGTH);
     }
 
 
@@ -43152,7 +43160,7 @@ static int
 loci_validate_of_bsn_tlv_hash_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_TYPE, SHORT);
     }
 
     len = 5;
@@ -43160,7 +43168,7 @@ loci_validate_of_bsn_tlv_hash_type_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HASH_TYPE, LENGTH);
     }
 
 
@@ -43174,7 +43182,7 @@ static int
 loci_validate_of_bsn_tlv_header_size_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HEADER_SIZE, SHORT);
     }
 
     len = 8;
@@ -43182,7 +43190,7 @@ loci_validate_of_bsn_tlv_header_size_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_HEADER_SIZE, LENGTH);
     }
 
 
@@ -43196,7 +43204,7 @@ static int
 loci_validate_of_bsn_tlv_icmp_code_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_CODE, SHORT);
     }
 
     len = 5;
@@ -43204,7 +43212,7 @@ loci_validate_of_bsn_tlv_icmp_code_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_CODE, LENGTH);
     }
 
 
@@ -43218,7 +43226,7 @@ static int
 loci_validate_of_bsn_tlv_icmp_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_ID, SHORT);
     }
 
     len = 6;
@@ -43226,7 +43234,7 @@ loci_validate_of_bsn_tlv_icmp_id_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_ID, LENGTH);
     }
 
 
@@ -43240,7 +43248,7 @@ static int
 loci_validate_of_bsn_tlv_icmp_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_TYPE, SHORT);
     }
 
     len = 5;
@@ -43248,7 +43256,7 @@ loci_validate_of_bsn_tlv_icmp_type_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMP_TYPE, LENGTH);
     }
 
 
@@ -43262,7 +43270,7 @@ static int
 loci_validate_of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMPV6_CHKSUM, SHORT);
     }
 
     len = 6;
@@ -43270,7 +43278,7 @@ loci_validate_of_bsn_tlv_icmpv6_chksum_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_ICMPV6_CHKSUM, LENGTH);
     }
 
 
@@ -43284,7 +43292,7 @@ static int
 loci_validate_of_bsn_tlv_idle_notification_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_NOTIFICATION, SHORT);
     }
 
     len = 4;
@@ -43292,7 +43300,7 @@ loci_validate_of_bsn_tlv_idle_notification_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_NOTIFICATION, LENGTH);
     }
 
 
@@ -43306,7 +43314,7 @@ static int
 loci_validate_of_bsn_tlv_idle_time_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIME, SHORT);
     }
 
     len = 12;
@@ -43314,7 +43322,7 @@ loci_validate_of_bsn_tlv_idle_time_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIME, LENGTH);
     }
 
 
@@ -43328,7 +43336,7 @@ static int
 loci_validate_of_bsn_tlv_idle_timeout_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIMEOUT, SHORT);
     }
 
     len = 8;
@@ -43336,7 +43344,7 @@ loci_validate_of_bsn_tlv_idle_timeout_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IDLE_TIMEOUT, LENGTH);
     }
 
 
@@ -43350,7 +43358,7 @@ static int
 loci_validate_of_bsn_tlv_igmp_snooping_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IGMP_SNOOPING, SHORT);
     }
 
     len = 4;
@@ -43358,7 +43366,7 @@ loci_validate_of_bsn_tlv_igmp_snooping_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IGMP_SNOOPING, LENGTH);
     }
 
 
@@ -43372,7 +43380,7 @@ static int
 loci_validate_of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INGRESS_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -43380,7 +43388,7 @@ loci_validate_of_bsn_tlv_ingress_port_group_id_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INGRESS_PORT_GROUP_ID, LENGTH);
     }
 
 
@@ -43394,7 +43402,7 @@ static int
 loci_validate_of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_GATEWAY_MAC, SHORT);
     }
 
     len = 10;
@@ -43402,7 +43410,7 @@ loci_validate_of_bsn_tlv_internal_gateway_mac_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_GATEWAY_MAC, LENGTH);
     }
 
 
@@ -43416,7 +43424,7 @@ static int
 loci_validate_of_bsn_tlv_internal_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_MAC, SHORT);
     }
 
     len = 10;
@@ -43424,7 +43432,7 @@ loci_validate_of_bsn_tlv_internal_mac_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERNAL_MAC, LENGTH);
     }
 
 
@@ -43438,7 +43446,7 @@ static int
 loci_validate_of_bsn_tlv_interval_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERVAL, SHORT);
     }
 
     len = 8;
@@ -43446,7 +43454,7 @@ loci_validate_of_bsn_tlv_interval_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_INTERVAL, LENGTH);
     }
 
 
@@ -43460,7 +43468,7 @@ static int
 loci_validate_of_bsn_tlv_ip_proto_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IP_PROTO, SHORT);
     }
 
     len = 5;
@@ -43468,7 +43476,7 @@ loci_validate_of_bsn_tlv_ip_proto_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IP_PROTO, LENGTH);
     }
 
 
@@ -43482,7 +43490,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4, SHORT);
     }
 
     len = 8;
@@ -43490,7 +43498,7 @@ loci_validate_of_bsn_tlv_ipv4_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4, LENGTH);
     }
 
 
@@ -43504,7 +43512,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -43512,7 +43520,7 @@ loci_validate_of_bsn_tlv_ipv4_dst_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_DST, LENGTH);
     }
 
 
@@ -43526,7 +43534,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_netmask_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_NETMASK, SHORT);
     }
 
     len = 8;
@@ -43534,7 +43542,7 @@ loci_validate_of_bsn_tlv_ipv4_netmask_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_NETMASK, LENGTH);
     }
 
 
@@ -43548,7 +43556,7 @@ static int
 loci_validate_of_bsn_tlv_ipv4_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -43556,7 +43564,7 @@ loci_validate_of_bsn_tlv_ipv4_src_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV4_SRC, LENGTH);
     }
 
 
@@ -43570,7 +43578,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6, SHORT);
     }
 
     len = 20;
@@ -43578,7 +43586,7 @@ loci_validate_of_bsn_tlv_ipv6_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6, LENGTH);
     }
 
 
@@ -43592,7 +43600,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_DST, SHORT);
     }
 
     len = 20;
@@ -43600,7 +43608,7 @@ loci_validate_of_bsn_tlv_ipv6_dst_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_DST, LENGTH);
     }
 
 
@@ -43614,7 +43622,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_prefix_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_PREFIX, SHORT);
     }
 
     len = 21;
@@ -43622,7 +43630,7 @@ loci_validate_of_bsn_tlv_ipv6_prefix_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 21) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_PREFIX, LENGTH);
     }
 
 
@@ -43636,7 +43644,7 @@ static int
 loci_validate_of_bsn_tlv_ipv6_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_SRC, SHORT);
     }
 
     len = 20;
@@ -43644,7 +43652,7 @@ loci_validate_of_bsn_tlv_ipv6_src_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_IPV6_SRC, LENGTH);
     }
 
 
@@ -43658,7 +43666,7 @@ static int
 loci_validate_of_bsn_tlv_known_multicast_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_KNOWN_MULTICAST_RATE, SHORT);
     }
 
     len = 8;
@@ -43666,7 +43674,7 @@ loci_validate_of_bsn_tlv_known_multicast_rate_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_KNOWN_MULTICAST_RATE, LENGTH);
     }
 
 
@@ -43680,7 +43688,7 @@ static int
 loci_validate_of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L2_MULTICAST_LOOKUP, SHORT);
     }
 
     len = 4;
@@ -43688,7 +43696,7 @@ loci_validate_of_bsn_tlv_l2_multicast_lookup_OF_VERSION_1_4(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L2_MULTICAST_LOOKUP, LENGTH);
     }
 
 
@@ -43702,7 +43710,7 @@ static int
 loci_validate_of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_DST_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -43710,7 +43718,7 @@ loci_validate_of_bsn_tlv_l3_dst_class_id_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_DST_CLASS_ID, LENGTH);
     }
 
 
@@ -43724,7 +43732,7 @@ static int
 loci_validate_of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_INTERFACE_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -43732,7 +43740,7 @@ loci_validate_of_bsn_tlv_l3_interface_class_id_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_INTERFACE_CLASS_ID, LENGTH);
     }
 
 
@@ -43746,7 +43754,7 @@ static int
 loci_validate_of_bsn_tlv_l3_src_class_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_SRC_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -43754,7 +43762,7 @@ loci_validate_of_bsn_tlv_l3_src_class_id_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_L3_SRC_CLASS_ID, LENGTH);
     }
 
 
@@ -43768,7 +43776,7 @@ static int
 loci_validate_of_bsn_tlv_loopback_port_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_LOOPBACK_PORT, SHORT);
     }
 
     len = 8;
@@ -43776,7 +43784,7 @@ loci_validate_of_bsn_tlv_loopback_port_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_LOOPBACK_PORT, LENGTH);
     }
 
 
@@ -43790,7 +43798,7 @@ static int
 loci_validate_of_bsn_tlv_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC, SHORT);
     }
 
     len = 10;
@@ -43798,7 +43806,7 @@ loci_validate_of_bsn_tlv_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC, LENGTH);
     }
 
 
@@ -43812,7 +43820,7 @@ static int
 loci_validate_of_bsn_tlv_mac_mask_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC_MASK, SHORT);
     }
 
     len = 10;
@@ -43820,7 +43828,7 @@ loci_validate_of_bsn_tlv_mac_mask_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MAC_MASK, LENGTH);
     }
 
 
@@ -43834,7 +43842,7 @@ static int
 loci_validate_of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MCG_TYPE_VXLAN, SHORT);
     }
 
     len = 4;
@@ -43842,7 +43850,7 @@ loci_validate_of_bsn_tlv_mcg_type_vxlan_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MCG_TYPE_VXLAN, LENGTH);
     }
 
 
@@ -43856,7 +43864,7 @@ static int
 loci_validate_of_bsn_tlv_miss_packets_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MISS_PACKETS, SHORT);
     }
 
     len = 12;
@@ -43864,7 +43872,7 @@ loci_validate_of_bsn_tlv_miss_packets_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MISS_PACKETS, LENGTH);
     }
 
 
@@ -43878,7 +43886,7 @@ static int
 loci_validate_of_bsn_tlv_mpls_control_word_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_CONTROL_WORD, SHORT);
     }
 
     len = 5;
@@ -43886,7 +43894,7 @@ loci_validate_of_bsn_tlv_mpls_control_word_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_CONTROL_WORD, LENGTH);
     }
 
 
@@ -43900,7 +43908,7 @@ static int
 loci_validate_of_bsn_tlv_mpls_label_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_LABEL, SHORT);
     }
 
     len = 8;
@@ -43908,7 +43916,7 @@ loci_validate_of_bsn_tlv_mpls_label_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_LABEL, LENGTH);
     }
 
 
@@ -43922,7 +43930,7 @@ static int
 loci_validate_of_bsn_tlv_mpls_sequenced_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_SEQUENCED, SHORT);
     }
 
     len = 5;
@@ -43930,7 +43938,7 @@ loci_validate_of_bsn_tlv_mpls_sequenced_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MPLS_SEQUENCED, LENGTH);
     }
 
 
@@ -43944,7 +43952,7 @@ static int
 loci_validate_of_bsn_tlv_multicast_interface_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MULTICAST_INTERFACE_ID, SHORT);
     }
 
     len = 8;
@@ -43952,7 +43960,7 @@ loci_validate_of_bsn_tlv_multicast_interface_id_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_MULTICAST_INTERFACE_ID, LENGTH);
     }
 
 
@@ -43966,14 +43974,14 @@ static int
 loci_validate_of_bsn_tlv_name_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NAME, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NAME, LENGTH);
     }
 
     len = wire_len;
@@ -43989,7 +43997,7 @@ static int
 loci_validate_of_bsn_tlv_ndp_offload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_OFFLOAD, SHORT);
     }
 
     len = 4;
@@ -43997,7 +44005,7 @@ loci_validate_of_bsn_tlv_ndp_offload_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_OFFLOAD, LENGTH);
     }
 
 
@@ -44011,7 +44019,7 @@ static int
 loci_validate_of_bsn_tlv_ndp_static_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_STATIC, SHORT);
     }
 
     len = 4;
@@ -44019,7 +44027,7 @@ loci_validate_of_bsn_tlv_ndp_static_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NDP_STATIC, LENGTH);
     }
 
 
@@ -44033,7 +44041,7 @@ static int
 loci_validate_of_bsn_tlv_negate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEGATE, SHORT);
     }
 
     len = 4;
@@ -44041,7 +44049,7 @@ loci_validate_of_bsn_tlv_negate_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEGATE, LENGTH);
     }
 
 
@@ -44055,7 +44063,7 @@ static int
 loci_validate_of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_IPV4, SHORT);
     }
 
     len = 8;
@@ -44063,7 +44071,7 @@ loci_validate_of_bsn_tlv_next_hop_ipv4_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_IPV4, LENGTH);
     }
 
 
@@ -44077,7 +44085,7 @@ static int
 loci_validate_of_bsn_tlv_next_hop_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_MAC, SHORT);
     }
 
     len = 10;
@@ -44085,7 +44093,7 @@ loci_validate_of_bsn_tlv_next_hop_mac_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXT_HOP_MAC, LENGTH);
     }
 
 
@@ -44099,7 +44107,7 @@ static int
 loci_validate_of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXTHOP_TYPE_VXLAN, SHORT);
     }
 
     len = 4;
@@ -44107,7 +44115,7 @@ loci_validate_of_bsn_tlv_nexthop_type_vxlan_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_NEXTHOP_TYPE_VXLAN, LENGTH);
     }
 
 
@@ -44121,7 +44129,7 @@ static int
 loci_validate_of_bsn_tlv_offset_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_OFFSET, SHORT);
     }
 
     len = 6;
@@ -44129,7 +44137,7 @@ loci_validate_of_bsn_tlv_offset_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_OFFSET, LENGTH);
     }
 
 
@@ -44143,7 +44151,7 @@ static int
 loci_validate_of_bsn_tlv_parent_port_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARENT_PORT, SHORT);
     }
 
     len = 8;
@@ -44151,7 +44159,7 @@ loci_validate_of_bsn_tlv_parent_port_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARENT_PORT, LENGTH);
     }
 
 
@@ -44165,7 +44173,7 @@ static int
 loci_validate_of_bsn_tlv_partner_key_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_KEY, SHORT);
     }
 
     len = 6;
@@ -44173,7 +44181,7 @@ loci_validate_of_bsn_tlv_partner_key_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_KEY, LENGTH);
     }
 
 
@@ -44187,7 +44195,7 @@ static int
 loci_validate_of_bsn_tlv_partner_port_num_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_NUM, SHORT);
     }
 
     len = 6;
@@ -44195,7 +44203,7 @@ loci_validate_of_bsn_tlv_partner_port_num_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_NUM, LENGTH);
     }
 
 
@@ -44209,7 +44217,7 @@ static int
 loci_validate_of_bsn_tlv_partner_port_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -44217,7 +44225,7 @@ loci_validate_of_bsn_tlv_partner_port_priority_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_PORT_PRIORITY, LENGTH);
     }
 
 
@@ -44231,7 +44239,7 @@ static int
 loci_validate_of_bsn_tlv_partner_state_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_STATE, SHORT);
     }
 
     len = 5;
@@ -44239,7 +44247,7 @@ loci_validate_of_bsn_tlv_partner_state_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_STATE, LENGTH);
     }
 
 
@@ -44253,7 +44261,7 @@ static int
 loci_validate_of_bsn_tlv_partner_system_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_MAC, SHORT);
     }
 
     len = 10;
@@ -44261,7 +44269,7 @@ loci_validate_of_bsn_tlv_partner_system_mac_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_MAC, LENGTH);
     }
 
 
@@ -44275,7 +44283,7 @@ static int
 loci_validate_of_bsn_tlv_partner_system_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_PRIORITY, SHORT);
     }
 
     len = 6;
@@ -44283,7 +44291,7 @@ loci_validate_of_bsn_tlv_partner_system_priority_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PARTNER_SYSTEM_PRIORITY, LENGTH);
     }
 
 
@@ -44297,7 +44305,7 @@ static int
 loci_validate_of_bsn_tlv_port_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT, SHORT);
     }
 
     len = 8;
@@ -44305,7 +44313,7 @@ loci_validate_of_bsn_tlv_port_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT, LENGTH);
     }
 
 
@@ -44319,7 +44327,7 @@ static int
 loci_validate_of_bsn_tlv_port_usage_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_USAGE, SHORT);
     }
 
     len = 6;
@@ -44327,7 +44335,7 @@ loci_validate_of_bsn_tlv_port_usage_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_USAGE, LENGTH);
     }
 
 
@@ -44341,7 +44349,7 @@ static int
 loci_validate_of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_VXLAN_MODE, SHORT);
     }
 
     len = 5;
@@ -44349,7 +44357,7 @@ loci_validate_of_bsn_tlv_port_vxlan_mode_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PORT_VXLAN_MODE, LENGTH);
     }
 
 
@@ -44363,7 +44371,7 @@ static int
 loci_validate_of_bsn_tlv_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PRIORITY, SHORT);
     }
 
     len = 8;
@@ -44371,7 +44379,7 @@ loci_validate_of_bsn_tlv_priority_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PRIORITY, LENGTH);
     }
 
 
@@ -44385,7 +44393,7 @@ static int
 loci_validate_of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PUSH_VLAN_ON_INGRESS, SHORT);
     }
 
     len = 4;
@@ -44393,7 +44401,7 @@ loci_validate_of_bsn_tlv_push_vlan_on_ingress_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_PUSH_VLAN_ON_INGRESS, LENGTH);
     }
 
 
@@ -44407,7 +44415,7 @@ static int
 loci_validate_of_bsn_tlv_qos_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QOS_PRIORITY, SHORT);
     }
 
     len = 8;
@@ -44415,7 +44423,7 @@ loci_validate_of_bsn_tlv_qos_priority_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QOS_PRIORITY, LENGTH);
     }
 
 
@@ -44429,7 +44437,7 @@ static int
 loci_validate_of_bsn_tlv_queue_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_ID, SHORT);
     }
 
     len = 8;
@@ -44437,7 +44445,7 @@ loci_validate_of_bsn_tlv_queue_id_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_ID, LENGTH);
     }
 
 
@@ -44451,7 +44459,7 @@ static int
 loci_validate_of_bsn_tlv_queue_weight_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_WEIGHT, SHORT);
     }
 
     len = 8;
@@ -44459,7 +44467,7 @@ loci_validate_of_bsn_tlv_queue_weight_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_QUEUE_WEIGHT, LENGTH);
     }
 
 
@@ -44473,7 +44481,7 @@ static int
 loci_validate_of_bsn_tlv_rate_limit_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_LIMIT, SHORT);
     }
 
     len = 8;
@@ -44481,7 +44489,7 @@ loci_validate_of_bsn_tlv_rate_limit_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_LIMIT, LENGTH);
     }
 
 
@@ -44495,7 +44503,7 @@ static int
 loci_validate_of_bsn_tlv_rate_unit_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_UNIT, SHORT);
     }
 
     len = 5;
@@ -44503,7 +44511,7 @@ loci_validate_of_bsn_tlv_rate_unit_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RATE_UNIT, LENGTH);
     }
 
 
@@ -44517,14 +44525,14 @@ static int
 loci_validate_of_bsn_tlv_reference_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REFERENCE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REFERENCE, LENGTH);
     }
 
     len = wire_len;
@@ -44545,7 +44553,7 @@ static int
 loci_validate_of_bsn_tlv_reply_packets_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REPLY_PACKETS, SHORT);
     }
 
     len = 12;
@@ -44553,7 +44561,7 @@ loci_validate_of_bsn_tlv_reply_packets_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REPLY_PACKETS, LENGTH);
     }
 
 
@@ -44567,7 +44575,7 @@ static int
 loci_validate_of_bsn_tlv_request_packets_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REQUEST_PACKETS, SHORT);
     }
 
     len = 12;
@@ -44575,7 +44583,7 @@ loci_validate_of_bsn_tlv_request_packets_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_REQUEST_PACKETS, LENGTH);
     }
 
 
@@ -44589,7 +44597,7 @@ static int
 loci_validate_of_bsn_tlv_rx_bytes_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_BYTES, SHORT);
     }
 
     len = 12;
@@ -44597,7 +44605,7 @@ loci_validate_of_bsn_tlv_rx_bytes_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_BYTES, LENGTH);
     }
 
 
@@ -44611,7 +44619,7 @@ static int
 loci_validate_of_bsn_tlv_rx_packets_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_PACKETS, SHORT);
     }
 
     len = 12;
@@ -44619,7 +44627,7 @@ loci_validate_of_bsn_tlv_rx_packets_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_RX_PACKETS, LENGTH);
     }
 
 
@@ -44633,7 +44641,7 @@ static int
 loci_validate_of_bsn_tlv_sampling_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SAMPLING_RATE, SHORT);
     }
 
     len = 8;
@@ -44641,7 +44649,7 @@ loci_validate_of_bsn_tlv_sampling_rate_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SAMPLING_RATE, LENGTH);
     }
 
 
@@ -44655,7 +44663,7 @@ static int
 loci_validate_of_bsn_tlv_set_loopback_mode_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SET_LOOPBACK_MODE, SHORT);
     }
 
     len = 4;
@@ -44663,7 +44671,7 @@ loci_validate_of_bsn_tlv_set_loopback_mode_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SET_LOOPBACK_MODE, LENGTH);
     }
 
 
@@ -44677,7 +44685,7 @@ static int
 loci_validate_of_bsn_tlv_status_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STATUS, SHORT);
     }
 
     len = 5;
@@ -44685,7 +44693,7 @@ loci_validate_of_bsn_tlv_status_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STATUS, LENGTH);
     }
 
 
@@ -44699,7 +44707,7 @@ static int
 loci_validate_of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L2_ON_INGRESS, SHORT);
     }
 
     len = 4;
@@ -44707,7 +44715,7 @@ loci_validate_of_bsn_tlv_strip_mpls_l2_on_ingress_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L2_ON_INGRESS, LENGTH);
     }
 
 
@@ -44721,7 +44729,7 @@ static int
 loci_validate_of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L3_ON_INGRESS, SHORT);
     }
 
     len = 4;
@@ -44729,7 +44737,7 @@ loci_validate_of_bsn_tlv_strip_mpls_l3_on_ingress_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_MPLS_L3_ON_INGRESS, LENGTH);
     }
 
 
@@ -44743,7 +44751,7 @@ static int
 loci_validate_of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_VLAN_ON_EGRESS, SHORT);
     }
 
     len = 4;
@@ -44751,7 +44759,7 @@ loci_validate_of_bsn_tlv_strip_vlan_on_egress_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_STRIP_VLAN_ON_EGRESS, LENGTH);
     }
 
 
@@ -44765,7 +44773,7 @@ static int
 loci_validate_of_bsn_tlv_sub_agent_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SUB_AGENT_ID, SHORT);
     }
 
     len = 8;
@@ -44773,7 +44781,7 @@ loci_validate_of_bsn_tlv_sub_agent_id_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_SUB_AGENT_ID, LENGTH);
     }
 
 
@@ -44787,7 +44795,7 @@ static int
 loci_validate_of_bsn_tlv_tcp_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_DST, SHORT);
     }
 
     len = 6;
@@ -44795,7 +44803,7 @@ loci_validate_of_bsn_tlv_tcp_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_DST, LENGTH);
     }
 
 
@@ -44809,7 +44817,7 @@ static int
 loci_validate_of_bsn_tlv_tcp_flags_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_FLAGS, SHORT);
     }
 
     len = 6;
@@ -44817,7 +44825,7 @@ loci_validate_of_bsn_tlv_tcp_flags_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_FLAGS, LENGTH);
     }
 
 
@@ -44831,7 +44839,7 @@ static int
 loci_validate_of_bsn_tlv_tcp_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_SRC, SHORT);
     }
 
     len = 6;
@@ -44839,7 +44847,7 @@ loci_validate_of_bsn_tlv_tcp_src_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TCP_SRC, LENGTH);
     }
 
 
@@ -44853,7 +44861,7 @@ static int
 loci_validate_of_bsn_tlv_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TTL, SHORT);
     }
 
     len = 6;
@@ -44861,7 +44869,7 @@ loci_validate_of_bsn_tlv_ttl_OF_VERSION_1_4(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TTL, LENGTH);
     }
 
 
@@ -44875,7 +44883,7 @@ static int
 loci_validate_of_bsn_tlv_tunnel_capability_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TUNNEL_CAPABILITY, SHORT);
     }
 
     len = 12;
@@ -44883,7 +44891,7 @@ loci_validate_of_bsn_tlv_tunnel_capability_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TUNNEL_CAPABILITY, LENGTH);
     }
 
 
@@ -44897,7 +44905,7 @@ static int
 loci_validate_of_bsn_tlv_tx_bytes_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_BYTES, SHORT);
     }
 
     len = 12;
@@ -44905,7 +44913,7 @@ loci_validate_of_bsn_tlv_tx_bytes_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_BYTES, LENGTH);
     }
 
 
@@ -44919,7 +44927,7 @@ static int
 loci_validate_of_bsn_tlv_tx_packets_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_PACKETS, SHORT);
     }
 
     len = 12;
@@ -44927,7 +44935,7 @@ loci_validate_of_bsn_tlv_tx_packets_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_TX_PACKETS, LENGTH);
     }
 
 
@@ -44941,7 +44949,7 @@ static int
 loci_validate_of_bsn_tlv_udf_anchor_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ANCHOR, SHORT);
     }
 
     len = 6;
@@ -44949,7 +44957,7 @@ loci_validate_of_bsn_tlv_udf_anchor_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ANCHOR, LENGTH);
     }
 
 
@@ -44963,7 +44971,7 @@ static int
 loci_validate_of_bsn_tlv_udf_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ID, SHORT);
     }
 
     len = 6;
@@ -44971,7 +44979,7 @@ loci_validate_of_bsn_tlv_udf_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_ID, LENGTH);
     }
 
 
@@ -44985,7 +44993,7 @@ static int
 loci_validate_of_bsn_tlv_udf_length_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_LENGTH, SHORT);
     }
 
     len = 6;
@@ -44993,7 +45001,7 @@ loci_validate_of_bsn_tlv_udf_length_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_LENGTH, LENGTH);
     }
 
 
@@ -45007,7 +45015,7 @@ static int
 loci_validate_of_bsn_tlv_udf_offset_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_OFFSET, SHORT);
     }
 
     len = 6;
@@ -45015,7 +45023,7 @@ loci_validate_of_bsn_tlv_udf_offset_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDF_OFFSET, LENGTH);
     }
 
 
@@ -45029,7 +45037,7 @@ static int
 loci_validate_of_bsn_tlv_udp_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_DST, SHORT);
     }
 
     len = 6;
@@ -45037,7 +45045,7 @@ loci_validate_of_bsn_tlv_udp_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_DST, LENGTH);
     }
 
 
@@ -45051,7 +45059,7 @@ static int
 loci_validate_of_bsn_tlv_udp_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_SRC, SHORT);
     }
 
     len = 6;
@@ -45059,7 +45067,7 @@ loci_validate_of_bsn_tlv_udp_src_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UDP_SRC, LENGTH);
     }
 
 
@@ -45073,14 +45081,14 @@ static int
 loci_validate_of_bsn_tlv_uint64_list_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UINT64_LIST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UINT64_LIST, LENGTH);
     }
 
     len = wire_len;
@@ -45101,7 +45109,7 @@ static int
 loci_validate_of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_QUERY_TIMEOUT, SHORT);
     }
 
     len = 8;
@@ -45109,7 +45117,7 @@ loci_validate_of_bsn_tlv_unicast_query_timeout_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_QUERY_TIMEOUT, LENGTH);
     }
 
 
@@ -45123,7 +45131,7 @@ static int
 loci_validate_of_bsn_tlv_unicast_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_RATE, SHORT);
     }
 
     len = 8;
@@ -45131,7 +45139,7 @@ loci_validate_of_bsn_tlv_unicast_rate_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNICAST_RATE, LENGTH);
     }
 
 
@@ -45145,7 +45153,7 @@ static int
 loci_validate_of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNKNOWN_MULTICAST_RATE, SHORT);
     }
 
     len = 8;
@@ -45153,7 +45161,7 @@ loci_validate_of_bsn_tlv_unknown_multicast_rate_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNKNOWN_MULTICAST_RATE, LENGTH);
     }
 
 
@@ -45167,7 +45175,7 @@ static int
 loci_validate_of_bsn_tlv_untagged_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNTAGGED, SHORT);
     }
 
     len = 4;
@@ -45175,7 +45183,7 @@ loci_validate_of_bsn_tlv_untagged_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_UNTAGGED, LENGTH);
     }
 
 
@@ -45189,7 +45197,7 @@ static int
 loci_validate_of_bsn_tlv_use_packet_state_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_USE_PACKET_STATE, SHORT);
     }
 
     len = 5;
@@ -45197,7 +45205,7 @@ loci_validate_of_bsn_tlv_use_packet_state_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_USE_PACKET_STATE, LENGTH);
     }
 
 
@@ -45211,7 +45219,7 @@ static int
 loci_validate_of_bsn_tlv_vfi_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFI, SHORT);
     }
 
     len = 6;
@@ -45219,7 +45227,7 @@ loci_validate_of_bsn_tlv_vfi_OF_VERSION_1_4(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFI, LENGTH);
     }
 
 
@@ -45233,7 +45241,7 @@ static int
 loci_validate_of_bsn_tlv_vfp_class_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFP_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -45241,7 +45249,7 @@ loci_validate_of_bsn_tlv_vfp_class_id_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VFP_CLASS_ID, LENGTH);
     }
 
 
@@ -45255,14 +45263,14 @@ static int
 loci_validate_of_bsn_tlv_vlan_mac_list_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_MAC_LIST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_MAC_LIST, LENGTH);
     }
 
     len = wire_len;
@@ -45283,7 +45291,7 @@ static int
 loci_validate_of_bsn_tlv_vlan_pcp_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_PCP, SHORT);
     }
 
     len = 5;
@@ -45291,7 +45299,7 @@ loci_validate_of_bsn_tlv_vlan_pcp_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_PCP, LENGTH);
     }
 
 
@@ -45305,7 +45313,7 @@ static int
 loci_validate_of_bsn_tlv_vlan_vid_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID, SHORT);
     }
 
     len = 6;
@@ -45313,7 +45321,7 @@ loci_validate_of_bsn_tlv_vlan_vid_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID, LENGTH);
     }
 
 
@@ -45327,7 +45335,7 @@ static int
 loci_validate_of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID_MASK, SHORT);
     }
 
     len = 6;
@@ -45335,7 +45343,7 @@ loci_validate_of_bsn_tlv_vlan_vid_mask_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VLAN_VID_MASK, LENGTH);
     }
 
 
@@ -45349,7 +45357,7 @@ static int
 loci_validate_of_bsn_tlv_vni_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VNI, SHORT);
     }
 
     len = 8;
@@ -45357,7 +45365,7 @@ loci_validate_of_bsn_tlv_vni_OF_VERSION_1_4(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VNI, LENGTH);
     }
 
 
@@ -45371,7 +45379,7 @@ static int
 loci_validate_of_bsn_tlv_vpn_key_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VPN_KEY, SHORT);
     }
 
     len = 8;
@@ -45379,7 +45387,7 @@ loci_validate_of_bsn_tlv_vpn_key_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VPN_KEY, LENGTH);
     }
 
 
@@ -45393,7 +45401,7 @@ static int
 loci_validate_of_bsn_tlv_vrf_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VRF, SHORT);
     }
 
     len = 8;
@@ -45401,7 +45409,7 @@ loci_validate_of_bsn_tlv_vrf_OF_VERSION_1_4(uint8_t *data, int len, int *out_len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VRF, LENGTH);
     }
 
 
@@ -45415,7 +45423,7 @@ static int
 loci_validate_of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VXLAN_EGRESS_LAG, SHORT);
     }
 
     len = 4;
@@ -45423,7 +45431,7 @@ loci_validate_of_bsn_tlv_vxlan_egress_lag_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_TLV_VXLAN_EGRESS_LAG, LENGTH);
     }
 
 
@@ -45437,7 +45445,7 @@ static int
 loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, SHORT);
     }
 
     len = 24;
@@ -45445,7 +45453,7 @@ loci_validate_of_bsn_virtual_port_create_reply_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REPLY, LENGTH);
     }
 
 
@@ -45459,14 +45467,14 @@ static int
 loci_validate_of_bsn_vport_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT, LENGTH);
     }
 
     len = wire_len;
@@ -45490,14 +45498,14 @@ static int
 loci_validate_of_bsn_virtual_port_create_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_CREATE_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -45514,7 +45522,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, SHORT);
     }
 
     len = 20;
@@ -45522,7 +45530,7 @@ loci_validate_of_bsn_virtual_port_remove_reply_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REPLY, LENGTH);
     }
 
 
@@ -45536,7 +45544,7 @@ static int
 loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, SHORT);
     }
 
     len = 20;
@@ -45544,7 +45552,7 @@ loci_validate_of_bsn_virtual_port_remove_request_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST, LENGTH);
     }
 
 
@@ -45558,7 +45566,7 @@ static int
 loci_validate_of_bsn_vlan_counter_clear_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_CLEAR, SHORT);
     }
 
     len = 18;
@@ -45566,7 +45574,7 @@ loci_validate_of_bsn_vlan_counter_clear_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 18) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_CLEAR, LENGTH);
     }
 
 
@@ -45580,14 +45588,14 @@ static int
 loci_validate_of_bsn_vlan_counter_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -45608,14 +45616,14 @@ static int
 loci_validate_of_bsn_vlan_counter_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -45636,7 +45644,7 @@ static int
 loci_validate_of_bsn_vlan_counter_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 26;
@@ -45644,7 +45652,7 @@ loci_validate_of_bsn_vlan_counter_stats_request_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 26) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -45658,7 +45666,7 @@ static int
 loci_validate_of_bsn_vlan_mac_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VLAN_MAC, SHORT);
     }
 
     len = 8;
@@ -45674,7 +45682,7 @@ static int
 loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, SHORT);
     }
 
     len = 64;
@@ -45682,7 +45690,7 @@ loci_validate_of_bsn_vport_l2gre_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_L2GRE, LENGTH);
     }
 
 
@@ -45696,7 +45704,7 @@ static int
 loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, SHORT);
     }
 
     len = 32;
@@ -45704,7 +45712,7 @@ loci_validate_of_bsn_vport_q_in_q_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VPORT_Q_IN_Q, LENGTH);
     }
 
 
@@ -45718,14 +45726,14 @@ static int
 loci_validate_of_bsn_vrf_counter_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -45746,14 +45754,14 @@ static int
 loci_validate_of_bsn_vrf_counter_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -45774,7 +45782,7 @@ static int
 loci_validate_of_bsn_vrf_counter_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REQUEST, SHORT);
     }
 
     len = 28;
@@ -45782,7 +45790,7 @@ loci_validate_of_bsn_vrf_counter_stats_request_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_BSN_VRF_COUNTER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -45796,14 +45804,14 @@ static int
 loci_validate_of_bucket_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET, LENGTH);
     }
 
     len = wire_len;
@@ -45824,7 +45832,7 @@ static int
 loci_validate_of_bucket_counter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUCKET_COUNTER, SHORT);
     }
 
     len = 16;
@@ -45840,14 +45848,14 @@ static int
 loci_validate_of_bundle_add_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_ADD_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_ADD_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -45863,14 +45871,14 @@ static int
 loci_validate_of_bundle_ctrl_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_CTRL_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_CTRL_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -45891,14 +45899,14 @@ static int
 loci_validate_of_bundle_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -45914,14 +45922,14 @@ static int
 loci_validate_of_bundle_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -45943,14 +45951,14 @@ static int
 loci_validate_of_bundle_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_BUNDLE_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -45970,7 +45978,7 @@ static int
 loci_validate_of_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, SHORT);
     }
 
     len = 1072;
@@ -45978,7 +45986,7 @@ loci_validate_of_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 1072) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REPLY, LENGTH);
     }
 
 
@@ -45992,7 +46000,7 @@ static int
 loci_validate_of_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -46000,7 +46008,7 @@ loci_validate_of_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -46014,14 +46022,14 @@ static int
 loci_validate_of_echo_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -46037,14 +46045,14 @@ static int
 loci_validate_of_echo_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_ECHO_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -46060,7 +46068,7 @@ static int
 loci_validate_of_features_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, SHORT);
     }
 
     len = 32;
@@ -46068,7 +46076,7 @@ loci_validate_of_features_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REPLY, LENGTH);
     }
 
 
@@ -46082,7 +46090,7 @@ static int
 loci_validate_of_features_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, SHORT);
     }
 
     len = 8;
@@ -46090,7 +46098,7 @@ loci_validate_of_features_request_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_FEATURES_REQUEST, LENGTH);
     }
 
 
@@ -46104,14 +46112,14 @@ static int
 loci_validate_of_flow_mod_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -46143,14 +46151,14 @@ static int
 loci_validate_of_flow_add_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -46168,14 +46176,14 @@ static int
 loci_validate_of_flow_delete_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -46193,14 +46201,14 @@ static int
 loci_validate_of_flow_delete_strict_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_DELETE_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -46218,14 +46226,14 @@ static int
 loci_validate_of_flow_mod_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -46241,14 +46249,14 @@ static int
 loci_validate_of_flow_modify_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -46266,14 +46274,14 @@ static int
 loci_validate_of_flow_modify_strict_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MODIFY_STRICT, LENGTH);
     }
 
     len = wire_len;
@@ -46291,14 +46299,14 @@ static int
 loci_validate_of_flow_monitor_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MONITOR_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_MONITOR_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -46314,14 +46322,14 @@ static int
 loci_validate_of_flow_removed_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_REMOVED, LENGTH);
     }
 
     len = wire_len;
@@ -46338,14 +46346,14 @@ static int
 loci_validate_of_flow_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -46363,14 +46371,14 @@ static int
 loci_validate_of_flow_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -46391,14 +46399,14 @@ static int
 loci_validate_of_flow_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_FLOW_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -46415,7 +46423,7 @@ static int
 loci_validate_of_get_config_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, SHORT);
     }
 
     len = 12;
@@ -46423,7 +46431,7 @@ loci_validate_of_get_config_reply_OF_VERSION_1_4(uint8_t *data, int len, int *ou
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REPLY, LENGTH);
     }
 
 
@@ -46437,7 +46445,7 @@ static int
 loci_validate_of_get_config_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, SHORT);
     }
 
     len = 8;
@@ -46445,7 +46453,7 @@ loci_validate_of_get_config_request_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GET_CONFIG_REQUEST, LENGTH);
     }
 
 
@@ -46459,14 +46467,14 @@ static int
 loci_validate_of_group_mod_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -46497,14 +46505,14 @@ static int
 loci_validate_of_group_add_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_ADD, LENGTH);
     }
 
     len = wire_len;
@@ -46525,14 +46533,14 @@ static int
 loci_validate_of_group_delete_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DELETE, LENGTH);
     }
 
     len = wire_len;
@@ -46553,14 +46561,14 @@ static int
 loci_validate_of_group_desc_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -46581,14 +46589,14 @@ static int
 loci_validate_of_group_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -46609,7 +46617,7 @@ static int
 loci_validate_of_group_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -46617,7 +46625,7 @@ loci_validate_of_group_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -46631,7 +46639,7 @@ static int
 loci_validate_of_group_features_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REPLY, SHORT);
     }
 
     len = 56;
@@ -46639,7 +46647,7 @@ loci_validate_of_group_features_stats_reply_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REPLY, LENGTH);
     }
 
 
@@ -46653,7 +46661,7 @@ static int
 loci_validate_of_group_features_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -46661,7 +46669,7 @@ loci_validate_of_group_features_stats_request_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_FEATURES_STATS_REQUEST, LENGTH);
     }
 
 
@@ -46675,14 +46683,14 @@ static int
 loci_validate_of_group_mod_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -46698,14 +46706,14 @@ static int
 loci_validate_of_group_modify_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_MODIFY, LENGTH);
     }
 
     len = wire_len;
@@ -46726,14 +46734,14 @@ static int
 loci_validate_of_group_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -46754,14 +46762,14 @@ static int
 loci_validate_of_group_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -46782,7 +46790,7 @@ static int
 loci_validate_of_group_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -46790,7 +46798,7 @@ loci_validate_of_group_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_GROUP_STATS_REQUEST, LENGTH);
     }
 
 
@@ -46804,14 +46812,14 @@ static int
 loci_validate_of_hello_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO, LENGTH);
     }
 
     len = wire_len;
@@ -46832,14 +46840,14 @@ static int
 loci_validate_of_hello_elem_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM, LENGTH);
     }
 
     len = wire_len;
@@ -46861,14 +46869,14 @@ static int
 loci_validate_of_hello_elem_versionbitmap_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM_VERSIONBITMAP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_ELEM_VERSIONBITMAP, LENGTH);
     }
 
     len = wire_len;
@@ -46889,14 +46897,14 @@ static int
 loci_validate_of_hello_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_HELLO_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -46912,14 +46920,14 @@ static int
 loci_validate_of_instruction_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION, LENGTH);
     }
 
     len = wire_len;
@@ -46953,14 +46961,14 @@ static int
 loci_validate_of_instruction_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID, LENGTH);
     }
 
     len = wire_len;
@@ -46994,14 +47002,14 @@ static int
 loci_validate_of_instruction_apply_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_APPLY_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -47022,7 +47030,7 @@ static int
 loci_validate_of_instruction_id_apply_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_APPLY_ACTIONS, SHORT);
     }
 
     len = 4;
@@ -47030,7 +47038,7 @@ loci_validate_of_instruction_id_apply_actions_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_APPLY_ACTIONS, LENGTH);
     }
 
 
@@ -47044,14 +47052,14 @@ static int
 loci_validate_of_instruction_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -47073,14 +47081,14 @@ static int
 loci_validate_of_instruction_bsn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -47130,14 +47138,14 @@ static int
 loci_validate_of_instruction_id_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -47159,14 +47167,14 @@ static int
 loci_validate_of_instruction_id_bsn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -47216,7 +47224,7 @@ static int
 loci_validate_of_instruction_bsn_arp_offload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_ARP_OFFLOAD, SHORT);
     }
 
     len = 16;
@@ -47224,7 +47232,7 @@ loci_validate_of_instruction_bsn_arp_offload_OF_VERSION_1_4(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_ARP_OFFLOAD, LENGTH);
     }
 
 
@@ -47238,7 +47246,7 @@ static int
 loci_validate_of_instruction_id_bsn_arp_offload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_ARP_OFFLOAD, SHORT);
     }
 
     len = 12;
@@ -47246,7 +47254,7 @@ loci_validate_of_instruction_id_bsn_arp_offload_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_ARP_OFFLOAD, LENGTH);
     }
 
 
@@ -47260,7 +47268,7 @@ static int
 loci_validate_of_instruction_bsn_auto_negotiation_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_AUTO_NEGOTIATION, SHORT);
     }
 
     len = 16;
@@ -47268,7 +47276,7 @@ loci_validate_of_instruction_bsn_auto_negotiation_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_AUTO_NEGOTIATION, LENGTH);
     }
 
 
@@ -47282,7 +47290,7 @@ static int
 loci_validate_of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_AUTO_NEGOTIATION, SHORT);
     }
 
     len = 12;
@@ -47290,7 +47298,7 @@ loci_validate_of_instruction_id_bsn_auto_negotiation_OF_VERSION_1_4(uint8_t *dat
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_AUTO_NEGOTIATION, LENGTH);
     }
 
 
@@ -47304,7 +47312,7 @@ static int
 loci_validate_of_instruction_bsn_deny_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DENY, SHORT);
     }
 
     len = 16;
@@ -47312,7 +47320,7 @@ loci_validate_of_instruction_bsn_deny_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DENY, LENGTH);
     }
 
 
@@ -47326,7 +47334,7 @@ static int
 loci_validate_of_instruction_id_bsn_deny_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DENY, SHORT);
     }
 
     len = 12;
@@ -47334,7 +47342,7 @@ loci_validate_of_instruction_id_bsn_deny_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DENY, LENGTH);
     }
 
 
@@ -47348,7 +47356,7 @@ static int
 loci_validate_of_instruction_bsn_dhcp_offload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DHCP_OFFLOAD, SHORT);
     }
 
     len = 16;
@@ -47356,7 +47364,7 @@ loci_validate_of_instruction_bsn_dhcp_offload_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DHCP_OFFLOAD, LENGTH);
     }
 
 
@@ -47370,7 +47378,7 @@ static int
 loci_validate_of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DHCP_OFFLOAD, SHORT);
     }
 
     len = 12;
@@ -47378,7 +47386,7 @@ loci_validate_of_instruction_id_bsn_dhcp_offload_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DHCP_OFFLOAD, LENGTH);
     }
 
 
@@ -47392,7 +47400,7 @@ static int
 loci_validate_of_instruction_bsn_disable_l3_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_L3, SHORT);
     }
 
     len = 16;
@@ -47400,7 +47408,7 @@ loci_validate_of_instruction_bsn_disable_l3_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_L3, LENGTH);
     }
 
 
@@ -47414,7 +47422,7 @@ static int
 loci_validate_of_instruction_id_bsn_disable_l3_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_L3, SHORT);
     }
 
     len = 12;
@@ -47422,7 +47430,7 @@ loci_validate_of_instruction_id_bsn_disable_l3_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_L3, LENGTH);
     }
 
 
@@ -47436,7 +47444,7 @@ static int
 loci_validate_of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_SRC_MAC_CHECK, SHORT);
     }
 
     len = 16;
@@ -47444,7 +47452,7 @@ loci_validate_of_instruction_bsn_disable_src_mac_check_OF_VERSION_1_4(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_SRC_MAC_CHECK, LENGTH);
     }
 
 
@@ -47458,7 +47466,7 @@ static int
 loci_validate_of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_SRC_MAC_CHECK, SHORT);
     }
 
     len = 12;
@@ -47466,7 +47474,7 @@ loci_validate_of_instruction_id_bsn_disable_src_mac_check_OF_VERSION_1_4(uint8_t
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_SRC_MAC_CHECK, LENGTH);
     }
 
 
@@ -47480,7 +47488,7 @@ static int
 loci_validate_of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_VLAN_COUNTERS, SHORT);
     }
 
     len = 16;
@@ -47488,7 +47496,7 @@ loci_validate_of_instruction_bsn_disable_vlan_counters_OF_VERSION_1_4(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_DISABLE_VLAN_COUNTERS, LENGTH);
     }
 
 
@@ -47502,7 +47510,7 @@ static int
 loci_validate_of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_VLAN_COUNTERS, SHORT);
     }
 
     len = 12;
@@ -47510,7 +47518,7 @@ loci_validate_of_instruction_id_bsn_disable_vlan_counters_OF_VERSION_1_4(uint8_t
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_DISABLE_VLAN_COUNTERS, LENGTH);
     }
 
 
@@ -47524,7 +47532,7 @@ static int
 loci_validate_of_instruction_bsn_hash_select_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_HASH_SELECT, SHORT);
     }
 
     len = 16;
@@ -47532,7 +47540,7 @@ loci_validate_of_instruction_bsn_hash_select_OF_VERSION_1_4(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_HASH_SELECT, LENGTH);
     }
 
 
@@ -47546,7 +47554,7 @@ static int
 loci_validate_of_instruction_id_bsn_hash_select_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_HASH_SELECT, SHORT);
     }
 
     len = 12;
@@ -47554,7 +47562,7 @@ loci_validate_of_instruction_id_bsn_hash_select_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_HASH_SELECT, LENGTH);
     }
 
 
@@ -47568,7 +47576,7 @@ static int
 loci_validate_of_instruction_bsn_internal_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_INTERNAL_PRIORITY, SHORT);
     }
 
     len = 16;
@@ -47576,7 +47584,7 @@ loci_validate_of_instruction_bsn_internal_priority_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_INTERNAL_PRIORITY, LENGTH);
     }
 
 
@@ -47590,7 +47598,7 @@ static int
 loci_validate_of_instruction_id_bsn_internal_priority_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_INTERNAL_PRIORITY, SHORT);
     }
 
     len = 12;
@@ -47598,7 +47606,7 @@ loci_validate_of_instruction_id_bsn_internal_priority_OF_VERSION_1_4(uint8_t *da
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_INTERNAL_PRIORITY, LENGTH);
     }
 
 
@@ -47612,7 +47620,7 @@ static int
 loci_validate_of_instruction_bsn_ndp_offload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_NDP_OFFLOAD, SHORT);
     }
 
     len = 16;
@@ -47620,7 +47628,7 @@ loci_validate_of_instruction_bsn_ndp_offload_OF_VERSION_1_4(uint8_t *data, int l
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_NDP_OFFLOAD, LENGTH);
     }
 
 
@@ -47634,7 +47642,7 @@ static int
 loci_validate_of_instruction_id_bsn_ndp_offload_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_NDP_OFFLOAD, SHORT);
     }
 
     len = 12;
@@ -47642,7 +47650,7 @@ loci_validate_of_instruction_id_bsn_ndp_offload_OF_VERSION_1_4(uint8_t *data, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_NDP_OFFLOAD, LENGTH);
     }
 
 
@@ -47656,7 +47664,7 @@ static int
 loci_validate_of_instruction_bsn_packet_of_death_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PACKET_OF_DEATH, SHORT);
     }
 
     len = 16;
@@ -47664,7 +47672,7 @@ loci_validate_of_instruction_bsn_packet_of_death_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PACKET_OF_DEATH, LENGTH);
     }
 
 
@@ -47678,7 +47686,7 @@ static int
 loci_validate_of_instruction_id_bsn_packet_of_death_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PACKET_OF_DEATH, SHORT);
     }
 
     len = 12;
@@ -47686,7 +47694,7 @@ loci_validate_of_instruction_id_bsn_packet_of_death_OF_VERSION_1_4(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PACKET_OF_DEATH, LENGTH);
     }
 
 
@@ -47700,7 +47708,7 @@ static int
 loci_validate_of_instruction_bsn_permit_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PERMIT, SHORT);
     }
 
     len = 16;
@@ -47708,7 +47716,7 @@ loci_validate_of_instruction_bsn_permit_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PERMIT, LENGTH);
     }
 
 
@@ -47722,7 +47730,7 @@ static int
 loci_validate_of_instruction_id_bsn_permit_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PERMIT, SHORT);
     }
 
     len = 12;
@@ -47730,7 +47738,7 @@ loci_validate_of_instruction_id_bsn_permit_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PERMIT, LENGTH);
     }
 
 
@@ -47744,7 +47752,7 @@ static int
 loci_validate_of_instruction_bsn_prioritize_pdus_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PRIORITIZE_PDUS, SHORT);
     }
 
     len = 16;
@@ -47752,7 +47760,7 @@ loci_validate_of_instruction_bsn_prioritize_pdus_OF_VERSION_1_4(uint8_t *data, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_PRIORITIZE_PDUS, LENGTH);
     }
 
 
@@ -47766,7 +47774,7 @@ static int
 loci_validate_of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PRIORITIZE_PDUS, SHORT);
     }
 
     len = 12;
@@ -47774,7 +47782,7 @@ loci_validate_of_instruction_id_bsn_prioritize_pdus_OF_VERSION_1_4(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_PRIORITIZE_PDUS, LENGTH);
     }
 
 
@@ -47788,7 +47796,7 @@ static int
 loci_validate_of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_REQUIRE_VLAN_XLATE, SHORT);
     }
 
     len = 16;
@@ -47796,7 +47804,7 @@ loci_validate_of_instruction_bsn_require_vlan_xlate_OF_VERSION_1_4(uint8_t *data
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_REQUIRE_VLAN_XLATE, LENGTH);
     }
 
 
@@ -47810,7 +47818,7 @@ static int
 loci_validate_of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_REQUIRE_VLAN_XLATE, SHORT);
     }
 
     len = 12;
@@ -47818,7 +47826,7 @@ loci_validate_of_instruction_id_bsn_require_vlan_xlate_OF_VERSION_1_4(uint8_t *d
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_REQUIRE_VLAN_XLATE, LENGTH);
     }
 
 
@@ -47832,7 +47840,7 @@ static int
 loci_validate_of_instruction_bsn_span_destination_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_SPAN_DESTINATION, SHORT);
     }
 
     len = 16;
@@ -47840,7 +47848,7 @@ loci_validate_of_instruction_bsn_span_destination_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_BSN_SPAN_DESTINATION, LENGTH);
     }
 
 
@@ -47854,7 +47862,7 @@ static int
 loci_validate_of_instruction_id_bsn_span_destination_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_SPAN_DESTINATION, SHORT);
     }
 
     len = 12;
@@ -47862,7 +47870,7 @@ loci_validate_of_instruction_id_bsn_span_destination_OF_VERSION_1_4(uint8_t *dat
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_BSN_SPAN_DESTINATION, LENGTH);
     }
 
 
@@ -47876,7 +47884,7 @@ static int
 loci_validate_of_instruction_clear_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, SHORT);
     }
 
     len = 8;
@@ -47884,7 +47892,7 @@ loci_validate_of_instruction_clear_actions_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_CLEAR_ACTIONS, LENGTH);
     }
 
 
@@ -47898,7 +47906,7 @@ static int
 loci_validate_of_instruction_id_clear_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_CLEAR_ACTIONS, SHORT);
     }
 
     len = 4;
@@ -47906,7 +47914,7 @@ loci_validate_of_instruction_id_clear_actions_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_CLEAR_ACTIONS, LENGTH);
     }
 
 
@@ -47920,7 +47928,7 @@ static int
 loci_validate_of_instruction_goto_table_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, SHORT);
     }
 
     len = 8;
@@ -47928,7 +47936,7 @@ loci_validate_of_instruction_goto_table_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_GOTO_TABLE, LENGTH);
     }
 
 
@@ -47942,7 +47950,7 @@ static int
 loci_validate_of_instruction_id_goto_table_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_GOTO_TABLE, SHORT);
     }
 
     len = 4;
@@ -47950,7 +47958,7 @@ loci_validate_of_instruction_id_goto_table_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_GOTO_TABLE, LENGTH);
     }
 
 
@@ -47964,7 +47972,7 @@ static int
 loci_validate_of_instruction_meter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_METER, SHORT);
     }
 
     len = 8;
@@ -47972,7 +47980,7 @@ loci_validate_of_instruction_meter_OF_VERSION_1_4(uint8_t *data, int len, int *o
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_METER, LENGTH);
     }
 
 
@@ -47986,7 +47994,7 @@ static int
 loci_validate_of_instruction_id_meter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_METER, SHORT);
     }
 
     len = 4;
@@ -47994,7 +48002,7 @@ loci_validate_of_instruction_id_meter_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_METER, LENGTH);
     }
 
 
@@ -48008,14 +48016,14 @@ static int
 loci_validate_of_instruction_write_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -48036,7 +48044,7 @@ static int
 loci_validate_of_instruction_id_write_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_ACTIONS, SHORT);
     }
 
     len = 4;
@@ -48044,7 +48052,7 @@ loci_validate_of_instruction_id_write_actions_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_ACTIONS, LENGTH);
     }
 
 
@@ -48058,7 +48066,7 @@ static int
 loci_validate_of_instruction_write_metadata_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, SHORT);
     }
 
     len = 24;
@@ -48066,7 +48074,7 @@ loci_validate_of_instruction_write_metadata_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_WRITE_METADATA, LENGTH);
     }
 
 
@@ -48080,7 +48088,7 @@ static int
 loci_validate_of_instruction_id_write_metadata_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_METADATA, SHORT);
     }
 
     len = 4;
@@ -48088,7 +48096,7 @@ loci_validate_of_instruction_id_write_metadata_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_INSTRUCTION_ID_WRITE_METADATA, LENGTH);
     }
 
 
@@ -48102,14 +48110,14 @@ static int
 loci_validate_of_match_v3_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V3, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_MATCH_V3, LENGTH);
     }
 
     len = wire_len;
@@ -48130,14 +48138,14 @@ static int
 loci_validate_of_meter_band_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND, LENGTH);
     }
 
     len = wire_len;
@@ -48163,7 +48171,7 @@ static int
 loci_validate_of_meter_band_drop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DROP, SHORT);
     }
 
     len = 16;
@@ -48171,7 +48179,7 @@ loci_validate_of_meter_band_drop_OF_VERSION_1_4(uint8_t *data, int len, int *out
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DROP, LENGTH);
     }
 
 
@@ -48185,7 +48193,7 @@ static int
 loci_validate_of_meter_band_dscp_remark_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DSCP_REMARK, SHORT);
     }
 
     len = 16;
@@ -48193,7 +48201,7 @@ loci_validate_of_meter_band_dscp_remark_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_DSCP_REMARK, LENGTH);
     }
 
 
@@ -48207,7 +48215,7 @@ static int
 loci_validate_of_meter_band_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_EXPERIMENTER, SHORT);
     }
 
     len = 16;
@@ -48215,7 +48223,7 @@ loci_validate_of_meter_band_experimenter_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_EXPERIMENTER, LENGTH);
     }
 
 
@@ -48229,7 +48237,7 @@ static int
 loci_validate_of_meter_band_stats_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_BAND_STATS, SHORT);
     }
 
     len = 16;
@@ -48245,14 +48253,14 @@ static int
 loci_validate_of_meter_config_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG, LENGTH);
     }
 
     len = wire_len;
@@ -48273,14 +48281,14 @@ static int
 loci_validate_of_meter_config_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -48301,7 +48309,7 @@ static int
 loci_validate_of_meter_config_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -48309,7 +48317,7 @@ loci_validate_of_meter_config_stats_request_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_CONFIG_STATS_REQUEST, LENGTH);
     }
 
 
@@ -48323,7 +48331,7 @@ static int
 loci_validate_of_meter_features_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES, SHORT);
     }
 
     len = 16;
@@ -48339,7 +48347,7 @@ static int
 loci_validate_of_meter_features_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REPLY, SHORT);
     }
 
     len = 32;
@@ -48347,7 +48355,7 @@ loci_validate_of_meter_features_stats_reply_OF_VERSION_1_4(uint8_t *data, int le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REPLY, LENGTH);
     }
 
 
@@ -48362,7 +48370,7 @@ static int
 loci_validate_of_meter_features_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -48370,7 +48378,7 @@ loci_validate_of_meter_features_stats_request_OF_VERSION_1_4(uint8_t *data, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_FEATURES_STATS_REQUEST, LENGTH);
     }
 
 
@@ -48384,14 +48392,14 @@ static int
 loci_validate_of_meter_mod_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -48412,14 +48420,14 @@ static int
 loci_validate_of_meter_mod_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -48435,14 +48443,14 @@ static int
 loci_validate_of_meter_stats_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS, LENGTH);
     }
 
     len = wire_len;
@@ -48463,14 +48471,14 @@ static int
 loci_validate_of_meter_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -48491,7 +48499,7 @@ static int
 loci_validate_of_meter_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -48499,7 +48507,7 @@ loci_validate_of_meter_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_METER_STATS_REQUEST, LENGTH);
     }
 
 
@@ -48513,14 +48521,14 @@ static int
 loci_validate_of_nicira_header_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_NICIRA_HEADER, LENGTH);
     }
 
     len = wire_len;
@@ -48540,7 +48548,7 @@ static int
 loci_validate_of_oxm_arp_op_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_OP, SHORT);
     }
 
     len = 6;
@@ -48556,7 +48564,7 @@ static int
 loci_validate_of_oxm_arp_op_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_OP_MASKED, SHORT);
     }
 
     len = 8;
@@ -48572,7 +48580,7 @@ static int
 loci_validate_of_oxm_arp_sha_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SHA, SHORT);
     }
 
     len = 10;
@@ -48588,7 +48596,7 @@ static int
 loci_validate_of_oxm_arp_sha_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SHA_MASKED, SHORT);
     }
 
     len = 16;
@@ -48604,7 +48612,7 @@ static int
 loci_validate_of_oxm_arp_spa_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SPA, SHORT);
     }
 
     len = 8;
@@ -48620,7 +48628,7 @@ static int
 loci_validate_of_oxm_arp_spa_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_SPA_MASKED, SHORT);
     }
 
     len = 12;
@@ -48636,7 +48644,7 @@ static int
 loci_validate_of_oxm_arp_tha_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_THA, SHORT);
     }
 
     len = 10;
@@ -48652,7 +48660,7 @@ static int
 loci_validate_of_oxm_arp_tha_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_THA_MASKED, SHORT);
     }
 
     len = 16;
@@ -48668,7 +48676,7 @@ static int
 loci_validate_of_oxm_arp_tpa_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_TPA, SHORT);
     }
 
     len = 8;
@@ -48684,7 +48692,7 @@ static int
 loci_validate_of_oxm_arp_tpa_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ARP_TPA_MASKED, SHORT);
     }
 
     len = 12;
@@ -48700,7 +48708,7 @@ static int
 loci_validate_of_oxm_bsn_egr_port_group_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_EGR_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -48716,7 +48724,7 @@ static int
 loci_validate_of_oxm_bsn_egr_port_group_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_EGR_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -48732,7 +48740,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_128_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_128, SHORT);
     }
 
     len = 20;
@@ -48748,7 +48756,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_128_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_128_MASKED, SHORT);
     }
 
     len = 36;
@@ -48764,7 +48772,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_512_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 68) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_512, SHORT);
     }
 
     len = 68;
@@ -48780,7 +48788,7 @@ static int
 loci_validate_of_oxm_bsn_in_ports_512_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 132) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IN_PORTS_512_MASKED, SHORT);
     }
 
     len = 132;
@@ -48796,7 +48804,7 @@ static int
 loci_validate_of_oxm_bsn_ingress_port_group_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INGRESS_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -48812,7 +48820,7 @@ static int
 loci_validate_of_oxm_bsn_ingress_port_group_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INGRESS_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -48828,7 +48836,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -48844,7 +48852,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -48860,7 +48868,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -48876,7 +48884,7 @@ static int
 loci_validate_of_oxm_bsn_inner_eth_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -48892,7 +48900,7 @@ static int
 loci_validate_of_oxm_bsn_inner_vlan_vid_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_VLAN_VID, SHORT);
     }
 
     len = 6;
@@ -48908,7 +48916,7 @@ static int
 loci_validate_of_oxm_bsn_inner_vlan_vid_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_INNER_VLAN_VID_MASKED, SHORT);
     }
 
     len = 8;
@@ -48924,7 +48932,7 @@ static int
 loci_validate_of_oxm_bsn_ip_fragmentation_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IP_FRAGMENTATION, SHORT);
     }
 
     len = 5;
@@ -48940,7 +48948,7 @@ static int
 loci_validate_of_oxm_bsn_ip_fragmentation_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_IP_FRAGMENTATION_MASKED, SHORT);
     }
 
     len = 6;
@@ -48956,7 +48964,7 @@ static int
 loci_validate_of_oxm_bsn_l2_cache_hit_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L2_CACHE_HIT, SHORT);
     }
 
     len = 5;
@@ -48972,7 +48980,7 @@ static int
 loci_validate_of_oxm_bsn_l2_cache_hit_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L2_CACHE_HIT_MASKED, SHORT);
     }
 
     len = 6;
@@ -48988,7 +48996,7 @@ static int
 loci_validate_of_oxm_bsn_l3_interface_class_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_INTERFACE_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -49004,7 +49012,7 @@ static int
 loci_validate_of_oxm_bsn_l3_interface_class_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_INTERFACE_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -49020,7 +49028,7 @@ static int
 loci_validate_of_oxm_bsn_l3_src_class_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_SRC_CLASS_ID, SHORT);
     }
 
     len = 8;
@@ -49036,7 +49044,7 @@ static int
 loci_validate_of_oxm_bsn_l3_src_class_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_L3_SRC_CLASS_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -49052,7 +49060,7 @@ static int
 loci_validate_of_oxm_bsn_lag_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_LAG_ID, SHORT);
     }
 
     len = 8;
@@ -49068,7 +49076,7 @@ static int
 loci_validate_of_oxm_bsn_lag_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_LAG_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -49084,7 +49092,7 @@ static int
 loci_validate_of_oxm_bsn_tcp_flags_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_TCP_FLAGS, SHORT);
     }
 
     len = 6;
@@ -49100,7 +49108,7 @@ static int
 loci_validate_of_oxm_bsn_tcp_flags_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_TCP_FLAGS_MASKED, SHORT);
     }
 
     len = 8;
@@ -49116,7 +49124,7 @@ static int
 loci_validate_of_oxm_bsn_udf0_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF0, SHORT);
     }
 
     len = 8;
@@ -49132,7 +49140,7 @@ static int
 loci_validate_of_oxm_bsn_udf0_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF0_MASKED, SHORT);
     }
 
     len = 12;
@@ -49148,7 +49156,7 @@ static int
 loci_validate_of_oxm_bsn_udf1_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF1, SHORT);
     }
 
     len = 8;
@@ -49164,7 +49172,7 @@ static int
 loci_validate_of_oxm_bsn_udf1_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF1_MASKED, SHORT);
     }
 
     len = 12;
@@ -49180,7 +49188,7 @@ static int
 loci_validate_of_oxm_bsn_udf2_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF2, SHORT);
     }
 
     len = 8;
@@ -49196,7 +49204,7 @@ static int
 loci_validate_of_oxm_bsn_udf2_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF2_MASKED, SHORT);
     }
 
     len = 12;
@@ -49212,7 +49220,7 @@ static int
 loci_validate_of_oxm_bsn_udf3_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF3, SHORT);
     }
 
     len = 8;
@@ -49228,7 +49236,7 @@ static int
 loci_validate_of_oxm_bsn_udf3_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF3_MASKED, SHORT);
     }
 
     len = 12;
@@ -49244,7 +49252,7 @@ static int
 loci_validate_of_oxm_bsn_udf4_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF4, SHORT);
     }
 
     len = 8;
@@ -49260,7 +49268,7 @@ static int
 loci_validate_of_oxm_bsn_udf4_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF4_MASKED, SHORT);
     }
 
     len = 12;
@@ -49276,7 +49284,7 @@ static int
 loci_validate_of_oxm_bsn_udf5_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF5, SHORT);
     }
 
     len = 8;
@@ -49292,7 +49300,7 @@ static int
 loci_validate_of_oxm_bsn_udf5_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF5_MASKED, SHORT);
     }
 
     len = 12;
@@ -49308,7 +49316,7 @@ static int
 loci_validate_of_oxm_bsn_udf6_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF6, SHORT);
     }
 
     len = 8;
@@ -49324,7 +49332,7 @@ static int
 loci_validate_of_oxm_bsn_udf6_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF6_MASKED, SHORT);
     }
 
     len = 12;
@@ -49340,7 +49348,7 @@ static int
 loci_validate_of_oxm_bsn_udf7_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF7, SHORT);
     }
 
     len = 8;
@@ -49356,7 +49364,7 @@ static int
 loci_validate_of_oxm_bsn_udf7_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_UDF7_MASKED, SHORT);
     }
 
     len = 12;
@@ -49372,7 +49380,7 @@ static int
 loci_validate_of_oxm_bsn_vfi_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VFI, SHORT);
     }
 
     len = 6;
@@ -49388,7 +49396,7 @@ static int
 loci_validate_of_oxm_bsn_vfi_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VFI_MASKED, SHORT);
     }
 
     len = 8;
@@ -49404,7 +49412,7 @@ static int
 loci_validate_of_oxm_bsn_vlan_xlate_port_group_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VLAN_XLATE_PORT_GROUP_ID, SHORT);
     }
 
     len = 8;
@@ -49420,7 +49428,7 @@ static int
 loci_validate_of_oxm_bsn_vlan_xlate_port_group_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VLAN_XLATE_PORT_GROUP_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -49436,7 +49444,7 @@ static int
 loci_validate_of_oxm_bsn_vrf_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VRF, SHORT);
     }
 
     len = 8;
@@ -49452,7 +49460,7 @@ static int
 loci_validate_of_oxm_bsn_vrf_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VRF_MASKED, SHORT);
     }
 
     len = 12;
@@ -49468,7 +49476,7 @@ static int
 loci_validate_of_oxm_bsn_vxlan_network_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VXLAN_NETWORK_ID, SHORT);
     }
 
     len = 8;
@@ -49484,7 +49492,7 @@ static int
 loci_validate_of_oxm_bsn_vxlan_network_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_BSN_VXLAN_NETWORK_ID_MASKED, SHORT);
     }
 
     len = 12;
@@ -49500,7 +49508,7 @@ static int
 loci_validate_of_oxm_encap_eth_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -49516,7 +49524,7 @@ static int
 loci_validate_of_oxm_encap_eth_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -49532,7 +49540,7 @@ static int
 loci_validate_of_oxm_encap_eth_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -49548,7 +49556,7 @@ static int
 loci_validate_of_oxm_encap_eth_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -49564,7 +49572,7 @@ static int
 loci_validate_of_oxm_encap_eth_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -49580,7 +49588,7 @@ static int
 loci_validate_of_oxm_encap_eth_type_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ENCAP_ETH_TYPE_MASKED, SHORT);
     }
 
     len = 8;
@@ -49596,7 +49604,7 @@ static int
 loci_validate_of_oxm_eth_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_DST, SHORT);
     }
 
     len = 10;
@@ -49612,7 +49620,7 @@ static int
 loci_validate_of_oxm_eth_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_DST_MASKED, SHORT);
     }
 
     len = 16;
@@ -49628,7 +49636,7 @@ static int
 loci_validate_of_oxm_eth_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_SRC, SHORT);
     }
 
     len = 10;
@@ -49644,7 +49652,7 @@ static int
 loci_validate_of_oxm_eth_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_SRC_MASKED, SHORT);
     }
 
     len = 16;
@@ -49660,7 +49668,7 @@ static int
 loci_validate_of_oxm_eth_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_TYPE, SHORT);
     }
 
     len = 6;
@@ -49676,7 +49684,7 @@ static int
 loci_validate_of_oxm_eth_type_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ETH_TYPE_MASKED, SHORT);
     }
 
     len = 8;
@@ -49692,7 +49700,7 @@ static int
 loci_validate_of_oxm_icmpv4_code_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_CODE, SHORT);
     }
 
     len = 5;
@@ -49708,7 +49716,7 @@ static int
 loci_validate_of_oxm_icmpv4_code_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_CODE_MASKED, SHORT);
     }
 
     len = 6;
@@ -49724,7 +49732,7 @@ static int
 loci_validate_of_oxm_icmpv4_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_TYPE, SHORT);
     }
 
     len = 5;
@@ -49740,7 +49748,7 @@ static int
 loci_validate_of_oxm_icmpv4_type_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV4_TYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -49756,7 +49764,7 @@ static int
 loci_validate_of_oxm_icmpv6_code_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_CODE, SHORT);
     }
 
     len = 5;
@@ -49772,7 +49780,7 @@ static int
 loci_validate_of_oxm_icmpv6_code_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_CODE_MASKED, SHORT);
     }
 
     len = 6;
@@ -49788,7 +49796,7 @@ static int
 loci_validate_of_oxm_icmpv6_type_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_TYPE, SHORT);
     }
 
     len = 5;
@@ -49804,7 +49812,7 @@ static int
 loci_validate_of_oxm_icmpv6_type_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_ICMPV6_TYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -49820,7 +49828,7 @@ static int
 loci_validate_of_oxm_in_phy_port_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PHY_PORT, SHORT);
     }
 
     len = 8;
@@ -49836,7 +49844,7 @@ static int
 loci_validate_of_oxm_in_phy_port_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PHY_PORT_MASKED, SHORT);
     }
 
     len = 12;
@@ -49852,7 +49860,7 @@ static int
 loci_validate_of_oxm_in_port_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PORT, SHORT);
     }
 
     len = 8;
@@ -49868,7 +49876,7 @@ static int
 loci_validate_of_oxm_in_port_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IN_PORT_MASKED, SHORT);
     }
 
     len = 12;
@@ -49884,7 +49892,7 @@ static int
 loci_validate_of_oxm_ip_dscp_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_DSCP, SHORT);
     }
 
     len = 5;
@@ -49900,7 +49908,7 @@ static int
 loci_validate_of_oxm_ip_dscp_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_DSCP_MASKED, SHORT);
     }
 
     len = 6;
@@ -49916,7 +49924,7 @@ static int
 loci_validate_of_oxm_ip_ecn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_ECN, SHORT);
     }
 
     len = 5;
@@ -49932,7 +49940,7 @@ static int
 loci_validate_of_oxm_ip_ecn_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_ECN_MASKED, SHORT);
     }
 
     len = 6;
@@ -49948,7 +49956,7 @@ static int
 loci_validate_of_oxm_ip_proto_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_PROTO, SHORT);
     }
 
     len = 5;
@@ -49964,7 +49972,7 @@ static int
 loci_validate_of_oxm_ip_proto_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IP_PROTO_MASKED, SHORT);
     }
 
     len = 6;
@@ -49980,7 +49988,7 @@ static int
 loci_validate_of_oxm_ipv4_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -49996,7 +50004,7 @@ static int
 loci_validate_of_oxm_ipv4_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_DST_MASKED, SHORT);
     }
 
     len = 12;
@@ -50012,7 +50020,7 @@ static int
 loci_validate_of_oxm_ipv4_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -50028,7 +50036,7 @@ static int
 loci_validate_of_oxm_ipv4_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV4_SRC_MASKED, SHORT);
     }
 
     len = 12;
@@ -50044,7 +50052,7 @@ static int
 loci_validate_of_oxm_ipv6_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_DST, SHORT);
     }
 
     len = 20;
@@ -50060,7 +50068,7 @@ static int
 loci_validate_of_oxm_ipv6_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_DST_MASKED, SHORT);
     }
 
     len = 36;
@@ -50076,7 +50084,7 @@ static int
 loci_validate_of_oxm_ipv6_exthdr_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_EXTHDR, SHORT);
     }
 
     len = 6;
@@ -50092,7 +50100,7 @@ static int
 loci_validate_of_oxm_ipv6_exthdr_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_EXTHDR_MASKED, SHORT);
     }
 
     len = 8;
@@ -50108,7 +50116,7 @@ static int
 loci_validate_of_oxm_ipv6_flabel_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_FLABEL, SHORT);
     }
 
     len = 8;
@@ -50124,7 +50132,7 @@ static int
 loci_validate_of_oxm_ipv6_flabel_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_FLABEL_MASKED, SHORT);
     }
 
     len = 12;
@@ -50140,7 +50148,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_sll_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_SLL, SHORT);
     }
 
     len = 10;
@@ -50156,7 +50164,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_sll_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_SLL_MASKED, SHORT);
     }
 
     len = 16;
@@ -50172,7 +50180,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_target_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TARGET, SHORT);
     }
 
     len = 20;
@@ -50188,7 +50196,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_target_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TARGET_MASKED, SHORT);
     }
 
     len = 36;
@@ -50204,7 +50212,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_tll_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TLL, SHORT);
     }
 
     len = 10;
@@ -50220,7 +50228,7 @@ static int
 loci_validate_of_oxm_ipv6_nd_tll_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_ND_TLL_MASKED, SHORT);
     }
 
     len = 16;
@@ -50236,7 +50244,7 @@ static int
 loci_validate_of_oxm_ipv6_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_SRC, SHORT);
     }
 
     len = 20;
@@ -50252,7 +50260,7 @@ static int
 loci_validate_of_oxm_ipv6_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 36) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_IPV6_SRC_MASKED, SHORT);
     }
 
     len = 36;
@@ -50268,7 +50276,7 @@ static int
 loci_validate_of_oxm_metadata_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_METADATA, SHORT);
     }
 
     len = 12;
@@ -50284,7 +50292,7 @@ static int
 loci_validate_of_oxm_metadata_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_METADATA_MASKED, SHORT);
     }
 
     len = 20;
@@ -50300,7 +50308,7 @@ static int
 loci_validate_of_oxm_mpls_bos_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_BOS, SHORT);
     }
 
     len = 5;
@@ -50316,7 +50324,7 @@ static int
 loci_validate_of_oxm_mpls_bos_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_BOS_MASKED, SHORT);
     }
 
     len = 6;
@@ -50332,7 +50340,7 @@ static int
 loci_validate_of_oxm_mpls_label_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_LABEL, SHORT);
     }
 
     len = 8;
@@ -50348,7 +50356,7 @@ static int
 loci_validate_of_oxm_mpls_label_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_LABEL_MASKED, SHORT);
     }
 
     len = 12;
@@ -50364,7 +50372,7 @@ static int
 loci_validate_of_oxm_mpls_tc_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_TC, SHORT);
     }
 
     len = 5;
@@ -50380,7 +50388,7 @@ static int
 loci_validate_of_oxm_mpls_tc_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_MPLS_TC_MASKED, SHORT);
     }
 
     len = 6;
@@ -50396,7 +50404,7 @@ static int
 loci_validate_of_oxm_nsh_c1_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C1, SHORT);
     }
 
     len = 8;
@@ -50412,7 +50420,7 @@ static int
 loci_validate_of_oxm_nsh_c1_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C1_MASKED, SHORT);
     }
 
     len = 12;
@@ -50428,7 +50436,7 @@ static int
 loci_validate_of_oxm_nsh_c2_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C2, SHORT);
     }
 
     len = 8;
@@ -50444,7 +50452,7 @@ static int
 loci_validate_of_oxm_nsh_c2_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C2_MASKED, SHORT);
     }
 
     len = 12;
@@ -50460,7 +50468,7 @@ static int
 loci_validate_of_oxm_nsh_c3_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C3, SHORT);
     }
 
     len = 8;
@@ -50476,7 +50484,7 @@ static int
 loci_validate_of_oxm_nsh_c3_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C3_MASKED, SHORT);
     }
 
     len = 12;
@@ -50492,7 +50500,7 @@ static int
 loci_validate_of_oxm_nsh_c4_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C4, SHORT);
     }
 
     len = 8;
@@ -50508,7 +50516,7 @@ static int
 loci_validate_of_oxm_nsh_c4_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_C4_MASKED, SHORT);
     }
 
     len = 12;
@@ -50524,7 +50532,7 @@ static int
 loci_validate_of_oxm_nsh_mdtype_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_MDTYPE, SHORT);
     }
 
     len = 5;
@@ -50540,7 +50548,7 @@ static int
 loci_validate_of_oxm_nsh_mdtype_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_MDTYPE_MASKED, SHORT);
     }
 
     len = 6;
@@ -50556,7 +50564,7 @@ static int
 loci_validate_of_oxm_nsh_np_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_NP, SHORT);
     }
 
     len = 5;
@@ -50572,7 +50580,7 @@ static int
 loci_validate_of_oxm_nsh_np_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSH_NP_MASKED, SHORT);
     }
 
     len = 6;
@@ -50588,7 +50596,7 @@ static int
 loci_validate_of_oxm_nsi_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSI, SHORT);
     }
 
     len = 5;
@@ -50604,7 +50612,7 @@ static int
 loci_validate_of_oxm_nsi_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSI_MASKED, SHORT);
     }
 
     len = 6;
@@ -50620,7 +50628,7 @@ static int
 loci_validate_of_oxm_nsp_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSP, SHORT);
     }
 
     len = 8;
@@ -50636,7 +50644,7 @@ static int
 loci_validate_of_oxm_nsp_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_NSP_MASKED, SHORT);
     }
 
     len = 12;
@@ -50652,7 +50660,7 @@ static int
 loci_validate_of_oxm_ovs_tcp_flags_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 10) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OVS_TCP_FLAGS, SHORT);
     }
 
     len = 10;
@@ -50668,7 +50676,7 @@ static int
 loci_validate_of_oxm_ovs_tcp_flags_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_OVS_TCP_FLAGS_MASKED, SHORT);
     }
 
     len = 12;
@@ -50684,7 +50692,7 @@ static int
 loci_validate_of_oxm_pbb_uca_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_PBB_UCA, SHORT);
     }
 
     len = 5;
@@ -50700,7 +50708,7 @@ static int
 loci_validate_of_oxm_pbb_uca_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_PBB_UCA_MASKED, SHORT);
     }
 
     len = 6;
@@ -50716,7 +50724,7 @@ static int
 loci_validate_of_oxm_sctp_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_DST, SHORT);
     }
 
     len = 6;
@@ -50732,7 +50740,7 @@ static int
 loci_validate_of_oxm_sctp_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -50748,7 +50756,7 @@ static int
 loci_validate_of_oxm_sctp_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_SRC, SHORT);
     }
 
     len = 6;
@@ -50764,7 +50772,7 @@ static int
 loci_validate_of_oxm_sctp_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_SCTP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -50780,7 +50788,7 @@ static int
 loci_validate_of_oxm_tcp_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_DST, SHORT);
     }
 
     len = 6;
@@ -50796,7 +50804,7 @@ static int
 loci_validate_of_oxm_tcp_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -50812,7 +50820,7 @@ static int
 loci_validate_of_oxm_tcp_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_SRC, SHORT);
     }
 
     len = 6;
@@ -50828,7 +50836,7 @@ static int
 loci_validate_of_oxm_tcp_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TCP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -50844,7 +50852,7 @@ static int
 loci_validate_of_oxm_tun_flags_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_FLAGS, SHORT);
     }
 
     len = 6;
@@ -50860,7 +50868,7 @@ static int
 loci_validate_of_oxm_tun_flags_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_FLAGS_MASKED, SHORT);
     }
 
     len = 8;
@@ -50876,7 +50884,7 @@ static int
 loci_validate_of_oxm_tun_gbp_flags_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_FLAGS, SHORT);
     }
 
     len = 5;
@@ -50892,7 +50900,7 @@ static int
 loci_validate_of_oxm_tun_gbp_flags_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_FLAGS_MASKED, SHORT);
     }
 
     len = 6;
@@ -50908,7 +50916,7 @@ static int
 loci_validate_of_oxm_tun_gbp_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_ID, SHORT);
     }
 
     len = 6;
@@ -50924,7 +50932,7 @@ static int
 loci_validate_of_oxm_tun_gbp_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GBP_ID_MASKED, SHORT);
     }
 
     len = 8;
@@ -50940,7 +50948,7 @@ static int
 loci_validate_of_oxm_tun_gpe_flags_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_FLAGS, SHORT);
     }
 
     len = 5;
@@ -50956,7 +50964,7 @@ static int
 loci_validate_of_oxm_tun_gpe_flags_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_FLAGS_MASKED, SHORT);
     }
 
     len = 6;
@@ -50972,7 +50980,7 @@ static int
 loci_validate_of_oxm_tun_gpe_np_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_NP, SHORT);
     }
 
     len = 5;
@@ -50988,7 +50996,7 @@ static int
 loci_validate_of_oxm_tun_gpe_np_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUN_GPE_NP_MASKED, SHORT);
     }
 
     len = 6;
@@ -51004,7 +51012,7 @@ static int
 loci_validate_of_oxm_tunnel_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_ID, SHORT);
     }
 
     len = 12;
@@ -51020,7 +51028,7 @@ static int
 loci_validate_of_oxm_tunnel_id_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_ID_MASKED, SHORT);
     }
 
     len = 20;
@@ -51036,7 +51044,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_DST, SHORT);
     }
 
     len = 8;
@@ -51052,7 +51060,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_DST_MASKED, SHORT);
     }
 
     len = 12;
@@ -51068,7 +51076,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_SRC, SHORT);
     }
 
     len = 8;
@@ -51084,7 +51092,7 @@ static int
 loci_validate_of_oxm_tunnel_ipv4_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_TUNNEL_IPV4_SRC_MASKED, SHORT);
     }
 
     len = 12;
@@ -51100,7 +51108,7 @@ static int
 loci_validate_of_oxm_udp_dst_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_DST, SHORT);
     }
 
     len = 6;
@@ -51116,7 +51124,7 @@ static int
 loci_validate_of_oxm_udp_dst_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_DST_MASKED, SHORT);
     }
 
     len = 8;
@@ -51132,7 +51140,7 @@ static int
 loci_validate_of_oxm_udp_src_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_SRC, SHORT);
     }
 
     len = 6;
@@ -51148,7 +51156,7 @@ static int
 loci_validate_of_oxm_udp_src_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_UDP_SRC_MASKED, SHORT);
     }
 
     len = 8;
@@ -51164,7 +51172,7 @@ static int
 loci_validate_of_oxm_vlan_pcp_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 5) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_PCP, SHORT);
     }
 
     len = 5;
@@ -51180,7 +51188,7 @@ static int
 loci_validate_of_oxm_vlan_pcp_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_PCP_MASKED, SHORT);
     }
 
     len = 6;
@@ -51196,7 +51204,7 @@ static int
 loci_validate_of_oxm_vlan_vid_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 6) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_VID, SHORT);
     }
 
     len = 6;
@@ -51212,7 +51220,7 @@ static int
 loci_validate_of_oxm_vlan_vid_masked_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_OXM_VLAN_VID_MASKED, SHORT);
     }
 
     len = 8;
@@ -51228,14 +51236,14 @@ static int
 loci_validate_of_packet_in_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 34) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_IN, LENGTH);
     }
 
     len = wire_len;
@@ -51252,14 +51260,14 @@ static int
 loci_validate_of_packet_out_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     len = wire_len;
@@ -51270,7 +51278,7 @@ loci_validate_of_packet_out_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 
 
     if (24 + wire_len_actions > len) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_OUT, LENGTH);
     }
 
     if (loci_validate_of_list_action_OF_VERSION_1_4(data + 24, wire_len_actions, out_len) < 0) {
@@ -51286,14 +51294,14 @@ static int
 loci_validate_of_packet_queue_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 8, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PACKET_QUEUE, LENGTH);
     }
 
     len = wire_len;
@@ -51314,14 +51322,14 @@ static int
 loci_validate_of_port_desc_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 4, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC, LENGTH);
     }
 
     len = wire_len;
@@ -51342,14 +51350,14 @@ static int
 loci_validate_of_port_desc_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -51375,14 +51383,14 @@ static int
 loci_validate_of_port_desc_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -51404,14 +51412,14 @@ static int
 loci_validate_of_port_desc_prop_bsn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -51437,7 +51445,7 @@ static int
 loci_validate_of_port_desc_prop_bsn_forward_error_correction_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN_FORWARD_ERROR_CORRECTION, SHORT);
     }
 
     len = 20;
@@ -51445,7 +51453,7 @@ loci_validate_of_port_desc_prop_bsn_forward_error_correction_OF_VERSION_1_4(uint
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN_FORWARD_ERROR_CORRECTION, LENGTH);
     }
 
 
@@ -51459,7 +51467,7 @@ static int
 loci_validate_of_port_desc_prop_bsn_generation_id_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN_GENERATION_ID, SHORT);
     }
 
     len = 20;
@@ -51467,7 +51475,7 @@ loci_validate_of_port_desc_prop_bsn_generation_id_OF_VERSION_1_4(uint8_t *data,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 20) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN_GENERATION_ID, LENGTH);
     }
 
 
@@ -51481,7 +51489,7 @@ static int
 loci_validate_of_port_desc_prop_bsn_uplink_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN_UPLINK, SHORT);
     }
 
     len = 12;
@@ -51489,7 +51497,7 @@ loci_validate_of_port_desc_prop_bsn_uplink_OF_VERSION_1_4(uint8_t *data, int len
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_BSN_UPLINK, LENGTH);
     }
 
 
@@ -51503,7 +51511,7 @@ static int
 loci_validate_of_port_desc_prop_ethernet_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_ETHERNET, SHORT);
     }
 
     len = 32;
@@ -51511,7 +51519,7 @@ loci_validate_of_port_desc_prop_ethernet_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_ETHERNET, LENGTH);
     }
 
 
@@ -51525,7 +51533,7 @@ static int
 loci_validate_of_port_desc_prop_optical_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 44) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_OPTICAL, SHORT);
     }
 
     len = 44;
@@ -51533,7 +51541,7 @@ loci_validate_of_port_desc_prop_optical_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 44) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_PROP_OPTICAL, LENGTH);
     }
 
 
@@ -51547,14 +51555,14 @@ static int
 loci_validate_of_port_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -51575,7 +51583,7 @@ static int
 loci_validate_of_port_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -51583,7 +51591,7 @@ loci_validate_of_port_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -51597,14 +51605,14 @@ static int
 loci_validate_of_port_mod_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 32) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -51625,14 +51633,14 @@ static int
 loci_validate_of_port_mod_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -51648,14 +51656,14 @@ static int
 loci_validate_of_port_mod_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -51681,7 +51689,7 @@ static int
 loci_validate_of_port_mod_prop_ethernet_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP_ETHERNET, SHORT);
     }
 
     len = 8;
@@ -51689,7 +51697,7 @@ loci_validate_of_port_mod_prop_ethernet_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP_ETHERNET, LENGTH);
     }
 
 
@@ -51703,14 +51711,14 @@ static int
 loci_validate_of_port_mod_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -51730,7 +51738,7 @@ static int
 loci_validate_of_port_mod_prop_optical_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP_OPTICAL, SHORT);
     }
 
     len = 24;
@@ -51738,7 +51746,7 @@ loci_validate_of_port_mod_prop_optical_OF_VERSION_1_4(uint8_t *data, int len, in
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_MOD_PROP_OPTICAL, LENGTH);
     }
 
 
@@ -51752,14 +51760,14 @@ static int
 loci_validate_of_port_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 80) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -51780,14 +51788,14 @@ static int
 loci_validate_of_port_stats_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -51813,7 +51821,7 @@ static int
 loci_validate_of_port_stats_prop_ethernet_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP_ETHERNET, SHORT);
     }
 
     len = 40;
@@ -51821,7 +51829,7 @@ loci_validate_of_port_stats_prop_ethernet_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 40) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP_ETHERNET, LENGTH);
     }
 
 
@@ -51835,14 +51843,14 @@ static int
 loci_validate_of_port_stats_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -51862,7 +51870,7 @@ static int
 loci_validate_of_port_stats_prop_optical_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 44) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP_OPTICAL, SHORT);
     }
 
     len = 44;
@@ -51870,7 +51878,7 @@ loci_validate_of_port_stats_prop_optical_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 44) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_PROP_OPTICAL, LENGTH);
     }
 
 
@@ -51884,14 +51892,14 @@ static int
 loci_validate_of_port_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -51912,7 +51920,7 @@ static int
 loci_validate_of_port_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -51920,7 +51928,7 @@ loci_validate_of_port_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATS_REQUEST, LENGTH);
     }
 
 
@@ -51934,14 +51942,14 @@ static int
 loci_validate_of_port_status_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 56) {
-        return -1;
+        VALIDATOR_FAIL(OF_PORT_STATUS, LENGTH);
     }
 
     len = wire_len;
@@ -51957,14 +51965,14 @@ static int
 loci_validate_of_queue_desc_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 8, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC, LENGTH);
     }
 
     len = wire_len;
@@ -51985,14 +51993,14 @@ static int
 loci_validate_of_queue_desc_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -52018,14 +52026,14 @@ static int
 loci_validate_of_queue_desc_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -52047,14 +52055,14 @@ static int
 loci_validate_of_queue_desc_prop_bsn_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_BSN, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_BSN, LENGTH);
     }
 
     len = wire_len;
@@ -52076,14 +52084,14 @@ static int
 loci_validate_of_queue_desc_prop_bsn_queue_name_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_BSN_QUEUE_NAME, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_BSN_QUEUE_NAME, LENGTH);
     }
 
     len = wire_len;
@@ -52099,7 +52107,7 @@ static int
 loci_validate_of_queue_desc_prop_max_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_MAX_RATE, SHORT);
     }
 
     len = 8;
@@ -52107,7 +52115,7 @@ loci_validate_of_queue_desc_prop_max_rate_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_MAX_RATE, LENGTH);
     }
 
 
@@ -52121,7 +52129,7 @@ static int
 loci_validate_of_queue_desc_prop_min_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_MIN_RATE, SHORT);
     }
 
     len = 8;
@@ -52129,7 +52137,7 @@ loci_validate_of_queue_desc_prop_min_rate_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_PROP_MIN_RATE, LENGTH);
     }
 
 
@@ -52143,14 +52151,14 @@ static int
 loci_validate_of_queue_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -52171,7 +52179,7 @@ static int
 loci_validate_of_queue_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -52179,7 +52187,7 @@ loci_validate_of_queue_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -52193,14 +52201,14 @@ static int
 loci_validate_of_queue_op_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_OP_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -52216,14 +52224,14 @@ static int
 loci_validate_of_queue_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -52249,14 +52257,14 @@ static int
 loci_validate_of_queue_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -52276,7 +52284,7 @@ static int
 loci_validate_of_queue_prop_max_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MAX_RATE, SHORT);
     }
 
     len = 16;
@@ -52284,7 +52292,7 @@ loci_validate_of_queue_prop_max_rate_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MAX_RATE, LENGTH);
     }
 
 
@@ -52298,7 +52306,7 @@ static int
 loci_validate_of_queue_prop_min_rate_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, SHORT);
     }
 
     len = 16;
@@ -52306,7 +52314,7 @@ loci_validate_of_queue_prop_min_rate_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_PROP_MIN_RATE, LENGTH);
     }
 
 
@@ -52320,14 +52328,14 @@ static int
 loci_validate_of_queue_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 48) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_ENTRY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 48) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_ENTRY, LENGTH);
     }
 
     len = wire_len;
@@ -52348,14 +52356,14 @@ static int
 loci_validate_of_queue_stats_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -52377,14 +52385,14 @@ static int
 loci_validate_of_queue_stats_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -52404,14 +52412,14 @@ static int
 loci_validate_of_queue_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -52432,7 +52440,7 @@ static int
 loci_validate_of_queue_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, SHORT);
     }
 
     len = 24;
@@ -52440,7 +52448,7 @@ loci_validate_of_queue_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_QUEUE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -52454,14 +52462,14 @@ static int
 loci_validate_of_requestforward_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_REQUESTFORWARD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_REQUESTFORWARD, LENGTH);
     }
 
     len = wire_len;
@@ -52477,14 +52485,14 @@ static int
 loci_validate_of_role_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -52506,14 +52514,14 @@ static int
 loci_validate_of_role_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -52533,7 +52541,7 @@ static int
 loci_validate_of_role_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REPLY, SHORT);
     }
 
     len = 24;
@@ -52541,7 +52549,7 @@ loci_validate_of_role_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REPLY, LENGTH);
     }
 
 
@@ -52555,7 +52563,7 @@ static int
 loci_validate_of_role_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST, SHORT);
     }
 
     len = 24;
@@ -52563,7 +52571,7 @@ loci_validate_of_role_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST, LENGTH);
     }
 
 
@@ -52577,14 +52585,14 @@ static int
 loci_validate_of_role_request_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_REQUEST_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -52600,14 +52608,14 @@ static int
 loci_validate_of_role_status_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_STATUS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_ROLE_STATUS, LENGTH);
     }
 
     len = wire_len;
@@ -52628,7 +52636,7 @@ static int
 loci_validate_of_set_config_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, SHORT);
     }
 
     len = 12;
@@ -52636,7 +52644,7 @@ loci_validate_of_set_config_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SET_CONFIG, LENGTH);
     }
 
 
@@ -52650,14 +52658,14 @@ static int
 loci_validate_of_switch_config_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_SWITCH_CONFIG_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -52673,7 +52681,7 @@ static int
 loci_validate_of_table_desc_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_DESC, SHORT);
     }
 
     len = 8;
@@ -52681,7 +52689,7 @@ loci_validate_of_table_desc_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_DESC, LENGTH);
     }
 
 
@@ -52695,14 +52703,14 @@ static int
 loci_validate_of_table_desc_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_DESC_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_DESC_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -52723,7 +52731,7 @@ static int
 loci_validate_of_table_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_DESC_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -52731,7 +52739,7 @@ loci_validate_of_table_desc_stats_request_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_DESC_STATS_REQUEST, LENGTH);
     }
 
 
@@ -52745,14 +52753,14 @@ static int
 loci_validate_of_table_feature_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -52806,14 +52814,14 @@ static int
 loci_validate_of_table_feature_prop_apply_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -52834,14 +52842,14 @@ static int
 loci_validate_of_table_feature_prop_apply_actions_miss_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_ACTIONS_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -52862,14 +52870,14 @@ static int
 loci_validate_of_table_feature_prop_apply_setfield_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD, LENGTH);
     }
 
     len = wire_len;
@@ -52890,14 +52898,14 @@ static int
 loci_validate_of_table_feature_prop_apply_setfield_miss_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_APPLY_SETFIELD_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -52918,14 +52926,14 @@ static int
 loci_validate_of_table_feature_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -52945,14 +52953,14 @@ static int
 loci_validate_of_table_feature_prop_experimenter_miss_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -52972,14 +52980,14 @@ static int
 loci_validate_of_table_feature_prop_instructions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -53000,14 +53008,14 @@ static int
 loci_validate_of_table_feature_prop_instructions_miss_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_INSTRUCTIONS_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -53028,14 +53036,14 @@ static int
 loci_validate_of_table_feature_prop_match_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_MATCH, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_MATCH, LENGTH);
     }
 
     len = wire_len;
@@ -53056,14 +53064,14 @@ static int
 loci_validate_of_table_feature_prop_next_tables_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES, LENGTH);
     }
 
     len = wire_len;
@@ -53084,14 +53092,14 @@ static int
 loci_validate_of_table_feature_prop_next_tables_miss_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_NEXT_TABLES_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -53112,14 +53120,14 @@ static int
 loci_validate_of_table_feature_prop_table_sync_from_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_TABLE_SYNC_FROM, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_TABLE_SYNC_FROM, LENGTH);
     }
 
     len = wire_len;
@@ -53140,14 +53148,14 @@ static int
 loci_validate_of_table_feature_prop_wildcards_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WILDCARDS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WILDCARDS, LENGTH);
     }
 
     len = wire_len;
@@ -53168,14 +53176,14 @@ static int
 loci_validate_of_table_feature_prop_write_actions_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS, LENGTH);
     }
 
     len = wire_len;
@@ -53196,14 +53204,14 @@ static int
 loci_validate_of_table_feature_prop_write_actions_miss_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_ACTIONS_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -53224,14 +53232,14 @@ static int
 loci_validate_of_table_feature_prop_write_setfield_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD, LENGTH);
     }
 
     len = wire_len;
@@ -53252,14 +53260,14 @@ static int
 loci_validate_of_table_feature_prop_write_setfield_miss_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD_MISS, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURE_PROP_WRITE_SETFIELD_MISS, LENGTH);
     }
 
     len = wire_len;
@@ -53280,14 +53288,14 @@ static int
 loci_validate_of_table_features_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 0, &wire_len);
     if (wire_len > len || wire_len < 64) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES, LENGTH);
     }
 
     len = wire_len;
@@ -53308,14 +53316,14 @@ static int
 loci_validate_of_table_features_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -53331,14 +53339,14 @@ static int
 loci_validate_of_table_features_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -53359,14 +53367,14 @@ static int
 loci_validate_of_table_features_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REQUEST, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_FEATURES_STATS_REQUEST, LENGTH);
     }
 
     len = wire_len;
@@ -53387,14 +53395,14 @@ static int
 loci_validate_of_table_mod_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD, LENGTH);
     }
 
     len = wire_len;
@@ -53415,14 +53423,14 @@ static int
 loci_validate_of_table_mod_failed_error_msg_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_FAILED_ERROR_MSG, LENGTH);
     }
 
     len = wire_len;
@@ -53438,14 +53446,14 @@ static int
 loci_validate_of_table_mod_prop_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP, LENGTH);
     }
 
     len = wire_len;
@@ -53465,7 +53473,7 @@ static int
 loci_validate_of_table_mod_prop_eviction_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP_EVICTION, SHORT);
     }
 
     len = 8;
@@ -53473,7 +53481,7 @@ loci_validate_of_table_mod_prop_eviction_OF_VERSION_1_4(uint8_t *data, int len,
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP_EVICTION, LENGTH);
     }
 
 
@@ -53487,14 +53495,14 @@ static int
 loci_validate_of_table_mod_prop_experimenter_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP_EXPERIMENTER, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 12) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP_EXPERIMENTER, LENGTH);
     }
 
     len = wire_len;
@@ -53514,7 +53522,7 @@ static int
 loci_validate_of_table_mod_prop_vacancy_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP_VACANCY, SHORT);
     }
 
     len = 8;
@@ -53522,7 +53530,7 @@ loci_validate_of_table_mod_prop_vacancy_OF_VERSION_1_4(uint8_t *data, int len, i
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_MOD_PROP_VACANCY, LENGTH);
     }
 
 
@@ -53536,7 +53544,7 @@ static int
 loci_validate_of_table_stats_entry_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 24) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_ENTRY, SHORT);
     }
 
     len = 24;
@@ -53552,14 +53560,14 @@ static int
 loci_validate_of_table_stats_reply_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, SHORT);
     }
 
 
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REPLY, LENGTH);
     }
 
     len = wire_len;
@@ -53580,7 +53588,7 @@ static int
 loci_validate_of_table_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, SHORT);
     }
 
     len = 16;
@@ -53588,7 +53596,7 @@ loci_validate_of_table_stats_request_OF_VERSION_1_4(uint8_t *data, int len, int
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 16) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATS_REQUEST, LENGTH);
     }
 
 
@@ -53602,7 +53610,7 @@ static int
 loci_validate_of_table_status_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATUS, SHORT);
     }
 
     len = 28;
@@ -53610,7 +53618,7 @@ loci_validate_of_table_status_OF_VERSION_1_4(uint8_t *data, int len, int *out_le
     uint16_t wire_len;
     buf_u16_get(data + 2, &wire_len);
     if (wire_len > len || wire_len < 28) {
-        return -1;
+        VALIDATOR_FAIL(OF_TABLE_STATUS, LENGTH);
     }
 
 
@@ -53624,7 +53632,7 @@ static int
 loci_validate_of_uint32_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 4) {
-        return -1;
+        VALIDATOR_FAIL(OF_UINT32, SHORT);
     }
 
     len = 4;
@@ -53640,7 +53648,7 @@ static int
 loci_validate_of_uint64_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 8) {
-        return -1;
+        VALIDATOR_FAIL(OF_UINT64, SHORT);
     }
 
     len = 8;
@@ -53656,7 +53664,7 @@ static int
 loci_validate_of_uint8_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 {
     if (len < 1) {
-        return -1;
+        VALIDATOR_FAIL(OF_UINT8, SHORT);
     }
 
     len = 1;
@@ -53669,15 +53677,15 @@ loci_validate_of_uint8_OF_VERSION_1_4(uint8_t *data, int len, int *out_len)
 }
 
 
-int
-of_validate_message(of_message_t msg, int len)
+static int
+validate_message(of_message_t msg, int len)
 {
     of_version_t version;
     if (len < OF_MESSAGE_MIN_LENGTH ||
         len != of_message_length_get(msg)) {
         VALIDATOR_LOG("message length %d != %d", len,
                       of_message_length_get(msg));
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, LENGTH);
     }
 
     version = of_message_version_get(msg);
@@ -53695,6 +53703,23 @@ of_validate_message(of_message_t msg, int len)
         return loci_validate_of_header_OF_VERSION_1_4(msg, len, &out_len);
     default:
         VALIDATOR_LOG("Bad version %d", version);
-        return -1;
+        VALIDATOR_FAIL(OF_HEADER, VERSION);
+    }
+}
+
+int
+of_validate_message(of_message_t msg, int len)
+{
+    int rv;
+
+    rv = validate_message(msg, len);
+    if (rv < 0) {
+        LOCI_TRACE(validate_message_fail,
+                   len >= 1 ? of_message_version_get(msg) : 0,
+                   len >= OF_MESSAGE_MIN_LENGTH ? of_message_type_get(msg) : -1,
+                   len,
+                   len >= OF_MESSAGE_MIN_LENGTH ? of_message_xid_get(msg) : 0);
     }
+
+    return rv;
 }
@@ -137,6 +137,7 @@ of_list_bsn_interface_new(of_version_t version)
     }
 
     of_list_bsn_interface_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
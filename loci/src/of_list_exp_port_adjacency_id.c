@@ -139,6 +139,7 @@ of_list_exp_port_adjacency_id_new(of_version_t version)
     }
 
     of_list_exp_port_adjacency_id_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
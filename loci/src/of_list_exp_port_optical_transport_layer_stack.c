@@ -139,6 +139,7 @@ of_list_exp_port_optical_transport_layer_stack_new(of_version_t version)
     }
 
     of_list_exp_port_optical_transport_layer_stack_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
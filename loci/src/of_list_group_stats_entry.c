@@ -139,6 +139,7 @@ of_list_group_stats_entry_new(of_version_t version)
     }
 
     of_list_group_stats_entry_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -137,6 +137,7 @@ of_list_port_desc_prop_optical_transport_new(of_version_t version)
     }
 
     of_list_port_desc_prop_optical_transport_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
@@ -141,6 +141,7 @@ of_list_queue_prop_new(of_version_t version)
     }
 
     of_list_queue_prop_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
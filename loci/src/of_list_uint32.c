@@ -137,6 +137,7 @@ of_list_uint32_new(of_version_t version)
     }
 
     of_list_uint32_init(obj, version, bytes, 0);
+    LOCI_OBJECT_NEW_HOOK(obj);
 
     return obj;
 }
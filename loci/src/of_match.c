@@ -14,6 +14,7 @@
 
 #include "loci_log.h"
 #include <loci/loci.h>
+#include <loci/loci_trace.h>
 
 /**
  * @brief Return the index (used as the WC field in 1.0 match) given the mask
@@ -4512,24 +4513,8 @@ of_match_v3_to_match(of_match_v3_t *src, of_match_t *dst)
     return OF_ERROR_NONE;
 }
 
-/**
- * Serialize a match structure according to the version passed
- * @param version The version to use for serialization protocol
- * @param match Pointer to the structure to serialize
- * @param octets Pointer to an octets object to fill out
- *
- * A buffer is allocated using normal internal ALLOC/FREE semantics
- * and pointed to by the octets object.  The length of the resulting
- * serialization is in octets->bytes.
- *
- * For 1.2 matches, returns the padded serialized structure
- *
- * Note that FREE must be called on octets->data when processing of
- * the object is complete.
- */
-
-int
-of_match_serialize(of_version_t version, of_match_t *match, of_octets_t *octets)
+static int
+match_serialize(of_version_t version, of_match_t *match, of_octets_t *octets)
 {
     int rv;
 
@@ -4637,6 +4622,33 @@ of_match_serialize(of_version_t version, of_match_t *match, of_octets_t *octets)
     return OF_ERROR_NONE;
 }
 
+/**
+ * Serialize a match structure according to the version passed
+ * @param version The version to use for serialization protocol
+ * @param match Pointer to the structure to serialize
+ * @param octets Pointer to an octets object to fill out
+ *
+ * A buffer is allocated using normal internal ALLOC/FREE semantics
+ * and pointed to by the octets object.  The length of the resulting
+ * serialization is in octets->bytes.
+ *
+ * For 1.2 matches, returns the padded serialized structure
+ *
+ * Note that FREE must be called on octets->data when processing of
+ * the object is complete.
+ */
+
+int
+of_match_serialize(of_version_t version, of_match_t *match, of_octets_t *octets)
+{
+    int rv;
+
+    rv = match_serialize(version, match, octets);
+    LOCI_TRACE(match_serialize, version, rv < 0 ? 0 : octets->bytes, rv);
+
+    return rv;
+}
+
 /**
  * Deserialize a match structure according to the version passed
  * @param version The version to use for deserialization protocol
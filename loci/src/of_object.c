@@ -12,8 +12,11 @@
  ****************************************************************/
 
 #include "loci_log.h"
+#include "loci_int.h"
 #include <loci/loci.h>
 #include <loci/loci_validator.h>
+#include <loci/loci_stats.h>
+#include <loci/loci_trace.h>
 
 /**
  * Create a generic new object and possibly underlying wire buffer
@@ -62,6 +65,9 @@ of_object_delete(of_object_t *obj)
         return;
     }
 
+    LOCI_STATS_FREE(obj->object_id);
+    LOCI_TRACE_OBJECT(object_delete, obj);
+
     if (obj->parent == NULL) {
         of_wire_buffer_free(obj->wbuf);
     }
@@ -96,6 +102,8 @@ of_object_dup(of_object_t *src)
 
     init_fn = of_object_init_map[src->object_id];
     init_fn(dst, src->version, src->length, 0);
+    LOCI_STATS_OBJECT_NEW(dst);
+    LOCI_TRACE_OBJECT(object_new, dst);
 
     MEMCPY(OF_OBJECT_BUFFER_INDEX(dst, 0),
            OF_OBJECT_BUFFER_INDEX(src, 0),
@@ -138,6 +146,9 @@ of_object_new_from_message(of_message_t msg, int len)
 
     of_header_wire_object_id_get(obj, &object_id);
     of_object_init_map[object_id](obj, version, len, 0);
+    LOCI_STATS_PARSE(object_id);
+    LOCI_TRACE_OBJECT(new_from_message, obj);
+    LOCI_STATS_ALLOC(object_id, sizeof(*obj) + sizeof(of_wire_buffer_t));
 
     return obj;
 }
@@ -184,6 +195,85 @@ of_object_new_from_message_preallocated(of_object_storage_t *storage,
 
     of_header_wire_object_id_get(obj, &object_id);
     of_object_init_map[object_id](obj, version, len, 0);
+    LOCI_STATS_PARSE(object_id);
+    LOCI_TRACE_OBJECT(new_from_message, obj);
+
+    return obj;
+}
+
+/**
+ * Build an object in a caller provided buffer
+ *
+ * @param storage Pointer to an uninitialized of_object_storage_t
+ * @param object_id The class of the object
+ * @param version The wire version to use for the object
+ * @param buf Pointer to the buffer, such as a slot of a send ring
+ * @param bytes Capacity of buf
+ * @returns Pointer to an initialized of_object_t, or NULL if the
+ * class is not in version or its fixed part does not fit in buf
+ *
+ * The object is initialized as by of_<cls>_new, but its wire buffer is
+ * buf: the accessors write the wire bytes of the object in place and
+ * setters that would grow the object past bytes return
+ * OF_ERROR_RESOURCE.  Once built, the message is the first obj->length
+ * bytes of buf.
+ *
+ * The lifetime of the returned object is the minimum of the lifetimes of
+ * 'buf' and 'storage'.  It must not be passed to of_object_delete.
+ */
+
+of_object_t *
+of_object_new_preallocated(of_object_storage_t *storage,
+                           of_object_id_t object_id, of_version_t version,
+                           uint8_t *buf, int bytes)
+{
+    of_object_t *obj = &storage->obj;
+    of_wire_buffer_t *wbuf = &storage->wbuf;
+    int len;
+
+    memset(storage, 0, sizeof(*storage));
+
+    if (!OF_VERSION_OKAY(version) ||
+        object_id < 0 || object_id >= OF_OBJECT_COUNT) {
+        return NULL;
+    }
+
+    len = of_object_fixed_len[version][object_id];
+    if (len < 0 || len > bytes) {
+        return NULL;
+    }
+
+    obj->wbuf = wbuf;
+    wbuf->buf = buf;
+    wbuf->alloc_bytes = bytes;
+
+    of_object_init_map[object_id](obj, version, len, 0);
+    LOCI_TRACE_OBJECT(object_new, obj);
+    of_object_wire_type_set(obj);
+    of_object_wire_length_set(obj, obj->length);
+
+    /* Initialize match TLV for 1.2 as of_<cls>_new does */
+    if (version >= OF_VERSION_1_2) {
+        switch (object_id) {
+        case OF_AGGREGATE_STATS_REQUEST:
+        case OF_FLOW_MOD:
+        case OF_FLOW_ADD:
+        case OF_FLOW_DELETE:
+        case OF_FLOW_DELETE_STRICT:
+        case OF_FLOW_MODIFY:
+        case OF_FLOW_MODIFY_STRICT:
+        case OF_FLOW_REMOVED:
+        case OF_FLOW_STATS_ENTRY:
+        case OF_FLOW_STATS_REQUEST:
+            of_object_u16_set(obj, 48 + 2, 4);
+            break;
+        case OF_PACKET_IN:
+            of_object_u16_set(obj, 16 + 2, 4);
+            break;
+        default:
+            break;
+        }
+    }
 
     return obj;
 }
@@ -359,6 +449,7 @@ of_list_append_bind(of_object_t *parent, of_object_t *child)
     }
 
     if (!of_object_can_grow(parent, parent->length + child->length)) {
+        LOCI_STATS_LIST_APPEND_FAILURE(parent->object_id);
         return OF_ERROR_RESOURCE;
     }
 
@@ -393,6 +484,7 @@ of_list_append(of_object_t *list, of_object_t *item)
     new_len = list->length + item->length;
 
     if (!of_object_can_grow(list, new_len)) {
+        LOCI_STATS_LIST_APPEND_FAILURE(list->object_id);
         return OF_ERROR_RESOURCE;
     }
 
@@ -12,6 +12,8 @@
  ****************************************************************/
 
 #include <loci/loci.h>
+#include <loci/loci_stats.h>
+#include <loci/loci_trace.h>
 
 #if 0
 static of_match_v1_t *
@@ -80,30 +82,28 @@ of_wire_buffer_of_match_set(of_object_t *obj, int offset,
 #endif
 
 /**
- * Replace data in the data buffer, possibly with a new
- * length or appending to buffer.
+ * Resize a span of the data buffer, moving the bytes after it.
  *
  * @param wbuf The wire buffer being updated.
- * @param offset The start point of the update
- * @param old_len The number of bytes being replaced
- * @param data Source of bytes to write into the buffer
- * @param new_len The number of bytes to write
+ * @param offset The start point of the span
+ * @param old_len The current length of the span
+ * @param new_len The new length of the span
+ * @returns Pointer to the start of the span in the buffer
  *
- * The buffer may grow for this operation.  Current byte count
- * is pre-grow for the replace.
+ * The buffer may grow for this operation.  The contents of the span
+ * are left to the caller: bytes beyond the old length are not
+ * initialized.
  *
  * The current byte count for the buffer is updated.
- * 
  */
 
-void
-of_wire_buffer_replace_data(of_wire_buffer_t *wbuf, 
-                            int offset, 
-                            int old_len,
-                            uint8_t *data,
-                            int new_len)
+uint8_t *
+of_wire_buffer_resize_data(of_wire_buffer_t *wbuf,
+                           int offset,
+                           int old_len,
+                           int new_len)
 {
-    int bytes;
+    int bytes = 0;
     uint8_t *src_ptr, *dst_ptr;
     int cur_bytes;
 
@@ -113,6 +113,7 @@ of_wire_buffer_replace_data(of_wire_buffer_t *wbuf,
 
     /* Doesn't make sense; mismatch in current buffer info */
     LOCI_ASSERT(old_len + offset <= wbuf->current_bytes);
+    LOCI_ASSERT(cur_bytes + (new_len - old_len) <= wbuf->alloc_bytes);
 
     wbuf->current_bytes += (new_len - old_len); // may decrease size
 
@@ -123,9 +124,40 @@ of_wire_buffer_replace_data(of_wire_buffer_t *wbuf,
         bytes = cur_bytes - (offset + old_len);
         MEMMOVE(dst_ptr, src_ptr, bytes);
     }
-
-    dst_ptr = &wbuf->buf[offset];
-    MEMCPY(dst_ptr, data, new_len);
+    LOCI_STATS_REPLACE_DATA(bytes);
+    LOCI_TRACE(replace_data, offset, old_len, new_len, bytes);
 
     LOCI_ASSERT(wbuf->current_bytes == cur_bytes + (new_len - old_len));
+
+    return &wbuf->buf[offset];
+}
+
+/**
+ * Replace data in the data buffer, possibly with a new
+ * length or appending to buffer.
+ *
+ * @param wbuf The wire buffer being updated.
+ * @param offset The start point of the update
+ * @param old_len The number of bytes being replaced
+ * @param data Source of bytes to write into the buffer
+ * @param new_len The number of bytes to write
+ *
+ * The buffer may grow for this operation.  Current byte count
+ * is pre-grow for the replace.
+ *
+ * The current byte count for the buffer is updated.
+ * 
+ */
+
+void
+of_wire_buffer_replace_data(of_wire_buffer_t *wbuf, 
+                            int offset, 
+                            int old_len,
+                            uint8_t *data,
+                            int new_len)
+{
+    uint8_t *dst_ptr;
+
+    dst_ptr = of_wire_buffer_resize_data(wbuf, offset, old_len, new_len);
+    MEMCPY(dst_ptr, data, new_len);
 }
@@ -0,0 +1,131 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file locibench.h
+ *
+ * Common declarations for the LOCI benchmarks
+ *
+ * Each result is printed on one line of value/unit pairs, in the
+ * format of Go benchmarks so existing tools can compare runs:
+ *
+ *   <name> <iterations> <N> ns/op <N> B/op <N> allocs/op <N> out-B/op
+ *
+ * B/op and allocs/op count the heap allocations made while timing;
+ * out-B/op is the size of the output the benchmark produces.
+ */
+
+#if !defined(_LOCIBENCH_H_)
+#define _LOCIBENCH_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <loci/loci.h>
+
+/* Default iteration count; override with -n */
+#define LOCIBENCH_DEFAULT_ITERATIONS 100000
+
+extern int locibench_iterations;
+
+static inline uint64_t
+locibench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * Start timing a benchmark
+ * @returns The start time to pass to locibench_report
+ *
+ * Also resets the allocation counters reported by locibench_report.
+ */
+extern uint64_t locibench_start(void);
+
+/**
+ * Report one benchmark result
+ * @param name Benchmark name
+ * @param iterations Number of operations timed
+ * @param start Value returned by locibench_start
+ * @param bytes Output bytes per operation, or 0 if not meaningful
+ */
+extern void locibench_report(const char *name, int iterations,
+                             uint64_t start, uint64_t bytes);
+
+/* Sink that defeats dead code elimination of benchmark results */
+extern volatile uint64_t locibench_sink;
+
+#define LOCIBENCH_TEXT_BUF_SIZE 8192
+
+/**
+ * Text output for loci_writer_f based functions
+ *
+ * Output wraps around in the buffer; only its size is kept.
+ */
+typedef struct locibench_text_s {
+    char data[LOCIBENCH_TEXT_BUF_SIZE];
+    int len;
+    uint64_t total;
+} locibench_text_t;
+
+extern int locibench_text_writer(void *cookie, const char *fmt, ...);
+
+static inline void
+locibench_text_reset(locibench_text_t *tb)
+{
+    tb->len = 0;
+    tb->total = 0;
+}
+
+/* Bytes written since the last reset */
+static inline uint64_t
+locibench_text_bytes(locibench_text_t *tb)
+{
+    return tb->total + tb->len;
+}
+
+/**
+ * An entry of the data file corpus
+ */
+typedef struct locibench_data_s {
+    const char *name;           /* Data file, e.g. "of13/packet_in" */
+    of_version_t version;
+    of_object_t *(*build)(void);
+    const uint8_t *binary;      /* Expected wire encoding */
+    int len;
+} locibench_data_t;
+
+/* Terminated by an entry with a NULL name */
+extern const locibench_data_t locibench_data[];
+
+/* Benchmark groups, one per source file */
+extern int bench_capture(void);
+extern int bench_checksum(void);
+extern int bench_classifier(void);
+extern int bench_columns(void);
+extern int bench_corpus(void);
+extern int bench_counter(void);
+extern int bench_export(void);
+extern int bench_gentable(void);
+extern int bench_hash(void);
+extern int bench_list(void);
+extern int bench_match(void);
+extern int bench_packet(void);
+extern int bench_parse(void);
+extern int bench_pdu(void);
+extern int bench_peek(void);
+extern int bench_program(void);
+extern int bench_random(void);
+extern int bench_sdwn(void);
+extern int bench_template(void);
+extern int bench_tlv(void);
+
+#endif /* _LOCIBENCH_H_ */
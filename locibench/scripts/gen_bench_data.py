@@ -0,0 +1,54 @@
+# Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University
+# Copyright (c) 2011, 2012 Open Networking Foundation
+# Copyright (c) 2012, 2013 Big Switch Networks, Inc.
+# See the file LICENSE.loci which should have been included in the source distribution
+
+"""Generate src/bench_data.c from locitest/src/test_data.c.
+
+test_data.c has a test for each data file of loxigen, holding the
+message as bytes and the code that builds it.  Each becomes a
+locibench_data_t entry with the same bytes and a builder running the
+same code.  Run through "make bench-data".
+"""
+
+import os
+import re
+
+BENCH = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+src = open(os.path.join(BENCH, '../locitest/src/test_data.c')).read()
+blocks = re.findall(r'/\* Generated from (\S+)\.data \*/\nstatic int\ntest_(\w+)\(void\) \{\n    uint8_t binary\[\] = \{\n(.*?)\n    \};\n\n    of_object_t \*obj;\n\n(.*?)\n    if \(sizeof\(binary\)', src, re.S)
+vers = {'of10': 'OF_VERSION_1_0', 'of11': 'OF_VERSION_1_1', 'of12': 'OF_VERSION_1_2',
+        'of13': 'OF_VERSION_1_3', 'of14': 'OF_VERSION_1_4'}
+out = []
+out.append('''/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ *
+ * Generated by scripts/gen_bench_data.py from locitest/src/test_data.c;
+ * run "make bench-data" after changing either.
+ *
+ * Data file corpus for the benchmarks.
+ */
+
+/* The generated builders don't check accessor results */
+#define DISABLE_WARN_UNUSED_RESULT
+#include <locibench/locibench.h>
+''')
+for path, name, binary, code in blocks:
+    lines = [l.strip() for l in binary.strip().split('\n')]
+    lines = [l for l in lines if l]
+    out.append('/* Generated from %s.data */' % path)
+    out.append('static const uint8_t %s_binary[] = {' % name)
+    for l in lines:
+        out.append('    ' + l.rstrip())
+    out.append('};\n')
+    out.append('static of_object_t *\n%s_build(void)\n{\n    of_object_t *obj;\n\n%s\n    return obj;\n}\n' % (name, code.rstrip('\n')))
+out.append('const locibench_data_t locibench_data[] = {')
+for path, name, binary, code in blocks:
+    out.append('    { "%s", %s, %s_build, %s_binary, sizeof(%s_binary) },' % (path, vers[path.split('/')[0]], name, name, name))
+out.append('    { NULL },\n};\n')
+open(os.path.join(BENCH, 'src/bench_data.c'), 'w').write('\n'.join(out))
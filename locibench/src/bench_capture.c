@@ -0,0 +1,179 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_capture.c
+ *
+ * Capture file write and replay, per record, over a workload of
+ * WORKLOAD random messages of every version:
+ *
+ *   write    loci_capture_write of one message, including flushes
+ *   index    building and writing the index on close
+ *   open     opening the capture with its index (per capture)
+ *   replay   loci_capture_object on every record in order
+ *   by_type  loci_capture_by_type of a random message type
+ *
+ * The capture is written to $TMPDIR (default /tmp) and removed after
+ * the run.
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_capture.h>
+#include <loci/loci_random.h>
+#include <unistd.h>
+
+#define WORKLOAD 4096
+
+static struct {
+    uint8_t *msg;
+    int len;
+} workload[WORKLOAD];
+
+static int
+workload_init(void)
+{
+    loci_random_t r;
+    of_object_t *obj;
+    int i;
+
+    loci_random_init(&r, NULL);
+    for (i = 0; i < WORKLOAD; i++) {
+        obj = loci_random_message_new(&r, OF_VERSION_1_0 + i % 5);
+        if (obj == NULL) {
+            loci_random_cleanup(&r);
+            return -1;
+        }
+        workload[i].len = obj->length;
+        workload[i].msg = MALLOC(obj->length);
+        MEMCPY(workload[i].msg, OF_OBJECT_TO_MESSAGE(obj), obj->length);
+        of_object_delete(obj);
+    }
+    loci_random_cleanup(&r);
+
+    return 0;
+}
+
+static void
+workload_free(void)
+{
+    int i;
+
+    for (i = 0; i < WORKLOAD; i++) {
+        FREE(workload[i].msg);
+    }
+}
+
+static int
+bench_write(const char *path)
+{
+    loci_capture_writer_t w;
+    uint64_t start, bytes = 0;
+    int i, n = locibench_iterations;
+
+    if (loci_capture_writer_open(&w, path, 0) < 0) {
+        return -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if (loci_capture_write(&w, i, i & 7, workload[i % WORKLOAD].msg,
+                               workload[i % WORKLOAD].len) < 0) {
+            loci_capture_writer_close(&w);
+            return -1;
+        }
+        bytes += LOCI_CAPTURE_RECORD_BYTES(workload[i % WORKLOAD].len);
+    }
+    if (loci_capture_writer_flush(&w) < 0) {
+        loci_capture_writer_close(&w);
+        return -1;
+    }
+    locibench_report("capture/write", n, start, bytes / n);
+
+    start = locibench_start();
+    if (loci_capture_writer_close(&w) < 0) {
+        return -1;
+    }
+    locibench_report("capture/index", n, start, 0);
+
+    return 0;
+}
+
+static int
+bench_read(const char *path)
+{
+    loci_capture_t cap;
+    loci_capture_range_t range;
+    of_object_storage_t storage;
+    const of_object_id_t *ids;
+    of_object_t *obj;
+    loci_random_t r;
+    uint64_t start;
+    int i, count, n;
+
+    n = locibench_iterations / 100 + 1;
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if (loci_capture_open(&cap, path) < 0) {
+            return -1;
+        }
+        locibench_sink += loci_capture_count(&cap);
+        loci_capture_close(&cap);
+    }
+    locibench_report("capture/open", n, start, 0);
+
+    if (loci_capture_open(&cap, path) < 0) {
+        return -1;
+    }
+    n = loci_capture_count(&cap);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if ((obj = loci_capture_object(&cap, i, &storage)) == NULL) {
+            loci_capture_close(&cap);
+            return -1;
+        }
+        locibench_sink += obj->object_id;
+    }
+    locibench_report("capture/replay", n, start, 0);
+
+    loci_random_init(&r, NULL);
+    ids = loci_random_message_ids(OF_VERSION_1_3, &count);
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        range = loci_capture_by_type(&cap, ids[loci_random_range(&r, count)]);
+        locibench_sink += range.count;
+    }
+    locibench_report("capture/by_type", n, start, 0);
+    loci_random_cleanup(&r);
+
+    loci_capture_close(&cap);
+    return 0;
+}
+
+int
+bench_capture(void)
+{
+    const char *dir = getenv("TMPDIR");
+    char path[256], idx_path[sizeof(path) + 4];
+    int rv;
+
+    snprintf(path, sizeof(path), "%s/locibench-capture-%d",
+             dir != NULL ? dir : "/tmp", (int)getpid());
+    snprintf(idx_path, sizeof(idx_path), "%s.idx", path);
+
+    if (workload_init() < 0) {
+        workload_free();
+        return -1;
+    }
+    rv = bench_write(path);
+    if (rv == 0) {
+        rv = bench_read(path);
+    }
+    unlink(path);
+    unlink(idx_path);
+    workload_free();
+
+    return rv;
+}
@@ -0,0 +1,117 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_checksum.c
+ *
+ * BSN flow checksums kept from flow_mods, in a table of 1024 buckets:
+ *
+ *   checksum/add            loci_flow_checksum_apply of a 1.3 flow_add
+ *                           of a new flow, one op per flow
+ *   checksum/modify         a 1.3 flow_modify_strict of one of them,
+ *                           which changes no cookie
+ *   checksum/delete_strict  a 1.3 flow_delete_strict of each flow
+ *   checksum/bucket_stats   loci_flow_checksum_bucket_stats_fill of the
+ *                           1024 buckets into a reply, one op per reply
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_flow_checksum.h>
+
+#define BUCKETS 1024
+
+static void
+match_flow(of_match_t *match, uint32_t i)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = OF_VERSION_1_3;
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.ipv4_dst = 0x0a000000 | i;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    match->fields.tcp_dst = 80;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+}
+
+/* Apply a flow_mod to each of n flows, returning -1 if one fails */
+#define FLOW_MOD_BENCH(cls, fc, name, n) do {                           \
+        of_object_t *obj;                                               \
+        of_match_t match;                                               \
+        uint64_t start;                                                 \
+        int i, rv = 0;                                                  \
+                                                                        \
+        if ((obj = cls##_new(OF_VERSION_1_3)) == NULL) {                \
+            return -1;                                                  \
+        }                                                               \
+        cls##_priority_set(obj, 100);                                   \
+        cls##_out_port_set(obj, OF_PORT_DEST_NONE);                     \
+        cls##_out_group_set(obj, OF_GROUP_ANY);                         \
+        start = locibench_start();                                      \
+        for (i = 0; i < (n) && rv == 0; i++) {                          \
+            match_flow(&match, i);                                      \
+            cls##_cookie_set(obj, (i + 1) * 0x9e3779b97f4a7c15ULL);     \
+            if ((rv = cls##_match_set(obj, &match)) == 0) {             \
+                rv = loci_flow_checksum_apply(fc, obj);                 \
+            }                                                           \
+        }                                                               \
+        locibench_report(name, n, start, 0);                            \
+        of_object_delete(obj);                                          \
+        if (rv < 0) {                                                   \
+            fprintf(stderr, "%s failed: %d\n", name, rv);               \
+            return -1;                                                  \
+        }                                                               \
+    } while (0)
+
+static int
+bench_flow_mods(loci_flow_checksum_t *fc, int n)
+{
+    FLOW_MOD_BENCH(of_flow_add, fc, "checksum/add", n);
+    FLOW_MOD_BENCH(of_flow_modify_strict, fc, "checksum/modify", n);
+    FLOW_MOD_BENCH(of_flow_delete_strict, fc, "checksum/delete_strict", n);
+
+    return 0;
+}
+
+int
+bench_checksum(void)
+{
+    loci_flow_checksum_t fc;
+    of_object_t *reply;
+    uint64_t start;
+    uint32_t bucket;
+    int i, n = locibench_iterations, rv;
+
+    if (loci_flow_checksum_init(&fc, 1, BUCKETS) < 0) {
+        return -1;
+    }
+    if ((rv = bench_flow_mods(&fc, n)) < 0) {
+        loci_flow_checksum_cleanup(&fc);
+        return rv;
+    }
+    if (loci_flow_checksum_count(&fc) != 0) {
+        fprintf(stderr, "checksum/delete_strict left %u flows\n",
+                loci_flow_checksum_count(&fc));
+        loci_flow_checksum_cleanup(&fc);
+        return -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if ((reply = of_bsn_flow_checksum_bucket_stats_reply_new(
+                 OF_VERSION_1_3)) == NULL) {
+            break;
+        }
+        bucket = 0;
+        locibench_sink += loci_flow_checksum_bucket_stats_fill(&fc, 0,
+                                                               &bucket, reply);
+        of_object_delete(reply);
+    }
+    locibench_report("checksum/bucket_stats", n, start, 0);
+    loci_flow_checksum_cleanup(&fc);
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_classifier.c
+ *
+ * Classifier over 10k and 1M flows mixing the masks of an L2 table,
+ * IPv4 routes of prefix lengths 16 to 32, ACLs and exact 5-tuples:
+ * 21 tuples in all.  Packets are made to hit a random flow.
+ *
+ *   classifier/<flows>/add          loci_classifier_add, per flow
+ *   classifier/<flows>/lookup/hot   1024 distinct packets, mostly
+ *                                   answered by the cache
+ *   classifier/<flows>/lookup/cold  65536 distinct packets, mostly
+ *                                   cache misses
+ *   classifier/<flows>/remove       loci_classifier_remove, per flow
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_classifier.h>
+
+#define HOT_PACKETS 1024
+#define COLD_PACKETS 65536
+
+enum {
+    FLOW_L2,
+    FLOW_ROUTE,
+    FLOW_ACL,
+    FLOW_5TUPLE,
+};
+
+/* A flow, small enough to keep a million of */
+typedef struct flow_s {
+    uint8_t kind;
+    uint8_t prefix_len;
+    uint16_t priority;
+    uint32_t src;
+    uint32_t dst;
+    uint16_t sport;
+    uint16_t dport;
+} flow_t;
+
+static const struct {
+    const char *name;
+    int count;
+} sizes[] = {
+    { "10k", 10000 },
+    { "1M", 1000000 },
+};
+
+static uint32_t seed = 1;
+
+static uint32_t
+rand32(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) | (seed << 16);
+}
+
+static void
+flow_random(flow_t *flow)
+{
+    uint32_t r = rand32() % 10;
+
+    MEMSET(flow, 0, sizeof(*flow));
+    flow->src = rand32();
+    flow->dst = rand32();
+    flow->sport = rand32();
+    flow->dport = rand32();
+    if (r < 2) {
+        flow->kind = FLOW_L2;
+        flow->priority = 100;
+    } else if (r < 6) {
+        flow->kind = FLOW_ROUTE;
+        flow->prefix_len = 16 + rand32() % 17;
+        flow->priority = 1000 + flow->prefix_len;
+    } else if (r < 8) {
+        flow->kind = FLOW_ACL;
+        flow->prefix_len = rand32() % 2 ? 24 : 32;
+        flow->priority = 5000;
+    } else {
+        flow->kind = FLOW_5TUPLE;
+        flow->priority = 6000;
+    }
+}
+
+static void
+flow_match(const flow_t *flow, of_match_t *match)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = OF_VERSION_1_3;
+
+    if (flow->kind == FLOW_L2) {
+        MEMCPY(match->fields.eth_dst.addr, &flow->dst, 4);
+        OF_MATCH_MASK_ETH_DST_EXACT_SET(match);
+        match->fields.vlan_vid = 0x1000 | (flow->sport & 0xfff);
+        OF_MATCH_MASK_VLAN_VID_EXACT_SET(match);
+        return;
+    }
+
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    if (flow->kind == FLOW_ROUTE) {
+        match->masks.ipv4_dst = ~0U << (32 - flow->prefix_len);
+        match->fields.ipv4_dst = flow->dst & match->masks.ipv4_dst;
+        return;
+    }
+
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.tcp_dst = flow->dport;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+    if (flow->kind == FLOW_ACL) {
+        match->masks.ipv4_src = ~0U << (32 - flow->prefix_len);
+        match->fields.ipv4_src = flow->src & match->masks.ipv4_src;
+        return;
+    }
+
+    match->fields.ipv4_src = flow->src;
+    OF_MATCH_MASK_IPV4_SRC_EXACT_SET(match);
+    match->fields.ipv4_dst = flow->dst;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    match->fields.tcp_src = flow->sport;
+    OF_MATCH_MASK_TCP_SRC_EXACT_SET(match);
+}
+
+/* A TCP/IPv4 packet hitting the flow */
+static void
+flow_packet(const flow_t *flow, of_match_fields_t *fields)
+{
+    MEMSET(fields, 0, sizeof(*fields));
+    fields->eth_type = 0x0800;
+    fields->vlan_vid = 0x1000 | (rand32() & 0xfff);
+    fields->ip_proto = 6;
+    fields->ipv4_src = rand32();
+    fields->ipv4_dst = rand32();
+    fields->tcp_src = rand32();
+    fields->tcp_dst = rand32();
+
+    switch (flow->kind) {
+    case FLOW_L2:
+        MEMCPY(fields->eth_dst.addr, &flow->dst, 4);
+        fields->vlan_vid = 0x1000 | (flow->sport & 0xfff);
+        break;
+    case FLOW_ROUTE:
+        fields->ipv4_dst = flow->dst;
+        break;
+    case FLOW_ACL:
+        fields->ipv4_src = flow->src;
+        fields->tcp_dst = flow->dport;
+        break;
+    default:
+        fields->ipv4_src = flow->src;
+        fields->ipv4_dst = flow->dst;
+        fields->tcp_src = flow->sport;
+        fields->tcp_dst = flow->dport;
+        break;
+    }
+}
+
+static int
+bench_lookup(loci_classifier_t *cls, const char *size_name,
+             const char *name_suffix, of_match_fields_t *packets, int count)
+{
+    char name[64];
+    uint64_t start;
+    int i, n = locibench_iterations;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if (loci_classifier_lookup(cls, 0, &packets[i % count]) == NULL) {
+            return -1;
+        }
+    }
+    snprintf(name, sizeof(name), "classifier/%s/lookup/%s", size_name,
+             name_suffix);
+    locibench_report(name, n, start, 0);
+
+    return 0;
+}
+
+static int
+bench_size(const char *size_name, int count)
+{
+    loci_classifier_t cls;
+    of_match_fields_t *packets;
+    of_match_t match;
+    flow_t *flows;
+    char name[64];
+    uint64_t start;
+    int i, added = 0, rv = -1;
+
+    flows = MALLOC(count * sizeof(*flows));
+    packets = MALLOC(COLD_PACKETS * sizeof(*packets));
+    if (flows == NULL || packets == NULL ||
+        loci_classifier_init(&cls, LOCI_CLASSIFIER_CACHE_SLOTS) < 0) {
+        FREE(flows);
+        FREE(packets);
+        return -1;
+    }
+    for (i = 0; i < count; i++) {
+        flow_random(&flows[i]);
+    }
+
+    /* Random flows can collide; those are dropped */
+    start = locibench_start();
+    for (i = 0; i < count; i++) {
+        flow_match(&flows[i], &match);
+        if (loci_classifier_add(&cls, 0, &match, flows[i].priority,
+                                &flows[i]) == 0) {
+            flows[added++] = flows[i];
+        }
+    }
+    snprintf(name, sizeof(name), "classifier/%s/add", size_name);
+    locibench_report(name, count, start, 0);
+
+    for (i = 0; i < COLD_PACKETS; i++) {
+        flow_packet(&flows[rand32() % added], &packets[i]);
+    }
+    if (bench_lookup(&cls, size_name, "hot", packets, HOT_PACKETS) < 0 ||
+        bench_lookup(&cls, size_name, "cold", packets, COLD_PACKETS) < 0) {
+        goto done;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < added; i++) {
+        flow_match(&flows[i], &match);
+        if (loci_classifier_remove(&cls, 0, &match, flows[i].priority,
+                                   NULL) < 0) {
+            goto done;
+        }
+    }
+    snprintf(name, sizeof(name), "classifier/%s/remove", size_name);
+    locibench_report(name, added, start, 0);
+    rv = 0;
+
+ done:
+    loci_classifier_cleanup(&cls);
+    FREE(flows);
+    FREE(packets);
+    return rv;
+}
+
+int
+bench_classifier(void)
+{
+    int i;
+
+    for (i = 0; i < (int)(sizeof(sizes) / sizeof(sizes[0])); i++) {
+        if (bench_size(sizes[i].name, sizes[i].count) < 0) {
+            fprintf(stderr, "classifier benchmark failed for %s\n",
+                    sizes[i].name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,243 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_columns.c
+ *
+ * A poll of 1024 ports as two 1.3 port stats replies, written from
+ * and read into columns, one op per port:
+ *
+ *   columns/1k/objects         of_port_stats_entry_init,
+ *                              of_list_append_bind and the setters per
+ *                              port
+ *   columns/1k/fill            loci_columns_fill of both replies
+ *   columns/1k/getters         OF_LIST_PORT_STATS_ENTRY_ITER and the
+ *                              getters of the counters
+ *   columns/1k/extract         loci_columns_extract of both replies
+ *   columns/1k/delta           loci_columns_delta against the previous
+ *                              poll, ports in the same order
+ *   columns/1k/delta-reorder   The same, ports in the opposite order
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_columns.h>
+
+#define PORTS 1024
+#define REPLIES 2
+
+/* A 1.3 reply with rows first to first + n of src, through the setters */
+static of_object_t *
+reply_objects(const loci_columns_t *src, int first, int n, int reverse)
+{
+    of_object_t *reply;
+    of_list_port_stats_entry_t list;
+    of_port_stats_entry_t entry;
+    const uint64_t *const *c = (const uint64_t *const *)src->columns;
+    int i, row;
+
+    if ((reply = of_port_stats_reply_new(OF_VERSION_1_3)) == NULL) {
+        return NULL;
+    }
+    of_port_stats_reply_entries_bind(reply, &list);
+    for (i = first; i < first + n; i++) {
+        row = reverse ? PORTS - 1 - i : i;
+        of_port_stats_entry_init(&entry, OF_VERSION_1_3, -1, 1);
+        if (of_list_append_bind(&list, &entry) < 0) {
+            of_object_delete(reply);
+            return NULL;
+        }
+        of_port_stats_entry_port_no_set(&entry, c[0][row]);
+        of_port_stats_entry_duration_sec_set(&entry, c[1][row]);
+        of_port_stats_entry_duration_nsec_set(&entry, c[2][row]);
+        of_port_stats_entry_rx_packets_set(&entry, c[3][row]);
+        of_port_stats_entry_tx_packets_set(&entry, c[4][row]);
+        of_port_stats_entry_rx_bytes_set(&entry, c[5][row]);
+        of_port_stats_entry_tx_bytes_set(&entry, c[6][row]);
+        of_port_stats_entry_rx_dropped_set(&entry, c[7][row]);
+        of_port_stats_entry_tx_dropped_set(&entry, c[8][row]);
+        of_port_stats_entry_rx_errors_set(&entry, c[9][row]);
+        of_port_stats_entry_tx_errors_set(&entry, c[10][row]);
+        of_port_stats_entry_rx_frame_err_set(&entry, c[11][row]);
+        of_port_stats_entry_rx_over_err_set(&entry, c[12][row]);
+        of_port_stats_entry_rx_crc_err_set(&entry, c[13][row]);
+        of_port_stats_entry_collisions_set(&entry, c[14][row]);
+    }
+
+    return reply;
+}
+
+static void
+poll_free(of_object_t **replies)
+{
+    int i;
+
+    for (i = 0; i < REPLIES; i++) {
+        if (replies[i] != NULL) {
+            of_object_delete(replies[i]);
+            replies[i] = NULL;
+        }
+    }
+}
+
+static int
+poll_objects(of_object_t **replies, const loci_columns_t *src, int reverse)
+{
+    int i;
+
+    poll_free(replies);
+    for (i = 0; i < REPLIES; i++) {
+        replies[i] = reply_objects(src, i * (PORTS / REPLIES),
+                                   PORTS / REPLIES, reverse);
+        if (replies[i] == NULL) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int
+poll_fill(of_object_t **replies, const loci_columns_t *src)
+{
+    int i, next = 0;
+
+    poll_free(replies);
+    for (i = 0; i < REPLIES && next < src->count; i++) {
+        if ((replies[i] = of_port_stats_reply_new(OF_VERSION_1_3)) == NULL ||
+            loci_columns_fill(replies[i], src, &next) < 0) {
+            return -1;
+        }
+    }
+
+    return next == src->count ? 0 : -1;
+}
+
+static int
+poll_extract(loci_columns_t *cols, of_object_t **replies)
+{
+    of_list_port_stats_entry_t list;
+    int i;
+
+    loci_columns_clear(cols);
+    for (i = 0; i < REPLIES; i++) {
+        of_port_stats_reply_entries_bind(replies[i], &list);
+        if (loci_columns_extract(cols, &list) < 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int
+bench_columns(void)
+{
+    of_object_t *replies[REPLIES] = { NULL }, *reversed[REPLIES] = { NULL };
+    of_list_port_stats_entry_t list;
+    of_port_stats_entry_t entry;
+    loci_columns_t src, cur, prev, delta;
+    uint64_t start, v;
+    int i, j, n, rv, polls = locibench_iterations / PORTS + 1;
+
+    /* Each is initialized so the cleanup can free them all */
+    rv = loci_columns_init(&src, OF_PORT_STATS_ENTRY, PORTS);
+    rv |= loci_columns_init(&cur, OF_PORT_STATS_ENTRY, PORTS);
+    rv |= loci_columns_init(&prev, OF_PORT_STATS_ENTRY, PORTS);
+    rv |= loci_columns_init(&delta, OF_PORT_STATS_ENTRY, PORTS);
+    if (rv == 0) {
+        rv = loci_columns_resize(&src, PORTS);
+    }
+    for (i = 0; i < src.count && rv == 0; i++) {
+        src.columns[0][i] = i + 1;
+        for (j = 1; j < src.n_columns; j++) {
+            src.columns[j][i] = (i + 1) * (uint64_t)j * 1000;
+        }
+    }
+    if (rv == 0) {
+        rv = poll_objects(reversed, &src, 1);
+    }
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        rv = poll_objects(replies, &src, 0);
+    }
+    locibench_report("columns/1k/objects", polls * PORTS, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        rv = poll_fill(replies, &src);
+    }
+    locibench_report("columns/1k/fill", polls * PORTS, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        for (j = 0; j < REPLIES; j++) {
+            of_port_stats_reply_entries_bind(replies[j], &list);
+            OF_LIST_PORT_STATS_ENTRY_ITER(&list, &entry, n) {
+                of_port_stats_entry_rx_packets_get(&entry, &v);
+                locibench_sink += v;
+                of_port_stats_entry_tx_packets_get(&entry, &v);
+                locibench_sink += v;
+                of_port_stats_entry_rx_bytes_get(&entry, &v);
+                locibench_sink += v;
+                of_port_stats_entry_tx_bytes_get(&entry, &v);
+                locibench_sink += v;
+                of_port_stats_entry_rx_dropped_get(&entry, &v);
+                locibench_sink += v;
+                of_port_stats_entry_tx_dropped_get(&entry, &v);
+                locibench_sink += v;
+                of_port_stats_entry_rx_errors_get(&entry, &v);
+                locibench_sink += v;
+                of_port_stats_entry_tx_errors_get(&entry, &v);
+                locibench_sink += v;
+            }
+        }
+    }
+    locibench_report("columns/1k/getters", polls * PORTS, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        rv = poll_extract(&cur, replies);
+        locibench_sink += cur.columns[3][PORTS - 1];
+    }
+    locibench_report("columns/1k/extract", polls * PORTS, start, 0);
+    if (rv == 0 && MEMCMP(cur.columns[14], src.columns[14],
+                          PORTS * sizeof(uint64_t)) != 0) {
+        fprintf(stderr, "columns/1k/extract doesn't read back the fill\n");
+        rv = -1;
+    }
+
+    if (rv == 0) {
+        rv = poll_extract(&prev, replies);
+    }
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        rv = loci_columns_delta(&cur, &prev, &delta);
+        locibench_sink += delta.columns[3][0];
+    }
+    locibench_report("columns/1k/delta", polls * PORTS, start, 0);
+
+    if (rv == 0) {
+        rv = poll_extract(&prev, reversed);
+    }
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        rv = loci_columns_delta(&cur, &prev, &delta);
+        locibench_sink += delta.columns[3][0];
+    }
+    locibench_report("columns/1k/delta-reorder", polls * PORTS, start, 0);
+
+    loci_columns_cleanup(&src);
+    loci_columns_cleanup(&cur);
+    loci_columns_cleanup(&prev);
+    loci_columns_cleanup(&delta);
+    poll_free(replies);
+    poll_free(reversed);
+    if (rv < 0) {
+        fprintf(stderr, "columns benchmark failed\n");
+    }
+
+    return rv;
+}
@@ -0,0 +1,138 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_corpus.c
+ *
+ * Benchmark every object of the data file corpus:
+ *
+ *   construct  Build the object with its generated accessors, then delete it
+ *   encode     Build the object and take its wire buffer, as when sending
+ *   parse      of_object_new_from_message_preallocated (messages only)
+ *   validate   of_validate_message (messages only)
+ *   show       of_object_show
+ *   dump       of_object_dump
+ *   dup        of_object_dup and delete
+ *
+ * Results are named corpus/<data file>/<operation>.
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_dump.h>
+#include <loci/loci_show.h>
+#include <loci/loci_validator.h>
+
+static int
+is_message(of_object_t *obj)
+{
+    return obj->object_id != OF_OBJECT &&
+        obj->object_id < OF_MESSAGE_OBJECT_COUNT;
+}
+
+static int
+bench_entry(const locibench_data_t *data)
+{
+    static locibench_text_t tb;
+    static uint8_t msg[OF_WIRE_BUFFER_MAX_LENGTH];
+    of_object_storage_t storage;
+    of_object_t *obj, *dup;
+    uint8_t *buf;
+    char name[96];
+    uint64_t start;
+    int i, n = locibench_iterations;
+
+    if ((obj = data->build()) == NULL) {
+        return -1;
+    }
+    if (obj->length != data->len ||
+        memcmp(OF_OBJECT_TO_MESSAGE(obj), data->binary, data->len) != 0) {
+        fprintf(stderr, "%s: built object does not match the data file\n",
+                data->name);
+        of_object_delete(obj);
+        return -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_delete(data->build());
+    }
+    snprintf(name, sizeof(name), "corpus/%s/construct", data->name);
+    locibench_report(name, n, start, data->len);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        dup = data->build();
+        of_object_wire_buffer_steal(dup, &buf);
+        of_object_delete(dup);
+        locibench_sink += buf[0];
+        FREE(buf);
+    }
+    snprintf(name, sizeof(name), "corpus/%s/encode", data->name);
+    locibench_report(name, n, start, data->len);
+
+    if (is_message(obj)) {
+        memcpy(msg, data->binary, data->len);
+        if (of_object_new_from_message_preallocated(&storage, msg, data->len) == NULL) {
+            fprintf(stderr, "%s: data file does not parse\n", data->name);
+            of_object_delete(obj);
+            return -1;
+        }
+
+        start = locibench_start();
+        for (i = 0; i < n; i++) {
+            dup = of_object_new_from_message_preallocated(&storage, msg, data->len);
+            locibench_sink += dup->object_id;
+        }
+        snprintf(name, sizeof(name), "corpus/%s/parse", data->name);
+        locibench_report(name, n, start, 0);
+
+        start = locibench_start();
+        for (i = 0; i < n; i++) {
+            locibench_sink += of_validate_message(msg, data->len);
+        }
+        snprintf(name, sizeof(name), "corpus/%s/validate", data->name);
+        locibench_report(name, n, start, 0);
+    }
+
+    locibench_text_reset(&tb);
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_show(locibench_text_writer, &tb, obj);
+    }
+    snprintf(name, sizeof(name), "corpus/%s/show", data->name);
+    locibench_report(name, n, start, locibench_text_bytes(&tb) / n);
+
+    locibench_text_reset(&tb);
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_dump(locibench_text_writer, &tb, obj);
+    }
+    snprintf(name, sizeof(name), "corpus/%s/dump", data->name);
+    locibench_report(name, n, start, locibench_text_bytes(&tb) / n);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_delete(of_object_dup(obj));
+    }
+    snprintf(name, sizeof(name), "corpus/%s/dup", data->name);
+    locibench_report(name, n, start, data->len);
+
+    of_object_delete(obj);
+    return 0;
+}
+
+int
+bench_corpus(void)
+{
+    const locibench_data_t *data;
+
+    for (data = locibench_data; data->name != NULL; data++) {
+        if (bench_entry(data) < 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
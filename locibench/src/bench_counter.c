@@ -0,0 +1,197 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_counter.c
+ *
+ * Polls of 100k BSN debug counters into 1.3 stats replies, one op per
+ * counter:
+ *
+ *   counter/100k/objects  of_bsn_debug_counter_stats_entry_init,
+ *                         of_list_append_bind and the setters per
+ *                         counter, a new reply when one is full
+ *   counter/100k/fill     loci_debug_counter_stats_fill
+ *   counter/100k/iterate  OF_LIST_BSN_DEBUG_COUNTER_STATS_ENTRY_ITER
+ *                         and the getters over the replies
+ *   counter/100k/decode   loci_debug_counter_stats_decode
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_debug_counter.h>
+
+#define COUNTERS 100000
+/* Replies a poll takes, with room to spare */
+#define REPLIES_MAX 32
+
+typedef struct poll_s {
+    of_object_t *replies[REPLIES_MAX];
+    int n_replies;
+} poll_t;
+
+static void
+poll_free(poll_t *poll)
+{
+    int i;
+
+    for (i = 0; i < poll->n_replies; i++) {
+        of_object_delete(poll->replies[i]);
+    }
+    poll->n_replies = 0;
+}
+
+static of_object_t *
+poll_reply_new(poll_t *poll)
+{
+    of_object_t *reply;
+
+    if (poll->n_replies == REPLIES_MAX ||
+        (reply = of_bsn_debug_counter_stats_reply_new(OF_VERSION_1_3)) ==
+        NULL) {
+        return NULL;
+    }
+    poll->replies[poll->n_replies++] = reply;
+
+    return reply;
+}
+
+static int
+poll_objects(poll_t *poll, const loci_debug_counter_t *counters)
+{
+    of_object_t *reply;
+    of_list_bsn_debug_counter_stats_entry_t list;
+    of_bsn_debug_counter_stats_entry_t entry;
+    int i;
+
+    if ((reply = poll_reply_new(poll)) == NULL) {
+        return -1;
+    }
+    of_bsn_debug_counter_stats_reply_entries_bind(reply, &list);
+    for (i = 0; i < COUNTERS; i++) {
+        of_bsn_debug_counter_stats_entry_init(&entry, OF_VERSION_1_3, -1, 1);
+        if (of_list_append_bind(&list, &entry) < 0) {
+            of_bsn_debug_counter_stats_reply_flags_set(
+                reply, OF_STATS_REPLY_FLAG_REPLY_MORE);
+            if ((reply = poll_reply_new(poll)) == NULL) {
+                return -1;
+            }
+            of_bsn_debug_counter_stats_reply_entries_bind(reply, &list);
+            of_bsn_debug_counter_stats_entry_init(&entry, OF_VERSION_1_3,
+                                                  -1, 1);
+            if (of_list_append_bind(&list, &entry) < 0) {
+                return -1;
+            }
+        }
+        of_bsn_debug_counter_stats_entry_counter_id_set(&entry,
+                                                        counters[i].id);
+        of_bsn_debug_counter_stats_entry_value_set(&entry, counters[i].value);
+    }
+
+    return 0;
+}
+
+static int
+poll_fill(poll_t *poll, const loci_debug_counter_t *counters)
+{
+    of_object_t *reply;
+    int next = 0;
+
+    do {
+        if ((reply = poll_reply_new(poll)) == NULL ||
+            loci_debug_counter_stats_fill(reply, counters, COUNTERS,
+                                          &next) < 0) {
+            return -1;
+        }
+    } while (next < COUNTERS);
+
+    return 0;
+}
+
+static uint64_t
+poll_bytes(poll_t *poll)
+{
+    uint64_t bytes = 0;
+    int i;
+
+    for (i = 0; i < poll->n_replies; i++) {
+        bytes += poll->replies[i]->length;
+    }
+
+    return bytes;
+}
+
+int
+bench_counter(void)
+{
+    loci_debug_counter_t *counters;
+    of_list_bsn_debug_counter_stats_entry_t list;
+    of_bsn_debug_counter_stats_entry_t entry;
+    poll_t poll = { { NULL }, 0 };
+    uint64_t start, bytes = 0, value;
+    int i, j, rv = 0, n, polls = locibench_iterations / COUNTERS + 1;
+
+    if ((counters = malloc(COUNTERS * sizeof(*counters))) == NULL) {
+        return -1;
+    }
+    for (i = 0; i < COUNTERS; i++) {
+        counters[i].id = i;
+        counters[i].value = (uint64_t)i * 1000003;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        poll_free(&poll);
+        rv = poll_objects(&poll, counters);
+    }
+    bytes = poll_bytes(&poll);
+    locibench_report("counter/100k/objects", polls * COUNTERS, start,
+                     bytes / COUNTERS);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        poll_free(&poll);
+        rv = poll_fill(&poll, counters);
+    }
+    locibench_report("counter/100k/fill", polls * COUNTERS, start,
+                     poll_bytes(&poll) / COUNTERS);
+    if (rv == 0 && poll_bytes(&poll) != bytes) {
+        fprintf(stderr, "counter/100k/fill wrote %" PRIu64 " bytes, not %"
+                PRIu64 "\n", poll_bytes(&poll), bytes);
+        rv = -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        for (j = 0; j < poll.n_replies; j++) {
+            of_bsn_debug_counter_stats_reply_entries_bind(poll.replies[j],
+                                                          &list);
+            OF_LIST_BSN_DEBUG_COUNTER_STATS_ENTRY_ITER(&list, &entry, n) {
+                of_bsn_debug_counter_stats_entry_value_get(&entry, &value);
+                locibench_sink += value;
+            }
+        }
+    }
+    locibench_report("counter/100k/iterate", polls * COUNTERS, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        for (j = 0, n = 0; j < poll.n_replies && n >= 0; j++) {
+            n = loci_debug_counter_stats_decode(poll.replies[j], counters,
+                                                COUNTERS);
+            locibench_sink += counters[0].value;
+        }
+        if (n < 0) {
+            rv = -1;
+        }
+    }
+    locibench_report("counter/100k/decode", polls * COUNTERS, start, 0);
+
+    poll_free(&poll);
+    free(counters);
+    if (rv < 0) {
+        fprintf(stderr, "counter benchmark failed\n");
+    }
+
+    return rv;
+}
@@ -0,0 +1,1929 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ *
+ * Generated by scripts/gen_bench_data.py from locitest/src/test_data.c;
+ * run "make bench-data" after changing either.
+ *
+ * Data file corpus for the benchmarks.
+ */
+
+/* The generated builders don't check accessor results */
+#define DISABLE_WARN_UNUSED_RESULT
+#include <locibench/locibench.h>
+
+/* Generated from of10/action_bsn_set_tunnel_dst.data */
+static const uint8_t of10_action_bsn_set_tunnel_dst_binary[] = {
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x5c, 0x16, 0xc7,
+    0x00, 0x00, 0x00, 0x02, 0x12, 0x34, 0x56, 0x78,
+};
+
+static of_object_t *
+of10_action_bsn_set_tunnel_dst_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_action_bsn_set_tunnel_dst_new(OF_VERSION_1_0);
+    of_action_bsn_set_tunnel_dst_dst_set(obj, 0x12345678);
+    return obj;
+}
+
+/* Generated from of10/desc_stats_reply.data */
+static const uint8_t of10_desc_stats_reply_binary[] = {
+    0x01, 0x11, 0x04, 0x2c, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x54, 0x68, 0x65, 0x20,
+    0x49, 0x6e, 0x64, 0x69, 0x67, 0x6f, 0x2d, 0x32,
+    0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
+    0x74, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x6e, 0x6b, 0x6e,
+    0x6f, 0x77, 0x6e, 0x20, 0x73, 0x65, 0x72, 0x76,
+    0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x64, 0x69,
+    0x67, 0x6f, 0x2d, 0x32, 0x20, 0x4c, 0x52, 0x49,
+    0x20, 0x70, 0x72, 0x65, 0x2d, 0x72, 0x65, 0x6c,
+    0x65, 0x61, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0x32, 0x33,
+    0x35, 0x38, 0x31, 0x33, 0x32, 0x31, 0x33, 0x34,
+    0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x64, 0x69,
+    0x67, 0x6f, 0x2d, 0x32, 0x20, 0x4c, 0x52, 0x49,
+    0x20, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64,
+    0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f, 0x64, 0x75,
+    0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of10_desc_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_desc_stats_reply_new(OF_VERSION_1_0);
+    of_desc_stats_reply_xid_set(obj, 3);
+    of_desc_stats_reply_flags_set(obj, OF_STATS_REPLY_FLAG_REPLY_MORE);
+    {
+        of_desc_str_t mfr_desc = "The Indigo-2 Community";
+        of_desc_stats_reply_mfr_desc_set(obj, mfr_desc);
+    }
+    {
+        of_desc_str_t hw_desc = "Unknown server";
+        of_desc_stats_reply_hw_desc_set(obj, hw_desc);
+    }
+    {
+        of_desc_str_t sw_desc = "Indigo-2 LRI pre-release";
+        of_desc_stats_reply_sw_desc_set(obj, sw_desc);
+    }
+    {
+        of_desc_str_t dp_desc = "Indigo-2 LRI forwarding module";
+        of_desc_stats_reply_dp_desc_set(obj, dp_desc);
+    }
+    {
+        of_serial_num_t serial_num = "11235813213455";
+        of_desc_stats_reply_serial_num_set(obj, serial_num);
+    }
+    return obj;
+}
+
+/* Generated from of10/echo_request.data */
+static const uint8_t of10_echo_request_binary[] = {
+    0x01, 0x02, 0x00, 0x0b, 0x12, 0x34, 0x56, 0x78,
+    0x61, 0x62, 0x01,
+};
+
+static of_object_t *
+of10_echo_request_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_echo_request_new(OF_VERSION_1_0);
+    of_echo_request_xid_set(obj, 0x12345678);
+    {
+        of_octets_t data = { .data=(uint8_t *)"ab\x01", .bytes=3 };
+        of_echo_request_data_set(obj, &data);
+    }
+    return obj;
+}
+
+/* Generated from of10/flow_add.data */
+static const uint8_t of10_flow_add_binary[] = {
+    0x01, 0x0e, 0x00, 0x70, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x30, 0x00, 0xe2, 0x00, 0x03, 0x01, 0x23,
+    0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23,
+    0x45, 0x67, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0xa8, 0x03, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x08, 0xff, 0xfb, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x23, 0x20,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x5c, 0x16, 0xc7,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of10_flow_add_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_flow_add_new(OF_VERSION_1_0);
+    of_flow_add_xid_set(obj, 0x12345678);
+    of_flow_add_idle_timeout_set(obj, 5);
+    of_flow_add_flags_set(obj, 2);
+    {
+        of_match_t match = { OF_VERSION_1_0 };
+        match.fields.in_port = 3;
+        match.fields.eth_src = (of_mac_addr_t) { { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab } };
+        match.fields.eth_dst = (of_mac_addr_t) { { 0xcd, 0xef, 0x01, 0x23, 0x45, 0x67 } };
+        match.fields.eth_type = 0x800;
+        match.fields.ipv4_src = 0xc0a8037f;
+        match.fields.ipv4_dst = 0xffffffff;
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_SRC_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_DST_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+        //OF_MATCH_MASK_VLAN_VID_EXACT_SET(&match);
+        //OF_MATCH_MASK_VLAN_PCP_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+        //OF_MATCH_MASK_IP_DSCP_EXACT_SET(&match);
+        //OF_MATCH_MASK_IP_PROTO_EXACT_SET(&match);
+        OF_MATCH_MASK_IPV4_SRC_EXACT_SET(&match);
+        OF_MATCH_MASK_IPV4_DST_EXACT_SET(&match);
+        //OF_MATCH_MASK_TCP_SRC_EXACT_SET(&match);
+        //OF_MATCH_MASK_TCP_DST_EXACT_SET(&match);
+        of_flow_add_match_set(obj, &match);
+    }
+    {
+        of_list_action_t actions;
+        of_flow_add_actions_bind(obj, &actions);
+        {
+            of_object_t action;
+            of_action_output_init(&action, OF_VERSION_1_0, -1, 1);
+            of_list_action_append_bind(&actions, &action);
+            of_action_output_port_set(&action, OF_PORT_DEST_FLOOD);
+        }
+        {
+            of_object_t action;
+            of_action_nicira_dec_ttl_init(&action, OF_VERSION_1_0, -1, 1);
+            of_list_action_append_bind(&actions, &action);
+        }
+        {
+            of_object_t action;
+            of_action_bsn_set_tunnel_dst_init(&action, OF_VERSION_1_0, -1, 1);
+            of_list_action_append_bind(&actions, &action);
+        }
+    }
+    return obj;
+}
+
+/* Generated from of10/flow_stats_entry.data */
+static const uint8_t of10_flow_stats_entry_binary[] = {
+    0x00, 0x68, 0x03, 0x00, 0x00, 0x30, 0x00, 0xe2,
+    0x00, 0x03, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab,
+    0xcd, 0xef, 0x01, 0x23, 0x45, 0x67, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0xa8, 0x03, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00, 0x05,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
+};
+
+static of_object_t *
+of10_flow_stats_entry_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_flow_stats_entry_new(OF_VERSION_1_0);
+    {
+        of_object_t list;
+        of_flow_stats_entry_actions_bind(obj, &list);
+        {
+            of_object_t *obj = of_action_output_new(OF_VERSION_1_0);
+            of_action_output_max_len_set(obj, 0);
+            of_action_output_port_set(obj, 1);
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+        {
+            of_object_t *obj = of_action_output_new(OF_VERSION_1_0);
+            of_action_output_max_len_set(obj, 0);
+            of_action_output_port_set(obj, 2);
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+    }
+    of_flow_stats_entry_byte_count_set(obj, 1000);
+    of_flow_stats_entry_cookie_set(obj, 81985529216486895);
+    of_flow_stats_entry_duration_nsec_set(obj, 2);
+    of_flow_stats_entry_duration_sec_set(obj, 1);
+    of_flow_stats_entry_hard_timeout_set(obj, 10);
+    of_flow_stats_entry_idle_timeout_set(obj, 5);
+    {
+        of_match_t match = { OF_VERSION_1_0 };
+        match.fields.in_port = 3;
+        match.fields.eth_src = (of_mac_addr_t) { { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab } };
+        match.fields.eth_dst = (of_mac_addr_t) { { 0xcd, 0xef, 0x01, 0x23, 0x45, 0x67 } };
+        match.fields.eth_type = 0x800;
+        match.fields.ipv4_src = 0xc0a8037f;
+        match.fields.ipv4_dst = 0xffffffff;
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_SRC_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_DST_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+        //OF_MATCH_MASK_VLAN_VID_EXACT_SET(&match);
+        //OF_MATCH_MASK_VLAN_PCP_EXACT_SET(&match);
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+        //OF_MATCH_MASK_IP_DSCP_EXACT_SET(&match);
+        //OF_MATCH_MASK_IP_PROTO_EXACT_SET(&match);
+        OF_MATCH_MASK_IPV4_SRC_EXACT_SET(&match);
+        OF_MATCH_MASK_IPV4_DST_EXACT_SET(&match);
+        //OF_MATCH_MASK_TCP_SRC_EXACT_SET(&match);
+        //OF_MATCH_MASK_TCP_DST_EXACT_SET(&match);
+        of_flow_stats_entry_match_set(obj, &match);
+    }
+    of_flow_stats_entry_packet_count_set(obj, 10);
+    of_flow_stats_entry_priority_set(obj, 100);
+    of_flow_stats_entry_table_id_set(obj, 3);
+    return obj;
+}
+
+/* Generated from of10/flow_stats_reply.data */
+static const uint8_t of10_flow_stats_reply_binary[] = {
+    0x01, 0x11, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0x03, 0x00,
+    0x00, 0x3f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x64, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x45, 0x67,
+    0x89, 0xab, 0xcd, 0xef, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00,
+    0x00, 0x3f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x64, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x45, 0x67,
+    0x89, 0xab, 0xcd, 0xef, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x03, 0x00, 0x00,
+};
+
+static of_object_t *
+of10_flow_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_flow_stats_reply_new(OF_VERSION_1_0);
+    of_flow_stats_reply_flags_set(obj, 0);
+    of_flow_stats_reply_xid_set(obj, 6);
+    {
+        of_object_t *entries = of_list_flow_stats_entry_new(OF_VERSION_1_0);
+        {
+            of_object_t *elem = of_flow_stats_entry_new(OF_VERSION_1_0);
+            of_flow_stats_entry_byte_count_set(elem, 1000);
+            of_flow_stats_entry_cookie_set(elem, 81985529216486895);
+            of_flow_stats_entry_duration_nsec_set(elem, 2);
+            of_flow_stats_entry_duration_sec_set(elem, 1);
+            of_flow_stats_entry_hard_timeout_set(elem, 10);
+            of_flow_stats_entry_idle_timeout_set(elem, 5);
+            of_flow_stats_entry_packet_count_set(elem, 10);
+            of_flow_stats_entry_priority_set(elem, 100);
+            of_flow_stats_entry_table_id_set(elem, 3);
+            {
+                of_match_t match = { OF_VERSION_1_0 };
+                of_flow_stats_entry_match_set(elem, &match);
+            }
+            {
+                of_object_t *actions = of_list_action_new(OF_VERSION_1_0);
+                {
+                    of_object_t *elem = of_action_output_new(OF_VERSION_1_0);
+                    of_action_output_max_len_set(elem, 0);
+                    of_action_output_port_set(elem, 1);
+                    of_list_append(actions, elem);
+                    of_object_delete(elem);
+                }
+                {
+                    of_object_t *elem = of_action_output_new(OF_VERSION_1_0);
+                    of_action_output_max_len_set(elem, 0);
+                    of_action_output_port_set(elem, 2);
+                    of_list_append(actions, elem);
+                    of_object_delete(elem);
+                }
+                of_flow_stats_entry_actions_set(elem, actions);
+                of_object_delete(actions);
+            }
+            of_list_append(entries, elem);
+            of_object_delete(elem);
+        }
+        {
+            of_object_t *elem = of_flow_stats_entry_new(OF_VERSION_1_0);
+            of_flow_stats_entry_byte_count_set(elem, 1000);
+            of_flow_stats_entry_cookie_set(elem, 81985529216486895);
+            of_flow_stats_entry_duration_nsec_set(elem, 2);
+            of_flow_stats_entry_duration_sec_set(elem, 1);
+            of_flow_stats_entry_hard_timeout_set(elem, 10);
+            of_flow_stats_entry_idle_timeout_set(elem, 5);
+            of_flow_stats_entry_packet_count_set(elem, 10);
+            of_flow_stats_entry_priority_set(elem, 100);
+            of_flow_stats_entry_table_id_set(elem, 4);
+            {
+                of_match_t match = { OF_VERSION_1_0 };
+                of_flow_stats_entry_match_set(elem, &match);
+            }
+            {
+                of_object_t *actions = of_list_action_new(OF_VERSION_1_0);
+                {
+                    of_object_t *elem = of_action_output_new(OF_VERSION_1_0);
+                    of_action_output_max_len_set(elem, 0);
+                    of_action_output_port_set(elem, 1);
+                    of_list_append(actions, elem);
+                    of_object_delete(elem);
+                }
+                {
+                    of_object_t *elem = of_action_output_new(OF_VERSION_1_0);
+                    of_action_output_max_len_set(elem, 0);
+                    of_action_output_port_set(elem, 2);
+                    of_list_append(actions, elem);
+                    of_object_delete(elem);
+                }
+                {
+                    of_object_t *elem = of_action_output_new(OF_VERSION_1_0);
+                    of_action_output_max_len_set(elem, 0);
+                    of_action_output_port_set(elem, 3);
+                    of_list_append(actions, elem);
+                    of_object_delete(elem);
+                }
+                of_flow_stats_entry_actions_set(elem, actions);
+                of_object_delete(actions);
+            }
+            of_list_append(entries, elem);
+            of_object_delete(elem);
+        }
+        of_flow_stats_reply_entries_set(obj, entries);
+        of_object_delete(entries);
+    }
+    return obj;
+}
+
+/* Generated from of10/hello.data */
+static const uint8_t of10_hello_binary[] = {
+    0x01, 0x00, 0x00, 0x08, 0x12, 0x34, 0x56, 0x78,
+};
+
+static of_object_t *
+of10_hello_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_hello_new(OF_VERSION_1_0);
+    of_hello_xid_set(obj, 305419896);
+    return obj;
+}
+
+/* Generated from of10/packet_in.data */
+static const uint8_t of10_packet_in_binary[] = {
+    0x01, 0x0a, 0x00, 0x15, 0x12, 0x34, 0x56, 0x78,
+    0xab, 0xcd, 0xef, 0x01, 0x00, 0x09, 0xff, 0xfe,
+    0x01, 0x00, 0x61, 0x62, 0x63,
+};
+
+static of_object_t *
+of10_packet_in_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_packet_in_new(OF_VERSION_1_0);
+    of_packet_in_buffer_id_set(obj, 0xabcdef01);
+    {
+        of_octets_t data = { .bytes=3, .data=(uint8_t *)"\x61\x62\x63" };
+        of_packet_in_data_set(obj, &data);
+    }
+    of_packet_in_in_port_set(obj, 65534);
+    of_packet_in_reason_set(obj, 1);
+    of_packet_in_total_len_set(obj, 9);
+    of_packet_in_xid_set(obj, 305419896);
+    return obj;
+}
+
+/* Generated from of10/packet_out.data */
+static const uint8_t of10_packet_out_binary[] = {
+    0x01, 0x0d, 0x00, 0x23, 0x12, 0x34, 0x56, 0x78,
+    0xab, 0xcd, 0xef, 0x01, 0xff, 0xfe, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
+    0x61, 0x62, 0x63,
+};
+
+static of_object_t *
+of10_packet_out_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_packet_out_new(OF_VERSION_1_0);
+    of_packet_out_buffer_id_set(obj, 0xabcdef01);
+    of_packet_out_in_port_set(obj, 65534);
+    of_packet_out_xid_set(obj, 305419896);
+    {
+        of_object_t *list = of_list_action_new(OF_VERSION_1_0);
+        {
+            of_object_t *obj = of_action_output_new(OF_VERSION_1_0);
+            of_action_output_max_len_set(obj, 0);
+            of_action_output_port_set(obj, 1);
+            of_list_append(list, obj);
+            of_object_delete(obj);
+        }
+        {
+            of_object_t *obj = of_action_output_new(OF_VERSION_1_0);
+            of_action_output_max_len_set(obj, 0);
+            of_action_output_port_set(obj, 2);
+            of_list_append(list, obj);
+            of_object_delete(obj);
+        }
+        of_packet_out_actions_set(obj, list);
+        of_object_delete(list);
+    }
+    {
+        of_octets_t data = { .bytes=3, .data=(uint8_t *)"\x61\x62\x63" };
+        of_packet_out_data_set(obj, &data);
+    }
+    return obj;
+}
+
+/* Generated from of10/port_desc.data */
+static const uint8_t of10_port_desc_binary[] = {
+    0xff, 0xfd, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x66, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00,
+};
+
+static of_object_t *
+of10_port_desc_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_port_desc_new(OF_VERSION_1_0);
+    of_port_desc_advertised_set(obj, 32);
+    of_port_desc_config_set(obj, 16);
+    of_port_desc_curr_set(obj, 1);
+    {
+        of_mac_addr_t hw_addr = { { 1, 2, 3, 4, 5, 6 } };
+        of_port_desc_hw_addr_set(obj, hw_addr);
+    }
+    {
+        of_port_name_t name = "foo";
+        of_port_desc_name_set(obj, name);
+    }
+    of_port_desc_peer_set(obj, 2048);
+    of_port_desc_port_no_set(obj, 65533);
+    of_port_desc_state_set(obj, 512);
+    of_port_desc_supported_set(obj, 512);
+    return obj;
+}
+
+/* Generated from of10/port_mod.data */
+static const uint8_t of10_port_mod_binary[] = {
+    0x01, 0x0f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02,
+    0xff, 0xfd, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x80, 0x00, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x11,
+    0xca, 0xfe, 0x67, 0x89, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of10_port_mod_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_port_mod_new(OF_VERSION_1_0);
+    of_port_mod_advertise_set(obj, 0xCAFE6789);
+    of_port_mod_config_set(obj, 0x8000006f);
+    {
+        of_mac_addr_t hw_addr = { { 1, 2, 3, 4, 5, 6 } };
+        of_port_mod_hw_addr_set(obj, hw_addr);
+    }
+    of_port_mod_mask_set(obj, 0x80000011);
+    of_port_mod_port_no_set(obj, 65533);
+    of_port_mod_xid_set(obj, 2);
+    return obj;
+}
+
+/* Generated from of10/port_stats_reply.data */
+static const uint8_t of10_port_stats_reply_binary[] = {
+    0x01, 0x11, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xff, 0xfe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01,
+};
+
+static of_object_t *
+of10_port_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_port_stats_reply_new(OF_VERSION_1_0);
+    {
+        of_object_t list;
+        of_port_stats_reply_entries_bind(obj, &list);
+        {
+            of_object_t *obj = of_port_stats_entry_new(OF_VERSION_1_0);
+            of_port_stats_entry_collisions_set(obj, 5);
+            of_port_stats_entry_port_no_set(obj, 1);
+            of_port_stats_entry_rx_bytes_set(obj, 0);
+            of_port_stats_entry_rx_crc_err_set(obj, 0);
+            of_port_stats_entry_rx_dropped_set(obj, 0);
+            of_port_stats_entry_rx_errors_set(obj, 0);
+            of_port_stats_entry_rx_frame_err_set(obj, 0);
+            of_port_stats_entry_rx_over_err_set(obj, 0);
+            of_port_stats_entry_rx_packets_set(obj, 56);
+            of_port_stats_entry_tx_bytes_set(obj, 0);
+            of_port_stats_entry_tx_dropped_set(obj, 0);
+            of_port_stats_entry_tx_errors_set(obj, 0);
+            of_port_stats_entry_tx_packets_set(obj, 0);
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+        {
+            of_object_t *obj = of_port_stats_entry_new(OF_VERSION_1_0);
+            of_port_stats_entry_collisions_set(obj, 1);
+            of_port_stats_entry_port_no_set(obj, 65534);
+            of_port_stats_entry_rx_bytes_set(obj, 0);
+            of_port_stats_entry_rx_crc_err_set(obj, 0);
+            of_port_stats_entry_rx_dropped_set(obj, 0);
+            of_port_stats_entry_rx_errors_set(obj, 0);
+            of_port_stats_entry_rx_frame_err_set(obj, 0);
+            of_port_stats_entry_rx_over_err_set(obj, 0);
+            of_port_stats_entry_rx_packets_set(obj, 1);
+            of_port_stats_entry_tx_bytes_set(obj, 0);
+            of_port_stats_entry_tx_dropped_set(obj, 0);
+            of_port_stats_entry_tx_errors_set(obj, 0);
+            of_port_stats_entry_tx_packets_set(obj, 0);
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+    }
+    of_port_stats_reply_flags_set(obj, 0);
+    of_port_stats_reply_xid_set(obj, 5);
+    return obj;
+}
+
+/* Generated from of10/port_status.data */
+static const uint8_t of10_port_status_binary[] = {
+    0x01, 0x0c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xfd, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x66, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00,
+};
+
+static of_object_t *
+of10_port_status_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_port_status_new(OF_VERSION_1_0);
+    {
+        of_object_t *desc = of_port_desc_new(OF_VERSION_1_0);
+        of_port_desc_advertised_set(desc, 32);
+        of_port_desc_config_set(desc, 16);
+        of_port_desc_curr_set(desc, 1);
+        {
+    	of_mac_addr_t hw_addr = { { 1, 2, 3, 4, 5, 6 } };
+    	of_port_desc_hw_addr_set(desc, hw_addr);
+        }
+        {
+    	of_port_name_t name = "foo";
+    	of_port_desc_name_set(desc, name);
+        }
+        of_port_desc_peer_set(desc, 2048);
+        of_port_desc_port_no_set(desc, 65533);
+        of_port_desc_state_set(desc, 512);
+        of_port_desc_supported_set(desc, 512);
+        of_port_status_desc_set(obj, desc);
+        of_object_delete(desc);
+    }
+    of_port_status_reason_set(obj, 1);
+    of_port_status_xid_set(obj, 4);
+    return obj;
+}
+
+/* Generated from of10/queue_get_config_reply.data */
+static const uint8_t of10_queue_get_config_reply_binary[] = {
+    0x01, 0x15, 0x00, 0x50, 0x12, 0x34, 0x56, 0x78,
+    0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of10_queue_get_config_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_queue_get_config_reply_new(OF_VERSION_1_0);
+    of_queue_get_config_reply_port_set(obj, 65534);
+    {
+        of_object_t list;
+        of_queue_get_config_reply_queues_bind(obj, &list);
+        {
+            of_object_t *obj = of_packet_queue_new(OF_VERSION_1_0);
+            {
+                of_object_t list;
+                of_packet_queue_properties_bind(obj, &list);
+                {
+                    of_object_t *obj = of_queue_prop_min_rate_new(OF_VERSION_1_0);
+                    of_queue_prop_min_rate_rate_set(obj, 5);
+                    of_list_append(&list, obj);
+                    of_object_delete(obj);
+                }
+            }
+            of_packet_queue_queue_id_set(obj, 1);
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+        {
+            of_object_t *obj = of_packet_queue_new(OF_VERSION_1_0);
+            {
+                of_object_t list;
+                of_packet_queue_properties_bind(obj, &list);
+                {
+                    of_object_t *obj = of_queue_prop_min_rate_new(OF_VERSION_1_0);
+                    of_queue_prop_min_rate_rate_set(obj, 6);
+                    of_list_append(&list, obj);
+                    of_object_delete(obj);
+                }
+                {
+                    of_object_t *obj = of_queue_prop_min_rate_new(OF_VERSION_1_0);
+                    of_queue_prop_min_rate_rate_set(obj, 7);
+                    of_list_append(&list, obj);
+                    of_object_delete(obj);
+                }
+            }
+            of_packet_queue_queue_id_set(obj, 2);
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+    }
+    of_queue_get_config_reply_xid_set(obj, 305419896);
+    return obj;
+}
+
+/* Generated from of10/table_stats_entry.data */
+static const uint8_t of10_table_stats_entry_binary[] = {
+    0x03, 0x00, 0x00, 0x00, 0x66, 0x6f, 0x6f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+};
+
+static of_object_t *
+of10_table_stats_entry_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_table_stats_entry_new(OF_VERSION_1_0);
+    of_table_stats_entry_active_count_set(obj, 2);
+    of_table_stats_entry_lookup_count_set(obj, 1099511627775ULL);
+    of_table_stats_entry_matched_count_set(obj, 9300233470495232273ULL);
+    of_table_stats_entry_max_entries_set(obj, 5);
+    {
+        of_table_name_t name = "foo";
+        of_table_stats_entry_name_set(obj, name);
+    }
+    of_table_stats_entry_table_id_set(obj, 3);
+    of_table_stats_entry_wildcards_set(obj, 4194303);
+    return obj;
+}
+
+/* Generated from of13/action_id_output.data */
+static const uint8_t of13_action_id_output_binary[] = {
+    0x00, 0x00, 0x00, 0x04,
+};
+
+static of_object_t *
+of13_action_id_output_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_action_id_output_new(OF_VERSION_1_3);
+    return obj;
+}
+
+/* Generated from of13/bad_match_error_msg.data */
+static const uint8_t of13_bad_match_error_msg_binary[] = {
+    0x04, 0x01, 0x00, 0x0f, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x04, 0x00, 0x08, 0x61, 0x62, 0x63,
+};
+
+static of_object_t *
+of13_bad_match_error_msg_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bad_match_error_msg_new(OF_VERSION_1_3);
+    of_bad_match_error_msg_xid_set(obj, 0x12345678);
+    of_bad_match_error_msg_code_set(obj, OF_MATCH_FAILED_BAD_MASK_BY_VERSION(OF_VERSION_1_3));
+    of_octets_t data = { .bytes=3, .data=(uint8_t *)"\x61\x62\x63" };
+    of_bad_match_error_msg_data_set(obj, &data);
+    return obj;
+}
+
+/* Generated from of13/bad_request_error_msg.data */
+static const uint8_t of13_bad_request_error_msg_binary[] = {
+    0x04, 0x01, 0x00, 0x0f, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x01, 0x00, 0x08, 0x61, 0x62, 0x63,
+};
+
+static of_object_t *
+of13_bad_request_error_msg_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bad_request_error_msg_new(OF_VERSION_1_3);
+    of_bad_request_error_msg_xid_set(obj, 0x12345678);
+    of_bad_request_error_msg_code_set(obj, OF_REQUEST_FAILED_BUFFER_UNKNOWN_BY_VERSION(OF_VERSION_1_3));
+    of_octets_t data = { .bytes=3, .data=(uint8_t *)"\x61\x62\x63" };
+    of_bad_request_error_msg_data_set(obj, &data);
+    return obj;
+}
+
+/* Generated from of13/bsn_flow_idle.data */
+static const uint8_t of13_bsn_flow_idle_binary[] = {
+    0x04, 0x04, 0x00, 0x38, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x28,
+    0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+    0x42, 0x68, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x16, 0x80, 0x00, 0x01, 0x08,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+    0x80, 0x00, 0x2a, 0x02, 0x00, 0x01, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_bsn_flow_idle_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_flow_idle_new(OF_VERSION_1_3);
+    of_bsn_flow_idle_xid_set(obj, 0x12345678);
+    of_bsn_flow_idle_cookie_set(obj, 0xFEDCBA9876543210);
+    of_bsn_flow_idle_priority_set(obj, 17000);
+    of_bsn_flow_idle_table_id_set(obj, 20);
+    {
+        of_match_t match = { OF_VERSION_1_3 };
+        match.fields.in_port = 4;
+        match.masks.in_port = 5;
+        match.fields.arp_op = 1;
+        OF_MATCH_MASK_ARP_OP_EXACT_SET(&match);
+        of_bsn_flow_idle_match_set(obj, &match);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_gentable_bucket_stats_reply.data */
+static const uint8_t of13_bsn_gentable_bucket_stats_reply_binary[] = {
+    0x04, 0x13, 0x00, 0x38, 0x12, 0x34, 0x56, 0x78,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x05,
+    0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11,
+    0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88,
+    0x12, 0x34, 0x23, 0x45, 0x34, 0x56, 0x45, 0x67,
+    0x56, 0x78, 0x67, 0x89, 0x78, 0x9a, 0x89, 0xab,
+};
+
+static of_object_t *
+of13_bsn_gentable_bucket_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_gentable_bucket_stats_reply_new(OF_VERSION_1_3);
+    of_bsn_gentable_bucket_stats_reply_xid_set(obj, 0x12345678);
+    {
+        of_object_t *list = of_list_bsn_gentable_bucket_stats_entry_new(OF_VERSION_1_3);
+        {
+            of_object_t *entry = of_bsn_gentable_bucket_stats_entry_new(OF_VERSION_1_3);
+            {
+                of_checksum_128_t checksum = { 0x8877665544332211L, 0xFFEEDDCCBBAA9988L };
+                of_bsn_gentable_bucket_stats_entry_checksum_set(entry, checksum);
+            }
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        {
+            of_object_t *entry = of_bsn_gentable_bucket_stats_entry_new(OF_VERSION_1_3);
+            {
+                of_checksum_128_t checksum = { 0x1234234534564567L, 0x56786789789A89ABL };
+                of_bsn_gentable_bucket_stats_entry_checksum_set(entry, checksum);
+            }
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        of_bsn_gentable_bucket_stats_reply_entries_set(obj, list);
+        of_object_delete(list);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_gentable_clear_request.data */
+static const uint8_t of13_bsn_gentable_clear_request_binary[] = {
+    0x04, 0x04, 0x00, 0x34, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x14, 0x00, 0x00, 0xfe, 0xdc, 0xba, 0x98,
+    0x76, 0x54, 0x32, 0x10, 0xff, 0xee, 0xcc, 0xbb,
+    0xaa, 0x99, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_bsn_gentable_clear_request_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_gentable_clear_request_new(OF_VERSION_1_3);
+    of_bsn_gentable_clear_request_xid_set(obj, 0x12345678);
+    of_bsn_gentable_clear_request_table_id_set(obj, 20);
+    {
+        of_checksum_128_t checksum = { 0xFEDCBA9876543210L, 0xFFEECCBBAA990000L };
+        of_bsn_gentable_clear_request_checksum_set(obj, checksum);
+    }
+    {
+        of_checksum_128_t checksum_mask = { 0xFFFFFFFFFFFFFFFFL, 0xFFFFFFFFFFFF0000L };
+        of_bsn_gentable_clear_request_checksum_mask_set(obj, checksum_mask);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_gentable_desc_stats_reply.data */
+static const uint8_t of13_bsn_gentable_desc_stats_reply_binary[] = {
+    0x04, 0x13, 0x00, 0x78, 0x12, 0x34, 0x56, 0x78,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x30, 0x00, 0x00, 0x74, 0x61, 0x62, 0x6c,
+    0x65, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x01, 0x74, 0x61, 0x62, 0x6c,
+    0x65, 0x20, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_bsn_gentable_desc_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_gentable_desc_stats_reply_new(OF_VERSION_1_3);
+    of_bsn_gentable_desc_stats_reply_xid_set(obj, 0x12345678);
+    {
+        of_object_t *list = of_list_bsn_gentable_desc_stats_entry_new(OF_VERSION_1_3);
+        {
+            of_table_name_t name = "table 0";
+            of_object_t *entry = of_bsn_gentable_desc_stats_entry_new(OF_VERSION_1_3);
+            of_bsn_gentable_desc_stats_entry_table_id_set(entry, 0);
+            of_bsn_gentable_desc_stats_entry_name_set(entry, name);
+            of_bsn_gentable_desc_stats_entry_buckets_size_set(entry, 32);
+            of_bsn_gentable_desc_stats_entry_max_entries_set(entry, 64);
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        {
+            of_table_name_t name = "table 1.........................";
+            of_object_t *entry = of_bsn_gentable_desc_stats_entry_new(OF_VERSION_1_3);
+            of_bsn_gentable_desc_stats_entry_table_id_set(entry, 1);
+            of_bsn_gentable_desc_stats_entry_name_set(entry, name);
+            of_bsn_gentable_desc_stats_entry_buckets_size_set(entry, 64);
+            of_bsn_gentable_desc_stats_entry_max_entries_set(entry, 128);
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        of_bsn_gentable_desc_stats_reply_entries_set(obj, list);
+        of_object_delete(list);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_gentable_entry_add.data */
+static const uint8_t of13_bsn_gentable_entry_add_binary[] = {
+    0x04, 0x04, 0x00, 0x48, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x2e,
+    0x00, 0x14, 0x00, 0x12, 0xfe, 0xdc, 0xba, 0x98,
+    0x76, 0x54, 0x32, 0x10, 0xff, 0xee, 0xcc, 0xbb,
+    0xaa, 0x99, 0x88, 0x77, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x0a,
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01,
+    0x00, 0x0a, 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa,
+};
+
+static of_object_t *
+of13_bsn_gentable_entry_add_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_gentable_entry_add_new(OF_VERSION_1_3);
+    of_bsn_gentable_entry_add_xid_set(obj, 0x12345678);
+    of_bsn_gentable_entry_add_table_id_set(obj, 20);
+    {
+        of_checksum_128_t checksum = { 0xFEDCBA9876543210L, 0xFFEECCBBAA998877L };
+        of_bsn_gentable_entry_add_checksum_set(obj, checksum);
+    }
+    {
+        of_object_t *list = of_list_bsn_tlv_new(OF_VERSION_1_3);
+        {
+            of_object_t *tlv = of_bsn_tlv_port_new(OF_VERSION_1_3);
+            of_bsn_tlv_port_value_set(tlv, 5);
+            of_list_append(list, tlv);
+            of_object_delete(tlv);
+        }
+        {
+            of_mac_addr_t mac = { { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab } };
+            of_object_t *tlv = of_bsn_tlv_mac_new(OF_VERSION_1_3);
+            of_bsn_tlv_mac_value_set(tlv, mac);
+            of_list_append(list, tlv);
+            of_object_delete(tlv);
+        }
+        of_bsn_gentable_entry_add_key_set(obj, list);
+        of_object_delete(list);
+    }
+    {
+        of_object_t *list = of_list_bsn_tlv_new(OF_VERSION_1_3);
+        {
+            of_object_t *tlv = of_bsn_tlv_port_new(OF_VERSION_1_3);
+            of_bsn_tlv_port_value_set(tlv, 6);
+            of_list_append(list, tlv);
+            of_object_delete(tlv);
+        }
+        {
+            of_mac_addr_t mac = { { 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa } };
+            of_object_t *tlv = of_bsn_tlv_mac_new(OF_VERSION_1_3);
+            of_bsn_tlv_mac_value_set(tlv, mac);
+            of_list_append(list, tlv);
+            of_object_delete(tlv);
+        }
+        of_bsn_gentable_entry_add_value_set(obj, list);
+        of_object_delete(list);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_gentable_entry_delete.data */
+static const uint8_t of13_bsn_gentable_entry_delete_binary[] = {
+    0x04, 0x04, 0x00, 0x24, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x2f,
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x01, 0x23,
+    0x45, 0x67, 0x89, 0xab,
+};
+
+static of_object_t *
+of13_bsn_gentable_entry_delete_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_gentable_entry_delete_new(OF_VERSION_1_3);
+    of_bsn_gentable_entry_delete_xid_set(obj, 0x12345678);
+    of_bsn_gentable_entry_delete_table_id_set(obj, 20);
+    {
+        of_object_t *list = of_list_bsn_tlv_new(OF_VERSION_1_3);
+        {
+            of_object_t *tlv = of_bsn_tlv_port_new(OF_VERSION_1_3);
+            of_bsn_tlv_port_value_set(tlv, 5);
+            of_list_append(list, tlv);
+            of_object_delete(tlv);
+        }
+        {
+            of_mac_addr_t mac = { { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab } };
+            of_object_t *tlv = of_bsn_tlv_mac_new(OF_VERSION_1_3);
+            of_bsn_tlv_mac_value_set(tlv, mac);
+            of_list_append(list, tlv);
+            of_object_delete(tlv);
+        }
+        of_bsn_gentable_entry_delete_key_set(obj, list);
+        of_object_delete(list);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_gentable_entry_desc_stats_reply.data */
+static const uint8_t of13_bsn_gentable_entry_desc_stats_reply_binary[] = {
+    0x04, 0x13, 0x00, 0x64, 0x12, 0x34, 0x56, 0x78,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x26, 0x00, 0x08, 0xfe, 0xdc, 0xba, 0x98,
+    0x76, 0x54, 0x32, 0x10, 0xff, 0xee, 0xcc, 0xbb,
+    0xaa, 0x99, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x0a,
+    0xff, 0xee, 0xdd, 0xcc, 0xbb, 0x00, 0x00, 0x26,
+    0x00, 0x08, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54,
+    0x32, 0x10, 0xff, 0xee, 0xcc, 0xbb, 0xaa, 0x99,
+    0x88, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x01, 0x00, 0x0a, 0xff, 0xee,
+    0xdd, 0xcc, 0xbb, 0x01,
+};
+
+static of_object_t *
+of13_bsn_gentable_entry_desc_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_gentable_entry_desc_stats_reply_new(OF_VERSION_1_3);
+    of_bsn_gentable_entry_desc_stats_reply_xid_set(obj, 0x12345678);
+    {
+        of_object_t *list = of_list_bsn_gentable_entry_desc_stats_entry_new(OF_VERSION_1_3);
+        {
+            of_object_t *entry = of_bsn_gentable_entry_desc_stats_entry_new(OF_VERSION_1_3);
+            {
+                of_checksum_128_t checksum = { 0xFEDCBA9876543210L, 0xFFEECCBBAA998800L };
+                of_bsn_gentable_entry_desc_stats_entry_checksum_set(entry, checksum);
+            }
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_port_new(OF_VERSION_1_3);
+                    of_bsn_tlv_port_value_set(tlv, 5);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_desc_stats_entry_key_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_mac_new(OF_VERSION_1_3);
+                    of_mac_addr_t mac = { { 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0x00 } };
+                    of_bsn_tlv_mac_value_set(tlv, mac);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_desc_stats_entry_value_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        {
+            of_object_t *entry = of_bsn_gentable_entry_desc_stats_entry_new(OF_VERSION_1_3);
+            {
+                of_checksum_128_t checksum = { 0xFEDCBA9876543210L, 0xFFEECCBBAA998801L };
+                of_bsn_gentable_entry_desc_stats_entry_checksum_set(entry, checksum);
+            }
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_port_new(OF_VERSION_1_3);
+                    of_bsn_tlv_port_value_set(tlv, 6);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_desc_stats_entry_key_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_mac_new(OF_VERSION_1_3);
+                    of_mac_addr_t mac = { { 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0x01 } };
+                    of_bsn_tlv_mac_value_set(tlv, mac);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_desc_stats_entry_value_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        of_bsn_gentable_entry_desc_stats_reply_entries_set(obj, list);
+        of_object_delete(list);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_gentable_entry_stats_reply.data */
+static const uint8_t of13_bsn_gentable_entry_stats_reply_binary[] = {
+    0x04, 0x13, 0x00, 0x60, 0x12, 0x34, 0x56, 0x78,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x24, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+    0x00, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x65, 0x00, 0x24, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x64, 0x00, 0x03, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+};
+
+static of_object_t *
+of13_bsn_gentable_entry_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_gentable_entry_stats_reply_new(OF_VERSION_1_3);
+    of_bsn_gentable_entry_stats_reply_xid_set(obj, 0x12345678);
+    {
+        of_object_t *list = of_list_bsn_gentable_entry_stats_entry_new(OF_VERSION_1_3);
+        {
+            of_object_t *entry = of_bsn_gentable_entry_stats_entry_new(OF_VERSION_1_3);
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_port_new(OF_VERSION_1_3);
+                    of_bsn_tlv_port_value_set(tlv, 5);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_stats_entry_key_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_rx_packets_new(OF_VERSION_1_3);
+                    of_bsn_tlv_rx_packets_value_set(tlv, 100);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                {
+                    of_object_t *tlv = of_bsn_tlv_tx_packets_new(OF_VERSION_1_3);
+                    of_bsn_tlv_tx_packets_value_set(tlv, 101);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_stats_entry_stats_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        {
+            of_object_t *entry = of_bsn_gentable_entry_stats_entry_new(OF_VERSION_1_3);
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_port_new(OF_VERSION_1_3);
+                    of_bsn_tlv_port_value_set(tlv, 6);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_stats_entry_key_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            {
+                of_object_t *tlvs = of_list_bsn_tlv_new(OF_VERSION_1_3);
+                {
+                    of_object_t *tlv = of_bsn_tlv_rx_packets_new(OF_VERSION_1_3);
+                    of_bsn_tlv_rx_packets_value_set(tlv, 100);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                {
+                    of_object_t *tlv = of_bsn_tlv_tx_packets_new(OF_VERSION_1_3);
+                    of_bsn_tlv_tx_packets_value_set(tlv, 101);
+                    of_list_append(tlvs, tlv);
+                    of_object_delete(tlv);
+                }
+                of_bsn_gentable_entry_stats_entry_stats_set(entry, tlvs);
+                of_object_delete(tlvs);
+            }
+            of_list_append(list, entry);
+            of_object_delete(entry);
+        }
+        of_bsn_gentable_entry_stats_reply_entries_set(obj, list);
+        of_object_delete(list);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_lacp_stats_reply.data */
+static const uint8_t of13_bsn_lacp_stats_reply_binary[] = {
+    0x04, 0x13, 0x00, 0x3c, 0x12, 0x34, 0x56, 0x78,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xf1, 0x11, 0xf2, 0x22, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0xf3, 0x33, 0xf4, 0x44,
+    0xf5, 0x55, 0x02, 0x00, 0xf6, 0x66, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0xf7, 0x77, 0xf8, 0x88,
+    0xf9, 0x99, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_bsn_lacp_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_lacp_stats_reply_new(OF_VERSION_1_3);
+    of_bsn_lacp_stats_reply_xid_set(obj, 0x12345678);
+    {
+        of_object_t *entries = of_list_bsn_lacp_stats_entry_new(OF_VERSION_1_3);
+        {
+            of_object_t *elem = of_bsn_lacp_stats_entry_new(OF_VERSION_1_3);
+            of_bsn_lacp_stats_entry_port_no_set(elem, 0xf111);
+            of_bsn_lacp_stats_entry_actor_sys_priority_set(elem, 0xf222);
+            {
+                of_mac_addr_t mac = { { 1, 2, 3, 4, 5, 6 } };
+                of_bsn_lacp_stats_entry_actor_sys_mac_set(elem, mac);
+            }
+            of_bsn_lacp_stats_entry_actor_port_priority_set(elem, 0xf333);
+            of_bsn_lacp_stats_entry_actor_port_num_set(elem, 0xf444);
+            of_bsn_lacp_stats_entry_actor_key_set(elem, 0xf555);
+            of_bsn_lacp_stats_entry_partner_sys_priority_set(elem, 0xf666);
+            of_bsn_lacp_stats_entry_convergence_status_set(elem, LACP_OUT_OF_SYNC);
+            {
+                of_mac_addr_t mac = { { 0xa, 0xb, 0xc, 0xd, 0xe, 0xf } };
+                of_bsn_lacp_stats_entry_partner_sys_mac_set(elem, mac);
+            }
+            of_bsn_lacp_stats_entry_partner_port_priority_set(elem, 0xf777);
+            of_bsn_lacp_stats_entry_partner_port_num_set(elem, 0xf888);
+            of_bsn_lacp_stats_entry_partner_key_set(elem, 0xf999);
+            of_list_append(entries, elem);
+            of_object_delete(elem);
+        }
+        of_bsn_lacp_stats_reply_entries_set(obj, entries);
+        of_object_delete(entries);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_lacp_stats_request.data */
+static const uint8_t of13_bsn_lacp_stats_request_binary[] = {
+    0x04, 0x12, 0x00, 0x18, 0x12, 0x34, 0x56, 0x78,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x01,
+};
+
+static of_object_t *
+of13_bsn_lacp_stats_request_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_lacp_stats_request_new(OF_VERSION_1_3);
+    of_bsn_lacp_stats_request_xid_set(obj, 0x12345678);
+    return obj;
+}
+
+/* Generated from of13/bsn_set_aux_cxns_reply.data */
+static const uint8_t of13_bsn_set_aux_cxns_reply_binary[] = {
+    0x04, 0x04, 0x00, 0x18, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_bsn_set_aux_cxns_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_set_aux_cxns_reply_new(OF_VERSION_1_3);
+    of_bsn_set_aux_cxns_reply_xid_set(obj, 0x12345678);
+    of_bsn_set_aux_cxns_reply_num_aux_set(obj, 1);
+    of_bsn_set_aux_cxns_reply_status_set(obj, 0);
+    return obj;
+}
+
+/* Generated from of13/bsn_set_aux_cxns_request.data */
+static const uint8_t of13_bsn_set_aux_cxns_request_binary[] = {
+    0x04, 0x04, 0x00, 0x14, 0x12, 0x34, 0x56, 0x78,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x3a,
+    0x00, 0x00, 0x00, 0x01,
+};
+
+static of_object_t *
+of13_bsn_set_aux_cxns_request_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_set_aux_cxns_request_new(OF_VERSION_1_3);
+    of_bsn_set_aux_cxns_request_xid_set(obj, 0x12345678);
+    of_bsn_set_aux_cxns_request_num_aux_set(obj, 1);
+    return obj;
+}
+
+/* Generated from of13/bsn_virtual_port_create_request__l2gre.data */
+static const uint8_t of13_bsn_virtual_port_create_request__l2gre_binary[] = {
+    0x04, 0x04, 0x00, 0x50, 0x01, 0x02, 0x03, 0x04,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0xc0, 0x00, 0x00, 0x02,
+    0xc0, 0x00, 0x10, 0x02, 0x01, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xbe, 0xef, 0x00, 0x00, 0x04, 0x00,
+    0x66, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_bsn_virtual_port_create_request__l2gre_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_virtual_port_create_request_new(OF_VERSION_1_3);
+    of_bsn_virtual_port_create_request_xid_set(obj, 0x01020304);
+    {
+        of_object_t *vport = of_bsn_vport_l2gre_new(OF_VERSION_1_3);
+        {
+            of_port_name_t if_name = "foo";
+            of_mac_addr_t local_mac = { { 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f } };
+            of_mac_addr_t nh_mac = { { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 } };
+            of_bsn_vport_l2gre_flags_set(vport,
+                OF_BSN_VPORT_L2GRE_LOCAL_MAC_IS_VALID |
+                OF_BSN_VPORT_L2GRE_DSCP_ASSIGN |
+                OF_BSN_VPORT_L2GRE_LOOPBACK_IS_VALID |
+                OF_BSN_VPORT_L2GRE_RATE_LIMIT_IS_VALID);
+            of_bsn_vport_l2gre_port_no_set(vport, 1);
+            of_bsn_vport_l2gre_loopback_port_no_set(vport, 2);
+            of_bsn_vport_l2gre_local_mac_set(vport, local_mac);
+            of_bsn_vport_l2gre_nh_mac_set(vport, nh_mac);
+            of_bsn_vport_l2gre_src_ip_set(vport, 0xc0000002);
+            of_bsn_vport_l2gre_dst_ip_set(vport, 0xc0001002);
+            of_bsn_vport_l2gre_dscp_set(vport, 1);
+            of_bsn_vport_l2gre_ttl_set(vport, 64);
+            of_bsn_vport_l2gre_vpn_set(vport, 0xbeef);
+            of_bsn_vport_l2gre_rate_limit_set(vport, 0x400);
+            of_bsn_vport_l2gre_if_name_set(vport, if_name);
+        }
+        of_bsn_virtual_port_create_request_vport_set(obj, vport);
+        of_object_delete(vport);
+    }
+    return obj;
+}
+
+/* Generated from of13/bsn_virtual_port_create_request__q_in_q.data */
+static const uint8_t of13_bsn_virtual_port_create_request__q_in_q_binary[] = {
+    0x04, 0x04, 0x00, 0x30, 0x01, 0x02, 0x03, 0x04,
+    0x00, 0x5c, 0x16, 0xc7, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05,
+    0x66, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_bsn_virtual_port_create_request__q_in_q_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_bsn_virtual_port_create_request_new(OF_VERSION_1_3);
+    of_bsn_virtual_port_create_request_xid_set(obj, 0x01020304);
+    {
+        of_object_t *vport = of_bsn_vport_q_in_q_new(OF_VERSION_1_3);
+        {
+            of_port_name_t if_name = "foo";
+            of_bsn_vport_q_in_q_port_no_set(vport, 1);
+            of_bsn_vport_q_in_q_ingress_tpid_set(vport, 2);
+            of_bsn_vport_q_in_q_ingress_vlan_id_set(vport, 3);
+            of_bsn_vport_q_in_q_egress_tpid_set(vport, 4);
+            of_bsn_vport_q_in_q_egress_vlan_id_set(vport, 5);
+            of_bsn_vport_q_in_q_if_name_set(vport, if_name);
+        }
+        of_bsn_virtual_port_create_request_vport_set(obj, vport);
+        of_object_delete(vport);
+    }
+    return obj;
+}
+
+/* Generated from of13/instruction_bsn_disable_src_mac_check.data */
+static const uint8_t of13_instruction_bsn_disable_src_mac_check_binary[] = {
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x5c, 0x16, 0xc7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static of_object_t *
+of13_instruction_bsn_disable_src_mac_check_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_instruction_bsn_disable_src_mac_check_new(OF_VERSION_1_3);
+    return obj;
+}
+
+/* Generated from of13/instruction_id_goto_table.data */
+static const uint8_t of13_instruction_id_goto_table_binary[] = {
+    0x00, 0x01, 0x00, 0x04,
+};
+
+static of_object_t *
+of13_instruction_id_goto_table_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_instruction_id_goto_table_new(OF_VERSION_1_3);
+    return obj;
+}
+
+/* Generated from of13/oxm_bsn_global_vrf_allowed.data */
+static const uint8_t of13_oxm_bsn_global_vrf_allowed_binary[] = {
+    0x00, 0x03, 0x06, 0x01, 0x01,
+};
+
+static of_object_t *
+of13_oxm_bsn_global_vrf_allowed_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_oxm_bsn_global_vrf_allowed_new(OF_VERSION_1_3);
+    of_oxm_bsn_global_vrf_allowed_value_set(obj, 1);
+    return obj;
+}
+
+/* Generated from of13/oxm_bsn_in_ports_masked_128.data */
+static const uint8_t of13_oxm_bsn_in_ports_masked_128_binary[] = {
+    0x00, 0x03, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0xff, 0xfe,
+};
+
+static of_object_t *
+of13_oxm_bsn_in_ports_masked_128_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_oxm_bsn_in_ports_128_masked_new(OF_VERSION_1_3);
+    {
+        of_bitmap_128_t bmap = { 0, 0 };
+        of_oxm_bsn_in_ports_128_masked_value_set(obj, bmap);
+    }
+    {
+        of_bitmap_128_t bmap = { 0xfffffffeffffffff , 0xfffffffffffdfffe };
+        of_oxm_bsn_in_ports_128_masked_value_mask_set(obj, bmap);
+    }
+    return obj;
+}
+
+/* Generated from of13/oxm_bsn_in_ports_masked_512.data */
+static const uint8_t of13_oxm_bsn_in_ports_masked_512_binary[] = {
+    0x00, 0x03, 0x27, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0xff, 0xfe,
+};
+
+static of_object_t *
+of13_oxm_bsn_in_ports_masked_512_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_oxm_bsn_in_ports_512_masked_new(OF_VERSION_1_3);
+    {
+        of_bitmap_512_t bmap = { { 0, 0, 0, 0, 0, 0, 0, 0 } };
+        of_oxm_bsn_in_ports_512_masked_value_set(obj, bmap);
+    }
+    {
+        of_bitmap_512_t bmap = { { 0x7fffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffeffffffff, 0xfffffffffffdfffe } };
+        of_oxm_bsn_in_ports_512_masked_value_mask_set(obj, bmap);
+    }
+    return obj;
+}
+
+/* Generated from of13/oxm_bsn_l3_src_class_id.data */
+static const uint8_t of13_oxm_bsn_l3_src_class_id_binary[] = {
+    0x00, 0x03, 0x0a, 0x04, 0x12, 0x34, 0x56, 0x78,
+};
+
+static of_object_t *
+of13_oxm_bsn_l3_src_class_id_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_oxm_bsn_l3_src_class_id_new(OF_VERSION_1_3);
+    of_oxm_bsn_l3_src_class_id_value_set(obj, 0x12345678);
+    return obj;
+}
+
+/* Generated from of13/oxm_bsn_lag_id.data */
+static const uint8_t of13_oxm_bsn_lag_id_binary[] = {
+    0x00, 0x03, 0x02, 0x04, 0x12, 0x34, 0x56, 0x78,
+};
+
+static of_object_t *
+of13_oxm_bsn_lag_id_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_oxm_bsn_lag_id_new(OF_VERSION_1_3);
+    of_oxm_bsn_lag_id_value_set(obj, 0x12345678);
+    return obj;
+}
+
+/* Generated from of13/port_status.data */
+static const uint8_t of13_port_status_binary[] = {
+    0x04, 0x0c, 0x00, 0x50, 0x12, 0x34, 0x56, 0x78,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00,
+    0x66, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x14,
+};
+
+static of_object_t *
+of13_port_status_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_port_status_new(OF_VERSION_1_3);
+    of_port_status_xid_set(obj, 0x12345678);
+    of_port_status_reason_set(obj, OF_PORT_CHANGE_REASON_MODIFY);
+    {
+        of_object_t desc;
+        of_port_status_desc_bind(obj, &desc);
+        of_port_desc_port_no_set(&desc, 4);
+        of_mac_addr_t hw_addr = { { 1, 2, 3, 4, 5, 6 } };
+        of_port_desc_hw_addr_set(&desc, hw_addr);
+        of_port_name_t name = "foo";
+        of_port_desc_name_set(&desc, name);
+        of_port_desc_config_set(&desc, OF_PORT_CONFIG_FLAG_NO_FWD|OF_PORT_CONFIG_FLAG_NO_RECV);
+        of_port_desc_state_set(&desc, OF_PORT_STATE_FLAG_BLOCKED);
+        of_port_desc_curr_set(&desc, OF_PORT_FEATURE_FLAG_10MB_HD);
+        of_port_desc_advertised_set(&desc, OF_PORT_FEATURE_FLAG_10MB_FD);
+        of_port_desc_supported_set(&desc, OF_PORT_FEATURE_FLAG_100MB_HD);
+        of_port_desc_peer_set(&desc, OF_PORT_FEATURE_FLAG_100MB_FD);
+        of_port_desc_curr_speed_set(&desc, 10);
+        of_port_desc_max_speed_set(&desc, 20);
+    }
+    return obj;
+}
+
+/* Generated from of14/port_stats_reply.data */
+static const uint8_t of14_port_stats_reply_binary[] = {
+    0x05, 0x13, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x50, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+};
+
+static of_object_t *
+of14_port_stats_reply_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_port_stats_reply_new(OF_VERSION_1_4);
+    {
+        of_object_t list;
+        of_port_stats_reply_entries_bind(obj, &list);
+        {
+            of_object_t *obj = of_port_stats_entry_new(OF_VERSION_1_4);
+            of_port_stats_entry_port_no_set(obj, 1);
+            of_port_stats_entry_rx_packets_set(obj, 1);
+            of_port_stats_entry_tx_packets_set(obj, 0);
+            of_port_stats_entry_rx_bytes_set(obj, 0);
+            of_port_stats_entry_tx_bytes_set(obj, 0);
+            of_port_stats_entry_rx_dropped_set(obj, 0);
+            of_port_stats_entry_tx_dropped_set(obj, 0);
+            of_port_stats_entry_rx_errors_set(obj, 0);
+            of_port_stats_entry_tx_errors_set(obj, 2);
+            /* Append property */
+            {
+                of_object_t list;
+                of_port_stats_entry_properties_bind(obj, &list);
+                {
+                    of_object_t *obj = of_port_stats_prop_ethernet_new(OF_VERSION_1_4);
+                    of_port_stats_prop_ethernet_rx_frame_err_set(obj, 1);
+                    of_port_stats_prop_ethernet_rx_over_err_set(obj, 2);
+                    of_port_stats_prop_ethernet_rx_crc_err_set(obj, 3);
+                    of_port_stats_prop_ethernet_collisions_set(obj, 4);
+                    of_list_append(&list, obj);
+                    of_object_delete(obj);
+                }
+            }
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+        {
+            of_object_t *obj = of_port_stats_entry_new(OF_VERSION_1_4);
+            of_port_stats_entry_port_no_set(obj, OF_PORT_DEST_LOCAL);
+            of_port_stats_entry_rx_packets_set(obj, 3);
+            of_port_stats_entry_tx_packets_set(obj, 0);
+            of_port_stats_entry_rx_bytes_set(obj, 0);
+            of_port_stats_entry_tx_bytes_set(obj, 0);
+            of_port_stats_entry_rx_dropped_set(obj, 0);
+            of_port_stats_entry_tx_dropped_set(obj, 0);
+            of_port_stats_entry_rx_errors_set(obj, 0);
+            of_port_stats_entry_tx_errors_set(obj, 4);
+            of_list_append(&list, obj);
+            of_object_delete(obj);
+        }
+    }
+    of_port_stats_reply_flags_set(obj, 0);
+    of_port_stats_reply_xid_set(obj, 5);
+    return obj;
+}
+
+/* Generated from of14/port_status.data */
+static const uint8_t of14_port_status_binary[] = {
+    0x05, 0x0c, 0x00, 0x58, 0x12, 0x34, 0x56, 0x78,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x48, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00,
+    0x66, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x14,
+};
+
+static of_object_t *
+of14_port_status_build(void)
+{
+    of_object_t *obj;
+
+    obj = of_port_status_new(OF_VERSION_1_4);
+    of_port_status_xid_set(obj, 0x12345678);
+    of_port_status_reason_set(obj, OF_PORT_CHANGE_REASON_MODIFY);
+    {
+        of_object_t desc;
+        of_port_status_desc_bind(obj, &desc);
+        of_port_desc_port_no_set(&desc, 4);
+        of_mac_addr_t hw_addr = { { 1, 2, 3, 4, 5, 6 } };
+        of_port_desc_hw_addr_set(&desc, hw_addr);
+        of_port_name_t name = "foo";
+        of_port_desc_name_set(&desc, name);
+        of_port_desc_config_set(&desc, OF_PORT_CONFIG_FLAG_NO_FWD|OF_PORT_CONFIG_FLAG_NO_RECV);
+        of_port_desc_state_set(&desc, OF_PORT_STATE_FLAG_BLOCKED);
+        {
+            of_list_port_desc_prop_t list;
+            of_port_desc_properties_bind(&desc, &list);
+            {
+                of_object_t *obj = of_port_desc_prop_ethernet_new(OF_VERSION_1_4);
+                of_port_desc_prop_ethernet_curr_set(obj, OF_PORT_FEATURE_FLAG_10MB_HD);
+                of_port_desc_prop_ethernet_advertised_set(obj, OF_PORT_FEATURE_FLAG_10MB_FD);
+                of_port_desc_prop_ethernet_supported_set(obj, OF_PORT_FEATURE_FLAG_100MB_HD);
+                of_port_desc_prop_ethernet_peer_set(obj, OF_PORT_FEATURE_FLAG_100MB_FD);
+                of_port_desc_prop_ethernet_curr_speed_set(obj, 10);
+                of_port_desc_prop_ethernet_max_speed_set(obj, 20);
+                of_list_append(&list, obj);
+                of_object_delete(obj);
+            }
+        }
+    }
+    return obj;
+}
+
+const locibench_data_t locibench_data[] = {
+    { "of10/action_bsn_set_tunnel_dst", OF_VERSION_1_0, of10_action_bsn_set_tunnel_dst_build, of10_action_bsn_set_tunnel_dst_binary, sizeof(of10_action_bsn_set_tunnel_dst_binary) },
+    { "of10/desc_stats_reply", OF_VERSION_1_0, of10_desc_stats_reply_build, of10_desc_stats_reply_binary, sizeof(of10_desc_stats_reply_binary) },
+    { "of10/echo_request", OF_VERSION_1_0, of10_echo_request_build, of10_echo_request_binary, sizeof(of10_echo_request_binary) },
+    { "of10/flow_add", OF_VERSION_1_0, of10_flow_add_build, of10_flow_add_binary, sizeof(of10_flow_add_binary) },
+    { "of10/flow_stats_entry", OF_VERSION_1_0, of10_flow_stats_entry_build, of10_flow_stats_entry_binary, sizeof(of10_flow_stats_entry_binary) },
+    { "of10/flow_stats_reply", OF_VERSION_1_0, of10_flow_stats_reply_build, of10_flow_stats_reply_binary, sizeof(of10_flow_stats_reply_binary) },
+    { "of10/hello", OF_VERSION_1_0, of10_hello_build, of10_hello_binary, sizeof(of10_hello_binary) },
+    { "of10/packet_in", OF_VERSION_1_0, of10_packet_in_build, of10_packet_in_binary, sizeof(of10_packet_in_binary) },
+    { "of10/packet_out", OF_VERSION_1_0, of10_packet_out_build, of10_packet_out_binary, sizeof(of10_packet_out_binary) },
+    { "of10/port_desc", OF_VERSION_1_0, of10_port_desc_build, of10_port_desc_binary, sizeof(of10_port_desc_binary) },
+    { "of10/port_mod", OF_VERSION_1_0, of10_port_mod_build, of10_port_mod_binary, sizeof(of10_port_mod_binary) },
+    { "of10/port_stats_reply", OF_VERSION_1_0, of10_port_stats_reply_build, of10_port_stats_reply_binary, sizeof(of10_port_stats_reply_binary) },
+    { "of10/port_status", OF_VERSION_1_0, of10_port_status_build, of10_port_status_binary, sizeof(of10_port_status_binary) },
+    { "of10/queue_get_config_reply", OF_VERSION_1_0, of10_queue_get_config_reply_build, of10_queue_get_config_reply_binary, sizeof(of10_queue_get_config_reply_binary) },
+    { "of10/table_stats_entry", OF_VERSION_1_0, of10_table_stats_entry_build, of10_table_stats_entry_binary, sizeof(of10_table_stats_entry_binary) },
+    { "of13/action_id_output", OF_VERSION_1_3, of13_action_id_output_build, of13_action_id_output_binary, sizeof(of13_action_id_output_binary) },
+    { "of13/bad_match_error_msg", OF_VERSION_1_3, of13_bad_match_error_msg_build, of13_bad_match_error_msg_binary, sizeof(of13_bad_match_error_msg_binary) },
+    { "of13/bad_request_error_msg", OF_VERSION_1_3, of13_bad_request_error_msg_build, of13_bad_request_error_msg_binary, sizeof(of13_bad_request_error_msg_binary) },
+    { "of13/bsn_flow_idle", OF_VERSION_1_3, of13_bsn_flow_idle_build, of13_bsn_flow_idle_binary, sizeof(of13_bsn_flow_idle_binary) },
+    { "of13/bsn_gentable_bucket_stats_reply", OF_VERSION_1_3, of13_bsn_gentable_bucket_stats_reply_build, of13_bsn_gentable_bucket_stats_reply_binary, sizeof(of13_bsn_gentable_bucket_stats_reply_binary) },
+    { "of13/bsn_gentable_clear_request", OF_VERSION_1_3, of13_bsn_gentable_clear_request_build, of13_bsn_gentable_clear_request_binary, sizeof(of13_bsn_gentable_clear_request_binary) },
+    { "of13/bsn_gentable_desc_stats_reply", OF_VERSION_1_3, of13_bsn_gentable_desc_stats_reply_build, of13_bsn_gentable_desc_stats_reply_binary, sizeof(of13_bsn_gentable_desc_stats_reply_binary) },
+    { "of13/bsn_gentable_entry_add", OF_VERSION_1_3, of13_bsn_gentable_entry_add_build, of13_bsn_gentable_entry_add_binary, sizeof(of13_bsn_gentable_entry_add_binary) },
+    { "of13/bsn_gentable_entry_delete", OF_VERSION_1_3, of13_bsn_gentable_entry_delete_build, of13_bsn_gentable_entry_delete_binary, sizeof(of13_bsn_gentable_entry_delete_binary) },
+    { "of13/bsn_gentable_entry_desc_stats_reply", OF_VERSION_1_3, of13_bsn_gentable_entry_desc_stats_reply_build, of13_bsn_gentable_entry_desc_stats_reply_binary, sizeof(of13_bsn_gentable_entry_desc_stats_reply_binary) },
+    { "of13/bsn_gentable_entry_stats_reply", OF_VERSION_1_3, of13_bsn_gentable_entry_stats_reply_build, of13_bsn_gentable_entry_stats_reply_binary, sizeof(of13_bsn_gentable_entry_stats_reply_binary) },
+    { "of13/bsn_lacp_stats_reply", OF_VERSION_1_3, of13_bsn_lacp_stats_reply_build, of13_bsn_lacp_stats_reply_binary, sizeof(of13_bsn_lacp_stats_reply_binary) },
+    { "of13/bsn_lacp_stats_request", OF_VERSION_1_3, of13_bsn_lacp_stats_request_build, of13_bsn_lacp_stats_request_binary, sizeof(of13_bsn_lacp_stats_request_binary) },
+    { "of13/bsn_set_aux_cxns_reply", OF_VERSION_1_3, of13_bsn_set_aux_cxns_reply_build, of13_bsn_set_aux_cxns_reply_binary, sizeof(of13_bsn_set_aux_cxns_reply_binary) },
+    { "of13/bsn_set_aux_cxns_request", OF_VERSION_1_3, of13_bsn_set_aux_cxns_request_build, of13_bsn_set_aux_cxns_request_binary, sizeof(of13_bsn_set_aux_cxns_request_binary) },
+    { "of13/bsn_virtual_port_create_request__l2gre", OF_VERSION_1_3, of13_bsn_virtual_port_create_request__l2gre_build, of13_bsn_virtual_port_create_request__l2gre_binary, sizeof(of13_bsn_virtual_port_create_request__l2gre_binary) },
+    { "of13/bsn_virtual_port_create_request__q_in_q", OF_VERSION_1_3, of13_bsn_virtual_port_create_request__q_in_q_build, of13_bsn_virtual_port_create_request__q_in_q_binary, sizeof(of13_bsn_virtual_port_create_request__q_in_q_binary) },
+    { "of13/instruction_bsn_disable_src_mac_check", OF_VERSION_1_3, of13_instruction_bsn_disable_src_mac_check_build, of13_instruction_bsn_disable_src_mac_check_binary, sizeof(of13_instruction_bsn_disable_src_mac_check_binary) },
+    { "of13/instruction_id_goto_table", OF_VERSION_1_3, of13_instruction_id_goto_table_build, of13_instruction_id_goto_table_binary, sizeof(of13_instruction_id_goto_table_binary) },
+    { "of13/oxm_bsn_global_vrf_allowed", OF_VERSION_1_3, of13_oxm_bsn_global_vrf_allowed_build, of13_oxm_bsn_global_vrf_allowed_binary, sizeof(of13_oxm_bsn_global_vrf_allowed_binary) },
+    { "of13/oxm_bsn_in_ports_masked_128", OF_VERSION_1_3, of13_oxm_bsn_in_ports_masked_128_build, of13_oxm_bsn_in_ports_masked_128_binary, sizeof(of13_oxm_bsn_in_ports_masked_128_binary) },
+    { "of13/oxm_bsn_in_ports_masked_512", OF_VERSION_1_3, of13_oxm_bsn_in_ports_masked_512_build, of13_oxm_bsn_in_ports_masked_512_binary, sizeof(of13_oxm_bsn_in_ports_masked_512_binary) },
+    { "of13/oxm_bsn_l3_src_class_id", OF_VERSION_1_3, of13_oxm_bsn_l3_src_class_id_build, of13_oxm_bsn_l3_src_class_id_binary, sizeof(of13_oxm_bsn_l3_src_class_id_binary) },
+    { "of13/oxm_bsn_lag_id", OF_VERSION_1_3, of13_oxm_bsn_lag_id_build, of13_oxm_bsn_lag_id_binary, sizeof(of13_oxm_bsn_lag_id_binary) },
+    { "of13/port_status", OF_VERSION_1_3, of13_port_status_build, of13_port_status_binary, sizeof(of13_port_status_binary) },
+    { "of14/port_stats_reply", OF_VERSION_1_4, of14_port_stats_reply_build, of14_port_stats_reply_binary, sizeof(of14_port_stats_reply_binary) },
+    { "of14/port_status", OF_VERSION_1_4, of14_port_status_build, of14_port_status_binary, sizeof(of14_port_status_binary) },
+    { NULL },
+};
@@ -0,0 +1,161 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_export.c
+ *
+ * Compare the text (show, dump) and structured (JSON, binary log)
+ * object serializers.
+ *
+ * The text serializers write through locibench_text_writer; the
+ * structured ones through a stream that discards output on flush.
+ * Neither path allocates.
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_dump.h>
+#include <loci/loci_show.h>
+#include <loci/loci_json.h>
+#include <loci/loci_binlog.h>
+
+static int
+discard_flush(void *cookie, const uint8_t *data, int len)
+{
+    locibench_sink += data[0];
+    return OF_ERROR_NONE;
+}
+
+static of_object_t *
+packet_in_new(void)
+{
+    of_packet_in_t *obj = of_packet_in_new(OF_VERSION_1_3);
+    of_match_t match;
+    uint8_t data[128];
+    of_octets_t octets = { data, sizeof(data) };
+
+    memset(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.in_port = 3;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+    match.fields.eth_type = 0x800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+    memset(data, 0x5a, sizeof(data));
+
+    of_packet_in_xid_set(obj, 0x12345678);
+    of_packet_in_buffer_id_set(obj, -1);
+    of_packet_in_total_len_set(obj, sizeof(data));
+    of_packet_in_cookie_set(obj, 0x0123456789abcdefULL);
+    if (of_packet_in_match_set(obj, &match) < 0 ||
+        of_packet_in_data_set(obj, &octets) < 0) {
+        of_packet_in_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static of_object_t *
+flow_stats_reply_new(int entries)
+{
+    of_flow_stats_reply_t *obj = of_flow_stats_reply_new(OF_VERSION_1_0);
+    of_list_flow_stats_entry_t list;
+    of_flow_stats_entry_t *entry;
+    of_list_action_t actions;
+    of_action_output_t output;
+    of_match_t match;
+    int i;
+
+    of_flow_stats_reply_entries_bind(obj, &list);
+    for (i = 0; i < entries; i++) {
+        entry = of_flow_stats_entry_new(OF_VERSION_1_0);
+        memset(&match, 0, sizeof(match));
+        match.version = OF_VERSION_1_0;
+        match.fields.in_port = i;
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+        match.fields.ipv4_dst = 0x0a000000 + i;
+        OF_MATCH_MASK_IPV4_DST_EXACT_SET(&match);
+        match.fields.eth_type = 0x800;
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+        of_flow_stats_entry_priority_set(entry, 100);
+        of_flow_stats_entry_packet_count_set(entry, i * 1000);
+        of_flow_stats_entry_byte_count_set(entry, i * 64000);
+        of_flow_stats_entry_actions_bind(entry, &actions);
+        of_action_output_init(&output, OF_VERSION_1_0, -1, 1);
+        if (of_flow_stats_entry_match_set(entry, &match) < 0 ||
+            of_list_action_append_bind(&actions, &output) < 0 ||
+            of_list_flow_stats_entry_append(&list, entry) < 0) {
+            of_flow_stats_entry_delete(entry);
+            of_flow_stats_reply_delete(obj);
+            return NULL;
+        }
+        of_action_output_port_set(&output, i + 1);
+        of_flow_stats_entry_delete(entry);
+    }
+
+    return obj;
+}
+
+static void
+bench_object(const char *prefix, of_object_t *obj)
+{
+    static locibench_text_t tb;
+    uint8_t buf[4096];
+    loci_stream_t s;
+    char name[64];
+    uint64_t start;
+    int i, n = locibench_iterations;
+
+    locibench_text_reset(&tb);
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_show(locibench_text_writer, &tb, obj);
+    }
+    snprintf(name, sizeof(name), "%s/show", prefix);
+    locibench_report(name, n, start, locibench_text_bytes(&tb) / n);
+
+    locibench_text_reset(&tb);
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_dump(locibench_text_writer, &tb, obj);
+    }
+    snprintf(name, sizeof(name), "%s/dump", prefix);
+    locibench_report(name, n, start, locibench_text_bytes(&tb) / n);
+
+    loci_stream_init(&s, buf, sizeof(buf), discard_flush, NULL);
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_json(&s, obj);
+    }
+    snprintf(name, sizeof(name), "%s/json", prefix);
+    locibench_report(name, n, start, loci_stream_finish(&s) / n);
+
+    loci_stream_init(&s, buf, sizeof(buf), discard_flush, NULL);
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_object_binlog(&s, obj);
+    }
+    snprintf(name, sizeof(name), "%s/binlog", prefix);
+    locibench_report(name, n, start, loci_stream_finish(&s) / n);
+}
+
+int
+bench_export(void)
+{
+    of_object_t *obj;
+
+    if ((obj = packet_in_new()) == NULL) {
+        return -1;
+    }
+    bench_object("export/packet_in", obj);
+    of_object_delete(obj);
+
+    if ((obj = flow_stats_reply_new(16)) == NULL) {
+        return -1;
+    }
+    bench_object("export/flow_stats_reply_16", obj);
+    of_object_delete(obj);
+
+    return 0;
+}
@@ -0,0 +1,332 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_gentable.c
+ *
+ * BSN gentable store of 10k and 1M entries in 65536 checksum buckets.
+ * Keys are a port and a VLAN TLV, values a MAC and an IPv4 TLV, as an
+ * L2 or ARP table would have.
+ *
+ *   gentable/<entries>/add           loci_gentable_add, per entry
+ *   gentable/<entries>/lookup        loci_gentable_lookup of a random
+ *                                    entry
+ *   gentable/<entries>/bucket_stats  bucket stats replies for all
+ *                                    buckets, per bucket
+ *   gentable/<entries>/entry_desc    entry desc replies for the
+ *                                    entries of one bucket, per bucket
+ *                                    as a resync of a differing bucket
+ *   gentable/<entries>/resync        loci_gentable_resync of a switch
+ *                                    with every 100th entry changed, per
+ *                                    changed entry, the switch's side
+ *                                    included
+ *   gentable/<entries>/delete        loci_gentable_delete, per entry
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_gentable.h>
+#include <loci/loci_gentable_resync.h>
+
+#define BUCKETS 65536
+#define KEY_BYTES 14
+#define VALUE_BYTES 18
+#define REPLIES_MAX 64
+
+/* The switch end of a resync: a table and the replies not yet taken */
+typedef struct bench_switch_s {
+    loci_gentable_t gt;
+    of_object_t *replies[REPLIES_MAX];
+    int head;
+    int tail;
+} bench_switch_t;
+
+static const struct {
+    const char *name;
+    uint32_t count;
+} sizes[] = {
+    { "10k", 10000 },
+    { "1M", 1000000 },
+};
+
+static void
+key_build(uint32_t i, uint8_t *key)
+{
+    buf_u16_set(key, 0);
+    buf_u16_set(key + 2, 8);
+    buf_u32_set(key + 4, i >> 12);
+    buf_u16_set(key + 8, 6);
+    buf_u16_set(key + 10, 6);
+    buf_u16_set(key + 12, i & 0xfff);
+}
+
+static void
+value_build(uint32_t i, uint8_t *value)
+{
+    buf_u16_set(value, 1);
+    buf_u16_set(value + 2, 10);
+    MEMSET(value + 4, 0, 6);
+    buf_u32_set(value + 6, i);
+    buf_u16_set(value + 10, 4);
+    buf_u16_set(value + 12, 8);
+    buf_u32_set(value + 14, 0x0a000000 | i);
+}
+
+static of_checksum_128_t
+checksum_make(uint32_t i)
+{
+    of_checksum_128_t checksum;
+
+    checksum.hi = (i + 1) * 0x9e3779b97f4a7c15ULL;
+    checksum.lo = (i + 1) * 0xc2b2ae3d27d4eb4fULL;
+    return checksum;
+}
+
+static int
+bench_dumps(loci_gentable_t *gt, const char *size_name)
+{
+    loci_gentable_dump_t dump;
+    of_object_t *reply;
+    char name[64];
+    uint64_t start;
+    int i, n = locibench_iterations, rv;
+
+    start = locibench_start();
+    loci_gentable_dump_init(gt, &dump, 0, BUCKETS);
+    do {
+        reply = of_bsn_gentable_bucket_stats_reply_new(OF_VERSION_1_3);
+        if (reply == NULL) {
+            return -1;
+        }
+        rv = loci_gentable_bucket_stats_fill(gt, &dump, reply);
+        locibench_sink += reply->length;
+        of_object_delete(reply);
+        if (rv < 0) {
+            return -1;
+        }
+    } while (!loci_gentable_dump_done(&dump));
+    snprintf(name, sizeof(name), "gentable/%s/bucket_stats", size_name);
+    locibench_report(name, BUCKETS, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        loci_gentable_dump_init(gt, &dump, (i * 7919) % BUCKETS, 1);
+        do {
+            reply = of_bsn_gentable_entry_desc_stats_reply_new(OF_VERSION_1_3);
+            if (reply == NULL) {
+                return -1;
+            }
+            rv = loci_gentable_entry_desc_fill(gt, &dump, reply);
+            locibench_sink += reply->length;
+            of_object_delete(reply);
+            if (rv < 0) {
+                return -1;
+            }
+        } while (!loci_gentable_dump_done(&dump));
+    }
+    snprintf(name, sizeof(name), "gentable/%s/entry_desc", size_name);
+    locibench_report(name, n, start, 0);
+
+    return 0;
+}
+
+static int
+switch_dump(bench_switch_t *sw, loci_gentable_dump_t *dump, int entries,
+            uint32_t xid)
+{
+    of_object_t *reply;
+    int rv;
+
+    do {
+        if ((sw->tail + 1) % REPLIES_MAX == sw->head) {
+            return OF_ERROR_RESOURCE;
+        }
+        if (entries) {
+            reply = of_bsn_gentable_entry_desc_stats_reply_new(OF_VERSION_1_3);
+        } else {
+            reply = of_bsn_gentable_bucket_stats_reply_new(OF_VERSION_1_3);
+        }
+        if (reply == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        if (entries) {
+            of_bsn_gentable_entry_desc_stats_reply_xid_set(reply, xid);
+            rv = loci_gentable_entry_desc_fill(&sw->gt, dump, reply);
+        } else {
+            of_bsn_gentable_bucket_stats_reply_xid_set(reply, xid);
+            rv = loci_gentable_bucket_stats_fill(&sw->gt, dump, reply);
+        }
+        if (rv < 0) {
+            of_object_delete(reply);
+            return rv;
+        }
+        sw->replies[sw->tail] = reply;
+        sw->tail = (sw->tail + 1) % REPLIES_MAX;
+    } while (!loci_gentable_dump_done(dump));
+
+    return OF_ERROR_NONE;
+}
+
+static int
+switch_send(void *cookie, of_object_t *msg)
+{
+    bench_switch_t *sw = cookie;
+    loci_gentable_dump_t dump;
+    of_checksum_128_t checksum, mask;
+    uint32_t xid;
+    int rv;
+
+    switch (msg->object_id) {
+    case OF_BSN_GENTABLE_BUCKET_STATS_REQUEST:
+        of_bsn_gentable_bucket_stats_request_xid_get(msg, &xid);
+        loci_gentable_dump_init(&sw->gt, &dump, 0, sw->gt.buckets_size);
+        rv = switch_dump(sw, &dump, 0, xid);
+        break;
+    case OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST:
+        of_bsn_gentable_entry_desc_stats_request_xid_get(msg, &xid);
+        of_bsn_gentable_entry_desc_stats_request_checksum_get(msg, &checksum);
+        of_bsn_gentable_entry_desc_stats_request_checksum_mask_get(msg, &mask);
+        loci_gentable_dump_select(&sw->gt, &dump, checksum, mask);
+        rv = switch_dump(sw, &dump, 1, xid);
+        break;
+    default:
+        rv = loci_gentable_apply(&sw->gt, msg);
+        break;
+    }
+    of_object_delete(msg);
+
+    return rv;
+}
+
+static int
+bench_resync(loci_gentable_t *gt, const char *size_name, uint32_t count)
+{
+    bench_switch_t sw;
+    loci_gentable_resync_t rs;
+    of_object_t *reply;
+    uint8_t key[KEY_BYTES], value[VALUE_BYTES];
+    char name[64];
+    uint64_t start;
+    uint32_t i;
+    int rv = -1;
+
+    MEMSET(&sw, 0, sizeof(sw));
+    if (loci_gentable_init(&sw.gt, 0, BUCKETS) < 0) {
+        return -1;
+    }
+    for (i = 0; i < count; i++) {
+        key_build(i, key);
+        value_build(i % 100 == 0 ? i + 1 : i, value);
+        if (loci_gentable_add(&sw.gt, key, sizeof(key), value, sizeof(value),
+                              checksum_make(i % 100 == 0 ? i + count : i)) <
+            0) {
+            goto done;
+        }
+    }
+
+    start = locibench_start();
+    if (loci_gentable_resync_start(&rs, gt, OF_VERSION_1_3, 1, switch_send,
+                                   &sw) < 0) {
+        loci_gentable_resync_cleanup(&rs);
+        goto done;
+    }
+    while (!loci_gentable_resync_done(&rs) && sw.head != sw.tail) {
+        reply = sw.replies[sw.head];
+        sw.head = (sw.head + 1) % REPLIES_MAX;
+        if (loci_gentable_resync_handle(&rs, reply) < 0) {
+            of_object_delete(reply);
+            break;
+        }
+        of_object_delete(reply);
+    }
+    snprintf(name, sizeof(name), "gentable/%s/resync", size_name);
+    locibench_report(name, (count + 99) / 100, start, 0);
+    if (loci_gentable_resync_done(&rs) && rs.adds == (count + 99) / 100 &&
+        sw.gt.checksum.hi == gt->checksum.hi &&
+        sw.gt.checksum.lo == gt->checksum.lo) {
+        rv = 0;
+    }
+    loci_gentable_resync_cleanup(&rs);
+
+ done:
+    while (sw.head != sw.tail) {
+        of_object_delete(sw.replies[sw.head]);
+        sw.head = (sw.head + 1) % REPLIES_MAX;
+    }
+    loci_gentable_cleanup(&sw.gt);
+    return rv;
+}
+
+static int
+bench_size(const char *size_name, uint32_t count)
+{
+    loci_gentable_t gt;
+    uint8_t key[KEY_BYTES], value[VALUE_BYTES];
+    char name[64];
+    uint64_t start;
+    uint32_t i;
+    int n = locibench_iterations, rv = -1;
+
+    if (loci_gentable_init(&gt, 0, BUCKETS) < 0) {
+        return -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < count; i++) {
+        key_build(i, key);
+        value_build(i, value);
+        if (loci_gentable_add(&gt, key, sizeof(key), value, sizeof(value),
+                              checksum_make(i)) < 0) {
+            goto done;
+        }
+    }
+    snprintf(name, sizeof(name), "gentable/%s/add", size_name);
+    locibench_report(name, count, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < (uint32_t)n; i++) {
+        key_build((i * 2654435761U) % count, key);
+        if (loci_gentable_lookup(&gt, key, sizeof(key)) == NULL) {
+            goto done;
+        }
+    }
+    snprintf(name, sizeof(name), "gentable/%s/lookup", size_name);
+    locibench_report(name, n, start, 0);
+
+    if (bench_dumps(&gt, size_name) < 0 ||
+        bench_resync(&gt, size_name, count) < 0) {
+        goto done;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < count; i++) {
+        key_build(i, key);
+        if (loci_gentable_delete(&gt, key, sizeof(key)) < 0) {
+            goto done;
+        }
+    }
+    snprintf(name, sizeof(name), "gentable/%s/delete", size_name);
+    locibench_report(name, count, start, 0);
+    rv = 0;
+
+ done:
+    loci_gentable_cleanup(&gt);
+    return rv;
+}
+
+int
+bench_gentable(void)
+{
+    int i;
+
+    for (i = 0; i < (int)(sizeof(sizes) / sizeof(sizes[0])); i++) {
+        if (bench_size(sizes[i].name, sizes[i].count) < 0) {
+            fprintf(stderr, "gentable benchmark failed for %s\n",
+                    sizes[i].name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
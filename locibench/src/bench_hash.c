@@ -0,0 +1,176 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_hash.c
+ *
+ * Hashing, one op being one hash:
+ *
+ *   hash/bytes/64          loci_hash_bytes of 64 bytes
+ *   hash/bytes/1500        loci_hash_bytes of 1500 bytes
+ *   hash/match/5tuple      loci_match_hash of a 1.3 TCP 5-tuple match
+ *   hash/match/of10        the same flow as OpenFlow 1.0 codes it
+ *   hash/match/equal       loci_match_equal of the two
+ *   hash/match/of_match_eq of_match_eq of the 1.3 match and a copy,
+ *                          for comparison
+ *   hash/object/flow_add   loci_object_hash of a 1.3 flow_add with the
+ *                          match and an output action to apply, xid
+ *                          ignored
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_hash.h>
+
+#define DATA_BYTES 1500
+
+static uint8_t data[DATA_BYTES];
+
+static void
+match_5tuple(of_match_t *match, of_version_t version)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = version;
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.vlan_vid = version < OF_VERSION_1_2 ? 10 : 0x1000 | 10;
+    OF_MATCH_MASK_VLAN_VID_EXACT_SET(match);
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.ipv4_src = 0x0a000001;
+    OF_MATCH_MASK_IPV4_SRC_EXACT_SET(match);
+    match->fields.ipv4_dst = 0x0a000002;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    match->fields.tcp_src = 1234;
+    OF_MATCH_MASK_TCP_SRC_EXACT_SET(match);
+    match->fields.tcp_dst = 80;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+}
+
+static of_object_t *
+flow_add_build(void)
+{
+    of_object_t *obj, *output;
+    of_list_action_t *actions;
+    of_list_instruction_t *instructions;
+    of_instruction_apply_actions_t *apply;
+    of_match_t match;
+    int rv = OF_ERROR_RESOURCE;
+
+    obj = of_flow_add_new(OF_VERSION_1_3);
+    instructions = of_list_instruction_new(OF_VERSION_1_3);
+    apply = of_instruction_apply_actions_new(OF_VERSION_1_3);
+    actions = of_list_action_new(OF_VERSION_1_3);
+    output = of_action_output_new(OF_VERSION_1_3);
+    if (obj != NULL && instructions != NULL && apply != NULL &&
+        actions != NULL && output != NULL) {
+        of_flow_add_xid_set(obj, 1);
+        of_flow_add_cookie_set(obj, 0x1234);
+        of_flow_add_priority_set(obj, 100);
+        of_action_output_port_set(output, 1);
+        match_5tuple(&match, OF_VERSION_1_3);
+        if ((rv = of_flow_add_match_set(obj, &match)) == 0 &&
+            (rv = of_list_action_append(actions, output)) == 0 &&
+            (rv = of_instruction_apply_actions_actions_set(apply,
+                                                           actions)) == 0 &&
+            (rv = of_list_instruction_append(instructions, apply)) == 0) {
+            rv = of_flow_add_instructions_set(obj, instructions);
+        }
+    }
+    if (output != NULL) {
+        of_object_delete(output);
+    }
+    if (actions != NULL) {
+        of_object_delete(actions);
+    }
+    if (apply != NULL) {
+        of_object_delete(apply);
+    }
+    if (instructions != NULL) {
+        of_object_delete(instructions);
+    }
+    if (rv < 0 && obj != NULL) {
+        of_object_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static void
+bench_bytes(const char *name, int len)
+{
+    uint64_t start;
+    int i, n = locibench_iterations;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        locibench_sink += loci_hash_bytes(data, len, i);
+    }
+    locibench_report(name, n, start, 0);
+}
+
+static void
+bench_match_hash(const char *name, const of_match_t *match)
+{
+    uint64_t start;
+    int i, n = locibench_iterations;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        locibench_sink += loci_match_hash(match, i);
+    }
+    locibench_report(name, n, start, 0);
+}
+
+int
+bench_hash(void)
+{
+    of_match_t m10, m13, copy;
+    of_object_t *obj;
+    uint64_t start, hash;
+    int i, n = locibench_iterations;
+
+    for (i = 0; i < DATA_BYTES; i++) {
+        data[i] = i * 7;
+    }
+    bench_bytes("hash/bytes/64", 64);
+    bench_bytes("hash/bytes/1500", DATA_BYTES);
+
+    match_5tuple(&m13, OF_VERSION_1_3);
+    match_5tuple(&m10, OF_VERSION_1_0);
+    bench_match_hash("hash/match/5tuple", &m13);
+    bench_match_hash("hash/match/of10", &m10);
+    copy = m13;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        locibench_sink += loci_match_equal(&m10, &m13);
+    }
+    locibench_report("hash/match/equal", n, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        locibench_sink += of_match_eq(&m13, &copy);
+    }
+    locibench_report("hash/match/of_match_eq", n, start, 0);
+
+    if ((obj = flow_add_build()) == NULL) {
+        fprintf(stderr, "hash benchmark failed to build flow_add\n");
+        return -1;
+    }
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if (loci_object_hash(obj, LOCI_HASH_IGNORE_XID, 0, &hash) < 0) {
+            fprintf(stderr, "hash benchmark failed for flow_add\n");
+            of_object_delete(obj);
+            return -1;
+        }
+        locibench_sink += hash;
+    }
+    locibench_report("hash/object/flow_add", n, start, 0);
+    of_object_delete(obj);
+
+    return 0;
+}
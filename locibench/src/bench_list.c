@@ -0,0 +1,113 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_list.c
+ *
+ * List append and iteration, per element, on a list of LIST_LEN
+ * output actions:
+ *
+ *   append       of_list_append of a prebuilt element
+ *   append_bind  of_list_append_bind, then set the element in place
+ *   iterate      OF_LIST_ACTION_ITER reading each element's port
+ */
+
+#include <locibench/locibench.h>
+
+#define LIST_LEN 64
+
+static void
+bench_append(of_version_t version, const char *name)
+{
+    of_list_action_t *list;
+    of_action_output_t *elem;
+    uint64_t start;
+    int i, j, n = locibench_iterations / LIST_LEN + 1;
+
+    elem = of_action_output_new(version);
+    of_action_output_port_set(elem, 1);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        list = of_list_action_new(version);
+        for (j = 0; j < LIST_LEN; j++) {
+            of_list_append(list, elem);
+        }
+        locibench_sink += list->length;
+        of_list_action_delete(list);
+    }
+    locibench_report(name, n * LIST_LEN, start, elem->length);
+
+    of_action_output_delete(elem);
+}
+
+static void
+bench_append_bind(of_version_t version, const char *name)
+{
+    of_list_action_t *list;
+    of_action_output_t elem;
+    uint64_t start;
+    int i, j, n = locibench_iterations / LIST_LEN + 1;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        list = of_list_action_new(version);
+        for (j = 0; j < LIST_LEN; j++) {
+            of_action_output_init(&elem, version, -1, 1);
+            of_list_action_append_bind(list, &elem);
+            of_action_output_port_set(&elem, j);
+        }
+        locibench_sink += list->length;
+        of_list_action_delete(list);
+    }
+    locibench_report(name, n * LIST_LEN, start, elem.length);
+}
+
+static int
+bench_iterate(of_version_t version, const char *name)
+{
+    of_list_action_t *list;
+    of_action_output_t *elem;
+    of_object_t iter;
+    of_port_no_t port;
+    uint64_t start;
+    int i, j, rv, count = 0, n = locibench_iterations / LIST_LEN + 1;
+
+    list = of_list_action_new(version);
+    elem = of_action_output_new(version);
+    for (j = 0; j < LIST_LEN; j++) {
+        of_action_output_port_set(elem, j);
+        of_list_append(list, elem);
+    }
+    of_action_output_delete(elem);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        OF_LIST_ACTION_ITER(list, &iter, rv) {
+            of_action_output_port_get(&iter, &port);
+            locibench_sink += port;
+            count++;
+        }
+    }
+    locibench_report(name, n * LIST_LEN, start, 0);
+
+    of_list_action_delete(list);
+    return count == n * LIST_LEN ? 0 : -1;
+}
+
+int
+bench_list(void)
+{
+    bench_append(OF_VERSION_1_0, "list/action/1.0/append");
+    bench_append(OF_VERSION_1_3, "list/action/1.3/append");
+    bench_append_bind(OF_VERSION_1_0, "list/action/1.0/append_bind");
+    bench_append_bind(OF_VERSION_1_3, "list/action/1.3/append_bind");
+    if (bench_iterate(OF_VERSION_1_0, "list/action/1.0/iterate") < 0 ||
+        bench_iterate(OF_VERSION_1_3, "list/action/1.3/iterate") < 0) {
+        return -1;
+    }
+
+    return 0;
+}
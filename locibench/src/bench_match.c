@@ -0,0 +1,107 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_match.c
+ *
+ * Match serialization and deserialization for each version
+ *
+ * Deserialization is measured through of_flow_add_match_get on a
+ * flow_add carrying the match.  OpenFlow 1.1 is left out as its wire
+ * match can't express the partially wildcarded benchmark match.
+ */
+
+#include <locibench/locibench.h>
+
+static const struct {
+    of_version_t version;
+    const char *name;
+} versions[] = {
+    { OF_VERSION_1_0, "1.0" },
+    { OF_VERSION_1_2, "1.2" },
+    { OF_VERSION_1_3, "1.3" },
+    { OF_VERSION_1_4, "1.4" },
+};
+
+static void
+match_init(of_match_t *match, of_version_t version)
+{
+    memset(match, 0, sizeof(*match));
+    match->version = version;
+    match->fields.in_port = 1;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(match);
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.ipv4_dst = 0x0a000000;
+    match->masks.ipv4_dst = 0xff000000;
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.tcp_dst = 80;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+}
+
+static int
+bench_version(of_version_t version, const char *version_name)
+{
+    of_match_t match, out;
+    of_octets_t octets;
+    of_flow_add_t *obj;
+    char name[64];
+    uint64_t start;
+    int i, n = locibench_iterations;
+
+    match_init(&match, version);
+
+    if (of_match_serialize(version, &match, &octets) < 0) {
+        return -1;
+    }
+    FREE(octets.data);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        of_match_serialize(version, &match, &octets);
+        locibench_sink += octets.bytes;
+        FREE(octets.data);
+    }
+    snprintf(name, sizeof(name), "match/%s/serialize", version_name);
+    locibench_report(name, n, start, octets.bytes);
+
+    if ((obj = of_flow_add_new(version)) == NULL) {
+        return -1;
+    }
+    if (of_flow_add_match_set(obj, &match) < 0 ||
+        of_flow_add_match_get(obj, &out) < 0 ||
+        !of_match_eq(&match, &out)) {
+        of_flow_add_delete(obj);
+        return -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        locibench_sink += of_flow_add_match_get(obj, &out);
+        locibench_sink += out.fields.tcp_dst;
+    }
+    snprintf(name, sizeof(name), "match/%s/deserialize", version_name);
+    locibench_report(name, n, start, 0);
+
+    of_flow_add_delete(obj);
+    return 0;
+}
+
+int
+bench_match(void)
+{
+    int i;
+
+    for (i = 0; i < (int)(sizeof(versions) / sizeof(versions[0])); i++) {
+        if (bench_version(versions[i].version, versions[i].name) < 0) {
+            fprintf(stderr, "match benchmark failed for %s\n",
+                    versions[i].name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
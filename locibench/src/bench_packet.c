@@ -0,0 +1,191 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_packet.c
+ *
+ * Packet header parsing into a match, over generated packets with
+ * random addresses and ports.  One op is one packet.
+ *
+ *   packet/tcp4/all    802.1Q tagged TCP/IPv4, all fields
+ *   packet/mix/all     a mix of TCP/IPv4, UDP/IPv4, tagged TCP/IPv4,
+ *                      TCP/IPv6 and ARP, all fields
+ *   packet/mix/eth     the same, Ethernet and VLAN fields only
+ *   packet/mix/ip      the same, IP fields only
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_packet.h>
+
+#define PACKETS 256
+#define PACKET_BYTES 64
+
+static const struct {
+    const char *name;
+    uint32_t fields;
+} subsets[] = {
+    { "all", LOCI_PACKET_FIELDS_ALL },
+    { "eth", LOCI_PACKET_FIELDS_ETH | LOCI_PACKET_FIELDS_VLAN },
+    { "ip", LOCI_PACKET_FIELDS_IP },
+};
+
+static uint8_t packets[PACKETS][PACKET_BYTES];
+static int packet_lens[PACKETS];
+
+static uint32_t seed = 1;
+
+static uint32_t
+rand32(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) | (seed << 16);
+}
+
+static void
+rand_bytes(uint8_t *buf, int len)
+{
+    int i;
+
+    for (i = 0; i < len; i++) {
+        buf[i] = rand32();
+    }
+}
+
+/* Ethernet header, tagged if vid is not 0; returns its length */
+static int
+eth_build(uint8_t *buf, uint16_t vid, uint16_t eth_type)
+{
+    rand_bytes(buf, 12);
+    buf[0] &= 0xfe;
+    if (vid != 0) {
+        buf_u16_set(buf + 12, 0x8100);
+        buf_u16_set(buf + 14, vid);
+        buf_u16_set(buf + 16, eth_type);
+        return 18;
+    }
+    buf_u16_set(buf + 12, eth_type);
+    return 14;
+}
+
+static int
+ipv4_build(uint8_t *buf, uint16_t vid, uint8_t proto)
+{
+    int offset = eth_build(buf, vid, 0x0800);
+    uint8_t *ip = buf + offset;
+
+    MEMSET(ip, 0, 20);
+    ip[0] = 0x45;
+    ip[1] = rand32() & 0xfc;
+    buf_u16_set(ip + 2, PACKET_BYTES - offset);
+    ip[8] = 64;
+    ip[9] = proto;
+    rand_bytes(ip + 12, 8);
+    rand_bytes(ip + 20, 4);
+    return PACKET_BYTES;
+}
+
+static int
+ipv6_build(uint8_t *buf, uint8_t proto)
+{
+    int offset = eth_build(buf, 0, 0x86dd);
+    uint8_t *ip = buf + offset;
+
+    buf_u32_set(ip, 0x60000000 | (rand32() & 0xfffff));
+    buf_u16_set(ip + 4, PACKET_BYTES - offset - 40);
+    ip[6] = proto;
+    ip[7] = 64;
+    rand_bytes(ip + 8, 32);
+    rand_bytes(ip + 40, PACKET_BYTES - offset - 40);
+    return PACKET_BYTES;
+}
+
+static int
+arp_build(uint8_t *buf)
+{
+    int offset = eth_build(buf, 0, 0x0806);
+    uint8_t *arp = buf + offset;
+
+    buf_u16_set(arp, 1);
+    buf_u16_set(arp + 2, 0x0800);
+    arp[4] = 6;
+    arp[5] = 4;
+    buf_u16_set(arp + 6, 1 + (rand32() & 1));
+    rand_bytes(arp + 8, 20);
+    return offset + 28;
+}
+
+/* Fill packets with the mix, or with tagged TCP/IPv4 only */
+static void
+packets_build(int mix)
+{
+    int i;
+
+    for (i = 0; i < PACKETS; i++) {
+        switch (mix ? i % 5 : 2) {
+        case 0:
+            packet_lens[i] = ipv4_build(packets[i], 0, 6);
+            break;
+        case 1:
+            packet_lens[i] = ipv4_build(packets[i], 0, 17);
+            break;
+        case 2:
+            packet_lens[i] = ipv4_build(packets[i], 1 + i % 4094, 6);
+            break;
+        case 3:
+            packet_lens[i] = ipv6_build(packets[i], 6);
+            break;
+        default:
+            packet_lens[i] = arp_build(packets[i]);
+            break;
+        }
+    }
+}
+
+static int
+bench_subset(const char *set_name, const char *subset_name,
+             uint32_t fields)
+{
+    of_match_t match;
+    char name[64];
+    uint64_t start;
+    int i, j, n = locibench_iterations;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        j = i % PACKETS;
+        if (loci_packet_match(OF_VERSION_1_3, packets[j], packet_lens[j],
+                              fields, &match) < 0) {
+            return -1;
+        }
+        locibench_sink += match.fields.eth_type + match.fields.ip_proto;
+    }
+    snprintf(name, sizeof(name), "packet/%s/%s", set_name, subset_name);
+    locibench_report(name, n, start, 0);
+
+    return 0;
+}
+
+int
+bench_packet(void)
+{
+    int i;
+
+    packets_build(0);
+    if (bench_subset("tcp4", subsets[0].name, subsets[0].fields) < 0) {
+        fprintf(stderr, "packet benchmark failed for tcp4\n");
+        return -1;
+    }
+
+    packets_build(1);
+    for (i = 0; i < (int)(sizeof(subsets) / sizeof(subsets[0])); i++) {
+        if (bench_subset("mix", subsets[i].name, subsets[i].fields) < 0) {
+            fprintf(stderr, "packet benchmark failed for mix/%s\n",
+                    subsets[i].name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_parse.c
+ *
+ * Bulk load of text flows: parse only, and parse plus build of the
+ * flow add message.
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_parse.h>
+
+#define PARSE_FLOW_COUNT 1000000
+
+/* Longest generated line plus newline */
+#define PARSE_LINE_MAX 160
+
+static char *
+flow_text_new(int count, int *len)
+{
+    char *text, *p;
+    int i;
+
+    if ((text = malloc((size_t)count * PARSE_LINE_MAX)) == NULL) {
+        return NULL;
+    }
+
+    for (i = 0, p = text; i < count; i++) {
+        p += sprintf(p, "table=0,priority=%d,in_port=%d,eth_type=0x800,"
+                     "ipv4_dst=10.%d.%d.0/24,ip_proto=6,tcp_dst=%d "
+                     "actions=output:%d\n",
+                     100 + i % 1000, 1 + i % 48, (i >> 16) & 0xff,
+                     (i >> 8) & 0xff, 1 + i % 65535, 1 + (i + 1) % 48);
+    }
+    *len = p - text;
+
+    return text;
+}
+
+static int
+bench_flow_add(const char *name, of_version_t version, const char *text, int len)
+{
+    const char *p = text, *nl, *end = text + len;
+    loci_flow_t flow;
+    of_flow_add_t *obj;
+    uint64_t start;
+    int count = 0;
+
+    start = locibench_start();
+    for (; p < end; p = nl + 1) {
+        nl = memchr(p, '\n', end - p);
+        if (loci_flow_parse(p, nl - p, &flow, NULL) < 0) {
+            return -1;
+        }
+        if (version != OF_VERSION_UNKNOWN) {
+            if ((obj = of_flow_add_new(version)) == NULL ||
+                    loci_flow_add_fill(obj, &flow) < 0) {
+                return -1;
+            }
+            locibench_sink += obj->length;
+            of_flow_add_delete(obj);
+        } else {
+            locibench_sink += flow.priority;
+        }
+        count++;
+    }
+    locibench_report(name, count, start, len / count);
+
+    return 0;
+}
+
+int
+bench_parse(void)
+{
+    char *text;
+    int len, rv;
+
+    if ((text = flow_text_new(PARSE_FLOW_COUNT, &len)) == NULL) {
+        return -1;
+    }
+
+    rv = bench_flow_add("parse/flow_1M", OF_VERSION_UNKNOWN, text, len);
+    if (rv == 0) {
+        rv = bench_flow_add("parse/flow_add_1M/1.0", OF_VERSION_1_0, text, len);
+    }
+    if (rv == 0) {
+        rv = bench_flow_add("parse/flow_add_1M/1.3", OF_VERSION_1_3, text, len);
+    }
+
+    free(text);
+    return rv;
+}
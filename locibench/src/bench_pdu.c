@@ -0,0 +1,201 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_pdu.c
+ *
+ * A switch of 4096 ports, each with tx slots sending every 30, 1000 and
+ * 30000 ms and an rx slot timing out every 3000 ms, started spread over
+ * a second; 16384 slots in all.  One op per millisecond of the clock:
+ *
+ *   pdu/16k/wheel  loci_pdu_sched_advance a tick at a time, the
+ *                  rx_timeouts written to a stream
+ *   pdu/16k/scan   The same slots in an array, every slot compared to
+ *                  the clock each tick
+ *
+ * One op per slot:
+ *
+ *   pdu/16k/start  loci_pdu_sched_add of a slot already started
+ *   pdu/16k/rx     loci_pdu_sched_rx
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_pdu_sched.h>
+
+#define PORTS 4096
+#define TX_SLOTS 3
+#define SLOTS (PORTS * (TX_SLOTS + 1))
+#define RX_TIMEOUT_MS 3000
+#define PDU_BYTES 64
+
+static const uint32_t tx_intervals[TX_SLOTS] = { 30, 1000, 30000 };
+
+static uint8_t pdu[PDU_BYTES];
+
+/* A slot of the scan */
+struct scan_slot {
+    uint64_t expires;
+    uint32_t interval_ms;
+    of_port_no_t port_no;
+    uint8_t slot_num;
+    uint8_t kind;
+};
+
+static int
+tx_count(void *cookie, of_port_no_t port_no, uint8_t slot_num,
+         const uint8_t *data, int len)
+{
+    locibench_sink += port_no + slot_num + data[0] + len;
+    return 0;
+}
+
+static int
+timeouts_count(void *cookie, const uint8_t *data, int len)
+{
+    locibench_sink += len;
+    return 0;
+}
+
+/* Start the slots of port p on tick p * 1000 / PORTS */
+static int
+sched_fill(loci_pdu_sched_t *sched, loci_stream_t *timeouts)
+{
+    int port, slot;
+
+    for (port = 0; port < PORTS; port++) {
+        if (loci_pdu_sched_advance(sched, port * 1000 / PORTS, tx_count,
+                                   NULL, timeouts) < 0) {
+            return -1;
+        }
+        for (slot = 0; slot < TX_SLOTS; slot++) {
+            if (loci_pdu_sched_add(sched, LOCI_PDU_TX, port + 1, slot,
+                                   tx_intervals[slot], pdu, PDU_BYTES) < 0) {
+                return -1;
+            }
+        }
+        if (loci_pdu_sched_add(sched, LOCI_PDU_RX, port + 1, 0,
+                               RX_TIMEOUT_MS, NULL, 0) < 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* The same slots, due on the same ticks */
+static void
+scan_fill(loci_pdu_sched_t *sched, struct scan_slot *slots)
+{
+    loci_pdu_timer_t *timer;
+    uint32_t i;
+    int n = 0;
+
+    for (i = 0; i < sched->n_slots; i++) {
+        for (timer = sched->slots[i]; timer != NULL; timer = timer->next) {
+            slots[n].expires = timer->expires;
+            slots[n].interval_ms = timer->interval_ms;
+            slots[n].port_no = timer->port_no;
+            slots[n].slot_num = timer->slot_num;
+            slots[n].kind = timer->kind;
+            n++;
+        }
+    }
+}
+
+static int
+scan_tick(struct scan_slot *slots, uint64_t now, loci_stream_t *timeouts)
+{
+    uint8_t *buf;
+    int i, fired = 0;
+
+    for (i = 0; i < SLOTS; i++) {
+        if (slots[i].expires != now) {
+            continue;
+        }
+        if (slots[i].kind == LOCI_PDU_TX) {
+            tx_count(NULL, slots[i].port_no, slots[i].slot_num, pdu,
+                     PDU_BYTES);
+        } else if ((buf = loci_stream_reserve(timeouts, 21)) != NULL) {
+            MEMSET(buf, 0, 21);
+            buf_u32_set(buf + 16, slots[i].port_no);
+            loci_stream_advance(timeouts, 21);
+        }
+        slots[i].expires += slots[i].interval_ms;
+        fired++;
+    }
+
+    return fired;
+}
+
+int
+bench_pdu(void)
+{
+    loci_pdu_sched_t sched;
+    loci_stream_t timeouts;
+    struct scan_slot *slots;
+    uint8_t buf[4096];
+    uint64_t start, now;
+    int i, n, rv = 0;
+    int ticks = locibench_iterations / 10 + 1;
+    int wheel_fired = 0, scan_fired = 0;
+
+    MEMSET(pdu, 0x5a, sizeof(pdu));
+    loci_stream_init(&timeouts, buf, sizeof(buf), timeouts_count, NULL);
+    slots = MALLOC(SLOTS * sizeof(*slots));
+    if (slots == NULL || loci_pdu_sched_init(&sched, OF_VERSION_1_3, 0) < 0) {
+        FREE(slots);
+        return -1;
+    }
+    if (sched_fill(&sched, &timeouts) < 0 || sched.count != SLOTS) {
+        rv = -1;
+    }
+    scan_fill(&sched, slots);
+    now = sched.now;
+
+    start = locibench_start();
+    for (i = 1; i <= ticks && rv == 0; i++) {
+        if ((n = loci_pdu_sched_advance(&sched, now + i, tx_count, NULL,
+                                        &timeouts)) < 0) {
+            rv = -1;
+        }
+        wheel_fired += n;
+    }
+    loci_stream_finish(&timeouts);
+    locibench_report("pdu/16k/wheel", ticks, start, 0);
+
+    start = locibench_start();
+    for (i = 1; i <= ticks && rv == 0; i++) {
+        scan_fired += scan_tick(slots, now + i, &timeouts);
+    }
+    loci_stream_finish(&timeouts);
+    locibench_report("pdu/16k/scan", ticks, start, 0);
+    if (wheel_fired != scan_fired) {
+        rv = -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < locibench_iterations && rv == 0; i++) {
+        n = i % SLOTS;
+        if (loci_pdu_sched_add(&sched, LOCI_PDU_TX, n / TX_SLOTS % PORTS + 1,
+                               n % TX_SLOTS, tx_intervals[n % TX_SLOTS], pdu,
+                               PDU_BYTES) < 0) {
+            rv = -1;
+        }
+    }
+    locibench_report("pdu/16k/start", locibench_iterations, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < locibench_iterations && rv == 0; i++) {
+        if (loci_pdu_sched_rx(&sched, i % PORTS + 1, 0) < 0) {
+            rv = -1;
+        }
+    }
+    locibench_report("pdu/16k/rx", locibench_iterations, start, 0);
+
+    loci_pdu_sched_cleanup(&sched);
+    FREE(slots);
+
+    return rv;
+}
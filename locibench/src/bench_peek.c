@@ -0,0 +1,145 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_peek.c
+ *
+ * Packet_in dispatch: getting buffer_id, reason, table_id, cookie,
+ * in_port and the data of a packet_in with a 3 field match and 64
+ * bytes of data.
+ *
+ *   peek/<version>/packet_in/object  of_object_new_from_message_preallocated,
+ *                                    the getters, match_get and data_get
+ *   peek/<version>/packet_in/peek    loci_packet_in_peek
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_peek.h>
+
+static const struct {
+    of_version_t version;
+    const char *name;
+} versions[] = {
+    { OF_VERSION_1_0, "1.0" },
+    { OF_VERSION_1_3, "1.3" },
+};
+
+static of_packet_in_t *
+packet_in_build(of_version_t version)
+{
+    static uint8_t data[64];
+    of_packet_in_t *obj;
+    of_octets_t octets = { data, sizeof(data) };
+    of_match_t match;
+
+    obj = of_packet_in_new(version);
+    of_packet_in_buffer_id_set(obj, -1);
+    of_packet_in_total_len_set(obj, sizeof(data));
+    if (version == OF_VERSION_1_0) {
+        of_packet_in_in_port_set(obj, 1);
+    } else {
+        memset(&match, 0, sizeof(match));
+        match.version = version;
+        match.fields.in_port = 1;
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+        match.fields.metadata = 2;
+        OF_MATCH_MASK_METADATA_EXACT_SET(&match);
+        match.fields.tunnel_id = 3;
+        OF_MATCH_MASK_TUNNEL_ID_EXACT_SET(&match);
+        if (of_packet_in_match_set(obj, &match) < 0) {
+            of_packet_in_delete(obj);
+            return NULL;
+        }
+    }
+    if (of_packet_in_data_set(obj, &octets) < 0) {
+        of_packet_in_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static int
+bench_version(of_version_t version, const char *version_name)
+{
+    of_packet_in_t *msg;
+    of_object_storage_t storage;
+    of_object_t *obj;
+    loci_packet_in_t pi;
+    of_match_t match;
+    of_octets_t data;
+    uint32_t buffer_id;
+    uint8_t reason, table_id = 0;
+    uint64_t cookie = 0;
+    of_port_no_t in_port;
+    uint8_t *buf;
+    char name[64];
+    uint64_t start;
+    int i, len, n = locibench_iterations;
+
+    if ((msg = packet_in_build(version)) == NULL) {
+        return -1;
+    }
+    buf = OF_OBJECT_TO_MESSAGE(msg);
+    len = msg->length;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        obj = of_object_new_from_message_preallocated(&storage, buf, len);
+        if (obj == NULL) {
+            of_packet_in_delete(msg);
+            return -1;
+        }
+        of_packet_in_buffer_id_get(obj, &buffer_id);
+        of_packet_in_reason_get(obj, &reason);
+        if (version == OF_VERSION_1_0) {
+            of_packet_in_in_port_get(obj, &in_port);
+        } else {
+            of_packet_in_table_id_get(obj, &table_id);
+            of_packet_in_cookie_get(obj, &cookie);
+            if (of_packet_in_match_get(obj, &match) < 0) {
+                of_packet_in_delete(msg);
+                return -1;
+            }
+            in_port = match.fields.in_port;
+        }
+        of_packet_in_data_get(obj, &data);
+        locibench_sink += buffer_id + reason + table_id + cookie + in_port +
+            data.bytes;
+    }
+    snprintf(name, sizeof(name), "peek/%s/packet_in/object", version_name);
+    locibench_report(name, n, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if (loci_packet_in_peek(buf, len, &pi) < 0) {
+            of_packet_in_delete(msg);
+            return -1;
+        }
+        locibench_sink += pi.buffer_id + pi.reason + pi.table_id +
+            pi.cookie + pi.in_port + pi.data_len;
+    }
+    snprintf(name, sizeof(name), "peek/%s/packet_in/peek", version_name);
+    locibench_report(name, n, start, 0);
+
+    of_packet_in_delete(msg);
+    return 0;
+}
+
+int
+bench_peek(void)
+{
+    int i;
+
+    for (i = 0; i < (int)(sizeof(versions) / sizeof(versions[0])); i++) {
+        if (bench_version(versions[i].version, versions[i].name) < 0) {
+            fprintf(stderr, "peek benchmark failed for %s\n",
+                    versions[i].name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,360 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_program.c
+ *
+ * Action execution on a 64 byte TCP/IPv4 packet, with the actions of a
+ * flow compiled once into a program, and decoded from the instruction
+ * list for each packet as a datapath walking the list would.  One op
+ * is one packet; the packet is copied back before each.
+ *
+ *   program/<flow>/compile   loci_program_compile of the instructions
+ *   program/<flow>/run       running the compiled program
+ *   program/<flow>/decode    compiling and running, per packet
+ *
+ * The flows are:
+ *
+ *   route    rewrite both MAC addresses, decrement TTL, output
+ *   nat      rewrite IPv4 source and TCP source port, output
+ *   mpls     push an MPLS label, set it, output, pop it
+ *   of10     OpenFlow 1.0 set_vlan_vid (pushing a tag), set_nw_tos,
+ *            output
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_program.h>
+
+#define HEADROOM 16
+#define PACKET_BYTES 64
+
+static uint8_t packet[PACKET_BYTES];
+static uint8_t buf[HEADROOM + PACKET_BYTES];
+
+static void
+packet_output(void *cookie, uint32_t port, uint16_t max_len, uint8_t *data,
+              int len)
+{
+    locibench_sink += port + len;
+}
+
+static void
+packet_build(void)
+{
+    uint8_t *ip = packet + 14;
+    int i;
+
+    for (i = 0; i < PACKET_BYTES; i++) {
+        packet[i] = i * 7;
+    }
+    packet[0] &= 0xfe;
+    buf_u16_set(packet + 12, 0x0800);
+    MEMSET(ip, 0, 20);
+    ip[0] = 0x45;
+    buf_u16_set(ip + 2, PACKET_BYTES - 14);
+    ip[8] = 64;
+    ip[9] = 6;
+    ip[32] = 0x50;
+}
+
+static int
+action_append(of_list_action_t *actions, of_object_t *action)
+{
+    int rv;
+
+    if (action == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    rv = of_list_action_append(actions, action);
+    of_object_delete(action);
+
+    return rv;
+}
+
+static int
+set_field_append(of_list_action_t *actions, of_oxm_t *oxm)
+{
+    of_action_set_field_t *action;
+    int rv;
+
+    action = of_action_set_field_new(actions->version);
+    if (action == NULL || oxm == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    rv = of_action_set_field_field_set(action, oxm);
+    of_object_delete(oxm);
+    if (rv < 0) {
+        of_object_delete(action);
+        return rv;
+    }
+
+    return action_append(actions, action);
+}
+
+static int
+output_append(of_list_action_t *actions, uint32_t port)
+{
+    of_action_output_t *output;
+
+    output = of_action_output_new(actions->version);
+    if (output != NULL) {
+        of_action_output_port_set(output, port);
+    }
+
+    return action_append(actions, output);
+}
+
+static int
+actions_route(of_list_action_t *actions)
+{
+    of_mac_addr_t mac = { { 0x02, 0, 0, 0, 0, 1 } };
+    of_oxm_t *oxm;
+    int rv;
+
+    if ((oxm = of_oxm_eth_src_new(actions->version)) != NULL) {
+        of_oxm_eth_src_value_set(oxm, mac);
+    }
+    if ((rv = set_field_append(actions, oxm)) < 0) {
+        return rv;
+    }
+    mac.addr[5] = 2;
+    if ((oxm = of_oxm_eth_dst_new(actions->version)) != NULL) {
+        of_oxm_eth_dst_value_set(oxm, mac);
+    }
+    if ((rv = set_field_append(actions, oxm)) < 0 ||
+        (rv = action_append(actions,
+                            of_action_dec_nw_ttl_new(actions->version))) < 0) {
+        return rv;
+    }
+
+    return output_append(actions, 1);
+}
+
+static int
+actions_nat(of_list_action_t *actions)
+{
+    of_oxm_t *oxm;
+    int rv;
+
+    if ((oxm = of_oxm_ipv4_src_new(actions->version)) != NULL) {
+        of_oxm_ipv4_src_value_set(oxm, 0xc0a80001);
+    }
+    if ((rv = set_field_append(actions, oxm)) < 0) {
+        return rv;
+    }
+    if ((oxm = of_oxm_tcp_src_new(actions->version)) != NULL) {
+        of_oxm_tcp_src_value_set(oxm, 40000);
+    }
+    if ((rv = set_field_append(actions, oxm)) < 0) {
+        return rv;
+    }
+
+    return output_append(actions, 1);
+}
+
+static int
+actions_mpls(of_list_action_t *actions)
+{
+    of_object_t *action;
+    of_oxm_t *oxm;
+    int rv;
+
+    if ((action = of_action_push_mpls_new(actions->version)) != NULL) {
+        of_action_push_mpls_ethertype_set(action, 0x8847);
+    }
+    if ((rv = action_append(actions, action)) < 0) {
+        return rv;
+    }
+    if ((oxm = of_oxm_mpls_label_new(actions->version)) != NULL) {
+        of_oxm_mpls_label_value_set(oxm, 1000);
+    }
+    if ((rv = set_field_append(actions, oxm)) < 0 ||
+        (rv = output_append(actions, 1)) < 0) {
+        return rv;
+    }
+    if ((action = of_action_pop_mpls_new(actions->version)) != NULL) {
+        of_action_pop_mpls_ethertype_set(action, 0x0800);
+    }
+
+    return action_append(actions, action);
+}
+
+static int
+actions_of10(of_list_action_t *actions)
+{
+    of_object_t *action;
+    int rv;
+
+    if ((action = of_action_set_vlan_vid_new(actions->version)) != NULL) {
+        of_action_set_vlan_vid_vlan_vid_set(action, 100);
+    }
+    if ((rv = action_append(actions, action)) < 0) {
+        return rv;
+    }
+    if ((action = of_action_set_nw_tos_new(actions->version)) != NULL) {
+        of_action_set_nw_tos_nw_tos_set(action, 0xb8);
+    }
+    if ((rv = action_append(actions, action)) < 0) {
+        return rv;
+    }
+
+    return output_append(actions, 1);
+}
+
+static const struct {
+    const char *name;
+    of_version_t version;
+    int (*build)(of_list_action_t *actions);
+} flows[] = {
+    { "route", OF_VERSION_1_3, actions_route },
+    { "nat", OF_VERSION_1_3, actions_nat },
+    { "mpls", OF_VERSION_1_3, actions_mpls },
+    { "of10", OF_VERSION_1_0, actions_of10 },
+};
+
+/*
+ * The instructions of a flow; OpenFlow 1.0 has no instructions, so its
+ * actions are compiled on their own
+ */
+static of_object_t *
+flow_build(int flow)
+{
+    of_version_t version = flows[flow].version;
+    of_list_action_t *actions;
+    of_list_instruction_t *instructions;
+    of_instruction_apply_actions_t *apply;
+    int rv;
+
+    if ((actions = of_list_action_new(version)) == NULL) {
+        return NULL;
+    }
+    if (flows[flow].build(actions) < 0) {
+        of_object_delete(actions);
+        return NULL;
+    }
+    if (version == OF_VERSION_1_0) {
+        return actions;
+    }
+
+    instructions = of_list_instruction_new(version);
+    apply = of_instruction_apply_actions_new(version);
+    rv = OF_ERROR_RESOURCE;
+    if (instructions != NULL && apply != NULL &&
+        (rv = of_instruction_apply_actions_actions_set(apply, actions)) == 0) {
+        rv = of_list_instruction_append(instructions, apply);
+    }
+    of_object_delete(actions);
+    if (apply != NULL) {
+        of_object_delete(apply);
+    }
+    if (rv < 0) {
+        if (instructions != NULL) {
+            of_object_delete(instructions);
+        }
+        return NULL;
+    }
+
+    return instructions;
+}
+
+static int
+compile(loci_program_t *prog, of_object_t *list)
+{
+    if (list->version == OF_VERSION_1_0) {
+        return loci_program_compile_actions(prog, list);
+    }
+    return loci_program_compile(prog, list);
+}
+
+/* The packet as it came, for each op */
+static void
+packet_reset(loci_program_packet_t *pkt)
+{
+    MEMCPY(buf + HEADROOM, packet, PACKET_BYTES);
+    pkt->data = buf + HEADROOM;
+    pkt->len = PACKET_BYTES;
+    pkt->headroom = HEADROOM;
+}
+
+static int
+bench_flow(int flow)
+{
+    loci_program_t prog;
+    loci_program_packet_t pkt;
+    loci_program_env_t env;
+    of_object_t *list;
+    char name[64];
+    uint64_t start;
+    int i, n = locibench_iterations, err, rv = -1;
+
+    if ((list = flow_build(flow)) == NULL) {
+        return -1;
+    }
+    MEMSET(&env, 0, sizeof(env));
+    env.output = packet_output;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if (compile(&prog, list) < 0) {
+            goto done;
+        }
+        locibench_sink += prog.n_ops;
+        loci_program_cleanup(&prog);
+    }
+    snprintf(name, sizeof(name), "program/%s/compile", flows[flow].name);
+    locibench_report(name, n, start, 0);
+
+    if (compile(&prog, list) < 0) {
+        goto done;
+    }
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        packet_reset(&pkt);
+        if (loci_program_run(&prog, &pkt, &env) < 0) {
+            loci_program_cleanup(&prog);
+            goto done;
+        }
+    }
+    snprintf(name, sizeof(name), "program/%s/run", flows[flow].name);
+    locibench_report(name, n, start, 0);
+    loci_program_cleanup(&prog);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        packet_reset(&pkt);
+        if (compile(&prog, list) < 0) {
+            goto done;
+        }
+        err = loci_program_run(&prog, &pkt, &env);
+        loci_program_cleanup(&prog);
+        if (err < 0) {
+            goto done;
+        }
+    }
+    snprintf(name, sizeof(name), "program/%s/decode", flows[flow].name);
+    locibench_report(name, n, start, 0);
+    rv = 0;
+
+ done:
+    of_object_delete(list);
+    return rv;
+}
+
+int
+bench_program(void)
+{
+    int i;
+
+    packet_build();
+    for (i = 0; i < (int)(sizeof(flows) / sizeof(flows[0])); i++) {
+        if (bench_flow(i) < 0) {
+            fprintf(stderr, "program benchmark failed for %s\n",
+                    flows[i].name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
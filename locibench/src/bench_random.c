@@ -0,0 +1,89 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_random.c
+ *
+ * Random workload generation rate
+ *
+ * random/<version>/message generates and deletes a message of a type
+ * drawn from every message type of the version, so it bounds how fast
+ * a generated workload can be fed to the other benchmarks.
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_random.h>
+
+static const struct {
+    of_version_t version;
+    const char *name;
+} versions[] = {
+    { OF_VERSION_1_0, "1.0" },
+    { OF_VERSION_1_1, "1.1" },
+    { OF_VERSION_1_2, "1.2" },
+    { OF_VERSION_1_3, "1.3" },
+    { OF_VERSION_1_4, "1.4" },
+};
+
+static int
+bench_messages(loci_random_t *r, of_version_t version, const char *version_name)
+{
+    of_object_t *obj;
+    char name[64];
+    uint64_t start, bytes = 0;
+    int i, n = locibench_iterations;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if ((obj = loci_random_message_new(r, version)) == NULL) {
+            return -1;
+        }
+        bytes += obj->length;
+        of_object_delete(obj);
+    }
+    snprintf(name, sizeof(name), "random/%s/message", version_name);
+    locibench_report(name, n, start, bytes / n);
+    locibench_sink += bytes;
+
+    return 0;
+}
+
+int
+bench_random(void)
+{
+    loci_random_t r;
+    of_match_t match;
+    of_octets_t octets;
+    uint64_t start;
+    int i, n = locibench_iterations;
+
+    loci_random_init(&r, NULL);
+
+    for (i = 0; i < (int)(sizeof(versions) / sizeof(versions[0])); i++) {
+        if (bench_messages(&r, versions[i].version, versions[i].name) < 0) {
+            fprintf(stderr, "random benchmark failed for %s\n",
+                    versions[i].name);
+            loci_random_cleanup(&r);
+            return -1;
+        }
+    }
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        loci_random_match(&r, OF_VERSION_1_3, &match);
+        locibench_sink += match.fields.in_port;
+    }
+    locibench_report("random/match", n, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        loci_random_packet(&r, &octets);
+        locibench_sink += octets.bytes;
+    }
+    locibench_report("random/packet", n, start, 0);
+
+    loci_random_cleanup(&r);
+    return 0;
+}
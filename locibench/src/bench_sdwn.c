@@ -0,0 +1,406 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_sdwn.c
+ *
+ * A poll of an access point with 1024 crypto clients, one
+ * of_sdwn_get_clients_reply per client with a 16 byte key, written and
+ * read back to back in one buffer, one op per client:
+ *
+ *   sdwn/1k/objects  of_sdwn_get_clients_reply_crypto_new, the setters
+ *                    and keys_set per client, copied to the buffer
+ *   sdwn/1k/encode   loci_sdwn_clients_reply_encode
+ *   sdwn/1k/parse    of_object_new_from_message_preallocated per
+ *                    reply, the getters and keys_bind
+ *   sdwn/1k/decode   loci_sdwn_clients_decode
+ *
+ * A probe storm of 4096 of_sdwn_ieee80211_mgmt, 256 clients each
+ * heard on 2 radios 8 times, one op per message:
+ *
+ *   sdwn/probe/object        of_object_new_from_message_preallocated
+ *                            and the getters per message
+ *   sdwn/probe/peek          loci_sdwn_mgmt_peek per message
+ *   sdwn/probe/dispatch      loci_sdwn_mgmt_dispatch to a handler
+ *   sdwn/probe/filter        The same through a filter of one probe
+ *                            per client per storm
+ *   sdwn/probe/reply-object  of_sdwn_ieee80211_mgmt_reply_new and the
+ *                            setters per message
+ *   sdwn/probe/reply         loci_sdwn_mgmt_reply_build over a copy of
+ *                            the message
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_sdwn_client.h>
+#include <loci/loci_sdwn_mgmt.h>
+
+#define CLIENTS 1024
+#define KEY_BYTES 16
+#define REPLY_BYTES (LOCI_SDWN_REPLY_BYTES + 4 + KEY_BYTES)
+
+static uint8_t rates[OF_DESC_STR_LEN];
+static uint8_t key[4 + KEY_BYTES];
+
+static void
+clients_make(loci_sdwn_client_t *clients)
+{
+    loci_sdwn_client_t *client;
+    int i;
+
+    buf_u16_set(key, 0x37);     /* of_bsn_tlv_data */
+    buf_u16_set(key + 2, sizeof(key));
+    for (i = 0; i < KEY_BYTES; i++) {
+        key[4 + i] = i;
+    }
+    for (i = 0; i < OF_DESC_STR_LEN; i++) {
+        rates[i] = i;
+    }
+
+    for (i = 0; i < CLIENTS; i++) {
+        client = &clients[i];
+        MEMSET(client, 0, sizeof(*client));
+        client->type = LOCI_SDWN_CLIENT_CRYPTO;
+        client->mac.addr[0] = 0x02;
+        client->mac.addr[4] = i >> 8;
+        client->mac.addr[5] = i;
+        client->assoc_id = i + 1;
+        client->capabilities = 0x431;
+        client->cap_flags = 0x3;
+        client->ht_capabilities[0] = 0x6f;
+        client->vht_capabilities[0] = 0x91;
+        client->supported_rates = rates;
+        client->keys = key;
+        client->keys_len = sizeof(key);
+    }
+}
+
+/* The keys of every client, as a list for keys_set */
+static of_list_bsn_tlv_data_t *
+keys_list(void)
+{
+    of_list_bsn_tlv_data_t *list;
+    of_bsn_tlv_data_t *tlv;
+    of_octets_t value = { key + 4, KEY_BYTES };
+    int rv = -1;
+
+    if ((list = of_list_bsn_tlv_data_new(OF_VERSION_1_3)) == NULL) {
+        return NULL;
+    }
+    if ((tlv = of_bsn_tlv_data_new(OF_VERSION_1_3)) != NULL) {
+        if (of_bsn_tlv_data_value_set(tlv, &value) == 0) {
+            rv = of_list_append(list, tlv);
+        }
+        of_object_delete(tlv);
+    }
+    if (rv < 0) {
+        of_object_delete(list);
+        return NULL;
+    }
+
+    return list;
+}
+
+/* One reply per client through the setters, back to back in buf */
+static int
+poll_objects(uint8_t *buf, const loci_sdwn_client_t *clients,
+             of_list_bsn_tlv_data_t *keys)
+{
+    of_object_t *obj;
+    const loci_sdwn_client_t *client;
+    of_desc_str_t supported_rates;
+    int i, offset = 0;
+
+    for (i = 0; i < CLIENTS; i++) {
+        client = &clients[i];
+        if ((obj = of_sdwn_get_clients_reply_crypto_new(OF_VERSION_1_3)) ==
+            NULL) {
+            return -1;
+        }
+        of_sdwn_get_clients_reply_crypto_xid_set(obj, 1);
+        if (i < CLIENTS - 1) {
+            of_sdwn_get_clients_reply_crypto_flags_set(
+                obj, OF_STATS_REPLY_FLAG_REPLY_MORE);
+        }
+        of_sdwn_get_clients_reply_crypto_mac_set(obj, client->mac);
+        of_sdwn_get_clients_reply_crypto_assoc_id_set(obj, client->assoc_id);
+        of_sdwn_get_clients_reply_crypto_capabilities_set(
+            obj, client->capabilities);
+        of_sdwn_get_clients_reply_crypto_cap_flags_set(obj,
+                                                       client->cap_flags);
+        MEMCPY(supported_rates, client->supported_rates, OF_DESC_STR_LEN);
+        of_sdwn_get_clients_reply_crypto_supported_rates_set(
+            obj, supported_rates);
+        if (of_sdwn_get_clients_reply_crypto_keys_set(obj, keys) < 0) {
+            of_object_delete(obj);
+            return -1;
+        }
+        MEMCPY(buf + offset, OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+        offset += obj->length;
+        of_object_delete(obj);
+    }
+
+    return offset;
+}
+
+/* Each reply as an object, through the getters */
+static int
+poll_parse(uint8_t *buf, int len)
+{
+    of_object_storage_t storage;
+    of_object_t *obj;
+    of_list_bsn_tlv_data_t list;
+    of_mac_addr_t mac;
+    uint16_t assoc_id, capabilities;
+    int offset, n = 0;
+
+    for (offset = 0; offset < len; offset += obj->length, n++) {
+        obj = of_object_new_from_message_preallocated(
+            &storage, buf + offset, of_message_length_get(buf + offset));
+        if (obj == NULL || obj->object_id != OF_SDWN_GET_CLIENTS_REPLY_CRYPTO) {
+            return -1;
+        }
+        of_sdwn_get_clients_reply_crypto_mac_get(obj, &mac);
+        of_sdwn_get_clients_reply_crypto_assoc_id_get(obj, &assoc_id);
+        of_sdwn_get_clients_reply_crypto_capabilities_get(obj,
+                                                          &capabilities);
+        of_sdwn_get_clients_reply_crypto_keys_bind(obj, &list);
+        locibench_sink += mac.addr[5] + assoc_id + capabilities +
+            list.length;
+    }
+
+    return n;
+}
+
+#define PROBES 4096
+#define PROBE_CLIENTS 256
+
+/* The storm, back to back in buf */
+static int
+storm_build(uint8_t *buf)
+{
+    of_sdwn_ieee80211_mgmt_t *obj;
+    of_mac_addr_t mac = { { 0x02, 0, 0, 0, 0, 0 } };
+    int i, client;
+
+    for (i = 0; i < PROBES; i++) {
+        if ((obj = of_sdwn_ieee80211_mgmt_new(OF_VERSION_1_3)) == NULL) {
+            return -1;
+        }
+        client = (i / 2) & (PROBE_CLIENTS - 1);
+        mac.addr[5] = client;
+        of_sdwn_ieee80211_mgmt_xid_set(obj, i);
+        of_sdwn_ieee80211_mgmt_ieee80211_type_set(obj, IEEE80211_PROBE);
+        of_sdwn_ieee80211_mgmt_addr_set(obj, mac);
+        of_sdwn_ieee80211_mgmt_ssi_set(obj, (uint32_t)-50 - client / 8);
+        of_sdwn_ieee80211_mgmt_freq_set(obj, 2412);
+        of_sdwn_ieee80211_mgmt_if_no_set(obj, 1 + (i & 1));
+        MEMCPY(buf + i * LOCI_SDWN_MGMT_BYTES, OF_OBJECT_BUFFER_INDEX(obj, 0),
+               LOCI_SDWN_MGMT_BYTES);
+        of_object_delete(obj);
+    }
+
+    return 0;
+}
+
+static int
+probe_handle(void *cookie, loci_sdwn_mgmt_t *mgmt)
+{
+    locibench_sink += mgmt->ssi + mgmt->addr.addr[5];
+
+    return 0;
+}
+
+static int
+bench_probe(void)
+{
+    loci_sdwn_mgmt_handler_f handlers[LOCI_SDWN_MGMT_TYPES] = { NULL };
+    loci_sdwn_mgmt_filter_t filter;
+    loci_sdwn_mgmt_t mgmt;
+    of_object_storage_t storage;
+    of_object_t *obj;
+    of_mac_addr_t mac;
+    of_port_no_t if_no;
+    uint32_t ssi, freq;
+    uint8_t type, scratch[LOCI_SDWN_MGMT_BYTES];
+    uint8_t *buf, *msg;
+    uint64_t start;
+    int i, j, rv, len = PROBES * LOCI_SDWN_MGMT_BYTES;
+    int storms = locibench_iterations / PROBES + 1;
+
+    handlers[IEEE80211_PROBE] = probe_handle;
+    if ((buf = MALLOC(len)) == NULL) {
+        return -1;
+    }
+    rv = loci_sdwn_mgmt_filter_init(&filter, 4 * PROBE_CLIENTS, 1, 1);
+    if (rv == 0) {
+        rv = storm_build(buf);
+    }
+
+    start = locibench_start();
+    for (i = 0; i < storms && rv == 0; i++) {
+        for (j = 0; j < PROBES; j++) {
+            msg = buf + j * LOCI_SDWN_MGMT_BYTES;
+            obj = of_object_new_from_message_preallocated(
+                &storage, msg, LOCI_SDWN_MGMT_BYTES);
+            if (obj == NULL) {
+                rv = -1;
+                break;
+            }
+            of_sdwn_ieee80211_mgmt_ieee80211_type_get(obj, &type);
+            of_sdwn_ieee80211_mgmt_addr_get(obj, &mac);
+            of_sdwn_ieee80211_mgmt_ssi_get(obj, &ssi);
+            of_sdwn_ieee80211_mgmt_freq_get(obj, &freq);
+            of_sdwn_ieee80211_mgmt_if_no_get(obj, &if_no);
+            locibench_sink += type + mac.addr[5] + ssi + freq + if_no;
+        }
+    }
+    locibench_report("sdwn/probe/object", storms * PROBES, start,
+                     LOCI_SDWN_MGMT_BYTES);
+
+    start = locibench_start();
+    for (i = 0; i < storms && rv == 0; i++) {
+        for (j = 0; j < PROBES; j++) {
+            rv = loci_sdwn_mgmt_peek(buf + j * LOCI_SDWN_MGMT_BYTES,
+                                     LOCI_SDWN_MGMT_BYTES, &mgmt);
+            locibench_sink += mgmt.type + mgmt.addr.addr[5] + mgmt.ssi +
+                mgmt.freq + mgmt.if_no;
+        }
+    }
+    locibench_report("sdwn/probe/peek", storms * PROBES, start,
+                     LOCI_SDWN_MGMT_BYTES);
+
+    start = locibench_start();
+    for (i = 0; i < storms && rv == 0; i++) {
+        if (loci_sdwn_mgmt_dispatch(buf, len, handlers, NULL, 0, NULL) !=
+            PROBES) {
+            rv = -1;
+        }
+    }
+    locibench_report("sdwn/probe/dispatch", storms * PROBES, start,
+                     LOCI_SDWN_MGMT_BYTES);
+
+    /* A storm a tick; clients sharing a slot get more through */
+    start = locibench_start();
+    for (i = 0; i < storms && rv == 0; i++) {
+        if (loci_sdwn_mgmt_dispatch(buf, len, handlers, &filter, i, NULL) <
+            PROBE_CLIENTS) {
+            rv = -1;
+        }
+    }
+    locibench_report("sdwn/probe/filter", storms * PROBES, start,
+                     LOCI_SDWN_MGMT_BYTES);
+
+    start = locibench_start();
+    for (i = 0; i < storms && rv == 0; i++) {
+        for (j = 0; j < PROBES; j++) {
+            obj = of_sdwn_ieee80211_mgmt_reply_new(OF_VERSION_1_3);
+            if (obj == NULL) {
+                rv = -1;
+                break;
+            }
+            of_sdwn_ieee80211_mgmt_reply_xid_set(obj, j);
+            of_sdwn_ieee80211_mgmt_reply_if_no_set(obj, 1 + (j & 1));
+            of_sdwn_ieee80211_mgmt_reply_deny_set(obj, 1);
+            locibench_sink += obj->length;
+            of_object_delete(obj);
+        }
+    }
+    locibench_report("sdwn/probe/reply-object", storms * PROBES, start,
+                     LOCI_SDWN_MGMT_REPLY_BYTES);
+
+    start = locibench_start();
+    for (i = 0; i < storms && rv == 0; i++) {
+        for (j = 0; j < PROBES; j++) {
+            MEMCPY(scratch, buf + j * LOCI_SDWN_MGMT_BYTES,
+                   LOCI_SDWN_MGMT_BYTES);
+            if (loci_sdwn_mgmt_reply_build(scratch, sizeof(scratch), 1) !=
+                LOCI_SDWN_MGMT_REPLY_BYTES) {
+                rv = -1;
+                break;
+            }
+            locibench_sink += scratch[3];
+        }
+    }
+    locibench_report("sdwn/probe/reply", storms * PROBES, start,
+                     LOCI_SDWN_MGMT_REPLY_BYTES);
+
+    loci_sdwn_mgmt_filter_cleanup(&filter);
+    FREE(buf);
+
+    return rv;
+}
+
+int
+bench_sdwn(void)
+{
+    loci_sdwn_client_t *clients, *decoded;
+    of_list_bsn_tlv_data_t *keys;
+    uint8_t *buf;
+    uint64_t start;
+    int i, len = 0, next, rv = 0;
+    int polls = locibench_iterations / CLIENTS + 1;
+
+    clients = MALLOC(CLIENTS * sizeof(*clients));
+    decoded = MALLOC(CLIENTS * sizeof(*decoded));
+    buf = MALLOC(CLIENTS * REPLY_BYTES);
+    keys = keys_list();
+    if (clients == NULL || decoded == NULL || buf == NULL || keys == NULL) {
+        rv = -1;
+    } else {
+        clients_make(clients);
+    }
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        if ((len = poll_objects(buf, clients, keys)) != CLIENTS * REPLY_BYTES) {
+            rv = -1;
+        }
+    }
+    locibench_report("sdwn/1k/objects", polls * CLIENTS, start, REPLY_BYTES);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        next = 0;
+        len = loci_sdwn_clients_reply_encode(buf, CLIENTS * REPLY_BYTES, 1,
+                                             clients, CLIENTS, &next);
+        if (len != CLIENTS * REPLY_BYTES) {
+            rv = -1;
+        }
+    }
+    locibench_report("sdwn/1k/encode", polls * CLIENTS, start, REPLY_BYTES);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        if (poll_parse(buf, len) != CLIENTS) {
+            rv = -1;
+        }
+    }
+    locibench_report("sdwn/1k/parse", polls * CLIENTS, start, REPLY_BYTES);
+
+    start = locibench_start();
+    for (i = 0; i < polls && rv == 0; i++) {
+        if (loci_sdwn_clients_decode(buf, len, decoded, CLIENTS, NULL) !=
+            CLIENTS) {
+            rv = -1;
+        }
+        locibench_sink += decoded[CLIENTS - 1].assoc_id;
+    }
+    locibench_report("sdwn/1k/decode", polls * CLIENTS, start, REPLY_BYTES);
+
+    if (keys != NULL) {
+        of_object_delete(keys);
+    }
+    FREE(buf);
+    FREE(decoded);
+    FREE(clients);
+    if (rv == 0) {
+        rv = bench_probe();
+    }
+    if (rv < 0) {
+        fprintf(stderr, "sdwn benchmark failed\n");
+    }
+
+    return rv;
+}
@@ -0,0 +1,187 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_template.c
+ *
+ * Reactive flow_add emission: building each flow with of_flow_add_new
+ * and the setters, or with the setters in a send buffer, against
+ * patching an instance of a template.  Each flow differs in xid,
+ * cookie, ipv4_dst, tcp_dst and output port.
+ *
+ *   template/<version>/flow_add/new           new, setters, delete
+ *   template/<version>/flow_add/preallocated  setters in the send buffer
+ *   template/<version>/flow_add/instance      copy of the image, 5 patches
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_template.h>
+
+static const struct {
+    of_version_t version;
+    const char *name;
+} versions[] = {
+    { OF_VERSION_1_0, "1.0" },
+    { OF_VERSION_1_3, "1.3" },
+};
+
+static int
+flow_add_set(of_flow_add_t *obj, uint32_t xid, uint32_t ipv4_dst,
+             uint16_t tcp_dst, of_port_no_t port, of_match_t *match,
+             of_action_output_t *output)
+{
+    of_version_t version = obj->version;
+    of_list_instruction_t instructions;
+    of_instruction_apply_actions_t apply;
+    of_list_action_t actions;
+
+    of_flow_add_xid_set(obj, xid);
+    of_flow_add_cookie_set(obj, xid);
+    of_flow_add_priority_set(obj, 1000);
+    of_flow_add_idle_timeout_set(obj, 10);
+
+    memset(match, 0, sizeof(*match));
+    match->version = version;
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.ipv4_dst = ipv4_dst;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    match->fields.tcp_dst = tcp_dst;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+    if (of_flow_add_match_set(obj, match) < 0) {
+        return -1;
+    }
+
+    if (version == OF_VERSION_1_0) {
+        of_flow_add_actions_bind(obj, &actions);
+    } else {
+        of_flow_add_instructions_bind(obj, &instructions);
+        of_instruction_apply_actions_init(&apply, version, -1, 1);
+        if (of_list_instruction_append_bind(&instructions, &apply) < 0) {
+            return -1;
+        }
+        of_instruction_apply_actions_actions_bind(&apply, &actions);
+    }
+    of_action_output_init(output, version, -1, 1);
+    if (of_list_action_append_bind(&actions, output) < 0) {
+        return -1;
+    }
+    of_action_output_port_set(output, port);
+
+    return 0;
+}
+
+static of_flow_add_t *
+flow_add_build(of_version_t version, uint32_t xid, uint32_t ipv4_dst,
+               uint16_t tcp_dst, of_port_no_t port, of_match_t *match,
+               of_action_output_t *output)
+{
+    of_flow_add_t *obj;
+
+    obj = of_flow_add_new(version);
+    if (flow_add_set(obj, xid, ipv4_dst, tcp_dst, port, match, output) < 0) {
+        of_flow_add_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static int
+bench_version(of_version_t version, const char *version_name)
+{
+    loci_template_t t;
+    of_object_storage_t storage;
+    of_flow_add_t *obj;
+    of_action_output_t output;
+    of_match_t match;
+    uint8_t buf[512];
+    char name[64];
+    uint64_t start;
+    int i, len = 0, n = locibench_iterations;
+    int xid, cookie, dst, tp_dst, port;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        obj = flow_add_build(version, i, 0x0a000000 + i, i, i & 0xff,
+                             &match, &output);
+        if (obj == NULL) {
+            return -1;
+        }
+        locibench_sink += obj->length;
+        of_flow_add_delete(obj);
+    }
+    snprintf(name, sizeof(name), "template/%s/flow_add/new", version_name);
+    locibench_report(name, n, start, 0);
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        obj = of_object_new_preallocated(&storage, OF_FLOW_ADD, version,
+                                         buf, sizeof(buf));
+        if (obj == NULL ||
+            flow_add_set(obj, i, 0x0a000000 + i, i, i & 0xff,
+                         &match, &output) < 0) {
+            return -1;
+        }
+        len = obj->length;
+        locibench_sink += buf[len - 1];
+    }
+    snprintf(name, sizeof(name), "template/%s/flow_add/preallocated",
+             version_name);
+    locibench_report(name, n, start, len);
+
+    obj = flow_add_build(version, 0, 0x0a000000, 80, 1, &match, &output);
+    if (obj == NULL || loci_template_init(&t, obj) < 0) {
+        return -1;
+    }
+    xid = loci_template_field_u32(&t, obj, of_flow_add_xid_set);
+    cookie = loci_template_field_u64(&t, obj, of_flow_add_cookie_set);
+    dst = loci_template_field_match(&t, of_flow_add_match_set, &match,
+                                    "ipv4_dst");
+    tp_dst = loci_template_field_match(&t, of_flow_add_match_set, &match,
+                                       "tcp_dst");
+    port = loci_template_field_u32(&t, &output, of_action_output_port_set);
+    if (xid < 0 || cookie < 0 || dst < 0 || tp_dst < 0 || port < 0 ||
+        t.length > (int)sizeof(buf)) {
+        loci_template_cleanup(&t);
+        of_flow_add_delete(obj);
+        return -1;
+    }
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        loci_template_instance(&t, buf);
+        loci_template_patch(&t, buf, xid, i);
+        loci_template_patch(&t, buf, cookie, i);
+        loci_template_patch(&t, buf, dst, 0x0a000000 + i);
+        loci_template_patch(&t, buf, tp_dst, i);
+        loci_template_patch(&t, buf, port, i & 0xff);
+        locibench_sink += buf[t.length - 1];
+    }
+    snprintf(name, sizeof(name), "template/%s/flow_add/instance", version_name);
+    locibench_report(name, n, start, t.length);
+
+    loci_template_cleanup(&t);
+    of_flow_add_delete(obj);
+    return 0;
+}
+
+int
+bench_template(void)
+{
+    int i;
+
+    for (i = 0; i < (int)(sizeof(versions) / sizeof(versions[0])); i++) {
+        if (bench_version(versions[i].version, versions[i].name) < 0) {
+            fprintf(stderr, "template benchmark failed for %s\n",
+                    versions[i].name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
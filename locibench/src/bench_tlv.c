@@ -0,0 +1,182 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file bench_tlv.c
+ *
+ * Finding 5 TLVs (port, vlan_vid, mac, ipv4, udp_dst) in a gentable key
+ * of 8 BSN TLVs, one op per key:
+ *
+ *   tlv/iterate  OF_LIST_BSN_TLV_ITER, switching on each TLV's class
+ *   tlv/index    loci_bsn_tlv_index, then the typed getters
+ *
+ * and, one op per pair of indexed keys:
+ *
+ *   tlv/hash     loci_bsn_tlv_hash
+ *   tlv/equal    loci_bsn_tlv_equal of the key and the same TLVs in
+ *                reverse order
+ */
+
+#include <locibench/locibench.h>
+#include <loci/loci_bsn_tlv.h>
+
+#define KEY_TLVS 8
+
+/* Append the key's TLVs, the first one last if reverse */
+static int
+key_make(of_list_bsn_tlv_t *list, int reverse)
+{
+    of_mac_addr_t mac = { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } };
+    of_octets_t name = { (uint8_t *)"eth1", 4 };
+    of_object_t *tlv[KEY_TLVS];
+    int i, rv = 0;
+
+    tlv[0] = of_bsn_tlv_port_new(list->version);
+    tlv[1] = of_bsn_tlv_vlan_vid_new(list->version);
+    tlv[2] = of_bsn_tlv_mac_new(list->version);
+    tlv[3] = of_bsn_tlv_name_new(list->version);
+    tlv[4] = of_bsn_tlv_ipv4_new(list->version);
+    tlv[5] = of_bsn_tlv_ip_proto_new(list->version);
+    tlv[6] = of_bsn_tlv_udp_dst_new(list->version);
+    tlv[7] = of_bsn_tlv_rx_packets_new(list->version);
+    for (i = 0; i < KEY_TLVS; i++) {
+        if (tlv[i] == NULL) {
+            rv = -1;
+        }
+    }
+    if (rv == 0) {
+        of_bsn_tlv_port_value_set(tlv[0], 7);
+        of_bsn_tlv_vlan_vid_value_set(tlv[1], 10);
+        of_bsn_tlv_mac_value_set(tlv[2], mac);
+        rv = of_bsn_tlv_name_value_set(tlv[3], &name);
+        of_bsn_tlv_ipv4_value_set(tlv[4], 0x0a000001);
+        of_bsn_tlv_ip_proto_value_set(tlv[5], 17);
+        of_bsn_tlv_udp_dst_value_set(tlv[6], 4789);
+        of_bsn_tlv_rx_packets_value_set(tlv[7], 1000);
+    }
+    for (i = 0; i < KEY_TLVS; i++) {
+        if (rv == 0) {
+            rv = of_list_append(list, tlv[reverse ? KEY_TLVS - 1 - i : i]);
+        }
+    }
+    for (i = 0; i < KEY_TLVS; i++) {
+        if (tlv[i] != NULL) {
+            of_object_delete(tlv[i]);
+        }
+    }
+
+    return rv;
+}
+
+static void
+bench_iterate(of_list_bsn_tlv_t *key)
+{
+    of_object_t tlv;
+    of_mac_addr_t mac;
+    uint64_t start;
+    uint32_t port = 0, ipv4 = 0;
+    uint16_t vlan_vid = 0, udp_dst = 0;
+    int i, rv, n = locibench_iterations;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        OF_LIST_BSN_TLV_ITER(key, &tlv, rv) {
+            switch (tlv.object_id) {
+            case OF_BSN_TLV_PORT:
+                of_bsn_tlv_port_value_get(&tlv, &port);
+                break;
+            case OF_BSN_TLV_VLAN_VID:
+                of_bsn_tlv_vlan_vid_value_get(&tlv, &vlan_vid);
+                break;
+            case OF_BSN_TLV_MAC:
+                of_bsn_tlv_mac_value_get(&tlv, &mac);
+                locibench_sink += mac.addr[5];
+                break;
+            case OF_BSN_TLV_IPV4:
+                of_bsn_tlv_ipv4_value_get(&tlv, &ipv4);
+                break;
+            case OF_BSN_TLV_UDP_DST:
+                of_bsn_tlv_udp_dst_value_get(&tlv, &udp_dst);
+                break;
+            default:
+                break;
+            }
+        }
+        locibench_sink += port + vlan_vid + ipv4 + udp_dst;
+    }
+    locibench_report("tlv/iterate", n, start, 0);
+}
+
+static void
+bench_index(of_list_bsn_tlv_t *key)
+{
+    loci_bsn_tlv_index_t idx;
+    of_mac_addr_t mac;
+    uint64_t start;
+    uint32_t port = 0, ipv4 = 0;
+    uint16_t vlan_vid = 0, udp_dst = 0;
+    int i, n = locibench_iterations;
+
+    start = locibench_start();
+    for (i = 0; i < n; i++) {
+        if (loci_bsn_tlv_index_list(&idx, key) == 0) {
+            loci_bsn_tlv_u32_get(&idx, OF_BSN_TLV_PORT, &port);
+            loci_bsn_tlv_u16_get(&idx, OF_BSN_TLV_VLAN_VID, &vlan_vid);
+            if (loci_bsn_tlv_mac_get(&idx, OF_BSN_TLV_MAC, &mac) == 0) {
+                locibench_sink += mac.addr[5];
+            }
+            loci_bsn_tlv_u32_get(&idx, OF_BSN_TLV_IPV4, &ipv4);
+            loci_bsn_tlv_u16_get(&idx, OF_BSN_TLV_UDP_DST, &udp_dst);
+        }
+        locibench_sink += port + vlan_vid + ipv4 + udp_dst;
+    }
+    locibench_report("tlv/index", n, start, 0);
+}
+
+int
+bench_tlv(void)
+{
+    of_list_bsn_tlv_t *key, *reversed;
+    loci_bsn_tlv_index_t a, b;
+    uint64_t start;
+    int i, n = locibench_iterations, rv = -1;
+
+    key = of_list_bsn_tlv_new(OF_VERSION_1_3);
+    reversed = of_list_bsn_tlv_new(OF_VERSION_1_3);
+    if (key != NULL && reversed != NULL && key_make(key, 0) == 0 &&
+        key_make(reversed, 1) == 0 &&
+        loci_bsn_tlv_index_list(&a, key) == 0 &&
+        loci_bsn_tlv_index_list(&b, reversed) == 0 &&
+        loci_bsn_tlv_equal(&a, &b)) {
+        rv = 0;
+    }
+    if (rv < 0) {
+        fprintf(stderr, "tlv benchmark failed to build keys\n");
+    } else {
+        bench_iterate(key);
+        bench_index(key);
+
+        start = locibench_start();
+        for (i = 0; i < n; i++) {
+            locibench_sink += loci_bsn_tlv_hash(&a, i);
+        }
+        locibench_report("tlv/hash", n, start, 0);
+
+        start = locibench_start();
+        for (i = 0; i < n; i++) {
+            locibench_sink += loci_bsn_tlv_equal(&a, &b);
+        }
+        locibench_report("tlv/equal", n, start, 0);
+    }
+
+    if (key != NULL) {
+        of_object_delete(key);
+    }
+    if (reversed != NULL) {
+        of_object_delete(reversed);
+    }
+
+    return rv;
+}
@@ -0,0 +1,180 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * @file main.c
+ *
+ * Run the LOCI benchmarks
+ *
+ * Usage: locibench [-n iterations] [group ...]
+ *
+ * Heap allocations are counted by wrapping malloc and free at link
+ * time (see the Makefile).
+ */
+
+#include <stdarg.h>
+
+#include <locibench/locibench.h>
+#include <loci/loci_stats.h>
+
+int locibench_iterations = LOCIBENCH_DEFAULT_ITERATIONS;
+volatile uint64_t locibench_sink;
+
+static uint64_t alloc_count;
+static uint64_t alloc_bytes;
+
+extern void *__real_malloc(size_t size);
+
+void *
+__wrap_malloc(size_t size)
+{
+    alloc_count++;
+    alloc_bytes += size;
+    return __real_malloc(size);
+}
+
+static struct {
+    const char *name;
+    int (*fn)(void);
+} groups[] = {
+    { "capture", bench_capture },
+    { "checksum", bench_checksum },
+    { "classifier", bench_classifier },
+    { "columns", bench_columns },
+    { "corpus", bench_corpus },
+    { "counter", bench_counter },
+    { "export", bench_export },
+    { "gentable", bench_gentable },
+    { "hash", bench_hash },
+    { "list", bench_list },
+    { "match", bench_match },
+    { "packet", bench_packet },
+    { "parse", bench_parse },
+    { "pdu", bench_pdu },
+    { "peek", bench_peek },
+    { "program", bench_program },
+    { "random", bench_random },
+    { "sdwn", bench_sdwn },
+    { "template", bench_template },
+    { "tlv", bench_tlv },
+};
+
+uint64_t
+locibench_start(void)
+{
+    alloc_count = 0;
+    alloc_bytes = 0;
+    return locibench_now_ns();
+}
+
+void
+locibench_report(const char *name, int iterations, uint64_t start, uint64_t bytes)
+{
+    uint64_t ns = locibench_now_ns() - start;
+
+    printf("%-48s %10d %12.1f ns/op %10.1f B/op %6.2f allocs/op %8" PRIu64 " out-B/op\n",
+           name, iterations, (double)ns / iterations,
+           (double)alloc_bytes / iterations, (double)alloc_count / iterations,
+           bytes);
+    fflush(stdout);
+}
+
+int
+locibench_text_writer(void *cookie, const char *fmt, ...)
+{
+    locibench_text_t *tb = cookie;
+    va_list ap;
+    int rv;
+
+    if (tb->len > LOCIBENCH_TEXT_BUF_SIZE / 2) {
+        tb->total += tb->len;
+        tb->len = 0;
+    }
+    va_start(ap, fmt);
+    rv = vsnprintf(tb->data + tb->len, LOCIBENCH_TEXT_BUF_SIZE - tb->len, fmt, ap);
+    va_end(ap);
+    if (rv < 0) {
+        return rv;
+    }
+    if (tb->len + rv >= LOCIBENCH_TEXT_BUF_SIZE) {
+        /* Cut short: flush and write it again from the start */
+        tb->total += tb->len;
+        tb->len = 0;
+        va_start(ap, fmt);
+        vsnprintf(tb->data, LOCIBENCH_TEXT_BUF_SIZE, fmt, ap);
+        va_end(ap);
+        if (rv >= LOCIBENCH_TEXT_BUF_SIZE) {
+            /* Larger than the buffer: only its size is kept */
+            tb->total += rv;
+            return rv;
+        }
+    }
+    tb->len += rv;
+    return rv;
+}
+
+static int
+stderr_writer(void *cookie, const char *fmt, ...)
+{
+    va_list ap;
+    int rv;
+
+    va_start(ap, fmt);
+    rv = vfprintf(stderr, fmt, ap);
+    va_end(ap);
+
+    return rv;
+}
+
+static int
+selected(const char *name, int argc, char *argv[], int first)
+{
+    int i;
+
+    if (first >= argc) {
+        return 1;
+    }
+    for (i = first; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int first = 1;
+    int rv = 0;
+    int i;
+
+    if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+        locibench_iterations = atoi(argv[2]);
+        if (locibench_iterations <= 0) {
+            fprintf(stderr, "Bad iteration count %s\n", argv[2]);
+            return 1;
+        }
+        first = 3;
+    }
+
+    for (i = 0; i < (int)(sizeof(groups) / sizeof(groups[0])); i++) {
+        if (selected(groups[i].name, argc, argv, first)) {
+            if (groups[i].fn() < 0) {
+                fprintf(stderr, "Benchmark group %s failed\n", groups[i].name);
+                rv = 1;
+            }
+        }
+    }
+
+    if (LOCI_STATS_ENABLED) {
+        static loci_stats_t stats;
+
+        loci_stats_snapshot(&stats);
+        loci_stats_show(stderr_writer, NULL, &stats);
+    }
+
+    return rv;
+}
@@ -64,6 +64,29 @@ extern int run_validator_tests(void);
 
 extern int run_list_limits_tests(void);
 
+extern int run_export_tests(void);
+extern int run_parse_tests(void);
+extern int run_stats_tests(void);
+extern int run_trace_tests(void);
+extern int run_random_tests(void);
+extern int run_capture_tests(void);
+extern int run_template_tests(void);
+extern int run_preallocated_tests(void);
+extern int run_peek_tests(void);
+extern int run_packet_tests(void);
+extern int run_classifier_tests(void);
+extern int run_program_tests(void);
+extern int run_hash_tests(void);
+extern int run_gentable_tests(void);
+extern int run_gentable_resync_tests(void);
+extern int run_flow_checksum_tests(void);
+extern int run_bsn_tlv_tests(void);
+extern int run_debug_counter_tests(void);
+extern int run_columns_tests(void);
+extern int run_sdwn_client_tests(void);
+extern int run_sdwn_mgmt_tests(void);
+extern int run_pdu_sched_tests(void);
+
 extern int test_ext_objs(void);
 extern int test_datafiles(void);
 
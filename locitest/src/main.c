@@ -41,6 +41,29 @@ main(int argc, char *argv[])
 
     TEST_ASSERT(run_list_limits_tests() == TEST_PASS);
 
+    TEST_ASSERT(run_export_tests() == TEST_PASS);
+    TEST_ASSERT(run_parse_tests() == TEST_PASS);
+    TEST_ASSERT(run_stats_tests() == TEST_PASS);
+    TEST_ASSERT(run_trace_tests() == TEST_PASS);
+    TEST_ASSERT(run_random_tests() == TEST_PASS);
+    TEST_ASSERT(run_capture_tests() == TEST_PASS);
+    TEST_ASSERT(run_template_tests() == TEST_PASS);
+    TEST_ASSERT(run_preallocated_tests() == TEST_PASS);
+    TEST_ASSERT(run_peek_tests() == TEST_PASS);
+    TEST_ASSERT(run_packet_tests() == TEST_PASS);
+    TEST_ASSERT(run_classifier_tests() == TEST_PASS);
+    TEST_ASSERT(run_program_tests() == TEST_PASS);
+    TEST_ASSERT(run_hash_tests() == TEST_PASS);
+    TEST_ASSERT(run_gentable_tests() == TEST_PASS);
+    TEST_ASSERT(run_gentable_resync_tests() == TEST_PASS);
+    TEST_ASSERT(run_flow_checksum_tests() == TEST_PASS);
+    TEST_ASSERT(run_bsn_tlv_tests() == TEST_PASS);
+    TEST_ASSERT(run_debug_counter_tests() == TEST_PASS);
+    TEST_ASSERT(run_columns_tests() == TEST_PASS);
+    TEST_ASSERT(run_sdwn_client_tests() == TEST_PASS);
+    TEST_ASSERT(run_sdwn_mgmt_tests() == TEST_PASS);
+    TEST_ASSERT(run_pdu_sched_tests() == TEST_PASS);
+
     RUN_TEST(ext_objs);
 
     TEST_ASSERT(test_datafiles() == TEST_PASS);
@@ -0,0 +1,256 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the BSN TLV list index
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_bsn_tlv.h>
+
+#define VERSION OF_VERSION_1_3
+
+/* Append a TLV of class cls with its value set by setter */
+#define TLV_APPEND(list, cls, version, setter) do {                     \
+        of_object_t *_tlv = cls##_new(version);                         \
+        TEST_ASSERT(_tlv != NULL);                                      \
+        setter;                                                         \
+        TEST_OK(of_list_append(list, _tlv));                            \
+        of_object_delete(_tlv);                                         \
+    } while (0)
+
+static of_mac_addr_t mac = { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } };
+static of_ipv6_t ipv6 = { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+                            0, 0, 0, 0, 0, 0, 0, 1 } };
+
+/*
+ * port 7, vlan_vid 10, mac, name "eth1", port 8, rx_packets, ipv6,
+ * ip_proto 6
+ */
+static of_list_bsn_tlv_t *
+list_make(of_version_t version)
+{
+    of_list_bsn_tlv_t *list;
+    of_octets_t name = { (uint8_t *)"eth1", 4 };
+
+    if ((list = of_list_bsn_tlv_new(version)) == NULL) {
+        return NULL;
+    }
+    TLV_APPEND(list, of_bsn_tlv_port, version,
+               of_bsn_tlv_port_value_set(_tlv, 7));
+    TLV_APPEND(list, of_bsn_tlv_vlan_vid, version,
+               of_bsn_tlv_vlan_vid_value_set(_tlv, 10));
+    TLV_APPEND(list, of_bsn_tlv_mac, version,
+               of_bsn_tlv_mac_value_set(_tlv, mac));
+    TLV_APPEND(list, of_bsn_tlv_name, version,
+               TEST_OK(of_bsn_tlv_name_value_set(_tlv, &name)));
+    TLV_APPEND(list, of_bsn_tlv_port, version,
+               of_bsn_tlv_port_value_set(_tlv, 8));
+    TLV_APPEND(list, of_bsn_tlv_rx_packets, version,
+               of_bsn_tlv_rx_packets_value_set(_tlv, 0x123456789aULL));
+    TLV_APPEND(list, of_bsn_tlv_ipv6, version,
+               of_bsn_tlv_ipv6_value_set(_tlv, ipv6));
+    TLV_APPEND(list, of_bsn_tlv_ip_proto, version,
+               of_bsn_tlv_ip_proto_value_set(_tlv, 6));
+
+    return list;
+}
+
+static int
+test_bsn_tlv_index(void)
+{
+    loci_bsn_tlv_index_t idx;
+    of_list_bsn_tlv_t *list;
+    of_mac_addr_t mac_get;
+    of_ipv6_t ipv6_get;
+    const uint8_t *data;
+    uint64_t u64;
+    uint32_t u32;
+    uint16_t u16;
+    uint8_t u8;
+    int pos, len, version;
+
+    for (version = OF_VERSION_1_3; version <= OF_VERSION_1_4; version++) {
+        list = list_make(version);
+        TEST_ASSERT(list != NULL);
+        TEST_OK(loci_bsn_tlv_index_list(&idx, list));
+        TEST_ASSERT(loci_bsn_tlv_count(&idx) == 8);
+
+        /* The two ports are chained */
+        pos = loci_bsn_tlv_find(&idx, OF_BSN_TLV_PORT);
+        TEST_ASSERT(pos == 0);
+        pos = loci_bsn_tlv_find_next(&idx, pos);
+        TEST_ASSERT(pos == 4);
+        TEST_ASSERT(loci_bsn_tlv_id(&idx, pos) == OF_BSN_TLV_PORT);
+        TEST_ASSERT(loci_bsn_tlv_find_next(&idx, pos) == -1);
+        TEST_ASSERT(loci_bsn_tlv_find(&idx, OF_BSN_TLV_IP_PROTO) == 7);
+        TEST_ASSERT(loci_bsn_tlv_find(&idx, OF_BSN_TLV_UDP_SRC) == -1);
+        TEST_ASSERT(loci_bsn_tlv_find(&idx, OF_BSN_TLV) == -1);
+        TEST_ASSERT(loci_bsn_tlv_find(&idx, OF_FLOW_ADD) == -1);
+
+        TEST_OK(loci_bsn_tlv_u32_get(&idx, OF_BSN_TLV_PORT, &u32));
+        TEST_ASSERT(u32 == 7);
+        TEST_OK(loci_bsn_tlv_u16_get(&idx, OF_BSN_TLV_VLAN_VID, &u16));
+        TEST_ASSERT(u16 == 10);
+        TEST_OK(loci_bsn_tlv_u8_get(&idx, OF_BSN_TLV_IP_PROTO, &u8));
+        TEST_ASSERT(u8 == 6);
+        TEST_OK(loci_bsn_tlv_u64_get(&idx, OF_BSN_TLV_RX_PACKETS, &u64));
+        TEST_ASSERT(u64 == 0x123456789aULL);
+        TEST_OK(loci_bsn_tlv_mac_get(&idx, OF_BSN_TLV_MAC, &mac_get));
+        TEST_ASSERT(MEMCMP(&mac_get, &mac, sizeof(mac)) == 0);
+        TEST_OK(loci_bsn_tlv_ipv6_get(&idx, OF_BSN_TLV_IPV6, &ipv6_get));
+        TEST_ASSERT(MEMCMP(&ipv6_get, &ipv6, sizeof(ipv6)) == 0);
+        TEST_OK(loci_bsn_tlv_data_get(&idx, OF_BSN_TLV_NAME, &data, &len));
+        TEST_ASSERT(len == 4);
+        TEST_ASSERT(MEMCMP(data, "eth1", 4) == 0);
+
+        TEST_ASSERT(loci_bsn_tlv_u16_get(&idx, OF_BSN_TLV_UDP_SRC, &u16) ==
+                    OF_ERROR_RANGE);
+        TEST_ASSERT(loci_bsn_tlv_data_get(&idx, OF_BSN_TLV_DATA, &data,
+                                          &len) == OF_ERROR_RANGE);
+        /* A u64 from a u16 TLV is too long */
+        TEST_ASSERT(loci_bsn_tlv_u64_get(&idx, OF_BSN_TLV_VLAN_VID, &u64) ==
+                    OF_ERROR_PARSE);
+
+        of_object_delete(list);
+    }
+
+    return TEST_PASS;
+}
+
+static int
+test_bsn_tlv_malformed(void)
+{
+    loci_bsn_tlv_index_t idx;
+    of_list_bsn_tlv_t *list;
+    uint8_t buf[(LOCI_BSN_TLV_INDEX_MAX + 1) * LOCI_BSN_TLV_HEADER_BYTES];
+    uint8_t *wire;
+    uint16_t u16;
+    int i, len;
+
+    list = list_make(VERSION);
+    TEST_ASSERT(list != NULL);
+    wire = OF_OBJECT_BUFFER_INDEX(list, 0);
+    len = list->length;
+
+    TEST_ASSERT(loci_bsn_tlv_index(&idx, OF_VERSION_1_0, wire, len) ==
+                OF_ERROR_VERSION);
+    TEST_ASSERT(loci_bsn_tlv_index(&idx, VERSION, wire, len - 1) ==
+                OF_ERROR_PARSE);
+    TEST_ASSERT(loci_bsn_tlv_index(&idx, VERSION, wire, 2) ==
+                OF_ERROR_PARSE);
+    TEST_OK(loci_bsn_tlv_index(&idx, VERSION, wire, 0));
+    TEST_ASSERT(loci_bsn_tlv_count(&idx) == 0);
+    TEST_ASSERT(loci_bsn_tlv_find(&idx, OF_BSN_TLV_PORT) == -1);
+    of_object_delete(list);
+
+    /* Lengths short of the header, and types of no class */
+    MEMSET(buf, 0, sizeof(buf));
+    buf[3] = 2;
+    TEST_ASSERT(loci_bsn_tlv_index(&idx, VERSION, buf, 8) == OF_ERROR_PARSE);
+    for (i = 0; i < LOCI_BSN_TLV_INDEX_MAX + 1; i++) {
+        buf[i * 4] = 0x12;
+        buf[i * 4 + 1] = i;
+        buf[i * 4 + 3] = LOCI_BSN_TLV_HEADER_BYTES;
+    }
+    TEST_OK(loci_bsn_tlv_index(&idx, VERSION, buf, 8));
+    TEST_ASSERT(loci_bsn_tlv_count(&idx) == 2);
+    TEST_ASSERT(loci_bsn_tlv_find(&idx, OF_BSN_TLV) == 0);
+    TEST_ASSERT(loci_bsn_tlv_find_next(&idx, 0) == 1);
+    TEST_ASSERT(loci_bsn_tlv_index(&idx, VERSION, buf, sizeof(buf)) ==
+                OF_ERROR_RESOURCE);
+
+    /* A vlan_vid with a 1 byte value */
+    buf[0] = 0;
+    buf[1] = 6;
+    buf[3] = LOCI_BSN_TLV_HEADER_BYTES + 1;
+    TEST_OK(loci_bsn_tlv_index(&idx, VERSION, buf, 5));
+    TEST_ASSERT(loci_bsn_tlv_find(&idx, OF_BSN_TLV_VLAN_VID) == 0);
+    TEST_ASSERT(loci_bsn_tlv_u16_get(&idx, OF_BSN_TLV_VLAN_VID,
+                                     &u16) == OF_ERROR_PARSE);
+
+    return TEST_PASS;
+}
+
+static int
+test_bsn_tlv_equal(void)
+{
+    loci_bsn_tlv_index_t a, b;
+    of_list_bsn_tlv_t *la, *lb;
+
+    /* The same TLVs in another order */
+    la = of_list_bsn_tlv_new(VERSION);
+    lb = of_list_bsn_tlv_new(VERSION);
+    TEST_ASSERT(la != NULL && lb != NULL);
+    TLV_APPEND(la, of_bsn_tlv_port, VERSION,
+               of_bsn_tlv_port_value_set(_tlv, 7));
+    TLV_APPEND(la, of_bsn_tlv_vlan_vid, VERSION,
+               of_bsn_tlv_vlan_vid_value_set(_tlv, 10));
+    TLV_APPEND(la, of_bsn_tlv_mac, VERSION,
+               of_bsn_tlv_mac_value_set(_tlv, mac));
+    TLV_APPEND(lb, of_bsn_tlv_mac, VERSION,
+               of_bsn_tlv_mac_value_set(_tlv, mac));
+    TLV_APPEND(lb, of_bsn_tlv_port, VERSION,
+               of_bsn_tlv_port_value_set(_tlv, 7));
+    TLV_APPEND(lb, of_bsn_tlv_vlan_vid, VERSION,
+               of_bsn_tlv_vlan_vid_value_set(_tlv, 10));
+    TEST_OK(loci_bsn_tlv_index_list(&a, la));
+    TEST_OK(loci_bsn_tlv_index_list(&b, lb));
+    TEST_ASSERT(loci_bsn_tlv_equal(&a, &b));
+    TEST_ASSERT(loci_bsn_tlv_equal(&b, &a));
+    TEST_ASSERT(loci_bsn_tlv_hash(&a, 0) == loci_bsn_tlv_hash(&b, 0));
+    TEST_ASSERT(loci_bsn_tlv_hash(&a, 1) == loci_bsn_tlv_hash(&b, 1));
+    TEST_ASSERT(loci_bsn_tlv_hash(&a, 0) != loci_bsn_tlv_hash(&a, 1));
+
+    /* Another port */
+    TLV_APPEND(la, of_bsn_tlv_port, VERSION,
+               of_bsn_tlv_port_value_set(_tlv, 8));
+    TLV_APPEND(lb, of_bsn_tlv_vlan_vid, VERSION,
+               of_bsn_tlv_vlan_vid_value_set(_tlv, 8));
+    TEST_OK(loci_bsn_tlv_index_list(&a, la));
+    TEST_OK(loci_bsn_tlv_index_list(&b, lb));
+    TEST_ASSERT(!loci_bsn_tlv_equal(&a, &b));
+    TEST_ASSERT(!loci_bsn_tlv_equal(&b, &a));
+    TEST_ASSERT(loci_bsn_tlv_hash(&a, 0) != loci_bsn_tlv_hash(&b, 0));
+    of_object_delete(lb);
+
+    /* The ports of a in the other order */
+    lb = of_list_bsn_tlv_new(VERSION);
+    TEST_ASSERT(lb != NULL);
+    TLV_APPEND(lb, of_bsn_tlv_port, VERSION,
+               of_bsn_tlv_port_value_set(_tlv, 8));
+    TLV_APPEND(lb, of_bsn_tlv_mac, VERSION,
+               of_bsn_tlv_mac_value_set(_tlv, mac));
+    TLV_APPEND(lb, of_bsn_tlv_vlan_vid, VERSION,
+               of_bsn_tlv_vlan_vid_value_set(_tlv, 10));
+    TLV_APPEND(lb, of_bsn_tlv_port, VERSION,
+               of_bsn_tlv_port_value_set(_tlv, 7));
+    TEST_OK(loci_bsn_tlv_index_list(&b, lb));
+    TEST_ASSERT(!loci_bsn_tlv_equal(&a, &b));
+
+    /* A list and a prefix of it */
+    TEST_OK(loci_bsn_tlv_index(&b, VERSION, OF_OBJECT_BUFFER_INDEX(la, 0),
+                               la->length - 8));
+    TEST_ASSERT(!loci_bsn_tlv_equal(&a, &b));
+    TEST_ASSERT(!loci_bsn_tlv_equal(&b, &a));
+    TEST_OK(loci_bsn_tlv_index(&b, VERSION, OF_OBJECT_BUFFER_INDEX(la, 0),
+                               la->length));
+    TEST_ASSERT(loci_bsn_tlv_equal(&a, &b));
+
+    of_object_delete(la);
+    of_object_delete(lb);
+
+    return TEST_PASS;
+}
+
+int
+run_bsn_tlv_tests(void)
+{
+    RUN_TEST(bsn_tlv_index);
+    RUN_TEST(bsn_tlv_malformed);
+    RUN_TEST(bsn_tlv_equal);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,225 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test capture files
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_capture.h>
+#include <loci/loci_random.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define MESSAGES 500
+
+static char path[64];
+static char idx_path[68];
+
+static struct {
+    uint8_t *msg;
+    int len;
+    uint32_t conn_id;
+    of_object_id_t object_id;
+} written[MESSAGES + 1];
+
+/*
+ * Write random messages on three connections, every tenth an
+ * echo_request with xid 7, with timestamps going back once, and a
+ * final record that is not an OpenFlow message.
+ */
+static int
+capture_write(void)
+{
+    loci_capture_writer_t w;
+    loci_random_t r;
+    loci_random_config_t config;
+    of_object_t *obj;
+    uint64_t ts;
+    int i;
+
+    snprintf(path, sizeof(path), "/tmp/locitest-capture-%d", (int)getpid());
+    snprintf(idx_path, sizeof(idx_path), "%s.idx", path);
+
+    loci_random_config_init(&config);
+    config.seed = 1;
+    loci_random_init(&r, &config);
+    /* A small buffer makes the writer flush often */
+    TEST_OK(loci_capture_writer_open(&w, path, 4096));
+    for (i = 0; i < MESSAGES; i++) {
+        if (i % 10 == 0) {
+            obj = of_echo_request_new(OF_VERSION_1_0 + i % 4);
+            of_echo_request_xid_set(obj, 7);
+        } else {
+            obj = loci_random_message_new(&r, OF_VERSION_1_0 + i % 4);
+        }
+        TEST_ASSERT(obj != NULL);
+        written[i].len = obj->length;
+        written[i].msg = MALLOC(obj->length);
+        written[i].conn_id = i % 3;
+        written[i].object_id = obj->object_id;
+        MEMCPY(written[i].msg, OF_OBJECT_TO_MESSAGE(obj), obj->length);
+
+        ts = i < MESSAGES / 2 ? 1000 + i : i;
+        TEST_OK(loci_capture_write_object(&w, ts, written[i].conn_id, obj));
+        of_object_delete(obj);
+    }
+    written[i].len = 5;
+    written[i].conn_id = 0;
+    written[i].msg = MALLOC(5);
+    written[i].object_id = OF_OBJECT_INVALID;
+    MEMCPY(written[i].msg, "\x01\x00\x00\x05\x00", 5);
+    TEST_OK(loci_capture_write(&w, 0, 0, written[i].msg, 5));
+    TEST_OK(loci_capture_writer_close(&w));
+    loci_random_cleanup(&r);
+
+    return TEST_PASS;
+}
+
+static void
+capture_cleanup(void)
+{
+    int i;
+
+    for (i = 0; i <= MESSAGES; i++) {
+        FREE(written[i].msg);
+        written[i].msg = NULL;
+    }
+    unlink(path);
+    unlink(idx_path);
+}
+
+/* Check every record and query against what was written */
+static int
+capture_check(loci_capture_t *cap)
+{
+    const loci_capture_entry_t *e;
+    loci_capture_range_t range;
+    of_object_storage_t storage;
+    of_object_t *obj;
+    uint64_t last;
+    int i, echoes = 0;
+
+    TEST_ASSERT(loci_capture_count(cap) == MESSAGES + 1);
+    for (i = 0; i <= MESSAGES; i++) {
+        e = loci_capture_entry(cap, i);
+        TEST_ASSERT(e->length == written[i].len);
+        TEST_ASSERT(e->conn_id == written[i].conn_id);
+        TEST_ASSERT(e->object_id == written[i].object_id);
+        TEST_ASSERT(memcmp(loci_capture_message(cap, i), written[i].msg,
+                           written[i].len) == 0);
+        obj = loci_capture_object(cap, i, &storage);
+        if (written[i].object_id == OF_OBJECT_INVALID) {
+            TEST_ASSERT(obj == NULL);
+            continue;
+        }
+        TEST_ASSERT(obj != NULL);
+        TEST_ASSERT(obj->object_id == written[i].object_id);
+        /* The object refers to the mapped message */
+        TEST_ASSERT(OF_OBJECT_TO_MESSAGE(obj) == loci_capture_message(cap, i));
+    }
+
+    range = loci_capture_by_type(cap, OF_ECHO_REQUEST);
+    TEST_ASSERT(range.count >= MESSAGES / 10);
+    for (i = 0; i < range.count; i++) {
+        TEST_ASSERT(written[range.rec[i]].object_id == OF_ECHO_REQUEST);
+        TEST_ASSERT(i == 0 || range.rec[i] > range.rec[i - 1]);
+    }
+
+    range = loci_capture_by_xid(cap, 7);
+    for (i = 0; i < range.count; i++) {
+        TEST_ASSERT(loci_capture_entry(cap, range.rec[i])->xid == 7);
+        if (written[range.rec[i]].object_id == OF_ECHO_REQUEST) {
+            echoes++;
+        }
+    }
+    TEST_ASSERT(echoes == MESSAGES / 10);
+
+    range = loci_capture_by_type(cap, OF_OBJECT_INVALID);
+    TEST_ASSERT(range.count == 1 && range.rec[0] == MESSAGES);
+
+    /* The second half was written before the first */
+    range = loci_capture_by_time(cap, MESSAGES / 2, 1000);
+    TEST_ASSERT(range.count == MESSAGES / 2);
+    last = 0;
+    for (i = 0; i < range.count; i++) {
+        e = loci_capture_entry(cap, range.rec[i]);
+        TEST_ASSERT(range.rec[i] >= MESSAGES / 2);
+        TEST_ASSERT(e->timestamp >= last);
+        last = e->timestamp;
+    }
+    range = loci_capture_by_time(cap, 0, 1);
+    TEST_ASSERT(range.count == 1 && range.rec[0] == MESSAGES);
+    range = loci_capture_by_time(cap, 2000, 1000);
+    TEST_ASSERT(range.count == 0);
+
+    return TEST_PASS;
+}
+
+static int
+test_capture_index(void)
+{
+    loci_capture_t cap;
+
+    TEST_ASSERT(capture_write() == TEST_PASS);
+    TEST_OK(loci_capture_open(&cap, path));
+    TEST_ASSERT(cap.index_mapped);
+    TEST_ASSERT(capture_check(&cap) == TEST_PASS);
+    loci_capture_close(&cap);
+    capture_cleanup();
+
+    return TEST_PASS;
+}
+
+/*
+ * A partial record at the end of the log is ignored, and a log
+ * without an index is indexed when opened and by loci_capture_reindex.
+ */
+static int
+test_capture_recover(void)
+{
+    loci_capture_t cap;
+    uint8_t partial[20];
+    int fd;
+
+    TEST_ASSERT(capture_write() == TEST_PASS);
+
+    MEMSET(partial, 0, sizeof(partial));
+    partial[12] = 64;
+    TEST_ASSERT((fd = open(path, O_WRONLY | O_APPEND)) >= 0);
+    TEST_ASSERT(write(fd, partial, sizeof(partial)) == sizeof(partial));
+    close(fd);
+
+    TEST_OK(loci_capture_open(&cap, path));
+    TEST_ASSERT(cap.index_mapped);
+    TEST_ASSERT(capture_check(&cap) == TEST_PASS);
+    loci_capture_close(&cap);
+
+    unlink(idx_path);
+    TEST_OK(loci_capture_open(&cap, path));
+    TEST_ASSERT(!cap.index_mapped);
+    TEST_ASSERT(capture_check(&cap) == TEST_PASS);
+    loci_capture_close(&cap);
+
+    TEST_OK(loci_capture_reindex(path));
+    TEST_OK(loci_capture_open(&cap, path));
+    TEST_ASSERT(cap.index_mapped);
+    TEST_ASSERT(capture_check(&cap) == TEST_PASS);
+    loci_capture_close(&cap);
+
+    capture_cleanup();
+    TEST_ASSERT(loci_capture_open(&cap, path) < 0);
+
+    return TEST_PASS;
+}
+
+int
+run_capture_tests(void)
+{
+    RUN_TEST(capture_index);
+    RUN_TEST(capture_recover);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,239 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the classifier
+ *
+ * Lookups must find the highest priority flow whose match covers the
+ * packet, as of_match_more_specific says, with or without the cache
+ * and across adds and removes.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_classifier.h>
+
+static void
+match_init(of_match_t *match)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = OF_VERSION_1_3;
+}
+
+static void
+match_ipv4_dst(of_match_t *match, uint32_t dst, int prefix_len)
+{
+    match_init(match);
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->masks.ipv4_dst = prefix_len ? ~0U << (32 - prefix_len) : 0;
+    match->fields.ipv4_dst = dst & match->masks.ipv4_dst;
+}
+
+static int
+test_classifier_priority(void)
+{
+    loci_classifier_t cls;
+    of_match_t match, pkt;
+    int any, net, host;
+
+    TEST_OK(loci_classifier_init(&cls, LOCI_CLASSIFIER_CACHE_SLOTS));
+
+    match_init(&match);
+    TEST_OK(loci_classifier_add(&cls, 0, &match, 0, &any));
+    match_ipv4_dst(&match, 0x0a000000, 8);
+    TEST_OK(loci_classifier_add(&cls, 0, &match, 8, &net));
+    match_ipv4_dst(&match, 0x0a000001, 32);
+    TEST_OK(loci_classifier_add(&cls, 0, &match, 32, &host));
+    TEST_ASSERT(loci_classifier_count(&cls) == 3);
+
+    match_init(&pkt);
+    pkt.fields.eth_type = 0x0800;
+    pkt.fields.ipv4_dst = 0x0a000001;
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &host);
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &host);
+    TEST_ASSERT(cls.cache_hits == 1);
+    pkt.fields.ipv4_dst = 0x0a000002;
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &net);
+    pkt.fields.ipv4_dst = 0x0b000001;
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &any);
+    pkt.fields.eth_type = 0x86dd;
+    pkt.fields.ipv4_dst = 0x0a000001;
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &any);
+
+    /* Other tables are separate */
+    TEST_ASSERT(loci_classifier_lookup(&cls, 1, &pkt.fields) == NULL);
+    match_init(&match);
+    TEST_OK(loci_classifier_add(&cls, 1, &match, 0, &host));
+    TEST_ASSERT(loci_classifier_lookup(&cls, 1, &pkt.fields) == &host);
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &any);
+
+    /* A lower priority flow with a more specific match loses */
+    match_ipv4_dst(&match, 0x0a000002, 32);
+    TEST_OK(loci_classifier_add(&cls, 0, &match, 4, &host));
+    pkt.fields.eth_type = 0x0800;
+    pkt.fields.ipv4_dst = 0x0a000002;
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &net);
+
+    loci_classifier_cleanup(&cls);
+
+    return TEST_PASS;
+}
+
+static int
+test_classifier_remove(void)
+{
+    loci_classifier_t cls;
+    of_match_t match, pkt;
+    void *data;
+    int net, host;
+
+    TEST_OK(loci_classifier_init(&cls, 16));
+
+    match_ipv4_dst(&match, 0x0a000000, 8);
+    TEST_OK(loci_classifier_add(&cls, 0, &match, 8, &net));
+    TEST_ASSERT(loci_classifier_add(&cls, 0, &match, 8, &host) ==
+                OF_ERROR_PARAM);
+    TEST_ASSERT(loci_classifier_add(&cls, 0, &match, 9, NULL) ==
+                OF_ERROR_PARAM);
+    match_ipv4_dst(&match, 0x0a000001, 32);
+    TEST_OK(loci_classifier_add(&cls, 0, &match, 32, &host));
+
+    match_init(&pkt);
+    pkt.fields.eth_type = 0x0800;
+    pkt.fields.ipv4_dst = 0x0a000001;
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &host);
+
+    /* The cached result goes with the flow */
+    TEST_ASSERT(loci_classifier_remove(&cls, 0, &match, 31, &data) ==
+                OF_ERROR_RANGE);
+    TEST_OK(loci_classifier_remove(&cls, 0, &match, 32, &data));
+    TEST_ASSERT(data == &host);
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &net);
+    TEST_ASSERT(loci_classifier_remove(&cls, 0, &match, 32, NULL) ==
+                OF_ERROR_RANGE);
+
+    match_ipv4_dst(&match, 0x0a000000, 8);
+    TEST_OK(loci_classifier_remove(&cls, 0, &match, 8, NULL));
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == NULL);
+    TEST_ASSERT(loci_classifier_count(&cls) == 0);
+    TEST_ASSERT(loci_classifier_remove(&cls, 2, &match, 8, NULL) ==
+                OF_ERROR_RANGE);
+
+    /* Field bits outside the mask don't matter */
+    match.fields.ipv4_dst = 0x0a0b0c0d;
+    TEST_OK(loci_classifier_add(&cls, 0, &match, 8, &net));
+    TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == &net);
+    match.fields.ipv4_dst = 0x0a000000;
+    TEST_OK(loci_classifier_remove(&cls, 0, &match, 8, NULL));
+
+    loci_classifier_cleanup(&cls);
+
+    return TEST_PASS;
+}
+
+#define RANDOM_FLOWS 400
+#define RANDOM_PACKETS 2000
+
+/* Masks the random flows pick from, over a few fields */
+static void
+random_match(of_match_t *match, unsigned *seed)
+{
+    int kind = rand_r(seed) % 6;
+
+    match_init(match);
+    if (kind != 0) {
+        match->fields.eth_type = rand_r(seed) % 2 ? 0x0800 : 0x86dd;
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    }
+    if (kind == 2 || kind == 3 || kind == 5) {
+        match->masks.ipv4_dst = ~0U << (rand_r(seed) % 3 * 8);
+        match->fields.ipv4_dst = (rand_r(seed) % 4 * 0x01010101) &
+            match->masks.ipv4_dst;
+    }
+    if (kind == 3 || kind == 4) {
+        match->fields.tcp_dst = rand_r(seed) % 4;
+        OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+    }
+    if (kind == 5) {
+        match->fields.vlan_vid = 0x1000 | rand_r(seed) % 4;
+        match->masks.vlan_vid = 0x1fff;
+    }
+}
+
+/* The lookups agree with a linear search of the flows */
+static int
+test_classifier_random(void)
+{
+    static of_match_t flows[RANDOM_FLOWS];
+    static int present[RANDOM_FLOWS];
+    loci_classifier_t cls, uncached;
+    of_match_t pkt;
+    unsigned seed = 1;
+    void *data, *expect;
+    int i, j, best;
+
+    TEST_OK(loci_classifier_init(&cls, 64));
+    TEST_OK(loci_classifier_init(&uncached, 0));
+
+    /* Priority i, so the best flow is the one of highest index */
+    for (i = 0; i < RANDOM_FLOWS; i++) {
+        random_match(&flows[i], &seed);
+        TEST_OK(loci_classifier_add(&cls, 0, &flows[i], i, &flows[i]));
+        TEST_OK(loci_classifier_add(&uncached, 0, &flows[i], i, &flows[i]));
+        present[i] = 1;
+    }
+
+    for (i = 0; i < RANDOM_PACKETS; i++) {
+        /* Remove or put back a flow now and then */
+        if (i % 10 == 0) {
+            j = rand_r(&seed) % RANDOM_FLOWS;
+            if (present[j]) {
+                TEST_OK(loci_classifier_remove(&cls, 0, &flows[j], j, &data));
+                TEST_ASSERT(data == &flows[j]);
+                TEST_OK(loci_classifier_remove(&uncached, 0, &flows[j], j,
+                                               NULL));
+            } else {
+                TEST_OK(loci_classifier_add(&cls, 0, &flows[j], j,
+                                            &flows[j]));
+                TEST_OK(loci_classifier_add(&uncached, 0, &flows[j], j,
+                                            &flows[j]));
+            }
+            present[j] = !present[j];
+        }
+
+        MEMSET(&pkt, 0xff, sizeof(pkt));
+        pkt.fields.eth_type = rand_r(&seed) % 2 ? 0x0800 : 0x86dd;
+        pkt.fields.ipv4_dst = rand_r(&seed) % 4 * 0x01010101;
+        pkt.fields.tcp_dst = rand_r(&seed) % 5;
+        pkt.fields.vlan_vid = 0x1000 | rand_r(&seed) % 5;
+
+        best = -1;
+        for (j = 0; j < RANDOM_FLOWS; j++) {
+            if (present[j] && of_match_more_specific(&pkt, &flows[j])) {
+                best = j;
+            }
+        }
+        expect = best < 0 ? NULL : &flows[best];
+        TEST_ASSERT(loci_classifier_lookup(&cls, 0, &pkt.fields) == expect);
+        TEST_ASSERT(loci_classifier_lookup(&uncached, 0, &pkt.fields) ==
+                    expect);
+    }
+    TEST_ASSERT(cls.cache_hits > 0);
+
+    loci_classifier_cleanup(&cls);
+    loci_classifier_cleanup(&uncached);
+
+    return TEST_PASS;
+}
+
+int
+run_classifier_tests(void)
+{
+    RUN_TEST(classifier_priority);
+    RUN_TEST(classifier_remove);
+    RUN_TEST(classifier_random);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,736 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test stats lists read into columns
+ *
+ * The columns must hold what the generated getters read, in every
+ * version, and deltas must follow rows between polls whatever their
+ * order.  Replies filled from columns must parse and read back the
+ * same.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_columns.h>
+#include <loci/loci_hash.h>
+
+#define N_ENTRIES 40
+
+/* A value for field k of entry i */
+static uint64_t
+val(int i, int k)
+{
+    return ((uint64_t)(i + 1) << 40) | ((uint64_t)k << 20) | (i * 7 + k);
+}
+
+/* The column named name, which must exist */
+static uint64_t *
+column(loci_columns_t *cols, const char *name)
+{
+    int i = loci_columns_index(cols, name);
+
+    TEST_ASSERT(i >= 0);
+
+    return cols->columns[i];
+}
+
+static of_port_no_t
+port_no(int i)
+{
+    /* The last is a reserved port, widened in 1.0 */
+    return i == N_ENTRIES - 1 ? OF_PORT_DEST_LOCAL : (of_port_no_t)(i + 1);
+}
+
+static int
+port_stats_fill(of_object_t *reply, int first)
+{
+    of_list_port_stats_entry_t list;
+    of_port_stats_entry_t *entry;
+    of_list_port_stats_prop_t *props;
+    of_object_t *prop;
+    of_version_t version = reply->version;
+    int i;
+
+    of_port_stats_reply_entries_bind(reply, &list);
+    for (i = first; i < first + N_ENTRIES; i++) {
+        entry = of_port_stats_entry_new(version);
+        TEST_ASSERT(entry != NULL);
+        of_port_stats_entry_port_no_set(entry, port_no(i - first));
+        of_port_stats_entry_rx_packets_set(entry, val(i, 1));
+        of_port_stats_entry_tx_packets_set(entry, val(i, 2));
+        of_port_stats_entry_rx_bytes_set(entry, val(i, 3));
+        of_port_stats_entry_tx_bytes_set(entry, val(i, 4));
+        of_port_stats_entry_rx_dropped_set(entry, val(i, 5));
+        of_port_stats_entry_tx_dropped_set(entry, val(i, 6));
+        of_port_stats_entry_rx_errors_set(entry, val(i, 7));
+        of_port_stats_entry_tx_errors_set(entry, val(i, 8));
+        if (version >= OF_VERSION_1_3) {
+            of_port_stats_entry_duration_sec_set(entry, val(i, 9));
+            of_port_stats_entry_duration_nsec_set(entry, val(i, 10));
+        }
+        if (version < OF_VERSION_1_4) {
+            of_port_stats_entry_rx_frame_err_set(entry, val(i, 11));
+            of_port_stats_entry_rx_over_err_set(entry, val(i, 12));
+            of_port_stats_entry_rx_crc_err_set(entry, val(i, 13));
+            of_port_stats_entry_collisions_set(entry, val(i, 14));
+        } else if (i % 3 != 0) {
+            /* Some with another property first, some with none */
+            props = of_list_port_stats_prop_new(version);
+            TEST_ASSERT(props != NULL);
+            if (i % 3 == 2) {
+                prop = of_port_stats_prop_optical_new(version);
+                TEST_ASSERT(prop != NULL);
+                TEST_OK(of_list_append(props, prop));
+                of_object_delete(prop);
+            }
+            prop = of_port_stats_prop_ethernet_new(version);
+            TEST_ASSERT(prop != NULL);
+            of_port_stats_prop_ethernet_rx_frame_err_set(prop, val(i, 11));
+            of_port_stats_prop_ethernet_rx_over_err_set(prop, val(i, 12));
+            of_port_stats_prop_ethernet_rx_crc_err_set(prop, val(i, 13));
+            of_port_stats_prop_ethernet_collisions_set(prop, val(i, 14));
+            TEST_OK(of_list_append(props, prop));
+            of_object_delete(prop);
+            TEST_OK(of_port_stats_entry_properties_set(entry, props));
+            of_object_delete(props);
+        }
+        TEST_OK(of_list_append(&list, entry));
+        of_object_delete(entry);
+    }
+
+    return TEST_PASS;
+}
+
+static int
+test_columns_port_stats(void)
+{
+    static const char *const errs[] = {
+        "rx_frame_err", "rx_over_err", "rx_crc_err", "collisions",
+    };
+    loci_columns_t cols;
+    of_object_t *reply;
+    of_list_port_stats_entry_t list;
+    of_port_stats_entry_t entry;
+    of_port_no_t port;
+    uint64_t v;
+    int version, i, k, rv, row, ethernet;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        /* Room for less than a reply, so the columns grow */
+        TEST_OK(loci_columns_init(&cols, OF_PORT_STATS_ENTRY, 8));
+        TEST_ASSERT(cols.n_columns == 15);
+
+        for (k = 0; k < 2; k++) {
+            reply = of_port_stats_reply_new(version);
+            TEST_ASSERT(reply != NULL);
+            TEST_ASSERT(port_stats_fill(reply, k * N_ENTRIES) == TEST_PASS);
+            of_port_stats_reply_entries_bind(reply, &list);
+            TEST_ASSERT(loci_columns_extract(&cols, &list) == N_ENTRIES);
+            TEST_ASSERT(cols.count == (k + 1) * N_ENTRIES);
+
+            /* As the getters read it */
+            row = k * N_ENTRIES;
+            OF_LIST_PORT_STATS_ENTRY_ITER(&list, &entry, rv) {
+                of_port_stats_entry_port_no_get(&entry, &port);
+                TEST_ASSERT(column(&cols, "port_no")[row] == port);
+                of_port_stats_entry_rx_packets_get(&entry, &v);
+                TEST_ASSERT(column(&cols, "rx_packets")[row] == v);
+                of_port_stats_entry_tx_bytes_get(&entry, &v);
+                TEST_ASSERT(column(&cols, "tx_bytes")[row] == v);
+                of_port_stats_entry_tx_errors_get(&entry, &v);
+                TEST_ASSERT(column(&cols, "tx_errors")[row] == v);
+                row++;
+            }
+            TEST_ASSERT(row == (k + 1) * N_ENTRIES);
+            of_object_delete(reply);
+        }
+
+        TEST_ASSERT(column(&cols, "port_no")[N_ENTRIES - 1] ==
+                    OF_PORT_DEST_LOCAL);
+        for (i = 0; i < cols.count; i++) {
+            ethernet = version < OF_VERSION_1_4 || i % 3 != 0;
+            TEST_ASSERT(column(&cols, "port_no")[i] ==
+                        port_no(i < N_ENTRIES ? i : i - N_ENTRIES));
+            TEST_ASSERT(column(&cols, "rx_packets")[i] == val(i, 1));
+            TEST_ASSERT(column(&cols, "tx_dropped")[i] == val(i, 6));
+            TEST_ASSERT(column(&cols, "duration_sec")[i] ==
+                        (version >= OF_VERSION_1_3 ?
+                         (uint32_t)val(i, 9) : 0));
+            TEST_ASSERT(column(&cols, "duration_nsec")[i] ==
+                        (version >= OF_VERSION_1_3 ?
+                         (uint32_t)val(i, 10) : 0));
+            for (k = 0; k < 4; k++) {
+                TEST_ASSERT(column(&cols, errs[k])[i] ==
+                            (ethernet ? val(i, 11 + k) : 0));
+            }
+        }
+        loci_columns_cleanup(&cols);
+    }
+
+    return TEST_PASS;
+}
+
+static int
+test_columns_queue_table(void)
+{
+    loci_columns_t cols;
+    of_object_t *reply, *entry;
+    of_list_queue_stats_entry_t queues;
+    of_list_table_stats_entry_t tables;
+    uint64_t queue_id;
+    int version, i;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        reply = of_queue_stats_reply_new(version);
+        TEST_ASSERT(reply != NULL);
+        of_queue_stats_reply_entries_bind(reply, &queues);
+        for (i = 0; i < N_ENTRIES; i++) {
+            entry = of_queue_stats_entry_new(version);
+            TEST_ASSERT(entry != NULL);
+            of_queue_stats_entry_port_no_set(entry, i / 8 + 1);
+            of_queue_stats_entry_queue_id_set(entry, i % 8);
+            of_queue_stats_entry_tx_bytes_set(entry, val(i, 1));
+            of_queue_stats_entry_tx_packets_set(entry, val(i, 2));
+            of_queue_stats_entry_tx_errors_set(entry, val(i, 3));
+            if (version >= OF_VERSION_1_3) {
+                of_queue_stats_entry_duration_sec_set(entry, i);
+                of_queue_stats_entry_duration_nsec_set(entry, i * 1000);
+            }
+            TEST_OK(of_list_append(&queues, entry));
+            of_object_delete(entry);
+        }
+        TEST_OK(loci_columns_init(&cols, OF_QUEUE_STATS_ENTRY, N_ENTRIES));
+        TEST_ASSERT(loci_columns_extract(&cols, &queues) == N_ENTRIES);
+        for (i = 0; i < N_ENTRIES; i++) {
+            queue_id = i % 8;
+            TEST_ASSERT(column(&cols, "port_no")[i] == (uint64_t)(i / 8 + 1));
+            TEST_ASSERT(column(&cols, "queue_id")[i] == queue_id);
+            TEST_ASSERT(column(&cols, "tx_bytes")[i] == val(i, 1));
+            TEST_ASSERT(column(&cols, "tx_packets")[i] == val(i, 2));
+            TEST_ASSERT(column(&cols, "tx_errors")[i] == val(i, 3));
+            TEST_ASSERT(column(&cols, "duration_nsec")[i] ==
+                        (version >= OF_VERSION_1_3 ? (uint64_t)i * 1000 : 0));
+        }
+        /* The wrong class of list */
+        TEST_ASSERT(loci_columns_extract(&cols, reply) == OF_ERROR_PARAM);
+        loci_columns_cleanup(&cols);
+        of_object_delete(reply);
+
+        reply = of_table_stats_reply_new(version);
+        TEST_ASSERT(reply != NULL);
+        of_table_stats_reply_entries_bind(reply, &tables);
+        for (i = 0; i < 4; i++) {
+            entry = of_table_stats_entry_new(version);
+            TEST_ASSERT(entry != NULL);
+            of_table_stats_entry_table_id_set(entry, i * 60);
+            of_table_stats_entry_active_count_set(entry, val(i, 1));
+            of_table_stats_entry_lookup_count_set(entry, val(i, 2));
+            of_table_stats_entry_matched_count_set(entry, val(i, 3));
+            if (version < OF_VERSION_1_3) {
+                of_table_stats_entry_max_entries_set(entry, 1 << 16);
+            }
+            TEST_OK(of_list_append(&tables, entry));
+            of_object_delete(entry);
+        }
+        TEST_OK(loci_columns_init(&cols, OF_TABLE_STATS_ENTRY, 0));
+        TEST_ASSERT(loci_columns_extract(&cols, &tables) == 4);
+        for (i = 0; i < 4; i++) {
+            TEST_ASSERT(column(&cols, "table_id")[i] == (uint64_t)i * 60);
+            TEST_ASSERT(column(&cols, "active_count")[i] ==
+                        (uint32_t)val(i, 1));
+            TEST_ASSERT(column(&cols, "lookup_count")[i] == val(i, 2));
+            TEST_ASSERT(column(&cols, "matched_count")[i] == val(i, 3));
+            TEST_ASSERT(column(&cols, "max_entries")[i] ==
+                        (version < OF_VERSION_1_3 ? 1 << 16 : 0));
+        }
+
+        /* A partial entry; nothing is appended */
+        tables.length -= 1;
+        TEST_ASSERT(loci_columns_extract(&cols, &tables) == OF_ERROR_PARSE);
+        TEST_ASSERT(cols.count == 4);
+        loci_columns_cleanup(&cols);
+        of_object_delete(reply);
+    }
+
+    return TEST_PASS;
+}
+
+static int
+test_columns_flow_meter(void)
+{
+    loci_columns_t cols;
+    of_object_t *reply, *entry, *values, *value;
+    of_list_flow_stats_entry_t flows;
+    of_list_meter_stats_t meters;
+    of_list_bsn_vlan_counter_stats_entry_t vlans;
+    int versions[] = { OF_VERSION_1_0, OF_VERSION_1_3 };
+    uint64_t table_id;
+    int v, i, k;
+
+    for (v = 0; v < 2; v++) {
+        reply = of_flow_stats_reply_new(versions[v]);
+        TEST_ASSERT(reply != NULL);
+        of_flow_stats_reply_entries_bind(reply, &flows);
+        for (i = 0; i < N_ENTRIES; i++) {
+            entry = of_flow_stats_entry_new(versions[v]);
+            TEST_ASSERT(entry != NULL);
+            of_flow_stats_entry_table_id_set(entry, i % 4);
+            of_flow_stats_entry_priority_set(entry, 1000 + i);
+            of_flow_stats_entry_cookie_set(entry, val(i, 1));
+            of_flow_stats_entry_duration_sec_set(entry, i);
+            of_flow_stats_entry_idle_timeout_set(entry, 10 + i);
+            of_flow_stats_entry_hard_timeout_set(entry, 20 + i);
+            of_flow_stats_entry_packet_count_set(entry, val(i, 2));
+            of_flow_stats_entry_byte_count_set(entry, val(i, 3));
+            TEST_OK(of_list_append(&flows, entry));
+            of_object_delete(entry);
+        }
+        TEST_OK(loci_columns_init(&cols, OF_FLOW_STATS_ENTRY, 1));
+        TEST_ASSERT(loci_columns_extract(&cols, &flows) == N_ENTRIES);
+        for (i = 0; i < N_ENTRIES; i++) {
+            table_id = i % 4;
+            TEST_ASSERT(column(&cols, "table_id")[i] == table_id);
+            TEST_ASSERT(column(&cols, "priority")[i] == (uint64_t)(1000 + i));
+            TEST_ASSERT(column(&cols, "cookie")[i] == val(i, 1));
+            TEST_ASSERT(column(&cols, "duration_sec")[i] == (uint64_t)i);
+            TEST_ASSERT(column(&cols, "idle_timeout")[i] == (uint64_t)(10 + i));
+            TEST_ASSERT(column(&cols, "hard_timeout")[i] == (uint64_t)(20 + i));
+            TEST_ASSERT(column(&cols, "packet_count")[i] == val(i, 2));
+            TEST_ASSERT(column(&cols, "byte_count")[i] == val(i, 3));
+        }
+        loci_columns_cleanup(&cols);
+        of_object_delete(reply);
+    }
+
+    reply = of_meter_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    of_meter_stats_reply_entries_bind(reply, &meters);
+    for (i = 0; i < N_ENTRIES; i++) {
+        entry = of_meter_stats_new(OF_VERSION_1_3);
+        TEST_ASSERT(entry != NULL);
+        of_meter_stats_meter_id_set(entry, i + 1);
+        of_meter_stats_flow_count_set(entry, i * 2);
+        of_meter_stats_packet_in_count_set(entry, val(i, 1));
+        of_meter_stats_byte_in_count_set(entry, val(i, 2));
+        of_meter_stats_duration_sec_set(entry, i * 3);
+        TEST_OK(of_list_append(&meters, entry));
+        of_object_delete(entry);
+    }
+    TEST_OK(loci_columns_init(&cols, OF_METER_STATS, N_ENTRIES));
+    TEST_ASSERT(loci_columns_extract(&cols, &meters) == N_ENTRIES);
+    for (i = 0; i < N_ENTRIES; i++) {
+        TEST_ASSERT(column(&cols, "meter_id")[i] == (uint64_t)(i + 1));
+        TEST_ASSERT(column(&cols, "flow_count")[i] == (uint64_t)(i * 2));
+        TEST_ASSERT(column(&cols, "packet_in_count")[i] == val(i, 1));
+        TEST_ASSERT(column(&cols, "byte_in_count")[i] == val(i, 2));
+        TEST_ASSERT(column(&cols, "duration_sec")[i] == (uint64_t)(i * 3));
+    }
+    loci_columns_cleanup(&cols);
+    of_object_delete(reply);
+
+    /* Counter entries with up to 20 values, of which 16 are read */
+    reply = of_bsn_vlan_counter_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    of_bsn_vlan_counter_stats_reply_entries_bind(reply, &vlans);
+    for (i = 0; i < 21; i++) {
+        entry = of_bsn_vlan_counter_stats_entry_new(OF_VERSION_1_3);
+        values = of_list_uint64_new(OF_VERSION_1_3);
+        TEST_ASSERT(entry != NULL && values != NULL);
+        of_bsn_vlan_counter_stats_entry_vlan_vid_set(entry, 100 + i);
+        for (k = 0; k < i; k++) {
+            value = of_uint64_new(OF_VERSION_1_3);
+            TEST_ASSERT(value != NULL);
+            of_uint64_value_set(value, val(i, k));
+            TEST_OK(of_list_append(values, value));
+            of_object_delete(value);
+        }
+        TEST_OK(of_bsn_vlan_counter_stats_entry_values_set(entry, values));
+        TEST_OK(of_list_append(&vlans, entry));
+        of_object_delete(values);
+        of_object_delete(entry);
+    }
+    TEST_OK(loci_columns_init(&cols, OF_BSN_VLAN_COUNTER_STATS_ENTRY, 0));
+    TEST_ASSERT(cols.n_columns == 1 + LOCI_COLUMNS_VALUES_MAX);
+    TEST_ASSERT(loci_columns_index(&cols, "value16") < 0);
+    TEST_ASSERT(loci_columns_extract(&cols, &vlans) == 21);
+    for (i = 0; i < 21; i++) {
+        TEST_ASSERT(column(&cols, "vlan_vid")[i] == (uint64_t)(100 + i));
+        for (k = 0; k < LOCI_COLUMNS_VALUES_MAX; k++) {
+            TEST_ASSERT(cols.columns[1 + k][i] == (k < i ? val(i, k) : 0));
+        }
+    }
+    loci_columns_cleanup(&cols);
+    of_object_delete(reply);
+
+    TEST_ASSERT(loci_columns_init(&cols, OF_PORT_DESC_STATS_REPLY, 0) ==
+                OF_ERROR_PARAM);
+
+    return TEST_PASS;
+}
+
+/* Port stats of 1.3 with the given ports and rx_packets */
+static int
+delta_poll(loci_columns_t *cols, const of_port_no_t *ports,
+           const uint64_t *rx_packets, int n)
+{
+    of_object_t *reply, *entry;
+    of_list_port_stats_entry_t list;
+    int i;
+
+    reply = of_port_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    of_port_stats_reply_entries_bind(reply, &list);
+    for (i = 0; i < n; i++) {
+        entry = of_port_stats_entry_new(OF_VERSION_1_3);
+        TEST_ASSERT(entry != NULL);
+        of_port_stats_entry_port_no_set(entry, ports[i]);
+        of_port_stats_entry_rx_packets_set(entry, rx_packets[i]);
+        of_port_stats_entry_duration_sec_set(entry, 60);
+        TEST_OK(of_list_append(&list, entry));
+        of_object_delete(entry);
+    }
+    loci_columns_clear(cols);
+    TEST_ASSERT(loci_columns_extract(cols, &list) == n);
+    of_object_delete(reply);
+
+    return TEST_PASS;
+}
+
+/*
+ * Flow stats of 1.3, all with the same table, priority and cookie,
+ * matching in_ports and with packet_count
+ */
+static int
+flow_delta_poll(loci_columns_t *cols, const of_port_no_t *in_ports,
+                const uint64_t *packet_count, int n)
+{
+    of_object_t *reply, *entry;
+    of_list_flow_stats_entry_t list;
+    of_match_t match;
+    int i;
+
+    reply = of_flow_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    of_flow_stats_reply_entries_bind(reply, &list);
+    for (i = 0; i < n; i++) {
+        entry = of_flow_stats_entry_new(OF_VERSION_1_3);
+        TEST_ASSERT(entry != NULL);
+        MEMSET(&match, 0, sizeof(match));
+        match.version = OF_VERSION_1_3;
+        match.fields.in_port = in_ports[i];
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+        TEST_OK(of_flow_stats_entry_match_set(entry, &match));
+        of_flow_stats_entry_priority_set(entry, 100);
+        of_flow_stats_entry_cookie_set(entry, 7);
+        of_flow_stats_entry_packet_count_set(entry, packet_count[i]);
+        TEST_OK(of_list_append(&list, entry));
+        of_object_delete(entry);
+    }
+    loci_columns_clear(cols);
+    TEST_ASSERT(loci_columns_extract(cols, &list) == n);
+    for (i = 0; i < n; i++) {
+        MEMSET(&match, 0, sizeof(match));
+        match.version = OF_VERSION_1_3;
+        match.fields.in_port = in_ports[i];
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+        TEST_ASSERT(column(cols, "match_hash")[i] ==
+                    loci_match_hash(&match, 0));
+    }
+    of_object_delete(reply);
+
+    return TEST_PASS;
+}
+
+static int
+test_columns_delta(void)
+{
+    static const of_port_no_t ports1[] = { 1, 2, 3, 4 };
+    static const uint64_t rx1[] = { 100, 200, 300, 400 };
+    static const uint64_t rx2[] = { 150, 200, 310, 1000 };
+    /* Reordered, port 2 gone, port 5 new and port 3 reset */
+    static const of_port_no_t ports3[] = { 4, 5, 1, 3 };
+    static const uint64_t rx3[] = { 1100, 7, 150, 5 };
+    loci_columns_t prev, cur, delta, queues;
+    uint64_t *d, *dur;
+    int i;
+
+    TEST_OK(loci_columns_init(&prev, OF_PORT_STATS_ENTRY, 0));
+    TEST_OK(loci_columns_init(&cur, OF_PORT_STATS_ENTRY, 0));
+    TEST_OK(loci_columns_init(&delta, OF_PORT_STATS_ENTRY, 0));
+
+    /* Same ports in the same order */
+    TEST_ASSERT(delta_poll(&prev, ports1, rx1, 4) == TEST_PASS);
+    TEST_ASSERT(delta_poll(&cur, ports1, rx2, 4) == TEST_PASS);
+    TEST_OK(loci_columns_delta(&cur, &prev, &delta));
+    TEST_ASSERT(delta.count == 4);
+    d = column(&delta, "rx_packets");
+    dur = column(&delta, "duration_sec");
+    for (i = 0; i < 4; i++) {
+        TEST_ASSERT(d[i] == rx2[i] - rx1[i]);
+        TEST_ASSERT(column(&delta, "port_no")[i] == ports1[i]);
+        TEST_ASSERT(dur[i] == 60);
+    }
+
+    TEST_ASSERT(delta_poll(&prev, ports1, rx2, 4) == TEST_PASS);
+    TEST_ASSERT(delta_poll(&cur, ports3, rx3, 4) == TEST_PASS);
+    TEST_OK(loci_columns_delta(&cur, &prev, &delta));
+    d = column(&delta, "rx_packets");
+    TEST_ASSERT(d[0] == 100);
+    TEST_ASSERT(d[1] == 7);
+    TEST_ASSERT(d[2] == 0);
+    TEST_ASSERT(d[3] == 5);
+    TEST_ASSERT(column(&delta, "port_no")[1] == 5);
+
+    /* Against an empty poll, every row is new */
+    loci_columns_clear(&prev);
+    TEST_OK(loci_columns_delta(&cur, &prev, &delta));
+    TEST_ASSERT(delta.count == 4);
+    TEST_ASSERT(MEMCMP(column(&delta, "rx_packets"), rx3, sizeof(rx3)) == 0);
+
+    TEST_OK(loci_columns_init(&queues, OF_QUEUE_STATS_ENTRY, 0));
+    TEST_ASSERT(loci_columns_delta(&cur, &queues, &delta) == OF_ERROR_PARAM);
+    TEST_ASSERT(loci_columns_delta(&cur, &prev, &cur) == OF_ERROR_PARAM);
+
+    loci_columns_cleanup(&queues);
+    loci_columns_cleanup(&delta);
+    loci_columns_cleanup(&cur);
+    loci_columns_cleanup(&prev);
+
+    /* Flows that differ only in their match, reordered */
+    TEST_OK(loci_columns_init(&prev, OF_FLOW_STATS_ENTRY, 0));
+    TEST_OK(loci_columns_init(&cur, OF_FLOW_STATS_ENTRY, 0));
+    TEST_OK(loci_columns_init(&delta, OF_FLOW_STATS_ENTRY, 0));
+    TEST_ASSERT(flow_delta_poll(&prev, ports1, rx1, 4) == TEST_PASS);
+    TEST_ASSERT(flow_delta_poll(&cur, ports3, rx3, 4) == TEST_PASS);
+    TEST_OK(loci_columns_delta(&cur, &prev, &delta));
+    d = column(&delta, "packet_count");
+    TEST_ASSERT(d[0] == 700);
+    TEST_ASSERT(d[1] == 7);
+    TEST_ASSERT(d[2] == 50);
+    TEST_ASSERT(d[3] == 5);
+    loci_columns_cleanup(&delta);
+    loci_columns_cleanup(&cur);
+    loci_columns_cleanup(&prev);
+
+    return TEST_PASS;
+}
+
+/* Through the wire and back */
+static of_object_t *
+wire_copy(of_object_t *obj)
+{
+    uint8_t *buf;
+    int len = obj->length;
+
+    of_object_wire_buffer_steal(obj, &buf);
+    of_object_delete(obj);
+    if (buf == NULL) {
+        return NULL;
+    }
+
+    return of_object_new_from_message(OF_BUFFER_TO_MESSAGE(buf), len);
+}
+
+/*
+ * Rows of distinct keys and counters; gauges are cut to the 32 bits
+ * they have on the wire.
+ */
+static void
+fill_rows(loci_columns_t *cols)
+{
+    int i, j;
+
+    for (j = cols->n_keys; j < cols->n_columns; j++) {
+        for (i = 0; i < cols->count; i++) {
+            cols->columns[j][i] = cols->kinds[j] == LOCI_COLUMN_COUNTER ?
+                val(i, j) : (uint32_t)val(i, j);
+        }
+    }
+    for (i = 0; i < cols->count; i++) {
+        if (cols->entry_id == OF_QUEUE_STATS_ENTRY) {
+            cols->columns[0][i] = i / 8 + 1;
+            cols->columns[1][i] = i & 7;
+        } else {
+            cols->columns[0][i] = i + 1;
+        }
+    }
+}
+
+/*
+ * Fill replies from src, checking the flags and that they parse, and
+ * read them back into dst
+ */
+static int
+fill_replies(of_object_t *(*reply_new)(of_version_t), of_version_t version,
+             loci_columns_t *src, loci_columns_t *dst)
+{
+    of_object_t *reply, list;
+    uint16_t flags;
+    int n, next = 0, replies = 0;
+
+    loci_columns_clear(dst);
+    do {
+        reply = reply_new(version);
+        TEST_ASSERT(reply != NULL);
+        n = loci_columns_fill(reply, src, &next);
+        TEST_ASSERT(n > 0);
+        reply = wire_copy(reply);
+        TEST_ASSERT(reply != NULL);
+        if (reply->object_id == OF_PORT_STATS_REPLY) {
+            of_port_stats_reply_flags_get(reply, &flags);
+            of_port_stats_reply_entries_bind(reply, &list);
+        } else if (reply->object_id == OF_QUEUE_STATS_REPLY) {
+            of_queue_stats_reply_flags_get(reply, &flags);
+            of_queue_stats_reply_entries_bind(reply, &list);
+        } else {
+            of_table_stats_reply_flags_get(reply, &flags);
+            of_table_stats_reply_entries_bind(reply, &list);
+        }
+        TEST_ASSERT((flags != 0) == (next < src->count));
+        TEST_ASSERT(loci_columns_extract(dst, &list) == n);
+        of_object_delete(reply);
+        replies++;
+    } while (next < src->count);
+    TEST_ASSERT(dst->count == src->count);
+
+    return replies;
+}
+
+/* Each column of dst is src's, or 0 where the version has no field */
+static int
+columns_check(loci_columns_t *src, loci_columns_t *dst, const char **absent)
+{
+    int i, j, k, zero;
+
+    for (j = 0; j < src->n_columns; j++) {
+        for (k = 0, zero = 0; absent[k] != NULL; k++) {
+            if (strcmp(absent[k], src->names[j]) == 0) {
+                zero = 1;
+            }
+        }
+        for (i = 0; i < src->count; i++) {
+            TEST_ASSERT(dst->columns[j][i] ==
+                        (zero ? 0 : src->columns[j][i]));
+        }
+    }
+
+    return TEST_PASS;
+}
+
+static int
+test_columns_fill(void)
+{
+    static const char *none[] = { NULL };
+    static const char *no_duration[] = {
+        "duration_sec", "duration_nsec", NULL
+    };
+    static const char *no_max_entries[] = { "max_entries", NULL };
+    loci_columns_t src, dst;
+    of_object_t *reply, list, first, props, prop;
+    of_port_no_t port;
+    uint64_t crc_err;
+    int version, rv, n, next;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        /* Several replies' worth of ports */
+        TEST_OK(loci_columns_init(&src, OF_PORT_STATS_ENTRY, 0));
+        TEST_OK(loci_columns_init(&dst, OF_PORT_STATS_ENTRY, 0));
+        TEST_OK(loci_columns_resize(&src, 2000));
+        fill_rows(&src);
+        TEST_ASSERT(fill_replies(of_port_stats_reply_new, version,
+                                 &src, &dst) > 1);
+        TEST_ASSERT(columns_check(&src, &dst, version < OF_VERSION_1_3 ?
+                                  no_duration : none) == TEST_PASS);
+
+        /* As the getters read the first entry */
+        reply = of_port_stats_reply_new(version);
+        TEST_ASSERT(reply != NULL);
+        next = 0;
+        TEST_ASSERT(loci_columns_fill(reply, &src, &next) > 0);
+        reply = wire_copy(reply);
+        TEST_ASSERT(reply != NULL);
+        of_port_stats_reply_entries_bind(reply, &list);
+        TEST_OK(of_list_port_stats_entry_first(&list, &first));
+        of_port_stats_entry_port_no_get(&first, &port);
+        TEST_ASSERT(port == 1);
+        if (version == OF_VERSION_1_4) {
+            of_port_stats_entry_properties_bind(&first, &props);
+            n = 0;
+            OF_LIST_PORT_STATS_PROP_ITER(&props, &prop, rv) {
+                TEST_ASSERT(prop.object_id == OF_PORT_STATS_PROP_ETHERNET);
+                of_port_stats_prop_ethernet_rx_crc_err_get(&prop, &crc_err);
+                TEST_ASSERT(crc_err == src.columns[
+                                loci_columns_index(&src, "rx_crc_err")][0]);
+                n++;
+            }
+            TEST_ASSERT(n == 1);
+        }
+        of_object_delete(reply);
+
+        /* Columns of another class */
+        reply = of_queue_stats_reply_new(version);
+        TEST_ASSERT(reply != NULL);
+        next = 0;
+        TEST_ASSERT(loci_columns_fill(reply, &src, &next) == OF_ERROR_PARAM);
+        of_object_delete(reply);
+        loci_columns_cleanup(&src);
+        loci_columns_cleanup(&dst);
+
+        TEST_OK(loci_columns_init(&src, OF_QUEUE_STATS_ENTRY, 0));
+        TEST_OK(loci_columns_init(&dst, OF_QUEUE_STATS_ENTRY, 0));
+        TEST_OK(loci_columns_resize(&src, 3000));
+        fill_rows(&src);
+        TEST_ASSERT(fill_replies(of_queue_stats_reply_new, version,
+                                 &src, &dst) > 1);
+        TEST_ASSERT(columns_check(&src, &dst, version < OF_VERSION_1_3 ?
+                                  no_duration : none) == TEST_PASS);
+        loci_columns_cleanup(&src);
+        loci_columns_cleanup(&dst);
+
+        TEST_OK(loci_columns_init(&src, OF_TABLE_STATS_ENTRY, 0));
+        TEST_OK(loci_columns_init(&dst, OF_TABLE_STATS_ENTRY, 0));
+        TEST_OK(loci_columns_resize(&src, 200));
+        fill_rows(&src);
+        TEST_ASSERT(fill_replies(of_table_stats_reply_new, version,
+                                 &src, &dst) == 1);
+        TEST_ASSERT(columns_check(&src, &dst, version < OF_VERSION_1_3 ?
+                                  none : no_max_entries) == TEST_PASS);
+        loci_columns_cleanup(&src);
+        loci_columns_cleanup(&dst);
+    }
+
+    /* No rows make an empty, last reply */
+    TEST_OK(loci_columns_init(&src, OF_PORT_STATS_ENTRY, 0));
+    reply = of_port_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    next = 0;
+    TEST_ASSERT(loci_columns_fill(reply, &src, &next) == 0);
+    of_port_stats_reply_entries_bind(reply, &list);
+    TEST_ASSERT(list.length == 0);
+    of_object_delete(reply);
+    loci_columns_cleanup(&src);
+
+    /* Flow stats can't be filled */
+    TEST_OK(loci_columns_init(&src, OF_FLOW_STATS_ENTRY, 0));
+    reply = of_flow_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    TEST_ASSERT(loci_columns_fill(reply, &src, &next) == OF_ERROR_PARAM);
+    of_object_delete(reply);
+    loci_columns_cleanup(&src);
+
+    return TEST_PASS;
+}
+
+int
+run_columns_tests(void)
+{
+    RUN_TEST(columns_port_stats);
+    RUN_TEST(columns_queue_table);
+    RUN_TEST(columns_flow_meter);
+    RUN_TEST(columns_delta);
+    RUN_TEST(columns_fill);
+
+    return TEST_PASS;
+}
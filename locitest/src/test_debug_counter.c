@@ -0,0 +1,196 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test bulk debug counter replies
+ *
+ * What the bulk fill writes must read back the same through the
+ * generated accessors, and after a trip through the wire.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_debug_counter.h>
+
+#define VERSION OF_VERSION_1_3
+#define N_COUNTERS 10000
+#define N_DESCS 500
+
+/* Through the wire and back */
+static of_object_t *
+wire_copy(of_object_t *obj)
+{
+    uint8_t *buf;
+    int len = obj->length;
+
+    of_object_wire_buffer_steal(obj, &buf);
+    of_object_delete(obj);
+    if (buf == NULL) {
+        return NULL;
+    }
+
+    return of_object_new_from_message(OF_BUFFER_TO_MESSAGE(buf), len);
+}
+
+static int
+test_debug_counter_stats(void)
+{
+    loci_debug_counter_t *counters, *decoded;
+    of_object_t *reply;
+    of_list_bsn_debug_counter_stats_entry_t list;
+    of_bsn_debug_counter_stats_entry_t entry;
+    uint64_t id, value;
+    uint16_t flags;
+    int i, n, rv, next = 0, total = 0, replies = 0;
+
+    TEST_ASSERT(of_object_fixed_len[VERSION][OF_BSN_DEBUG_COUNTER_STATS_ENTRY]
+                == LOCI_DEBUG_COUNTER_ENTRY_BYTES);
+
+    counters = MALLOC(N_COUNTERS * sizeof(*counters));
+    decoded = MALLOC(N_COUNTERS * sizeof(*decoded));
+    TEST_ASSERT(counters != NULL && decoded != NULL);
+    for (i = 0; i < N_COUNTERS; i++) {
+        counters[i].id = i * 3 + 1;
+        counters[i].value = 0x0102030405060708ULL * (i + 1);
+    }
+
+    do {
+        reply = of_bsn_debug_counter_stats_reply_new(VERSION);
+        TEST_ASSERT(reply != NULL);
+        of_bsn_debug_counter_stats_reply_xid_set(reply, 7);
+        i = next;
+        n = loci_debug_counter_stats_fill(reply, counters, N_COUNTERS, &next);
+        TEST_ASSERT(n > 0);
+        TEST_ASSERT(next == i + n);
+
+        reply = wire_copy(reply);
+        TEST_ASSERT(reply != NULL);
+        of_bsn_debug_counter_stats_reply_flags_get(reply, &flags);
+        TEST_ASSERT((flags & OF_STATS_REPLY_FLAG_REPLY_MORE) ==
+                    (next < N_COUNTERS ? OF_STATS_REPLY_FLAG_REPLY_MORE : 0));
+        TEST_ASSERT(loci_debug_counter_stats_count(reply) == n);
+
+        /* As the accessors read it */
+        of_bsn_debug_counter_stats_reply_entries_bind(reply, &list);
+        OF_LIST_BSN_DEBUG_COUNTER_STATS_ENTRY_ITER(&list, &entry, rv) {
+            of_bsn_debug_counter_stats_entry_counter_id_get(&entry, &id);
+            of_bsn_debug_counter_stats_entry_value_get(&entry, &value);
+            TEST_ASSERT(id == counters[i].id);
+            TEST_ASSERT(value == counters[i].value);
+            i++;
+        }
+        TEST_ASSERT(i == next);
+
+        TEST_ASSERT(loci_debug_counter_stats_decode(reply, decoded + total,
+                                                    N_COUNTERS - total) == n);
+        total += n;
+        of_object_delete(reply);
+        replies++;
+    } while (next < N_COUNTERS);
+    TEST_ASSERT(total == N_COUNTERS);
+    TEST_ASSERT(replies == 3);
+    TEST_ASSERT(MEMCMP(decoded, counters, N_COUNTERS * sizeof(*counters)) == 0);
+
+    /* No counters make an empty, last reply */
+    reply = of_bsn_debug_counter_stats_reply_new(VERSION);
+    TEST_ASSERT(reply != NULL);
+    next = 0;
+    TEST_ASSERT(loci_debug_counter_stats_fill(reply, counters, 0, &next) == 0);
+    of_bsn_debug_counter_stats_reply_flags_get(reply, &flags);
+    TEST_ASSERT(flags == 0);
+    TEST_ASSERT(loci_debug_counter_stats_decode(reply, decoded, 0) == 0);
+
+    /* Too many for the array */
+    TEST_ASSERT(loci_debug_counter_stats_fill(reply, counters, 2, &next) == 2);
+    TEST_ASSERT(loci_debug_counter_stats_decode(reply, decoded, 1) ==
+                OF_ERROR_RESOURCE);
+
+    /* A partial entry; parsing refuses one, so make it in place */
+    reply->length += 8;
+    reply->wbuf->current_bytes += 8;
+    TEST_ASSERT(loci_debug_counter_stats_count(reply) == OF_ERROR_PARSE);
+    TEST_ASSERT(loci_debug_counter_stats_decode(reply, decoded, N_COUNTERS) ==
+                OF_ERROR_PARSE);
+    of_object_delete(reply);
+
+    FREE(counters);
+    FREE(decoded);
+
+    return TEST_PASS;
+}
+
+static int
+test_debug_counter_desc(void)
+{
+    loci_debug_counter_desc_t *descs, *decoded;
+    of_object_t *reply;
+    of_list_bsn_debug_counter_desc_stats_entry_t list;
+    of_bsn_debug_counter_desc_stats_entry_t entry;
+    of_str64_t name;
+    of_desc_str_t description;
+    uint64_t id;
+    int i, n, rv, next = 0, total = 0;
+
+    TEST_ASSERT(
+        of_object_fixed_len[VERSION][OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY] ==
+        LOCI_DEBUG_COUNTER_DESC_ENTRY_BYTES);
+
+    descs = MALLOC(N_DESCS * sizeof(*descs));
+    decoded = MALLOC(N_DESCS * sizeof(*decoded));
+    TEST_ASSERT(descs != NULL && decoded != NULL);
+    MEMSET(descs, 0, N_DESCS * sizeof(*descs));
+    for (i = 0; i < N_DESCS; i++) {
+        descs[i].id = 1000 + i;
+        snprintf(descs[i].name, sizeof(descs[i].name), "port%d.rx_drops", i);
+        snprintf(descs[i].description, sizeof(descs[i].description),
+                 "Packets dropped on receive by port %d", i);
+    }
+    /* A name that fills its field */
+    MEMSET(descs[1].name, 'x', sizeof(descs[1].name));
+
+    do {
+        reply = of_bsn_debug_counter_desc_stats_reply_new(VERSION);
+        TEST_ASSERT(reply != NULL);
+        i = next;
+        n = loci_debug_counter_desc_stats_fill(reply, descs, N_DESCS, &next);
+        TEST_ASSERT(n > 0);
+        reply = wire_copy(reply);
+        TEST_ASSERT(reply != NULL);
+
+        of_bsn_debug_counter_desc_stats_reply_entries_bind(reply, &list);
+        OF_LIST_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY_ITER(&list, &entry, rv) {
+            of_bsn_debug_counter_desc_stats_entry_counter_id_get(&entry, &id);
+            of_bsn_debug_counter_desc_stats_entry_name_get(&entry, &name);
+            of_bsn_debug_counter_desc_stats_entry_description_get(
+                &entry, &description);
+            TEST_ASSERT(id == descs[i].id);
+            TEST_ASSERT(MEMCMP(name, descs[i].name, sizeof(name)) == 0);
+            TEST_ASSERT(MEMCMP(description, descs[i].description,
+                               sizeof(description)) == 0);
+            i++;
+        }
+        TEST_ASSERT(i == next);
+
+        TEST_ASSERT(loci_debug_counter_desc_stats_decode(
+                        reply, decoded + total, N_DESCS - total) == n);
+        total += n;
+        of_object_delete(reply);
+    } while (next < N_DESCS);
+    TEST_ASSERT(total == N_DESCS);
+    TEST_ASSERT(MEMCMP(decoded, descs, N_DESCS * sizeof(*descs)) == 0);
+
+    FREE(descs);
+    FREE(decoded);
+
+    return TEST_PASS;
+}
+
+int
+run_debug_counter_tests(void)
+{
+    RUN_TEST(debug_counter_stats);
+    RUN_TEST(debug_counter_desc);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,320 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the JSON and binary log serializers
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_json.h>
+#include <loci/loci_binlog.h>
+
+static of_object_t *
+packet_in_new(void)
+{
+    of_packet_in_t *obj = of_packet_in_new(OF_VERSION_1_3);
+    of_match_t match;
+    uint8_t data[] = { 0xde, 0xad, 0xbe, 0xef };
+    of_octets_t octets = { data, sizeof(data) };
+
+    memset(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.in_port = 3;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+    match.fields.ipv4_dst = 0x0a000000;
+    match.masks.ipv4_dst = 0xff000000;
+
+    of_packet_in_xid_set(obj, 0x12345678);
+    of_packet_in_buffer_id_set(obj, 7);
+    of_packet_in_total_len_set(obj, 4);
+    of_packet_in_reason_set(obj, 1);
+    of_packet_in_table_id_set(obj, 2);
+    of_packet_in_cookie_set(obj, 0xffffffffffffffffULL);
+    if (of_packet_in_match_set(obj, &match) < 0 ||
+        of_packet_in_data_set(obj, &octets) < 0) {
+        of_packet_in_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static const char packet_in_json[] =
+    "{\"type\":\"of_packet_in\",\"version\":4,\"xid\":305419896,"
+    "\"buffer_id\":7,\"total_len\":4,\"reason\":1,\"table_id\":2,"
+    "\"cookie\":18446744073709551615,"
+    "\"match\":{\"in_port\":{\"value\":3,\"mask\":4294967295},"
+    "\"ipv4_dst\":{\"value\":\"10.0.0.0\",\"mask\":\"255.0.0.0\"}},"
+    "\"data\":\"deadbeef\"}";
+
+static int
+test_json_packet_in(void)
+{
+    of_object_t *obj;
+    loci_stream_t s;
+    uint8_t buf[512];
+
+    obj = packet_in_new();
+    TEST_ASSERT(obj != NULL);
+
+    loci_stream_init(&s, buf, sizeof(buf), NULL, NULL);
+    TEST_OK(of_object_json(&s, obj));
+    TEST_ASSERT(loci_stream_finish(&s) == sizeof(packet_in_json) - 1);
+    TEST_ASSERT(memcmp(buf, packet_in_json, sizeof(packet_in_json) - 1) == 0);
+
+    /* Too small and no flush function */
+    loci_stream_init(&s, buf, 16, NULL, NULL);
+    TEST_ASSERT(of_object_json(&s, obj) == OF_ERROR_RESOURCE);
+    TEST_ASSERT(loci_stream_finish(&s) == OF_ERROR_RESOURCE);
+
+    of_object_delete(obj);
+
+    return TEST_PASS;
+}
+
+struct flush_buf {
+    char data[1024];
+    int len;
+};
+
+static int
+flush_append(void *cookie, const uint8_t *data, int len)
+{
+    struct flush_buf *fb = cookie;
+
+    if (fb->len + len > (int)sizeof(fb->data)) {
+        return OF_ERROR_RESOURCE;
+    }
+    memcpy(fb->data + fb->len, data, len);
+    fb->len += len;
+    return OF_ERROR_NONE;
+}
+
+static int
+test_json_flush(void)
+{
+    of_object_t *obj;
+    loci_stream_t s;
+    uint8_t buf[LOCI_STREAM_MIN_SIZE];
+    struct flush_buf fb;
+
+    obj = packet_in_new();
+    TEST_ASSERT(obj != NULL);
+
+    fb.len = 0;
+    loci_stream_init(&s, buf, sizeof(buf), flush_append, &fb);
+    TEST_OK(of_object_json(&s, obj));
+    TEST_ASSERT(loci_stream_finish(&s) == sizeof(packet_in_json) - 1);
+    TEST_ASSERT(fb.len == sizeof(packet_in_json) - 1);
+    TEST_ASSERT(memcmp(fb.data, packet_in_json, fb.len) == 0);
+
+    of_object_delete(obj);
+
+    return TEST_PASS;
+}
+
+/* A bitmap_512 is longer than the smallest flushing stream */
+static int
+test_json_flush_bitmap_512(void)
+{
+    of_oxm_bsn_in_ports_512_t *obj;
+    of_bitmap_512_t bitmap;
+    loci_stream_t s;
+    uint8_t big[512], buf[LOCI_STREAM_MIN_SIZE];
+    struct flush_buf fb;
+    int i, len;
+
+    obj = of_oxm_bsn_in_ports_512_new(OF_VERSION_1_3);
+    TEST_ASSERT(obj != NULL);
+    for (i = 0; i < 8; i++) {
+        bitmap.words[i] = 0x0123456789abcdefULL + i;
+    }
+    of_oxm_bsn_in_ports_512_value_set(obj, bitmap);
+
+    loci_stream_init(&s, big, sizeof(big), NULL, NULL);
+    TEST_OK(of_object_json(&s, obj));
+    TEST_ASSERT((len = loci_stream_finish(&s)) > LOCI_STREAM_MIN_SIZE);
+    big[len] = 0;
+    TEST_ASSERT(strstr((char *)big, "\"value\":\"0x0123456789abcdf6"
+                       "0123456789abcdf5") != NULL);
+
+    fb.len = 0;
+    loci_stream_init(&s, buf, sizeof(buf), flush_append, &fb);
+    TEST_OK(of_object_json(&s, obj));
+    TEST_ASSERT(loci_stream_finish(&s) == len);
+    TEST_ASSERT(fb.len == len);
+    TEST_ASSERT(memcmp(fb.data, big, len) == 0);
+
+    of_object_delete(obj);
+
+    return TEST_PASS;
+}
+
+static int
+test_json_list(void)
+{
+    of_flow_add_t *obj;
+    of_list_action_t actions;
+    of_action_output_t output;
+    of_desc_stats_reply_t *desc;
+    of_desc_str_t desc_str;
+    loci_stream_t s;
+    uint8_t buf[2048];
+    int len;
+    static const char actions_json[] =
+        "\"actions\":[{\"type\":\"of_action_output\",\"version\":1,"
+        "\"port\":1,\"max_len\":0},{\"type\":\"of_action_output\","
+        "\"version\":1,\"port\":2,\"max_len\":0}]}";
+    static const char desc_json[] =
+        "\"mfr_desc\":\"a\\\"b\\\\c\\u0001\\u001f~\\u0080\\u00e9\\u00ff\"";
+
+    obj = of_flow_add_new(OF_VERSION_1_0);
+    TEST_ASSERT(obj != NULL);
+    of_flow_add_actions_bind(obj, &actions);
+    of_action_output_init(&output, OF_VERSION_1_0, -1, 1);
+    TEST_OK(of_list_action_append_bind(&actions, &output));
+    of_action_output_port_set(&output, 1);
+    of_action_output_init(&output, OF_VERSION_1_0, -1, 1);
+    TEST_OK(of_list_action_append_bind(&actions, &output));
+    of_action_output_port_set(&output, 2);
+
+    loci_stream_init(&s, buf, sizeof(buf), NULL, NULL);
+    TEST_OK(of_object_json(&s, obj));
+    len = loci_stream_finish(&s);
+    TEST_ASSERT(len > (int)sizeof(actions_json));
+    TEST_ASSERT(memcmp(buf + len - (sizeof(actions_json) - 1), actions_json,
+                       sizeof(actions_json) - 1) == 0);
+    TEST_ASSERT(memcmp(buf, "{\"type\":\"of_flow_add\",\"version\":1,", 34) == 0);
+    of_flow_add_delete(obj);
+
+    /* String escaping */
+    desc = of_desc_stats_reply_new(OF_VERSION_1_0);
+    TEST_ASSERT(desc != NULL);
+    memset(desc_str, 0, sizeof(desc_str));
+    strcpy(desc_str, "a\"b\\c\001\037~\200\351\377");
+    of_desc_stats_reply_mfr_desc_set(desc, desc_str);
+    loci_stream_init(&s, buf, sizeof(buf), NULL, NULL);
+    TEST_OK(of_object_json(&s, desc));
+    len = loci_stream_finish(&s);
+    TEST_ASSERT(len > 0);
+    buf[len] = 0;
+    TEST_ASSERT(strstr((char *)buf, desc_json) != NULL);
+    of_desc_stats_reply_delete(desc);
+
+    return TEST_PASS;
+}
+
+static int
+test_binlog_packet_in(void)
+{
+    of_object_t *obj;
+    loci_stream_t s;
+    uint8_t buf[512];
+    loci_binlog_record_t rec;
+    loci_binlog_cursor_t cursor;
+    loci_binlog_field_t f;
+    const uint8_t *entry;
+    int len;
+
+    obj = packet_in_new();
+    TEST_ASSERT(obj != NULL);
+
+    loci_stream_init(&s, buf, sizeof(buf), NULL, NULL);
+    TEST_OK(of_object_binlog(&s, obj));
+    len = loci_stream_finish(&s);
+    TEST_ASSERT(len > LOCI_BINLOG_HEADER_LENGTH);
+    /* Smaller than the wire message plus tags */
+    TEST_ASSERT(len < obj->length + 16);
+
+    TEST_ASSERT(loci_binlog_record_open(buf, len, &rec, &cursor) == len);
+    TEST_ASSERT(rec.object_id == OF_PACKET_IN);
+    TEST_ASSERT(rec.version == OF_VERSION_1_3);
+
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_U32 && f.value == 0x12345678);
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_U32 && f.value == 7);
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_U16 && f.value == 4);
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_U8 && f.value == 1);
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_U8 && f.value == 2);
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_U64 && f.value == 0xffffffffffffffffULL);
+
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_MATCH);
+    TEST_ASSERT(f.version == OF_VERSION_1_3);
+    entry = f.data;
+    TEST_ASSERT(strcmp(loci_binlog_match_field_names[entry[0]], "in_port") == 0);
+    TEST_ASSERT(entry[1] == sizeof(of_port_no_t));
+    entry += 2 + 2 * entry[1];
+    TEST_ASSERT(strcmp(loci_binlog_match_field_names[entry[0]], "ipv4_dst") == 0);
+    entry += 2 + 2 * entry[1];
+    TEST_ASSERT(entry == f.data + f.bytes);
+
+    TEST_OK(loci_binlog_next(&cursor, &f));
+    TEST_ASSERT(f.tag == LOCI_BINLOG_TAG_BYTES && f.bytes == 4);
+    TEST_ASSERT(memcmp(f.data, "\xde\xad\xbe\xef", 4) == 0);
+
+    TEST_ASSERT(loci_binlog_next(&cursor, &f) == OF_ERROR_RANGE);
+
+    /* Truncated record */
+    TEST_ASSERT(loci_binlog_record_open(buf, len - 1, &rec, &cursor) == OF_ERROR_PARSE);
+
+    of_object_delete(obj);
+
+    return TEST_PASS;
+}
+
+static int
+test_binlog_flush(void)
+{
+    of_object_t *obj;
+    loci_stream_t s;
+    uint8_t buf[128];
+    struct flush_buf fb;
+    loci_binlog_record_t rec;
+    loci_binlog_cursor_t cursor;
+    int i, len, off;
+
+    obj = packet_in_new();
+    TEST_ASSERT(obj != NULL);
+
+    /* Records are never split across flushes */
+    fb.len = 0;
+    loci_stream_init(&s, buf, sizeof(buf), flush_append, &fb);
+    for (i = 0; i < 5; i++) {
+        TEST_OK(of_object_binlog(&s, obj));
+    }
+    len = loci_stream_finish(&s);
+    TEST_ASSERT(len == fb.len);
+
+    for (off = 0, i = 0; off < fb.len; i++) {
+        TEST_ASSERT(loci_binlog_record_open((uint8_t *)fb.data + off,
+                                            fb.len - off, &rec, &cursor) > 0);
+        TEST_ASSERT(rec.object_id == OF_PACKET_IN);
+        off += rec.length;
+    }
+    TEST_ASSERT(i == 5);
+
+    of_object_delete(obj);
+
+    return TEST_PASS;
+}
+
+int
+run_export_tests(void)
+{
+    RUN_TEST(json_packet_in);
+    RUN_TEST(json_flush);
+    RUN_TEST(json_flush_bitmap_512);
+    RUN_TEST(json_list);
+    RUN_TEST(binlog_packet_in);
+    RUN_TEST(binlog_flush);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,649 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test BSN flow checksums
+ *
+ * After every change each bucket checksum must be the XOR of the
+ * cookies of the table's flows in it, and the table checksum the XOR of
+ * all of them.  Flow mods must change the flows each version's
+ * semantics says they do.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_flow_checksum.h>
+
+#define N_TABLES 4
+
+/* A TCP flow to 10.0.0.i, port p */
+static void
+match_make(of_match_t *match, of_version_t version, uint32_t i, uint16_t p)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = version;
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.ipv4_dst = 0x0a000000 | i;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    if (p != 0) {
+        match->fields.tcp_dst = p;
+        OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+    }
+}
+
+static uint64_t
+cookie_make(uint32_t i)
+{
+    return (i + 1) * 0x9e3779b97f4a7c15ULL;
+}
+
+/* Sum every table again from its flows */
+static int
+flow_checksum_check(loci_flow_checksum_t *fc)
+{
+    loci_flow_checksum_table_t *table;
+    loci_flow_checksum_flow_t *flow;
+    uint64_t *sums, sum;
+    uint32_t i, count, total = 0;
+    int t;
+
+    for (t = 0; t < fc->n_tables; t++) {
+        table = &fc->tables[t];
+        sums = MALLOC(table->buckets_size * sizeof(*sums));
+        TEST_ASSERT(sums != NULL);
+        MEMSET(sums, 0, table->buckets_size * sizeof(*sums));
+        sum = 0;
+        count = 0;
+        for (flow = table->flows; flow != NULL; flow = flow->table_next) {
+            TEST_ASSERT(flow->table_id == t);
+            TEST_ASSERT(flow->table_next == NULL ||
+                        flow->table_next->table_prev == flow);
+            sums[loci_flow_checksum_bucket(table, flow->cookie)] ^=
+                flow->cookie;
+            sum ^= flow->cookie;
+            count++;
+        }
+        for (i = 0; i < table->buckets_size; i++) {
+            TEST_ASSERT(sums[i] == table->buckets[i]);
+        }
+        FREE(sums);
+        TEST_ASSERT(sum == table->checksum);
+        TEST_ASSERT(count == table->count);
+        total += count;
+    }
+    TEST_ASSERT(total == loci_flow_checksum_count(fc));
+
+    return TEST_PASS;
+}
+
+#define FLOW_MOD_SET(cls, obj, version, table_id, match, priority, cookie, \
+                     cookie_mask)                                       \
+    do {                                                                \
+        cls##_priority_set(obj, priority);                              \
+        cls##_cookie_set(obj, cookie);                                  \
+        cls##_out_port_set(obj, OF_PORT_DEST_WILDCARD);                 \
+        if ((version) >= OF_VERSION_1_1) {                              \
+            cls##_table_id_set(obj, table_id);                          \
+            cls##_cookie_mask_set(obj, cookie_mask);                    \
+            cls##_out_group_set(obj, OF_GROUP_ANY);                     \
+        }                                                               \
+        rv = cls##_match_set(obj, match);                               \
+    } while (0)
+
+static of_object_t *
+flow_mod_new(of_object_id_t id, of_version_t version, uint8_t table_id,
+             of_match_t *match, uint16_t priority, uint64_t cookie,
+             uint64_t cookie_mask)
+{
+    of_object_t *obj = NULL;
+    int rv = OF_ERROR_NONE;
+
+    switch (id) {
+    case OF_FLOW_ADD:
+        if ((obj = of_flow_add_new(version)) != NULL) {
+            FLOW_MOD_SET(of_flow_add, obj, version, table_id, match,
+                         priority, cookie, cookie_mask);
+        }
+        break;
+    case OF_FLOW_MODIFY:
+        if ((obj = of_flow_modify_new(version)) != NULL) {
+            FLOW_MOD_SET(of_flow_modify, obj, version, table_id, match,
+                         priority, cookie, cookie_mask);
+        }
+        break;
+    case OF_FLOW_MODIFY_STRICT:
+        if ((obj = of_flow_modify_strict_new(version)) != NULL) {
+            FLOW_MOD_SET(of_flow_modify_strict, obj, version, table_id, match,
+                         priority, cookie, cookie_mask);
+        }
+        break;
+    case OF_FLOW_DELETE:
+        if ((obj = of_flow_delete_new(version)) != NULL) {
+            FLOW_MOD_SET(of_flow_delete, obj, version, table_id, match,
+                         priority, cookie, cookie_mask);
+        }
+        break;
+    default:
+        if ((obj = of_flow_delete_strict_new(version)) != NULL) {
+            FLOW_MOD_SET(of_flow_delete_strict, obj, version, table_id, match,
+                         priority, cookie, cookie_mask);
+        }
+        break;
+    }
+    if (rv < 0 && obj != NULL) {
+        of_object_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static int
+flow_mod_apply(loci_flow_checksum_t *fc, of_object_id_t id,
+               of_version_t version, uint8_t table_id, of_match_t *match,
+               uint16_t priority, uint64_t cookie, uint64_t cookie_mask)
+{
+    of_object_t *obj;
+    int rv;
+
+    obj = flow_mod_new(id, version, table_id, match, priority, cookie,
+                       cookie_mask);
+    if (obj == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    rv = loci_flow_checksum_apply(fc, obj);
+    of_object_delete(obj);
+
+    return rv;
+}
+
+static int
+test_flow_checksum_store(void)
+{
+    loci_flow_checksum_t fc;
+    of_match_t match;
+    uint64_t checksum;
+    uint32_t i, n = 1000;
+
+    TEST_ASSERT(loci_flow_checksum_init(&fc, N_TABLES, 12) == OF_ERROR_PARAM);
+    TEST_ASSERT(loci_flow_checksum_init(&fc, 0, 16) == OF_ERROR_PARAM);
+    TEST_OK(loci_flow_checksum_init(&fc, N_TABLES, 16));
+
+    for (i = 0; i < n; i++) {
+        match_make(&match, OF_VERSION_1_3, i, 80);
+        TEST_OK(loci_flow_checksum_add(&fc, i & 3, &match, 100, cookie_make(i),
+                                       0, NULL));
+    }
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == n);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+    TEST_ASSERT(loci_flow_checksum_add(&fc, N_TABLES, &match, 100, 1, 0,
+                                       NULL) == OF_ERROR_PARAM);
+
+    /* The same table, priority and match is the same flow */
+    checksum = loci_flow_checksum_table(&fc, 1);
+    match_make(&match, OF_VERSION_1_3, 5, 80);
+    TEST_OK(loci_flow_checksum_add(&fc, 1, &match, 100, 77, 0, NULL));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == n);
+    TEST_ASSERT(loci_flow_checksum_table(&fc, 1) ==
+                (checksum ^ cookie_make(5) ^ 77));
+    TEST_OK(loci_flow_checksum_add(&fc, 1, &match, 101, 78, 0, NULL));
+    TEST_OK(loci_flow_checksum_add(&fc, 2, &match, 100, 79, 0, NULL));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == n + 2);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    /* Overlap at the same priority is refused */
+    match_make(&match, OF_VERSION_1_3, 5, 0);
+    TEST_ASSERT(loci_flow_checksum_add(&fc, 1, &match, 100, 1,
+                                       OF_FLOW_MOD_FLAG_CHECK_OVERLAP,
+                                       NULL) ==
+                OF_ERROR_PARAM);
+    TEST_OK(loci_flow_checksum_add(&fc, 1, &match, 99, 1,
+                                   OF_FLOW_MOD_FLAG_CHECK_OVERLAP, NULL));
+    match_make(&match, OF_VERSION_1_3, 6, 0);
+    TEST_ASSERT(loci_flow_checksum_add(&fc, 1, &match, 100, 1,
+                                       OF_FLOW_MOD_FLAG_CHECK_OVERLAP,
+                                       NULL) ==
+                OF_ERROR_NONE);
+
+    /* Remove */
+    match_make(&match, OF_VERSION_1_3, 5, 80);
+    TEST_OK(loci_flow_checksum_remove(&fc, 1, &match, 101));
+    TEST_ASSERT(loci_flow_checksum_remove(&fc, 1, &match, 101) ==
+                OF_ERROR_RANGE);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    /* Rebucketing keeps the table checksums */
+    checksum = loci_flow_checksum_table(&fc, 0);
+    TEST_ASSERT(loci_flow_checksum_buckets_size_set(&fc, 0, 3) ==
+                OF_ERROR_PARAM);
+    TEST_ASSERT(loci_flow_checksum_buckets_size_set(&fc, N_TABLES, 4) ==
+                OF_ERROR_PARAM);
+    TEST_OK(loci_flow_checksum_buckets_size_set(&fc, 0, 1024));
+    TEST_ASSERT(loci_flow_checksum_buckets_size(&fc, 0) == 1024);
+    TEST_ASSERT(loci_flow_checksum_table(&fc, 0) == checksum);
+    TEST_OK(loci_flow_checksum_buckets_size_set(&fc, 3, 1));
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    loci_flow_checksum_cleanup(&fc);
+
+    return TEST_PASS;
+}
+
+static int
+test_flow_checksum_flow_mods(void)
+{
+    loci_flow_checksum_t fc;
+    of_match_t match;
+    of_object_t *obj;
+    uint32_t i;
+
+    TEST_OK(loci_flow_checksum_init(&fc, N_TABLES, 64));
+    for (i = 0; i < 64; i++) {
+        match_make(&match, OF_VERSION_1_3, i, 80);
+        TEST_OK(flow_mod_apply(&fc, OF_FLOW_ADD, OF_VERSION_1_3, i & 1, &match,
+                               100, cookie_make(i) & ~1ULL, 0));
+        match_make(&match, OF_VERSION_1_3, i, 443);
+        TEST_OK(flow_mod_apply(&fc, OF_FLOW_ADD, OF_VERSION_1_3, i & 1, &match,
+                               200, cookie_make(i) | 1, 0));
+    }
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 128);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    /* Modifies after 1.1 change no cookie and add nothing */
+    match_make(&match, OF_VERSION_1_3, 1000, 80);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_MODIFY, OF_VERSION_1_3, 0, &match,
+                           100, 5, 0));
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_MODIFY_STRICT, OF_VERSION_1_3, 0,
+                           &match, 100, 5, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 128);
+
+    /* Strict delete: priority counts */
+    match_make(&match, OF_VERSION_1_3, 2, 80);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_DELETE_STRICT, OF_VERSION_1_3, 0,
+                           &match, 200, 0, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 128);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_DELETE_STRICT, OF_VERSION_1_3, 0,
+                           &match, 100, 0, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 127);
+
+    /* Non-strict delete: every more specific flow, any priority */
+    match_make(&match, OF_VERSION_1_3, 4, 0);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_DELETE, OF_VERSION_1_3, 0, &match,
+                           0, 0, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 125);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    /* Cookie mask: the flows to port 443 have the low bit set */
+    MEMSET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_DELETE, OF_VERSION_1_3, 1, &match,
+                           0, 1, 1));
+    TEST_ASSERT(fc.tables[1].count == 32);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    /* Table all */
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_DELETE, OF_VERSION_1_3, 0xff, &match,
+                           0, 1, 1));
+    TEST_ASSERT(fc.tables[0].count == 30);
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 62);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    /* Flows without actions output nowhere */
+    obj = flow_mod_new(OF_FLOW_DELETE, OF_VERSION_1_3, 0, &match, 0, 0, 0);
+    TEST_ASSERT(obj != NULL);
+    of_flow_delete_out_port_set(obj, 3);
+    TEST_OK(loci_flow_checksum_apply(&fc, obj));
+    of_object_delete(obj);
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 62);
+
+    /* Unknown tables and other messages */
+    TEST_ASSERT(flow_mod_apply(&fc, OF_FLOW_ADD, OF_VERSION_1_3, N_TABLES,
+                               &match, 0, 0, 0) == OF_ERROR_PARAM);
+    obj = of_echo_request_new(OF_VERSION_1_3);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(loci_flow_checksum_apply(&fc, obj) == OF_ERROR_COMPAT);
+    of_object_delete(obj);
+
+    obj = of_bsn_table_set_buckets_size_new(OF_VERSION_1_3);
+    TEST_ASSERT(obj != NULL);
+    of_bsn_table_set_buckets_size_table_id_set(obj, 2);
+    of_bsn_table_set_buckets_size_buckets_size_set(obj, 256);
+    TEST_OK(loci_flow_checksum_apply(&fc, obj));
+    of_object_delete(obj);
+    TEST_ASSERT(loci_flow_checksum_buckets_size(&fc, 2) == 256);
+
+    /* Everything */
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_DELETE, OF_VERSION_1_3, 0xff, &match,
+                           0, 0, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 0);
+    TEST_ASSERT(loci_flow_checksum_table(&fc, 0) == 0);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    loci_flow_checksum_cleanup(&fc);
+
+    return TEST_PASS;
+}
+
+static int
+test_flow_checksum_versions(void)
+{
+    loci_flow_checksum_t fc;
+    of_match_t match;
+    of_object_t *obj;
+
+    TEST_OK(loci_flow_checksum_init(&fc, N_TABLES, 16));
+
+    /* A 1.0 modify of no flow adds one */
+    match_make(&match, OF_VERSION_1_0, 1, 80);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_MODIFY, OF_VERSION_1_0, 0, &match,
+                           100, 11, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 1);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_MODIFY_STRICT, OF_VERSION_1_0, 0,
+                           &match, 100, 12, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 1);
+    TEST_ASSERT(loci_flow_checksum_table(&fc, 0) == 11);
+
+    /* The same flow in 1.3 replaces it, with a VLAN in each version's
+     * encoding */
+    match.fields.vlan_vid = 10;
+    OF_MATCH_MASK_VLAN_VID_EXACT_SET(&match);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_ADD, OF_VERSION_1_0, 0, &match,
+                           100, 13, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 2);
+    match_make(&match, OF_VERSION_1_3, 1, 80);
+    match.fields.vlan_vid = 0x1000 | 10;
+    OF_MATCH_MASK_VLAN_VID_EXACT_SET(&match);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_ADD, OF_VERSION_1_3, 0, &match,
+                           100, 14, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 2);
+    TEST_ASSERT(loci_flow_checksum_table(&fc, 0) == (11 ^ 14));
+
+    /* 1.0 deletes have no cookie mask nor table */
+    match_make(&match, OF_VERSION_1_0, 1, 0);
+    TEST_OK(flow_mod_apply(&fc, OF_FLOW_DELETE, OF_VERSION_1_0, 0, &match,
+                           0, 999, 0));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 0);
+
+    /* 1.0 emergency flows are in no table */
+    match_make(&match, OF_VERSION_1_0, 2, 80);
+    obj = flow_mod_new(OF_FLOW_ADD, OF_VERSION_1_0, 0, &match, 1, 1, 0);
+    TEST_ASSERT(obj != NULL);
+    of_flow_add_flags_set(obj, OF_FLOW_MOD_FLAG_EMERG);
+    TEST_OK(loci_flow_checksum_apply(&fc, obj));
+    of_object_delete(obj);
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 0);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    loci_flow_checksum_cleanup(&fc);
+
+    return TEST_PASS;
+}
+
+static int
+test_flow_checksum_replies(void)
+{
+    loci_flow_checksum_t fc;
+    of_object_t *reply;
+    of_list_bsn_flow_checksum_bucket_stats_entry_t list;
+    of_bsn_flow_checksum_bucket_stats_entry_t elt;
+    of_list_bsn_table_checksum_stats_entry_t tables;
+    of_bsn_table_checksum_stats_entry_t table;
+    of_match_t match;
+    uint64_t checksum;
+    uint32_t i, bucket = 0, seen = 0;
+    uint16_t flags;
+    uint8_t table_id;
+    int replies = 0, rv, n;
+
+    TEST_OK(loci_flow_checksum_init(&fc, N_TABLES, 1));
+    TEST_OK(loci_flow_checksum_buckets_size_set(&fc, 2, 16384));
+    for (i = 0; i < 5000; i++) {
+        match_make(&match, OF_VERSION_1_3, i, 80);
+        TEST_OK(loci_flow_checksum_add(&fc, 2, &match, 100, cookie_make(i),
+                                       0, NULL));
+    }
+
+    /* 16384 buckets don't fit one reply */
+    do {
+        reply = of_bsn_flow_checksum_bucket_stats_reply_new(OF_VERSION_1_3);
+        TEST_ASSERT(reply != NULL);
+        n = loci_flow_checksum_bucket_stats_fill(&fc, 2, &bucket, reply);
+        TEST_ASSERT(n > 0);
+        of_bsn_flow_checksum_bucket_stats_reply_flags_get(reply, &flags);
+        TEST_ASSERT((flags & OF_STATS_REPLY_FLAG_REPLY_MORE) ==
+                    (bucket < 16384 ? OF_STATS_REPLY_FLAG_REPLY_MORE : 0));
+        of_bsn_flow_checksum_bucket_stats_reply_entries_bind(reply, &list);
+        OF_LIST_BSN_FLOW_CHECKSUM_BUCKET_STATS_ENTRY_ITER(&list, &elt, rv) {
+            of_bsn_flow_checksum_bucket_stats_entry_checksum_get(&elt,
+                                                                 &checksum);
+            TEST_ASSERT(checksum == fc.tables[2].buckets[seen]);
+            seen++;
+            n--;
+        }
+        TEST_ASSERT(n == 0);
+        of_object_delete(reply);
+        replies++;
+    } while (bucket < loci_flow_checksum_buckets_size(&fc, 2));
+    TEST_ASSERT(seen == 16384);
+    TEST_ASSERT(replies > 1);
+
+    reply = of_bsn_flow_checksum_bucket_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    bucket = 0;
+    TEST_ASSERT(loci_flow_checksum_bucket_stats_fill(&fc, N_TABLES, &bucket,
+                                                     reply) == OF_ERROR_PARAM);
+    of_object_delete(reply);
+
+    reply = of_bsn_table_checksum_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    TEST_ASSERT(loci_flow_checksum_table_stats_fill(&fc, reply) == N_TABLES);
+    of_bsn_table_checksum_stats_reply_entries_bind(reply, &tables);
+    i = 0;
+    OF_LIST_BSN_TABLE_CHECKSUM_STATS_ENTRY_ITER(&tables, &table, rv) {
+        of_bsn_table_checksum_stats_entry_table_id_get(&table, &table_id);
+        of_bsn_table_checksum_stats_entry_checksum_get(&table, &checksum);
+        TEST_ASSERT(table_id == i);
+        TEST_ASSERT(checksum == loci_flow_checksum_table(&fc, table_id));
+        i++;
+    }
+    TEST_ASSERT(i == N_TABLES);
+    TEST_ASSERT(loci_flow_checksum_table(&fc, 2) != 0);
+    of_object_delete(reply);
+
+    loci_flow_checksum_cleanup(&fc);
+
+    return TEST_PASS;
+}
+
+/*
+ * An output to port, and after 1.0 a group action for group unless it
+ * is OF_GROUP_ANY, as the actions of a flow add or strict modify
+ */
+static int
+outputs_set(of_object_t *obj, of_port_no_t port, uint32_t group)
+{
+    of_version_t version = obj->version;
+    of_list_action_t *actions;
+    of_list_instruction_t *instructions;
+    of_object_t action, *ins;
+
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    of_action_output_init(&action, version, -1, 1);
+    TEST_OK(of_list_action_append_bind(actions, &action));
+    of_action_output_port_set(&action, port);
+    if (version == OF_VERSION_1_0) {
+        TEST_OK(obj->object_id == OF_FLOW_ADD ?
+                of_flow_add_actions_set(obj, actions) :
+                of_flow_modify_strict_actions_set(obj, actions));
+        of_object_delete(actions);
+        return TEST_PASS;
+    }
+
+    instructions = of_list_instruction_new(version);
+    TEST_ASSERT(instructions != NULL);
+    ins = of_instruction_apply_actions_new(version);
+    TEST_ASSERT(ins != NULL);
+    TEST_OK(of_instruction_apply_actions_actions_set(ins, actions));
+    TEST_OK(of_list_instruction_append(instructions, ins));
+    of_object_delete(ins);
+    of_object_delete(actions);
+
+    if (group != OF_GROUP_ANY) {
+        actions = of_list_action_new(version);
+        TEST_ASSERT(actions != NULL);
+        of_action_group_init(&action, version, -1, 1);
+        TEST_OK(of_list_action_append_bind(actions, &action));
+        of_action_group_group_id_set(&action, group);
+        ins = of_instruction_write_actions_new(version);
+        TEST_ASSERT(ins != NULL);
+        TEST_OK(of_instruction_write_actions_actions_set(ins, actions));
+        TEST_OK(of_list_instruction_append(instructions, ins));
+        of_object_delete(ins);
+        of_object_delete(actions);
+    }
+
+    TEST_OK(obj->object_id == OF_FLOW_ADD ?
+            of_flow_add_instructions_set(obj, instructions) :
+            of_flow_modify_strict_instructions_set(obj, instructions));
+    of_object_delete(instructions);
+
+    return TEST_PASS;
+}
+
+/* Apply a delete of every flow of table 0 filtered by out_port and out_group */
+static int
+delete_filtered(loci_flow_checksum_t *fc, of_version_t version,
+                of_port_no_t out_port, uint32_t out_group)
+{
+    of_match_t match;
+    of_object_t *obj;
+    int rv;
+
+    MEMSET(&match, 0, sizeof(match));
+    match.version = version;
+    obj = flow_mod_new(OF_FLOW_DELETE, version, 0, &match, 0, 0, 0);
+    if (obj == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    of_flow_delete_out_port_set(obj, out_port);
+    if (version >= OF_VERSION_1_1) {
+        of_flow_delete_out_group_set(obj, out_group);
+    }
+    rv = loci_flow_checksum_apply(fc, obj);
+    of_object_delete(obj);
+
+    return rv;
+}
+
+/*
+ * Deletes filtered by out_port or out_group cover the flows with an
+ * output to them, as the flows' last add or modify set it
+ */
+static int
+test_flow_checksum_out_port(void)
+{
+    loci_flow_checksum_t fc;
+    of_list_instruction_t instructions;
+    of_match_t match;
+    of_object_t *obj;
+    of_port_no_t port;
+    uint64_t checksum;
+    uint32_t i, group;
+
+    /* Even flows output to port 3, odd ones to 1; every fourth from the
+     * second also to group 7 */
+    TEST_OK(loci_flow_checksum_init(&fc, N_TABLES, 16));
+    for (i = 0; i < 32; i++) {
+        match_make(&match, OF_VERSION_1_3, i, 80);
+        obj = flow_mod_new(OF_FLOW_ADD, OF_VERSION_1_3, 0, &match, 100,
+                           cookie_make(i), 0);
+        TEST_ASSERT(obj != NULL);
+        port = i % 2 == 0 ? 3 : 1;
+        group = i % 4 == 1 ? 7 : OF_GROUP_ANY;
+        TEST_ASSERT(outputs_set(obj, port, group) == TEST_PASS);
+        TEST_OK(loci_flow_checksum_apply(&fc, obj));
+        of_object_delete(obj);
+    }
+
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, 5, OF_GROUP_ANY));
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, OF_PORT_DEST_WILDCARD, 8));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 32);
+
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, 3, OF_GROUP_ANY));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 16);
+    checksum = 0;
+    for (i = 1; i < 32; i += 2) {
+        checksum ^= cookie_make(i);
+    }
+    TEST_ASSERT(loci_flow_checksum_table(&fc, 0) == checksum);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    /* Both filters must hold */
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, 3, 7));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 16);
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, 1, 7));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 8);
+
+    /* A modify replaces the outputs of its flow */
+    match_make(&match, OF_VERSION_1_3, 3, 80);
+    obj = flow_mod_new(OF_FLOW_MODIFY_STRICT, OF_VERSION_1_3, 0, &match, 100,
+                       0, 0);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(outputs_set(obj, 3, 7) == TEST_PASS);
+    TEST_OK(loci_flow_checksum_apply(&fc, obj));
+    of_object_delete(obj);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, 1, OF_GROUP_ANY));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 1);
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, OF_PORT_DEST_WILDCARD, 7));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 0);
+
+    /* Flows added directly take the instructions of their flow_mod */
+    match_make(&match, OF_VERSION_1_3, 40, 80);
+    obj = flow_mod_new(OF_FLOW_ADD, OF_VERSION_1_3, 0, &match, 100, 9, 0);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(outputs_set(obj, 9, OF_GROUP_ANY) == TEST_PASS);
+    of_flow_add_instructions_bind(obj, &instructions);
+    TEST_OK(loci_flow_checksum_add(&fc, 0, &match, 100, 9, 0, &instructions));
+    of_object_delete(obj);
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, 8, OF_GROUP_ANY));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 1);
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, 9, OF_GROUP_ANY));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 0);
+
+    /* 1.0 keeps actions in a list and has 16 bit ports */
+    match_make(&match, OF_VERSION_1_0, 41, 80);
+    obj = flow_mod_new(OF_FLOW_ADD, OF_VERSION_1_0, 0, &match, 100, 10, 0);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(outputs_set(obj, OF_PORT_DEST_CONTROLLER,
+                            OF_GROUP_ANY) == TEST_PASS);
+    TEST_OK(loci_flow_checksum_apply(&fc, obj));
+    of_object_delete(obj);
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_0, 3, OF_GROUP_ANY));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 1);
+    TEST_OK(delete_filtered(&fc, OF_VERSION_1_3, OF_PORT_DEST_CONTROLLER,
+                            OF_GROUP_ANY));
+    TEST_ASSERT(loci_flow_checksum_count(&fc) == 0);
+    TEST_ASSERT(flow_checksum_check(&fc) == TEST_PASS);
+
+    loci_flow_checksum_cleanup(&fc);
+
+    return TEST_PASS;
+}
+
+int
+run_flow_checksum_tests(void)
+{
+    RUN_TEST(flow_checksum_store);
+    RUN_TEST(flow_checksum_flow_mods);
+    RUN_TEST(flow_checksum_out_port);
+    RUN_TEST(flow_checksum_versions);
+    RUN_TEST(flow_checksum_replies);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,442 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the BSN gentable store
+ *
+ * After every change the checksum and count of each bucket must be
+ * those of its entries, and the table checksum the XOR of the bucket
+ * checksums.  Dumps must return every selected entry once, over as
+ * many replies as it takes.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_gentable.h>
+
+#define VERSION OF_VERSION_1_3
+#define TABLE_ID 7
+
+static of_checksum_128_t
+checksum_make(uint32_t i)
+{
+    of_checksum_128_t checksum;
+
+    checksum.hi = (i + 1) * 0x9e3779b97f4a7c15ULL;
+    checksum.lo = (i + 1) * 0xc2b2ae3d27d4eb4fULL;
+    return checksum;
+}
+
+/* Recount every bucket from its entries */
+static int
+gentable_check(loci_gentable_t *gt)
+{
+    loci_gentable_entry_t *entry;
+    of_checksum_128_t sum, table;
+    uint32_t i, count, total = 0;
+
+    MEMSET(&table, 0, sizeof(table));
+    for (i = 0; i < gt->buckets_size; i++) {
+        MEMSET(&sum, 0, sizeof(sum));
+        count = 0;
+        for (entry = gt->buckets[i].entries; entry != NULL;
+             entry = entry->bucket_next) {
+            TEST_ASSERT(loci_gentable_bucket(gt, entry->checksum) == i);
+            TEST_ASSERT(entry->bucket_next == NULL ||
+                        entry->bucket_next->bucket_prev == entry);
+            TEST_ASSERT(loci_gentable_lookup(gt, entry->data,
+                                             entry->key_bytes) == entry);
+            sum.hi ^= entry->checksum.hi;
+            sum.lo ^= entry->checksum.lo;
+            count++;
+        }
+        TEST_ASSERT(count == gt->buckets[i].count);
+        TEST_ASSERT(sum.hi == gt->buckets[i].checksum.hi);
+        TEST_ASSERT(sum.lo == gt->buckets[i].checksum.lo);
+        table.hi ^= sum.hi;
+        table.lo ^= sum.lo;
+        total += count;
+    }
+    TEST_ASSERT(total == loci_gentable_count(gt));
+    TEST_ASSERT(table.hi == gt->checksum.hi && table.lo == gt->checksum.lo);
+
+    return TEST_PASS;
+}
+
+static int
+test_gentable_store(void)
+{
+    loci_gentable_t gt;
+    loci_gentable_entry_t *entry;
+    of_checksum_128_t checksum, mask, empty;
+    uint8_t key[4], value[8];
+    uint32_t i, n = 1000;
+    int value_bytes;
+
+    MEMSET(&empty, 0, sizeof(empty));
+    TEST_ASSERT(loci_gentable_init(&gt, TABLE_ID, 3) == OF_ERROR_PARAM);
+    TEST_OK(loci_gentable_init(&gt, TABLE_ID, 16));
+    TEST_ASSERT(gt.bucket_bits == 4);
+
+    for (i = 0; i < n; i++) {
+        buf_u32_set(key, i);
+        MEMSET(value, i, sizeof(value));
+        value_bytes = i & 7;
+        TEST_OK(loci_gentable_add(&gt, key, sizeof(key), value, value_bytes,
+                                  checksum_make(i)));
+    }
+    TEST_ASSERT(loci_gentable_count(&gt) == n);
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+
+    buf_u32_set(key, 5);
+    entry = loci_gentable_lookup(&gt, key, sizeof(key));
+    TEST_ASSERT(entry != NULL);
+    TEST_ASSERT(entry->value_bytes == 5);
+    TEST_ASSERT(LOCI_GENTABLE_ENTRY_VALUE(entry)[0] == 5);
+    TEST_ASSERT(loci_gentable_lookup(&gt, key, 3) == NULL);
+
+    /* Change entries, in place and not */
+    MEMSET(value, 0xaa, sizeof(value));
+    TEST_OK(loci_gentable_add(&gt, key, sizeof(key), value, 5,
+                              checksum_make(5000)));
+    TEST_ASSERT(loci_gentable_lookup(&gt, key, sizeof(key)) == entry);
+    TEST_OK(loci_gentable_add(&gt, key, sizeof(key), value, 8,
+                              checksum_make(5001)));
+    entry = loci_gentable_lookup(&gt, key, sizeof(key));
+    TEST_ASSERT(entry->value_bytes == 8);
+    TEST_ASSERT(LOCI_GENTABLE_ENTRY_VALUE(entry)[7] == 0xaa);
+    TEST_ASSERT(entry->checksum.hi == checksum_make(5001).hi);
+    TEST_ASSERT(loci_gentable_count(&gt) == n);
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+
+    /* Delete half */
+    for (i = 0; i < n; i += 2) {
+        buf_u32_set(key, i);
+        TEST_OK(loci_gentable_delete(&gt, key, sizeof(key)));
+    }
+    TEST_ASSERT(loci_gentable_delete(&gt, key, sizeof(key)) == OF_ERROR_RANGE);
+    TEST_ASSERT(loci_gentable_count(&gt) == n / 2);
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+
+    /* Rebucketing keeps the table checksum */
+    checksum = gt.checksum;
+    TEST_ASSERT(loci_gentable_buckets_size_set(&gt, 0) == OF_ERROR_PARAM);
+    TEST_ASSERT(loci_gentable_buckets_size_set(&gt, 48) == OF_ERROR_PARAM);
+    TEST_ASSERT(gt.buckets_size == 16);
+    TEST_OK(loci_gentable_buckets_size_set(&gt, 256));
+    TEST_ASSERT(gt.bucket_bits == 8);
+    TEST_ASSERT(gt.checksum.hi == checksum.hi && gt.checksum.lo == checksum.lo);
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+    TEST_OK(loci_gentable_buckets_size_set(&gt, 1));
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+    TEST_OK(loci_gentable_buckets_size_set(&gt, 64));
+
+    /* Clear one bucket, then everything */
+    mask.hi = 0xfc00000000000000ULL;
+    mask.lo = 0;
+    checksum = gt.buckets[9].entries->checksum;
+    i = gt.buckets[9].count;
+    TEST_ASSERT(loci_gentable_clear(&gt, checksum, mask) == i);
+    TEST_ASSERT(gt.buckets[9].count == 0);
+    TEST_ASSERT(gt.buckets[9].entries == NULL);
+    TEST_ASSERT(loci_gentable_count(&gt) == n / 2 - i);
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+    TEST_ASSERT(loci_gentable_clear(&gt, empty, empty) == n / 2 - i);
+    TEST_ASSERT(loci_gentable_count(&gt) == 0);
+    TEST_ASSERT(gt.checksum.hi == 0 && gt.checksum.lo == 0);
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+
+    loci_gentable_cleanup(&gt);
+
+    return TEST_PASS;
+}
+
+/* A key of a port and a VLAN */
+static of_list_bsn_tlv_t *
+key_new(uint32_t port, uint16_t vlan_vid)
+{
+    of_list_bsn_tlv_t *list;
+    of_object_t *tlv;
+
+    if ((list = of_list_bsn_tlv_new(VERSION)) == NULL) {
+        return NULL;
+    }
+    if ((tlv = of_bsn_tlv_port_new(VERSION)) != NULL) {
+        of_bsn_tlv_port_value_set(tlv, port);
+        of_list_append(list, tlv);
+        of_object_delete(tlv);
+    }
+    if ((tlv = of_bsn_tlv_vlan_vid_new(VERSION)) != NULL) {
+        of_bsn_tlv_vlan_vid_value_set(tlv, vlan_vid);
+        of_list_append(list, tlv);
+        of_object_delete(tlv);
+    }
+
+    return list;
+}
+
+static of_object_t *
+entry_add_new(uint16_t table_id, uint32_t port, uint16_t vlan_vid,
+              uint32_t i)
+{
+    of_object_t *msg, *tlv;
+    of_list_bsn_tlv_t *key, *value;
+    of_mac_addr_t mac = { { 0x02, 0, 0, 0, 0, 0 } };
+    int rv = OF_ERROR_RESOURCE;
+
+    msg = of_bsn_gentable_entry_add_new(VERSION);
+    key = key_new(port, vlan_vid);
+    value = of_list_bsn_tlv_new(VERSION);
+    tlv = of_bsn_tlv_mac_new(VERSION);
+    if (msg != NULL && key != NULL && value != NULL && tlv != NULL) {
+        mac.addr[5] = i;
+        of_bsn_tlv_mac_value_set(tlv, mac);
+        of_bsn_gentable_entry_add_table_id_set(msg, table_id);
+        of_bsn_gentable_entry_add_checksum_set(msg, checksum_make(i));
+        if ((rv = of_list_append(value, tlv)) == 0 &&
+            (rv = of_bsn_gentable_entry_add_key_set(msg, key)) == 0) {
+            rv = of_bsn_gentable_entry_add_value_set(msg, value);
+        }
+    }
+    if (tlv != NULL) {
+        of_object_delete(tlv);
+    }
+    if (value != NULL) {
+        of_object_delete(value);
+    }
+    if (key != NULL) {
+        of_object_delete(key);
+    }
+    if (rv < 0 && msg != NULL) {
+        of_object_delete(msg);
+        return NULL;
+    }
+
+    return msg;
+}
+
+static int
+test_gentable_messages(void)
+{
+    loci_gentable_t gt;
+    loci_gentable_entry_t *entry;
+    of_list_bsn_tlv_t *key;
+    of_object_t *msg;
+    of_checksum_128_t mask;
+    int i;
+
+    TEST_OK(loci_gentable_init(&gt, TABLE_ID, 16));
+
+    for (i = 0; i < 20; i++) {
+        msg = entry_add_new(TABLE_ID, i, 100, i);
+        TEST_ASSERT(msg != NULL);
+        TEST_OK(loci_gentable_apply(&gt, msg));
+        of_object_delete(msg);
+    }
+    TEST_ASSERT(loci_gentable_count(&gt) == 20);
+
+    /* Another table's entries are refused */
+    msg = entry_add_new(TABLE_ID + 1, 99, 100, 99);
+    TEST_ASSERT(msg != NULL);
+    TEST_ASSERT(loci_gentable_apply(&gt, msg) == OF_ERROR_PARAM);
+    of_object_delete(msg);
+    TEST_ASSERT(loci_gentable_count(&gt) == 20);
+
+    /* The key is the raw TLV list */
+    key = key_new(3, 100);
+    TEST_ASSERT(key != NULL);
+    entry = loci_gentable_lookup(&gt, OF_OBJECT_BUFFER_INDEX(key, 0),
+                                 key->length);
+    TEST_ASSERT(entry != NULL);
+    TEST_ASSERT(entry->key_bytes == key->length);
+    TEST_ASSERT(entry->value_bytes == 10);
+    TEST_ASSERT(LOCI_GENTABLE_ENTRY_VALUE(entry)[9] == 3);
+    TEST_ASSERT(entry->checksum.lo == checksum_make(3).lo);
+
+    msg = of_bsn_gentable_entry_delete_new(VERSION);
+    TEST_ASSERT(msg != NULL);
+    of_bsn_gentable_entry_delete_table_id_set(msg, TABLE_ID);
+    TEST_OK(of_bsn_gentable_entry_delete_key_set(msg, key));
+    TEST_OK(loci_gentable_apply(&gt, msg));
+    TEST_ASSERT(loci_gentable_apply(&gt, msg) == OF_ERROR_RANGE);
+    of_object_delete(msg);
+    TEST_ASSERT(loci_gentable_lookup(&gt, OF_OBJECT_BUFFER_INDEX(key, 0),
+                                     key->length) == NULL);
+    of_object_delete(key);
+    TEST_ASSERT(loci_gentable_count(&gt) == 19);
+
+    msg = of_bsn_gentable_set_buckets_size_new(VERSION);
+    TEST_ASSERT(msg != NULL);
+    of_bsn_gentable_set_buckets_size_table_id_set(msg, TABLE_ID);
+    of_bsn_gentable_set_buckets_size_buckets_size_set(msg, 1024);
+    TEST_OK(loci_gentable_apply(&gt, msg));
+    of_object_delete(msg);
+    TEST_ASSERT(gt.buckets_size == 1024);
+    TEST_ASSERT(gentable_check(&gt) == TEST_PASS);
+
+    msg = of_bsn_gentable_clear_request_new(VERSION);
+    TEST_ASSERT(msg != NULL);
+    MEMSET(&mask, 0, sizeof(mask));
+    of_bsn_gentable_clear_request_table_id_set(msg, TABLE_ID);
+    of_bsn_gentable_clear_request_checksum_set(msg, mask);
+    of_bsn_gentable_clear_request_checksum_mask_set(msg, mask);
+    TEST_OK(loci_gentable_apply(&gt, msg));
+    of_object_delete(msg);
+    TEST_ASSERT(loci_gentable_count(&gt) == 0);
+
+    msg = of_echo_request_new(VERSION);
+    TEST_ASSERT(msg != NULL);
+    TEST_ASSERT(loci_gentable_apply(&gt, msg) == OF_ERROR_COMPAT);
+    of_object_delete(msg);
+
+    loci_gentable_cleanup(&gt);
+
+    return TEST_PASS;
+}
+
+/* Dump entries until done; count them and XOR their checksums */
+static int
+entry_desc_dump(loci_gentable_t *gt, loci_gentable_dump_t *dump,
+                uint32_t *count, of_checksum_128_t *sum, int *replies)
+{
+    of_bsn_gentable_entry_desc_stats_reply_t *reply;
+    of_list_bsn_gentable_entry_desc_stats_entry_t list;
+    of_bsn_gentable_entry_desc_stats_entry_t desc;
+    of_list_bsn_tlv_t key;
+    of_checksum_128_t checksum;
+    loci_gentable_entry_t *entry;
+    uint16_t flags;
+    int rv, n;
+
+    *count = 0;
+    MEMSET(sum, 0, sizeof(*sum));
+    *replies = 0;
+    do {
+        reply = of_bsn_gentable_entry_desc_stats_reply_new(VERSION);
+        TEST_ASSERT(reply != NULL);
+        n = loci_gentable_entry_desc_fill(gt, dump, reply);
+        TEST_ASSERT(n >= 0);
+        of_bsn_gentable_entry_desc_stats_reply_flags_get(reply, &flags);
+        TEST_ASSERT((flags & OF_STATS_REPLY_FLAG_REPLY_MORE) ==
+                    (loci_gentable_dump_done(dump) ? 0 :
+                     OF_STATS_REPLY_FLAG_REPLY_MORE));
+
+        of_bsn_gentable_entry_desc_stats_reply_entries_bind(reply, &list);
+        OF_LIST_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY_ITER(&list, &desc, rv) {
+            of_bsn_gentable_entry_desc_stats_entry_checksum_get(&desc,
+                                                                &checksum);
+            of_bsn_gentable_entry_desc_stats_entry_key_bind(&desc, &key);
+            entry = loci_gentable_lookup(gt, OF_OBJECT_BUFFER_INDEX(&key, 0),
+                                         key.length);
+            TEST_ASSERT(entry != NULL);
+            TEST_ASSERT(entry->checksum.hi == checksum.hi);
+            TEST_ASSERT(desc.length == 20 + entry->key_bytes +
+                        entry->value_bytes);
+            sum->hi ^= checksum.hi;
+            sum->lo ^= checksum.lo;
+            (*count)++;
+            n--;
+        }
+        TEST_ASSERT(rv == OF_ERROR_RANGE);
+        TEST_ASSERT(n == 0);
+        of_object_delete(reply);
+        (*replies)++;
+    } while (!loci_gentable_dump_done(dump));
+
+    return TEST_PASS;
+}
+
+static int
+test_gentable_dump(void)
+{
+    loci_gentable_t gt;
+    loci_gentable_dump_t dump;
+    of_bsn_gentable_bucket_stats_reply_t *reply;
+    of_list_bsn_gentable_bucket_stats_entry_t list;
+    of_bsn_gentable_bucket_stats_entry_t elt;
+    of_checksum_128_t checksum, mask, sum;
+    uint8_t key[8], value[200];
+    uint32_t i, count, n = 2000, bucket;
+    int replies, rv;
+
+    TEST_OK(loci_gentable_init(&gt, TABLE_ID, 8192));
+    MEMSET(value, 0x5a, sizeof(value));
+    for (i = 0; i < n; i++) {
+        buf_u32_set(key, i);
+        buf_u32_set(key + 4, ~i);
+        TEST_OK(loci_gentable_add(&gt, key, sizeof(key), value, sizeof(value),
+                                  checksum_make(i)));
+    }
+
+    /* Everything: the entries take several replies */
+    loci_gentable_dump_init(&gt, &dump, 0, gt.buckets_size);
+    TEST_ASSERT(entry_desc_dump(&gt, &dump, &count, &sum, &replies) ==
+                TEST_PASS);
+    TEST_ASSERT(count == n);
+    TEST_ASSERT(replies > 1);
+    TEST_ASSERT(sum.hi == gt.checksum.hi && sum.lo == gt.checksum.lo);
+
+    /* One bucket by checksum and mask */
+    bucket = loci_gentable_bucket(&gt, checksum_make(77));
+    checksum = checksum_make(77);
+    mask.hi = 0xfff8000000000000ULL;
+    mask.lo = 0;
+    loci_gentable_dump_select(&gt, &dump, checksum, mask);
+    TEST_ASSERT(dump.bucket == bucket && dump.end == bucket + 1);
+    TEST_ASSERT(entry_desc_dump(&gt, &dump, &count, &sum, &replies) ==
+                TEST_PASS);
+    TEST_ASSERT(count == gt.buckets[bucket].count);
+    TEST_ASSERT(sum.hi == gt.buckets[bucket].checksum.hi);
+
+    /* A whole checksum selects its entry alone */
+    mask.hi = mask.lo = ~0ULL;
+    loci_gentable_dump_select(&gt, &dump, checksum, mask);
+    TEST_ASSERT(entry_desc_dump(&gt, &dump, &count, &sum, &replies) ==
+                TEST_PASS);
+    TEST_ASSERT(count == 1 && replies == 1);
+    TEST_ASSERT(sum.hi == checksum.hi && sum.lo == checksum.lo);
+
+    /* A prefix shorter than the bucket bits selects a range */
+    mask.hi = 0xc000000000000000ULL;
+    mask.lo = 0;
+    loci_gentable_dump_select(&gt, &dump, checksum, mask);
+    TEST_ASSERT(dump.end - dump.bucket == gt.buckets_size / 4);
+    TEST_ASSERT(dump.bucket == (bucket & ~(gt.buckets_size / 4 - 1)));
+
+    /* Bucket stats of all 8192 buckets take several replies */
+    loci_gentable_dump_init(&gt, &dump, 0, 100000);
+    TEST_ASSERT(dump.end == gt.buckets_size);
+    bucket = 0;
+    replies = 0;
+    do {
+        reply = of_bsn_gentable_bucket_stats_reply_new(VERSION);
+        TEST_ASSERT(reply != NULL);
+        TEST_ASSERT(loci_gentable_bucket_stats_fill(&gt, &dump, reply) > 0);
+        of_bsn_gentable_bucket_stats_reply_entries_bind(reply, &list);
+        OF_LIST_BSN_GENTABLE_BUCKET_STATS_ENTRY_ITER(&list, &elt, rv) {
+            of_bsn_gentable_bucket_stats_entry_checksum_get(&elt, &checksum);
+            TEST_ASSERT(checksum.hi == gt.buckets[bucket].checksum.hi);
+            TEST_ASSERT(checksum.lo == gt.buckets[bucket].checksum.lo);
+            bucket++;
+        }
+        of_object_delete(reply);
+        replies++;
+    } while (!loci_gentable_dump_done(&dump));
+    TEST_ASSERT(bucket == gt.buckets_size);
+    TEST_ASSERT(replies > 1);
+
+    loci_gentable_cleanup(&gt);
+
+    return TEST_PASS;
+}
+
+int
+run_gentable_tests(void)
+{
+    RUN_TEST(gentable_store);
+    RUN_TEST(gentable_messages);
+    RUN_TEST(gentable_dump);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,440 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test gentable resync against an in-process switch
+ *
+ * The switch is a loci_gentable_t answering requests with
+ * loci_gentable_bucket_stats_fill and loci_gentable_entry_desc_fill and
+ * applying everything else with loci_gentable_apply.  Messages each way
+ * go through their wire encoding.  After a resync the switch's table
+ * must be the desired one, having been sent only the differences.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_gentable_resync.h>
+
+#define VERSION OF_VERSION_1_3
+#define TABLE_ID 3
+#define REPLIES_MAX 64
+
+typedef struct fake_switch_s {
+    loci_gentable_t gt;
+    /** Replies not yet taken, in order */
+    of_object_t *replies[REPLIES_MAX];
+    int head;
+    int tail;
+    /** Messages received */
+    int received;
+    /** Refuse messages after this many, if not negative */
+    int fail_after;
+} fake_switch_t;
+
+static void
+key_build(uint32_t i, uint8_t *key)
+{
+    buf_u16_set(key, 0);
+    buf_u16_set(key + 2, 8);
+    buf_u32_set(key + 4, i >> 12);
+    buf_u16_set(key + 8, 6);
+    buf_u16_set(key + 10, 6);
+    buf_u16_set(key + 12, i & 0xfff);
+}
+
+static of_checksum_128_t
+checksum_make(uint32_t i)
+{
+    of_checksum_128_t checksum;
+
+    checksum.hi = (i + 1) * 0x9e3779b97f4a7c15ULL;
+    checksum.lo = (i + 1) * 0xc2b2ae3d27d4eb4fULL;
+    return checksum;
+}
+
+/* Entry i; a different version gives another value and checksum */
+static int
+entry_put(loci_gentable_t *gt, uint32_t i, uint32_t version, int value_bytes)
+{
+    uint8_t key[14], value[256];
+
+    key_build(i, key);
+    MEMSET(value, i + version, value_bytes);
+    return loci_gentable_add(gt, key, sizeof(key), value, value_bytes,
+                             checksum_make(i + version * 1000000));
+}
+
+static int
+entry_remove(loci_gentable_t *gt, uint32_t i)
+{
+    uint8_t key[14];
+
+    key_build(i, key);
+    return loci_gentable_delete(gt, key, sizeof(key));
+}
+
+/* Through the wire and back */
+static of_object_t *
+wire_copy(of_object_t *obj)
+{
+    uint8_t *buf;
+    int len = obj->length;
+
+    of_object_wire_buffer_steal(obj, &buf);
+    of_object_delete(obj);
+    if (buf == NULL) {
+        return NULL;
+    }
+
+    return of_object_new_from_message(OF_BUFFER_TO_MESSAGE(buf), len);
+}
+
+static int
+reply_queue(fake_switch_t *sw, of_object_t *reply)
+{
+    if ((sw->tail + 1) % REPLIES_MAX == sw->head ||
+        (reply = wire_copy(reply)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    sw->replies[sw->tail] = reply;
+    sw->tail = (sw->tail + 1) % REPLIES_MAX;
+
+    return OF_ERROR_NONE;
+}
+
+/* Answer a stats request with replies from a dump */
+static int
+dump_reply(fake_switch_t *sw, loci_gentable_dump_t *dump, int entries,
+           uint32_t xid)
+{
+    of_object_t *reply;
+    int rv;
+
+    do {
+        if (entries) {
+            reply = of_bsn_gentable_entry_desc_stats_reply_new(VERSION);
+        } else {
+            reply = of_bsn_gentable_bucket_stats_reply_new(VERSION);
+        }
+        if (reply == NULL) {
+            return OF_ERROR_RESOURCE;
+        }
+        if (entries) {
+            of_bsn_gentable_entry_desc_stats_reply_xid_set(reply, xid);
+            rv = loci_gentable_entry_desc_fill(&sw->gt, dump, reply);
+        } else {
+            of_bsn_gentable_bucket_stats_reply_xid_set(reply, xid);
+            rv = loci_gentable_bucket_stats_fill(&sw->gt, dump, reply);
+        }
+        if (rv < 0) {
+            of_object_delete(reply);
+            return rv;
+        }
+        if ((rv = reply_queue(sw, reply)) < 0) {
+            return rv;
+        }
+    } while (!loci_gentable_dump_done(dump));
+
+    return OF_ERROR_NONE;
+}
+
+static int
+switch_receive(void *cookie, of_object_t *msg)
+{
+    fake_switch_t *sw = cookie;
+    loci_gentable_dump_t dump;
+    of_checksum_128_t checksum, mask;
+    uint32_t xid;
+    uint16_t table_id;
+    int rv;
+
+    if (sw->fail_after >= 0 && sw->received >= sw->fail_after) {
+        of_object_delete(msg);
+        return OF_ERROR_RESOURCE;
+    }
+    sw->received++;
+    if ((msg = wire_copy(msg)) == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+
+    switch (msg->object_id) {
+    case OF_BSN_GENTABLE_BUCKET_STATS_REQUEST:
+        of_bsn_gentable_bucket_stats_request_xid_get(msg, &xid);
+        of_bsn_gentable_bucket_stats_request_table_id_get(msg, &table_id);
+        loci_gentable_dump_init(&sw->gt, &dump, 0, sw->gt.buckets_size);
+        rv = table_id == TABLE_ID ? dump_reply(sw, &dump, 0, xid) :
+            OF_ERROR_PARAM;
+        break;
+    case OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST:
+        of_bsn_gentable_entry_desc_stats_request_xid_get(msg, &xid);
+        of_bsn_gentable_entry_desc_stats_request_checksum_get(msg, &checksum);
+        of_bsn_gentable_entry_desc_stats_request_checksum_mask_get(msg, &mask);
+        loci_gentable_dump_select(&sw->gt, &dump, checksum, mask);
+        rv = dump_reply(sw, &dump, 1, xid);
+        break;
+    default:
+        rv = loci_gentable_apply(&sw->gt, msg);
+        break;
+    }
+    of_object_delete(msg);
+
+    return rv;
+}
+
+static void
+switch_init(fake_switch_t *sw, uint32_t buckets_size)
+{
+    MEMSET(sw, 0, sizeof(*sw));
+    sw->fail_after = -1;
+    loci_gentable_init(&sw->gt, TABLE_ID, buckets_size);
+}
+
+static void
+switch_cleanup(fake_switch_t *sw)
+{
+    while (sw->head != sw->tail) {
+        of_object_delete(sw->replies[sw->head]);
+        sw->head = (sw->head + 1) % REPLIES_MAX;
+    }
+    loci_gentable_cleanup(&sw->gt);
+}
+
+/* Feed the switch's replies to the resync until it is done */
+static int
+resync_run(loci_gentable_resync_t *rs, fake_switch_t *sw)
+{
+    of_object_t *reply;
+
+    while (!loci_gentable_resync_done(rs)) {
+        TEST_ASSERT(sw->head != sw->tail);
+        reply = sw->replies[sw->head];
+        sw->head = (sw->head + 1) % REPLIES_MAX;
+        TEST_OK(loci_gentable_resync_handle(rs, reply));
+        of_object_delete(reply);
+    }
+    TEST_ASSERT(sw->head == sw->tail);
+
+    return TEST_PASS;
+}
+
+/* Same entries, values and checksums */
+static int
+tables_check(loci_gentable_t *want, loci_gentable_t *have)
+{
+    loci_gentable_entry_t *a, *b;
+    uint32_t i;
+
+    TEST_ASSERT(have->buckets_size == want->buckets_size);
+    TEST_ASSERT(loci_gentable_count(have) == loci_gentable_count(want));
+    TEST_ASSERT(have->checksum.hi == want->checksum.hi);
+    TEST_ASSERT(have->checksum.lo == want->checksum.lo);
+    for (i = 0; i < want->buckets_size; i++) {
+        for (a = want->buckets[i].entries; a != NULL; a = a->bucket_next) {
+            b = loci_gentable_lookup(have, a->data, a->key_bytes);
+            TEST_ASSERT(b != NULL);
+            TEST_ASSERT(b->checksum.hi == a->checksum.hi);
+            TEST_ASSERT(b->value_bytes == a->value_bytes);
+            TEST_ASSERT(MEMCMP(LOCI_GENTABLE_ENTRY_VALUE(a),
+                               LOCI_GENTABLE_ENTRY_VALUE(b),
+                               a->value_bytes) == 0);
+        }
+    }
+
+    return TEST_PASS;
+}
+
+static int
+test_gentable_resync_diff(void)
+{
+    loci_gentable_t desired;
+    loci_gentable_resync_t rs;
+    fake_switch_t sw;
+    uint32_t i, n = 3000;
+    int value_bytes;
+
+    TEST_OK(loci_gentable_init(&desired, TABLE_ID, 4096));
+    switch_init(&sw, 256);
+    for (i = 0; i < n; i++) {
+        value_bytes = 8 + (i & 15);
+        TEST_OK(entry_put(&desired, i, 0, value_bytes));
+        TEST_OK(entry_put(&sw.gt, i, 0, value_bytes));
+    }
+
+    /* Missing on the switch, changed on it and only on it */
+    for (i = 0; i < 20; i++) {
+        TEST_OK(entry_remove(&sw.gt, i * 101));
+    }
+    for (i = 0; i < 10; i++) {
+        TEST_OK(entry_put(&sw.gt, 7 + i * 211, 1, 4));
+    }
+    for (i = 0; i < 15; i++) {
+        TEST_OK(entry_put(&sw.gt, n + i, 0, 12));
+    }
+
+    TEST_OK(loci_gentable_resync_start(&rs, &desired, VERSION, 100,
+                                       switch_receive, &sw));
+    TEST_ASSERT(sw.gt.buckets_size == 4096);
+    TEST_ASSERT(resync_run(&rs, &sw) == TEST_PASS);
+    TEST_ASSERT(tables_check(&desired, &sw.gt) == TEST_PASS);
+
+    /* Only the differences were sent; a changed entry is in two buckets */
+    TEST_ASSERT(rs.adds == 30);
+    TEST_ASSERT(rs.deletes == 15);
+    TEST_ASSERT(rs.buckets_differ > 0 && rs.buckets_differ <= 55);
+    TEST_ASSERT(rs.requests <= rs.buckets_differ);
+    TEST_ASSERT(sw.received == 2 + (int)(rs.requests + rs.adds + rs.deletes));
+    TEST_ASSERT(rs.xid == 100 + (uint32_t)sw.received);
+    loci_gentable_resync_cleanup(&rs);
+
+    /* Again, nothing differs */
+    sw.received = 0;
+    TEST_OK(loci_gentable_resync_start(&rs, &desired, VERSION, 1,
+                                       switch_receive, &sw));
+    TEST_ASSERT(resync_run(&rs, &sw) == TEST_PASS);
+    TEST_ASSERT(rs.buckets_differ == 0 && rs.requests == 0);
+    TEST_ASSERT(rs.adds == 0 && rs.deletes == 0);
+    TEST_ASSERT(sw.received == 2);
+    loci_gentable_resync_cleanup(&rs);
+
+    switch_cleanup(&sw);
+    loci_gentable_cleanup(&desired);
+
+    return TEST_PASS;
+}
+
+static int
+test_gentable_resync_ranges(void)
+{
+    loci_gentable_t desired;
+    loci_gentable_resync_t rs;
+    fake_switch_t sw;
+    of_checksum_128_t empty;
+    uint32_t i, n = 600;
+
+    /* An empty switch: every bucket differs, and neighbours share requests */
+    TEST_OK(loci_gentable_init(&desired, TABLE_ID, 64));
+    switch_init(&sw, 64);
+    for (i = 0; i < n; i++) {
+        TEST_OK(entry_put(&desired, i, 0, 200));
+    }
+    TEST_OK(loci_gentable_resync_start(&rs, &desired, VERSION, 1,
+                                       switch_receive, &sw));
+    TEST_ASSERT(resync_run(&rs, &sw) == TEST_PASS);
+    TEST_ASSERT(tables_check(&desired, &sw.gt) == TEST_PASS);
+    TEST_ASSERT(rs.buckets_differ == 64);
+    TEST_ASSERT(rs.requests == 1);
+    TEST_ASSERT(rs.adds == n && rs.deletes == 0);
+    loci_gentable_resync_cleanup(&rs);
+
+    /* Over the range limit the requests split; replies take several
+     * messages */
+    for (i = n; i < 3 * LOCI_GENTABLE_RESYNC_RANGE_ENTRIES; i++) {
+        TEST_OK(entry_put(&desired, i, 0, 200));
+    }
+    MEMSET(&empty, 0, sizeof(empty));
+    TEST_ASSERT(loci_gentable_clear(&sw.gt, empty, empty) == n);
+    for (i = 0; i < n; i += 2) {
+        TEST_OK(entry_put(&sw.gt, i, 0, 200));
+    }
+    TEST_OK(loci_gentable_resync_start(&rs, &desired, VERSION, 1,
+                                       switch_receive, &sw));
+    TEST_ASSERT(resync_run(&rs, &sw) == TEST_PASS);
+    TEST_ASSERT(tables_check(&desired, &sw.gt) == TEST_PASS);
+    TEST_ASSERT(rs.requests > 2 && rs.requests < 64);
+    TEST_ASSERT(rs.adds == 3 * LOCI_GENTABLE_RESYNC_RANGE_ENTRIES - n / 2);
+    loci_gentable_resync_cleanup(&rs);
+
+    /* One bucket: the request is for everything */
+    TEST_OK(loci_gentable_buckets_size_set(&desired, 1));
+    TEST_OK(entry_put(&desired, 0, 2, 10));
+    TEST_OK(loci_gentable_resync_start(&rs, &desired, VERSION, 1,
+                                       switch_receive, &sw));
+    TEST_ASSERT(resync_run(&rs, &sw) == TEST_PASS);
+    TEST_ASSERT(tables_check(&desired, &sw.gt) == TEST_PASS);
+    TEST_ASSERT(rs.requests == 1 && rs.adds == 1);
+    loci_gentable_resync_cleanup(&rs);
+
+    switch_cleanup(&sw);
+    loci_gentable_cleanup(&desired);
+
+    return TEST_PASS;
+}
+
+static int
+test_gentable_resync_errors(void)
+{
+    loci_gentable_t desired;
+    loci_gentable_resync_t rs;
+    fake_switch_t sw;
+    of_object_t *msg;
+    uint32_t i;
+    int rv = OF_ERROR_NONE;
+
+    TEST_OK(loci_gentable_init(&desired, TABLE_ID, 16));
+    switch_init(&sw, 16);
+    for (i = 0; i < 100; i++) {
+        TEST_OK(entry_put(&desired, i, 0, 8));
+    }
+
+    TEST_ASSERT(loci_gentable_resync_start(&rs, &desired, OF_VERSION_1_0, 1,
+                                           switch_receive, &sw) ==
+                OF_ERROR_VERSION);
+    TEST_ASSERT(loci_gentable_resync_done(&rs));
+    loci_gentable_resync_cleanup(&rs);
+    TEST_ASSERT(sw.received == 0);
+
+    /* Other messages and stale replies are passed over */
+    TEST_OK(loci_gentable_resync_start(&rs, &desired, VERSION, 1,
+                                       switch_receive, &sw));
+    msg = of_echo_reply_new(VERSION);
+    TEST_ASSERT(msg != NULL);
+    TEST_ASSERT(loci_gentable_resync_handle(&rs, msg) == OF_ERROR_COMPAT);
+    of_object_delete(msg);
+    msg = of_bsn_gentable_bucket_stats_reply_new(VERSION);
+    TEST_ASSERT(msg != NULL);
+    of_bsn_gentable_bucket_stats_reply_xid_set(msg, 77);
+    TEST_ASSERT(loci_gentable_resync_handle(&rs, msg) == OF_ERROR_COMPAT);
+    of_object_delete(msg);
+    TEST_ASSERT(resync_run(&rs, &sw) == TEST_PASS);
+    TEST_ASSERT(tables_check(&desired, &sw.gt) == TEST_PASS);
+    loci_gentable_resync_cleanup(&rs);
+
+    /* A send error stops the resync */
+    TEST_OK(entry_put(&desired, 1000, 0, 8));
+    TEST_OK(entry_put(&desired, 1001, 0, 8));
+    sw.received = 0;
+    sw.fail_after = 3;
+    TEST_OK(loci_gentable_resync_start(&rs, &desired, VERSION, 1,
+                                       switch_receive, &sw));
+    TEST_ASSERT(sw.head != sw.tail);
+    msg = sw.replies[sw.head];
+    sw.head = (sw.head + 1) % REPLIES_MAX;
+    TEST_OK(loci_gentable_resync_handle(&rs, msg));
+    of_object_delete(msg);
+    while (sw.head != sw.tail && !loci_gentable_resync_done(&rs)) {
+        msg = sw.replies[sw.head];
+        sw.head = (sw.head + 1) % REPLIES_MAX;
+        rv = loci_gentable_resync_handle(&rs, msg);
+        of_object_delete(msg);
+    }
+    TEST_ASSERT(loci_gentable_resync_done(&rs));
+    TEST_ASSERT(rv == OF_ERROR_RESOURCE);
+    TEST_ASSERT(sw.received == 3);
+    loci_gentable_resync_cleanup(&rs);
+
+    switch_cleanup(&sw);
+    loci_gentable_cleanup(&desired);
+
+    return TEST_PASS;
+}
+
+int
+run_gentable_resync_tests(void)
+{
+    RUN_TEST(gentable_resync_diff);
+    RUN_TEST(gentable_resync_ranges);
+    RUN_TEST(gentable_resync_errors);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,308 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test hashes of bytes, matches and objects
+ *
+ * Every bit of the input must change a byte hash.  The same flow must
+ * hash the same in OpenFlow 1.0 and 1.3, and bits outside the masks,
+ * padding and (if asked) the xid must not count.  Distinct matches
+ * must not collide.  The fields of a logged match must be numbered as
+ * in loci_match_fields, which hashing a logged object relies on.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_hash.h>
+#include <loci/loci_binlog.h>
+#include <loci/loci_match_fields.h>
+
+#define COLLISION_MATCHES 100000
+#define COLLISION_BUCKETS 1024
+
+static int
+test_hash_bytes(void)
+{
+    uint8_t data[64];
+    uint64_t hash;
+    int len, bit;
+
+    for (len = 0; len < (int)sizeof(data); len++) {
+        data[len] = len * 13;
+    }
+
+    TEST_ASSERT(loci_hash_bytes(data, 40, 0) == loci_hash_bytes(data, 40, 0));
+    TEST_ASSERT(loci_hash_bytes(data, 40, 0) != loci_hash_bytes(data, 40, 1));
+    TEST_ASSERT(loci_hash_bytes(data, 0, 0) != loci_hash_bytes(data, 0, 1));
+    TEST_ASSERT(loci_hash_bytes(data, 8, 0) != loci_hash_bytes(data, 9, 0));
+
+    /* Every bit counts, in the stripes and in the tail */
+    for (len = 1; len <= (int)sizeof(data); len++) {
+        hash = loci_hash_bytes(data, len, 7);
+        for (bit = 0; bit < len * 8; bit++) {
+            data[bit / 8] ^= 1 << (bit % 8);
+            TEST_ASSERT(loci_hash_bytes(data, len, 7) != hash);
+            data[bit / 8] ^= 1 << (bit % 8);
+        }
+        TEST_ASSERT(loci_hash_bytes(data, len, 7) == hash);
+    }
+
+    return TEST_PASS;
+}
+
+/* The same TCP flow, as OpenFlow 1.0 and 1.3 code it */
+static void
+flow_match(of_match_t *match, of_version_t version, int tagged)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = version;
+
+    match->fields.in_port = 3;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(match);
+    if (version < OF_VERSION_1_2) {
+        match->fields.vlan_vid = tagged ? 10 : OF_MATCH_UNTAGGED_VLAN_ID(version);
+        match->fields.ip_dscp = 0xb8;
+    } else {
+        match->fields.vlan_vid = tagged ? 0x1000 | 10 : 0;
+        match->fields.ip_dscp = 46;
+    }
+    OF_MATCH_MASK_VLAN_VID_EXACT_SET(match);
+    OF_MATCH_MASK_IP_DSCP_EXACT_SET(match);
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.ipv4_src = 0x0a000001;
+    match->masks.ipv4_src = 0xffffff00;
+    match->fields.tcp_dst = 80;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+}
+
+static int
+test_hash_match(void)
+{
+    of_match_t m10, m13, canon;
+    uint64_t hash;
+
+    /* Across versions */
+    flow_match(&m10, OF_VERSION_1_0, 1);
+    flow_match(&m13, OF_VERSION_1_3, 1);
+    hash = loci_match_hash(&m13, 0);
+    TEST_ASSERT(loci_match_hash(&m10, 0) == hash);
+    TEST_ASSERT(loci_match_equal(&m10, &m13));
+    TEST_ASSERT(!of_match_eq(&m10, &m13));
+    TEST_ASSERT(loci_match_hash(&m13, 1) != hash);
+
+    loci_match_canonical(&m10, &canon);
+    TEST_ASSERT(canon.version == OF_VERSION_1_2);
+    TEST_ASSERT(canon.fields.vlan_vid == (0x1000 | 10));
+    TEST_ASSERT(canon.masks.vlan_vid == 0x1fff);
+    TEST_ASSERT(canon.fields.ip_dscp == 46);
+    TEST_ASSERT(canon.masks.ip_dscp == 0x3f);
+    TEST_ASSERT(canon.fields.ipv4_src == 0x0a000000);
+    TEST_ASSERT(loci_match_hash(&canon, 0) == hash);
+
+    flow_match(&m10, OF_VERSION_1_0, 0);
+    flow_match(&m13, OF_VERSION_1_3, 0);
+    TEST_ASSERT(loci_match_hash(&m10, 0) == loci_match_hash(&m13, 0));
+    TEST_ASSERT(loci_match_equal(&m10, &m13));
+    TEST_ASSERT(loci_match_hash(&m13, 0) != hash);
+
+    /* Bits outside the masks and padding don't count */
+    flow_match(&m13, OF_VERSION_1_3, 1);
+    m13.fields.ipv4_src |= 0xff;
+    m13.fields.tcp_src = 1234;
+    m13.fields.ipv6_src.addr[0] = 0xfe;
+    ((uint8_t *)&m13.fields)[sizeof(of_match_fields_t) - 1] = 0x55;
+    ((uint8_t *)&m13.masks)[sizeof(of_match_fields_t) - 1] = 0xaa;
+    TEST_ASSERT(loci_match_hash(&m13, 0) == hash);
+    flow_match(&m10, OF_VERSION_1_0, 1);
+    TEST_ASSERT(loci_match_equal(&m10, &m13));
+
+    /* Values and masks do */
+    flow_match(&m13, OF_VERSION_1_3, 1);
+    m13.fields.tcp_dst = 81;
+    TEST_ASSERT(loci_match_hash(&m13, 0) != hash);
+    flow_match(&m13, OF_VERSION_1_3, 1);
+    m13.masks.ipv4_src = 0xffffffff;
+    TEST_ASSERT(loci_match_hash(&m13, 0) != hash);
+    flow_match(&m10, OF_VERSION_1_3, 1);
+    TEST_ASSERT(!loci_match_equal(&m10, &m13));
+
+    /* A wildcard field of zero is not an exact match of zero */
+    MEMSET(&m10, 0, sizeof(m10));
+    m10.version = OF_VERSION_1_3;
+    m13 = m10;
+    OF_MATCH_MASK_TCP_SRC_EXACT_SET(&m13);
+    TEST_ASSERT(loci_match_hash(&m10, 0) != loci_match_hash(&m13, 0));
+    TEST_ASSERT(!loci_match_equal(&m10, &m13));
+
+    return TEST_PASS;
+}
+
+static of_object_t *
+flow_add_new(uint32_t xid)
+{
+    of_object_t *obj;
+    of_match_t match;
+
+    obj = of_flow_add_new(OF_VERSION_1_3);
+    if (obj == NULL) {
+        return NULL;
+    }
+    of_flow_add_xid_set(obj, xid);
+    of_flow_add_cookie_set(obj, 0x1234);
+    of_flow_add_priority_set(obj, 100);
+    flow_match(&match, OF_VERSION_1_3, 1);
+    if (of_flow_add_match_set(obj, &match) < 0) {
+        of_object_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static int
+test_hash_object(void)
+{
+    of_object_t *a, *b;
+    of_octets_t data;
+    uint8_t *buf;
+    uint8_t payload[] = { 1, 2, 3, 4, 5 };
+    uint64_t hash_a, hash_b;
+    int len;
+
+    /* The xid counts unless ignored */
+    a = flow_add_new(1);
+    b = flow_add_new(2);
+    TEST_ASSERT(a != NULL && b != NULL);
+    TEST_OK(loci_object_hash(a, 0, 0, &hash_a));
+    TEST_OK(loci_object_hash(b, 0, 0, &hash_b));
+    TEST_ASSERT(hash_a != hash_b);
+    TEST_OK(loci_object_hash(a, LOCI_HASH_IGNORE_XID, 0, &hash_a));
+    TEST_OK(loci_object_hash(b, LOCI_HASH_IGNORE_XID, 0, &hash_b));
+    TEST_ASSERT(hash_a == hash_b);
+    TEST_OK(loci_object_hash(b, LOCI_HASH_IGNORE_XID, 1, &hash_b));
+    TEST_ASSERT(hash_a != hash_b);
+
+    /* Members count */
+    of_flow_add_priority_set(b, 101);
+    TEST_OK(loci_object_hash(b, LOCI_HASH_IGNORE_XID, 0, &hash_b));
+    TEST_ASSERT(hash_a != hash_b);
+    of_object_delete(b);
+
+    /* Padding on the wire doesn't */
+    TEST_OK(loci_object_hash(a, 0, 0, &hash_a));
+    len = a->length;
+    of_object_wire_buffer_steal(a, &buf);
+    TEST_ASSERT(buf != NULL);
+    of_object_delete(a);
+    buf[46] = 0xde;
+    buf[47] = 0xad;
+    b = of_object_new_from_message(OF_BUFFER_TO_MESSAGE(buf), len);
+    TEST_ASSERT(b != NULL);
+    TEST_OK(loci_object_hash(b, 0, 0, &hash_b));
+    TEST_ASSERT(hash_a == hash_b);
+    of_object_delete(b);
+
+    /* Nor does the version */
+    data.data = payload;
+    data.bytes = sizeof(payload);
+    a = of_echo_request_new(OF_VERSION_1_0);
+    b = of_echo_request_new(OF_VERSION_1_3);
+    TEST_ASSERT(a != NULL && b != NULL);
+    of_echo_request_xid_set(a, 9);
+    of_echo_request_xid_set(b, 9);
+    TEST_OK(of_echo_request_data_set(a, &data));
+    TEST_OK(of_echo_request_data_set(b, &data));
+    TEST_OK(loci_object_hash(a, 0, 0, &hash_a));
+    TEST_OK(loci_object_hash(b, 0, 0, &hash_b));
+    TEST_ASSERT(hash_a == hash_b);
+    payload[4] = 6;
+    TEST_OK(of_echo_request_data_set(b, &data));
+    TEST_OK(loci_object_hash(b, 0, 0, &hash_b));
+    TEST_ASSERT(hash_a != hash_b);
+    of_object_delete(a);
+    of_object_delete(b);
+
+    return TEST_PASS;
+}
+
+static int
+hash_compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static int
+test_hash_collisions(void)
+{
+    of_match_t match;
+    uint64_t *hashes;
+    int buckets[COLLISION_BUCKETS];
+    int i, max = 0;
+
+    hashes = MALLOC(COLLISION_MATCHES * sizeof(*hashes));
+    TEST_ASSERT(hashes != NULL);
+    MEMSET(buckets, 0, sizeof(buckets));
+
+    /* Flows differing in a few bits of the addresses and ports */
+    flow_match(&match, OF_VERSION_1_3, 1);
+    match.masks.ipv4_src = 0xffffffff;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(&match);
+    OF_MATCH_MASK_TCP_SRC_EXACT_SET(&match);
+    for (i = 0; i < COLLISION_MATCHES; i++) {
+        match.fields.ipv4_src = 0x0a000000 | (i & 0xff);
+        match.fields.ipv4_dst = 0x0a010000 | ((i >> 8) & 0xf);
+        match.fields.tcp_src = 1024 + (i >> 12);
+        hashes[i] = loci_match_hash(&match, 0);
+        buckets[hashes[i] % COLLISION_BUCKETS]++;
+    }
+
+    qsort(hashes, COLLISION_MATCHES, sizeof(*hashes), hash_compare);
+    for (i = 1; i < COLLISION_MATCHES; i++) {
+        TEST_ASSERT(hashes[i] != hashes[i - 1]);
+    }
+    FREE(hashes);
+
+    /* About 98 a bucket; a fair hash stays well under twice that */
+    for (i = 0; i < COLLISION_BUCKETS; i++) {
+        if (buckets[i] > max) {
+            max = buckets[i];
+        }
+    }
+    TEST_ASSERT(max < 2 * COLLISION_MATCHES / COLLISION_BUCKETS);
+
+    return TEST_PASS;
+}
+
+/* Binary log match fields are numbered as in loci_match_fields */
+static int
+test_hash_field_order(void)
+{
+    int i;
+
+    TEST_ASSERT(loci_binlog_match_field_count == LOCI_MATCH_FIELD_COUNT);
+    for (i = 0; i < LOCI_MATCH_FIELD_COUNT; i++) {
+        TEST_ASSERT(strcmp(loci_binlog_match_field_names[i],
+                           loci_match_fields[i].name) == 0);
+    }
+
+    return TEST_PASS;
+}
+
+int
+run_hash_tests(void)
+{
+    RUN_TEST(hash_bytes);
+    RUN_TEST(hash_match);
+    RUN_TEST(hash_object);
+    RUN_TEST(hash_collisions);
+    RUN_TEST(hash_field_order);
+
+    return TEST_PASS;
+}
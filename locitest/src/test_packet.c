@@ -0,0 +1,318 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test parsing packet headers into a match
+ *
+ * Each header's fields must be set exactly, only for the groups asked
+ * for, and a truncated packet must not be read past its end.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_packet.h>
+
+/* 802.1Q tagged TCP/IPv4, pcp 3 vid 100, dscp 46 */
+static uint8_t tcp4[] = {
+    0x02, 0, 0, 0, 0, 1, 0x02, 0, 0, 0, 0, 2, 0x81, 0x00,
+    0x60, 0x64, 0x08, 0x00,
+    0x45, 0xb8, 0x00, 0x28, 0, 0, 0, 0, 0x40, 0x06, 0, 0,
+    10, 0, 0, 1, 10, 0, 0, 2,
+    0x04, 0xd2, 0x00, 0x50, 0, 0, 0, 0, 0, 0, 0, 0,
+    0x50, 0x02, 0xff, 0xff, 0, 0, 0, 0,
+};
+
+/* IPv6 neighbor solicitation after a hop-by-hop header */
+static uint8_t nd6[] = {
+    0x33, 0x33, 0xff, 0, 0, 2, 0x02, 0, 0, 0, 0, 1, 0x86, 0xdd,
+    0x6e, 0x01, 0x23, 0x45, 0x00, 0x28, 0x00, 0xff,
+    0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0xff, 0, 0, 2,
+    0x3a, 0, 1, 4, 0, 0, 0, 0,
+    135, 0, 0, 0, 0, 0, 0, 0,
+    0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    1, 1, 0x02, 0, 0, 0, 0, 1,
+};
+
+/* ARP request */
+static uint8_t arp[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0, 0, 0, 0, 1, 0x08, 0x06,
+    0x00, 0x01, 0x08, 0x00, 6, 4, 0x00, 0x01,
+    0x02, 0, 0, 0, 0, 1, 10, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 2,
+};
+
+/* MPLS label 16, tc 5, bottom of stack */
+static uint8_t mpls[] = {
+    0x02, 0, 0, 0, 0, 1, 0x02, 0, 0, 0, 0, 2, 0x88, 0x47,
+    0x00, 0x01, 0x0b, 0x40,
+};
+
+static int
+test_packet_ipv4(void)
+{
+    of_match_t match, wire;
+    of_flow_add_t *flow_add;
+    int version;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        TEST_OK(loci_packet_match(version, tcp4, sizeof(tcp4),
+                                  LOCI_PACKET_FIELDS_ALL, &match));
+        TEST_ASSERT(match.version == version);
+        TEST_ASSERT(match.fields.eth_dst.addr[5] == 1);
+        TEST_ASSERT(match.fields.eth_src.addr[5] == 2);
+        TEST_ASSERT(OF_MATCH_MASK_ETH_DST_EXACT_TEST(&match));
+        TEST_ASSERT(OF_MATCH_MASK_ETH_SRC_EXACT_TEST(&match));
+        TEST_ASSERT(match.fields.eth_type == 0x0800);
+        if (version >= OF_VERSION_1_2) {
+            TEST_ASSERT(match.fields.vlan_vid == (0x1000 | 100));
+        } else {
+            TEST_ASSERT(match.fields.vlan_vid == 100);
+        }
+        TEST_ASSERT(match.fields.vlan_pcp == 3);
+        TEST_ASSERT(OF_MATCH_MASK_VLAN_VID_EXACT_TEST(&match));
+        TEST_ASSERT(match.fields.ip_dscp == 46);
+        TEST_ASSERT(match.fields.ip_ecn == 0);
+        TEST_ASSERT(OF_MATCH_MASK_IP_ECN_EXACT_TEST(&match));
+        TEST_ASSERT(match.fields.ip_proto == 6);
+        TEST_ASSERT(match.fields.ipv4_src == 0x0a000001);
+        TEST_ASSERT(match.fields.ipv4_dst == 0x0a000002);
+        TEST_ASSERT(OF_MATCH_MASK_IPV4_DST_EXACT_TEST(&match));
+        TEST_ASSERT(match.fields.tcp_src == 1234);
+        TEST_ASSERT(match.fields.tcp_dst == 80);
+        TEST_ASSERT(OF_MATCH_MASK_TCP_DST_EXACT_TEST(&match));
+        TEST_ASSERT(!OF_MATCH_MASK_UDP_DST_ACTIVE_TEST(&match));
+        TEST_ASSERT(!OF_MATCH_MASK_IN_PORT_ACTIVE_TEST(&match));
+        TEST_ASSERT(!OF_MATCH_MASK_IPV6_SRC_ACTIVE_TEST(&match));
+    }
+
+    /* The match survives a trip through the wire */
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_ASSERT(flow_add != NULL);
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    TEST_OK(of_flow_add_match_get(flow_add, &wire));
+    TEST_ASSERT(of_match_eq(&match, &wire));
+    of_flow_add_delete(flow_add);
+
+    /* Untagged */
+    tcp4[12] = 0x08;
+    tcp4[13] = 0x00;
+    TEST_OK(loci_packet_match(OF_VERSION_1_0, tcp4, sizeof(tcp4) - 4,
+                              LOCI_PACKET_FIELDS_VLAN, &match));
+    TEST_ASSERT(match.fields.vlan_vid == 0xffff);
+    TEST_ASSERT(OF_MATCH_MASK_VLAN_VID_EXACT_TEST(&match));
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4) - 4,
+                              LOCI_PACKET_FIELDS_VLAN, &match));
+    TEST_ASSERT(match.fields.vlan_vid == 0);
+    TEST_ASSERT(OF_MATCH_MASK_VLAN_VID_EXACT_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_VLAN_PCP_ACTIVE_TEST(&match));
+    tcp4[12] = 0x81;
+    tcp4[13] = 0x00;
+
+    return TEST_PASS;
+}
+
+static int
+test_packet_ipv6(void)
+{
+    of_match_t match, wire;
+    of_flow_add_t *flow_add;
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, nd6, sizeof(nd6),
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_ASSERT(match.fields.eth_type == 0x86dd);
+    TEST_ASSERT(match.fields.vlan_vid == 0);
+    TEST_ASSERT(match.fields.ip_dscp == 0x38);
+    TEST_ASSERT(match.fields.ip_ecn == 0);
+    TEST_ASSERT(match.fields.ipv6_flabel == 0x12345);
+    TEST_ASSERT(OF_MATCH_MASK_IPV6_FLABEL_EXACT_TEST(&match));
+    TEST_ASSERT(match.fields.ipv6_src.addr[0] == 0xfe);
+    TEST_ASSERT(match.fields.ipv6_src.addr[15] == 1);
+    TEST_ASSERT(match.fields.ipv6_dst.addr[0] == 0xff);
+    TEST_ASSERT(OF_MATCH_MASK_IPV6_DST_EXACT_TEST(&match));
+    TEST_ASSERT(match.fields.ip_proto == 58);
+    TEST_ASSERT(match.fields.icmpv6_type == 135);
+    TEST_ASSERT(match.fields.icmpv6_code == 0);
+    TEST_ASSERT(OF_MATCH_MASK_ICMPV6_CODE_EXACT_TEST(&match));
+    TEST_ASSERT(match.fields.ipv6_nd_target.addr[15] == 2);
+    TEST_ASSERT(OF_MATCH_MASK_IPV6_ND_TARGET_EXACT_TEST(&match));
+    TEST_ASSERT(match.fields.ipv6_nd_sll.addr[5] == 1);
+    TEST_ASSERT(OF_MATCH_MASK_IPV6_ND_SLL_EXACT_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_IPV6_ND_TLL_ACTIVE_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_IPV4_SRC_ACTIVE_TEST(&match));
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_ASSERT(flow_add != NULL);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    TEST_OK(of_flow_add_match_get(flow_add, &wire));
+    TEST_ASSERT(of_match_eq(&match, &wire));
+    of_flow_add_delete(flow_add);
+
+    /* A later fragment has no ICMPv6 header */
+    nd6[20] = 44;
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, nd6, sizeof(nd6),
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_ASSERT(match.fields.ip_proto == 58);
+    TEST_ASSERT(!OF_MATCH_MASK_ICMPV6_TYPE_ACTIVE_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_IPV6_ND_TARGET_ACTIVE_TEST(&match));
+    nd6[20] = 0;
+
+    return TEST_PASS;
+}
+
+static int
+test_packet_other(void)
+{
+    of_match_t match;
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, arp, sizeof(arp),
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_ASSERT(match.fields.eth_type == 0x0806);
+    TEST_ASSERT(match.fields.arp_op == 1);
+    TEST_ASSERT(match.fields.arp_sha.addr[5] == 1);
+    TEST_ASSERT(match.fields.arp_spa == 0x0a000001);
+    TEST_ASSERT(match.fields.arp_tha.addr[5] == 0);
+    TEST_ASSERT(match.fields.arp_tpa == 0x0a000002);
+    TEST_ASSERT(OF_MATCH_MASK_ARP_THA_EXACT_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_ARP_TPA_EXACT_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_IP_PROTO_ACTIVE_TEST(&match));
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, mpls, sizeof(mpls),
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_ASSERT(match.fields.eth_type == 0x8847);
+    TEST_ASSERT(match.fields.mpls_label == 16);
+    TEST_ASSERT(match.fields.mpls_tc == 5);
+    TEST_ASSERT(match.fields.mpls_bos == 1);
+    TEST_ASSERT(OF_MATCH_MASK_MPLS_LABEL_EXACT_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_MPLS_BOS_EXACT_TEST(&match));
+
+    /* An IPv4 fragment other than the first has no TCP header */
+    tcp4[24] = 0x00;
+    tcp4[25] = 0x10;
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_ASSERT(match.fields.ip_proto == 6);
+    TEST_ASSERT(!OF_MATCH_MASK_TCP_SRC_ACTIVE_TEST(&match));
+    tcp4[25] = 0x00;
+
+    return TEST_PASS;
+}
+
+/* Only the groups asked for, and what they depend on, are set */
+static int
+test_packet_fields(void)
+{
+    of_match_t match, all;
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                              LOCI_PACKET_FIELDS_ALL, &all));
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                              LOCI_PACKET_FIELDS_ETH, &match));
+    TEST_ASSERT(OF_MATCH_MASK_ETH_DST_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_ETH_TYPE_ACTIVE_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_VLAN_VID_ACTIVE_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_IP_PROTO_ACTIVE_TEST(&match));
+    TEST_ASSERT(of_match_more_specific(&all, &match));
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                              LOCI_PACKET_FIELDS_IP, &match));
+    TEST_ASSERT(!OF_MATCH_MASK_ETH_DST_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_ETH_TYPE_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_IPV4_SRC_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_IP_PROTO_ACTIVE_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_TCP_SRC_ACTIVE_TEST(&match));
+    TEST_ASSERT(of_match_more_specific(&all, &match));
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                              LOCI_PACKET_FIELDS_L4, &match));
+    TEST_ASSERT(OF_MATCH_MASK_ETH_TYPE_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_IP_PROTO_ACTIVE_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_IPV4_SRC_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_TCP_SRC_ACTIVE_TEST(&match));
+    TEST_ASSERT(of_match_more_specific(&all, &match));
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, nd6, sizeof(nd6),
+                              LOCI_PACKET_FIELDS_ND, &match));
+    TEST_ASSERT(OF_MATCH_MASK_IP_PROTO_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_ICMPV6_TYPE_ACTIVE_TEST(&match));
+    TEST_ASSERT(!OF_MATCH_MASK_ICMPV6_CODE_ACTIVE_TEST(&match));
+    TEST_ASSERT(OF_MATCH_MASK_IPV6_ND_TARGET_ACTIVE_TEST(&match));
+
+    TEST_OK(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                              0, &match));
+    TEST_ASSERT(!OF_MATCH_MASK_ETH_TYPE_ACTIVE_TEST(&match));
+
+    return TEST_PASS;
+}
+
+/*
+ * Every truncation is parsed from a buffer of exactly its length, so
+ * a read past the end shows up under a memory checker.  The fields of
+ * the complete headers are still set.
+ */
+static int
+test_packet_truncated(void)
+{
+    static struct {
+        uint8_t *pkt;
+        int len;
+    } pkts[] = {
+        { tcp4, sizeof(tcp4) },
+        { nd6, sizeof(nd6) },
+        { arp, sizeof(arp) },
+        { mpls, sizeof(mpls) },
+    };
+    of_match_t match;
+    uint8_t *buf;
+    int i, len, rv;
+
+    for (i = 0; i < (int)(sizeof(pkts) / sizeof(pkts[0])); i++) {
+        for (len = 0; len < pkts[i].len; len++) {
+            buf = MALLOC(len + 1);
+            TEST_ASSERT(buf != NULL);
+            MEMCPY(buf, pkts[i].pkt, len);
+            rv = loci_packet_match(OF_VERSION_1_3, buf, len,
+                                   LOCI_PACKET_FIELDS_ALL, &match);
+            TEST_ASSERT(rv == OF_ERROR_NONE || rv == OF_ERROR_PARSE);
+            if (len < 14) {
+                TEST_ASSERT(rv == OF_ERROR_PARSE);
+            }
+            FREE(buf);
+        }
+    }
+
+    /* Cut in the TCP header: the IP fields are there */
+    TEST_ASSERT(loci_packet_match(OF_VERSION_1_3, tcp4, 40,
+                                  LOCI_PACKET_FIELDS_ALL, &match) ==
+                OF_ERROR_PARSE);
+    TEST_ASSERT(match.fields.ipv4_dst == 0x0a000002);
+    TEST_ASSERT(match.fields.ip_proto == 6);
+    TEST_ASSERT(!OF_MATCH_MASK_TCP_SRC_ACTIVE_TEST(&match));
+
+    /* The IPv4 total length leaves out the Ethernet padding */
+    tcp4[21] = 20;
+    TEST_ASSERT(loci_packet_match(OF_VERSION_1_3, tcp4, sizeof(tcp4),
+                                  LOCI_PACKET_FIELDS_ALL, &match) ==
+                OF_ERROR_PARSE);
+    TEST_ASSERT(match.fields.ip_proto == 6);
+    TEST_ASSERT(!OF_MATCH_MASK_TCP_SRC_ACTIVE_TEST(&match));
+    tcp4[21] = 0x28;
+
+    return TEST_PASS;
+}
+
+int
+run_packet_tests(void)
+{
+    RUN_TEST(packet_ipv4);
+    RUN_TEST(packet_ipv6);
+    RUN_TEST(packet_other);
+    RUN_TEST(packet_fields);
+    RUN_TEST(packet_truncated);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,215 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the match and flow text parser
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_parse.h>
+#include <loci/loci_validator.h>
+
+#define PARSE(str, match, errp) loci_match_parse((str), strlen(str), (match), (errp))
+
+static int
+test_match_parse(void)
+{
+    of_match_t match, expected;
+    const char *str;
+    const char *err;
+
+    str = "in_port=1,eth_type=0x800 ipv4_dst=10.1.2.3/8";
+    TEST_OK(PARSE(str, &match, NULL));
+    memset(&expected, 0, sizeof(expected));
+    expected.fields.in_port = 1;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&expected);
+    expected.fields.eth_type = 0x800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&expected);
+    expected.fields.ipv4_dst = 0x0a000000;
+    expected.masks.ipv4_dst = 0xff000000;
+    TEST_ASSERT(of_match_eq(&match, &expected));
+
+    str = "eth_src=00:11:22:aa:bb:CC/ff:ff:ff:00:00:00,vlan_vid=0x1000/0x1000,"
+        "ipv6_src=2001:db8::1/64,ipv6_dst=::1,arp_spa=1.2.3.4/255.255.0.0,"
+        "metadata=18446744073709551615,in_port=controller";
+    TEST_OK(PARSE(str, &match, NULL));
+    memset(&expected, 0, sizeof(expected));
+    memcpy(expected.fields.eth_src.addr, "\x00\x11\x22\x00\x00\x00", 6);
+    memcpy(expected.masks.eth_src.addr, "\xff\xff\xff\x00\x00\x00", 6);
+    expected.fields.vlan_vid = 0x1000;
+    expected.masks.vlan_vid = 0x1000;
+    expected.fields.ipv6_src.addr[0] = 0x20;
+    expected.fields.ipv6_src.addr[1] = 0x01;
+    expected.fields.ipv6_src.addr[2] = 0x0d;
+    expected.fields.ipv6_src.addr[3] = 0xb8;
+    memset(expected.masks.ipv6_src.addr, 0xff, 8);
+    expected.fields.ipv6_dst.addr[15] = 1;
+    OF_MATCH_MASK_IPV6_DST_EXACT_SET(&expected);
+    expected.fields.arp_spa = 0x01020000;
+    expected.masks.arp_spa = 0xffff0000;
+    expected.fields.metadata = 0xffffffffffffffffULL;
+    OF_MATCH_MASK_METADATA_EXACT_SET(&expected);
+    expected.fields.in_port = OF_PORT_DEST_CONTROLLER;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&expected);
+    TEST_ASSERT(of_match_eq(&match, &expected));
+
+    str = "bsn_in_ports_128=0x10000000000000001";
+    TEST_OK(PARSE(str, &match, NULL));
+    TEST_ASSERT(match.fields.bsn_in_ports_128.hi == 1);
+    TEST_ASSERT(match.fields.bsn_in_ports_128.lo == 1);
+    TEST_ASSERT(OF_MATCH_MASK_BSN_IN_PORTS_128_EXACT_TEST(&match));
+
+    /* Empty match */
+    TEST_OK(PARSE(" ,", &match, NULL));
+    memset(&expected, 0, sizeof(expected));
+    TEST_ASSERT(of_match_eq(&match, &expected));
+
+    /* Errors point at the offending token */
+    str = "in_port=1,ip_proto=256";
+    TEST_ASSERT(PARSE(str, &match, &err) == OF_ERROR_PARSE);
+    TEST_ASSERT(err == str + 10);
+    str = "in_port=1 bogus=1";
+    TEST_ASSERT(PARSE(str, &match, &err) == OF_ERROR_PARSE);
+    TEST_ASSERT(err == str + 10);
+    TEST_ASSERT(PARSE("in_port", &match, NULL) == OF_ERROR_PARSE);
+    TEST_ASSERT(PARSE("ipv4_src=1.2.3", &match, NULL) == OF_ERROR_PARSE);
+    TEST_ASSERT(PARSE("ipv4_src=1.2.3.4/33", &match, NULL) == OF_ERROR_PARSE);
+    TEST_ASSERT(PARSE("ipv6_src=1::2::3", &match, NULL) == OF_ERROR_PARSE);
+    TEST_ASSERT(PARSE("eth_dst=00:11:22:33:44", &match, NULL) == OF_ERROR_PARSE);
+    TEST_ASSERT(PARSE("eth_type=0x", &match, NULL) == OF_ERROR_PARSE);
+
+    return TEST_PASS;
+}
+
+static const char flow_text[] =
+    "table=1,priority=100,in_port=1,eth_type=0x800,ipv4_dst=10.0.0.0/8 "
+    "actions=output:2,output:controller";
+
+static int
+test_flow_parse(void)
+{
+    loci_flow_t flow;
+    const char *str, *err;
+
+    TEST_OK(loci_flow_parse(flow_text, strlen(flow_text), &flow, NULL));
+    TEST_ASSERT(flow.table_id == 1);
+    TEST_ASSERT(flow.priority == 100);
+    TEST_ASSERT(flow.buffer_id == OF_BUFFER_ID_NO_BUFFER);
+    TEST_ASSERT(flow.match.fields.in_port == 1);
+    TEST_ASSERT(flow.match.masks.ipv4_dst == 0xff000000);
+    TEST_ASSERT(flow.goto_table == -1);
+    TEST_ASSERT(flow.action_count == 2);
+    TEST_ASSERT(flow.actions[0].type == LOCI_FLOW_ACTION_OUTPUT);
+    TEST_ASSERT(flow.actions[0].arg == 2);
+    TEST_ASSERT(flow.actions[0].arg16 == 0);
+    TEST_ASSERT(flow.actions[1].arg == OF_PORT_DEST_CONTROLLER);
+    TEST_ASSERT(flow.actions[1].arg16 == 0xffff);
+
+    str = "cookie=0x10/0xff,idle_timeout=5 actions=pop_vlan,goto_table:3";
+    TEST_OK(loci_flow_parse(str, strlen(str), &flow, NULL));
+    TEST_ASSERT(flow.cookie == 0x10 && flow.cookie_mask == 0xff);
+    TEST_ASSERT(flow.idle_timeout == 5);
+    TEST_ASSERT(flow.priority == 0x8000);
+    TEST_ASSERT(flow.action_count == 1);
+    TEST_ASSERT(flow.actions[0].type == LOCI_FLOW_ACTION_POP_VLAN);
+    TEST_ASSERT(flow.goto_table == 3);
+
+    str = "priority=1 actions=output:1,frobnicate";
+    TEST_ASSERT(loci_flow_parse(str, strlen(str), &flow, &err) == OF_ERROR_PARSE);
+    TEST_ASSERT(err == str + 28);
+    str = "priority=65536";
+    TEST_ASSERT(loci_flow_parse(str, strlen(str), &flow, &err) == OF_ERROR_PARSE);
+    TEST_ASSERT(err == str);
+
+    return TEST_PASS;
+}
+
+static int
+test_flow_add_parse(void)
+{
+    of_flow_add_t *obj;
+    of_list_action_t actions;
+    of_list_instruction_t instructions;
+    of_object_t elt;
+    of_match_t match;
+    of_port_no_t port;
+    uint16_t priority;
+    uint8_t table_id;
+    int rv, count;
+
+    /* OF 1.0: no table id, actions directly in the message */
+    obj = loci_flow_add_parse(OF_VERSION_1_0, flow_text, strlen(flow_text), &rv);
+    TEST_ASSERT(obj == NULL && rv == OF_ERROR_COMPAT);
+
+    obj = loci_flow_add_parse(OF_VERSION_1_0, flow_text + 8,
+                              strlen(flow_text) - 8, &rv);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(of_validate_message(OF_OBJECT_TO_MESSAGE(obj), obj->length) == 0);
+    of_flow_add_priority_get(obj, &priority);
+    TEST_ASSERT(priority == 100);
+    TEST_OK(of_flow_add_match_get(obj, &match));
+    TEST_ASSERT(match.fields.in_port == 1);
+    TEST_ASSERT(match.masks.ipv4_dst == 0xff000000);
+    of_flow_add_actions_bind(obj, &actions);
+    count = 0;
+    OF_LIST_ACTION_ITER(&actions, &elt, rv) {
+        TEST_ASSERT(elt.object_id == OF_ACTION_OUTPUT);
+        of_action_output_port_get(&elt, &port);
+        TEST_ASSERT(port == (count == 0 ? 2 : OF_PORT_DEST_CONTROLLER));
+        count++;
+    }
+    TEST_ASSERT(count == 2);
+    of_flow_add_delete(obj);
+
+    /* OF 1.3: actions in an apply_actions instruction */
+    obj = loci_flow_add_parse(OF_VERSION_1_3, flow_text, strlen(flow_text), &rv);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(of_validate_message(OF_OBJECT_TO_MESSAGE(obj), obj->length) == 0);
+    of_flow_add_table_id_get(obj, &table_id);
+    TEST_ASSERT(table_id == 1);
+    TEST_OK(of_flow_add_match_get(obj, &match));
+    TEST_ASSERT(match.fields.eth_type == 0x800);
+    of_flow_add_instructions_bind(obj, &instructions);
+    TEST_OK(of_list_instruction_first(&instructions, &elt));
+    TEST_ASSERT(elt.object_id == OF_INSTRUCTION_APPLY_ACTIONS);
+    of_instruction_apply_actions_actions_bind(&elt, &actions);
+    TEST_OK(of_list_action_first(&actions, &elt));
+    of_action_output_port_get(&elt, &port);
+    TEST_ASSERT(port == 2);
+    TEST_OK(of_list_action_next(&actions, &elt));
+    TEST_ASSERT(of_list_action_next(&actions, &elt) == OF_ERROR_RANGE);
+    of_flow_add_delete(obj);
+
+    /* Instructions and actions missing from OF 1.0 */
+    obj = loci_flow_add_parse(OF_VERSION_1_0, "actions=group:1", 15, &rv);
+    TEST_ASSERT(obj == NULL && rv == OF_ERROR_COMPAT);
+    obj = loci_flow_add_parse(OF_VERSION_1_0, "actions=goto_table:1", 20, &rv);
+    TEST_ASSERT(obj == NULL && rv == OF_ERROR_COMPAT);
+
+    obj = loci_flow_add_parse(OF_VERSION_1_3, "actions=goto_table:1", 20, &rv);
+    TEST_ASSERT(obj != NULL);
+    of_flow_add_instructions_bind(obj, &instructions);
+    TEST_OK(of_list_instruction_first(&instructions, &elt));
+    TEST_ASSERT(elt.object_id == OF_INSTRUCTION_GOTO_TABLE);
+    of_instruction_goto_table_table_id_get(&elt, &table_id);
+    TEST_ASSERT(table_id == 1);
+    of_flow_add_delete(obj);
+
+    /* Fields the version can't match on */
+    obj = loci_flow_add_parse(OF_VERSION_1_0, "ipv6_src=::1", 12, &rv);
+    TEST_ASSERT(obj == NULL && rv == OF_ERROR_COMPAT);
+
+    return TEST_PASS;
+}
+
+int
+run_parse_tests(void)
+{
+    RUN_TEST(match_parse);
+    RUN_TEST(flow_parse);
+    RUN_TEST(flow_add_parse);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,441 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the BSN PDU scheduler
+ *
+ * On a simulated clock, every slot must fire on exactly the ticks its
+ * interval puts it on, however the clock is advanced and whichever
+ * levels of the wheel its timer passes through, and the rx_timeout
+ * messages written must parse as the generated class.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_pdu_sched.h>
+
+#define TX_SLOTS 256
+
+/* What the send function saw */
+struct tx_log {
+    loci_pdu_sched_t *sched;
+    uint64_t start;
+    uint32_t interval[TX_SLOTS];
+    int sent[TX_SLOTS];
+    /* Sends on a tick the slot wasn't due, or with the wrong PDU */
+    int bad;
+    /* Slot whose sends fail, or -1 */
+    int fail_slot;
+};
+
+struct flush_buf {
+    uint8_t data[4096];
+    int len;
+    int flushes;
+};
+
+static int
+tx_record(void *cookie, of_port_no_t port_no, uint8_t slot_num,
+          const uint8_t *data, int len)
+{
+    struct tx_log *log = cookie;
+    uint64_t ticks = log->sched->now - log->start;
+
+    if (ticks == 0 || (ticks - 1) % log->interval[slot_num] != 0 ||
+        len != 1 || data[0] != slot_num) {
+        log->bad++;
+    }
+    log->sent[slot_num]++;
+
+    return slot_num == log->fail_slot ? OF_ERROR_RESOURCE : OF_ERROR_NONE;
+}
+
+static int
+flush_append(void *cookie, const uint8_t *data, int len)
+{
+    struct flush_buf *fb = cookie;
+
+    if (fb->len + len > (int)sizeof(fb->data)) {
+        return OF_ERROR_RESOURCE;
+    }
+    memcpy(fb->data + fb->len, data, len);
+    fb->len += len;
+    fb->flushes++;
+    return OF_ERROR_NONE;
+}
+
+/* Sends of a tx slot started at 0 by time t: on 1, 1 + interval, ... */
+static int
+tx_expected(uint32_t interval, uint64_t t)
+{
+    return t == 0 ? 0 : (t - 1) / interval + 1;
+}
+
+static int
+tx_check(struct tx_log *log, int slots)
+{
+    uint64_t t = log->sched->now - log->start;
+    int i;
+
+    TEST_ASSERT(log->bad == 0);
+    for (i = 0; i < slots; i++) {
+        TEST_ASSERT(log->sent[i] == tx_expected(log->interval[i], t));
+    }
+
+    return TEST_PASS;
+}
+
+static of_object_t *
+tx_request_new(of_version_t version, of_port_no_t port_no, uint8_t slot_num,
+               uint32_t interval_ms)
+{
+    of_object_t *req = of_bsn_pdu_tx_request_new(version);
+    of_octets_t data = { &slot_num, 1 };
+
+    if (req == NULL) {
+        return NULL;
+    }
+    of_bsn_pdu_tx_request_tx_interval_ms_set(req, interval_ms);
+    of_bsn_pdu_tx_request_port_no_set(req, port_no);
+    of_bsn_pdu_tx_request_slot_num_set(req, slot_num);
+    if (of_bsn_pdu_tx_request_data_set(req, &data) < 0) {
+        of_object_delete(req);
+        return NULL;
+    }
+
+    return req;
+}
+
+static of_object_t *
+rx_request_new(of_version_t version, of_port_no_t port_no, uint8_t slot_num,
+               uint32_t timeout_ms)
+{
+    of_object_t *req = of_bsn_pdu_rx_request_new(version);
+
+    if (req == NULL) {
+        return NULL;
+    }
+    of_bsn_pdu_rx_request_timeout_ms_set(req, timeout_ms);
+    of_bsn_pdu_rx_request_port_no_set(req, port_no);
+    of_bsn_pdu_rx_request_slot_num_set(req, slot_num);
+
+    return req;
+}
+
+static int
+apply(loci_pdu_sched_t *sched, of_object_t *req)
+{
+    int rv;
+
+    TEST_ASSERT(req != NULL);
+    rv = loci_pdu_sched_apply(sched, req);
+    of_object_delete(req);
+
+    return rv;
+}
+
+/* Parse the rx_timeout at buf and check its port and slot */
+static int
+timeout_check(const uint8_t *buf, int len, of_version_t version,
+              of_port_no_t port_no, uint8_t slot_num)
+{
+    of_object_t *obj;
+    of_port_no_t got_port_no;
+    uint8_t *copy, got_slot_num;
+
+    TEST_ASSERT(len >= OF_MESSAGE_HEADER_LENGTH);
+    len = of_message_length_get(OF_BUFFER_TO_MESSAGE((uint8_t *)buf));
+    TEST_ASSERT((copy = MALLOC(len)) != NULL);
+    MEMCPY(copy, buf, len);
+    obj = of_object_new_from_message(OF_BUFFER_TO_MESSAGE(copy), len);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
+    TEST_ASSERT(obj->version == version);
+    of_bsn_pdu_rx_timeout_port_no_get(obj, &got_port_no);
+    of_bsn_pdu_rx_timeout_slot_num_get(obj, &got_slot_num);
+    of_object_delete(obj);
+    TEST_ASSERT(got_port_no == port_no);
+    TEST_ASSERT(got_slot_num == slot_num);
+
+    return len;
+}
+
+static int
+test_pdu_sched_tx(void)
+{
+    static const uint32_t intervals[] = { 1, 7, 255, 256, 300, 70000 };
+    loci_pdu_sched_t sched;
+    loci_stream_t timeouts;
+    uint8_t buf[LOCI_STREAM_MIN_SIZE];
+    struct tx_log log;
+    uint64_t t;
+    int i, n = sizeof(intervals) / sizeof(intervals[0]);
+    int fired = 0, rv;
+
+    /* Start off a level boundary so the first moves down are partial */
+    TEST_OK(loci_pdu_sched_init(&sched, OF_VERSION_1_3, 0x1234567fe));
+    loci_stream_init(&timeouts, buf, sizeof(buf), NULL, NULL);
+    MEMSET(&log, 0, sizeof(log));
+    log.sched = &sched;
+    log.start = sched.now;
+    log.fail_slot = -1;
+    for (i = 0; i < n; i++) {
+        log.interval[i] = intervals[i];
+        TEST_OK(apply(&sched, tx_request_new(OF_VERSION_1_3, 7, i,
+                                             intervals[i])));
+    }
+    TEST_ASSERT(sched.count == n);
+
+    /* A tick at a time, then in uneven steps */
+    for (t = 1; t <= 1000; t++) {
+        rv = loci_pdu_sched_advance(&sched, log.start + t, tx_record, &log,
+                                    &timeouts);
+        TEST_ASSERT(rv >= 0);
+        fired += rv;
+        TEST_ASSERT(tx_check(&log, n) == TEST_PASS);
+    }
+    for (; t <= 300000; t += 997) {
+        rv = loci_pdu_sched_advance(&sched, log.start + t, tx_record, &log,
+                                    &timeouts);
+        TEST_ASSERT(rv >= 0);
+        fired += rv;
+        TEST_ASSERT(tx_check(&log, n) == TEST_PASS);
+    }
+    for (i = 0; i < n; i++) {
+        fired -= log.sent[i];
+    }
+    TEST_ASSERT(fired == 0);
+
+    /* The clock doesn't go back */
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, log.start, tx_record, &log,
+                                       &timeouts) == 0);
+    TEST_ASSERT(tx_check(&log, n) == TEST_PASS);
+
+    /* Failed sends are counted, and the slot keeps sending */
+    log.fail_slot = 1;
+    t = sched.now - log.start;
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, sched.now + 70, tx_record, &log,
+                                       &timeouts) > 0);
+    TEST_ASSERT(tx_check(&log, n) == TEST_PASS);
+    TEST_ASSERT(sched.tx_errors == (uint64_t)(log.sent[1] -
+                                              tx_expected(7, t)));
+    TEST_ASSERT(sched.tx_errors == 10);
+
+    TEST_ASSERT(LOCI_STREAM_LENGTH(&timeouts) == 0);
+    loci_pdu_sched_cleanup(&sched);
+
+    return TEST_PASS;
+}
+
+/* Timers that move down every level, on big jumps of the clock */
+static int
+test_pdu_sched_cascade(void)
+{
+    static const uint32_t intervals[] = {
+        65535, 65536, 65537, 16777215, 16777216, 16777217, 0xffffffff,
+    };
+    loci_pdu_sched_t sched;
+    loci_stream_t timeouts;
+    uint8_t buf[LOCI_STREAM_MIN_SIZE];
+    struct tx_log log;
+    uint64_t t, step;
+    uint8_t pdu;
+    int i, n = sizeof(intervals) / sizeof(intervals[0]);
+
+    TEST_OK(loci_pdu_sched_init(&sched, OF_VERSION_1_3, 0xfedcba98765));
+    loci_stream_init(&timeouts, buf, sizeof(buf), NULL, NULL);
+    MEMSET(&log, 0, sizeof(log));
+    log.sched = &sched;
+    log.start = sched.now;
+    log.fail_slot = -1;
+    for (i = 0; i < n; i++) {
+        log.interval[i] = intervals[i];
+        pdu = i;
+        TEST_OK(loci_pdu_sched_add(&sched, LOCI_PDU_TX, 9, i, intervals[i],
+                                   &pdu, 1));
+    }
+
+    /* Steps of every size, some ending just before or on a send */
+    for (t = 0, step = 1; t < 60000000; step = step * 3 + 1) {
+        t += step % 20000000;
+        TEST_ASSERT(loci_pdu_sched_advance(&sched, log.start + t, tx_record,
+                                           &log, &timeouts) >= 0);
+        TEST_ASSERT(tx_check(&log, n) == TEST_PASS);
+        TEST_ASSERT(loci_pdu_sched_advance(&sched, log.start + t + 1,
+                                           tx_record, &log, &timeouts) >= 0);
+        TEST_ASSERT(tx_check(&log, n) == TEST_PASS);
+        t++;
+    }
+
+    /* Without the short timers, up to and past the longest interval */
+    for (i = 0; i < n - 1; i++) {
+        TEST_OK(loci_pdu_sched_delete(&sched, LOCI_PDU_TX, 9, i));
+        log.sent[i] = 0;
+        log.interval[i] = 0xffffffff;
+    }
+    t = 0xffffffffULL;
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, log.start + t, tx_record, &log,
+                                       &timeouts) == 0);
+    TEST_ASSERT(log.sent[n - 1] == 1);
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, log.start + t + 1, tx_record,
+                                       &log, &timeouts) == 1);
+    TEST_ASSERT(log.sent[n - 1] == 2);
+    TEST_ASSERT(log.bad == 0);
+
+    loci_pdu_sched_cleanup(&sched);
+
+    return TEST_PASS;
+}
+
+static int
+pdu_sched_rx_version(of_version_t version)
+{
+    loci_pdu_sched_t sched;
+    loci_stream_t timeouts;
+    uint8_t buf[LOCI_STREAM_MIN_SIZE];
+    struct flush_buf fb;
+    of_port_no_t local = OF_PORT_DEST_LOCAL_BY_VERSION(version);
+    /* Slots time out in no order within a tick */
+    int slot_offset = version == OF_VERSION_1_0 ? 18 : 20;
+    uint8_t *first, *second;
+    uint32_t xid;
+    int len;
+
+    TEST_OK(loci_pdu_sched_init(&sched, version, 1000));
+    MEMSET(&fb, 0, sizeof(fb));
+    loci_stream_init(&timeouts, buf, sizeof(buf), flush_append, &fb);
+
+    TEST_OK(apply(&sched, rx_request_new(version, 1, 0, 100)));
+    TEST_OK(apply(&sched, rx_request_new(version, local, 2, 250)));
+    TEST_ASSERT(loci_pdu_sched_rx(&sched, 1, 1) == OF_ERROR_RANGE);
+    TEST_ASSERT(loci_pdu_sched_rx(&sched, 2, 0) == OF_ERROR_RANGE);
+
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, 1099, NULL, NULL,
+                                       &timeouts) == 0);
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, 1100, NULL, NULL,
+                                       &timeouts) == 1);
+    TEST_ASSERT(loci_stream_finish(&timeouts) > 0);
+    TEST_ASSERT((len = timeout_check(fb.data, fb.len, version, 1, 0)) > 0);
+    TEST_ASSERT(len == fb.len);
+    xid = of_message_xid_get(OF_BUFFER_TO_MESSAGE(fb.data));
+
+    /* A PDU received puts the timeout off; both time out together */
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, 1150, NULL, NULL,
+                                       &timeouts) == 0);
+    TEST_OK(loci_pdu_sched_rx(&sched, 1, 0));
+    fb.len = fb.flushes = 0;
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, 1249, NULL, NULL,
+                                       &timeouts) == 0);
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, 1250, NULL, NULL,
+                                       &timeouts) == 2);
+    TEST_ASSERT(fb.flushes == 0);
+    loci_stream_finish(&timeouts);
+    TEST_ASSERT(fb.flushes == 1);
+    TEST_ASSERT(fb.len == 2 * len);
+    first = fb.data + (fb.data[slot_offset] == 2 ? 0 : len);
+    second = fb.data + (fb.data[slot_offset] == 2 ? len : 0);
+    TEST_ASSERT(timeout_check(first, len, version, local, 2) == len);
+    TEST_ASSERT(timeout_check(second, len, version, 1, 0) == len);
+    TEST_ASSERT(of_message_xid_get(OF_BUFFER_TO_MESSAGE(fb.data)) != xid);
+
+    /* Timeouts repeat until a PDU is received; a timeout of 0 stops */
+    fb.len = 0;
+    TEST_OK(apply(&sched, rx_request_new(version, local, 2, 0)));
+    TEST_ASSERT(loci_pdu_sched_lookup(&sched, LOCI_PDU_RX, local, 2) == NULL);
+    TEST_ASSERT(loci_pdu_sched_advance(&sched, 2250, NULL, NULL,
+                                       &timeouts) == 10);
+    loci_stream_finish(&timeouts);
+    TEST_ASSERT(fb.len == 10 * len);
+    TEST_ASSERT(sched.count == 1);
+
+    loci_pdu_sched_cleanup(&sched);
+
+    return TEST_PASS;
+}
+
+static int
+test_pdu_sched_rx(void)
+{
+    TEST_ASSERT(pdu_sched_rx_version(OF_VERSION_1_0) == TEST_PASS);
+    TEST_ASSERT(pdu_sched_rx_version(OF_VERSION_1_3) == TEST_PASS);
+
+    return TEST_PASS;
+}
+
+static int
+test_pdu_sched_slots(void)
+{
+    loci_pdu_sched_t sched;
+    loci_pdu_timer_t *timer;
+    of_object_t *msg;
+    uint8_t pdu[300];
+    int port, slot;
+
+    TEST_ASSERT(loci_pdu_sched_init(&sched, 0, 0) == OF_ERROR_VERSION);
+    TEST_OK(loci_pdu_sched_init(&sched, OF_VERSION_1_4, 0));
+
+    msg = of_echo_request_new(OF_VERSION_1_4);
+    TEST_ASSERT(apply(&sched, msg) == OF_ERROR_COMPAT);
+    TEST_ASSERT(loci_pdu_sched_add(&sched, 2, 1, 0, 10, NULL,
+                                   0) == OF_ERROR_PARAM);
+    TEST_ASSERT(loci_pdu_sched_add(&sched, LOCI_PDU_TX, 1, 0, 0, NULL,
+                                   0) == OF_ERROR_PARAM);
+    TEST_ASSERT(loci_pdu_sched_delete(&sched, LOCI_PDU_TX, 1,
+                                      0) == OF_ERROR_RANGE);
+
+    /* Enough slots to grow the index; tx and rx are separate */
+    for (port = 1; port <= 16; port++) {
+        for (slot = 0; slot < 32; slot++) {
+            TEST_OK(loci_pdu_sched_add(&sched, LOCI_PDU_TX, port, slot,
+                                       port, NULL, 0));
+            TEST_OK(loci_pdu_sched_add(&sched, LOCI_PDU_RX, port, slot,
+                                       slot + 1, NULL, 0));
+        }
+    }
+    TEST_ASSERT(sched.count == 1024);
+    TEST_ASSERT(sched.n_slots >= 1024);
+    for (port = 1; port <= 16; port++) {
+        for (slot = 0; slot < 32; slot++) {
+            timer = loci_pdu_sched_lookup(&sched, LOCI_PDU_RX, port, slot);
+            TEST_ASSERT(timer != NULL);
+            TEST_ASSERT(timer->interval_ms == (uint32_t)slot + 1);
+        }
+    }
+    TEST_ASSERT(loci_pdu_sched_lookup(&sched, LOCI_PDU_RX, 17, 0) == NULL);
+
+    /* Restarting a slot takes the new interval and PDU */
+    memset(pdu, 0xab, sizeof(pdu));
+    TEST_OK(loci_pdu_sched_add(&sched, LOCI_PDU_TX, 3, 4, 500, pdu,
+                               sizeof(pdu)));
+    TEST_OK(loci_pdu_sched_add(&sched, LOCI_PDU_TX, 3, 4, 600, pdu, 10));
+    timer = loci_pdu_sched_lookup(&sched, LOCI_PDU_TX, 3, 4);
+    TEST_ASSERT(timer != NULL && timer->interval_ms == 600);
+    TEST_ASSERT(timer->data_len == 10 && timer->data[9] == 0xab);
+    TEST_ASSERT(sched.count == 1024);
+
+    for (port = 1; port <= 16; port++) {
+        for (slot = 0; slot < 32; slot++) {
+            TEST_OK(loci_pdu_sched_delete(&sched, LOCI_PDU_TX, port, slot));
+            TEST_OK(apply(&sched, tx_request_new(OF_VERSION_1_4, port, slot,
+                                                 0)));
+        }
+    }
+    TEST_ASSERT(sched.count == 512);
+    TEST_ASSERT(sched.level_count[0] == 512);
+
+    loci_pdu_sched_cleanup(&sched);
+
+    return TEST_PASS;
+}
+
+int
+run_pdu_sched_tests(void)
+{
+    RUN_TEST(pdu_sched_tx);
+    RUN_TEST(pdu_sched_cascade);
+    RUN_TEST(pdu_sched_rx);
+    RUN_TEST(pdu_sched_slots);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,225 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test peeking at messages
+ *
+ * The fields peeked at must be those the accessors get from the
+ * object, and truncated or malformed messages must be refused.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_peek.h>
+
+static of_packet_in_t *
+packet_in_build(of_version_t version)
+{
+    static uint8_t data[60] = { 0x02, 0, 0, 0, 0, 1, 0x02, 0, 0, 0, 0, 2 };
+    of_packet_in_t *obj;
+    of_octets_t octets = { data, sizeof(data) };
+    of_match_t match;
+
+    obj = of_packet_in_new(version);
+    of_packet_in_xid_set(obj, 0x12345678);
+    of_packet_in_buffer_id_set(obj, 0xabcdef01);
+    of_packet_in_total_len_set(obj, sizeof(data));
+    of_packet_in_reason_set(obj, OF_PACKET_IN_REASON_ACTION);
+    if (version >= OF_VERSION_1_1) {
+        of_packet_in_table_id_set(obj, 7);
+    }
+    if (version >= OF_VERSION_1_3) {
+        of_packet_in_cookie_set(obj, 0x0102030405060708ULL);
+    }
+    if (version <= OF_VERSION_1_1) {
+        of_packet_in_in_port_set(obj, 42);
+    } else {
+        MEMSET(&match, 0, sizeof(match));
+        match.version = version;
+        match.fields.in_port = 42;
+        OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+        match.fields.metadata = 0x1122334455667788ULL;
+        OF_MATCH_MASK_METADATA_EXACT_SET(&match);
+        match.fields.eth_type = 0x88cc;
+        OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+        if (of_packet_in_match_set(obj, &match) < 0) {
+            of_packet_in_delete(obj);
+            return NULL;
+        }
+    }
+    if (of_packet_in_data_set(obj, &octets) < 0) {
+        of_packet_in_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static int
+test_peek_packet_in(void)
+{
+    of_packet_in_t *obj;
+    loci_packet_in_t pi;
+    of_octets_t data;
+    of_match_t match;
+    uint8_t *buf;
+    uint32_t buffer_id;
+    uint16_t total_len;
+    uint8_t reason, table_id;
+    uint64_t cookie;
+    of_port_no_t in_port;
+    int version;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        obj = packet_in_build(version);
+        TEST_ASSERT(obj != NULL);
+        buf = OF_OBJECT_TO_MESSAGE(obj);
+
+        TEST_OK(loci_packet_in_peek(buf, obj->length, &pi));
+        TEST_ASSERT(pi.version == version);
+        TEST_ASSERT(pi.xid == 0x12345678);
+        of_packet_in_buffer_id_get(obj, &buffer_id);
+        TEST_ASSERT(pi.buffer_id == buffer_id);
+        of_packet_in_total_len_get(obj, &total_len);
+        TEST_ASSERT(pi.total_len == total_len);
+        of_packet_in_reason_get(obj, &reason);
+        TEST_ASSERT(pi.reason == reason);
+        if (version >= OF_VERSION_1_1) {
+            of_packet_in_table_id_get(obj, &table_id);
+            TEST_ASSERT(pi.table_id == table_id);
+        } else {
+            TEST_ASSERT(pi.table_id == 0);
+        }
+        if (version >= OF_VERSION_1_3) {
+            of_packet_in_cookie_get(obj, &cookie);
+            TEST_ASSERT(pi.cookie == cookie);
+        } else {
+            TEST_ASSERT(pi.cookie == 0);
+        }
+        if (version <= OF_VERSION_1_1) {
+            of_packet_in_in_port_get(obj, &in_port);
+        } else {
+            TEST_OK(of_packet_in_match_get(obj, &match));
+            in_port = match.fields.in_port;
+        }
+        TEST_ASSERT(pi.in_port == in_port);
+        TEST_ASSERT(pi.in_port == 42);
+        of_packet_in_data_get(obj, &data);
+        TEST_ASSERT(pi.data == data.data);
+        TEST_ASSERT(pi.data_len == data.bytes);
+
+        of_packet_in_delete(obj);
+    }
+
+    return TEST_PASS;
+}
+
+/* Every truncation of a packet_in is refused */
+static int
+test_peek_packet_in_truncated(void)
+{
+    of_packet_in_t *obj;
+    loci_packet_in_t pi;
+    uint8_t *buf;
+    int version, len, data_offset;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        obj = packet_in_build(version);
+        TEST_ASSERT(obj != NULL);
+        buf = OF_OBJECT_TO_MESSAGE(obj);
+        TEST_OK(loci_packet_in_peek(buf, obj->length, &pi));
+        data_offset = pi.data - buf;
+
+        /* Shorter than the header length */
+        for (len = 0; len < obj->length; len++) {
+            TEST_ASSERT(loci_packet_in_peek(buf, len, &pi) < 0);
+        }
+        /* Header length shorter than the fixed part and match */
+        for (len = OF_MESSAGE_HEADER_LENGTH; len < data_offset; len++) {
+            of_message_length_set(buf, len);
+            TEST_ASSERT(loci_packet_in_peek(buf, obj->length, &pi) < 0);
+        }
+        /* Header length within the data */
+        of_message_length_set(buf, data_offset + 1);
+        TEST_OK(loci_packet_in_peek(buf, obj->length, &pi));
+        TEST_ASSERT(pi.data_len == 1);
+
+        of_packet_in_delete(obj);
+    }
+
+    return TEST_PASS;
+}
+
+/* An OpenFlow 1.3 packet_in with the given OXMs and 4 bytes of data */
+static int
+packet_in_raw(uint8_t *buf, const uint8_t *oxms, int oxm_len)
+{
+    int match_len = 4 + oxm_len;
+    int len = 24 + OF_MATCH_BYTES(match_len) + 2 + 4;
+
+    MEMSET(buf, 0, len);
+    buf[0] = OF_VERSION_1_3;
+    buf[1] = 10;
+    of_message_length_set(buf, len);
+    buf_u16_set(buf + 24, OF_MATCH_TYPE_OXM);
+    buf_u16_set(buf + 26, match_len);
+    MEMCPY(buf + 28, oxms, oxm_len);
+
+    return len;
+}
+
+static int
+test_peek_packet_in_oxm(void)
+{
+    static const uint8_t after[] = {
+        0x80, 0x00, 0x0a, 0x02, 0x08, 0x00,             /* eth_type */
+        0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, /* in_port */
+    };
+    static const uint8_t none[] = {
+        0x80, 0x00, 0x0a, 0x02, 0x08, 0x00,             /* eth_type */
+    };
+    static const uint8_t overrun[] = {
+        0x80, 0x00, 0x0a, 0x06, 0x08, 0x00,             /* eth_type */
+    };
+    loci_packet_in_t pi;
+    uint8_t buf[128];
+    int len;
+
+    len = packet_in_raw(buf, after, sizeof(after));
+    TEST_OK(loci_packet_in_peek(buf, len, &pi));
+    TEST_ASSERT(pi.in_port == 5);
+    TEST_ASSERT(pi.data_len == 4);
+
+    len = packet_in_raw(buf, none, sizeof(none));
+    TEST_OK(loci_packet_in_peek(buf, len, &pi));
+    TEST_ASSERT(pi.in_port == 0);
+
+    len = packet_in_raw(buf, overrun, sizeof(overrun));
+    TEST_ASSERT(loci_packet_in_peek(buf, len, &pi) == OF_ERROR_PARSE);
+
+    /* Not an OXM match */
+    len = packet_in_raw(buf, after, sizeof(after));
+    buf_u16_set(buf + 24, 0);
+    TEST_ASSERT(loci_packet_in_peek(buf, len, &pi) == OF_ERROR_PARSE);
+
+    /* Not a packet_in */
+    len = packet_in_raw(buf, after, sizeof(after));
+    buf[1] = 13;
+    TEST_ASSERT(loci_packet_in_peek(buf, len, &pi) == OF_ERROR_PARSE);
+    buf[1] = 10;
+    buf[0] = 0x7f;
+    TEST_ASSERT(loci_packet_in_peek(buf, len, &pi) == OF_ERROR_VERSION);
+
+    return TEST_PASS;
+}
+
+int
+run_peek_tests(void)
+{
+    RUN_TEST(peek_packet_in);
+    RUN_TEST(peek_packet_in_truncated);
+    RUN_TEST(peek_packet_in_oxm);
+
+    return TEST_PASS;
+}
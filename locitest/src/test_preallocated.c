@@ -0,0 +1,316 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test building objects in caller provided buffers
+ *
+ * An object made by of_object_new_preallocated must have the bytes of
+ * the same object made by its new function, and setters that need more
+ * room than the buffer has must fail without changing the object.
+ */
+
+#include <locitest/test_common.h>
+
+static const struct {
+    of_object_id_t object_id;
+    of_object_t *(*new)(of_version_t version);
+} classes[] = {
+    { OF_HELLO, of_hello_new },
+    { OF_ECHO_REQUEST, of_echo_request_new },
+    { OF_FLOW_ADD, of_flow_add_new },
+    { OF_FLOW_DELETE_STRICT, of_flow_delete_strict_new },
+    { OF_FLOW_REMOVED, of_flow_removed_new },
+    { OF_FLOW_STATS_REQUEST, of_flow_stats_request_new },
+    { OF_FLOW_STATS_ENTRY, of_flow_stats_entry_new },
+    { OF_AGGREGATE_STATS_REQUEST, of_aggregate_stats_request_new },
+    { OF_PACKET_IN, of_packet_in_new },
+    { OF_PACKET_OUT, of_packet_out_new },
+    { OF_PORT_STATUS, of_port_status_new },
+    { OF_ACTION_OUTPUT, of_action_output_new },
+    { OF_BSN_GENTABLE_ENTRY_ADD, of_bsn_gentable_entry_add_new },
+};
+
+/* Same bytes as the object from the new function */
+static int
+test_preallocated_new(void)
+{
+    of_object_storage_t storage;
+    of_object_t *obj, *expect;
+    uint8_t buf[1024];
+    int i, version;
+
+    for (i = 0; i < (int)(sizeof(classes) / sizeof(classes[0])); i++) {
+        for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+            if (of_object_fixed_len[version][classes[i].object_id] < 0) {
+                TEST_ASSERT(of_object_new_preallocated(
+                                &storage, classes[i].object_id, version,
+                                buf, sizeof(buf)) == NULL);
+                continue;
+            }
+            MEMSET(buf, 0xa5, sizeof(buf));
+            obj = of_object_new_preallocated(&storage, classes[i].object_id,
+                                             version, buf, sizeof(buf));
+            TEST_ASSERT(obj != NULL);
+            TEST_ASSERT(obj->object_id == classes[i].object_id);
+            TEST_ASSERT(obj->version == version);
+            TEST_ASSERT(OF_OBJECT_TO_MESSAGE(obj) == buf);
+
+            expect = classes[i].new(version);
+            TEST_ASSERT(expect != NULL);
+            TEST_ASSERT(obj->length == expect->length);
+            TEST_ASSERT(obj->wbuf->current_bytes == expect->length);
+            TEST_ASSERT(memcmp(buf, OF_OBJECT_TO_MESSAGE(expect),
+                               expect->length) == 0);
+            of_object_delete(expect);
+        }
+    }
+
+    /* No room for the fixed part */
+    TEST_ASSERT(of_object_new_preallocated(&storage, OF_FLOW_ADD,
+                                           OF_VERSION_1_3, buf, 55) == NULL);
+    TEST_ASSERT(of_object_new_preallocated(&storage, OF_FLOW_ADD,
+                                           OF_VERSION_1_3, buf, 56) != NULL);
+    TEST_ASSERT(of_object_new_preallocated(&storage, OF_OBJECT_INVALID,
+                                           OF_VERSION_1_3, buf, 56) == NULL);
+
+    return TEST_PASS;
+}
+
+static void
+flow_match_init(of_match_t *match, of_version_t version)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = version;
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.ipv4_dst = 0x0a000001;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    match->fields.tcp_dst = 80;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+}
+
+/* A flow_add with a match and one output; returns the setters' result */
+static int
+flow_add_build(of_flow_add_t *obj)
+{
+    of_list_instruction_t instructions;
+    of_instruction_apply_actions_t apply;
+    of_list_action_t actions;
+    of_action_output_t output;
+    of_match_t match;
+    of_version_t version = obj->version;
+    int rv;
+
+    of_flow_add_xid_set(obj, 12345);
+    of_flow_add_cookie_set(obj, 0x0102030405060708ULL);
+    of_flow_add_priority_set(obj, 1000);
+    flow_match_init(&match, version);
+    if ((rv = of_flow_add_match_set(obj, &match)) < 0) {
+        return rv;
+    }
+
+    if (version == OF_VERSION_1_0) {
+        of_flow_add_actions_bind(obj, &actions);
+    } else {
+        of_flow_add_instructions_bind(obj, &instructions);
+        of_instruction_apply_actions_init(&apply, version, -1, 1);
+        if ((rv = of_list_instruction_append_bind(&instructions,
+                                                  &apply)) < 0) {
+            return rv;
+        }
+        of_instruction_apply_actions_actions_bind(&apply, &actions);
+    }
+    of_action_output_init(&output, version, -1, 1);
+    if ((rv = of_list_action_append_bind(&actions, &output)) < 0) {
+        return rv;
+    }
+    of_action_output_port_set(&output, 3);
+
+    return OF_ERROR_NONE;
+}
+
+/* Built in place, the message is the one built in a new object */
+static int
+test_preallocated_flow_add(void)
+{
+    of_object_storage_t storage;
+    of_flow_add_t *obj, *expect;
+    of_object_t *parsed;
+    uint8_t buf[256];
+    int version;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        if (version == OF_VERSION_1_1) {
+            /* The 1.1 wire match can't wildcard the fields left out */
+            continue;
+        }
+        obj = of_object_new_preallocated(&storage, OF_FLOW_ADD, version,
+                                         buf, sizeof(buf));
+        TEST_ASSERT(obj != NULL);
+        TEST_OK(flow_add_build(obj));
+
+        expect = of_flow_add_new(version);
+        TEST_OK(flow_add_build(expect));
+        TEST_ASSERT(obj->length == expect->length);
+        TEST_ASSERT(memcmp(buf, OF_OBJECT_TO_MESSAGE(expect),
+                           expect->length) == 0);
+        of_flow_add_delete(expect);
+
+        parsed = of_object_new_from_message_preallocated(&storage, buf,
+                                                         obj->length);
+        TEST_ASSERT(parsed != NULL);
+        TEST_ASSERT(parsed->object_id == OF_FLOW_ADD);
+    }
+
+    return TEST_PASS;
+}
+
+/*
+ * Every size between the fixed part and the whole message: the build
+ * fails with OF_ERROR_RESOURCE, leaving the message consistent and
+ * within the buffer.
+ */
+static int
+test_preallocated_capacity(void)
+{
+    of_object_storage_t storage;
+    of_flow_add_t *obj;
+    uint8_t buf[256 + 16];
+    int full, bytes, rv, version;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        if (version == OF_VERSION_1_1) {
+            continue;
+        }
+        obj = of_object_new_preallocated(&storage, OF_FLOW_ADD, version,
+                                         buf, 256);
+        TEST_OK(flow_add_build(obj));
+        full = obj->length;
+
+        for (bytes = of_object_fixed_len[version][OF_FLOW_ADD];
+             bytes < full; bytes++) {
+            MEMSET(buf, 0xa5, sizeof(buf));
+            obj = of_object_new_preallocated(&storage, OF_FLOW_ADD, version,
+                                             buf, bytes);
+            TEST_ASSERT(obj != NULL);
+            rv = flow_add_build(obj);
+            TEST_ASSERT(rv == OF_ERROR_RESOURCE);
+            TEST_ASSERT(obj->length <= bytes);
+            TEST_ASSERT(obj->wbuf->current_bytes == obj->length);
+            TEST_ASSERT(of_message_length_get(buf) == obj->length);
+            TEST_ASSERT(buf[bytes] == 0xa5);
+        }
+    }
+
+    return TEST_PASS;
+}
+
+/* Octets setters */
+static int
+test_preallocated_octets(void)
+{
+    of_object_storage_t storage;
+    of_packet_out_t *obj;
+    uint8_t buf[128], data[64];
+    of_octets_t octets = { data, sizeof(data) };
+    int fixed;
+
+    MEMSET(data, 0x5a, sizeof(data));
+    fixed = of_object_fixed_len[OF_VERSION_1_3][OF_PACKET_OUT];
+
+    obj = of_object_new_preallocated(&storage, OF_PACKET_OUT,
+                                     OF_VERSION_1_3, buf,
+                                     fixed + sizeof(data) - 1);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(of_packet_out_data_set(obj, &octets) == OF_ERROR_RESOURCE);
+    TEST_ASSERT(obj->length == fixed);
+
+    obj = of_object_new_preallocated(&storage, OF_PACKET_OUT,
+                                     OF_VERSION_1_3, buf,
+                                     fixed + sizeof(data));
+    TEST_ASSERT(obj != NULL);
+    TEST_OK(of_packet_out_data_set(obj, &octets));
+    TEST_ASSERT(obj->length == fixed + (int)sizeof(data));
+    TEST_ASSERT(memcmp(buf + fixed, data, sizeof(data)) == 0);
+
+    return TEST_PASS;
+}
+
+/* Trailing octets written in place match those copied by the setter */
+static int
+test_preallocated_reserve(void)
+{
+    of_object_storage_t storage;
+    of_packet_out_t *obj, *expect;
+    of_echo_request_t *echo;
+    uint8_t buf[128], data[64], *ptr;
+    of_octets_t octets = { data, sizeof(data) };
+    int i, version, fixed;
+
+    for (i = 0; i < (int)sizeof(data); i++) {
+        data[i] = i;
+    }
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        fixed = of_object_fixed_len[version][OF_PACKET_OUT];
+        obj = of_object_new_preallocated(&storage, OF_PACKET_OUT, version,
+                                         buf, fixed + sizeof(data));
+        TEST_ASSERT(obj != NULL);
+        of_packet_out_xid_set(obj, 7);
+        TEST_OK(of_packet_out_data_reserve(obj, sizeof(data), &ptr));
+        TEST_ASSERT(ptr == buf + fixed);
+        MEMCPY(ptr, data, sizeof(data));
+        TEST_ASSERT(of_packet_out_data_reserve(obj, sizeof(data) + 1,
+                                               &ptr) == OF_ERROR_RESOURCE);
+
+        expect = of_packet_out_new(version);
+        of_packet_out_xid_set(expect, 7);
+        TEST_OK(of_packet_out_data_set(expect, &octets));
+        TEST_ASSERT(obj->length == expect->length);
+        TEST_ASSERT(of_message_length_get(buf) == expect->length);
+        TEST_ASSERT(memcmp(buf, OF_OBJECT_TO_MESSAGE(expect),
+                           expect->length) == 0);
+        of_packet_out_delete(expect);
+    }
+
+    /* Resizing keeps the start of the data */
+    echo = of_echo_request_new(OF_VERSION_1_3);
+    TEST_OK(of_echo_request_data_set(echo, &octets));
+    TEST_OK(of_echo_request_data_reserve(echo, 16, &ptr));
+    TEST_ASSERT(echo->length == OF_MESSAGE_HEADER_LENGTH + 16);
+    TEST_ASSERT(memcmp(ptr, data, 16) == 0);
+    TEST_OK(of_echo_request_data_reserve(echo, 0, &ptr));
+    TEST_ASSERT(echo->length == OF_MESSAGE_HEADER_LENGTH);
+    TEST_ASSERT(of_message_length_get(OF_OBJECT_TO_MESSAGE(echo)) ==
+                OF_MESSAGE_HEADER_LENGTH);
+
+    /* Lengths the 16 bit length field can't hold are rejected */
+    TEST_ASSERT(of_echo_request_data_reserve(echo, -1, &ptr) ==
+                OF_ERROR_PARAM);
+    TEST_ASSERT(of_echo_request_data_reserve(
+                    echo, OF_WIRE_BUFFER_MAX_LENGTH - OF_MESSAGE_HEADER_LENGTH + 1,
+                    &ptr) == OF_ERROR_PARAM);
+    TEST_ASSERT(echo->length == OF_MESSAGE_HEADER_LENGTH);
+    TEST_OK(of_echo_request_data_reserve(
+                echo, OF_WIRE_BUFFER_MAX_LENGTH - OF_MESSAGE_HEADER_LENGTH, &ptr));
+    TEST_ASSERT(echo->length == OF_WIRE_BUFFER_MAX_LENGTH);
+    of_echo_request_delete(echo);
+
+    return TEST_PASS;
+}
+
+int
+run_preallocated_tests(void)
+{
+    RUN_TEST(preallocated_new);
+    RUN_TEST(preallocated_flow_add);
+    RUN_TEST(preallocated_capacity);
+    RUN_TEST(preallocated_octets);
+    RUN_TEST(preallocated_reserve);
+
+    return TEST_PASS;
+}
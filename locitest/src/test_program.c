@@ -0,0 +1,600 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test compiled action programs
+ *
+ * A program must set the fields its actions name, push and pop headers
+ * and leave the IPv4 and L4 checksums right, as checked by summing the
+ * packet again.  Instructions other than actions are recorded, and an
+ * unknown action fails the compile.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_packet.h>
+#include <loci/loci_program.h>
+
+#define HEADROOM 8
+
+/* TCP/IPv4, ttl 64; checksums filled in by packet_init */
+static const uint8_t tcp4[] = {
+    0x02, 0, 0, 0, 0, 1, 0x02, 0, 0, 0, 0, 2, 0x08, 0x00,
+    0x45, 0x00, 0x00, 0x28, 0, 0, 0x40, 0x00, 0x40, 0x06, 0, 0,
+    10, 0, 0, 1, 10, 0, 0, 2,
+    0x04, 0xd2, 0x00, 0x50, 0, 0, 0, 1, 0, 0, 0, 0,
+    0x50, 0x02, 0xff, 0xff, 0, 0, 0, 0,
+};
+
+/* UDP/IPv4 with a payload of odd length */
+static const uint8_t udp4[] = {
+    0x02, 0, 0, 0, 0, 1, 0x02, 0, 0, 0, 0, 2, 0x08, 0x00,
+    0x45, 0x00, 0x00, 0x1f, 0, 0, 0x00, 0x00, 0x40, 0x11, 0, 0,
+    10, 0, 0, 1, 10, 0, 0, 2,
+    0x00, 0x35, 0x00, 0x35, 0x00, 0x0b, 0, 0,
+    0xab, 0xcd, 0xef,
+};
+
+/* UDP/IPv6, hop limit 64 */
+static const uint8_t udp6[] = {
+    0x02, 0, 0, 0, 0, 1, 0x02, 0, 0, 0, 0, 2, 0x86, 0xdd,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x40,
+    0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0x12, 0x34, 0x00, 0x35, 0x00, 0x0c, 0, 0,
+    1, 2, 3, 4,
+};
+
+typedef struct packet_s {
+    uint8_t buf[HEADROOM + 128];
+    loci_program_packet_t pkt;
+} packet_t;
+
+/* What the callbacks were given */
+static struct {
+    int outputs;
+    uint32_t port;
+    uint16_t max_len;
+    uint8_t data[128];
+    int len;
+    int groups;
+    uint32_t group_id;
+    int resubmits;
+    uint32_t in_port;
+    uint8_t table_id;
+} sent;
+
+static void
+sent_output(void *cookie, uint32_t port, uint16_t max_len, uint8_t *data,
+            int len)
+{
+    sent.outputs++;
+    sent.port = port;
+    sent.max_len = max_len;
+    MEMCPY(sent.data, data, len);
+    sent.len = len;
+}
+
+static void
+sent_group(void *cookie, uint32_t group_id, uint8_t *data, int len)
+{
+    sent.groups++;
+    sent.group_id = group_id;
+}
+
+static void
+sent_resubmit(void *cookie, uint32_t in_port, uint8_t table_id,
+              uint8_t *data, int len)
+{
+    sent.resubmits++;
+    sent.in_port = in_port;
+    sent.table_id = table_id;
+}
+
+static void
+env_init(loci_program_env_t *env)
+{
+    MEMSET(env, 0, sizeof(*env));
+    MEMSET(&sent, 0, sizeof(sent));
+    env->output = sent_output;
+    env->group = sent_group;
+    env->resubmit = sent_resubmit;
+}
+
+static uint32_t
+sum16(const uint8_t *p, int len, uint32_t sum)
+{
+    int i;
+
+    for (i = 0; i + 1 < len; i += 2) {
+        sum += (p[i] << 8) | p[i + 1];
+    }
+    if (len & 1) {
+        sum += p[len - 1] << 8;
+    }
+
+    return sum;
+}
+
+static uint16_t
+fold(uint32_t sum)
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return sum;
+}
+
+/* Offsets of the checksums of an IP packet, after any VLAN tag */
+static void
+csum_offsets(const uint8_t *data, int *l3, int *l4, int *l4_csum)
+{
+    *l3 = data[12] == 0x81 ? 18 : 14;
+    if (data[*l3 - 2] == 0x86) {
+        *l4 = *l3 + 40;
+        *l4_csum = *l4 + (data[*l3 + 6] == 6 ? 16 : 6);
+    } else {
+        *l4 = *l3 + (data[*l3] & 0xf) * 4;
+        *l4_csum = *l4 + (data[*l3 + 9] == 6 ? 16 : 6);
+    }
+}
+
+/* Sums of the IPv4 header and of the L4 segment with its pseudo header */
+static void
+csum_sums(const uint8_t *data, int len, uint16_t *ip, uint16_t *l4)
+{
+    uint32_t sum;
+    int l3, l4_start, l4_csum;
+
+    csum_offsets(data, &l3, &l4_start, &l4_csum);
+    if (data[l3 - 2] == 0x86) {
+        *ip = 0xffff;
+        sum = sum16(data + l3 + 8, 32, 0) + data[l3 + 6];
+    } else {
+        *ip = fold(sum16(data + l3, (data[l3] & 0xf) * 4, 0));
+        sum = sum16(data + l3 + 12, 8, 0) + data[l3 + 9];
+    }
+    sum += len - l4_start;
+    *l4 = fold(sum16(data + l4_start, len - l4_start, sum));
+}
+
+static void
+packet_init(packet_t *p, const uint8_t *data, int len, int headroom)
+{
+    uint16_t ip, l4;
+    int l3, l4_start, l4_csum;
+
+    MEMSET(p->buf, 0, sizeof(p->buf));
+    p->pkt.data = p->buf + headroom;
+    p->pkt.len = len;
+    p->pkt.headroom = headroom;
+    MEMCPY(p->pkt.data, data, len);
+
+    csum_offsets(p->pkt.data, &l3, &l4_start, &l4_csum);
+    csum_sums(p->pkt.data, len, &ip, &l4);
+    if (p->pkt.data[l3 - 2] == 0x08) {
+        p->pkt.data[l3 + 10] = ~ip >> 8;
+        p->pkt.data[l3 + 11] = ~ip;
+    }
+    p->pkt.data[l4_csum] = ~l4 >> 8;
+    p->pkt.data[l4_csum + 1] = ~l4;
+}
+
+static int
+csum_ok(const packet_t *p)
+{
+    uint16_t ip, l4;
+
+    csum_sums(p->pkt.data, p->pkt.len, &ip, &l4);
+    return ip == 0xffff && l4 == 0xffff;
+}
+
+/* Append a copy of an action to a list and delete it */
+static int
+action_append(of_list_action_t *actions, of_object_t *action)
+{
+    int rv;
+
+    if (action == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    rv = of_list_action_append(actions, action);
+    of_object_delete(action);
+
+    return rv;
+}
+
+static int
+set_field_append(of_list_action_t *actions, of_oxm_t *oxm)
+{
+    of_action_set_field_t *action;
+    int rv;
+
+    action = of_action_set_field_new(actions->version);
+    if (action == NULL || oxm == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    rv = of_action_set_field_field_set(action, oxm);
+    of_object_delete(oxm);
+    if (rv < 0) {
+        of_object_delete(action);
+        return rv;
+    }
+
+    return action_append(actions, action);
+}
+
+static int
+instruction_append(of_list_instruction_t *instructions,
+                   of_object_t *instruction)
+{
+    int rv;
+
+    if (instruction == NULL) {
+        return OF_ERROR_RESOURCE;
+    }
+    rv = of_list_instruction_append(instructions, instruction);
+    of_object_delete(instruction);
+
+    return rv;
+}
+
+static int
+test_program_instructions(void)
+{
+    of_list_instruction_t *instructions;
+    of_list_action_t *actions;
+    of_object_t *obj;
+    of_mac_addr_t mac = { { 0x02, 0, 0, 0, 0, 9 } };
+    loci_program_t prog;
+    loci_program_env_t env;
+    of_match_t match;
+    packet_t p;
+    of_version_t version = OF_VERSION_1_3;
+
+    instructions = of_list_instruction_new(version);
+    TEST_ASSERT(instructions != NULL);
+
+    /* The write actions come first in the list, and run after */
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    obj = of_action_group_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_group_group_id_set(obj, 5);
+    TEST_OK(action_append(actions, obj));
+    obj = of_instruction_write_actions_new(version);
+    TEST_ASSERT(obj != NULL);
+    TEST_OK(of_instruction_write_actions_actions_set(obj, actions));
+    TEST_OK(instruction_append(instructions, obj));
+    of_list_action_delete(actions);
+
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    obj = of_oxm_ipv4_dst_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_oxm_ipv4_dst_value_set(obj, 0xc0a80001);
+    TEST_OK(set_field_append(actions, obj));
+    obj = of_oxm_tcp_dst_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_oxm_tcp_dst_value_set(obj, 8080);
+    TEST_OK(set_field_append(actions, obj));
+    obj = of_oxm_eth_dst_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_oxm_eth_dst_value_set(obj, mac);
+    TEST_OK(set_field_append(actions, obj));
+    TEST_OK(action_append(actions, of_action_dec_nw_ttl_new(version)));
+    obj = of_action_output_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_output_port_set(obj, 2);
+    of_action_output_max_len_set(obj, 128);
+    TEST_OK(action_append(actions, obj));
+    obj = of_instruction_apply_actions_new(version);
+    TEST_ASSERT(obj != NULL);
+    TEST_OK(of_instruction_apply_actions_actions_set(obj, actions));
+    TEST_OK(instruction_append(instructions, obj));
+    of_list_action_delete(actions);
+
+    obj = of_instruction_goto_table_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_instruction_goto_table_table_id_set(obj, 3);
+    TEST_OK(instruction_append(instructions, obj));
+    obj = of_instruction_write_metadata_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_instruction_write_metadata_metadata_set(obj, 0x1234);
+    of_instruction_write_metadata_metadata_mask_set(obj, 0xffff);
+    TEST_OK(instruction_append(instructions, obj));
+    obj = of_instruction_meter_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_instruction_meter_meter_id_set(obj, 9);
+    TEST_OK(instruction_append(instructions, obj));
+    TEST_OK(instruction_append(instructions,
+                               of_instruction_bsn_deny_new(version)));
+
+    TEST_OK(loci_program_compile(&prog, instructions));
+    of_list_instruction_delete(instructions);
+    TEST_ASSERT(prog.n_apply == 5);
+    TEST_ASSERT(prog.n_ops == 6);
+    TEST_ASSERT(prog.ops[0].code == LOCI_OP_SET_FIELD);
+    TEST_ASSERT(prog.ops[5].code == LOCI_OP_GROUP);
+    TEST_ASSERT(prog.flags == (LOCI_PROGRAM_GOTO_TABLE |
+                               LOCI_PROGRAM_WRITE_METADATA |
+                               LOCI_PROGRAM_METER |
+                               LOCI_PROGRAM_WRITE_ACTIONS));
+    TEST_ASSERT(prog.table_id == 3);
+    TEST_ASSERT(prog.metadata == 0x1234);
+    TEST_ASSERT(prog.metadata_mask == 0xffff);
+    TEST_ASSERT(prog.meter_id == 9);
+    TEST_ASSERT(prog.bsn_flags == LOCI_PROGRAM_BSN_DENY);
+
+    env_init(&env);
+    packet_init(&p, tcp4, sizeof(tcp4), HEADROOM);
+    TEST_OK(loci_program_run(&prog, &p.pkt, &env));
+    TEST_ASSERT(sent.outputs == 1);
+    TEST_ASSERT(sent.port == 2);
+    TEST_ASSERT(sent.max_len == 128);
+    TEST_ASSERT(sent.groups == 0);
+    TEST_ASSERT(csum_ok(&p));
+
+    TEST_OK(loci_packet_match(version, p.pkt.data, p.pkt.len,
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_ASSERT(match.fields.ipv4_dst == 0xc0a80001);
+    TEST_ASSERT(match.fields.ipv4_src == 0x0a000001);
+    TEST_ASSERT(match.fields.tcp_dst == 8080);
+    TEST_ASSERT(match.fields.tcp_src == 1234);
+    TEST_ASSERT(memcmp(&match.fields.eth_dst, &mac, sizeof(mac)) == 0);
+    TEST_ASSERT(p.pkt.data[22] == 63);
+
+    TEST_OK(loci_program_run_write(&prog, &p.pkt, &env));
+    TEST_ASSERT(sent.groups == 1);
+    TEST_ASSERT(sent.group_id == 5);
+
+    loci_program_cleanup(&prog);
+    TEST_ASSERT(prog.ops == NULL);
+
+    return TEST_PASS;
+}
+
+/* OpenFlow 1.0 set_vlan_vid tags an untagged packet */
+static int
+test_program_of10(void)
+{
+    of_list_action_t *actions;
+    of_object_t *obj;
+    loci_program_t prog;
+    loci_program_env_t env;
+    of_match_t match;
+    packet_t p;
+    of_version_t version = OF_VERSION_1_0;
+
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    obj = of_action_set_vlan_vid_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_set_vlan_vid_vlan_vid_set(obj, 10);
+    TEST_OK(action_append(actions, obj));
+    obj = of_action_set_vlan_pcp_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_set_vlan_pcp_vlan_pcp_set(obj, 5);
+    TEST_OK(action_append(actions, obj));
+    obj = of_action_set_nw_tos_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_set_nw_tos_nw_tos_set(obj, 0xb8);
+    TEST_OK(action_append(actions, obj));
+    obj = of_action_set_tp_src_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_set_tp_src_tp_port_set(obj, 1000);
+    TEST_OK(action_append(actions, obj));
+    obj = of_action_enqueue_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_enqueue_port_set(obj, 3);
+    of_action_enqueue_queue_id_set(obj, 7);
+    TEST_OK(action_append(actions, obj));
+
+    TEST_OK(loci_program_compile_actions(&prog, actions));
+    of_list_action_delete(actions);
+    TEST_ASSERT(prog.n_ops == 6);
+    TEST_ASSERT(prog.n_apply == 6);
+
+    env_init(&env);
+    packet_init(&p, udp4, sizeof(udp4), HEADROOM);
+    TEST_OK(loci_program_run(&prog, &p.pkt, &env));
+    TEST_ASSERT(p.pkt.len == sizeof(udp4) + 4);
+    TEST_ASSERT(p.pkt.headroom == HEADROOM - 4);
+    TEST_ASSERT(env.queue_id == 7);
+    TEST_ASSERT(sent.outputs == 1);
+    TEST_ASSERT(sent.port == 3);
+    TEST_ASSERT(sent.len == p.pkt.len);
+    TEST_ASSERT(csum_ok(&p));
+
+    TEST_OK(loci_packet_match(version, p.pkt.data, p.pkt.len,
+                              LOCI_PACKET_FIELDS_ALL, &match));
+    TEST_ASSERT(match.fields.vlan_vid == 10);
+    TEST_ASSERT(match.fields.vlan_pcp == 5);
+    TEST_ASSERT(match.fields.ip_dscp == 46);
+    TEST_ASSERT(match.fields.udp_src == 1000);
+    TEST_ASSERT(match.fields.udp_dst == 53);
+
+    /* Tagged already, so no push; too little room otherwise */
+    TEST_OK(loci_program_run(&prog, &p.pkt, &env));
+    TEST_ASSERT(p.pkt.len == sizeof(udp4) + 4);
+    packet_init(&p, udp4, sizeof(udp4), 2);
+    TEST_ASSERT(loci_program_run(&prog, &p.pkt, &env) == OF_ERROR_RESOURCE);
+
+    /* A UDP checksum of zero stays zero */
+    packet_init(&p, udp4, sizeof(udp4), HEADROOM);
+    p.pkt.data[40] = p.pkt.data[41] = 0;
+    TEST_OK(loci_program_run(&prog, &p.pkt, &env));
+    TEST_ASSERT(p.pkt.data[44] == 0 && p.pkt.data[45] == 0);
+
+    loci_program_cleanup(&prog);
+
+    return TEST_PASS;
+}
+
+static int
+test_program_mpls(void)
+{
+    of_list_action_t *actions;
+    of_object_t *obj;
+    loci_program_t prog;
+    loci_program_env_t env;
+    packet_t p;
+    of_version_t version = OF_VERSION_1_3;
+
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    obj = of_action_push_mpls_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_push_mpls_ethertype_set(obj, 0x8847);
+    TEST_OK(action_append(actions, obj));
+    obj = of_oxm_mpls_label_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_oxm_mpls_label_value_set(obj, 1000);
+    TEST_OK(set_field_append(actions, obj));
+    TEST_OK(action_append(actions, of_action_dec_mpls_ttl_new(version)));
+    obj = of_action_output_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_output_port_set(obj, 1);
+    TEST_OK(action_append(actions, obj));
+    obj = of_action_pop_mpls_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_pop_mpls_ethertype_set(obj, 0x0800);
+    TEST_OK(action_append(actions, obj));
+
+    TEST_OK(loci_program_compile_actions(&prog, actions));
+    of_list_action_delete(actions);
+
+    /* Label 1000, bottom of stack, TTL 64 - 1 from the IP header */
+    env_init(&env);
+    packet_init(&p, tcp4, sizeof(tcp4), HEADROOM);
+    TEST_OK(loci_program_run(&prog, &p.pkt, &env));
+    TEST_ASSERT(sent.outputs == 1);
+    TEST_ASSERT(sent.len == sizeof(tcp4) + 4);
+    TEST_ASSERT(sent.data[12] == 0x88 && sent.data[13] == 0x47);
+    TEST_ASSERT(sent.data[14] == 0x00 && sent.data[15] == 0x3e);
+    TEST_ASSERT(sent.data[16] == 0x81 && sent.data[17] == 63);
+
+    /* The pop gives back the packet as it came, checksums and all */
+    TEST_ASSERT(p.pkt.len == sizeof(tcp4));
+    TEST_ASSERT(p.pkt.headroom == HEADROOM);
+    TEST_ASSERT(memcmp(p.pkt.data + 14, sent.data + 18, p.pkt.len - 14) == 0);
+    TEST_ASSERT(csum_ok(&p));
+
+    /* An expired TTL stops the program */
+    p.pkt.data[22] = 1;
+    TEST_ASSERT(loci_program_run(&prog, &p.pkt, &env) == OF_ERROR_RANGE);
+    TEST_ASSERT(sent.outputs == 1);
+
+    loci_program_cleanup(&prog);
+
+    return TEST_PASS;
+}
+
+static int
+test_program_nicira(void)
+{
+    of_list_action_t *actions;
+    of_object_t *obj;
+    of_ipv6_t ipv6 = { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                         0, 0, 0, 0, 0, 0, 0xab, 0xcd } };
+    loci_program_t prog;
+    loci_program_env_t env;
+    packet_t p;
+    of_version_t version = OF_VERSION_1_3;
+
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    obj = of_oxm_ipv6_src_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_oxm_ipv6_src_value_set(obj, ipv6);
+    TEST_OK(set_field_append(actions, obj));
+
+    /* NXM_OF_ETH_SRC to NXM_OF_ETH_DST, low 16 bits */
+    obj = of_action_nicira_move_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_nicira_move_src_set(obj, 0x00000406);
+    of_action_nicira_move_dst_set(obj, 0x00000206);
+    of_action_nicira_move_n_bits_set(obj, 16);
+    TEST_OK(action_append(actions, obj));
+
+    obj = of_action_nicira_resubmit_table_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_nicira_resubmit_table_in_port_set(obj, 5);
+    of_action_nicira_resubmit_table_table_set(obj, 2);
+    TEST_OK(action_append(actions, obj));
+    TEST_OK(action_append(actions, of_action_nicira_dec_ttl_new(version)));
+
+    TEST_OK(loci_program_compile_actions(&prog, actions));
+    of_list_action_delete(actions);
+    TEST_ASSERT(prog.n_ops == 4);
+
+    env_init(&env);
+    packet_init(&p, udp6, sizeof(udp6), HEADROOM);
+    TEST_OK(loci_program_run(&prog, &p.pkt, &env));
+    TEST_ASSERT(memcmp(p.pkt.data + 22, ipv6.addr, 16) == 0);
+    TEST_ASSERT(p.pkt.data[4] == 0 && p.pkt.data[5] == 2);
+    TEST_ASSERT(p.pkt.data[3] == 0);
+    TEST_ASSERT(p.pkt.data[21] == 63);
+    TEST_ASSERT(csum_ok(&p));
+    TEST_ASSERT(sent.resubmits == 1);
+    TEST_ASSERT(sent.in_port == 5);
+    TEST_ASSERT(sent.table_id == 2);
+
+    loci_program_cleanup(&prog);
+
+    /* Too many bits for the destination */
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    obj = of_action_nicira_move_new(version);
+    TEST_ASSERT(obj != NULL);
+    of_action_nicira_move_src_set(obj, 0x00000406);
+    of_action_nicira_move_dst_set(obj, 0x00001202);
+    of_action_nicira_move_n_bits_set(obj, 17);
+    TEST_OK(action_append(actions, obj));
+    TEST_ASSERT(loci_program_compile_actions(&prog, actions) ==
+                OF_ERROR_COMPAT);
+    of_list_action_delete(actions);
+
+    return TEST_PASS;
+}
+
+static int
+test_program_compat(void)
+{
+    of_list_action_t *actions;
+    loci_program_t prog;
+    of_version_t version = OF_VERSION_1_3;
+
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    TEST_OK(action_append(actions, of_action_dec_nw_ttl_new(version)));
+    TEST_OK(action_append(actions, of_action_copy_ttl_in_new(version)));
+    TEST_ASSERT(loci_program_compile_actions(&prog, actions) ==
+                OF_ERROR_COMPAT);
+    TEST_ASSERT(prog.ops == NULL);
+    TEST_ASSERT(prog.n_ops == 0);
+    of_list_action_delete(actions);
+
+    /* An empty list is an empty program */
+    actions = of_list_action_new(version);
+    TEST_ASSERT(actions != NULL);
+    TEST_OK(loci_program_compile_actions(&prog, actions));
+    TEST_ASSERT(prog.n_ops == 0);
+    loci_program_cleanup(&prog);
+    of_list_action_delete(actions);
+
+    return TEST_PASS;
+}
+
+int
+run_program_tests(void)
+{
+    RUN_TEST(program_instructions);
+    RUN_TEST(program_of10);
+    RUN_TEST(program_mpls);
+    RUN_TEST(program_nicira);
+    RUN_TEST(program_compat);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,198 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the random object generator
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_random.h>
+#include <loci/loci_validator.h>
+
+#define SEEDS 8
+
+/*
+ * Every message type of every version validates and parses back as
+ * the same type.
+ */
+static int
+test_random_messages(void)
+{
+    loci_random_t r;
+    loci_random_config_t config;
+    const of_object_id_t *ids;
+    of_object_t *obj, *parsed;
+    uint8_t *buf;
+    int version, i, count, seed;
+
+    loci_random_config_init(&config);
+    for (seed = 0; seed < SEEDS; seed++) {
+        config.seed = seed;
+        loci_random_init(&r, &config);
+        for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+            ids = loci_random_message_ids(version, &count);
+            TEST_ASSERT(count > 0);
+            for (i = 0; i < count; i++) {
+                obj = loci_random_new(&r, ids[i], version);
+                TEST_ASSERT(obj != NULL);
+                TEST_ASSERT(obj->object_id == ids[i]);
+                TEST_ASSERT(of_validate_message(OF_OBJECT_TO_MESSAGE(obj),
+                                                obj->length) == 0);
+
+                buf = MALLOC(obj->length);
+                TEST_ASSERT(buf != NULL);
+                MEMCPY(buf, OF_OBJECT_TO_MESSAGE(obj), obj->length);
+                parsed = of_object_new_from_message(buf, obj->length);
+                TEST_ASSERT(parsed != NULL);
+                TEST_ASSERT(parsed->object_id == obj->object_id);
+                TEST_ASSERT(parsed->length == obj->length);
+                of_object_delete(parsed);
+                of_object_delete(obj);
+            }
+        }
+        loci_random_cleanup(&r);
+    }
+
+    return TEST_PASS;
+}
+
+/* Generate a sequence of messages into buf, returning its length */
+static int
+random_sequence(uint64_t seed, uint8_t *buf, int len)
+{
+    loci_random_t r;
+    loci_random_config_t config;
+    of_object_t *obj;
+    int i, version, offset = 0;
+
+    loci_random_config_init(&config);
+    config.seed = seed;
+    config.list_max = 8;
+    config.depth_max = 3;
+    loci_random_init(&r, &config);
+    for (i = 0; i < 200; i++) {
+        version = OF_VERSION_1_0 + loci_random_range(&r, 4);
+        if ((obj = loci_random_message_new(&r, version)) == NULL) {
+            loci_random_cleanup(&r);
+            return -1;
+        }
+        if (offset + obj->length <= len) {
+            MEMCPY(buf + offset, OF_OBJECT_TO_MESSAGE(obj), obj->length);
+            offset += obj->length;
+        }
+        of_object_delete(obj);
+    }
+    loci_random_cleanup(&r);
+
+    return offset;
+}
+
+static int
+test_random_deterministic(void)
+{
+    static uint8_t a[1024 * 1024], b[1024 * 1024];
+    int a_len, b_len;
+
+    a_len = random_sequence(42, a, sizeof(a));
+    b_len = random_sequence(42, b, sizeof(b));
+    TEST_ASSERT(a_len > 0);
+    TEST_ASSERT(a_len == b_len);
+    TEST_ASSERT(memcmp(a, b, a_len) == 0);
+
+    b_len = random_sequence(43, b, sizeof(b));
+    TEST_ASSERT(b_len > 0);
+    TEST_ASSERT(a_len != b_len || memcmp(a, b, a_len) != 0);
+
+    return TEST_PASS;
+}
+
+/* Random matches are accepted by every version and read back unchanged */
+static int
+test_random_match(void)
+{
+    loci_random_t r;
+    loci_random_config_t config;
+    of_flow_add_t *flow;
+    of_match_t match, out;
+    int version, i;
+
+    loci_random_config_init(&config);
+    config.match_fields = 75;
+    config.match_masked = 50;
+    loci_random_init(&r, &config);
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        flow = of_flow_add_new(version);
+        TEST_ASSERT(flow != NULL);
+        for (i = 0; i < 100; i++) {
+            loci_random_match(&r, version, &match);
+            TEST_OK(of_flow_add_match_set(flow, &match));
+            TEST_OK(of_flow_add_match_get(flow, &out));
+            TEST_ASSERT(of_match_eq(&match, &out));
+        }
+        of_flow_add_delete(flow);
+    }
+    loci_random_cleanup(&r);
+
+    return TEST_PASS;
+}
+
+static int
+test_random_packet(void)
+{
+    loci_random_t r;
+    loci_random_config_t config;
+    of_octets_t octets;
+    uint8_t *ip;
+    uint32_t sum;
+    int i, j, ipv4 = 0;
+
+    loci_random_config_init(&config);
+    config.packet_min = 100;
+    config.packet_max = 200;
+    loci_random_init(&r, &config);
+    for (i = 0; i < 100; i++) {
+        loci_random_packet(&r, &octets);
+        TEST_ASSERT(octets.bytes >= 100 && octets.bytes <= 200);
+        /* Unicast source and destination */
+        TEST_ASSERT((octets.data[0] & 1) == 0);
+        TEST_ASSERT((octets.data[6] & 1) == 0);
+
+        ip = octets.data + 14;
+        if (octets.data[12] == 0x81 && octets.data[13] == 0x00) {
+            ip += 4;
+        }
+        if (ip[-2] != 0x08 || ip[-1] != 0x00) {
+            continue;
+        }
+
+        /* The IPv4 header checksum verifies */
+        ipv4++;
+        TEST_ASSERT(ip[0] == 0x45);
+        TEST_ASSERT(((ip[2] << 8) | ip[3]) == octets.data + octets.bytes - ip);
+        sum = 0;
+        for (j = 0; j < 20; j += 2) {
+            sum += (ip[j] << 8) | ip[j + 1];
+        }
+        while (sum >> 16) {
+            sum = (sum & 0xffff) + (sum >> 16);
+        }
+        TEST_ASSERT(sum == 0xffff);
+    }
+    TEST_ASSERT(ipv4 > 0);
+    loci_random_cleanup(&r);
+
+    return TEST_PASS;
+}
+
+int
+run_random_tests(void)
+{
+    RUN_TEST(random_messages);
+    RUN_TEST(random_deterministic);
+    RUN_TEST(random_match);
+    RUN_TEST(random_packet);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,386 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test bulk SDWN client messages
+ *
+ * What the bulk encoders write must parse and read back the same
+ * through the generated accessors, and messages built with the
+ * accessors must decode into the same records.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_sdwn_client.h>
+
+#define VERSION OF_VERSION_1_3
+#define N_CLIENTS 30
+#define KEY_BYTES 8
+
+/* The rates and keys the records point to */
+static uint8_t rates[N_CLIENTS][OF_DESC_STR_LEN];
+static uint8_t keys[N_CLIENTS][4 + KEY_BYTES];
+
+static void
+client_make(loci_sdwn_client_t *client, int i, int type)
+{
+    int j;
+
+    MEMSET(client, 0, sizeof(*client));
+    client->type = type;
+    client->mac.addr[0] = 0x02;
+    client->mac.addr[4] = i >> 8;
+    client->mac.addr[5] = i;
+    if (type == LOCI_SDWN_CLIENT_LVAP) {
+        return;
+    }
+    client->assoc_id = i + 1;
+    client->capabilities = 0x400 + i;
+    client->cap_flags = 0x3;
+    for (j = 0; j < LOCI_SDWN_HT_CAP_BYTES; j++) {
+        client->ht_capabilities[j] = i + j;
+    }
+    for (j = 0; j < LOCI_SDWN_VHT_CAP_BYTES; j++) {
+        client->vht_capabilities[j] = 0x80 + i + j;
+    }
+    for (j = 0; j < OF_DESC_STR_LEN; j++) {
+        rates[i][j] = i * 3 + j;
+    }
+    client->supported_rates = rates[i];
+    if (type == LOCI_SDWN_CLIENT_CRYPTO) {
+        /* One of_bsn_tlv_data */
+        buf_u16_set(keys[i], 0x37);
+        buf_u16_set(keys[i] + 2, sizeof(keys[i]));
+        for (j = 0; j < KEY_BYTES; j++) {
+            keys[i][4 + j] = 0xa0 + i + j;
+        }
+        client->keys = keys[i];
+        client->keys_len = sizeof(keys[i]);
+    }
+}
+
+/* The same fields, rates and keys by value */
+static int
+client_equal(const loci_sdwn_client_t *a, const loci_sdwn_client_t *b)
+{
+    if (MEMCMP(&a->mac, &b->mac, sizeof(a->mac)) != 0 ||
+        a->type != b->type || a->assoc_id != b->assoc_id ||
+        a->capabilities != b->capabilities ||
+        a->cap_flags != b->cap_flags || a->ap != b->ap ||
+        MEMCMP(a->ht_capabilities, b->ht_capabilities,
+               LOCI_SDWN_HT_CAP_BYTES) != 0 ||
+        MEMCMP(a->vht_capabilities, b->vht_capabilities,
+               LOCI_SDWN_VHT_CAP_BYTES) != 0 ||
+        a->keys_len != b->keys_len ||
+        (a->keys_len > 0 && MEMCMP(a->keys, b->keys, a->keys_len) != 0)) {
+        return 0;
+    }
+    if (a->supported_rates == NULL || b->supported_rates == NULL) {
+        return a->supported_rates == b->supported_rates;
+    }
+
+    return MEMCMP(a->supported_rates, b->supported_rates,
+                  OF_DESC_STR_LEN) == 0;
+}
+
+/* An object over a copy of the message at buf */
+static of_object_t *
+message_object(uint8_t *buf)
+{
+    uint8_t *copy;
+    int len = of_message_length_get(buf);
+
+    if ((copy = MALLOC(len)) == NULL) {
+        return NULL;
+    }
+    MEMCPY(copy, buf, len);
+
+    return of_object_new_from_message(OF_BUFFER_TO_MESSAGE(copy), len);
+}
+
+/*
+ * The getters of each kind only take objects of that kind; the normal
+ * and crypto kinds have the same fields up to the keys
+ */
+#define REPLY_FIELDS_CHECK(kind) do {                                       \
+        of_sdwn_get_clients_reply_##kind##_flags_get(obj, &flags);          \
+        of_sdwn_get_clients_reply_##kind##_xid_get(obj, &xid);              \
+        of_sdwn_get_clients_reply_##kind##_client_type_get(                 \
+            obj, &client_type);                                             \
+        of_sdwn_get_clients_reply_##kind##_mac_get(obj, &mac);              \
+        of_sdwn_get_clients_reply_##kind##_assoc_id_get(obj, &assoc_id);    \
+        of_sdwn_get_clients_reply_##kind##_capabilities_get(                \
+            obj, &capabilities);                                            \
+        of_sdwn_get_clients_reply_##kind##_ht_capabilities_bind(obj, &ht);  \
+        of_sdwn_get_clients_reply_##kind##_vht_capabilities_bind(           \
+            obj, &vht);                                                     \
+        of_sdwn_get_clients_reply_##kind##_supported_rates_get(             \
+            obj, &supported_rates);                                         \
+    } while (0)
+
+/* Check a reply through the generated getters */
+static int
+reply_check(of_object_t *obj, const loci_sdwn_client_t *client, int last)
+{
+    of_ieee80211_ht_cap_t ht;
+    of_ieee80211_vht_cap_t vht;
+    of_list_bsn_tlv_data_t list;
+    of_mac_addr_t mac;
+    of_desc_str_t supported_rates;
+    uint16_t flags, assoc_id, capabilities;
+    uint32_t xid;
+    uint8_t client_type;
+
+    switch (client->type) {
+    case LOCI_SDWN_CLIENT_LVAP:
+        TEST_ASSERT(obj->object_id == OF_SDWN_GET_CLIENTS_REPLY_LVAP);
+        of_sdwn_get_clients_reply_lvap_flags_get(obj, &flags);
+        of_sdwn_get_clients_reply_lvap_xid_get(obj, &xid);
+        of_sdwn_get_clients_reply_lvap_client_type_get(obj, &client_type);
+        of_sdwn_get_clients_reply_lvap_mac_get(obj, &mac);
+        break;
+    case LOCI_SDWN_CLIENT_NORMAL:
+        TEST_ASSERT(obj->object_id == OF_SDWN_GET_CLIENTS_REPLY_NORMAL);
+        REPLY_FIELDS_CHECK(normal);
+        break;
+    default:
+        TEST_ASSERT(obj->object_id == OF_SDWN_GET_CLIENTS_REPLY_CRYPTO);
+        REPLY_FIELDS_CHECK(crypto);
+        of_sdwn_get_clients_reply_crypto_keys_bind(obj, &list);
+        TEST_ASSERT(list.length == client->keys_len);
+        TEST_ASSERT(MEMCMP(OF_OBJECT_BUFFER_INDEX(&list, 0), client->keys,
+                           client->keys_len) == 0);
+        break;
+    }
+
+    TEST_ASSERT(flags == (last ? 0 : OF_STATS_REPLY_FLAG_REPLY_MORE));
+    TEST_ASSERT(xid == 0x1234);
+    TEST_ASSERT(client_type == client->type);
+    TEST_ASSERT(MEMCMP(&mac, &client->mac, sizeof(mac)) == 0);
+    if (client->type == LOCI_SDWN_CLIENT_LVAP) {
+        return TEST_PASS;
+    }
+    TEST_ASSERT(assoc_id == client->assoc_id);
+    TEST_ASSERT(capabilities == client->capabilities);
+    TEST_ASSERT(ht.length == LOCI_SDWN_HT_CAP_BYTES);
+    TEST_ASSERT(MEMCMP(OF_OBJECT_BUFFER_INDEX(&ht, 0),
+                       client->ht_capabilities,
+                       LOCI_SDWN_HT_CAP_BYTES) == 0);
+    TEST_ASSERT(MEMCMP(OF_OBJECT_BUFFER_INDEX(&vht, 0),
+                       client->vht_capabilities,
+                       LOCI_SDWN_VHT_CAP_BYTES) == 0);
+    TEST_ASSERT(MEMCMP(supported_rates, client->supported_rates,
+                       OF_DESC_STR_LEN) == 0);
+
+    return TEST_PASS;
+}
+
+static int
+test_sdwn_clients_reply(void)
+{
+    loci_sdwn_client_t clients[N_CLIENTS], decoded[N_CLIENTS];
+    of_object_t *obj;
+    uint8_t buf[1500];
+    int i, n, len, offset, more, next = 0, total = 0, chunks = 0;
+
+    for (i = 0; i < N_CLIENTS; i++) {
+        client_make(&clients[i], i, i < 10 ? LOCI_SDWN_CLIENT_NORMAL :
+                    i < 20 ? LOCI_SDWN_CLIENT_CRYPTO :
+                    LOCI_SDWN_CLIENT_LVAP);
+    }
+
+    while (next < N_CLIENTS) {
+        len = loci_sdwn_clients_reply_encode(buf, sizeof(buf), 0x1234,
+                                             clients, N_CLIENTS, &next);
+        TEST_ASSERT(len > 0 && len <= (int)sizeof(buf));
+        chunks++;
+
+        for (offset = 0, i = total; offset < len; i++) {
+            TEST_ASSERT((obj = message_object(buf + offset)) != NULL);
+            TEST_ASSERT(reply_check(obj, &clients[i],
+                                    i == N_CLIENTS - 1) == TEST_PASS);
+            of_object_delete(obj);
+            offset += of_message_length_get(buf + offset);
+        }
+        TEST_ASSERT(offset == len);
+
+        n = loci_sdwn_clients_decode(buf, len, decoded, N_CLIENTS, &more);
+        TEST_ASSERT(n == next - total);
+        TEST_ASSERT(more == (next < N_CLIENTS));
+        for (i = 0; i < n; i++) {
+            TEST_ASSERT(client_equal(&decoded[i], &clients[total + i]));
+        }
+        total = next;
+    }
+    TEST_ASSERT(chunks > 1);
+
+    /* Nothing to encode */
+    TEST_ASSERT(loci_sdwn_clients_reply_encode(buf, sizeof(buf), 0, clients,
+                                               N_CLIENTS, &next) == 0);
+
+    return TEST_PASS;
+}
+
+/* An of_sdwn_add_client of client through the setters */
+static of_object_t *
+add_client_object(const loci_sdwn_client_t *client)
+{
+    of_sdwn_add_client_t *obj;
+    of_list_bsn_tlv_data_t *list;
+    of_ieee80211_ht_cap_t ht;
+    of_ieee80211_vht_cap_t vht;
+    of_bsn_tlv_data_t *tlv;
+    of_octets_t value;
+    of_desc_str_t supported_rates;
+
+    TEST_ASSERT((obj = of_sdwn_add_client_new(VERSION)) != NULL);
+    of_sdwn_add_client_xid_set(obj, 0x1234);
+    of_sdwn_add_client_client_set(obj, client->mac);
+    of_sdwn_add_client_ap_set(obj, client->ap);
+    of_sdwn_add_client_assoc_id_set(obj, client->assoc_id);
+    of_sdwn_add_client_capabilities_set(obj, client->capabilities);
+    of_sdwn_add_client_cap_flags_set(obj, client->cap_flags);
+    of_sdwn_add_client_ht_capabilities_bind(obj, &ht);
+    MEMCPY(OF_OBJECT_BUFFER_INDEX(&ht, 0), client->ht_capabilities,
+           LOCI_SDWN_HT_CAP_BYTES);
+    of_sdwn_add_client_vht_capabilities_bind(obj, &vht);
+    MEMCPY(OF_OBJECT_BUFFER_INDEX(&vht, 0), client->vht_capabilities,
+           LOCI_SDWN_VHT_CAP_BYTES);
+    MEMCPY(supported_rates, client->supported_rates, OF_DESC_STR_LEN);
+    of_sdwn_add_client_supported_rates_set(obj, supported_rates);
+
+    if (client->keys_len > 0) {
+        TEST_ASSERT((list = of_list_bsn_tlv_data_new(VERSION)) != NULL);
+        TEST_ASSERT((tlv = of_bsn_tlv_data_new(VERSION)) != NULL);
+        value.data = client->keys + 4;
+        value.bytes = client->keys_len - 4;
+        TEST_OK(of_bsn_tlv_data_value_set(tlv, &value));
+        TEST_OK(of_list_append(list, tlv));
+        TEST_OK(of_sdwn_add_client_keys_set(obj, list));
+        of_object_delete(tlv);
+        of_object_delete(list);
+    }
+
+    return obj;
+}
+
+static int
+test_sdwn_add_clients(void)
+{
+    loci_sdwn_client_t clients[N_CLIENTS], decoded[N_CLIENTS];
+    of_object_t *obj;
+    uint8_t buf[N_CLIENTS * 400];
+    uint8_t *copy;
+    of_port_no_t ap;
+    uint16_t assoc_id;
+    int i, len, more, next = 0, offset = 0;
+
+    for (i = 0; i < N_CLIENTS; i++) {
+        client_make(&clients[i], i, i < N_CLIENTS / 2 ?
+                    LOCI_SDWN_CLIENT_NORMAL : LOCI_SDWN_CLIENT_CRYPTO);
+        clients[i].ap = 100 + i;
+    }
+
+    /* Built with the setters, decoded in bulk */
+    for (i = 0; i < N_CLIENTS; i++) {
+        TEST_ASSERT((obj = add_client_object(&clients[i])) != NULL);
+        MEMCPY(buf + offset, OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+        offset += obj->length;
+        of_object_delete(obj);
+    }
+    TEST_ASSERT(loci_sdwn_clients_decode(buf, offset, decoded, N_CLIENTS,
+                                         &more) == N_CLIENTS);
+    TEST_ASSERT(more == 0);
+    for (i = 0; i < N_CLIENTS; i++) {
+        TEST_ASSERT(client_equal(&decoded[i], &clients[i]));
+    }
+
+    /* Encoded in bulk, the same bytes as the setters */
+    copy = MALLOC(offset);
+    TEST_ASSERT(copy != NULL);
+    MEMCPY(copy, buf, offset);
+    len = loci_sdwn_add_clients_encode(buf, sizeof(buf), 0x1234, clients,
+                                       N_CLIENTS, &next);
+    TEST_ASSERT(len == offset);
+    TEST_ASSERT(next == N_CLIENTS);
+    TEST_ASSERT(MEMCMP(buf, copy, len) == 0);
+    FREE(copy);
+
+    TEST_ASSERT((obj = message_object(buf)) != NULL);
+    TEST_ASSERT(obj->object_id == OF_SDWN_ADD_CLIENT);
+    of_sdwn_add_client_ap_get(obj, &ap);
+    TEST_ASSERT(ap == 100);
+    of_sdwn_add_client_assoc_id_get(obj, &assoc_id);
+    TEST_ASSERT(assoc_id == 1);
+    of_object_delete(obj);
+
+    return TEST_PASS;
+}
+
+static int
+test_sdwn_clients_errors(void)
+{
+    loci_sdwn_client_t clients[4], decoded[4], client;
+    uint8_t buf[2048];
+    int i, len, next = 0;
+
+    for (i = 0; i < 4; i++) {
+        client_make(&clients[i], i, LOCI_SDWN_CLIENT_CRYPTO);
+    }
+    len = loci_sdwn_clients_reply_encode(buf, sizeof(buf), 1, clients, 4,
+                                         &next);
+    TEST_ASSERT(len == 4 * (LOCI_SDWN_REPLY_BYTES + 4 + KEY_BYTES));
+
+    /* Too many clients for the records */
+    TEST_ASSERT(loci_sdwn_clients_decode(buf, len, decoded, 3, NULL) ==
+                OF_ERROR_RESOURCE);
+    /* Short */
+    TEST_ASSERT(loci_sdwn_client_peek(buf, 8, &client) == OF_ERROR_PARSE);
+    TEST_ASSERT(loci_sdwn_clients_decode(buf, len - 1, decoded, 4, NULL) ==
+                OF_ERROR_PARSE);
+
+    /* A key running past the end */
+    buf_u16_set(buf + LOCI_SDWN_REPLY_BYTES + 2, 4 + KEY_BYTES + 1);
+    TEST_ASSERT(loci_sdwn_client_peek(buf, len, &client) == OF_ERROR_PARSE);
+    buf_u16_set(buf + LOCI_SDWN_REPLY_BYTES + 2, 4 + KEY_BYTES);
+
+    /* A normal reply with keys */
+    buf_u8_set(buf + 24, LOCI_SDWN_CLIENT_NORMAL);
+    TEST_ASSERT(loci_sdwn_client_peek(buf, len, &client) == OF_ERROR_PARSE);
+    buf_u8_set(buf + 24, LOCI_SDWN_CLIENT_CRYPTO);
+    TEST_OK(loci_sdwn_client_peek(buf, len, &client));
+
+    /* Another experimenter, another version */
+    buf_u32_set(buf + 16, 0x5c16c7);
+    TEST_ASSERT(loci_sdwn_client_peek(buf, len, &client) == OF_ERROR_PARSE);
+    buf_u8_set(buf, OF_VERSION_1_4);
+    TEST_ASSERT(loci_sdwn_client_peek(buf, len, &client) == OF_ERROR_VERSION);
+
+    /* No room for a client */
+    next = 0;
+    TEST_ASSERT(loci_sdwn_clients_reply_encode(buf, LOCI_SDWN_REPLY_BYTES, 1,
+                                               clients, 4, &next) ==
+                OF_ERROR_RESOURCE);
+    TEST_ASSERT(next == 0);
+
+    /* An unknown type, or too many keys */
+    clients[0].type = 7;
+    TEST_ASSERT(loci_sdwn_clients_reply_encode(buf, sizeof(buf), 1, clients,
+                                               4, &next) == OF_ERROR_PARAM);
+    clients[0].keys_len = OF_WIRE_BUFFER_MAX_LENGTH;
+    TEST_ASSERT(loci_sdwn_add_clients_encode(buf, sizeof(buf), 1, clients,
+                                             4, &next) == OF_ERROR_PARAM);
+
+    return TEST_PASS;
+}
+
+int
+run_sdwn_client_tests(void)
+{
+    RUN_TEST(sdwn_clients_reply);
+    RUN_TEST(sdwn_add_clients);
+    RUN_TEST(sdwn_clients_errors);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,380 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the SDWN management frame fast path
+ *
+ * Peeks must read what the generated setters wrote, the filter must
+ * hold each client to its burst per window on a simulated clock, and
+ * replies built in place must be what the generated setters build.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_sdwn_mgmt.h>
+
+#define VERSION OF_VERSION_1_3
+
+/* Frame controls: version 0, type and subtype */
+#define FC_ASSOC_REQ 0x00
+#define FC_REASSOC_REQ 0x20
+#define FC_PROBE_REQ 0x40
+#define FC_BEACON 0x80
+#define FC_AUTH 0xb0
+#define FC_DATA 0x08
+
+static of_mac_addr_t
+client_mac(int i)
+{
+    of_mac_addr_t mac = { { 0x02, 0, 0, 0, i >> 8, i } };
+
+    return mac;
+}
+
+/* Append msg to buf at *offset, deleting it */
+static int
+append(uint8_t *buf, int *offset, of_object_t *msg)
+{
+    TEST_ASSERT(msg != NULL);
+    MEMCPY(buf + *offset, OF_OBJECT_BUFFER_INDEX(msg, 0), msg->length);
+    *offset += msg->length;
+    of_object_delete(msg);
+
+    return TEST_PASS;
+}
+
+static of_object_t *
+mgmt_event(uint8_t type, int client, of_port_no_t if_no)
+{
+    of_sdwn_ieee80211_mgmt_t *obj;
+    of_mac_addr_t target = { { 0x02, 0xaa, 0, 0, 0, 1 } };
+
+    TEST_ASSERT((obj = of_sdwn_ieee80211_mgmt_new(VERSION)) != NULL);
+    of_sdwn_ieee80211_mgmt_xid_set(obj, 0x100 + client);
+    of_sdwn_ieee80211_mgmt_ieee80211_type_set(obj, type);
+    of_sdwn_ieee80211_mgmt_addr_set(obj, client_mac(client));
+    of_sdwn_ieee80211_mgmt_target_set(obj, target);
+    of_sdwn_ieee80211_mgmt_ssi_set(obj, (uint32_t)-60 - client);
+    of_sdwn_ieee80211_mgmt_freq_set(obj, 2412 + 5 * client);
+    of_sdwn_ieee80211_mgmt_if_no_set(obj, if_no);
+
+    return obj;
+}
+
+static of_object_t *
+mgmt_packet_in(uint8_t frame_control, int client)
+{
+    of_sdwn_packet_in_t *obj;
+    of_mac_addr_t bcast = { { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } };
+    of_mac_addr_t bssid = { { 0x02, 0xbb, 0, 0, 0, 1 } };
+    uint8_t body[20];
+    of_octets_t frame = { body, sizeof(body) };
+    int i;
+
+    for (i = 0; i < (int)sizeof(body); i++) {
+        body[i] = client + i;
+    }
+    TEST_ASSERT((obj = of_sdwn_packet_in_new(VERSION)) != NULL);
+    of_sdwn_packet_in_xid_set(obj, 0x200 + client);
+    of_sdwn_packet_in_if_no_set(obj, 3);
+    of_sdwn_packet_in_hdr_version_type_set(obj, frame_control);
+    of_sdwn_packet_in_hdr_addr1_set(obj, bcast);
+    of_sdwn_packet_in_hdr_addr2_set(obj, client_mac(client));
+    of_sdwn_packet_in_hdr_addr3_set(obj, bssid);
+    of_sdwn_packet_in_hdr_seq_ctrl_set(obj, 0x1230 + client);
+    TEST_OK(of_sdwn_packet_in_frame_set(obj, &frame));
+
+    return obj;
+}
+
+static int
+test_sdwn_mgmt_peek(void)
+{
+    static const struct {
+        uint8_t frame_control;
+        uint8_t type;
+    } frames[] = {
+        { FC_ASSOC_REQ, IEEE80211_ASSOC },
+        { FC_REASSOC_REQ, IEEE80211_ASSOC },
+        { FC_PROBE_REQ, IEEE80211_PROBE },
+        { FC_AUTH, IEEE80211_AUTH },
+        { FC_BEACON, IEEE80211_MGMT },
+        { FC_DATA, IEEE80211_MGMT },
+    };
+    loci_sdwn_mgmt_t mgmt;
+    of_mac_addr_t mac;
+    uint8_t buf[256];
+    int i, len = 0;
+
+    TEST_ASSERT(append(buf, &len, mgmt_event(IEEE80211_PROBE, 7, 2)) ==
+                TEST_PASS);
+    TEST_OK(loci_sdwn_mgmt_peek(buf, len, &mgmt));
+    TEST_ASSERT(mgmt.object_id == OF_SDWN_IEEE80211_MGMT);
+    TEST_ASSERT(mgmt.msg == buf && mgmt.msg_len == LOCI_SDWN_MGMT_BYTES);
+    TEST_ASSERT(mgmt.xid == 0x107);
+    TEST_ASSERT(mgmt.type == IEEE80211_PROBE);
+    mac = client_mac(7);
+    TEST_ASSERT(MEMCMP(&mgmt.addr, &mac, sizeof(mac)) == 0);
+    TEST_ASSERT(mgmt.target.addr[1] == 0xaa);
+    TEST_ASSERT(mgmt.ssi == (uint32_t)-67);
+    TEST_ASSERT(mgmt.freq == 2447);
+    TEST_ASSERT(mgmt.if_no == 2);
+    TEST_ASSERT(mgmt.frame == NULL && mgmt.frame_len == 0);
+
+    for (i = 0; i < (int)(sizeof(frames) / sizeof(frames[0])); i++) {
+        len = 0;
+        TEST_ASSERT(append(buf, &len,
+                           mgmt_packet_in(frames[i].frame_control, i)) ==
+                    TEST_PASS);
+        TEST_OK(loci_sdwn_mgmt_peek(buf, len, &mgmt));
+        TEST_ASSERT(mgmt.object_id == OF_SDWN_PACKET_IN);
+        TEST_ASSERT(mgmt.type == frames[i].type);
+        TEST_ASSERT(mgmt.frame_control == frames[i].frame_control);
+        TEST_ASSERT(mgmt.xid == (uint32_t)(0x200 + i));
+        TEST_ASSERT(mgmt.if_no == 3);
+        mac = client_mac(i);
+        TEST_ASSERT(MEMCMP(&mgmt.addr, &mac, sizeof(mac)) == 0);
+        TEST_ASSERT(mgmt.target.addr[0] == 0xff);
+        TEST_ASSERT(mgmt.bssid.addr[1] == 0xbb);
+        TEST_ASSERT(mgmt.seq_ctrl == 0x1230 + i);
+        TEST_ASSERT(mgmt.frame == buf + 50 && mgmt.frame_len == 20);
+        TEST_ASSERT(mgmt.frame[19] == 19 + i);
+    }
+
+    /* Short, another version, another message, an unknown type */
+    TEST_ASSERT(loci_sdwn_mgmt_peek(buf, len - 1, &mgmt) == OF_ERROR_PARSE);
+    TEST_ASSERT(loci_sdwn_mgmt_peek(buf, 4, &mgmt) == OF_ERROR_PARSE);
+    buf_u32_set(buf + 12, 10);
+    TEST_ASSERT(loci_sdwn_mgmt_peek(buf, len, &mgmt) == OF_ERROR_PARSE);
+    buf_u8_set(buf, OF_VERSION_1_0);
+    TEST_ASSERT(loci_sdwn_mgmt_peek(buf, len, &mgmt) == OF_ERROR_VERSION);
+    len = 0;
+    TEST_ASSERT(append(buf, &len, mgmt_event(LOCI_SDWN_MGMT_TYPES, 1, 2)) ==
+                TEST_PASS);
+    TEST_ASSERT(loci_sdwn_mgmt_peek(buf, len, &mgmt) == OF_ERROR_PARSE);
+
+    return TEST_PASS;
+}
+
+static int
+test_sdwn_mgmt_filter(void)
+{
+    loci_sdwn_mgmt_filter_t filter;
+    loci_sdwn_mgmt_t probe, auth, other;
+
+    MEMSET(&probe, 0, sizeof(probe));
+    probe.type = IEEE80211_PROBE;
+    probe.addr = client_mac(1);
+    auth = probe;
+    auth.type = IEEE80211_AUTH;
+    other = probe;
+    other.addr = client_mac(2);
+
+    TEST_ASSERT(loci_sdwn_mgmt_filter_init(&filter, 0, 100, 1) ==
+                OF_ERROR_PARAM);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_init(&filter, 16, 100, 0) ==
+                OF_ERROR_PARAM);
+
+    /* Two per client and type each 100 ticks */
+    TEST_OK(loci_sdwn_mgmt_filter_init(&filter, 1000, 100, 2));
+    TEST_ASSERT(filter.mask == 1023);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1000) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1010) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1020) == 0);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1099) == 0);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &auth, 1099) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &other, 1099) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1100) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1150) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1199) == 0);
+    TEST_ASSERT(filter.passed == 6 && filter.dropped == 3);
+    loci_sdwn_mgmt_filter_cleanup(&filter);
+
+    /* Clients taking each other's slot start new windows */
+    TEST_OK(loci_sdwn_mgmt_filter_init(&filter, 1, 100, 1));
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 0) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 1) == 0);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &other, 2) == 1);
+    TEST_ASSERT(loci_sdwn_mgmt_filter_check(&filter, &probe, 3) == 1);
+    loci_sdwn_mgmt_filter_cleanup(&filter);
+
+    return TEST_PASS;
+}
+
+typedef struct handled_s {
+    int probes;
+    int auths;
+    int fail_at;
+    uint32_t last_xid;
+} handled_t;
+
+static int
+probe_handle(void *cookie, loci_sdwn_mgmt_t *mgmt)
+{
+    handled_t *handled = cookie;
+
+    if (mgmt->type != IEEE80211_PROBE) {
+        return OF_ERROR_PARAM;
+    }
+    handled->last_xid = mgmt->xid;
+    if (++handled->probes == handled->fail_at) {
+        return OF_ERROR_RESOURCE;
+    }
+    /* Answer the events in place; the dispatch goes on after them */
+    if (mgmt->object_id == OF_SDWN_IEEE80211_MGMT &&
+        loci_sdwn_mgmt_reply_build(mgmt->msg, mgmt->msg_len, 1) !=
+        LOCI_SDWN_MGMT_REPLY_BYTES) {
+        return OF_ERROR_PARAM;
+    }
+
+    return 0;
+}
+
+static int
+auth_handle(void *cookie, loci_sdwn_mgmt_t *mgmt)
+{
+    handled_t *handled = cookie;
+
+    handled->auths++;
+    handled->last_xid = mgmt->xid;
+
+    return mgmt->type == IEEE80211_AUTH ? 0 : OF_ERROR_PARAM;
+}
+
+/* A storm: 4 rounds of probes of 10 clients on 2 radios, with auths */
+static int
+storm_build(uint8_t *buf, int *len)
+{
+    int round, i;
+
+    *len = 0;
+    for (round = 0; round < 4; round++) {
+        for (i = 0; i < 10; i++) {
+            TEST_ASSERT(append(buf, len, mgmt_event(IEEE80211_PROBE, i, 1)) ==
+                        TEST_PASS);
+            TEST_ASSERT(append(buf, len, mgmt_event(IEEE80211_PROBE, i, 2)) ==
+                        TEST_PASS);
+            TEST_ASSERT(append(buf, len, mgmt_packet_in(FC_PROBE_REQ, i)) ==
+                        TEST_PASS);
+        }
+        TEST_ASSERT(append(buf, len, mgmt_packet_in(FC_AUTH, round)) ==
+                    TEST_PASS);
+        TEST_ASSERT(append(buf, len, mgmt_packet_in(FC_BEACON, round)) ==
+                    TEST_PASS);
+        TEST_ASSERT(append(buf, len, of_echo_request_new(VERSION)) ==
+                    TEST_PASS);
+    }
+
+    return TEST_PASS;
+}
+
+static int
+test_sdwn_mgmt_dispatch(void)
+{
+    loci_sdwn_mgmt_handler_f handlers[LOCI_SDWN_MGMT_TYPES] = { NULL };
+    loci_sdwn_mgmt_filter_t filter;
+    handled_t handled;
+    uint8_t buf[8192];
+    int len;
+
+    handlers[IEEE80211_PROBE] = probe_handle;
+    handlers[IEEE80211_AUTH] = auth_handle;
+
+    /* Everything with a handler */
+    TEST_ASSERT(storm_build(buf, &len) == TEST_PASS);
+    MEMSET(&handled, 0, sizeof(handled));
+    TEST_ASSERT(loci_sdwn_mgmt_dispatch(buf, len, handlers, NULL, 0,
+                                        &handled) == 4 * 31);
+    TEST_ASSERT(handled.probes == 4 * 30 && handled.auths == 4);
+    TEST_ASSERT(handled.last_xid == 0x203);
+
+    /* Once per client and type in the window; the auths of 4 clients */
+    TEST_ASSERT(storm_build(buf, &len) == TEST_PASS);
+    MEMSET(&handled, 0, sizeof(handled));
+    TEST_OK(loci_sdwn_mgmt_filter_init(&filter, 256, 1000, 1));
+    TEST_ASSERT(loci_sdwn_mgmt_dispatch(buf, len, handlers, &filter, 5,
+                                        &handled) == 14);
+    TEST_ASSERT(handled.probes == 10 && handled.auths == 4);
+    TEST_ASSERT(filter.passed == 14 && filter.dropped == 4 * 30 - 10);
+
+    /* The next window */
+    TEST_ASSERT(storm_build(buf, &len) == TEST_PASS);
+    TEST_ASSERT(loci_sdwn_mgmt_dispatch(buf, len, handlers, &filter, 1005,
+                                        &handled) == 14);
+    loci_sdwn_mgmt_filter_cleanup(&filter);
+
+    /* A handler's error stops the dispatch */
+    TEST_ASSERT(storm_build(buf, &len) == TEST_PASS);
+    MEMSET(&handled, 0, sizeof(handled));
+    handled.fail_at = 5;
+    TEST_ASSERT(loci_sdwn_mgmt_dispatch(buf, len, handlers, NULL, 0,
+                                        &handled) == OF_ERROR_RESOURCE);
+    TEST_ASSERT(handled.probes == 5);
+
+    /* Cut short */
+    TEST_ASSERT(storm_build(buf, &len) == TEST_PASS);
+    TEST_ASSERT(loci_sdwn_mgmt_dispatch(buf, len - 1, handlers, NULL, 0,
+                                        &handled) == OF_ERROR_PARSE);
+
+    return TEST_PASS;
+}
+
+static int
+test_sdwn_mgmt_reply(void)
+{
+    of_sdwn_ieee80211_mgmt_reply_t *reply;
+    of_object_t *obj;
+    uint8_t buf[256], *copy;
+    uint32_t xid;
+    of_port_no_t if_no;
+    uint8_t deny;
+    int len = 0;
+
+    TEST_ASSERT(append(buf, &len, mgmt_event(IEEE80211_ASSOC, 9, 0x1234567)) ==
+                TEST_PASS);
+    TEST_ASSERT(loci_sdwn_mgmt_reply_build(buf, len, 1) ==
+                LOCI_SDWN_MGMT_REPLY_BYTES);
+
+    /* The same bytes as the setters */
+    TEST_ASSERT((reply = of_sdwn_ieee80211_mgmt_reply_new(VERSION)) != NULL);
+    of_sdwn_ieee80211_mgmt_reply_xid_set(reply, 0x109);
+    of_sdwn_ieee80211_mgmt_reply_if_no_set(reply, 0x1234567);
+    of_sdwn_ieee80211_mgmt_reply_deny_set(reply, 1);
+    TEST_ASSERT(reply->length == LOCI_SDWN_MGMT_REPLY_BYTES);
+    TEST_ASSERT(MEMCMP(buf, OF_OBJECT_BUFFER_INDEX(reply, 0),
+                       LOCI_SDWN_MGMT_REPLY_BYTES) == 0);
+    of_object_delete(reply);
+
+    TEST_ASSERT((copy = MALLOC(LOCI_SDWN_MGMT_REPLY_BYTES)) != NULL);
+    MEMCPY(copy, buf, LOCI_SDWN_MGMT_REPLY_BYTES);
+    obj = of_object_new_from_message(OF_BUFFER_TO_MESSAGE(copy),
+                                     LOCI_SDWN_MGMT_REPLY_BYTES);
+    TEST_ASSERT(obj != NULL);
+    TEST_ASSERT(obj->object_id == OF_SDWN_IEEE80211_MGMT_REPLY);
+    of_sdwn_ieee80211_mgmt_reply_xid_get(obj, &xid);
+    of_sdwn_ieee80211_mgmt_reply_if_no_get(obj, &if_no);
+    of_sdwn_ieee80211_mgmt_reply_deny_get(obj, &deny);
+    TEST_ASSERT(xid == 0x109 && if_no == 0x1234567 && deny == 1);
+    of_object_delete(obj);
+
+    /* Only over an of_sdwn_ieee80211_mgmt */
+    TEST_ASSERT(loci_sdwn_mgmt_reply_build(buf, len, 0) == OF_ERROR_PARSE);
+    len = 0;
+    TEST_ASSERT(append(buf, &len, mgmt_packet_in(FC_PROBE_REQ, 1)) ==
+                TEST_PASS);
+    TEST_ASSERT(loci_sdwn_mgmt_reply_build(buf, len, 0) == OF_ERROR_PARSE);
+
+    return TEST_PASS;
+}
+
+int
+run_sdwn_mgmt_tests(void)
+{
+    RUN_TEST(sdwn_mgmt_peek);
+    RUN_TEST(sdwn_mgmt_filter);
+    RUN_TEST(sdwn_mgmt_dispatch);
+    RUN_TEST(sdwn_mgmt_reply);
+
+    return TEST_PASS;
+}
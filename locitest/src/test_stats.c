@@ -0,0 +1,199 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the instrumentation counters
+ *
+ * The counts are only checked when LOCI is built with LOCI_STATS_ENABLE;
+ * otherwise snapshots must stay zero.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_stats.h>
+#include <loci/loci_validator.h>
+
+static loci_stats_t before, after;
+
+#define DELTA(field) (after.field - before.field)
+#define OBJ_DELTA(id, field) DELTA(objects[id].field)
+
+static int
+show_writer(void *cookie, const char *fmt, ...)
+{
+    int *count = cookie;
+
+    (*count)++;
+    return 0;
+}
+
+static int
+test_stats_disabled(void)
+{
+    static loci_stats_t zero;
+    of_echo_request_t *obj;
+
+    if (LOCI_STATS_ENABLED) {
+        return TEST_PASS;
+    }
+
+    obj = of_echo_request_new(OF_VERSION_1_0);
+    TEST_ASSERT(obj != NULL);
+    of_echo_request_delete(obj);
+
+    loci_stats_snapshot(&after);
+    TEST_ASSERT(memcmp(&after, &zero, sizeof(zero)) == 0);
+
+    return TEST_PASS;
+}
+
+static int
+test_stats_objects(void)
+{
+    of_echo_request_t *obj, *dup;
+    uint8_t *msg_buf;
+    int len;
+
+    if (!LOCI_STATS_ENABLED) {
+        return TEST_PASS;
+    }
+
+    loci_stats_snapshot(&before);
+
+    obj = of_echo_request_new(OF_VERSION_1_3);
+    TEST_ASSERT(obj != NULL);
+    dup = of_object_dup(obj);
+    TEST_ASSERT(dup != NULL);
+    of_echo_request_delete(dup);
+
+    len = obj->length;
+    of_object_wire_buffer_steal(obj, &msg_buf);
+    TEST_ASSERT(msg_buf != NULL);
+    of_echo_request_delete(obj);
+
+    obj = of_object_new_from_message(OF_BUFFER_TO_MESSAGE(msg_buf), len);
+    TEST_ASSERT(obj != NULL);
+    of_object_delete(obj);
+
+    loci_stats_snapshot(&after);
+    TEST_ASSERT(OBJ_DELTA(OF_ECHO_REQUEST, allocs) == 3);
+    TEST_ASSERT(OBJ_DELTA(OF_ECHO_REQUEST, alloc_bytes) >=
+                OF_WIRE_BUFFER_MAX_LENGTH + len);
+    TEST_ASSERT(OBJ_DELTA(OF_ECHO_REQUEST, frees) == 3);
+    TEST_ASSERT(OBJ_DELTA(OF_ECHO_REQUEST, parses) == 1);
+
+    return TEST_PASS;
+}
+
+static int
+test_stats_validate(void)
+{
+    of_echo_request_t *obj;
+    uint8_t msg[OF_MESSAGE_MIN_LENGTH];
+
+    if (!LOCI_STATS_ENABLED) {
+        return TEST_PASS;
+    }
+
+    obj = of_echo_request_new(OF_VERSION_1_3);
+    TEST_ASSERT(obj != NULL);
+    memcpy(msg, OF_OBJECT_TO_MESSAGE(obj), sizeof(msg));
+    of_echo_request_delete(obj);
+
+    loci_stats_snapshot(&before);
+
+    /* Length field disagrees with the buffer */
+    TEST_ASSERT(of_validate_message(msg, sizeof(msg) - 1) < 0);
+
+    /* Unknown version */
+    msg[0] = 0x7f;
+    TEST_ASSERT(of_validate_message(msg, sizeof(msg)) < 0);
+
+    loci_stats_snapshot(&after);
+    TEST_ASSERT(OBJ_DELTA(OF_HEADER, validate_failures[LOCI_STATS_VALIDATE_LENGTH]) == 1);
+    TEST_ASSERT(OBJ_DELTA(OF_HEADER, validate_failures[LOCI_STATS_VALIDATE_VERSION]) == 1);
+
+    return TEST_PASS;
+}
+
+static int
+test_stats_list_append(void)
+{
+    of_flow_stats_reply_t *obj;
+    of_list_flow_stats_entry_t list;
+    of_flow_stats_entry_t element;
+    int rv;
+
+    if (!LOCI_STATS_ENABLED) {
+        return TEST_PASS;
+    }
+
+    loci_stats_snapshot(&before);
+
+    obj = of_flow_stats_reply_new(OF_VERSION_1_0);
+    TEST_ASSERT(obj != NULL);
+    of_flow_stats_reply_entries_bind(obj, &list);
+    do {
+        of_flow_stats_entry_init(&element, OF_VERSION_1_0, -1, 1);
+        rv = of_list_flow_stats_entry_append_bind(&list, &element);
+    } while (rv == OF_ERROR_NONE);
+    TEST_ASSERT(rv == OF_ERROR_RESOURCE);
+    of_flow_stats_reply_delete(obj);
+
+    loci_stats_snapshot(&after);
+    TEST_ASSERT(OBJ_DELTA(OF_LIST_FLOW_STATS_ENTRY, list_append_failures) == 1);
+
+    return TEST_PASS;
+}
+
+static int
+test_stats_replace_data(void)
+{
+    of_packet_in_t *obj;
+    of_match_t match;
+    uint8_t data[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    of_octets_t octets = { data, sizeof(data) };
+    int count = 0;
+
+    if (!LOCI_STATS_ENABLED) {
+        return TEST_PASS;
+    }
+
+    obj = of_packet_in_new(OF_VERSION_1_3);
+    TEST_ASSERT(obj != NULL);
+    memset(&match, 0, sizeof(match));
+    TEST_OK(of_packet_in_match_set(obj, &match));
+    TEST_OK(of_packet_in_data_set(obj, &octets));
+
+    loci_stats_snapshot(&before);
+
+    /* Growing the match moves the data behind it */
+    match.fields.in_port = 1;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+    TEST_OK(of_packet_in_match_set(obj, &match));
+
+    loci_stats_snapshot(&after);
+    TEST_ASSERT(DELTA(replace_data_calls) >= 1);
+    TEST_ASSERT(DELTA(replace_data_move_bytes) >= sizeof(data));
+
+    of_packet_in_delete(obj);
+
+    loci_stats_snapshot(&after);
+    loci_stats_show(show_writer, &count, &after);
+    TEST_ASSERT(count > 1);
+
+    return TEST_PASS;
+}
+
+int
+run_stats_tests(void)
+{
+    RUN_TEST(stats_disabled);
+    RUN_TEST(stats_objects);
+    RUN_TEST(stats_validate);
+    RUN_TEST(stats_list_append);
+    RUN_TEST(stats_replace_data);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,293 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test message templates
+ *
+ * An instance of a template patched with some values must be byte for
+ * byte the message built with the same values through the setters.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_template.h>
+
+typedef struct flow_values_s {
+    uint32_t xid;
+    uint64_t cookie;
+    uint32_t ipv4_dst;
+    uint16_t tcp_dst;
+    of_mac_addr_t eth_src;
+    of_port_no_t port;
+} flow_values_t;
+
+static void
+flow_match_init(of_match_t *match, of_version_t version,
+                const flow_values_t *v)
+{
+    MEMSET(match, 0, sizeof(*match));
+    match->version = version;
+    match->fields.in_port = 1;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(match);
+    match->fields.eth_type = 0x0800;
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(match);
+    match->fields.eth_src = v->eth_src;
+    OF_MATCH_MASK_ETH_SRC_EXACT_SET(match);
+    match->fields.ip_proto = 6;
+    OF_MATCH_MASK_IP_PROTO_EXACT_SET(match);
+    match->fields.ipv4_dst = v->ipv4_dst;
+    OF_MATCH_MASK_IPV4_DST_EXACT_SET(match);
+    match->fields.tcp_dst = v->tcp_dst;
+    OF_MATCH_MASK_TCP_DST_EXACT_SET(match);
+}
+
+/*
+ * A flow_add sending to one port; on return output is the output
+ * action, bound in the message.
+ */
+static of_flow_add_t *
+flow_add_build(of_version_t version, const flow_values_t *v,
+               of_match_t *match, of_action_output_t *output)
+{
+    of_flow_add_t *obj;
+    of_list_instruction_t instructions;
+    of_instruction_apply_actions_t apply;
+    of_list_action_t actions;
+
+    obj = of_flow_add_new(version);
+    of_flow_add_xid_set(obj, v->xid);
+    of_flow_add_cookie_set(obj, v->cookie);
+    of_flow_add_priority_set(obj, 1000);
+    of_flow_add_idle_timeout_set(obj, 10);
+    flow_match_init(match, version, v);
+    if (of_flow_add_match_set(obj, match) < 0) {
+        of_flow_add_delete(obj);
+        return NULL;
+    }
+
+    if (version == OF_VERSION_1_0) {
+        of_flow_add_actions_bind(obj, &actions);
+    } else {
+        of_flow_add_instructions_bind(obj, &instructions);
+        of_instruction_apply_actions_init(&apply, version, -1, 1);
+        if (of_list_instruction_append_bind(&instructions, &apply) < 0) {
+            of_flow_add_delete(obj);
+            return NULL;
+        }
+        of_instruction_apply_actions_actions_bind(&apply, &actions);
+    }
+    of_action_output_init(output, version, -1, 1);
+    if (of_list_action_append_bind(&actions, output) < 0) {
+        of_flow_add_delete(obj);
+        return NULL;
+    }
+    of_action_output_port_set(output, v->port);
+    of_action_output_max_len_set(output, 0xffff);
+
+    return obj;
+}
+
+static int
+test_template_flow_add(void)
+{
+    static const flow_values_t v1 = {
+        1, 0x1122334455667788ULL, 0x0a000001, 80,
+        { { 0x02, 0, 0, 0, 0, 1 } }, 3
+    };
+    static const flow_values_t v2 = {
+        0xdeadbeef, 0x0102030405060708ULL, 0xc0a80102, 443,
+        { { 0x02, 0x11, 0x22, 0x33, 0x44, 0x55 } }, 17
+    };
+    loci_template_t t;
+    of_flow_add_t *obj, *expect;
+    of_action_output_t output, output2;
+    of_match_t match, match2;
+    uint8_t buf[512], *before;
+    int version, xid, cookie, dst, tp_dst, eth_src, port;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        if (version == OF_VERSION_1_1) {
+            /* The 1.1 wire match can't wildcard the fields left out */
+            continue;
+        }
+        obj = flow_add_build(version, &v1, &match, &output);
+        TEST_ASSERT(obj != NULL);
+        before = MALLOC(obj->length);
+        MEMCPY(before, OF_OBJECT_TO_MESSAGE(obj), obj->length);
+
+        TEST_OK(loci_template_init(&t, obj));
+        TEST_ASSERT((xid = loci_template_field_u32(&t, obj,
+                                                   of_flow_add_xid_set)) >= 0);
+        TEST_ASSERT((cookie = loci_template_field_u64(
+                         &t, obj, of_flow_add_cookie_set)) >= 0);
+        TEST_ASSERT((dst = loci_template_field_match(
+                         &t, of_flow_add_match_set, &match, "ipv4_dst")) >= 0);
+        TEST_ASSERT((tp_dst = loci_template_field_match(
+                         &t, of_flow_add_match_set, &match, "tcp_dst")) >= 0);
+        TEST_ASSERT((eth_src = loci_template_field_match(
+                         &t, of_flow_add_match_set, &match, "eth_src")) >= 0);
+        TEST_ASSERT((port = loci_template_field_u32(
+                         &t, &output, of_action_output_port_set)) >= 0);
+        TEST_ASSERT(t.fields[eth_src].width == OF_MAC_ADDR_BYTES);
+        TEST_ASSERT(t.fields[port].width ==
+                    (version == OF_VERSION_1_0 ? 2 : 4));
+
+        /* Probing leaves the message as it was */
+        TEST_ASSERT(obj->length == t.length);
+        TEST_ASSERT(memcmp(before, OF_OBJECT_TO_MESSAGE(obj), obj->length) == 0);
+        FREE(before);
+
+        TEST_ASSERT(t.length <= (int)sizeof(buf));
+        loci_template_instance(&t, buf);
+        TEST_ASSERT(memcmp(buf, OF_OBJECT_TO_MESSAGE(obj), t.length) == 0);
+        loci_template_patch(&t, buf, xid, v2.xid);
+        loci_template_patch(&t, buf, cookie, v2.cookie);
+        loci_template_patch(&t, buf, dst, v2.ipv4_dst);
+        loci_template_patch(&t, buf, tp_dst, v2.tcp_dst);
+        loci_template_patch_bytes(&t, buf, eth_src, &v2.eth_src);
+        loci_template_patch(&t, buf, port, v2.port);
+
+        expect = flow_add_build(version, &v2, &match2, &output2);
+        TEST_ASSERT(expect != NULL);
+        TEST_ASSERT(expect->length == t.length);
+        TEST_ASSERT(memcmp(buf, OF_OBJECT_TO_MESSAGE(expect), t.length) == 0);
+
+        of_flow_add_delete(expect);
+        loci_template_cleanup(&t);
+        of_flow_add_delete(obj);
+    }
+
+    return TEST_PASS;
+}
+
+static of_packet_out_t *
+packet_out_build(of_version_t version, uint32_t xid, of_port_no_t in_port,
+                 of_port_no_t port, of_action_output_t *output)
+{
+    static uint8_t data[60] = { 0x02, 0, 0, 0, 0, 1, 0x02, 0, 0, 0, 0, 2 };
+    of_packet_out_t *obj;
+    of_list_action_t *actions, list;
+    of_octets_t octets = { data, sizeof(data) };
+
+    obj = of_packet_out_new(version);
+    of_packet_out_xid_set(obj, xid);
+    of_packet_out_buffer_id_set(obj, -1);
+    of_packet_out_in_port_set(obj, in_port);
+
+    actions = of_list_action_new(version);
+    of_action_output_init(output, version, -1, 1);
+    if (of_list_action_append_bind(actions, output) < 0) {
+        of_list_action_delete(actions);
+        of_packet_out_delete(obj);
+        return NULL;
+    }
+    of_action_output_port_set(output, port);
+    if (of_packet_out_actions_set(obj, actions) < 0 ||
+        of_packet_out_data_set(obj, &octets) < 0) {
+        of_list_action_delete(actions);
+        of_packet_out_delete(obj);
+        return NULL;
+    }
+    of_list_action_delete(actions);
+
+    /* The output action in the message */
+    of_packet_out_actions_bind(obj, &list);
+    if (of_list_action_first(&list, output) < 0) {
+        of_packet_out_delete(obj);
+        return NULL;
+    }
+
+    return obj;
+}
+
+static int
+test_template_packet_out(void)
+{
+    loci_template_t t;
+    of_packet_out_t *obj, *expect;
+    of_action_output_t output, output2;
+    uint8_t buf[256];
+    int version, xid, in_port, port;
+
+    for (version = OF_VERSION_1_0; version <= OF_VERSION_1_4; version++) {
+        obj = packet_out_build(version, 1, 2, 3, &output);
+        TEST_ASSERT(obj != NULL);
+
+        TEST_OK(loci_template_init(&t, obj));
+        TEST_ASSERT((xid = loci_template_field_u32(
+                         &t, obj, of_packet_out_xid_set)) >= 0);
+        TEST_ASSERT((in_port = loci_template_field_u32(
+                         &t, obj, of_packet_out_in_port_set)) >= 0);
+        TEST_ASSERT((port = loci_template_field_u32(
+                         &t, &output, of_action_output_port_set)) >= 0);
+
+        loci_template_instance(&t, buf);
+        loci_template_patch(&t, buf, xid, 1000);
+        loci_template_patch(&t, buf, in_port, 20);
+        loci_template_patch(&t, buf, port, 30);
+
+        expect = packet_out_build(version, 1000, 20, 30, &output2);
+        TEST_ASSERT(expect != NULL);
+        TEST_ASSERT(memcmp(buf, OF_OBJECT_TO_MESSAGE(expect), t.length) == 0);
+
+        of_packet_out_delete(expect);
+        loci_template_cleanup(&t);
+        of_packet_out_delete(obj);
+    }
+
+    return TEST_PASS;
+}
+
+/* Fields that can't be patched in place are refused */
+static int
+test_template_refused(void)
+{
+    static const flow_values_t v = {
+        1, 2, 0x0a000001, 80, { { 0x02, 0, 0, 0, 0, 1 } }, 3
+    };
+    loci_template_t t;
+    of_flow_add_t *obj;
+    of_action_output_t output, other;
+    of_match_t match;
+    uint8_t *before;
+
+    obj = flow_add_build(OF_VERSION_1_3, &v, &match, &output);
+    TEST_ASSERT(obj != NULL);
+    before = MALLOC(obj->length);
+    MEMCPY(before, OF_OBJECT_TO_MESSAGE(obj), obj->length);
+    TEST_OK(loci_template_init(&t, obj));
+
+    /* Not in the match */
+    TEST_ASSERT(loci_template_field_match(&t, of_flow_add_match_set, &match,
+                                          "udp_dst") < 0);
+    TEST_ASSERT(loci_template_field_match(&t, of_flow_add_match_set, &match,
+                                          "no_such_field") < 0);
+    /* Masked */
+    match.masks.ipv4_dst = 0xffffff00;
+    TEST_ASSERT(loci_template_field_match(&t, of_flow_add_match_set, &match,
+                                          "ipv4_dst") < 0);
+    /* Not bound in the message */
+    of_action_output_init(&other, OF_VERSION_1_3, -1, 1);
+    TEST_ASSERT(loci_template_field_u32(&t, &other,
+                                        of_action_output_port_set) < 0);
+    TEST_ASSERT(t.field_count == 0);
+
+    TEST_ASSERT(obj->length == t.length);
+    TEST_ASSERT(memcmp(before, OF_OBJECT_TO_MESSAGE(obj), obj->length) == 0);
+    FREE(before);
+    loci_template_cleanup(&t);
+    of_flow_add_delete(obj);
+
+    return TEST_PASS;
+}
+
+int
+run_template_tests(void)
+{
+    RUN_TEST(template_flow_add);
+    RUN_TEST(template_packet_out);
+    RUN_TEST(template_refused);
+
+    return TEST_PASS;
+}
@@ -0,0 +1,65 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/**
+ * Test the static tracepoints
+ *
+ * Without LOCI_TRACE_ENABLE the probes must compile away entirely,
+ * including their arguments.
+ */
+
+#include <locitest/test_common.h>
+#include <loci/loci_trace.h>
+
+static int
+test_trace_compiled_out(void)
+{
+    int evaluated = 0;
+
+    if (LOCI_TRACE_ENABLED) {
+        return TEST_PASS;
+    }
+
+    /* Neither expands to code that could touch the arguments */
+    LOCI_TRACE(object_new, evaluated++, evaluated++);
+    LOCI_TRACE_OBJECT(object_delete, (evaluated++, (of_object_t *)NULL));
+    TEST_ASSERT(evaluated == 0);
+
+    return TEST_PASS;
+}
+
+static int
+test_trace_xid(void)
+{
+#if LOCI_TRACE_ENABLED
+    of_echo_request_t *msg;
+    of_action_output_t *action;
+
+    /* No tracer is attached while the tests run */
+    TEST_ASSERT(!LOCI_TRACE_ACTIVE(object_new));
+
+    msg = of_echo_request_new(OF_VERSION_1_3);
+    TEST_ASSERT(msg != NULL);
+    of_echo_request_xid_set(msg, 0x12345678);
+    TEST_ASSERT(loci_trace_xid(msg) == 0x12345678);
+    of_echo_request_delete(msg);
+
+    action = of_action_output_new(OF_VERSION_1_3);
+    TEST_ASSERT(action != NULL);
+    TEST_ASSERT(loci_trace_xid(action) == 0);
+    of_action_output_delete(action);
+#endif
+
+    return TEST_PASS;
+}
+
+int
+run_trace_tests(void)
+{
+    RUN_TEST(trace_compiled_out);
+    RUN_TEST(trace_xid);
+
+    return TEST_PASS;
+}